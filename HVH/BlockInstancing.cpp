@@ -0,0 +1,60 @@
+#include "BlockInstancing.h"
+#include <cmath>
+#include <cstring>
+
+static void MakeTranslation(BlockInstance& inst, float x, float y, float z)
+{
+    memset(&inst, 0, sizeof(inst));
+    inst.row[0][0] = 1.0f;
+    inst.row[1][1] = 1.0f;
+    inst.row[2][2] = 1.0f;
+    inst.row[3][0] = x;
+    inst.row[3][1] = y;
+    inst.row[3][2] = z;
+    inst.row[3][3] = 1.0f;
+}
+
+// scale * rotation(roll, pitch, yaw) * translation, same as the old per-object path
+static void MakeObjectTransform(BlockInstance& inst, const InstanceObject& obj)
+{
+    float cp = cosf(obj.rotation[0]), sp = sinf(obj.rotation[0]);
+    float cy = cosf(obj.rotation[1]), sy = sinf(obj.rotation[1]);
+    float cr = cosf(obj.rotation[2]), sr = sinf(obj.rotation[2]);
+
+    float r[3][3] = {
+        { cr * cy + sr * sp * sy, sr * cp, sr * sp * cy - cr * sy },
+        { cr * sp * sy - sr * cy, cr * cp, sr * sy + cr * sp * cy },
+        { cp * sy,               -sp,      cp * cy },
+    };
+
+    for (int i = 0; i < 3; ++i) {
+        for (int j = 0; j < 3; ++j) {
+            inst.row[i][j] = r[i][j] * obj.scale[i];
+        }
+        inst.row[i][3] = 0.0f;
+    }
+    inst.row[3][0] = obj.position[0];
+    inst.row[3][1] = obj.position[1];
+    inst.row[3][2] = obj.position[2];
+    inst.row[3][3] = 1.0f;
+}
+
+void BuildInstanceList(const VoxelWorld* world, const InstanceObject* objects, size_t objectCount, InstanceList& out)
+{
+    size_t total = (world ? world->GetBlockCount() : 0) + objectCount;
+    out.instances.resize(total);
+    size_t n = 0;
+
+    if (world) {
+        world->ForEachBlock([&](int x, int y, int z, BlockId id) {
+            MakeTranslation(out.instances[n], (float)x, (float)y, (float)z);
+            out.instances[n++].layer = (uint32_t)BlockRegistry::Get(id).texture;
+            });
+    }
+
+    for (size_t i = 0; i < objectCount; ++i) {
+        MakeObjectTransform(out.instances[n], objects[i]);
+        out.instances[n++].layer = (uint32_t)BlockRegistry::Get(objects[i].block).texture;
+    }
+    out.instances.resize(n);
+}
@@ -0,0 +1,32 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include "VoxelWorld.h"
+#include "BlockRegistry.h"
+
+// Per-instance data for the instanced block shader: a row-major world matrix
+// laid out for row vectors (v * M), matching XMMATRIX without the transpose,
+// and the block texture array slice to sample.
+struct BlockInstance {
+    float row[4][4];
+    uint32_t layer;   // BlockTexture
+};
+
+// Object that doesn't fit the voxel grid (rotated/scaled), in engine units.
+struct InstanceObject {
+    float position[3];
+    float rotation[3]; // pitch, yaw, roll like XMMatrixRotationRollPitchYaw
+    float scale[3];
+    BlockId block;
+};
+
+struct InstanceList {
+    std::vector<BlockInstance> instances;
+};
+
+// Builds the per-frame instance list: every voxel (world may be null when the
+// voxels are drawn as chunk meshes) plus every object, in map order. Each
+// instance carries its texture slice, so the whole list is one
+// DrawIndexedInstanced. No D3D dependency.
+void BuildInstanceList(const VoxelWorld* world, const InstanceObject* objects, size_t objectCount, InstanceList& out);
@@ -0,0 +1,92 @@
+#include "BlockRegistry.h"
+#include <mutex>
+#include <unordered_map>
+
+namespace {
+
+    // Adding a block kind is a new row here. Keep the order stable,
+    // ids are the row index and are shared with network peers.
+    const BlockDef builtinBlocks[] = {
+        //  name     texture                solid  opaque creative
+        { "",      BlockTexture::Checker, false, false, false }, // air
+        { "grass", BlockTexture::Grass,   true,  true,  true  },
+        { "stone", BlockTexture::Stone,   true,  true,  true  },
+        { "wood",  BlockTexture::Wood,    true,  true,  true  },
+        { "metal", BlockTexture::Metal,   true,  true,  true  },
+        { "brick", BlockTexture::Brick,   true,  true,  true  },
+        { "dirt",  BlockTexture::Dirt,    true,  true,  true  },
+        { "water", BlockTexture::Water,   true,  true,  true  },
+        { "lava",  BlockTexture::Lava,    true,  true,  true  },
+        { "cube",  BlockTexture::Checker, true,  true,  true  },
+    };
+
+    // Runtime names are capped so defs never reallocates; the render thread
+    // reads it without taking the lock.
+    const size_t MAX_BLOCK_TYPES = 1024;
+
+    struct Registry {
+        std::vector<BlockDef> defs;
+        std::unordered_map<std::string, BlockId> ids;
+        std::vector<BlockId> creative;
+        std::mutex mutex;
+
+        Registry() {
+            defs.reserve(MAX_BLOCK_TYPES);
+            for (const BlockDef& def : builtinBlocks) {
+                BlockId id = (BlockId)defs.size();
+                defs.push_back(def);
+                if (id != BLOCK_AIR) ids[def.name] = id;
+                if (def.creative) creative.push_back(id);
+            }
+        }
+    };
+
+    Registry& GetRegistry()
+    {
+        static Registry registry;
+        return registry;
+    }
+}
+
+BlockId BlockRegistry::Find(const std::string& name)
+{
+    Registry& reg = GetRegistry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    auto it = reg.ids.find(name);
+    return it != reg.ids.end() ? it->second : BLOCK_AIR;
+}
+
+BlockId BlockRegistry::Intern(const std::string& name)
+{
+    Registry& reg = GetRegistry();
+    std::lock_guard<std::mutex> lock(reg.mutex);
+    auto it = reg.ids.find(name);
+    if (it != reg.ids.end()) return it->second;
+
+    if (name.empty() || reg.defs.size() >= MAX_BLOCK_TYPES) {
+        return reg.ids["cube"];
+    }
+
+    BlockDef def = { name, BlockTexture::Checker, true, true, false };
+    BlockId id = (BlockId)reg.defs.size();
+    reg.defs.push_back(def);
+    reg.ids[name] = id;
+    return id;
+}
+
+const BlockDef& BlockRegistry::Get(BlockId id)
+{
+    Registry& reg = GetRegistry();
+    if (id >= reg.defs.size()) return reg.defs[BLOCK_AIR];
+    return reg.defs[id];
+}
+
+size_t BlockRegistry::GetCount()
+{
+    return GetRegistry().defs.size();
+}
+
+const std::vector<BlockId>& BlockRegistry::GetCreativeBlocks()
+{
+    return GetRegistry().creative;
+}
@@ -0,0 +1,45 @@
+#pragma once
+#include <string>
+#include <vector>
+#include "VoxelWorld.h"
+
+// Texture a block samples, the engine maps these to its SRVs.
+enum class BlockTexture : uint8_t {
+    Checker,
+    Grass,
+    Stone,
+    Wood,
+    Metal,
+    Brick,
+    Dirt,
+    Water,
+    Lava,
+};
+const int BLOCK_TEXTURE_COUNT = (int)BlockTexture::Lava + 1;
+
+struct BlockDef {
+    std::string name;
+    BlockTexture texture;
+    bool solid;       // takes part in player/camera collision
+    bool opaque;      // hides the faces of neighbouring blocks
+    bool creative;    // listed in the creative inventory
+};
+
+// Block type names interned to small ids once, at load/parse time.
+// Built-in blocks come from a static table so their ids match on every peer;
+// unknown names (e.g. from an old map file) are appended at runtime and drawn
+// with the checker texture.
+class BlockRegistry
+{
+public:
+    // Returns BLOCK_AIR if the name is not registered.
+    static BlockId Find(const std::string& name);
+    // Like Find, but registers unknown names.
+    static BlockId Intern(const std::string& name);
+
+    static const BlockDef& Get(BlockId id);
+    static const std::string& GetName(BlockId id) { return Get(id).name; }
+    static size_t GetCount();
+
+    static const std::vector<BlockId>& GetCreativeBlocks();
+};
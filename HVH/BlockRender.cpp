@@ -0,0 +1,375 @@
+﻿#include "GameEngine.h"
+#include <chrono>
+
+bool GameEngine::CreateBlockShaders()
+{
+    HRESULT hr = S_OK; ID3DBlob* err = nullptr;
+
+    // the slice isn't interpolated, every vertex of a face carries the same one
+    const char* frameSource = R"(
+struct PS_INPUT {
+    float4 position:SV_POSITION; float3 worldPos:TEXCOORD0; float3 normal:TEXCOORD1; float2 uv:TEXCOORD2;
+    nointerpolation uint layer:TEXCOORD3;
+};
+cbuffer FrameBuffer : register(b0){
+    matrix View; matrix Projection;
+    float3 CameraPos; float _pad0;
+    float3 LightDir;  float _pad1;
+    float3 LightColor;float _pad2;
+    float3 Ambient;   float _pad3;
+};
+)";
+
+    const char* instancedSource = R"(
+struct VS_INPUT {
+    float3 position:POSITION; float3 normal:NORMAL; float2 uv:TEXCOORD0;
+    float4 w0:WORLD0; float4 w1:WORLD1; float4 w2:WORLD2; float4 w3:WORLD3; uint layer:TEXLAYER;
+};
+PS_INPUT main(VS_INPUT i){
+    PS_INPUT o;
+    float4x4 World = float4x4(i.w0, i.w1, i.w2, i.w3);
+    float4 wp = mul(float4(i.position,1), World);
+    o.worldPos = wp.xyz;
+    o.normal = normalize(mul(float4(i.normal,0), World).xyz);
+    o.uv = i.uv;
+    o.layer = i.layer;
+    o.position = mul(mul(wp, View), Projection);
+    return o;
+})";
+
+    // chunk vertices are already in world space
+    const char* chunkSource = R"(
+struct VS_INPUT { float3 position:POSITION; float3 normal:NORMAL; float2 uv:TEXCOORD0; uint layer:TEXLAYER; };
+PS_INPUT main(VS_INPUT i){
+    PS_INPUT o;
+    o.worldPos = i.position;
+    o.normal = i.normal;
+    o.uv = i.uv;
+    o.layer = i.layer;
+    o.position = mul(mul(float4(i.position,1), View), Projection);
+    return o;
+})";
+
+    const char* psSource = R"(
+Texture2DArray tex0:register(t0); SamplerState sam0:register(s0);
+float4 main(PS_INPUT i):SV_Target{
+    float3 N = normalize(i.normal);
+    float3 L = normalize(-LightDir);
+    float3 V = normalize(CameraPos - i.worldPos);
+    float3 H = normalize(L+V);
+    float diff = saturate(dot(N,L));
+    float spec = pow(saturate(dot(N,H)), 512.0) * 0.1;
+    float3 albedo = tex0.Sample(sam0, float3(i.uv, i.layer)).rgb;
+    float3 color = Ambient * albedo + (albedo*diff + spec) * LightColor;
+    return float4(color,1);
+})";
+
+    auto compile = [&](const char* body, const char* target, ID3DBlob** out) {
+        std::string source = std::string(frameSource) + body;
+        hr = D3DCompile(source.c_str(), source.size(), nullptr, nullptr, nullptr, "main", target, 0, 0, out, &err);
+        if (FAILED(hr)) { if (err) OutputDebugStringA((char*)err->GetBufferPointer()); SafeRelease(&err); return false; }
+        return true;
+    };
+
+    ID3DBlob* instancedVS = nullptr; ID3DBlob* chunkVS = nullptr; ID3DBlob* ps = nullptr;
+    bool ok = compile(instancedSource, "vs_5_0", &instancedVS) && compile(chunkSource, "vs_5_0", &chunkVS) &&
+        compile(psSource, "ps_5_0", &ps);
+
+    if (ok) {
+        ok = SUCCEEDED(pDevice->CreateVertexShader(instancedVS->GetBufferPointer(), instancedVS->GetBufferSize(), nullptr, &pInstancedVS)) &&
+            SUCCEEDED(pDevice->CreateVertexShader(chunkVS->GetBufferPointer(), chunkVS->GetBufferSize(), nullptr, &pChunkVS)) &&
+            SUCCEEDED(pDevice->CreatePixelShader(ps->GetBufferPointer(), ps->GetBufferSize(), nullptr, &pBlockPS));
+    }
+
+    if (ok) {
+        D3D11_INPUT_ELEMENT_DESC layout[] = {
+            {"POSITION",0,DXGI_FORMAT_R32G32B32_FLOAT,   0,0,  D3D11_INPUT_PER_VERTEX_DATA,0},
+            {"NORMAL",  0,DXGI_FORMAT_R32G32B32_FLOAT,   0,12, D3D11_INPUT_PER_VERTEX_DATA,0},
+            {"TEXCOORD",0,DXGI_FORMAT_R32G32_FLOAT,      0,24, D3D11_INPUT_PER_VERTEX_DATA,0},
+            {"WORLD",   0,DXGI_FORMAT_R32G32B32A32_FLOAT,1,0,  D3D11_INPUT_PER_INSTANCE_DATA,1},
+            {"WORLD",   1,DXGI_FORMAT_R32G32B32A32_FLOAT,1,16, D3D11_INPUT_PER_INSTANCE_DATA,1},
+            {"WORLD",   2,DXGI_FORMAT_R32G32B32A32_FLOAT,1,32, D3D11_INPUT_PER_INSTANCE_DATA,1},
+            {"WORLD",   3,DXGI_FORMAT_R32G32B32A32_FLOAT,1,48, D3D11_INPUT_PER_INSTANCE_DATA,1},
+            {"TEXLAYER",0,DXGI_FORMAT_R32_UINT,          1,64, D3D11_INPUT_PER_INSTANCE_DATA,1},
+        };
+        ok = SUCCEEDED(pDevice->CreateInputLayout(layout, 8, instancedVS->GetBufferPointer(), instancedVS->GetBufferSize(), &pInstancedInputLayout));
+    }
+
+    if (ok) {
+        D3D11_INPUT_ELEMENT_DESC layout[] = {
+            {"POSITION",0,DXGI_FORMAT_R32G32B32_FLOAT,0,0, D3D11_INPUT_PER_VERTEX_DATA,0},
+            {"NORMAL",  0,DXGI_FORMAT_R32G32B32_FLOAT,0,12,D3D11_INPUT_PER_VERTEX_DATA,0},
+            {"TEXCOORD",0,DXGI_FORMAT_R32G32_FLOAT,   0,24,D3D11_INPUT_PER_VERTEX_DATA,0},
+            {"TEXLAYER",0,DXGI_FORMAT_R32_UINT,       0,32,D3D11_INPUT_PER_VERTEX_DATA,0},
+        };
+        ok = SUCCEEDED(pDevice->CreateInputLayout(layout, 4, chunkVS->GetBufferPointer(), chunkVS->GetBufferSize(), &pChunkInputLayout));
+    }
+    SafeRelease(&instancedVS); SafeRelease(&chunkVS); SafeRelease(&ps);
+    if (!ok) return false;
+
+    // per-frame constants: camera + lighting, written once per Render
+    D3D11_BUFFER_DESC cbd = {};
+    cbd.ByteWidth = sizeof(FrameConstantBuffer);
+    cbd.Usage = D3D11_USAGE_DYNAMIC;
+    cbd.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
+    cbd.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+    hr = pDevice->CreateBuffer(&cbd, nullptr, &pFrameCB);
+    frameConstantsValid = false;
+    return SUCCEEDED(hr);
+}
+
+bool GameEngine::UpdateFrameConstants(const XMFLOAT3& lightDir, const XMFLOAT3& lightColor, const XMFLOAT3& ambient)
+{
+    FrameConstantBuffer frame;
+    frame.view = XMMatrixTranspose(viewMatrix);
+    frame.projection = XMMatrixTranspose(projectionMatrix);
+    frame.cameraPos = cameraPosition;
+    frame.lightDir = lightDir;
+    frame.lightColor = lightColor;
+    frame.ambient = ambient;
+    // called once per block pass, and a still camera under steady lighting
+    // leaves it the same across frames: only write when something moved
+    if (frameConstantsValid && memcmp(&frame, &frameConstants, sizeof(frame)) == 0) return true;
+
+    D3D11_MAPPED_SUBRESOURCE mapped{};
+    if (FAILED(pContext->Map(pFrameCB, 0, D3D11_MAP_WRITE_DISCARD, 0, &mapped))) return false;
+    memcpy(mapped.pData, &frame, sizeof(frame));
+    pContext->Unmap(pFrameCB, 0);
+    frameConstants = frame;
+    frameConstantsValid = true;
+    return true;
+}
+
+bool GameEngine::EnsureInstanceBuffer(UINT instanceCount)
+{
+    if (pInstanceVB && instanceCount <= instanceCapacity) return true;
+
+    UINT capacity = instanceCapacity ? instanceCapacity : 1024;
+    while (capacity < instanceCount) capacity *= 2;
+
+    SafeRelease(&pInstanceVB);
+    instanceCapacity = 0;
+
+    D3D11_BUFFER_DESC bd = {};
+    bd.ByteWidth = capacity * sizeof(BlockInstance);
+    bd.Usage = D3D11_USAGE_DYNAMIC;
+    bd.BindFlags = D3D11_BIND_VERTEX_BUFFER;
+    bd.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
+    if (FAILED(pDevice->CreateBuffer(&bd, nullptr, &pInstanceVB))) return false;
+
+    instanceCapacity = capacity;
+    return true;
+}
+
+void GameEngine::UpdateViewFrustum()
+{
+    XMFLOAT4X4 viewProj;
+    XMStoreFloat4x4(&viewProj, viewMatrix * projectionMatrix);
+    viewFrustum.Extract(viewProj.m);
+
+    const float eye[3] = { cameraPosition.x, cameraPosition.y, cameraPosition.z };
+    viewFrustum.SetViewDistance(eye, viewDistance);
+
+    cullCounters = CullCounters();
+}
+
+void GameEngine::RenderMapBlocks(const XMFLOAT3& lightDir, const XMFLOAT3& lightColor, const XMFLOAT3& ambient)
+{
+    // rotated objects are bounded by the cube's circumscribed sphere
+    const std::vector<MapObject>& mapObjects = mapStore.GetObjects();
+    cullBoxes.Clear();
+    for (const MapObject& obj : mapObjects) {
+        float r = (std::max)(obj.scale.x, (std::max)(obj.scale.y, obj.scale.z)) * 1.7321f;
+        cullBoxes.Add(obj.position.x - r, obj.position.y - r, obj.position.z - r,
+            obj.position.x + r, obj.position.y + r, obj.position.z + r);
+    }
+    // rigid bodies follow, they don't rotate
+    for (size_t i = 0; i < rigidBodies.GetCount(); ++i) {
+        float p[3], h[3];
+        rigidBodies.GetPosition(i, p);
+        rigidBodies.GetHalfExtents(i, h);
+        cullBoxes.Add(p[0] - h[0], p[1] - h[1], p[2] - h[2], p[0] + h[0], p[1] + h[1], p[2] + h[2]);
+    }
+    size_t objectCount = mapObjects.size() + rigidBodies.GetCount();
+    cullCounters.objectsTested = objectCount;
+    if (frustumCulling) {
+        cullCounters.objectsVisible = viewFrustum.CullBoxes(cullBoxes, cullVisible);
+    }
+    else {
+        cullVisible.assign(objectCount, 1);
+        cullCounters.objectsVisible = objectCount;
+    }
+
+    instanceObjects.clear();
+    for (size_t i = 0; i < mapObjects.size(); ++i) {
+        if (!cullVisible[i]) continue;
+        const MapObject& obj = mapObjects[i];
+        instanceObjects.emplace_back();
+        InstanceObject& inst = instanceObjects.back();
+        inst.position[0] = obj.position.x; inst.position[1] = obj.position.y; inst.position[2] = obj.position.z;
+        inst.rotation[0] = obj.rotation.x; inst.rotation[1] = obj.rotation.y; inst.rotation[2] = obj.rotation.z;
+        inst.scale[0] = obj.scale.x; inst.scale[1] = obj.scale.y; inst.scale[2] = obj.scale.z;
+        inst.block = obj.block;
+    }
+    for (size_t i = 0; i < rigidBodies.GetCount(); ++i) {
+        if (!cullVisible[mapObjects.size() + i]) continue;
+        instanceObjects.emplace_back();
+        InstanceObject& inst = instanceObjects.back();
+        rigidBodies.GetPosition(i, inst.position);
+        rigidBodies.GetHalfExtents(i, inst.scale);
+        inst.rotation[0] = inst.rotation[1] = inst.rotation[2] = 0.0f;
+        inst.block = rigidBodies.GetBlock(i);
+    }
+    // voxels are drawn from chunk meshes, only sparse objects are instanced
+    BuildInstanceList(nullptr, instanceObjects.data(), instanceObjects.size(), blockInstances);
+
+    if (blockInstances.instances.empty()) return;
+    if (!EnsureInstanceBuffer((UINT)blockInstances.instances.size())) return;
+
+    if (!UpdateFrameConstants(lightDir, lightColor, ambient)) return;
+
+    D3D11_MAPPED_SUBRESOURCE mapped{};
+    if (FAILED(pContext->Map(pInstanceVB, 0, D3D11_MAP_WRITE_DISCARD, 0, &mapped))) return;
+    memcpy(mapped.pData, blockInstances.instances.data(), blockInstances.instances.size() * sizeof(BlockInstance));
+    pContext->Unmap(pInstanceVB, 0);
+
+    ID3D11Buffer* buffers[2] = { pCubeVB, pInstanceVB };
+    UINT strides[2] = { sizeof(Vertex), sizeof(BlockInstance) };
+    UINT offsets[2] = { 0, 0 };
+    pContext->IASetInputLayout(pInstancedInputLayout);
+    pContext->IASetVertexBuffers(0, 2, buffers, strides, offsets);
+    pContext->IASetIndexBuffer(pCubeIB, DXGI_FORMAT_R16_UINT, 0);
+    pContext->VSSetShader(pInstancedVS, nullptr, 0);
+    pContext->PSSetShader(pBlockPS, nullptr, 0);
+    pContext->VSSetConstantBuffers(0, 1, &pFrameCB);
+    pContext->PSSetConstantBuffers(0, 1, &pFrameCB);
+    pContext->PSSetShaderResources(0, 1, &pBlockTextureArraySRV);
+    pContext->DrawIndexedInstanced(cubeIndexCount, (UINT)blockInstances.instances.size(), 0, 0, 0);
+
+    // back to the per-object pipeline for the player meshes
+    pContext->IASetInputLayout(pInputLayout);
+    pContext->VSSetShader(pVS, nullptr, 0);
+    pContext->PSSetShader(pPS, nullptr, 0);
+    pContext->VSSetConstantBuffers(0, 1, &pCB);
+    pContext->PSSetConstantBuffers(0, 1, &pCB);
+}
+
+void GameEngine::ReleaseChunkMeshes()
+{
+    for (auto& pair : chunkMeshes) {
+        SafeRelease(&pair.second.vb);
+        SafeRelease(&pair.second.ib);
+    }
+    chunkMeshes.clear();
+}
+
+void GameEngine::UpdateChunkMeshes()
+{
+    dirtyChunkScratch.clear();
+    mapStore.GetVoxels().TakeDirtyChunks(dirtyChunkScratch);
+    if (dirtyChunkScratch.empty()) return;
+
+    auto start = std::chrono::high_resolution_clock::now();
+
+    for (const ChunkCoords& c : dirtyChunkScratch) {
+        int64_t key = VoxelWorld::MakeKey(c.cx, c.cy, c.cz);
+        BuildChunkMesh(mapStore.GetVoxels(), c.cx, c.cy, c.cz, greedyMeshing, meshScratch);
+
+        auto it = chunkMeshes.find(key);
+        if (it != chunkMeshes.end()) {
+            SafeRelease(&it->second.vb);
+            SafeRelease(&it->second.ib);
+            if (meshScratch.indices.empty()) {
+                chunkMeshes.erase(it);
+                continue;
+            }
+        }
+        else if (meshScratch.indices.empty()) {
+            continue;
+        }
+
+        ChunkRenderData& data = chunkMeshes[key];
+        data.indexCount = (UINT)meshScratch.indices.size();
+        data.triangles = meshScratch.indices.size() / 3;
+        // blocks span +-1 around their lattice point
+        const int origin[3] = { c.cx * VOXEL_CHUNK_SIZE, c.cy * VOXEL_CHUNK_SIZE, c.cz * VOXEL_CHUNK_SIZE };
+        for (int axis = 0; axis < 3; ++axis) {
+            data.boundsMin[axis] = (float)(origin[axis] - 1);
+            data.boundsMax[axis] = (float)(origin[axis] + VOXEL_CHUNK_SIZE);
+        }
+
+        D3D11_BUFFER_DESC bd = {};
+        bd.Usage = D3D11_USAGE_IMMUTABLE;
+        bd.BindFlags = D3D11_BIND_VERTEX_BUFFER;
+        bd.ByteWidth = (UINT)(meshScratch.vertices.size() * sizeof(MeshVertex));
+        D3D11_SUBRESOURCE_DATA init = {};
+        init.pSysMem = meshScratch.vertices.data();
+        HRESULT hr = pDevice->CreateBuffer(&bd, &init, &data.vb);
+
+        if (SUCCEEDED(hr)) {
+            bd.BindFlags = D3D11_BIND_INDEX_BUFFER;
+            bd.ByteWidth = (UINT)(meshScratch.indices.size() * sizeof(uint32_t));
+            init.pSysMem = meshScratch.indices.data();
+            hr = pDevice->CreateBuffer(&bd, &init, &data.ib);
+        }
+
+        if (FAILED(hr)) {
+            SafeRelease(&data.vb);
+            SafeRelease(&data.ib);
+            chunkMeshes.erase(key);
+        }
+    }
+
+    auto end = std::chrono::high_resolution_clock::now();
+    lastRemeshCount = dirtyChunkScratch.size();
+    lastRemeshMs = std::chrono::duration<float, std::milli>(end - start).count();
+}
+
+void GameEngine::RenderChunkMeshes(const XMFLOAT3& lightDir, const XMFLOAT3& lightColor, const XMFLOAT3& ambient)
+{
+    if (chunkMeshes.empty()) return;
+
+    cullBoxes.Clear();
+    chunkDrawList.clear();
+    for (const auto& pair : chunkMeshes) {
+        const ChunkRenderData& data = pair.second;
+        cullBoxes.Add(data.boundsMin[0], data.boundsMin[1], data.boundsMin[2],
+            data.boundsMax[0], data.boundsMax[1], data.boundsMax[2]);
+        chunkDrawList.push_back(&data);
+    }
+    cullCounters.chunksTested = chunkDrawList.size();
+    if (frustumCulling) {
+        cullCounters.chunksVisible = viewFrustum.CullBoxes(cullBoxes, cullVisible);
+    }
+    else {
+        cullVisible.assign(chunkDrawList.size(), 1);
+        cullCounters.chunksVisible = chunkDrawList.size();
+    }
+    if (cullCounters.chunksVisible == 0) return;
+
+    if (!UpdateFrameConstants(lightDir, lightColor, ambient)) return;
+
+    // one texture binding for every chunk, each chunk one draw
+    pContext->IASetInputLayout(pChunkInputLayout);
+    pContext->VSSetShader(pChunkVS, nullptr, 0);
+    pContext->PSSetShader(pBlockPS, nullptr, 0);
+    pContext->VSSetConstantBuffers(0, 1, &pFrameCB);
+    pContext->PSSetConstantBuffers(0, 1, &pFrameCB);
+    pContext->PSSetShaderResources(0, 1, &pBlockTextureArraySRV);
+
+    UINT stride = sizeof(MeshVertex);
+    UINT offset = 0;
+    for (size_t i = 0; i < chunkDrawList.size(); ++i) {
+        if (!cullVisible[i]) continue;
+        const ChunkRenderData& data = *chunkDrawList[i];
+        pContext->IASetVertexBuffers(0, 1, &data.vb, &stride, &offset);
+        pContext->IASetIndexBuffer(data.ib, DXGI_FORMAT_R32_UINT, 0);
+        pContext->DrawIndexed(data.indexCount, 0, 0);
+    }
+
+    pContext->IASetInputLayout(pInputLayout);
+    pContext->VSSetShader(pVS, nullptr, 0);
+    pContext->PSSetShader(pPS, nullptr, 0);
+    pContext->VSSetConstantBuffers(0, 1, &pCB);
+    pContext->PSSetConstantBuffers(0, 1, &pCB);
+}
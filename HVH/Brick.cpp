@@ -1,2511 +0,0 @@
-﻿//H V H   T E X T U R E   D A T A
-//================================
-#include "GameEngine.h"
-#include <vector>
-bool GameEngine::CreateBrickTextureSRV(UINT size, ID3D11ShaderResourceView** outSRV) {
-    static ID3D11ShaderResourceView* cachedSRV = nullptr;
-    if (cachedSRV) {
-        *outSRV = cachedSRV;
-        return true;
-    }
-    if (size != 64) return false;
-    static const struct PixelSegment {
-        BYTE r, g, b, a;
-        int count;
-    } segments[] = {
-        {158, 88, 73, 69, 1},
-        {168, 92, 73, 132, 1},
-        {150, 84, 65, 132, 1},
-        {144, 81, 63, 132, 1},
-        {146, 81, 63, 132, 2},
-        {148, 83, 63, 132, 1},
-        {156, 86, 67, 132, 1},
-        {154, 86, 67, 132, 1},
-        {154, 84, 65, 132, 1},
-        {156, 88, 69, 132, 1},
-        {173, 148, 141, 132, 1},
-        {177, 160, 152, 132, 1},
-        {175, 158, 150, 132, 1},
-        {177, 162, 156, 132, 1},
-        {162, 110, 94, 132, 1},
-        {152, 81, 61, 132, 1},
-        {154, 86, 67, 132, 2},
-        {156, 86, 67, 132, 1},
-        {156, 88, 69, 132, 2},
-        {158, 88, 69, 132, 1},
-        {154, 86, 67, 132, 1},
-        {142, 81, 61, 132, 4},
-        {162, 88, 67, 132, 1},
-        {168, 90, 69, 132, 1},
-        {166, 90, 69, 132, 1},
-        {168, 90, 69, 132, 1},
-        {160, 88, 67, 132, 1},
-        {152, 86, 67, 132, 1},
-        {154, 86, 67, 132, 1},
-        {152, 84, 67, 132, 1},
-        {160, 88, 69, 132, 1},
-        {171, 92, 73, 132, 1},
-        {169, 92, 73, 132, 1},
-        {171, 94, 73, 132, 1},
-        {168, 90, 71, 132, 1},
-        {142, 79, 59, 132, 1},
-        {141, 79, 59, 132, 1},
-        {141, 77, 59, 132, 1},
-        {141, 75, 57, 132, 1},
-        {169, 141, 131, 132, 1},
-        {177, 162, 156, 132, 1},
-        {175, 158, 150, 132, 1},
-        {177, 164, 158, 132, 1},
-        {166, 119, 106, 132, 1},
-        {152, 81, 59, 132, 1},
-        {154, 86, 67, 132, 1},
-        {152, 86, 67, 132, 1},
-        {158, 86, 67, 132, 1},
-        {168, 90, 69, 132, 1},
-        {166, 90, 69, 132, 3},
-        {156, 86, 67, 132, 1},
-        {154, 86, 67, 132, 4},
-        {168, 92, 73, 132, 1},
-        {160, 90, 74, 143, 1},
-        {184, 102, 80, 255, 1},
-        {164, 92, 71, 255, 1},
-        {158, 88, 69, 255, 1},
-        {159, 88, 69, 255, 2},
-        {162, 89, 70, 255, 1},
-        {169, 94, 73, 255, 1},
-        {168, 94, 73, 255, 1},
-        {168, 93, 71, 255, 1},
-        {169, 96, 76, 255, 1},
-        {189, 161, 153, 255, 1},
-        {192, 172, 166, 255, 1},
-        {191, 170, 162, 255, 1},
-        {193, 176, 168, 255, 1},
-        {173, 118, 102, 255, 1},
-        {163, 87, 66, 255, 1},
-        {165, 92, 72, 255, 2},
-        {168, 94, 74, 255, 1},
-        {171, 97, 76, 255, 1},
-        {171, 96, 76, 255, 1},
-        {172, 96, 76, 255, 1},
-        {169, 95, 74, 255, 1},
-        {157, 88, 68, 255, 4},
-        {179, 98, 75, 255, 1},
-        {185, 100, 77, 255, 1},
-        {183, 100, 77, 255, 1},
-        {185, 101, 77, 255, 1},
-        {175, 97, 75, 255, 1},
-        {167, 94, 73, 255, 1},
-        {168, 94, 73, 255, 1},
-        {167, 93, 73, 255, 1},
-        {175, 96, 76, 255, 1},
-        {188, 102, 81, 255, 1},
-        {187, 102, 80, 255, 1},
-        {188, 103, 82, 255, 1},
-        {184, 100, 78, 255, 1},
-        {154, 86, 65, 255, 1},
-        {152, 85, 65, 255, 1},
-        {153, 84, 64, 255, 1},
-        {152, 82, 62, 255, 1},
-        {183, 152, 142, 255, 1},
-        {193, 174, 168, 255, 1},
-        {191, 170, 162, 255, 1},
-        {193, 177, 170, 255, 1},
-        {179, 129, 114, 255, 1},
-        {165, 87, 65, 255, 1},
-        {167, 93, 73, 255, 1},
-        {166, 93, 73, 255, 1},
-        {171, 95, 74, 255, 1},
-        {183, 100, 77, 255, 1},
-        {182, 100, 77, 255, 2},
-        {181, 100, 75, 255, 1},
-        {170, 94, 73, 255, 1},
-        {168, 94, 73, 255, 4},
-        {183, 102, 80, 255, 1},
-        {150, 86, 69, 132, 1},
-        {160, 89, 70, 255, 1},
-        {144, 80, 62, 255, 1},
-        {140, 78, 60, 255, 1},
-        {141, 78, 60, 255, 2},
-        {143, 79, 61, 255, 1},
-        {150, 83, 65, 255, 1},
-        {149, 83, 65, 255, 1},
-        {149, 82, 63, 255, 1},
-        {150, 85, 68, 255, 1},
-        {173, 149, 141, 255, 1},
-        {177, 159, 153, 255, 1},
-        {176, 157, 150, 255, 1},
-        {177, 162, 155, 255, 1},
-        {165, 111, 95, 255, 1},
-        {158, 84, 63, 255, 1},
-        {159, 89, 68, 255, 1},
-        {161, 89, 69, 255, 1},
-        {155, 87, 67, 255, 1},
-        {148, 83, 65, 255, 1},
-        {149, 83, 66, 255, 1},
-        {150, 84, 66, 255, 1},
-        {147, 82, 65, 255, 1},
-        {136, 76, 58, 255, 4},
-        {149, 82, 62, 255, 1},
-        {152, 83, 63, 255, 1},
-        {151, 83, 63, 255, 1},
-        {152, 83, 63, 255, 1},
-        {149, 83, 64, 255, 1},
-        {147, 82, 64, 255, 2},
-        {147, 81, 64, 255, 1},
-        {151, 84, 65, 255, 1},
-        {158, 87, 67, 255, 2},
-        {158, 88, 68, 255, 1},
-        {156, 86, 66, 255, 1},
-        {140, 78, 59, 255, 1},
-        {138, 77, 59, 255, 1},
-        {139, 76, 58, 255, 1},
-        {138, 75, 56, 255, 1},
-        {168, 140, 130, 255, 1},
-        {178, 161, 155, 255, 1},
-        {176, 157, 150, 255, 1},
-        {178, 163, 157, 255, 1},
-        {165, 119, 105, 255, 1},
-        {152, 80, 60, 255, 1},
-        {154, 86, 67, 255, 2},
-        {155, 86, 67, 255, 1},
-        {157, 86, 66, 255, 1},
-        {157, 86, 67, 255, 2},
-        {156, 86, 66, 255, 1},
-        {148, 82, 64, 255, 1},
-        {147, 82, 64, 255, 3},
-        {148, 82, 64, 255, 1},
-        {160, 89, 70, 255, 1},
-        {127, 75, 59, 132, 1},
-        {134, 74, 58, 255, 1},
-        {124, 68, 54, 255, 1},
-        {124, 69, 53, 255, 3},
-        {126, 70, 54, 255, 1},
-        {132, 73, 58, 255, 1},
-        {133, 73, 57, 255, 1},
-        {131, 71, 56, 255, 1},
-        {134, 76, 61, 255, 1},
-        {171, 148, 140, 255, 1},
-        {177, 160, 153, 255, 1},
-        {176, 157, 150, 255, 1},
-        {176, 161, 155, 255, 1},
-        {177, 118, 99, 255, 1},
-        {177, 95, 70, 255, 1},
-        {177, 99, 75, 255, 1},
-        {181, 101, 77, 255, 1},
-        {155, 86, 66, 255, 1},
-        {120, 66, 52, 255, 1},
-        {124, 68, 54, 255, 1},
-        {125, 68, 54, 255, 1},
-        {122, 67, 52, 255, 1},
-        {109, 60, 45, 255, 4},
-        {102, 57, 41, 255, 1},
-        {101, 56, 41, 255, 2},
-        {99, 55, 40, 255, 1},
-        {114, 63, 48, 255, 1},
-        {126, 69, 55, 255, 1},
-        {124, 68, 54, 255, 1},
-        {125, 68, 54, 255, 1},
-        {122, 67, 51, 255, 1},
-        {116, 66, 47, 255, 3},
-        {117, 67, 48, 255, 1},
-        {130, 74, 56, 255, 1},
-        {131, 74, 55, 255, 1},
-        {131, 73, 54, 255, 1},
-        {129, 72, 52, 255, 1},
-        {166, 139, 129, 255, 1},
-        {178, 161, 155, 255, 1},
-        {176, 157, 150, 255, 1},
-        {178, 163, 157, 255, 1},
-        {165, 119, 105, 255, 1},
-        {152, 80, 60, 255, 1},
-        {154, 86, 67, 255, 1},
-        {156, 87, 68, 255, 1},
-        {147, 82, 64, 255, 1},
-        {125, 67, 54, 255, 1},
-        {126, 68, 55, 255, 3},
-        {125, 68, 54, 255, 1},
-        {124, 68, 54, 255, 3},
-        {125, 67, 54, 255, 1},
-        {136, 73, 58, 255, 1},
-        {127, 75, 59, 132, 1},
-        {135, 75, 58, 255, 1},
-        {125, 69, 54, 255, 4},
-        {127, 70, 55, 255, 1},
-        {133, 74, 59, 255, 1},
-        {133, 74, 58, 255, 1},
-        {132, 72, 56, 255, 1},
-        {134, 77, 61, 255, 1},
-        {171, 148, 140, 255, 1},
-        {177, 160, 153, 255, 1},
-        {176, 157, 150, 255, 1},
-        {176, 161, 155, 255, 1},
-        {176, 118, 99, 255, 1},
-        {176, 94, 70, 255, 1},
-        {176, 98, 75, 255, 1},
-        {180, 100, 77, 255, 1},
-        {155, 86, 66, 255, 1},
-        {121, 67, 52, 255, 1},
-        {125, 69, 54, 255, 1},
-        {126, 69, 54, 255, 1},
-        {123, 68, 52, 255, 1},
-        {110, 61, 45, 255, 1},
-        {110, 61, 46, 255, 3},
-        {104, 58, 42, 255, 1},
-        {103, 57, 42, 255, 2},
-        {101, 56, 41, 255, 1},
-        {116, 64, 49, 255, 1},
-        {127, 70, 55, 255, 1},
-        {125, 69, 54, 255, 1},
-        {126, 69, 54, 255, 1},
-        {123, 68, 52, 255, 1},
-        {118, 67, 48, 255, 3},
-        {119, 68, 49, 255, 1},
-        {130, 74, 56, 255, 1},
-        {131, 74, 55, 255, 1},
-        {131, 73, 54, 255, 1},
-        {129, 72, 52, 255, 1},
-        {166, 139, 129, 255, 1},
-        {178, 161, 155, 255, 1},
-        {176, 157, 150, 255, 1},
-        {178, 163, 157, 255, 1},
-        {165, 119, 105, 255, 1},
-        {152, 80, 60, 255, 1},
-        {154, 86, 67, 255, 1},
-        {156, 87, 68, 255, 1},
-        {147, 82, 64, 255, 1},
-        {126, 68, 54, 255, 1},
-        {127, 69, 55, 255, 3},
-        {126, 69, 54, 255, 1},
-        {125, 69, 54, 255, 3},
-        {126, 68, 54, 255, 1},
-        {137, 74, 58, 255, 1},
-        {127, 75, 59, 132, 1},
-        {135, 75, 58, 255, 1},
-        {125, 69, 54, 255, 4},
-        {127, 70, 55, 255, 1},
-        {133, 74, 59, 255, 1},
-        {133, 74, 58, 255, 1},
-        {132, 72, 56, 255, 1},
-        {134, 77, 61, 255, 1},
-        {171, 148, 140, 255, 1},
-        {177, 160, 153, 255, 1},
-        {176, 157, 150, 255, 1},
-        {176, 161, 155, 255, 1},
-        {176, 118, 99, 255, 1},
-        {176, 94, 70, 255, 1},
-        {176, 98, 75, 255, 1},
-        {180, 100, 77, 255, 1},
-        {155, 86, 66, 255, 1},
-        {121, 67, 52, 255, 1},
-        {125, 69, 54, 255, 1},
-        {126, 69, 54, 255, 1},
-        {123, 68, 52, 255, 1},
-        {110, 61, 45, 255, 1},
-        {110, 61, 46, 255, 3},
-        {104, 58, 42, 255, 1},
-        {103, 57, 42, 255, 2},
-        {101, 56, 41, 255, 1},
-        {116, 64, 49, 255, 1},
-        {127, 70, 55, 255, 1},
-        {125, 69, 54, 255, 1},
-        {126, 69, 54, 255, 1},
-        {123, 68, 52, 255, 1},
-        {118, 67, 48, 255, 3},
-        {119, 68, 49, 255, 1},
-        {130, 74, 56, 255, 1},
-        {131, 74, 55, 255, 1},
-        {131, 73, 54, 255, 1},
-        {129, 72, 52, 255, 1},
-        {166, 139, 129, 255, 1},
-        {178, 161, 155, 255, 1},
-        {176, 157, 150, 255, 1},
-        {178, 163, 157, 255, 1},
-        {165, 119, 105, 255, 1},
-        {152, 80, 60, 255, 1},
-        {154, 86, 67, 255, 1},
-        {156, 87, 68, 255, 1},
-        {147, 82, 64, 255, 1},
-        {126, 68, 54, 255, 1},
-        {127, 69, 55, 255, 3},
-        {126, 69, 54, 255, 1},
-        {125, 69, 54, 255, 3},
-        {126, 68, 54, 255, 1},
-        {137, 74, 58, 255, 1},
-        {127, 75, 59, 132, 1},
-        {135, 75, 58, 255, 1},
-        {125, 69, 54, 255, 1},
-        {126, 69, 54, 255, 3},
-        {127, 70, 55, 255, 1},
-        {132, 73, 58, 255, 2},
-        {131, 71, 56, 255, 1},
-        {133, 76, 61, 255, 1},
-        {171, 148, 140, 255, 1},
-        {177, 160, 153, 255, 1},
-        {176, 157, 150, 255, 1},
-        {176, 161, 155, 255, 1},
-        {176, 118, 99, 255, 1},
-        {175, 93, 69, 255, 1},
-        {175, 98, 74, 255, 1},
-        {179, 100, 76, 255, 1},
-        {155, 86, 66, 255, 1},
-        {121, 67, 52, 255, 1},
-        {125, 69, 54, 255, 1},
-        {126, 69, 54, 255, 1},
-        {123, 68, 52, 255, 1},
-        {111, 61, 45, 255, 1},
-        {111, 61, 46, 255, 3},
-        {105, 58, 42, 255, 1},
-        {104, 57, 42, 255, 2},
-        {102, 56, 41, 255, 1},
-        {116, 64, 49, 255, 1},
-        {127, 70, 55, 255, 1},
-        {125, 69, 54, 255, 1},
-        {126, 69, 54, 255, 1},
-        {123, 68, 52, 255, 1},
-        {118, 67, 49, 255, 3},
-        {119, 68, 50, 255, 1},
-        {130, 74, 55, 255, 1},
-        {131, 74, 55, 255, 1},
-        {131, 73, 54, 255, 1},
-        {129, 71, 52, 255, 1},
-        {166, 139, 129, 255, 1},
-        {178, 162, 155, 255, 1},
-        {176, 157, 150, 255, 1},
-        {178, 163, 157, 255, 1},
-        {165, 119, 105, 255, 1},
-        {151, 79, 60, 255, 1},
-        {153, 85, 67, 255, 1},
-        {155, 86, 68, 255, 1},
-        {147, 81, 64, 255, 1},
-        {127, 69, 54, 255, 1},
-        {128, 69, 55, 255, 3},
-        {126, 69, 54, 255, 1},
-        {125, 69, 54, 255, 3},
-        {126, 69, 54, 255, 1},
-        {138, 74, 58, 255, 1},
-        {127, 75, 59, 132, 1},
-        {134, 74, 58, 255, 1},
-        {131, 73, 56, 255, 1},
-        {139, 77, 58, 255, 1},
-        {138, 76, 58, 255, 1},
-        {140, 77, 59, 255, 1},
-        {132, 73, 56, 255, 1},
-        {110, 61, 46, 255, 1},
-        {111, 61, 47, 255, 1},
-        {110, 59, 45, 255, 1},
-        {113, 64, 50, 255, 1},
-        {169, 147, 139, 255, 1},
-        {178, 160, 154, 255, 1},
-        {176, 157, 150, 255, 1},
-        {178, 162, 155, 255, 1},
-        {163, 110, 94, 255, 1},
-        {155, 82, 62, 255, 1},
-        {157, 87, 68, 255, 1},
-        {159, 88, 69, 255, 1},
-        {144, 80, 62, 255, 1},
-        {125, 68, 54, 255, 1},
-        {127, 69, 55, 255, 3},
-        {123, 68, 53, 255, 4},
-        {116, 63, 49, 255, 1},
-        {114, 62, 48, 255, 2},
-        {113, 62, 47, 255, 1},
-        {120, 67, 51, 255, 1},
-        {126, 69, 55, 255, 1},
-        {125, 69, 54, 255, 3},
-        {124, 69, 54, 255, 4},
-        {126, 69, 54, 255, 2},
-        {126, 68, 53, 255, 1},
-        {124, 66, 51, 255, 1},
-        {165, 138, 129, 255, 1},
-        {179, 162, 155, 255, 1},
-        {176, 157, 150, 255, 1},
-        {180, 164, 158, 255, 1},
-        {154, 113, 99, 255, 1},
-        {129, 67, 48, 255, 1},
-        {133, 74, 55, 255, 1},
-        {132, 74, 55, 255, 1},
-        {135, 76, 57, 255, 1},
-        {142, 79, 61, 255, 3},
-        {141, 78, 61, 255, 1},
-        {126, 70, 55, 255, 1},
-        {125, 69, 54, 255, 2},
-        {124, 69, 54, 255, 1},
-        {135, 75, 57, 255, 1},
-        {152, 84, 64, 255, 1},
-        {127, 75, 59, 132, 1},
-        {134, 74, 58, 255, 1},
-        {132, 73, 56, 255, 1},
-        {142, 78, 59, 255, 1},
-        {141, 77, 59, 255, 1},
-        {143, 78, 60, 255, 1},
-        {133, 73, 56, 255, 1},
-        {106, 60, 45, 255, 1},
-        {107, 60, 46, 255, 1},
-        {106, 58, 44, 255, 1},
-        {109, 63, 49, 255, 1},
-        {169, 147, 139, 255, 1},
-        {178, 160, 154, 255, 1},
-        {176, 157, 150, 255, 1},
-        {178, 162, 155, 255, 1},
-        {160, 109, 94, 255, 1},
-        {151, 81, 61, 255, 1},
-        {153, 86, 67, 255, 1},
-        {155, 87, 68, 255, 1},
-        {143, 79, 62, 255, 1},
-        {125, 68, 54, 255, 1},
-        {127, 69, 55, 255, 3},
-        {126, 69, 54, 255, 4},
-        {117, 64, 50, 255, 1},
-        {115, 63, 49, 255, 2},
-        {114, 63, 48, 255, 1},
-        {121, 67, 51, 255, 1},
-        {126, 69, 55, 255, 1},
-        {125, 69, 54, 255, 9},
-        {125, 68, 53, 255, 1},
-        {123, 66, 51, 255, 1},
-        {165, 138, 129, 255, 1},
-        {179, 162, 155, 255, 1},
-        {176, 157, 150, 255, 1},
-        {180, 164, 158, 255, 1},
-        {153, 112, 98, 255, 1},
-        {125, 66, 46, 255, 1},
-        {129, 73, 54, 255, 1},
-        {128, 73, 54, 255, 1},
-        {132, 75, 56, 255, 1},
-        {145, 80, 62, 255, 1},
-        {143, 80, 62, 255, 2},
-        {142, 79, 62, 255, 1},
-        {126, 70, 55, 255, 1},
-        {125, 69, 54, 255, 2},
-        {124, 69, 54, 255, 1},
-        {136, 76, 58, 255, 1},
-        {155, 85, 65, 255, 1},
-        {127, 75, 59, 132, 1},
-        {134, 74, 58, 255, 1},
-        {132, 73, 56, 255, 1},
-        {141, 78, 59, 255, 1},
-        {140, 77, 59, 255, 1},
-        {142, 78, 60, 255, 1},
-        {133, 73, 56, 255, 1},
-        {107, 60, 45, 255, 1},
-        {108, 60, 46, 255, 1},
-        {107, 58, 44, 255, 1},
-        {110, 63, 49, 255, 1},
-        {169, 147, 139, 255, 1},
-        {178, 160, 154, 255, 1},
-        {176, 157, 150, 255, 1},
-        {178, 162, 155, 255, 1},
-        {161, 109, 94, 255, 1},
-        {152, 81, 61, 255, 1},
-        {154, 86, 67, 255, 1},
-        {156, 87, 68, 255, 1},
-        {143, 79, 62, 255, 1},
-        {125, 68, 54, 255, 1},
-        {127, 69, 55, 255, 3},
-        {125, 69, 54, 255, 4},
-        {117, 64, 50, 255, 1},
-        {115, 63, 49, 255, 2},
-        {114, 63, 48, 255, 1},
-        {121, 67, 51, 255, 1},
-        {126, 69, 55, 255, 1},
-        {125, 69, 54, 255, 9},
-        {125, 68, 53, 255, 1},
-        {123, 66, 51, 255, 1},
-        {165, 138, 129, 255, 1},
-        {179, 162, 155, 255, 1},
-        {176, 157, 150, 255, 1},
-        {180, 164, 158, 255, 1},
-        {153, 112, 98, 255, 1},
-        {126, 66, 46, 255, 1},
-        {130, 73, 54, 255, 1},
-        {129, 73, 54, 255, 1},
-        {133, 75, 56, 255, 1},
-        {144, 80, 62, 255, 1},
-        {143, 80, 62, 255, 2},
-        {142, 79, 62, 255, 1},
-        {126, 70, 55, 255, 1},
-        {125, 69, 54, 255, 2},
-        {124, 69, 54, 255, 1},
-        {136, 76, 58, 255, 1},
-        {154, 85, 65, 255, 1},
-        {125, 71, 54, 132, 1},
-        {131, 69, 52, 255, 1},
-        {130, 68, 51, 255, 1},
-        {140, 74, 54, 255, 1},
-        {139, 73, 54, 255, 1},
-        {141, 74, 55, 255, 1},
-        {131, 69, 51, 255, 1},
-        {103, 55, 40, 255, 1},
-        {104, 55, 41, 255, 1},
-        {103, 53, 39, 255, 1},
-        {107, 58, 44, 255, 1},
-        {170, 147, 139, 255, 1},
-        {179, 161, 155, 255, 1},
-        {177, 158, 151, 255, 1},
-        {179, 163, 156, 255, 1},
-        {161, 107, 91, 255, 1},
-        {152, 77, 56, 255, 1},
-        {153, 82, 63, 255, 1},
-        {156, 83, 64, 255, 1},
-        {142, 75, 58, 255, 1},
-        {123, 63, 49, 255, 1},
-        {125, 64, 50, 255, 3},
-        {123, 64, 49, 255, 1},
-        {122, 64, 49, 255, 3},
-        {114, 59, 44, 255, 1},
-        {112, 58, 43, 255, 1},
-        {112, 58, 44, 255, 1},
-        {111, 58, 43, 255, 1},
-        {118, 62, 46, 255, 1},
-        {123, 64, 50, 255, 1},
-        {122, 64, 49, 255, 9},
-        {122, 63, 48, 255, 1},
-        {121, 61, 46, 255, 1},
-        {165, 138, 129, 255, 1},
-        {180, 163, 156, 255, 1},
-        {177, 158, 151, 255, 1},
-        {181, 165, 160, 255, 1},
-        {152, 110, 96, 255, 1},
-        {124, 61, 41, 255, 1},
-        {128, 69, 49, 255, 1},
-        {127, 68, 49, 255, 1},
-        {131, 71, 51, 255, 1},
-        {143, 76, 57, 255, 1},
-        {142, 76, 57, 255, 2},
-        {141, 75, 57, 255, 1},
-        {124, 65, 50, 255, 1},
-        {122, 64, 49, 255, 2},
-        {121, 64, 49, 255, 1},
-        {134, 72, 53, 255, 1},
-        {153, 81, 60, 255, 1},
-        {152, 123, 112, 132, 1},
-        {160, 129, 117, 255, 1},
-        {151, 121, 108, 255, 1},
-        {154, 122, 109, 255, 1},
-        {153, 122, 109, 255, 1},
-        {154, 122, 109, 255, 1},
-        {151, 121, 108, 255, 1},
-        {143, 116, 105, 255, 3},
-        {144, 118, 106, 255, 1},
-        {163, 144, 135, 255, 1},
-        {166, 148, 140, 255, 1},
-        {165, 147, 139, 255, 1},
-        {166, 149, 140, 255, 1},
-        {160, 132, 120, 255, 1},
-        {158, 123, 110, 255, 1},
-        {158, 125, 112, 255, 1},
-        {159, 125, 112, 255, 1},
-        {154, 122, 110, 255, 1},
-        {149, 119, 108, 255, 5},
-        {148, 119, 108, 255, 3},
-        {146, 118, 106, 255, 1},
-        {145, 117, 106, 255, 3},
-        {147, 119, 107, 255, 1},
-        {149, 120, 108, 255, 1},
-        {148, 119, 108, 255, 10},
-        {148, 119, 107, 255, 1},
-        {162, 141, 132, 255, 1},
-        {166, 149, 140, 255, 1},
-        {165, 147, 139, 255, 1},
-        {166, 150, 141, 255, 1},
-        {158, 133, 122, 255, 1},
-        {149, 118, 105, 255, 1},
-        {150, 120, 108, 255, 2},
-        {151, 121, 108, 255, 1},
-        {154, 123, 110, 255, 4},
-        {149, 120, 108, 255, 1},
-        {148, 119, 108, 255, 3},
-        {152, 121, 109, 255, 1},
-        {167, 133, 119, 255, 1},
-        {166, 152, 142, 132, 1},
-        {176, 161, 150, 255, 1},
-        {162, 148, 138, 255, 1},
-        {161, 148, 138, 255, 3},
-        {162, 148, 138, 255, 1},
-        {164, 149, 139, 255, 4},
-        {159, 143, 133, 255, 1},
-        {159, 142, 132, 255, 2},
-        {159, 142, 131, 255, 1},
-        {160, 145, 136, 255, 1},
-        {161, 147, 138, 255, 1},
-        {160, 147, 138, 255, 2},
-        {161, 148, 138, 255, 1},
-        {162, 148, 139, 255, 1},
-        {162, 148, 138, 255, 3},
-        {162, 148, 139, 255, 1},
-        {163, 148, 139, 255, 3},
-        {163, 149, 139, 255, 4},
-        {163, 148, 139, 255, 1},
-        {162, 148, 139, 255, 1},
-        {163, 148, 139, 255, 11},
-        {160, 143, 133, 255, 1},
-        {159, 142, 131, 255, 1},
-        {159, 142, 132, 255, 1},
-        {159, 142, 131, 255, 1},
-        {161, 145, 135, 255, 1},
-        {162, 148, 139, 255, 1},
-        {162, 148, 138, 255, 1},
-        {162, 148, 139, 255, 1},
-        {162, 148, 138, 255, 1},
-        {161, 147, 138, 255, 4},
-        {162, 148, 139, 255, 1},
-        {163, 148, 139, 255, 3},
-        {162, 148, 138, 255, 1},
-        {174, 160, 150, 255, 1},
-        {164, 146, 137, 132, 1},
-        {173, 155, 144, 255, 1},
-        {160, 143, 133, 255, 61},
-        {173, 155, 144, 255, 1},
-        {166, 152, 142, 132, 1},
-        {175, 161, 151, 255, 1},
-        {161, 148, 139, 255, 1},
-        {160, 148, 138, 255, 1},
-        {161, 148, 138, 255, 24},
-        {159, 143, 133, 255, 1},
-        {159, 142, 131, 255, 1},
-        {159, 142, 132, 255, 1},
-        {159, 141, 131, 255, 1},
-        {159, 145, 135, 255, 1},
-        {160, 148, 138, 255, 1},
-        {160, 147, 138, 255, 28},
-        {160, 144, 134, 255, 1},
-        {173, 155, 144, 255, 1},
-        {154, 119, 106, 132, 1},
-        {162, 124, 109, 255, 1},
-        {153, 117, 103, 255, 1},
-        {158, 119, 106, 255, 1},
-        {157, 119, 105, 255, 22},
-        {157, 118, 105, 255, 1},
-        {157, 119, 105, 255, 1},
-        {165, 144, 135, 255, 1},
-        {167, 150, 142, 255, 1},
-        {167, 149, 140, 255, 1},
-        {167, 151, 143, 255, 1},
-        {164, 132, 120, 255, 1},
-        {161, 119, 104, 255, 1},
-        {162, 121, 107, 255, 27},
-        {162, 120, 105, 255, 1},
-        {160, 137, 126, 255, 1},
-        {173, 156, 146, 255, 1},
-        {139, 77, 57, 132, 1},
-        {145, 75, 54, 255, 1},
-        {144, 76, 56, 255, 1},
-        {155, 82, 63, 255, 1},
-        {153, 81, 62, 255, 22},
-        {153, 80, 61, 255, 1},
-        {153, 81, 62, 255, 1},
-        {174, 146, 137, 255, 1},
-        {178, 161, 156, 255, 1},
-        {177, 158, 151, 255, 1},
-        {178, 164, 158, 255, 1},
-        {171, 115, 99, 255, 1},
-        {165, 81, 59, 255, 1},
-        {166, 87, 65, 255, 27},
-        {166, 85, 62, 255, 1},
-        {161, 128, 115, 255, 1},
-        {173, 158, 148, 255, 1},
-        {141, 81, 63, 132, 1},
-        {147, 81, 61, 255, 1},
-        {145, 81, 62, 255, 1},
-        {155, 87, 68, 255, 1},
-        {154, 86, 67, 255, 22},
-        {154, 85, 66, 255, 1},
-        {154, 86, 67, 255, 1},
-        {173, 146, 137, 255, 1},
-        {177, 160, 154, 255, 1},
-        {176, 157, 150, 255, 1},
-        {177, 162, 156, 255, 1},
-        {170, 117, 101, 255, 1},
-        {165, 86, 64, 255, 1},
-        {166, 91, 70, 255, 27},
-        {166, 89, 67, 255, 1},
-        {161, 129, 116, 255, 1},
-        {173, 158, 148, 255, 1},
-        {141, 81, 63, 132, 1},
-        {146, 80, 60, 255, 1},
-        {145, 81, 62, 255, 1},
-        {157, 88, 69, 255, 1},
-        {155, 87, 68, 255, 2},
-        {155, 87, 67, 255, 1},
-        {154, 86, 67, 255, 4},
-        {155, 87, 68, 255, 4},
-        {156, 87, 68, 255, 1},
-        {157, 88, 68, 255, 3},
-        {156, 87, 68, 255, 1},
-        {155, 87, 68, 255, 6},
-        {155, 86, 67, 255, 1},
-        {155, 87, 68, 255, 1},
-        {173, 146, 137, 255, 1},
-        {177, 160, 154, 255, 1},
-        {176, 157, 150, 255, 1},
-        {177, 162, 156, 255, 1},
-        {170, 117, 101, 255, 1},
-        {165, 86, 64, 255, 1},
-        {166, 91, 70, 255, 2},
-        {167, 91, 70, 255, 1},
-        {168, 92, 71, 255, 4},
-        {169, 92, 71, 255, 4},
-        {168, 92, 71, 255, 5},
-        {169, 92, 71, 255, 4},
-        {168, 92, 71, 255, 7},
-        {168, 90, 68, 255, 1},
-        {161, 130, 116, 255, 1},
-        {173, 158, 148, 255, 1},
-        {142, 83, 65, 132, 1},
-        {150, 84, 63, 255, 1},
-        {144, 81, 62, 255, 1},
-        {149, 84, 66, 255, 1},
-        {149, 83, 65, 255, 2},
-        {150, 84, 66, 255, 1},
-        {154, 86, 67, 255, 4},
-        {150, 83, 65, 255, 1},
-        {149, 83, 65, 255, 3},
-        {146, 81, 63, 255, 1},
-        {144, 80, 62, 255, 3},
-        {146, 81, 63, 255, 1},
-        {149, 83, 65, 255, 6},
-        {149, 82, 64, 255, 1},
-        {149, 83, 65, 255, 1},
-        {172, 145, 136, 255, 1},
-        {177, 160, 154, 255, 1},
-        {176, 157, 150, 255, 1},
-        {177, 162, 156, 255, 1},
-        {170, 117, 101, 255, 1},
-        {165, 86, 64, 255, 1},
-        {166, 91, 70, 255, 1},
-        {167, 91, 70, 255, 1},
-        {163, 90, 69, 255, 1},
-        {158, 87, 67, 255, 4},
-        {156, 86, 66, 255, 4},
-        {158, 87, 67, 255, 1},
-        {159, 87, 67, 255, 1},
-        {158, 87, 67, 255, 1},
-        {159, 87, 67, 255, 1},
-        {157, 86, 66, 255, 1},
-        {156, 86, 66, 255, 3},
-        {157, 86, 66, 255, 1},
-        {159, 87, 67, 255, 1},
-        {158, 87, 67, 255, 6},
-        {158, 85, 64, 255, 1},
-        {159, 128, 115, 255, 1},
-        {173, 158, 148, 255, 1},
-        {158, 90, 73, 132, 1},
-        {169, 94, 74, 255, 1},
-        {140, 78, 61, 255, 1},
-        {123, 68, 53, 255, 1},
-        {125, 69, 54, 255, 1},
-        {123, 68, 53, 255, 1},
-        {131, 73, 57, 255, 1},
-        {155, 86, 68, 255, 1},
-        {154, 86, 67, 255, 1},
-        {155, 86, 67, 255, 1},
-        {153, 85, 66, 255, 1},
-        {128, 71, 55, 255, 1},
-        {124, 68, 54, 255, 1},
-        {125, 69, 54, 255, 1},
-        {126, 70, 55, 255, 1},
-        {106, 59, 45, 255, 1},
-        {96, 53, 40, 255, 1},
-        {98, 54, 41, 255, 1},
-        {96, 53, 40, 255, 1},
-        {109, 60, 46, 255, 1},
-        {127, 70, 55, 255, 1},
-        {125, 69, 54, 255, 5},
-        {124, 68, 53, 255, 1},
-        {125, 69, 54, 255, 1},
-        {168, 143, 134, 255, 1},
-        {178, 161, 154, 255, 1},
-        {176, 157, 150, 255, 1},
-        {177, 162, 156, 255, 1},
-        {170, 117, 101, 255, 1},
-        {165, 86, 64, 255, 1},
-        {166, 91, 70, 255, 1},
-        {169, 93, 71, 255, 1},
-        {152, 83, 65, 255, 1},
-        {121, 67, 53, 255, 1},
-        {124, 69, 54, 255, 1},
-        {125, 69, 54, 255, 1},
-        {122, 68, 53, 255, 1},
-        {110, 61, 45, 255, 1},
-        {109, 61, 46, 255, 2},
-        {108, 61, 46, 255, 1},
-        {121, 67, 52, 255, 1},
-        {125, 69, 54, 255, 1},
-        {124, 69, 54, 255, 1},
-        {125, 70, 55, 255, 1},
-        {116, 65, 49, 255, 1},
-        {108, 60, 45, 255, 1},
-        {109, 61, 46, 255, 1},
-        {108, 60, 45, 255, 1},
-        {113, 63, 48, 255, 1},
-        {125, 69, 54, 255, 1},
-        {124, 69, 54, 255, 6},
-        {122, 65, 50, 255, 1},
-        {151, 123, 112, 255, 1},
-        {176, 160, 149, 255, 1},
-        {158, 90, 73, 132, 1},
-        {169, 94, 74, 255, 1},
-        {140, 78, 61, 255, 1},
-        {123, 68, 53, 255, 1},
-        {125, 69, 54, 255, 1},
-        {123, 68, 53, 255, 1},
-        {131, 73, 57, 255, 1},
-        {155, 86, 68, 255, 1},
-        {154, 86, 67, 255, 1},
-        {155, 86, 67, 255, 1},
-        {153, 85, 66, 255, 1},
-        {128, 71, 55, 255, 1},
-        {124, 68, 54, 255, 1},
-        {125, 69, 54, 255, 1},
-        {126, 70, 55, 255, 1},
-        {105, 59, 45, 255, 1},
-        {95, 53, 40, 255, 1},
-        {97, 54, 41, 255, 1},
-        {95, 53, 40, 255, 1},
-        {108, 60, 46, 255, 1},
-        {127, 70, 55, 255, 1},
-        {125, 69, 54, 255, 5},
-        {124, 68, 53, 255, 1},
-        {125, 69, 54, 255, 1},
-        {168, 143, 134, 255, 1},
-        {178, 161, 154, 255, 1},
-        {176, 157, 150, 255, 1},
-        {177, 162, 156, 255, 1},
-        {170, 117, 101, 255, 1},
-        {165, 86, 64, 255, 1},
-        {166, 91, 70, 255, 1},
-        {169, 93, 71, 255, 1},
-        {152, 83, 65, 255, 1},
-        {122, 67, 53, 255, 1},
-        {125, 69, 54, 255, 1},
-        {126, 69, 54, 255, 1},
-        {123, 68, 53, 255, 1},
-        {110, 61, 45, 255, 1},
-        {109, 61, 46, 255, 2},
-        {108, 61, 46, 255, 1},
-        {122, 67, 52, 255, 1},
-        {126, 69, 54, 255, 1},
-        {125, 69, 54, 255, 1},
-        {126, 70, 55, 255, 1},
-        {116, 65, 49, 255, 1},
-        {108, 60, 45, 255, 1},
-        {109, 61, 46, 255, 1},
-        {108, 60, 45, 255, 1},
-        {113, 63, 48, 255, 1},
-        {126, 69, 54, 255, 1},
-        {125, 69, 54, 255, 6},
-        {123, 65, 50, 255, 1},
-        {151, 123, 112, 255, 1},
-        {176, 160, 149, 255, 1},
-        {158, 90, 73, 132, 1},
-        {169, 94, 74, 255, 1},
-        {140, 78, 61, 255, 1},
-        {123, 68, 53, 255, 1},
-        {125, 69, 54, 255, 1},
-        {123, 68, 53, 255, 1},
-        {131, 73, 57, 255, 1},
-        {155, 86, 68, 255, 1},
-        {154, 86, 67, 255, 1},
-        {155, 86, 67, 255, 1},
-        {153, 85, 66, 255, 1},
-        {128, 71, 55, 255, 1},
-        {124, 68, 54, 255, 1},
-        {125, 69, 54, 255, 1},
-        {126, 70, 55, 255, 1},
-        {106, 59, 45, 255, 1},
-        {96, 53, 40, 255, 1},
-        {98, 54, 41, 255, 1},
-        {96, 53, 40, 255, 1},
-        {109, 60, 46, 255, 1},
-        {127, 70, 55, 255, 1},
-        {125, 69, 54, 255, 5},
-        {124, 68, 53, 255, 1},
-        {125, 69, 54, 255, 1},
-        {168, 143, 134, 255, 1},
-        {178, 161, 154, 255, 1},
-        {176, 157, 150, 255, 1},
-        {177, 162, 156, 255, 1},
-        {170, 117, 101, 255, 1},
-        {165, 86, 64, 255, 1},
-        {166, 91, 70, 255, 1},
-        {169, 93, 71, 255, 1},
-        {152, 83, 65, 255, 1},
-        {122, 67, 53, 255, 1},
-        {125, 69, 54, 255, 1},
-        {126, 69, 54, 255, 1},
-        {123, 68, 53, 255, 1},
-        {111, 61, 45, 255, 1},
-        {110, 61, 46, 255, 2},
-        {109, 61, 46, 255, 1},
-        {122, 67, 52, 255, 1},
-        {126, 69, 54, 255, 1},
-        {125, 69, 54, 255, 1},
-        {126, 70, 55, 255, 1},
-        {117, 65, 49, 255, 1},
-        {109, 60, 45, 255, 1},
-        {110, 61, 46, 255, 1},
-        {109, 60, 45, 255, 1},
-        {114, 63, 48, 255, 1},
-        {126, 69, 54, 255, 1},
-        {125, 69, 54, 255, 6},
-        {123, 65, 50, 255, 1},
-        {151, 123, 112, 255, 1},
-        {176, 160, 149, 255, 1},
-        {158, 90, 73, 132, 1},
-        {169, 94, 74, 255, 1},
-        {140, 78, 61, 255, 1},
-        {123, 68, 53, 255, 1},
-        {125, 69, 54, 255, 1},
-        {123, 68, 53, 255, 1},
-        {132, 73, 57, 255, 1},
-        {155, 86, 68, 255, 1},
-        {154, 86, 67, 255, 1},
-        {155, 86, 67, 255, 1},
-        {153, 85, 66, 255, 1},
-        {128, 71, 55, 255, 1},
-        {124, 68, 54, 255, 1},
-        {125, 69, 54, 255, 1},
-        {126, 70, 55, 255, 1},
-        {106, 59, 45, 255, 1},
-        {96, 53, 40, 255, 1},
-        {98, 54, 41, 255, 1},
-        {96, 53, 40, 255, 1},
-        {109, 60, 46, 255, 1},
-        {127, 70, 55, 255, 1},
-        {125, 69, 54, 255, 5},
-        {124, 68, 53, 255, 1},
-        {125, 69, 54, 255, 1},
-        {168, 143, 134, 255, 1},
-        {178, 161, 154, 255, 1},
-        {176, 157, 150, 255, 1},
-        {177, 162, 156, 255, 1},
-        {170, 117, 101, 255, 1},
-        {165, 86, 64, 255, 1},
-        {166, 91, 70, 255, 1},
-        {169, 93, 71, 255, 1},
-        {152, 83, 65, 255, 1},
-        {122, 67, 53, 255, 1},
-        {125, 69, 54, 255, 1},
-        {126, 69, 54, 255, 1},
-        {123, 68, 53, 255, 1},
-        {111, 61, 45, 255, 1},
-        {110, 61, 45, 255, 2},
-        {109, 61, 45, 255, 1},
-        {122, 67, 52, 255, 1},
-        {126, 69, 54, 255, 1},
-        {125, 69, 54, 255, 1},
-        {126, 70, 55, 255, 1},
-        {117, 65, 49, 255, 1},
-        {109, 60, 44, 255, 1},
-        {110, 61, 45, 255, 1},
-        {109, 60, 44, 255, 1},
-        {114, 63, 48, 255, 1},
-        {126, 69, 54, 255, 1},
-        {125, 69, 54, 255, 6},
-        {123, 65, 50, 255, 1},
-        {151, 123, 112, 255, 1},
-        {176, 160, 149, 255, 1},
-        {158, 90, 73, 132, 1},
-        {172, 96, 75, 255, 1},
-        {129, 72, 56, 255, 1},
-        {98, 54, 41, 255, 1},
-        {102, 56, 43, 255, 1},
-        {100, 54, 42, 255, 1},
-        {114, 63, 48, 255, 1},
-        {156, 87, 68, 255, 1},
-        {154, 86, 67, 255, 1},
-        {155, 87, 68, 255, 1},
-        {152, 85, 66, 255, 1},
-        {108, 59, 46, 255, 1},
-        {100, 55, 42, 255, 1},
-        {102, 56, 43, 255, 1},
-        {101, 56, 42, 255, 1},
-        {115, 63, 49, 255, 1},
-        {122, 67, 53, 255, 1},
-        {121, 67, 52, 255, 1},
-        {122, 67, 53, 255, 1},
-        {113, 62, 48, 255, 1},
-        {101, 56, 42, 255, 1},
-        {102, 56, 43, 255, 1},
-        {101, 55, 42, 255, 1},
-        {106, 59, 44, 255, 1},
-        {125, 69, 54, 255, 2},
-        {124, 68, 53, 255, 1},
-        {125, 69, 54, 255, 1},
-        {168, 143, 134, 255, 1},
-        {178, 161, 154, 255, 1},
-        {176, 157, 150, 255, 1},
-        {177, 162, 156, 255, 1},
-        {170, 117, 101, 255, 1},
-        {165, 86, 64, 255, 1},
-        {166, 91, 70, 255, 1},
-        {170, 93, 72, 255, 1},
-        {148, 81, 62, 255, 1},
-        {109, 60, 45, 255, 1},
-        {113, 62, 47, 255, 1},
-        {112, 62, 47, 255, 1},
-        {114, 63, 48, 255, 1},
-        {122, 68, 52, 255, 1},
-        {123, 68, 52, 255, 3},
-        {115, 64, 48, 255, 1},
-        {112, 62, 47, 255, 1},
-        {113, 62, 47, 255, 1},
-        {112, 62, 46, 255, 1},
-        {118, 65, 49, 255, 1},
-        {123, 69, 53, 255, 1},
-        {123, 68, 52, 255, 1},
-        {122, 68, 52, 255, 1},
-        {123, 68, 53, 255, 1},
-        {125, 69, 54, 255, 7},
-        {123, 65, 50, 255, 1},
-        {151, 123, 112, 255, 1},
-        {176, 160, 149, 255, 1},
-        {158, 90, 73, 132, 1},
-        {172, 96, 75, 255, 1},
-        {126, 71, 55, 255, 1},
-        {92, 50, 38, 255, 1},
-        {97, 53, 40, 255, 1},
-        {94, 51, 39, 255, 1},
-        {109, 60, 47, 255, 1},
-        {156, 87, 68, 255, 1},
-        {154, 86, 67, 255, 1},
-        {155, 87, 68, 255, 1},
-        {152, 85, 66, 255, 1},
-        {103, 56, 43, 255, 1},
-        {95, 52, 39, 255, 1},
-        {97, 53, 40, 255, 1},
-        {95, 52, 39, 255, 1},
-        {116, 64, 50, 255, 1},
-        {128, 71, 56, 255, 1},
-        {126, 70, 55, 255, 1},
-        {128, 71, 56, 255, 1},
-        {114, 63, 49, 255, 1},
-        {95, 52, 39, 255, 1},
-        {97, 53, 40, 255, 1},
-        {96, 52, 39, 255, 1},
-        {101, 56, 43, 255, 1},
-        {125, 69, 54, 255, 2},
-        {124, 68, 53, 255, 1},
-        {125, 69, 54, 255, 1},
-        {168, 143, 134, 255, 1},
-        {178, 161, 154, 255, 1},
-        {176, 157, 150, 255, 1},
-        {177, 162, 156, 255, 1},
-        {170, 117, 101, 255, 1},
-        {165, 86, 64, 255, 1},
-        {166, 91, 70, 255, 1},
-        {170, 93, 72, 255, 1},
-        {147, 81, 62, 255, 1},
-        {105, 59, 44, 255, 1},
-        {109, 61, 46, 255, 1},
-        {108, 61, 46, 255, 1},
-        {111, 62, 47, 255, 1},
-        {125, 69, 54, 255, 1},
-        {126, 69, 54, 255, 2},
-        {127, 69, 54, 255, 1},
-        {114, 63, 48, 255, 1},
-        {108, 61, 46, 255, 1},
-        {109, 61, 46, 255, 1},
-        {108, 60, 45, 255, 1},
-        {118, 65, 49, 255, 1},
-        {127, 70, 56, 255, 1},
-        {126, 69, 54, 255, 2},
-        {125, 69, 54, 255, 8},
-        {123, 65, 50, 255, 1},
-        {151, 123, 112, 255, 1},
-        {176, 160, 149, 255, 1},
-        {158, 90, 73, 132, 1},
-        {172, 96, 75, 255, 1},
-        {127, 71, 55, 255, 1},
-        {93, 51, 39, 255, 1},
-        {98, 54, 41, 255, 1},
-        {95, 52, 40, 255, 1},
-        {110, 61, 47, 255, 1},
-        {156, 87, 68, 255, 1},
-        {154, 86, 67, 255, 1},
-        {155, 87, 68, 255, 1},
-        {152, 85, 66, 255, 1},
-        {104, 57, 44, 255, 1},
-        {96, 53, 40, 255, 1},
-        {98, 54, 41, 255, 1},
-        {96, 53, 40, 255, 1},
-        {116, 64, 50, 255, 1},
-        {127, 70, 55, 255, 1},
-        {125, 69, 54, 255, 1},
-        {127, 70, 55, 255, 1},
-        {114, 63, 49, 255, 1},
-        {96, 53, 40, 255, 1},
-        {98, 54, 41, 255, 1},
-        {97, 53, 40, 255, 1},
-        {102, 57, 43, 255, 1},
-        {125, 69, 54, 255, 2},
-        {124, 68, 53, 255, 1},
-        {125, 69, 54, 255, 1},
-        {168, 143, 134, 255, 1},
-        {178, 161, 154, 255, 1},
-        {176, 157, 150, 255, 1},
-        {177, 162, 156, 255, 1},
-        {170, 117, 101, 255, 1},
-        {165, 86, 64, 255, 1},
-        {166, 91, 70, 255, 1},
-        {170, 93, 72, 255, 1},
-        {147, 81, 62, 255, 1},
-        {106, 59, 44, 255, 1},
-        {110, 61, 46, 255, 1},
-        {109, 61, 46, 255, 1},
-        {112, 62, 47, 255, 1},
-        {124, 69, 54, 255, 1},
-        {125, 69, 54, 255, 2},
-        {126, 69, 54, 255, 1},
-        {114, 63, 48, 255, 1},
-        {109, 61, 46, 255, 1},
-        {110, 61, 46, 255, 1},
-        {109, 60, 45, 255, 1},
-        {118, 65, 49, 255, 1},
-        {126, 70, 55, 255, 1},
-        {125, 69, 54, 255, 10},
-        {123, 65, 50, 255, 1},
-        {151, 123, 112, 255, 1},
-        {176, 160, 149, 255, 1},
-        {158, 86, 67, 132, 1},
-        {172, 91, 70, 255, 1},
-        {125, 65, 49, 255, 1},
-        {88, 44, 32, 255, 1},
-        {93, 47, 34, 255, 1},
-        {90, 45, 33, 255, 1},
-        {106, 55, 40, 255, 1},
-        {156, 83, 63, 255, 1},
-        {153, 82, 62, 255, 1},
-        {154, 83, 63, 255, 1},
-        {151, 80, 61, 255, 1},
-        {100, 50, 37, 255, 1},
-        {91, 46, 33, 255, 1},
-        {93, 47, 34, 255, 1},
-        {91, 46, 33, 255, 1},
-        {112, 58, 43, 255, 1},
-        {124, 65, 49, 255, 1},
-        {122, 64, 48, 255, 1},
-        {124, 65, 49, 255, 1},
-        {110, 57, 42, 255, 1},
-        {91, 46, 33, 255, 1},
-        {93, 47, 34, 255, 1},
-        {92, 46, 33, 255, 1},
-        {98, 50, 36, 255, 1},
-        {122, 63, 48, 255, 1},
-        {122, 64, 48, 255, 1},
-        {121, 62, 47, 255, 1},
-        {122, 63, 48, 255, 1},
-        {169, 143, 134, 255, 1},
-        {179, 162, 156, 255, 1},
-        {177, 158, 151, 255, 1},
-        {178, 163, 158, 255, 1},
-        {171, 115, 99, 255, 1},
-        {165, 82, 59, 255, 1},
-        {166, 87, 65, 255, 1},
-        {170, 89, 68, 255, 1},
-        {146, 76, 57, 255, 1},
-        {102, 53, 37, 255, 1},
-        {106, 55, 39, 255, 1},
-        {105, 55, 39, 255, 1},
-        {108, 56, 40, 255, 1},
-        {121, 63, 48, 255, 1},
-        {122, 64, 48, 255, 1},
-        {122, 63, 48, 255, 1},
-        {123, 64, 48, 255, 1},
-        {110, 57, 41, 255, 1},
-        {105, 55, 39, 255, 1},
-        {106, 55, 39, 255, 1},
-        {105, 54, 38, 255, 1},
-        {115, 59, 43, 255, 1},
-        {123, 64, 49, 255, 1},
-        {122, 63, 48, 255, 3},
-        {122, 64, 48, 255, 1},
-        {122, 63, 48, 255, 1},
-        {122, 64, 48, 255, 2},
-        {122, 63, 48, 255, 1},
-        {122, 64, 48, 255, 1},
-        {122, 63, 48, 255, 1},
-        {120, 59, 44, 255, 1},
-        {150, 122, 110, 255, 1},
-        {176, 160, 149, 255, 1},
-        {162, 125, 112, 132, 1},
-        {172, 132, 118, 255, 1},
-        {148, 114, 102, 255, 1},
-        {134, 105, 94, 255, 1},
-        {136, 107, 95, 255, 1},
-        {135, 106, 94, 255, 1},
-        {141, 110, 98, 255, 1},
-        {159, 121, 108, 255, 1},
-        {158, 121, 108, 255, 2},
-        {157, 121, 107, 255, 1},
-        {138, 108, 96, 255, 1},
-        {135, 106, 95, 255, 1},
-        {136, 106, 95, 255, 1},
-        {135, 106, 94, 255, 1},
-        {143, 112, 100, 255, 1},
-        {147, 115, 104, 255, 1},
-        {146, 115, 103, 255, 1},
-        {147, 116, 104, 255, 1},
-        {142, 111, 100, 255, 1},
-        {135, 106, 94, 255, 1},
-        {136, 106, 95, 255, 2},
-        {138, 108, 96, 255, 1},
-        {146, 115, 103, 255, 2},
-        {146, 114, 103, 255, 1},
-        {146, 115, 103, 255, 1},
-        {163, 143, 134, 255, 1},
-        {167, 150, 141, 255, 1},
-        {166, 148, 140, 255, 1},
-        {167, 150, 142, 255, 1},
-        {164, 133, 121, 255, 1},
-        {161, 121, 107, 255, 1},
-        {162, 123, 109, 255, 1},
-        {163, 124, 110, 255, 1},
-        {155, 119, 106, 255, 1},
-        {139, 111, 99, 255, 1},
-        {141, 112, 100, 255, 2},
-        {142, 112, 100, 255, 1},
-        {146, 115, 103, 255, 4},
-        {142, 112, 100, 255, 1},
-        {141, 112, 100, 255, 2},
-        {141, 111, 100, 255, 1},
-        {144, 113, 102, 255, 1},
-        {147, 115, 103, 255, 1},
-        {146, 115, 103, 255, 10},
-        {146, 113, 101, 255, 1},
-        {156, 136, 125, 255, 1},
-        {174, 157, 146, 255, 1},
-        {164, 150, 142, 132, 1},
-        {173, 160, 149, 255, 1},
-        {163, 149, 139, 255, 1},
-        {165, 150, 141, 255, 1},
-        {165, 150, 140, 255, 2},
-        {164, 149, 140, 255, 1},
-        {160, 147, 138, 255, 3},
-        {161, 148, 138, 255, 1},
-        {164, 150, 140, 255, 1},
-        {165, 150, 140, 255, 3},
-        {163, 149, 140, 255, 1},
-        {163, 149, 139, 255, 3},
-        {164, 149, 140, 255, 1},
-        {165, 150, 140, 255, 4},
-        {163, 149, 139, 255, 4},
-        {159, 143, 133, 255, 1},
-        {159, 142, 131, 255, 1},
-        {159, 142, 132, 255, 1},
-        {159, 142, 131, 255, 1},
-        {159, 145, 135, 255, 1},
-        {160, 147, 138, 255, 2},
-        {159, 147, 138, 255, 1},
-        {161, 148, 138, 255, 1},
-        {164, 149, 140, 255, 4},
-        {163, 149, 139, 255, 4},
-        {164, 149, 140, 255, 4},
-        {163, 149, 139, 255, 13},
-        {161, 145, 135, 255, 1},
-        {173, 155, 144, 255, 1},
-        {164, 146, 137, 132, 1},
-        {173, 155, 144, 255, 1},
-        {160, 143, 133, 255, 61},
-        {173, 155, 144, 255, 1},
-        {164, 150, 141, 132, 1},
-        {173, 159, 149, 255, 1},
-        {160, 147, 138, 255, 8},
-        {160, 147, 137, 255, 1},
-        {159, 143, 132, 255, 1},
-        {159, 142, 132, 255, 2},
-        {159, 142, 131, 255, 1},
-        {160, 146, 136, 255, 1},
-        {160, 148, 138, 255, 1},
-        {160, 147, 138, 255, 11},
-        {159, 146, 137, 255, 4},
-        {160, 147, 138, 255, 13},
-        {159, 143, 133, 255, 1},
-        {159, 142, 131, 255, 1},
-        {159, 142, 132, 255, 1},
-        {159, 142, 131, 255, 1},
-        {160, 145, 135, 255, 1},
-        {160, 148, 138, 255, 1},
-        {160, 147, 138, 255, 7},
-        {159, 146, 137, 255, 4},
-        {161, 147, 138, 255, 1},
-        {175, 161, 150, 255, 1},
-        {164, 129, 115, 132, 1},
-        {174, 134, 120, 255, 1},
-        {161, 124, 111, 255, 1},
-        {160, 124, 111, 255, 3},
-        {161, 124, 111, 255, 1},
-        {160, 124, 111, 255, 1},
-        {161, 124, 111, 255, 1},
-        {160, 123, 111, 255, 1},
-        {160, 125, 112, 255, 1},
-        {165, 145, 136, 255, 1},
-        {166, 148, 140, 255, 1},
-        {166, 148, 139, 255, 1},
-        {166, 149, 141, 255, 1},
-        {161, 131, 119, 255, 1},
-        {158, 121, 108, 255, 1},
-        {159, 123, 110, 255, 11},
-        {165, 127, 112, 255, 1},
-        {166, 128, 113, 255, 2},
-        {167, 128, 113, 255, 1},
-        {161, 125, 111, 255, 1},
-        {158, 122, 109, 255, 1},
-        {159, 123, 110, 255, 10},
-        {158, 122, 109, 255, 1},
-        {164, 143, 133, 255, 1},
-        {166, 149, 141, 255, 1},
-        {166, 148, 139, 255, 1},
-        {166, 150, 141, 255, 1},
-        {162, 135, 123, 255, 1},
-        {158, 121, 107, 255, 1},
-        {159, 123, 110, 255, 5},
-        {158, 123, 110, 255, 1},
-        {159, 123, 110, 255, 1},
-        {166, 127, 113, 255, 1},
-        {166, 128, 113, 255, 2},
-        {167, 128, 113, 255, 1},
-        {156, 122, 109, 255, 1},
-        {164, 129, 116, 255, 1},
-        {162, 88, 73, 132, 1},
-        {172, 91, 71, 255, 1},
-        {159, 84, 66, 255, 7},
-        {159, 83, 64, 255, 1},
-        {160, 86, 69, 255, 1},
-        {175, 150, 142, 255, 1},
-        {178, 160, 154, 255, 1},
-        {177, 158, 151, 255, 1},
-        {179, 163, 157, 255, 1},
-        {161, 107, 91, 255, 1},
-        {152, 76, 56, 255, 1},
-        {154, 82, 62, 255, 2},
-        {154, 82, 63, 255, 3},
-        {154, 82, 62, 255, 1},
-        {154, 82, 63, 255, 1},
-        {154, 82, 62, 255, 2},
-        {154, 82, 63, 255, 1},
-        {154, 82, 62, 255, 1},
-        {175, 94, 71, 255, 1},
-        {179, 97, 72, 255, 1},
-        {178, 96, 72, 255, 1},
-        {180, 97, 73, 255, 1},
-        {163, 87, 67, 255, 1},
-        {152, 81, 61, 255, 1},
-        {154, 82, 63, 255, 1},
-        {154, 82, 62, 255, 3},
-        {154, 82, 63, 255, 1},
-        {154, 82, 62, 255, 1},
-        {154, 82, 63, 255, 2},
-        {154, 82, 62, 255, 1},
-        {154, 81, 62, 255, 1},
-        {153, 79, 60, 255, 1},
-        {172, 142, 132, 255, 1},
-        {178, 162, 156, 255, 1},
-        {177, 158, 151, 255, 1},
-        {179, 164, 159, 255, 1},
-        {166, 117, 103, 255, 1},
-        {152, 75, 55, 255, 1},
-        {154, 82, 63, 255, 3},
-        {154, 82, 62, 255, 1},
-        {154, 82, 63, 255, 1},
-        {153, 82, 62, 255, 1},
-        {155, 83, 63, 255, 1},
-        {176, 95, 71, 255, 1},
-        {179, 96, 72, 255, 1},
-        {178, 96, 72, 255, 1},
-        {180, 97, 73, 255, 1},
-        {145, 78, 57, 255, 1},
-        {140, 75, 55, 255, 1},
-        {162, 92, 77, 132, 1},
-        {172, 95, 76, 255, 1},
-        {159, 88, 70, 255, 7},
-        {159, 87, 68, 255, 1},
-        {160, 90, 73, 255, 1},
-        {174, 150, 141, 255, 1},
-        {177, 159, 153, 255, 1},
-        {176, 157, 150, 255, 1},
-        {178, 162, 155, 255, 1},
-        {161, 109, 94, 255, 1},
-        {152, 81, 61, 255, 1},
-        {154, 86, 67, 255, 11},
-        {174, 97, 75, 255, 1},
-        {178, 100, 76, 255, 1},
-        {177, 99, 76, 255, 1},
-        {179, 100, 77, 255, 1},
-        {163, 91, 71, 255, 1},
-        {152, 85, 66, 255, 1},
-        {154, 86, 67, 255, 9},
-        {154, 86, 66, 255, 1},
-        {153, 84, 64, 255, 1},
-        {171, 142, 132, 255, 1},
-        {177, 161, 155, 255, 1},
-        {176, 157, 150, 255, 1},
-        {178, 163, 157, 255, 1},
-        {165, 119, 105, 255, 1},
-        {152, 80, 60, 255, 1},
-        {154, 86, 67, 255, 5},
-        {153, 86, 67, 255, 1},
-        {155, 87, 68, 255, 1},
-        {175, 98, 75, 255, 1},
-        {178, 99, 76, 255, 1},
-        {177, 99, 76, 255, 1},
-        {179, 100, 77, 255, 1},
-        {146, 82, 62, 255, 1},
-        {142, 80, 61, 255, 1},
-        {164, 92, 77, 132, 1},
-        {173, 96, 77, 255, 1},
-        {160, 89, 71, 255, 7},
-        {160, 88, 69, 255, 1},
-        {161, 91, 74, 255, 1},
-        {174, 150, 141, 255, 1},
-        {177, 159, 153, 255, 1},
-        {176, 157, 150, 255, 1},
-        {178, 162, 155, 255, 1},
-        {161, 109, 94, 255, 1},
-        {152, 81, 61, 255, 1},
-        {154, 86, 67, 255, 3},
-        {155, 87, 68, 255, 1},
-        {155, 87, 67, 255, 7},
-        {176, 98, 76, 255, 1},
-        {180, 101, 77, 255, 1},
-        {179, 100, 77, 255, 1},
-        {181, 101, 78, 255, 1},
-        {164, 92, 72, 255, 1},
-        {153, 86, 66, 255, 1},
-        {155, 87, 67, 255, 1},
-        {155, 87, 68, 255, 1},
-        {155, 86, 67, 255, 1},
-        {154, 86, 67, 255, 4},
-        {156, 87, 68, 255, 2},
-        {156, 87, 67, 255, 1},
-        {155, 85, 65, 255, 1},
-        {171, 142, 132, 255, 1},
-        {177, 161, 155, 255, 1},
-        {176, 157, 150, 255, 1},
-        {178, 163, 157, 255, 1},
-        {165, 119, 105, 255, 1},
-        {152, 80, 60, 255, 1},
-        {154, 86, 67, 255, 3},
-        {155, 86, 67, 255, 2},
-        {154, 86, 67, 255, 1},
-        {156, 87, 68, 255, 1},
-        {177, 99, 76, 255, 1},
-        {180, 100, 77, 255, 1},
-        {179, 100, 77, 255, 1},
-        {181, 101, 78, 255, 1},
-        {147, 82, 62, 255, 1},
-        {142, 80, 61, 255, 1},
-        {158, 90, 75, 132, 1},
-        {168, 93, 74, 255, 1},
-        {155, 86, 68, 255, 7},
-        {155, 85, 67, 255, 1},
-        {156, 88, 71, 255, 1},
-        {174, 150, 141, 255, 1},
-        {177, 159, 153, 255, 1},
-        {176, 157, 150, 255, 1},
-        {178, 162, 155, 255, 1},
-        {161, 109, 94, 255, 1},
-        {152, 81, 61, 255, 1},
-        {154, 86, 67, 255, 2},
-        {152, 85, 66, 255, 1},
-        {150, 84, 65, 255, 1},
-        {150, 84, 66, 255, 2},
-        {151, 84, 66, 255, 1},
-        {150, 84, 66, 255, 4},
-        {168, 94, 72, 255, 1},
-        {172, 96, 73, 255, 1},
-        {171, 95, 73, 255, 1},
-        {173, 96, 74, 255, 1},
-        {159, 89, 69, 255, 1},
-        {149, 83, 65, 255, 1},
-        {151, 84, 66, 255, 1},
-        {150, 84, 65, 255, 1},
-        {152, 85, 66, 255, 1},
-        {154, 86, 67, 255, 3},
-        {153, 86, 67, 255, 1},
-        {149, 83, 64, 255, 2},
-        {149, 82, 63, 255, 1},
-        {148, 81, 62, 255, 1},
-        {170, 141, 131, 255, 1},
-        {177, 161, 155, 255, 1},
-        {176, 157, 150, 255, 1},
-        {178, 163, 157, 255, 1},
-        {165, 119, 105, 255, 1},
-        {152, 80, 60, 255, 1},
-        {154, 86, 67, 255, 2},
-        {153, 86, 67, 255, 1},
-        {152, 85, 66, 255, 2},
-        {151, 85, 66, 255, 1},
-        {153, 86, 66, 255, 1},
-        {169, 95, 73, 255, 1},
-        {172, 96, 73, 255, 1},
-        {171, 96, 73, 255, 1},
-        {173, 97, 74, 255, 1},
-        {144, 81, 62, 255, 1},
-        {143, 80, 61, 255, 1},
-        {129, 75, 59, 132, 1},
-        {136, 76, 59, 255, 1},
-        {126, 69, 55, 255, 1},
-        {126, 70, 55, 255, 3},
-        {126, 69, 55, 255, 1},
-        {126, 70, 55, 255, 1},
-        {126, 69, 55, 255, 1},
-        {125, 68, 53, 255, 1},
-        {128, 73, 58, 255, 1},
-        {170, 148, 139, 255, 1},
-        {178, 160, 153, 255, 1},
-        {176, 157, 150, 255, 1},
-        {178, 162, 155, 255, 1},
-        {161, 109, 94, 255, 1},
-        {152, 81, 61, 255, 1},
-        {154, 86, 67, 255, 1},
-        {156, 87, 68, 255, 1},
-        {142, 79, 62, 255, 1},
-        {124, 68, 53, 255, 1},
-        {126, 69, 54, 255, 7},
-        {126, 70, 54, 255, 1},
-        {127, 70, 54, 255, 3},
-        {126, 70, 54, 255, 1},
-        {126, 69, 54, 255, 2},
-        {124, 68, 53, 255, 1},
-        {136, 75, 58, 255, 1},
-        {156, 87, 68, 255, 1},
-        {154, 86, 67, 255, 1},
-        {156, 87, 68, 255, 1},
-        {149, 83, 64, 255, 1},
-        {110, 62, 47, 255, 1},
-        {109, 60, 47, 255, 1},
-        {109, 60, 46, 255, 1},
-        {107, 58, 44, 255, 1},
-        {161, 137, 127, 255, 1},
-        {180, 162, 156, 255, 1},
-        {176, 157, 150, 255, 1},
-        {178, 163, 157, 255, 1},
-        {165, 119, 105, 255, 1},
-        {152, 80, 60, 255, 1},
-        {154, 86, 67, 255, 1},
-        {155, 87, 68, 255, 1},
-        {149, 83, 64, 255, 1},
-        {134, 74, 56, 255, 1},
-        {135, 75, 57, 255, 2},
-        {134, 75, 57, 255, 1},
-        {127, 70, 55, 255, 1},
-        {126, 70, 54, 255, 1},
-        {127, 70, 54, 255, 1},
-        {126, 70, 54, 255, 1},
-        {132, 73, 56, 255, 1},
-        {146, 82, 62, 255, 1},
-        {127, 75, 59, 132, 1},
-        {134, 75, 58, 255, 1},
-        {124, 69, 54, 255, 7},
-        {123, 67, 52, 255, 1},
-        {126, 72, 57, 255, 1},
-        {170, 148, 139, 255, 1},
-        {178, 160, 153, 255, 1},
-        {176, 157, 150, 255, 1},
-        {178, 162, 155, 255, 1},
-        {161, 109, 94, 255, 1},
-        {152, 81, 61, 255, 1},
-        {154, 86, 67, 255, 1},
-        {156, 87, 68, 255, 1},
-        {142, 79, 62, 255, 1},
-        {122, 68, 53, 255, 1},
-        {125, 69, 54, 255, 2},
-        {124, 69, 54, 255, 1},
-        {125, 69, 54, 255, 4},
-        {124, 68, 54, 255, 4},
-        {124, 69, 54, 255, 1},
-        {125, 69, 54, 255, 1},
-        {124, 69, 54, 255, 1},
-        {122, 68, 53, 255, 1},
-        {135, 75, 58, 255, 1},
-        {156, 87, 68, 255, 1},
-        {154, 86, 67, 255, 1},
-        {156, 87, 68, 255, 1},
-        {149, 83, 64, 255, 1},
-        {108, 61, 46, 255, 1},
-        {106, 60, 46, 255, 1},
-        {107, 59, 45, 255, 1},
-        {105, 57, 43, 255, 1},
-        {161, 136, 127, 255, 1},
-        {180, 162, 156, 255, 1},
-        {176, 157, 150, 255, 1},
-        {178, 163, 157, 255, 1},
-        {165, 119, 105, 255, 1},
-        {152, 80, 60, 255, 1},
-        {154, 86, 67, 255, 1},
-        {155, 87, 68, 255, 1},
-        {149, 83, 64, 255, 1},
-        {134, 74, 56, 255, 1},
-        {134, 75, 57, 255, 2},
-        {133, 75, 57, 255, 1},
-        {125, 68, 54, 255, 1},
-        {124, 68, 54, 255, 3},
-        {131, 73, 56, 255, 1},
-        {146, 82, 62, 255, 1},
-        {127, 75, 59, 132, 1},
-        {135, 75, 58, 255, 1},
-        {125, 69, 54, 255, 7},
-        {124, 67, 52, 255, 1},
-        {127, 72, 57, 255, 1},
-        {170, 148, 139, 255, 1},
-        {178, 160, 153, 255, 1},
-        {176, 157, 150, 255, 1},
-        {178, 162, 155, 255, 1},
-        {161, 109, 94, 255, 1},
-        {152, 81, 61, 255, 1},
-        {154, 86, 67, 255, 1},
-        {156, 87, 68, 255, 1},
-        {142, 79, 62, 255, 1},
-        {123, 68, 53, 255, 1},
-        {125, 69, 54, 255, 14},
-        {123, 68, 53, 255, 1},
-        {135, 75, 58, 255, 1},
-        {156, 87, 68, 255, 1},
-        {154, 86, 67, 255, 1},
-        {156, 87, 68, 255, 1},
-        {149, 83, 64, 255, 1},
-        {109, 61, 46, 255, 1},
-        {107, 60, 46, 255, 1},
-        {108, 59, 45, 255, 1},
-        {106, 57, 43, 255, 1},
-        {161, 136, 127, 255, 1},
-        {180, 162, 156, 255, 1},
-        {176, 157, 150, 255, 1},
-        {178, 163, 157, 255, 1},
-        {165, 119, 105, 255, 1},
-        {152, 80, 60, 255, 1},
-        {154, 86, 67, 255, 1},
-        {155, 87, 68, 255, 1},
-        {149, 83, 64, 255, 1},
-        {134, 74, 56, 255, 1},
-        {134, 75, 57, 255, 2},
-        {133, 75, 57, 255, 1},
-        {126, 69, 54, 255, 1},
-        {125, 69, 54, 255, 3},
-        {131, 73, 56, 255, 1},
-        {146, 82, 62, 255, 1},
-        {127, 75, 59, 132, 1},
-        {135, 75, 58, 255, 1},
-        {125, 69, 54, 255, 7},
-        {124, 67, 52, 255, 1},
-        {126, 72, 57, 255, 1},
-        {170, 148, 139, 255, 1},
-        {178, 160, 153, 255, 1},
-        {176, 157, 150, 255, 1},
-        {178, 162, 155, 255, 1},
-        {161, 109, 94, 255, 1},
-        {152, 81, 61, 255, 1},
-        {154, 86, 67, 255, 1},
-        {156, 87, 68, 255, 1},
-        {142, 79, 62, 255, 1},
-        {123, 68, 53, 255, 1},
-        {125, 69, 54, 255, 3},
-        {126, 70, 54, 255, 1},
-        {126, 70, 55, 255, 1},
-        {126, 69, 55, 255, 1},
-        {126, 70, 55, 255, 1},
-        {125, 69, 54, 255, 5},
-        {126, 69, 54, 255, 2},
-        {124, 68, 53, 255, 1},
-        {135, 75, 58, 255, 1},
-        {156, 87, 68, 255, 1},
-        {154, 86, 67, 255, 1},
-        {156, 87, 68, 255, 1},
-        {149, 83, 64, 255, 1},
-        {108, 60, 45, 255, 1},
-        {106, 59, 45, 255, 1},
-        {107, 58, 44, 255, 1},
-        {105, 56, 42, 255, 1},
-        {161, 136, 127, 255, 1},
-        {180, 162, 156, 255, 1},
-        {176, 157, 150, 255, 1},
-        {178, 163, 157, 255, 1},
-        {165, 119, 105, 255, 1},
-        {152, 80, 60, 255, 1},
-        {154, 86, 67, 255, 1},
-        {155, 87, 68, 255, 1},
-        {149, 83, 64, 255, 1},
-        {134, 74, 56, 255, 1},
-        {135, 75, 57, 255, 2},
-        {133, 75, 57, 255, 1},
-        {126, 69, 54, 255, 1},
-        {125, 69, 54, 255, 3},
-        {131, 73, 56, 255, 1},
-        {147, 82, 62, 255, 1},
-        {139, 81, 63, 132, 1},
-        {146, 82, 61, 255, 1},
-        {130, 72, 55, 255, 1},
-        {124, 68, 54, 255, 1},
-        {125, 69, 54, 255, 1},
-        {124, 69, 54, 255, 1},
-        {127, 70, 55, 255, 1},
-        {134, 75, 56, 255, 2},
-        {133, 73, 54, 255, 1},
-        {135, 78, 59, 255, 1},
-        {172, 148, 140, 255, 1},
-        {177, 160, 153, 255, 1},
-        {176, 157, 150, 255, 1},
-        {178, 162, 155, 255, 1},
-        {161, 109, 94, 255, 1},
-        {152, 81, 61, 255, 1},
-        {154, 86, 67, 255, 1},
-        {156, 87, 68, 255, 1},
-        {142, 79, 62, 255, 1},
-        {123, 68, 53, 255, 1},
-        {125, 69, 54, 255, 1},
-        {126, 70, 55, 255, 1},
-        {121, 67, 52, 255, 1},
-        {101, 56, 42, 255, 4},
-        {121, 67, 52, 255, 1},
-        {126, 70, 55, 255, 1},
-        {125, 69, 54, 255, 1},
-        {126, 70, 54, 255, 1},
-        {117, 65, 50, 255, 1},
-        {111, 61, 47, 255, 1},
-        {112, 62, 47, 255, 1},
-        {109, 60, 46, 255, 1},
-        {126, 70, 54, 255, 1},
-        {157, 88, 68, 255, 1},
-        {154, 86, 67, 255, 2},
-        {153, 85, 67, 255, 1},
-        {144, 81, 62, 255, 1},
-        {144, 80, 62, 255, 1},
-        {144, 80, 61, 255, 1},
-        {143, 78, 59, 255, 1},
-        {169, 141, 131, 255, 1},
-        {178, 161, 155, 255, 1},
-        {176, 157, 150, 255, 1},
-        {178, 163, 157, 255, 1},
-        {165, 119, 105, 255, 1},
-        {152, 80, 60, 255, 1},
-        {154, 86, 67, 255, 1},
-        {156, 87, 68, 255, 1},
-        {147, 82, 64, 255, 1},
-        {126, 69, 54, 255, 1},
-        {127, 70, 55, 255, 3},
-        {132, 74, 57, 255, 1},
-        {132, 74, 56, 255, 3},
-        {128, 72, 55, 255, 1},
-        {137, 76, 59, 255, 1},
-        {141, 81, 63, 132, 1},
-        {150, 83, 62, 255, 1},
-        {131, 73, 56, 255, 1},
-        {124, 68, 54, 255, 1},
-        {125, 69, 54, 255, 1},
-        {124, 69, 54, 255, 1},
-        {128, 71, 55, 255, 1},
-        {138, 76, 57, 255, 2},
-        {137, 74, 55, 255, 1},
-        {139, 79, 60, 255, 1},
-        {172, 148, 140, 255, 1},
-        {177, 160, 153, 255, 1},
-        {176, 157, 150, 255, 1},
-        {178, 162, 155, 255, 1},
-        {161, 109, 94, 255, 1},
-        {152, 81, 61, 255, 1},
-        {154, 86, 67, 255, 1},
-        {156, 87, 68, 255, 1},
-        {142, 79, 62, 255, 1},
-        {123, 68, 53, 255, 1},
-        {125, 69, 54, 255, 1},
-        {126, 70, 55, 255, 1},
-        {120, 66, 51, 255, 1},
-        {93, 52, 38, 255, 4},
-        {120, 67, 51, 255, 1},
-        {126, 70, 55, 255, 1},
-        {125, 69, 54, 255, 1},
-        {126, 70, 54, 255, 1},
-        {114, 64, 49, 255, 1},
-        {106, 58, 45, 255, 1},
-        {107, 60, 46, 255, 1},
-        {104, 57, 44, 255, 1},
-        {123, 69, 53, 255, 1},
-        {157, 88, 68, 255, 1},
-        {154, 86, 67, 255, 3},
-        {156, 87, 68, 255, 1},
-        {157, 87, 68, 255, 1},
-        {156, 87, 67, 255, 1},
-        {156, 85, 65, 255, 1},
-        {172, 142, 132, 255, 1},
-        {177, 161, 155, 255, 1},
-        {176, 157, 150, 255, 1},
-        {178, 163, 157, 255, 1},
-        {165, 119, 105, 255, 1},
-        {152, 80, 60, 255, 1},
-        {154, 86, 67, 255, 1},
-        {156, 87, 68, 255, 1},
-        {146, 82, 64, 255, 1},
-        {123, 68, 54, 255, 1},
-        {124, 69, 54, 255, 2},
-        {126, 69, 54, 255, 1},
-        {134, 75, 57, 255, 4},
-        {127, 71, 54, 255, 1},
-        {134, 74, 58, 255, 1},
-        {141, 81, 63, 132, 1},
-        {149, 83, 62, 255, 1},
-        {131, 73, 56, 255, 1},
-        {124, 68, 54, 255, 1},
-        {125, 69, 54, 255, 1},
-        {124, 69, 54, 255, 1},
-        {128, 71, 55, 255, 1},
-        {137, 76, 57, 255, 2},
-        {136, 74, 55, 255, 1},
-        {138, 79, 60, 255, 1},
-        {172, 148, 140, 255, 1},
-        {177, 160, 153, 255, 1},
-        {176, 157, 150, 255, 1},
-        {178, 162, 155, 255, 1},
-        {161, 109, 94, 255, 1},
-        {152, 81, 61, 255, 1},
-        {154, 86, 67, 255, 1},
-        {156, 87, 68, 255, 1},
-        {142, 79, 62, 255, 1},
-        {123, 68, 53, 255, 1},
-        {125, 69, 54, 255, 1},
-        {126, 70, 55, 255, 1},
-        {120, 66, 51, 255, 1},
-        {95, 53, 39, 255, 4},
-        {120, 67, 51, 255, 1},
-        {126, 70, 55, 255, 1},
-        {125, 69, 54, 255, 1},
-        {126, 70, 54, 255, 1},
-        {115, 64, 49, 255, 1},
-        {107, 59, 45, 255, 1},
-        {108, 60, 46, 255, 1},
-        {105, 58, 44, 255, 1},
-        {124, 69, 53, 255, 1},
-        {157, 88, 68, 255, 1},
-        {154, 86, 67, 255, 5},
-        {154, 86, 66, 255, 1},
-        {153, 84, 64, 255, 1},
-        {171, 142, 132, 255, 1},
-        {177, 161, 155, 255, 1},
-        {176, 157, 150, 255, 1},
-        {178, 163, 157, 255, 1},
-        {165, 119, 105, 255, 1},
-        {152, 80, 60, 255, 1},
-        {154, 86, 67, 255, 1},
-        {156, 87, 68, 255, 1},
-        {146, 82, 64, 255, 1},
-        {124, 68, 54, 255, 1},
-        {125, 69, 54, 255, 2},
-        {126, 69, 54, 255, 1},
-        {134, 75, 57, 255, 4},
-        {127, 71, 54, 255, 1},
-        {135, 74, 58, 255, 1},
-        {139, 75, 57, 132, 1},
-        {147, 77, 55, 255, 1},
-        {129, 67, 50, 255, 1},
-        {121, 62, 48, 255, 1},
-        {122, 63, 48, 255, 1},
-        {121, 63, 48, 255, 1},
-        {125, 65, 49, 255, 1},
-        {135, 71, 51, 255, 1},
-        {135, 70, 51, 255, 1},
-        {134, 68, 49, 255, 1},
-        {136, 74, 54, 255, 1},
-        {173, 149, 140, 255, 1},
-        {178, 161, 155, 255, 1},
-        {177, 158, 151, 255, 1},
-        {179, 164, 157, 255, 1},
-        {161, 106, 91, 255, 1},
-        {151, 76, 55, 255, 1},
-        {153, 81, 62, 255, 1},
-        {156, 82, 63, 255, 1},
-        {140, 74, 56, 255, 1},
-        {120, 62, 46, 255, 1},
-        {122, 63, 48, 255, 1},
-        {123, 64, 49, 255, 1},
-        {117, 60, 44, 255, 1},
-        {89, 46, 31, 255, 1},
-        {90, 46, 31, 255, 3},
-        {117, 61, 44, 255, 1},
-        {123, 64, 49, 255, 1},
-        {122, 63, 48, 255, 1},
-        {123, 64, 48, 255, 1},
-        {111, 57, 42, 255, 1},
-        {102, 52, 38, 255, 1},
-        {104, 53, 39, 255, 1},
-        {100, 51, 37, 255, 1},
-        {121, 63, 47, 255, 1},
-        {157, 83, 63, 255, 1},
-        {153, 81, 62, 255, 5},
-        {153, 81, 61, 255, 1},
-        {152, 79, 59, 255, 1},
-        {172, 142, 132, 255, 1},
-        {178, 162, 156, 255, 1},
-        {177, 158, 151, 255, 1},
-        {179, 165, 159, 255, 1},
-        {165, 117, 103, 255, 1},
-        {151, 75, 54, 255, 1},
-        {153, 81, 62, 255, 1},
-        {155, 82, 63, 255, 1},
-        {145, 77, 58, 255, 1},
-        {121, 62, 47, 255, 1},
-        {122, 63, 48, 255, 2},
-        {123, 63, 48, 255, 1},
-        {132, 69, 51, 255, 1},
-        {132, 70, 51, 255, 3},
-        {124, 65, 48, 255, 1},
-        {132, 67, 51, 255, 1},
-        {152, 117, 104, 132, 1},
-        {162, 123, 107, 255, 1},
-        {147, 112, 98, 255, 1},
-        {143, 110, 98, 255, 1},
-        {144, 110, 98, 255, 2},
-        {145, 110, 98, 255, 1},
-        {150, 113, 99, 255, 1},
-        {149, 113, 99, 255, 1},
-        {149, 112, 98, 255, 1},
-        {150, 114, 100, 255, 1},
-        {165, 145, 136, 255, 1},
-        {168, 151, 142, 255, 1},
-        {167, 149, 141, 255, 1},
-        {168, 151, 143, 255, 1},
-        {161, 128, 115, 255, 1},
-        {157, 115, 101, 255, 1},
-        {157, 117, 103, 255, 1},
-        {158, 118, 104, 255, 1},
-        {152, 114, 101, 255, 1},
-        {143, 109, 97, 255, 1},
-        {144, 110, 98, 255, 2},
-        {142, 108, 96, 255, 1},
-        {130, 100, 88, 255, 1},
-        {131, 100, 88, 255, 1},
-        {130, 100, 88, 255, 1},
-        {131, 100, 88, 255, 1},
-        {142, 108, 96, 255, 1},
-        {144, 110, 98, 255, 3},
-        {139, 107, 95, 255, 1},
-        {136, 106, 94, 255, 2},
-        {135, 105, 94, 255, 1},
-        {144, 110, 97, 255, 1},
-        {159, 118, 104, 255, 1},
-        {157, 117, 103, 255, 6},
-        {157, 116, 102, 255, 1},
-        {165, 142, 133, 255, 1},
-        {168, 151, 143, 255, 1},
-        {167, 149, 141, 255, 1},
-        {168, 152, 144, 255, 1},
-        {162, 132, 120, 255, 1},
-        {156, 114, 100, 255, 1},
-        {157, 117, 103, 255, 1},
-        {158, 118, 104, 255, 1},
-        {154, 115, 102, 255, 1},
-        {143, 109, 97, 255, 1},
-        {144, 110, 98, 255, 3},
-        {148, 112, 99, 255, 1},
-        {149, 113, 99, 255, 1},
-        {148, 113, 99, 255, 1},
-        {149, 113, 99, 255, 1},
-        {145, 111, 98, 255, 1},
-        {155, 119, 106, 255, 1},
-        {166, 152, 142, 132, 1},
-        {175, 161, 151, 255, 1},
-        {162, 149, 139, 255, 1},
-        {163, 149, 139, 255, 4},
-        {162, 149, 139, 255, 3},
-        {162, 148, 139, 255, 1},
-        {159, 143, 132, 255, 1},
-        {159, 142, 131, 255, 1},
-        {159, 142, 132, 255, 1},
-        {159, 141, 131, 255, 1},
-        {160, 146, 136, 255, 1},
-        {161, 148, 139, 255, 1},
-        {161, 148, 138, 255, 1},
-        {160, 148, 138, 255, 1},
-        {162, 148, 139, 255, 1},
-        {163, 149, 140, 255, 1},
-        {163, 149, 139, 255, 2},
-        {163, 149, 140, 255, 1},
-        {165, 150, 141, 255, 4},
-        {163, 149, 140, 255, 1},
-        {163, 149, 139, 255, 3},
-        {164, 149, 140, 255, 1},
-        {164, 150, 140, 255, 2},
-        {165, 150, 140, 255, 1},
-        {163, 149, 140, 255, 1},
-        {160, 148, 138, 255, 1},
-        {161, 148, 138, 255, 6},
-        {161, 148, 139, 255, 1},
-        {159, 143, 133, 255, 1},
-        {159, 142, 131, 255, 1},
-        {159, 142, 132, 255, 1},
-        {159, 141, 131, 255, 1},
-        {160, 145, 135, 255, 1},
-        {161, 148, 139, 255, 1},
-        {161, 148, 138, 255, 1},
-        {160, 148, 138, 255, 1},
-        {161, 148, 139, 255, 1},
-        {163, 149, 140, 255, 1},
-        {163, 149, 139, 255, 3},
-        {162, 149, 139, 255, 4},
-        {163, 149, 139, 255, 1},
-        {176, 162, 151, 255, 1},
-        {164, 146, 137, 132, 1},
-        {173, 155, 144, 255, 1},
-        {160, 143, 133, 255, 61},
-        {173, 155, 144, 255, 1},
-        {164, 150, 141, 132, 1},
-        {173, 159, 149, 255, 1},
-        {160, 147, 137, 255, 5},
-        {159, 146, 137, 255, 4},
-        {160, 147, 137, 255, 17},
-        {159, 143, 133, 255, 1},
-        {159, 142, 132, 255, 2},
-        {159, 142, 131, 255, 1},
-        {160, 145, 135, 255, 1},
-        {161, 147, 138, 255, 1},
-        {161, 147, 137, 255, 2},
-        {160, 147, 137, 255, 1},
-        {159, 146, 137, 255, 4},
-        {160, 147, 137, 255, 20},
-        {160, 147, 138, 255, 1},
-        {160, 144, 134, 255, 1},
-        {173, 155, 144, 255, 1},
-        {162, 131, 117, 132, 1},
-        {172, 137, 123, 255, 1},
-        {159, 126, 114, 255, 4},
-        {160, 127, 114, 255, 1},
-        {163, 129, 116, 255, 4},
-        {159, 127, 114, 255, 1},
-        {159, 126, 114, 255, 16},
-        {164, 144, 134, 255, 1},
-        {165, 148, 139, 255, 1},
-        {165, 147, 138, 255, 1},
-        {165, 149, 140, 255, 1},
-        {160, 134, 123, 255, 1},
-        {157, 124, 112, 255, 1},
-        {157, 126, 114, 255, 1},
-        {157, 125, 113, 255, 1},
-        {160, 127, 115, 255, 1},
-        {165, 131, 117, 255, 1},
-        {165, 130, 116, 255, 1},
-        {165, 131, 116, 255, 1},
-        {164, 130, 116, 255, 1},
-        {159, 126, 114, 255, 20},
-        {159, 126, 113, 255, 1},
-        {160, 139, 128, 255, 1},
-        {173, 156, 145, 255, 1},
-        {158, 86, 69, 132, 1},
-        {167, 89, 69, 255, 1},
-        {154, 82, 63, 255, 3},
-        {153, 82, 63, 255, 1},
-        {158, 84, 64, 255, 1},
-        {171, 90, 70, 255, 1},
-        {170, 90, 70, 255, 2},
-        {169, 90, 70, 255, 1},
-        {156, 84, 64, 255, 1},
-        {153, 82, 63, 255, 1},
-        {154, 82, 63, 255, 13},
-        {154, 81, 62, 255, 1},
-        {154, 82, 63, 255, 1},
-        {173, 146, 137, 255, 1},
-        {178, 161, 155, 255, 1},
-        {177, 158, 151, 255, 1},
-        {179, 164, 158, 255, 1},
-        {159, 110, 96, 255, 1},
-        {145, 73, 54, 255, 1},
-        {147, 79, 61, 255, 1},
-        {145, 78, 60, 255, 1},
-        {158, 85, 65, 255, 1},
-        {180, 98, 74, 255, 1},
-        {178, 97, 73, 255, 1},
-        {179, 97, 73, 255, 1},
-        {176, 95, 72, 255, 1},
-        {155, 83, 63, 255, 1},
-        {154, 82, 63, 255, 19},
-        {154, 79, 59, 255, 1},
-        {159, 127, 114, 255, 1},
-        {174, 159, 148, 255, 1},
-        {158, 90, 73, 132, 1},
-        {167, 93, 73, 255, 1},
-        {154, 86, 67, 255, 3},
-        {153, 86, 67, 255, 1},
-        {158, 87, 68, 255, 1},
-        {171, 93, 73, 255, 1},
-        {170, 93, 73, 255, 2},
-        {169, 93, 73, 255, 1},
-        {156, 87, 68, 255, 1},
-        {153, 86, 67, 255, 1},
-        {154, 86, 67, 255, 13},
-        {154, 85, 66, 255, 1},
-        {154, 86, 67, 255, 1},
-        {173, 146, 137, 255, 1},
-        {177, 160, 154, 255, 1},
-        {176, 157, 150, 255, 1},
-        {178, 163, 156, 255, 1},
-        {159, 112, 98, 255, 1},
-        {146, 77, 58, 255, 1},
-        {148, 83, 65, 255, 1},
-        {146, 82, 64, 255, 1},
-        {158, 88, 69, 255, 1},
-        {179, 100, 77, 255, 1},
-        {177, 99, 76, 255, 1},
-        {178, 99, 76, 255, 1},
-        {175, 97, 75, 255, 1},
-        {155, 86, 67, 255, 1},
-        {154, 86, 67, 255, 19},
-        {154, 83, 63, 255, 1},
-        {159, 128, 115, 255, 1},
-        {174, 158, 148, 255, 1},
-        {158, 90, 73, 132, 1},
-        {167, 93, 73, 255, 1},
-        {154, 86, 67, 255, 1},
-        {155, 86, 67, 255, 2},
-        {154, 86, 67, 255, 1},
-        {159, 87, 68, 255, 1},
-        {172, 94, 73, 255, 1},
-        {171, 94, 73, 255, 2},
-        {170, 94, 73, 255, 1},
-        {157, 87, 68, 255, 1},
-        {154, 86, 67, 255, 1},
-        {155, 86, 67, 255, 10},
-        {155, 87, 67, 255, 1},
-        {155, 87, 68, 255, 2},
-        {155, 86, 67, 255, 1},
-        {155, 87, 68, 255, 1},
-        {173, 146, 137, 255, 1},
-        {177, 160, 154, 255, 1},
-        {176, 157, 150, 255, 1},
-        {178, 163, 156, 255, 1},
-        {159, 112, 98, 255, 1},
-        {146, 77, 58, 255, 1},
-        {148, 83, 65, 255, 1},
-        {146, 82, 64, 255, 1},
-        {158, 88, 69, 255, 1},
-        {181, 101, 78, 255, 1},
-        {178, 100, 77, 255, 1},
-        {180, 100, 77, 255, 1},
-        {176, 98, 76, 255, 1},
-        {156, 86, 67, 255, 1},
-        {155, 87, 67, 255, 4},
-        {155, 86, 67, 255, 5},
-        {155, 87, 67, 255, 3},
-        {155, 86, 67, 255, 1},
-        {155, 87, 67, 255, 1},
-        {155, 86, 67, 255, 2},
-        {155, 87, 67, 255, 1},
-        {155, 86, 67, 255, 1},
-        {155, 87, 67, 255, 1},
-        {155, 84, 63, 255, 1},
-        {159, 128, 115, 255, 1},
-        {174, 158, 148, 255, 1},
-        {158, 90, 73, 132, 1},
-        {167, 93, 73, 255, 1},
-        {153, 85, 67, 255, 1},
-        {152, 85, 66, 255, 2},
-        {151, 85, 66, 255, 1},
-        {156, 86, 67, 255, 1},
-        {168, 91, 72, 255, 1},
-        {167, 92, 72, 255, 2},
-        {166, 91, 72, 255, 1},
-        {154, 86, 67, 255, 1},
-        {151, 85, 66, 255, 1},
-        {152, 85, 66, 255, 11},
-        {151, 84, 65, 255, 2},
-        {151, 83, 64, 255, 1},
-        {151, 84, 65, 255, 1},
-        {172, 146, 137, 255, 1},
-        {177, 160, 154, 255, 1},
-        {176, 157, 150, 255, 1},
-        {178, 163, 156, 255, 1},
-        {159, 112, 98, 255, 1},
-        {146, 77, 58, 255, 1},
-        {148, 83, 65, 255, 1},
-        {147, 82, 64, 255, 1},
-        {157, 88, 68, 255, 1},
-        {175, 98, 76, 255, 1},
-        {173, 97, 75, 255, 1},
-        {174, 97, 75, 255, 1},
-        {171, 95, 74, 255, 1},
-        {153, 85, 66, 255, 1},
-        {152, 84, 66, 255, 4},
-        {152, 85, 66, 255, 5},
-        {152, 84, 66, 255, 3},
-        {152, 85, 66, 255, 1},
-        {152, 84, 66, 255, 1},
-        {152, 85, 66, 255, 2},
-        {152, 84, 66, 255, 1},
-        {152, 85, 66, 255, 1},
-        {152, 84, 66, 255, 1},
-        {152, 82, 62, 255, 1},
-        {158, 128, 115, 255, 1},
-        {174, 159, 148, 255, 1},
-        {158, 90, 73, 132, 1},
-        {169, 94, 74, 255, 1},
-        {141, 79, 61, 255, 1},
-        {125, 69, 54, 255, 1},
-        {127, 70, 55, 255, 3},
-        {128, 71, 55, 255, 4},
-        {127, 70, 55, 255, 11},
-        {128, 70, 55, 255, 1},
-        {124, 68, 53, 255, 1},
-        {110, 61, 46, 255, 2},
-        {109, 60, 45, 255, 1},
-        {110, 61, 46, 255, 1},
-        {165, 142, 133, 255, 1},
-        {179, 161, 155, 255, 1},
-        {176, 157, 150, 255, 1},
-        {178, 163, 156, 255, 1},
-        {163, 114, 100, 255, 1},
-        {152, 80, 60, 255, 1},
-        {154, 86, 67, 255, 1},
-        {155, 87, 68, 255, 1},
-        {144, 81, 63, 255, 1},
-        {123, 69, 55, 255, 1},
-        {125, 70, 55, 255, 1},
-        {125, 70, 56, 255, 1},
-        {125, 70, 55, 255, 1},
-        {123, 69, 55, 255, 1},
-        {123, 69, 54, 255, 1},
-        {124, 69, 54, 255, 3},
-        {123, 69, 54, 255, 5},
-        {124, 69, 54, 255, 3},
-        {123, 69, 54, 255, 1},
-        {124, 69, 54, 255, 1},
-        {123, 69, 54, 255, 2},
-        {124, 69, 54, 255, 1},
-        {123, 69, 54, 255, 2},
-        {122, 65, 51, 255, 1},
-        {150, 123, 112, 255, 1},
-        {176, 160, 149, 255, 1},
-        {158, 90, 73, 132, 1},
-        {169, 94, 74, 255, 1},
-        {140, 78, 61, 255, 1},
-        {122, 68, 53, 255, 1},
-        {124, 69, 54, 255, 3},
-        {124, 68, 53, 255, 4},
-        {124, 69, 54, 255, 11},
-        {125, 69, 54, 255, 1},
-        {121, 67, 52, 255, 1},
-        {106, 58, 44, 255, 2},
-        {105, 57, 43, 255, 1},
-        {106, 58, 44, 255, 1},
-        {165, 142, 133, 255, 1},
-        {179, 161, 155, 255, 1},
-        {176, 157, 150, 255, 1},
-        {178, 163, 156, 255, 1},
-        {163, 114, 100, 255, 1},
-        {152, 80, 60, 255, 1},
-        {154, 86, 67, 255, 1},
-        {156, 87, 68, 255, 1},
-        {143, 80, 63, 255, 1},
-        {117, 66, 52, 255, 1},
-        {120, 67, 53, 255, 1},
-        {119, 67, 53, 255, 1},
-        {120, 67, 53, 255, 1},
-        {120, 68, 54, 255, 20},
-        {118, 64, 50, 255, 1},
-        {149, 123, 112, 255, 1},
-        {176, 160, 149, 255, 1},
-        {158, 90, 73, 132, 1},
-        {169, 94, 74, 255, 1},
-        {140, 78, 61, 255, 1},
-        {123, 68, 53, 255, 1},
-        {125, 69, 54, 255, 18},
-        {126, 69, 54, 255, 1},
-        {122, 67, 52, 255, 1},
-        {107, 59, 45, 255, 2},
-        {106, 58, 44, 255, 1},
-        {107, 59, 45, 255, 1},
-        {165, 142, 133, 255, 1},
-        {179, 161, 155, 255, 1},
-        {176, 157, 150, 255, 1},
-        {178, 163, 156, 255, 1},
-        {163, 114, 100, 255, 1},
-        {152, 80, 60, 255, 1},
-        {154, 86, 67, 255, 1},
-        {156, 87, 68, 255, 1},
-        {143, 80, 63, 255, 1},
-        {119, 67, 53, 255, 1},
-        {121, 68, 54, 255, 23},
-        {119, 64, 50, 255, 1},
-        {149, 123, 112, 255, 1},
-        {176, 160, 149, 255, 1},
-        {158, 90, 73, 132, 1},
-        {169, 94, 74, 255, 1},
-        {141, 78, 61, 255, 1},
-        {124, 68, 53, 255, 1},
-        {126, 69, 54, 255, 1},
-        {126, 70, 54, 255, 1},
-        {126, 69, 54, 255, 1},
-        {125, 69, 54, 255, 15},
-        {126, 69, 54, 255, 1},
-        {122, 67, 52, 255, 1},
-        {106, 59, 45, 255, 2},
-        {105, 58, 44, 255, 1},
-        {106, 59, 45, 255, 1},
-        {165, 142, 133, 255, 1},
-        {179, 161, 155, 255, 1},
-        {176, 157, 150, 255, 1},
-        {178, 163, 156, 255, 1},
-        {163, 114, 100, 255, 1},
-        {152, 80, 60, 255, 1},
-        {154, 86, 67, 255, 1},
-        {156, 87, 68, 255, 1},
-        {143, 80, 63, 255, 1},
-        {119, 67, 53, 255, 1},
-        {121, 68, 54, 255, 23},
-        {119, 64, 50, 255, 1},
-        {149, 123, 112, 255, 1},
-        {176, 160, 149, 255, 1},
-        {158, 90, 73, 132, 1},
-        {170, 95, 75, 255, 1},
-        {134, 74, 58, 255, 1},
-        {109, 60, 46, 255, 1},
-        {112, 62, 47, 255, 1},
-        {111, 61, 47, 255, 1},
-        {115, 63, 49, 255, 1},
-        {125, 69, 54, 255, 16},
-        {124, 68, 54, 255, 1},
-        {120, 66, 52, 255, 1},
-        {120, 67, 52, 255, 1},
-        {119, 66, 51, 255, 1},
-        {120, 66, 52, 255, 1},
-        {167, 143, 134, 255, 1},
-        {178, 161, 154, 255, 1},
-        {176, 157, 150, 255, 1},
-        {178, 163, 156, 255, 1},
-        {163, 114, 100, 255, 1},
-        {152, 80, 60, 255, 1},
-        {154, 86, 67, 255, 1},
-        {156, 87, 68, 255, 1},
-        {143, 80, 63, 255, 1},
-        {119, 67, 53, 255, 1},
-        {121, 68, 54, 255, 23},
-        {119, 64, 50, 255, 1},
-        {149, 123, 112, 255, 1},
-        {176, 160, 149, 255, 1},
-        {158, 90, 73, 132, 1},
-        {171, 95, 75, 255, 1},
-        {131, 73, 57, 255, 1},
-        {102, 56, 42, 255, 1},
-        {106, 58, 44, 255, 1},
-        {105, 57, 43, 255, 1},
-        {110, 60, 47, 255, 1},
-        {125, 69, 54, 255, 17},
-        {126, 70, 55, 255, 2},
-        {125, 69, 54, 255, 1},
-        {126, 70, 55, 255, 1},
-        {168, 143, 134, 255, 1},
-        {178, 161, 154, 255, 1},
-        {176, 157, 150, 255, 1},
-        {178, 163, 156, 255, 1},
-        {163, 114, 100, 255, 1},
-        {152, 80, 60, 255, 1},
-        {154, 86, 67, 255, 1},
-        {156, 87, 68, 255, 1},
-        {143, 80, 63, 255, 1},
-        {119, 67, 53, 255, 1},
-        {121, 68, 54, 255, 23},
-        {119, 64, 50, 255, 1},
-        {149, 123, 112, 255, 1},
-        {176, 160, 149, 255, 1},
-        {158, 90, 73, 132, 1},
-        {171, 95, 75, 255, 1},
-        {132, 73, 57, 255, 1},
-        {103, 57, 43, 255, 1},
-        {107, 59, 45, 255, 1},
-        {106, 58, 44, 255, 1},
-        {111, 61, 47, 255, 1},
-        {125, 69, 54, 255, 19},
-        {124, 68, 53, 255, 1},
-        {125, 69, 54, 255, 1},
-        {168, 143, 134, 255, 1},
-        {178, 161, 154, 255, 1},
-        {176, 157, 150, 255, 1},
-        {178, 163, 156, 255, 1},
-        {163, 114, 100, 255, 1},
-        {152, 80, 60, 255, 1},
-        {154, 86, 67, 255, 1},
-        {156, 87, 68, 255, 1},
-        {143, 80, 63, 255, 1},
-        {119, 67, 53, 255, 1},
-        {121, 68, 54, 255, 23},
-        {119, 64, 50, 255, 1},
-        {149, 123, 112, 255, 1},
-        {176, 160, 149, 255, 1},
-        {158, 86, 67, 132, 1},
-        {171, 90, 69, 255, 1},
-        {129, 67, 51, 255, 1},
-        {98, 50, 36, 255, 1},
-        {102, 52, 38, 255, 1},
-        {101, 51, 37, 255, 1},
-        {107, 54, 40, 255, 1},
-        {122, 63, 47, 255, 19},
-        {121, 62, 46, 255, 1},
-        {122, 63, 47, 255, 1},
-        {169, 143, 134, 255, 1},
-        {179, 162, 156, 255, 1},
-        {177, 158, 151, 255, 1},
-        {179, 165, 158, 255, 1},
-        {163, 112, 97, 255, 1},
-        {151, 75, 54, 255, 1},
-        {153, 81, 62, 255, 1},
-        {156, 82, 63, 255, 1},
-        {141, 75, 57, 255, 1},
-        {116, 61, 46, 255, 1},
-        {118, 62, 47, 255, 23},
-        {116, 57, 43, 255, 1},
-        {148, 121, 110, 255, 1},
-        {176, 160, 149, 255, 1},
-        {160, 117, 102, 132, 1},
-        {172, 124, 108, 255, 1},
-        {145, 107, 94, 255, 1},
-        {130, 98, 87, 255, 1},
-        {132, 100, 88, 255, 1},
-        {132, 99, 87, 255, 1},
-        {134, 101, 88, 255, 1},
-        {141, 105, 92, 255, 19},
-        {141, 104, 92, 255, 1},
-        {141, 105, 92, 255, 1},
-        {164, 143, 134, 255, 1},
-        {169, 152, 144, 255, 1},
-        {168, 150, 142, 255, 1},
-        {169, 153, 145, 255, 1},
-        {161, 128, 115, 255, 1},
-        {156, 110, 96, 255, 1},
-        {157, 113, 99, 255, 1},
-        {158, 114, 99, 255, 1},
-        {151, 110, 96, 255, 1},
-        {138, 103, 92, 255, 1},
-        {139, 104, 92, 255, 23},
-        {138, 102, 90, 255, 1},
-        {155, 133, 122, 255, 1},
-        {175, 158, 147, 255, 1},
-        {164, 151, 142, 143, 1},
-        {188, 173, 162, 255, 1},
-        {176, 161, 150, 255, 1},
-        {178, 162, 151, 255, 3},
-        {177, 162, 151, 255, 1},
-        {176, 161, 151, 255, 21},
-        {173, 155, 144, 255, 1},
-        {172, 153, 142, 255, 1},
-        {172, 154, 143, 255, 1},
-        {172, 153, 142, 255, 1},
-        {173, 157, 147, 255, 1},
-        {174, 160, 150, 255, 2},
-        {174, 160, 149, 255, 1},
-        {175, 160, 150, 255, 1},
-        {177, 161, 151, 255, 25},
-        {174, 157, 146, 255, 1},
-        {187, 167, 156, 255, 1},
-    };
-
-    static BYTE textureData[64 * 64 * 4];
-    BYTE* ptr = textureData;
-    for (const auto& seg : segments) {
-        for (int i = 0; i < seg.count; ++i) {
-            *ptr++ = seg.r;
-            *ptr++ = seg.g;
-            *ptr++ = seg.b;
-            *ptr++ = seg.a;
-        }
-    }
-
-    bool result = CreateTextureFromData(textureData, size, size, &cachedSRV);
-    *outSRV = cachedSRV;
-    return result;
-}
\ No newline at end of file
@@ -0,0 +1,189 @@
+#include "ChunkMesher.h"
+#include <cstring>
+
+namespace {
+
+    // chunk plus a 2 cell border on every side, enough for all neighbour tests
+    const int PAD = 2;
+    const int PADDED = VOXEL_CHUNK_SIZE + PAD * 2;
+
+    struct PaddedChunk {
+        BlockId blocks[PADDED * PADDED * PADDED];
+
+        BlockId Get(int lx, int ly, int lz) const {
+            return blocks[((ly + PAD) * PADDED + (lz + PAD)) * PADDED + (lx + PAD)];
+        }
+    };
+
+    struct Quad {
+        int dir;               // 0 -X, 1 +X, 2 -Y, 3 +Y, 4 -Z, 5 +Z
+        BlockTexture texture;
+        float min[3];
+        float max[3];
+    };
+
+    bool IsOpaque(BlockId id)
+    {
+        return id != BLOCK_AIR && BlockRegistry::Get(id).opaque;
+    }
+
+    void EmitQuad(const Quad& q, ChunkMesh& out)
+    {
+        float x0 = q.min[0], y0 = q.min[1], z0 = q.min[2];
+        float x1 = q.max[0], y1 = q.max[1], z1 = q.max[2];
+        // uv repeats once per block (2 units) so merged quads tile the texture
+        float w = (x1 - x0) * 0.5f, h = (y1 - y0) * 0.5f, d = (z1 - z0) * 0.5f;
+
+        // corner order and uvs follow CreateCubeMesh so winding and texture
+        // orientation match the old per-block cube
+        MeshVertex v[4];
+        float n[3] = { 0.0f, 0.0f, 0.0f };
+        switch (q.dir) {
+        case 0: // left
+            n[0] = -1.0f;
+            v[0] = { { x0, y0, z1 }, {}, { 0, h }, 0 }; v[1] = { { x0, y1, z1 }, {}, { 0, 0 }, 0 };
+            v[2] = { { x0, y1, z0 }, {}, { d, 0 }, 0 }; v[3] = { { x0, y0, z0 }, {}, { d, h }, 0 };
+            break;
+        case 1: // right
+            n[0] = 1.0f;
+            v[0] = { { x1, y0, z0 }, {}, { 0, h }, 0 }; v[1] = { { x1, y1, z0 }, {}, { 0, 0 }, 0 };
+            v[2] = { { x1, y1, z1 }, {}, { d, 0 }, 0 }; v[3] = { { x1, y0, z1 }, {}, { d, h }, 0 };
+            break;
+        case 2: // bottom
+            n[1] = -1.0f;
+            v[0] = { { x0, y0, z0 }, {}, { 0, 0 }, 0 }; v[1] = { { x1, y0, z0 }, {}, { w, 0 }, 0 };
+            v[2] = { { x1, y0, z1 }, {}, { w, d }, 0 }; v[3] = { { x0, y0, z1 }, {}, { 0, d }, 0 };
+            break;
+        case 3: // top
+            n[1] = 1.0f;
+            v[0] = { { x0, y1, z0 }, {}, { 0, d }, 0 }; v[1] = { { x0, y1, z1 }, {}, { 0, 0 }, 0 };
+            v[2] = { { x1, y1, z1 }, {}, { w, 0 }, 0 }; v[3] = { { x1, y1, z0 }, {}, { w, d }, 0 };
+            break;
+        case 4: // front
+            n[2] = -1.0f;
+            v[0] = { { x0, y0, z0 }, {}, { 0, h }, 0 }; v[1] = { { x0, y1, z0 }, {}, { 0, 0 }, 0 };
+            v[2] = { { x1, y1, z0 }, {}, { w, 0 }, 0 }; v[3] = { { x1, y0, z0 }, {}, { w, h }, 0 };
+            break;
+        default: // back
+            n[2] = 1.0f;
+            v[0] = { { x0, y0, z1 }, {}, { w, h }, 0 }; v[1] = { { x1, y0, z1 }, {}, { 0, h }, 0 };
+            v[2] = { { x1, y1, z1 }, {}, { 0, 0 }, 0 }; v[3] = { { x0, y1, z1 }, {}, { w, 0 }, 0 };
+            break;
+        }
+
+        uint32_t base = (uint32_t)out.vertices.size();
+        for (int i = 0; i < 4; ++i) {
+            memcpy(v[i].normal, n, sizeof(n));
+            v[i].layer = (uint32_t)q.texture;
+            out.vertices.push_back(v[i]);
+        }
+        const uint32_t idx[6] = { 0, 1, 2, 0, 2, 3 };
+        for (int i = 0; i < 6; ++i) {
+            out.indices.push_back(base + idx[i]);
+        }
+    }
+}
+
+void ChunkMesh::Clear()
+{
+    vertices.clear();
+    indices.clear();
+    exposedFaces = 0;
+    quads = 0;
+}
+
+void BuildChunkMesh(const VoxelWorld& world, int cx, int cy, int cz, bool greedy, ChunkMesh& out)
+{
+    out.Clear();
+
+    const VoxelChunk* chunk = world.FindChunk(cx, cy, cz);
+    if (!chunk) return;
+
+    const int ox = cx * VOXEL_CHUNK_SIZE, oy = cy * VOXEL_CHUNK_SIZE, oz = cz * VOXEL_CHUNK_SIZE;
+
+    PaddedChunk padded;
+    memset(padded.blocks, 0, sizeof(padded.blocks));
+    world.ForEachBlockInBox(ox - PAD, oy - PAD, oz - PAD,
+        ox + VOXEL_CHUNK_SIZE - 1 + PAD, oy + VOXEL_CHUNK_SIZE - 1 + PAD, oz + VOXEL_CHUNK_SIZE - 1 + PAD,
+        [&](int x, int y, int z, BlockId id) {
+            int lx = x - ox + PAD, ly = y - oy + PAD, lz = z - oz + PAD;
+            padded.blocks[(ly * PADDED + lz) * PADDED + lx] = id;
+        });
+
+    uint8_t mask[VOXEL_CHUNK_SIZE][VOXEL_CHUNK_SIZE];
+
+    for (int dir = 0; dir < 6; ++dir) {
+        const int axis = dir / 2;
+        const int sign = (dir % 2) ? 1 : -1;
+        // the two in-plane axes
+        const int ua = (axis == 0) ? 1 : 0;
+        const int va = (axis == 2) ? 1 : 2;
+
+        for (int k = 0; k < VOXEL_CHUNK_SIZE; ++k) {
+            // 0 = no face, otherwise texture + 1
+            for (int u = 0; u < VOXEL_CHUNK_SIZE; ++u) {
+                for (int v = 0; v < VOXEL_CHUNK_SIZE; ++v) {
+                    int p[3];
+                    p[axis] = k; p[ua] = u; p[va] = v;
+                    mask[u][v] = 0;
+
+                    BlockId id = padded.Get(p[0], p[1], p[2]);
+                    if (id == BLOCK_AIR) continue;
+
+                    int n1[3] = { p[0], p[1], p[2] };
+                    int n2[3] = { p[0], p[1], p[2] };
+                    n1[axis] += sign;
+                    n2[axis] += sign * 2;
+                    if (IsOpaque(padded.Get(n1[0], n1[1], n1[2])) ||
+                        IsOpaque(padded.Get(n2[0], n2[1], n2[2]))) {
+                        continue;
+                    }
+
+                    mask[u][v] = (uint8_t)BlockRegistry::Get(id).texture + 1;
+                    out.exposedFaces++;
+                }
+            }
+
+            // faces only tile exactly when their centers are 2 apart, so merge
+            // with a stride of 2 along both plane axes
+            const int step = greedy ? 2 : VOXEL_CHUNK_SIZE;
+            for (int v = 0; v < VOXEL_CHUNK_SIZE; ++v) {
+                for (int u = 0; u < VOXEL_CHUNK_SIZE; ++u) {
+                    uint8_t m = mask[u][v];
+                    if (m == 0) continue;
+
+                    int u1 = u;
+                    while (u1 + step < VOXEL_CHUNK_SIZE && mask[u1 + step][v] == m) u1 += step;
+
+                    int v1 = v;
+                    while (v1 + step < VOXEL_CHUNK_SIZE) {
+                        bool rowMatches = true;
+                        for (int uu = u; uu <= u1; uu += step) {
+                            if (mask[uu][v1 + step] != m) { rowMatches = false; break; }
+                        }
+                        if (!rowMatches) break;
+                        v1 += step;
+                    }
+
+                    for (int vv = v; vv <= v1; vv += step) {
+                        for (int uu = u; uu <= u1; uu += step) {
+                            mask[uu][vv] = 0;
+                        }
+                    }
+
+                    const int origin[3] = { ox, oy, oz };
+                    Quad q;
+                    q.dir = dir;
+                    q.texture = (BlockTexture)(m - 1);
+                    q.min[axis] = q.max[axis] = (float)(origin[axis] + k + sign);
+                    q.min[ua] = (float)(origin[ua] + u - 1);
+                    q.max[ua] = (float)(origin[ua] + u1 + 1);
+                    q.min[va] = (float)(origin[va] + v - 1);
+                    q.max[va] = (float)(origin[va] + v1 + 1);
+                    EmitQuad(q, out);
+                    out.quads++;
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,31 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include "VoxelWorld.h"
+#include "BlockRegistry.h"
+
+// GameEngine::Vertex (position, normal, uv) plus the block texture array
+// slice, so a whole chunk draws with one binding and one DrawIndexed.
+struct MeshVertex {
+    float position[3];
+    float normal[3];
+    float uv[2];
+    uint32_t layer;   // BlockTexture
+};
+
+struct ChunkMesh {
+    std::vector<MeshVertex> vertices;
+    std::vector<uint32_t> indices;
+    size_t exposedFaces = 0;   // block faces that survived culling
+    size_t quads = 0;          // quads emitted after merging
+
+    void Clear();
+};
+
+// Builds world-space geometry for one VoxelChunk, skipping faces buried by an
+// opaque neighbour. Blocks span +-1 around their lattice point, so a face is
+// hidden when a neighbour sits 1 or 2 cells away along its normal. With greedy
+// set, coplanar faces of the same texture that tile exactly (2 cells apart)
+// are merged into larger quads with repeating UVs.
+void BuildChunkMesh(const VoxelWorld& world, int cx, int cy, int cz, bool greedy, ChunkMesh& out);
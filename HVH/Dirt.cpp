@@ -1,3540 +0,0 @@
-//H V H   T E X T U R E   D A T A
-//================================
-//Generated by HVH Texture Editor v1.0
-#include <vector>
-#include "GameEngine.h"
-bool GameEngine::CreateDirtTextureSRV(UINT size, ID3D11ShaderResourceView** outSRV) {
-    static ID3D11ShaderResourceView* cachedSRV = nullptr;
-    if (cachedSRV) {
-        *outSRV = cachedSRV;
-        return true;
-    }
-
-    if (size != 64) return false;
-
-    static const struct PixelSegment {
-        BYTE r, g, b, a;
-        int count;
-    } segments[] = {
-        {187, 132, 93, 79, 1},
-        {201, 143, 100, 142, 1},
-        {184, 132, 93, 142, 1},
-        {188, 134, 95, 142, 1},
-        {167, 118, 82, 142, 1},
-        {149, 105, 71, 142, 1},
-        {150, 107, 73, 142, 5},
-        {152, 109, 75, 142, 1},
-        {134, 96, 64, 142, 1},
-        {118, 84, 57, 142, 1},
-        {122, 86, 57, 142, 5},
-        {116, 82, 55, 142, 1},
-        {158, 113, 77, 142, 1},
-        {190, 138, 96, 142, 1},
-        {184, 132, 93, 142, 1},
-        {188, 134, 95, 142, 1},
-        {167, 118, 82, 142, 1},
-        {149, 105, 71, 142, 1},
-        {150, 107, 73, 142, 5},
-        {152, 109, 75, 142, 1},
-        {134, 96, 64, 142, 1},
-        {118, 84, 57, 142, 1},
-        {122, 86, 57, 142, 5},
-        {123, 87, 59, 142, 1},
-        {104, 71, 48, 142, 1},
-        {86, 59, 39, 142, 1},
-        {89, 61, 39, 142, 1},
-        {86, 59, 39, 142, 1},
-        {107, 75, 50, 142, 1},
-        {123, 87, 59, 142, 1},
-        {122, 86, 57, 142, 5},
-        {116, 82, 55, 142, 1},
-        {158, 113, 77, 142, 1},
-        {190, 138, 96, 142, 1},
-        {184, 132, 93, 142, 1},
-        {190, 138, 96, 142, 1},
-        {149, 107, 73, 142, 1},
-        {116, 82, 55, 142, 1},
-        {122, 86, 57, 142, 1},
-        {116, 82, 55, 142, 1},
-        {158, 113, 77, 142, 1},
-        {190, 138, 96, 142, 1},
-        {184, 132, 93, 142, 1},
-        {201, 143, 100, 142, 1},
-        {183, 132, 92, 154, 1},
-        {216, 156, 109, 255, 1},
-        {200, 144, 101, 255, 1},
-        {203, 146, 103, 255, 1},
-        {180, 129, 89, 255, 1},
-        {160, 115, 78, 255, 1},
-        {163, 117, 80, 255, 5},
-        {166, 119, 81, 255, 1},
-        {145, 104, 70, 255, 1},
-        {129, 91, 62, 255, 1},
-        {131, 93, 63, 255, 5},
-        {125, 89, 59, 255, 1},
-        {170, 121, 83, 255, 1},
-        {206, 148, 104, 255, 1},
-        {200, 144, 101, 255, 1},
-        {203, 146, 103, 255, 1},
-        {180, 129, 89, 255, 1},
-        {160, 115, 78, 255, 1},
-        {163, 117, 80, 255, 5},
-        {166, 119, 81, 255, 1},
-        {145, 104, 70, 255, 1},
-        {129, 91, 62, 255, 1},
-        {131, 93, 63, 255, 5},
-        {134, 95, 64, 255, 1},
-        {111, 78, 52, 255, 1},
-        {93, 64, 42, 255, 1},
-        {96, 66, 43, 255, 1},
-        {93, 64, 42, 255, 1},
-        {116, 81, 54, 255, 1},
-        {134, 95, 64, 255, 1},
-        {131, 93, 63, 255, 5},
-        {125, 89, 59, 255, 1},
-        {170, 121, 83, 255, 1},
-        {206, 148, 104, 255, 1},
-        {200, 144, 101, 255, 1},
-        {206, 148, 104, 255, 1},
-        {161, 116, 79, 255, 1},
-        {125, 89, 59, 255, 1},
-        {131, 93, 63, 255, 1},
-        {125, 89, 59, 255, 1},
-        {170, 121, 83, 255, 1},
-        {206, 148, 104, 255, 1},
-        {200, 144, 101, 255, 1},
-        {216, 156, 109, 255, 1},
-        {184, 132, 93, 142, 1},
-        {200, 144, 101, 255, 1},
-        {185, 133, 93, 255, 1},
-        {188, 135, 95, 255, 1},
-        {166, 119, 82, 255, 1},
-        {148, 106, 72, 255, 1},
-        {151, 108, 74, 255, 5},
-        {153, 110, 75, 255, 1},
-        {134, 96, 65, 255, 1},
-        {119, 84, 57, 255, 1},
-        {121, 86, 58, 255, 5},
-        {116, 82, 55, 255, 1},
-        {157, 112, 77, 255, 1},
-        {190, 137, 96, 255, 1},
-        {185, 133, 93, 255, 1},
-        {188, 135, 95, 255, 1},
-        {166, 119, 82, 255, 1},
-        {148, 106, 72, 255, 1},
-        {151, 108, 74, 255, 5},
-        {153, 110, 75, 255, 1},
-        {134, 96, 65, 255, 1},
-        {119, 84, 57, 255, 1},
-        {121, 86, 58, 255, 5},
-        {124, 88, 59, 255, 1},
-        {103, 72, 48, 255, 1},
-        {86, 59, 39, 255, 1},
-        {89, 61, 40, 255, 1},
-        {86, 59, 39, 255, 1},
-        {107, 75, 50, 255, 1},
-        {124, 88, 59, 255, 1},
-        {121, 86, 58, 255, 5},
-        {116, 82, 55, 255, 1},
-        {157, 112, 77, 255, 1},
-        {190, 137, 96, 255, 1},
-        {185, 133, 93, 255, 1},
-        {190, 137, 96, 255, 1},
-        {149, 107, 73, 255, 1},
-        {116, 82, 55, 255, 1},
-        {121, 86, 58, 255, 1},
-        {116, 82, 55, 255, 1},
-        {157, 112, 77, 255, 1},
-        {190, 137, 96, 255, 1},
-        {185, 133, 93, 255, 1},
-        {200, 144, 101, 255, 1},
-        {190, 136, 96, 142, 1},
-        {206, 148, 104, 255, 1},
-        {190, 137, 96, 255, 1},
-        {194, 139, 98, 255, 1},
-        {168, 121, 83, 255, 1},
-        {148, 106, 72, 255, 1},
-        {151, 108, 74, 255, 2},
-        {154, 110, 76, 255, 1},
-        {156, 112, 77, 255, 2},
-        {158, 114, 78, 255, 1},
-        {136, 98, 66, 255, 1},
-        {119, 84, 57, 255, 1},
-        {121, 86, 58, 255, 5},
-        {115, 82, 55, 255, 1},
-        {161, 115, 79, 255, 1},
-        {198, 143, 101, 255, 1},
-        {193, 139, 97, 255, 1},
-        {196, 141, 100, 255, 1},
-        {172, 124, 86, 255, 1},
-        {153, 110, 75, 255, 1},
-        {156, 112, 77, 255, 5},
-        {158, 114, 78, 255, 1},
-        {136, 98, 66, 255, 1},
-        {119, 84, 57, 255, 1},
-        {121, 86, 58, 255, 2},
-        {122, 87, 59, 255, 1},
-        {124, 88, 60, 255, 1},
-        {124, 88, 59, 255, 1},
-        {127, 91, 61, 255, 1},
-        {101, 71, 47, 255, 1},
-        {80, 55, 36, 255, 1},
-        {84, 57, 37, 255, 1},
-        {81, 55, 36, 255, 1},
-        {105, 73, 49, 255, 1},
-        {124, 88, 59, 255, 1},
-        {121, 86, 58, 255, 2},
-        {118, 84, 56, 255, 1},
-        {115, 82, 55, 255, 1},
-        {116, 82, 55, 255, 1},
-        {110, 78, 52, 255, 1},
-        {156, 111, 77, 255, 1},
-        {193, 140, 98, 255, 1},
-        {188, 135, 95, 255, 1},
-        {193, 139, 98, 255, 1},
-        {152, 109, 75, 255, 1},
-        {119, 84, 56, 255, 1},
-        {124, 88, 59, 255, 1},
-        {118, 84, 56, 255, 1},
-        {162, 116, 80, 255, 1},
-        {198, 143, 101, 255, 1},
-        {193, 139, 97, 255, 1},
-        {208, 150, 106, 255, 1},
-        {149, 105, 73, 142, 1},
-        {161, 116, 80, 255, 1},
-        {149, 107, 73, 255, 1},
-        {149, 107, 74, 255, 1},
-        {150, 107, 74, 255, 1},
-        {151, 108, 74, 255, 2},
-        {154, 110, 76, 255, 1},
-        {131, 93, 63, 255, 1},
-        {114, 80, 53, 255, 1},
-        {116, 82, 55, 255, 2},
-        {119, 84, 57, 255, 1},
-        {122, 86, 58, 255, 1},
-        {121, 86, 58, 255, 5},
-        {120, 85, 57, 255, 1},
-        {127, 90, 61, 255, 1},
-        {132, 93, 64, 255, 1},
-        {131, 93, 63, 255, 1},
-        {133, 94, 64, 255, 1},
-        {123, 87, 59, 255, 1},
-        {115, 81, 54, 255, 1},
-        {116, 82, 55, 255, 6},
-        {119, 84, 57, 255, 1},
-        {122, 86, 58, 255, 1},
-        {121, 86, 58, 255, 1},
-        {123, 87, 59, 255, 1},
-        {111, 78, 52, 255, 1},
-        {102, 71, 47, 255, 1},
-        {103, 72, 48, 255, 1},
-        {102, 71, 47, 255, 1},
-        {115, 80, 54, 255, 1},
-        {125, 89, 60, 255, 1},
-        {124, 87, 59, 255, 2},
-        {122, 87, 59, 255, 1},
-        {121, 86, 58, 255, 2},
-        {118, 84, 56, 255, 1},
-        {141, 101, 69, 255, 1},
-        {160, 114, 79, 255, 1},
-        {157, 112, 77, 255, 1},
-        {156, 112, 77, 255, 1},
-        {162, 116, 80, 255, 1},
-        {167, 120, 83, 255, 1},
-        {166, 119, 82, 255, 1},
-        {171, 123, 85, 255, 1},
-        {131, 93, 63, 255, 1},
-        {98, 68, 45, 255, 1},
-        {103, 72, 48, 255, 1},
-        {101, 70, 47, 255, 1},
-        {119, 84, 56, 255, 1},
-        {134, 95, 65, 255, 1},
-        {131, 93, 63, 255, 1},
-        {142, 100, 69, 255, 1},
-        {116, 82, 53, 142, 1},
-        {125, 89, 60, 255, 1},
-        {116, 82, 55, 255, 1},
-        {113, 80, 54, 255, 1},
-        {136, 96, 66, 255, 1},
-        {153, 110, 75, 255, 1},
-        {151, 108, 74, 255, 1},
-        {156, 112, 77, 255, 1},
-        {113, 80, 53, 255, 1},
-        {79, 53, 34, 255, 1},
-        {84, 57, 37, 255, 1},
-        {81, 55, 36, 255, 1},
-        {105, 73, 49, 255, 1},
-        {124, 88, 59, 255, 1},
-        {121, 86, 58, 255, 5},
-        {125, 88, 59, 255, 1},
-        {99, 69, 46, 255, 1},
-        {78, 53, 34, 255, 1},
-        {81, 55, 36, 255, 1},
-        {81, 55, 35, 255, 1},
-        {83, 56, 37, 255, 1},
-        {84, 57, 37, 255, 6},
-        {81, 55, 36, 255, 1},
-        {105, 73, 49, 255, 1},
-        {124, 88, 59, 255, 1},
-        {121, 86, 58, 255, 1},
-        {124, 88, 59, 255, 1},
-        {102, 71, 47, 255, 1},
-        {83, 57, 37, 255, 1},
-        {86, 59, 39, 255, 1},
-        {81, 54, 35, 255, 1},
-        {126, 88, 60, 255, 1},
-        {162, 116, 80, 255, 1},
-        {156, 112, 77, 255, 1},
-        {158, 114, 78, 255, 1},
-        {136, 98, 66, 255, 1},
-        {119, 84, 57, 255, 1},
-        {121, 86, 58, 255, 1},
-        {116, 82, 55, 255, 1},
-        {160, 114, 79, 255, 1},
-        {196, 141, 99, 255, 1},
-        {190, 137, 96, 255, 1},
-        {194, 139, 98, 255, 1},
-        {167, 120, 82, 255, 1},
-        {145, 103, 70, 255, 1},
-        {148, 106, 72, 255, 1},
-        {153, 110, 75, 255, 1},
-        {113, 80, 54, 255, 1},
-        {81, 55, 36, 255, 1},
-        {86, 59, 39, 255, 1},
-        {87, 59, 39, 255, 1},
-        {83, 57, 37, 255, 1},
-        {81, 55, 35, 255, 1},
-        {81, 55, 36, 255, 1},
-        {88, 60, 38, 255, 1},
-        {122, 86, 57, 142, 1},
-        {131, 93, 63, 255, 1},
-        {121, 86, 58, 255, 1},
-        {119, 84, 57, 255, 1},
-        {138, 98, 67, 255, 1},
-        {153, 110, 75, 255, 1},
-        {151, 108, 74, 255, 1},
-        {156, 112, 77, 255, 1},
-        {116, 82, 55, 255, 1},
-        {84, 57, 37, 255, 1},
-        {89, 61, 40, 255, 1},
-        {86, 59, 39, 255, 1},
-        {107, 75, 50, 255, 1},
-        {124, 88, 59, 255, 1},
-        {121, 86, 58, 255, 5},
-        {124, 88, 59, 255, 1},
-        {103, 72, 48, 255, 1},
-        {86, 59, 39, 255, 1},
-        {89, 61, 40, 255, 9},
-        {86, 59, 39, 255, 1},
-        {107, 75, 50, 255, 1},
-        {124, 88, 59, 255, 1},
-        {121, 86, 58, 255, 1},
-        {124, 88, 59, 255, 1},
-        {103, 72, 48, 255, 1},
-        {86, 59, 39, 255, 1},
-        {89, 61, 40, 255, 1},
-        {84, 57, 37, 255, 1},
-        {124, 87, 59, 255, 1},
-        {156, 112, 77, 255, 1},
-        {151, 108, 74, 255, 1},
-        {153, 110, 75, 255, 1},
-        {134, 96, 65, 255, 1},
-        {119, 84, 57, 255, 1},
-        {121, 86, 58, 255, 1},
-        {116, 82, 55, 255, 1},
-        {157, 112, 77, 255, 1},
-        {190, 137, 96, 255, 1},
-        {185, 133, 93, 255, 1},
-        {188, 135, 95, 255, 1},
-        {166, 119, 82, 255, 1},
-        {148, 106, 72, 255, 1},
-        {151, 108, 74, 255, 1},
-        {156, 112, 77, 255, 1},
-        {116, 82, 55, 255, 1},
-        {84, 57, 37, 255, 1},
-        {89, 61, 40, 255, 5},
-        {96, 66, 43, 255, 1},
-        {116, 82, 53, 142, 1},
-        {125, 89, 60, 255, 1},
-        {116, 82, 55, 255, 1},
-        {113, 80, 54, 255, 1},
-        {137, 97, 66, 255, 1},
-        {156, 112, 77, 255, 1},
-        {153, 110, 75, 255, 1},
-        {159, 114, 79, 255, 1},
-        {116, 82, 55, 255, 1},
-        {81, 55, 35, 255, 1},
-        {86, 59, 39, 255, 1},
-        {83, 57, 37, 255, 1},
-        {107, 75, 50, 255, 1},
-        {127, 90, 61, 255, 1},
-        {124, 88, 59, 255, 1},
-        {124, 89, 60, 255, 1},
-        {119, 85, 57, 255, 1},
-        {115, 82, 55, 255, 1},
-        {116, 82, 55, 255, 1},
-        {119, 84, 56, 255, 1},
-        {98, 68, 45, 255, 1},
-        {81, 55, 36, 255, 1},
-        {84, 57, 37, 255, 6},
-        {85, 58, 38, 255, 1},
-        {87, 59, 39, 255, 1},
-        {86, 59, 39, 255, 1},
-        {84, 57, 38, 255, 1},
-        {103, 72, 48, 255, 1},
-        {119, 84, 56, 255, 1},
-        {116, 82, 55, 255, 1},
-        {118, 84, 56, 255, 1},
-        {101, 70, 47, 255, 1},
-        {86, 59, 39, 255, 1},
-        {89, 61, 40, 255, 1},
-        {84, 57, 37, 255, 1},
-        {125, 88, 60, 255, 1},
-        {159, 114, 79, 255, 1},
-        {153, 110, 75, 255, 1},
-        {156, 112, 76, 255, 1},
-        {135, 97, 66, 255, 1},
-        {119, 84, 57, 255, 1},
-        {121, 86, 58, 255, 1},
-        {115, 82, 55, 255, 1},
-        {161, 115, 79, 255, 1},
-        {198, 143, 101, 255, 1},
-        {193, 139, 97, 255, 1},
-        {196, 142, 100, 255, 1},
-        {170, 120, 81, 255, 1},
-        {149, 103, 66, 255, 1},
-        {152, 106, 69, 255, 1},
-        {158, 110, 72, 255, 1},
-        {112, 78, 50, 255, 1},
-        {76, 51, 33, 255, 1},
-        {81, 55, 36, 255, 1},
-        {81, 55, 35, 255, 1},
-        {84, 57, 37, 255, 1},
-        {87, 59, 39, 255, 1},
-        {86, 59, 39, 255, 1},
-        {93, 64, 41, 255, 1},
-        {158, 113, 77, 142, 1},
-        {170, 121, 84, 255, 1},
-        {157, 112, 77, 255, 1},
-        {159, 114, 79, 255, 1},
-        {144, 103, 70, 255, 1},
-        {132, 94, 64, 255, 1},
-        {134, 96, 65, 255, 1},
-        {136, 97, 66, 255, 1},
-        {119, 84, 57, 255, 1},
-        {105, 73, 49, 255, 1},
-        {107, 75, 50, 255, 2},
-        {105, 73, 49, 255, 1},
-        {103, 72, 48, 255, 2},
-        {99, 69, 46, 255, 1},
-        {133, 94, 65, 255, 1},
-        {161, 116, 80, 255, 1},
-        {157, 112, 77, 255, 1},
-        {160, 114, 79, 255, 1},
-        {138, 98, 67, 255, 1},
-        {121, 85, 58, 255, 1},
-        {124, 87, 59, 255, 5},
-        {125, 88, 60, 255, 1},
-        {114, 80, 54, 255, 1},
-        {106, 74, 49, 255, 1},
-        {107, 75, 50, 255, 1},
-        {103, 72, 48, 255, 1},
-        {135, 96, 65, 255, 1},
-        {161, 115, 80, 255, 1},
-        {157, 112, 77, 255, 1},
-        {163, 116, 80, 255, 1},
-        {119, 84, 56, 255, 1},
-        {83, 57, 37, 255, 1},
-        {89, 61, 40, 255, 1},
-        {85, 58, 38, 255, 1},
-        {114, 80, 54, 255, 1},
-        {138, 98, 67, 255, 1},
-        {134, 96, 65, 255, 1},
-        {135, 96, 66, 255, 1},
-        {127, 90, 61, 255, 1},
-        {120, 85, 58, 255, 1},
-        {121, 86, 58, 255, 1},
-        {120, 85, 57, 255, 1},
-        {127, 90, 61, 255, 1},
-        {132, 93, 64, 255, 1},
-        {131, 93, 63, 255, 1},
-        {130, 90, 60, 255, 1},
-        {137, 110, 88, 255, 1},
-        {143, 126, 112, 255, 1},
-        {142, 123, 108, 255, 1},
-        {142, 125, 111, 255, 1},
-        {142, 111, 87, 255, 1},
-        {143, 99, 67, 255, 1},
-        {143, 101, 70, 255, 1},
-        {145, 103, 71, 255, 1},
-        {122, 87, 59, 255, 1},
-        {104, 73, 48, 255, 1},
-        {107, 75, 50, 255, 1},
-        {116, 81, 54, 255, 1},
-        {190, 136, 96, 142, 1},
-        {206, 148, 104, 255, 1},
-        {190, 137, 96, 255, 1},
-        {196, 141, 99, 255, 1},
-        {150, 108, 74, 255, 1},
-        {113, 80, 53, 255, 1},
-        {119, 84, 57, 255, 1},
-        {118, 84, 56, 255, 1},
-        {121, 86, 58, 255, 1},
-        {124, 88, 60, 255, 1},
-        {124, 88, 59, 255, 1},
-        {127, 90, 61, 255, 1},
-        {103, 72, 48, 255, 1},
-        {83, 57, 37, 255, 1},
-        {86, 59, 39, 255, 1},
-        {78, 52, 34, 255, 1},
-        {145, 102, 71, 255, 1},
-        {199, 143, 100, 255, 1},
-        {190, 137, 96, 255, 1},
-        {193, 139, 98, 255, 1},
-        {171, 123, 85, 255, 1},
-        {153, 110, 75, 255, 1},
-        {156, 112, 77, 255, 5},
-        {158, 114, 78, 255, 1},
-        {138, 99, 67, 255, 1},
-        {121, 86, 58, 255, 1},
-        {124, 88, 59, 255, 1},
-        {118, 84, 56, 255, 1},
-        {161, 115, 79, 255, 1},
-        {195, 141, 99, 255, 1},
-        {190, 137, 96, 255, 1},
-        {199, 143, 100, 255, 1},
-        {133, 95, 64, 255, 1},
-        {81, 55, 36, 255, 1},
-        {89, 61, 40, 255, 1},
-        {86, 59, 39, 255, 1},
-        {106, 74, 49, 255, 1},
-        {121, 86, 58, 255, 1},
-        {119, 84, 57, 255, 1},
-        {118, 84, 57, 255, 1},
-        {120, 85, 57, 255, 1},
-        {121, 86, 58, 255, 2},
-        {125, 88, 59, 255, 1},
-        {99, 69, 46, 255, 1},
-        {78, 53, 34, 255, 1},
-        {81, 55, 36, 255, 1},
-        {77, 48, 27, 255, 1},
-        {111, 101, 94, 255, 1},
-        {138, 144, 149, 255, 1},
-        {134, 137, 140, 255, 1},
-        {129, 137, 143, 255, 1},
-        {167, 138, 117, 255, 1},
-        {198, 139, 94, 255, 1},
-        {193, 139, 97, 255, 1},
-        {198, 143, 101, 255, 1},
-        {154, 111, 76, 255, 1},
-        {118, 84, 56, 255, 1},
-        {124, 88, 59, 255, 1},
-        {134, 95, 65, 255, 1},
-        {184, 132, 93, 142, 1},
-        {200, 144, 101, 255, 1},
-        {185, 133, 93, 255, 1},
-        {190, 137, 96, 255, 1},
-        {149, 107, 73, 255, 1},
-        {116, 82, 55, 255, 1},
-        {121, 86, 58, 255, 5},
-        {124, 88, 59, 255, 1},
-        {103, 72, 48, 255, 1},
-        {86, 59, 39, 255, 1},
-        {89, 61, 40, 255, 1},
-        {81, 55, 36, 255, 1},
-        {143, 101, 70, 255, 1},
-        {193, 139, 97, 255, 1},
-        {185, 133, 93, 255, 1},
-        {188, 135, 95, 255, 1},
-        {166, 119, 82, 255, 1},
-        {148, 106, 72, 255, 1},
-        {151, 108, 74, 255, 5},
-        {153, 110, 75, 255, 1},
-        {134, 96, 65, 255, 1},
-        {119, 84, 57, 255, 1},
-        {121, 86, 58, 255, 1},
-        {116, 82, 55, 255, 1},
-        {157, 112, 77, 255, 1},
-        {190, 137, 96, 255, 1},
-        {185, 133, 93, 255, 1},
-        {193, 139, 97, 255, 1},
-        {131, 93, 63, 255, 1},
-        {81, 55, 36, 255, 1},
-        {89, 61, 40, 255, 1},
-        {86, 59, 39, 255, 1},
-        {107, 75, 50, 255, 1},
-        {124, 88, 59, 255, 1},
-        {121, 86, 58, 255, 5},
-        {124, 88, 59, 255, 1},
-        {103, 72, 48, 255, 1},
-        {86, 59, 39, 255, 1},
-        {89, 61, 40, 255, 1},
-        {85, 55, 32, 255, 1},
-        {115, 102, 93, 255, 1},
-        {139, 141, 143, 255, 1},
-        {135, 135, 135, 255, 1},
-        {131, 135, 138, 255, 1},
-        {163, 134, 112, 255, 1},
-        {189, 133, 90, 255, 1},
-        {185, 133, 93, 255, 1},
-        {190, 137, 96, 255, 1},
-        {149, 107, 73, 255, 1},
-        {116, 82, 55, 255, 1},
-        {121, 86, 58, 255, 1},
-        {131, 93, 63, 255, 1},
-        {188, 134, 95, 142, 1},
-        {203, 146, 103, 255, 1},
-        {188, 135, 95, 255, 1},
-        {193, 139, 98, 255, 1},
-        {151, 107, 71, 255, 1},
-        {117, 80, 51, 255, 1},
-        {122, 84, 54, 255, 2},
-        {119, 83, 55, 255, 1},
-        {115, 82, 55, 255, 1},
-        {116, 82, 55, 255, 1},
-        {119, 84, 56, 255, 1},
-        {99, 69, 46, 255, 1},
-        {84, 57, 38, 255, 1},
-        {86, 59, 39, 255, 1},
-        {78, 52, 34, 255, 1},
-        {146, 103, 72, 255, 1},
-        {202, 146, 102, 255, 1},
-        {193, 139, 97, 255, 1},
-        {196, 141, 100, 255, 1},
-        {169, 122, 84, 255, 1},
-        {147, 106, 72, 255, 1},
-        {151, 108, 74, 255, 2},
-        {152, 109, 75, 255, 1},
-        {154, 110, 75, 255, 1},
-        {153, 110, 75, 255, 1},
-        {156, 112, 77, 255, 1},
-        {132, 95, 64, 255, 1},
-        {113, 80, 54, 255, 1},
-        {116, 82, 55, 255, 1},
-        {110, 78, 52, 255, 1},
-        {156, 111, 77, 255, 1},
-        {193, 140, 98, 255, 1},
-        {188, 135, 95, 255, 1},
-        {196, 142, 99, 255, 1},
-        {129, 92, 62, 255, 1},
-        {75, 51, 33, 255, 1},
-        {84, 57, 37, 255, 1},
-        {81, 55, 36, 255, 1},
-        {105, 73, 49, 255, 1},
-        {124, 88, 59, 255, 1},
-        {121, 86, 58, 255, 2},
-        {122, 87, 59, 255, 1},
-        {124, 88, 60, 255, 1},
-        {124, 88, 59, 255, 1},
-        {127, 90, 61, 255, 1},
-        {103, 72, 48, 255, 1},
-        {83, 57, 37, 255, 1},
-        {86, 59, 39, 255, 1},
-        {83, 53, 30, 255, 1},
-        {112, 101, 94, 255, 1},
-        {135, 141, 147, 255, 1},
-        {131, 135, 138, 255, 1},
-        {127, 135, 141, 255, 1},
-        {163, 135, 114, 255, 1},
-        {192, 135, 92, 255, 1},
-        {188, 135, 95, 255, 1},
-        {193, 139, 98, 255, 1},
-        {150, 108, 74, 255, 1},
-        {116, 82, 55, 255, 1},
-        {121, 86, 58, 255, 1},
-        {131, 93, 63, 255, 1},
-        {165, 118, 82, 142, 1},
-        {179, 129, 89, 255, 1},
-        {166, 119, 82, 255, 1},
-        {170, 121, 82, 255, 1},
-        {137, 108, 84, 255, 1},
-        {110, 96, 86, 255, 1},
-        {114, 98, 86, 255, 1},
-        {110, 97, 86, 255, 1},
-        {138, 106, 81, 255, 1},
-        {160, 113, 77, 255, 1},
-        {157, 112, 77, 255, 1},
-        {161, 115, 80, 255, 1},
-        {129, 91, 62, 255, 1},
-        {103, 72, 48, 255, 1},
-        {107, 75, 50, 255, 1},
-        {105, 73, 49, 255, 1},
-        {121, 85, 58, 255, 1},
-        {133, 94, 65, 255, 1},
-        {131, 93, 63, 255, 1},
-        {130, 91, 63, 255, 1},
-        {143, 101, 69, 255, 1},
-        {153, 109, 75, 255, 1},
-        {151, 108, 74, 255, 1},
-        {152, 109, 75, 255, 1},
-        {142, 101, 69, 255, 1},
-        {133, 94, 64, 255, 1},
-        {134, 96, 65, 255, 1},
-        {132, 94, 64, 255, 1},
-        {147, 105, 72, 255, 1},
-        {159, 114, 79, 255, 1},
-        {157, 112, 77, 255, 1},
-        {156, 112, 77, 255, 1},
-        {162, 116, 80, 255, 1},
-        {167, 120, 83, 255, 1},
-        {166, 119, 82, 255, 1},
-        {169, 122, 84, 255, 1},
-        {142, 101, 69, 255, 1},
-        {120, 85, 57, 255, 1},
-        {124, 87, 59, 255, 2},
-        {122, 87, 59, 255, 1},
-        {121, 86, 58, 255, 2},
-        {123, 87, 59, 255, 1},
-        {111, 78, 52, 255, 1},
-        {102, 71, 47, 255, 1},
-        {103, 72, 48, 255, 2},
-        {105, 74, 49, 255, 1},
-        {107, 75, 50, 255, 2},
-        {103, 70, 45, 255, 1},
-        {138, 108, 84, 255, 1},
-        {167, 139, 117, 255, 1},
-        {163, 134, 112, 255, 1},
-        {163, 135, 114, 255, 1},
-        {165, 126, 95, 255, 1},
-        {166, 118, 80, 255, 1},
-        {166, 119, 82, 255, 1},
-        {169, 122, 84, 255, 1},
-        {141, 101, 69, 255, 1},
-        {118, 83, 56, 255, 1},
-        {121, 86, 58, 255, 1},
-        {131, 93, 63, 255, 1},
-        {147, 105, 71, 142, 1},
-        {160, 115, 78, 255, 1},
-        {148, 106, 72, 255, 1},
-        {151, 106, 69, 255, 1},
-        {125, 108, 95, 255, 1},
-        {104, 110, 115, 255, 1},
-        {107, 110, 112, 255, 1},
-        {101, 108, 113, 255, 1},
-        {153, 125, 103, 255, 1},
-        {197, 139, 95, 255, 1},
-        {190, 137, 96, 255, 1},
-        {195, 141, 99, 255, 1},
-        {153, 110, 75, 255, 1},
-        {118, 84, 56, 255, 1},
-        {124, 88, 59, 255, 1},
-        {127, 91, 61, 255, 1},
-        {100, 70, 46, 255, 1},
-        {77, 52, 34, 255, 1},
-        {81, 55, 36, 255, 1},
-        {76, 51, 32, 255, 1},
-        {121, 84, 57, 255, 1},
-        {157, 112, 77, 255, 1},
-        {151, 108, 74, 255, 1},
-        {153, 110, 75, 255, 1},
-        {133, 95, 64, 255, 1},
-        {116, 82, 56, 255, 1},
-        {119, 84, 57, 255, 1},
-        {113, 80, 53, 255, 1},
-        {159, 113, 78, 255, 1},
-        {196, 141, 99, 255, 1},
-        {190, 137, 96, 255, 1},
-        {194, 139, 98, 255, 1},
-        {167, 120, 82, 255, 1},
-        {145, 103, 70, 255, 1},
-        {148, 106, 72, 255, 1},
-        {148, 105, 72, 255, 1},
-        {153, 109, 75, 255, 1},
-        {157, 112, 77, 255, 1},
-        {156, 112, 77, 255, 1},
-        {158, 114, 78, 255, 1},
-        {136, 98, 66, 255, 1},
-        {119, 84, 57, 255, 1},
-        {121, 86, 58, 255, 1},
-        {124, 88, 59, 255, 1},
-        {102, 71, 47, 255, 1},
-        {83, 57, 37, 255, 1},
-        {86, 59, 39, 255, 1},
-        {83, 57, 37, 255, 1},
-        {107, 75, 50, 255, 1},
-        {127, 90, 61, 255, 1},
-        {124, 88, 59, 255, 1},
-        {119, 84, 57, 255, 1},
-        {160, 113, 76, 255, 1},
-        {194, 137, 92, 255, 1},
-        {189, 133, 90, 255, 1},
-        {193, 135, 92, 255, 1},
-        {166, 118, 80, 255, 1},
-        {145, 104, 71, 255, 1},
-        {148, 106, 72, 255, 1},
-        {150, 108, 73, 255, 1},
-        {133, 95, 64, 255, 1},
-        {119, 84, 57, 255, 1},
-        {121, 86, 58, 255, 1},
-        {131, 93, 63, 255, 1},
-        {150, 107, 73, 142, 1},
-        {163, 117, 80, 255, 1},
-        {151, 108, 74, 255, 1},
-        {154, 108, 71, 255, 1},
-        {127, 108, 93, 255, 1},
-        {105, 108, 111, 255, 1},
-        {108, 108, 108, 255, 1},
-        {102, 106, 109, 255, 1},
-        {151, 122, 100, 255, 1},
-        {191, 135, 92, 255, 1},
-        {185, 133, 93, 255, 1},
-        {190, 137, 96, 255, 1},
-        {149, 107, 73, 255, 1},
-        {116, 82, 55, 255, 1},
-        {121, 86, 58, 255, 1},
-        {124, 88, 59, 255, 1},
-        {103, 72, 48, 255, 1},
-        {86, 59, 39, 255, 1},
-        {89, 61, 40, 255, 1},
-        {84, 57, 37, 255, 1},
-        {124, 87, 59, 255, 1},
-        {156, 112, 77, 255, 1},
-        {151, 108, 74, 255, 1},
-        {153, 110, 75, 255, 1},
-        {134, 96, 65, 255, 1},
-        {119, 84, 57, 255, 1},
-        {121, 86, 58, 255, 1},
-        {116, 82, 55, 255, 1},
-        {157, 112, 77, 255, 1},
-        {190, 137, 96, 255, 1},
-        {185, 133, 93, 255, 1},
-        {188, 135, 95, 255, 1},
-        {166, 119, 82, 255, 1},
-        {148, 106, 72, 255, 1},
-        {151, 108, 74, 255, 5},
-        {153, 110, 75, 255, 1},
-        {134, 96, 65, 255, 1},
-        {119, 84, 57, 255, 1},
-        {121, 86, 58, 255, 1},
-        {124, 88, 59, 255, 1},
-        {103, 72, 48, 255, 1},
-        {86, 59, 39, 255, 1},
-        {89, 61, 40, 255, 1},
-        {86, 59, 39, 255, 1},
-        {107, 75, 50, 255, 1},
-        {124, 88, 59, 255, 1},
-        {121, 86, 58, 255, 1},
-        {116, 82, 55, 255, 1},
-        {157, 112, 77, 255, 1},
-        {190, 137, 96, 255, 1},
-        {185, 133, 93, 255, 1},
-        {188, 135, 95, 255, 1},
-        {166, 119, 82, 255, 1},
-        {148, 106, 72, 255, 1},
-        {151, 108, 74, 255, 1},
-        {153, 110, 75, 255, 1},
-        {134, 96, 65, 255, 1},
-        {119, 84, 57, 255, 1},
-        {121, 86, 58, 255, 1},
-        {131, 93, 63, 255, 1},
-        {150, 107, 73, 142, 1},
-        {163, 117, 80, 255, 1},
-        {151, 108, 74, 255, 1},
-        {154, 108, 71, 255, 1},
-        {126, 109, 95, 255, 1},
-        {104, 110, 115, 255, 1},
-        {107, 110, 112, 255, 1},
-        {101, 108, 113, 255, 1},
-        {152, 124, 103, 255, 1},
-        {194, 137, 93, 255, 1},
-        {188, 135, 95, 255, 1},
-        {193, 140, 98, 255, 1},
-        {147, 106, 72, 255, 1},
-        {110, 78, 52, 255, 1},
-        {116, 82, 55, 255, 1},
-        {118, 84, 56, 255, 1},
-        {101, 70, 47, 255, 1},
-        {86, 59, 39, 255, 1},
-        {89, 61, 40, 255, 1},
-        {84, 57, 37, 255, 1},
-        {124, 87, 59, 255, 1},
-        {156, 112, 77, 255, 1},
-        {151, 108, 74, 255, 1},
-        {153, 110, 75, 255, 1},
-        {134, 96, 65, 255, 1},
-        {119, 84, 57, 255, 1},
-        {121, 86, 58, 255, 1},
-        {116, 82, 55, 255, 1},
-        {160, 114, 79, 255, 1},
-        {196, 141, 99, 255, 1},
-        {190, 137, 96, 255, 1},
-        {194, 139, 98, 255, 1},
-        {168, 121, 83, 255, 1},
-        {148, 106, 72, 255, 1},
-        {151, 108, 74, 255, 2},
-        {154, 110, 76, 255, 1},
-        {156, 112, 77, 255, 2},
-        {158, 114, 78, 255, 1},
-        {136, 98, 66, 255, 1},
-        {119, 84, 57, 255, 1},
-        {121, 86, 58, 255, 1},
-        {125, 88, 59, 255, 1},
-        {99, 69, 46, 255, 1},
-        {78, 53, 34, 255, 1},
-        {81, 55, 36, 255, 1},
-        {78, 53, 34, 255, 1},
-        {104, 72, 48, 255, 1},
-        {125, 88, 59, 255, 1},
-        {121, 86, 58, 255, 1},
-        {116, 82, 55, 255, 1},
-        {159, 113, 78, 255, 1},
-        {193, 139, 98, 255, 1},
-        {188, 135, 95, 255, 1},
-        {191, 137, 96, 255, 1},
-        {170, 122, 84, 255, 1},
-        {153, 110, 75, 255, 1},
-        {156, 112, 77, 255, 1},
-        {158, 114, 78, 255, 1},
-        {136, 98, 66, 255, 1},
-        {119, 84, 57, 255, 1},
-        {121, 86, 58, 255, 1},
-        {131, 93, 63, 255, 1},
-        {150, 107, 73, 142, 1},
-        {163, 117, 80, 255, 1},
-        {151, 108, 74, 255, 1},
-        {154, 109, 73, 255, 1},
-        {131, 101, 77, 255, 1},
-        {113, 94, 81, 255, 1},
-        {115, 96, 80, 255, 1},
-        {111, 94, 80, 255, 1},
-        {144, 109, 81, 255, 1},
-        {170, 121, 83, 255, 1},
-        {166, 119, 82, 255, 1},
-        {167, 120, 83, 255, 1},
-        {161, 115, 80, 255, 1},
-        {156, 112, 77, 255, 1},
-        {157, 112, 77, 255, 1},
-        {163, 116, 80, 255, 1},
-        {119, 84, 56, 255, 1},
-        {83, 57, 37, 255, 1},
-        {89, 61, 40, 255, 1},
-        {84, 57, 37, 255, 1},
-        {124, 87, 59, 255, 1},
-        {156, 112, 77, 255, 1},
-        {151, 108, 74, 255, 1},
-        {153, 110, 75, 255, 1},
-        {134, 96, 65, 255, 1},
-        {119, 84, 57, 255, 1},
-        {121, 86, 58, 255, 1},
-        {119, 84, 57, 255, 1},
-        {137, 97, 66, 255, 1},
-        {151, 109, 75, 255, 1},
-        {149, 107, 73, 255, 1},
-        {149, 107, 74, 255, 1},
-        {150, 107, 74, 255, 1},
-        {151, 108, 74, 255, 2},
-        {154, 110, 76, 255, 1},
-        {131, 93, 63, 255, 1},
-        {114, 80, 53, 255, 1},
-        {116, 82, 55, 255, 2},
-        {119, 84, 57, 255, 1},
-        {122, 86, 58, 255, 1},
-        {121, 86, 58, 255, 1},
-        {119, 85, 57, 255, 1},
-        {133, 94, 64, 255, 1},
-        {144, 103, 71, 255, 1},
-        {143, 101, 70, 255, 1},
-        {144, 103, 71, 255, 1},
-        {130, 93, 63, 255, 1},
-        {119, 85, 57, 255, 1},
-        {121, 86, 58, 255, 1},
-        {118, 83, 56, 255, 1},
-        {146, 104, 71, 255, 1},
-        {169, 122, 84, 255, 1},
-        {166, 119, 82, 255, 1},
-        {170, 122, 85, 255, 1},
-        {138, 98, 67, 255, 1},
-        {112, 79, 53, 255, 1},
-        {116, 82, 55, 255, 2},
-        {119, 84, 57, 255, 1},
-        {122, 86, 58, 255, 1},
-        {121, 86, 58, 255, 1},
-        {131, 93, 63, 255, 1},
-        {150, 107, 73, 142, 1},
-        {163, 117, 80, 255, 1},
-        {151, 108, 74, 255, 1},
-        {153, 110, 75, 255, 1},
-        {135, 95, 63, 255, 1},
-        {120, 82, 53, 255, 1},
-        {122, 84, 54, 255, 1},
-        {120, 82, 53, 255, 1},
-        {137, 96, 64, 255, 1},
-        {150, 108, 74, 255, 1},
-        {148, 106, 72, 255, 1},
-        {145, 103, 70, 255, 1},
-        {172, 123, 86, 255, 1},
-        {194, 139, 98, 255, 1},
-        {190, 137, 96, 255, 1},
-        {199, 143, 100, 255, 1},
-        {133, 95, 64, 255, 1},
-        {81, 55, 36, 255, 1},
-        {89, 61, 40, 255, 1},
-        {84, 57, 37, 255, 1},
-        {124, 87, 59, 255, 1},
-        {156, 112, 77, 255, 1},
-        {151, 108, 74, 255, 1},
-        {153, 110, 75, 255, 1},
-        {134, 96, 65, 255, 1},
-        {119, 84, 57, 255, 1},
-        {121, 86, 58, 255, 2},
-        {118, 84, 56, 255, 1},
-        {115, 82, 55, 255, 1},
-        {116, 82, 55, 255, 1},
-        {113, 80, 54, 255, 1},
-        {136, 96, 66, 255, 1},
-        {153, 110, 75, 255, 1},
-        {151, 108, 74, 255, 1},
-        {156, 112, 77, 255, 1},
-        {113, 80, 53, 255, 1},
-        {79, 53, 34, 255, 1},
-        {84, 57, 37, 255, 1},
-        {81, 55, 36, 255, 1},
-        {105, 73, 49, 255, 1},
-        {124, 88, 59, 255, 1},
-        {121, 86, 58, 255, 1},
-        {115, 82, 55, 255, 1},
-        {161, 115, 79, 255, 1},
-        {198, 143, 101, 255, 1},
-        {193, 139, 97, 255, 1},
-        {198, 143, 101, 255, 1},
-        {152, 110, 75, 255, 1},
-        {115, 82, 55, 255, 1},
-        {121, 86, 58, 255, 1},
-        {119, 84, 57, 255, 1},
-        {136, 97, 66, 255, 1},
-        {150, 108, 73, 255, 1},
-        {148, 106, 72, 255, 1},
-        {153, 110, 76, 255, 1},
-        {112, 79, 53, 255, 1},
-        {79, 53, 34, 255, 1},
-        {84, 57, 37, 255, 1},
-        {81, 55, 36, 255, 1},
-        {105, 73, 49, 255, 1},
-        {124, 88, 59, 255, 1},
-        {121, 86, 58, 255, 1},
-        {131, 93, 63, 255, 1},
-        {150, 107, 73, 142, 1},
-        {163, 117, 80, 255, 1},
-        {151, 108, 74, 255, 1},
-        {153, 110, 75, 255, 1},
-        {134, 96, 65, 255, 1},
-        {119, 84, 57, 255, 1},
-        {121, 86, 58, 255, 1},
-        {119, 84, 57, 255, 1},
-        {138, 98, 67, 255, 1},
-        {153, 110, 75, 255, 1},
-        {151, 108, 74, 255, 1},
-        {148, 106, 72, 255, 1},
-        {170, 122, 85, 255, 1},
-        {188, 135, 95, 255, 1},
-        {185, 133, 93, 255, 1},
-        {193, 139, 97, 255, 1},
-        {131, 93, 63, 255, 1},
-        {81, 55, 36, 255, 1},
-        {89, 61, 40, 255, 1},
-        {84, 57, 37, 255, 1},
-        {124, 87, 59, 255, 1},
-        {156, 112, 77, 255, 1},
-        {151, 108, 74, 255, 1},
-        {153, 110, 75, 255, 1},
-        {134, 96, 65, 255, 1},
-        {119, 84, 57, 255, 1},
-        {121, 86, 58, 255, 5},
-        {119, 84, 57, 255, 1},
-        {138, 98, 67, 255, 1},
-        {153, 110, 75, 255, 1},
-        {151, 108, 74, 255, 1},
-        {156, 112, 77, 255, 1},
-        {116, 82, 55, 255, 1},
-        {84, 57, 37, 255, 1},
-        {89, 61, 40, 255, 1},
-        {86, 59, 39, 255, 1},
-        {107, 75, 50, 255, 1},
-        {124, 88, 59, 255, 1},
-        {121, 86, 58, 255, 1},
-        {116, 82, 55, 255, 1},
-        {157, 112, 77, 255, 1},
-        {190, 137, 96, 255, 1},
-        {185, 133, 93, 255, 1},
-        {190, 137, 96, 255, 1},
-        {149, 107, 73, 255, 1},
-        {116, 82, 55, 255, 1},
-        {121, 86, 58, 255, 1},
-        {119, 84, 57, 255, 1},
-        {138, 98, 67, 255, 1},
-        {153, 110, 75, 255, 1},
-        {151, 108, 74, 255, 1},
-        {156, 112, 77, 255, 1},
-        {116, 82, 55, 255, 1},
-        {84, 57, 37, 255, 1},
-        {89, 61, 40, 255, 1},
-        {86, 59, 39, 255, 1},
-        {107, 75, 50, 255, 1},
-        {124, 88, 59, 255, 1},
-        {121, 86, 58, 255, 1},
-        {131, 93, 63, 255, 1},
-        {147, 105, 71, 142, 1},
-        {160, 115, 78, 255, 1},
-        {148, 106, 72, 255, 1},
-        {150, 108, 73, 255, 1},
-        {134, 96, 65, 255, 1},
-        {122, 86, 59, 255, 1},
-        {124, 88, 59, 255, 1},
-        {122, 86, 59, 255, 1},
-        {139, 99, 68, 255, 1},
-        {153, 110, 75, 255, 1},
-        {151, 108, 74, 255, 1},
-        {148, 106, 72, 255, 1},
-        {172, 123, 86, 255, 1},
-        {191, 137, 97, 255, 1},
-        {188, 135, 95, 255, 1},
-        {196, 141, 99, 255, 1},
-        {131, 93, 63, 255, 1},
-        {78, 53, 34, 255, 1},
-        {86, 59, 39, 255, 1},
-        {81, 55, 35, 255, 1},
-        {123, 86, 58, 255, 1},
-        {156, 112, 77, 255, 1},
-        {151, 108, 74, 255, 1},
-        {153, 110, 75, 255, 1},
-        {135, 97, 66, 255, 1},
-        {122, 86, 59, 255, 1},
-        {124, 88, 59, 255, 5},
-        {121, 86, 58, 255, 1},
-        {142, 101, 69, 255, 1},
-        {158, 114, 78, 255, 1},
-        {156, 112, 77, 255, 1},
-        {162, 116, 80, 255, 1},
-        {117, 83, 55, 255, 1},
-        {81, 54, 35, 255, 1},
-        {86, 59, 39, 255, 1},
-        {83, 57, 37, 255, 1},
-        {106, 74, 49, 255, 1},
-        {124, 88, 59, 255, 1},
-        {121, 86, 58, 255, 1},
-        {115, 82, 55, 255, 1},
-        {161, 115, 79, 255, 1},
-        {198, 143, 101, 255, 1},
-        {193, 139, 97, 255, 1},
-        {198, 143, 101, 255, 1},
-        {152, 110, 75, 255, 1},
-        {115, 82, 55, 255, 1},
-        {121, 86, 58, 255, 1},
-        {119, 84, 57, 255, 1},
-        {139, 99, 68, 255, 1},
-        {156, 112, 76, 255, 1},
-        {153, 110, 75, 255, 1},
-        {159, 114, 79, 255, 1},
-        {116, 82, 55, 255, 1},
-        {81, 55, 35, 255, 1},
-        {86, 59, 39, 255, 1},
-        {84, 57, 38, 255, 1},
-        {103, 72, 48, 255, 1},
-        {119, 84, 56, 255, 1},
-        {116, 82, 55, 255, 1},
-        {125, 89, 60, 255, 1},
-        {170, 122, 84, 142, 1},
-        {184, 132, 92, 255, 1},
-        {170, 122, 85, 255, 1},
-        {175, 126, 87, 255, 1},
-        {132, 94, 64, 255, 1},
-        {98, 68, 45, 255, 1},
-        {103, 72, 48, 255, 1},
-        {99, 69, 46, 255, 1},
-        {130, 92, 63, 255, 1},
-        {155, 111, 76, 255, 1},
-        {151, 108, 74, 255, 1},
-        {150, 107, 73, 255, 1},
-        {159, 114, 79, 255, 1},
-        {167, 120, 83, 255, 1},
-        {166, 119, 82, 255, 1},
-        {171, 123, 85, 255, 1},
-        {133, 95, 64, 255, 1},
-        {102, 71, 48, 255, 1},
-        {107, 75, 50, 255, 1},
-        {104, 72, 48, 255, 1},
-        {132, 93, 64, 255, 1},
-        {154, 111, 76, 255, 1},
-        {151, 108, 74, 255, 1},
-        {155, 111, 76, 255, 1},
-        {124, 88, 59, 255, 1},
-        {99, 69, 46, 255, 1},
-        {103, 72, 48, 255, 5},
-        {102, 71, 47, 255, 1},
-        {111, 77, 52, 255, 1},
-        {117, 83, 56, 255, 1},
-        {116, 82, 55, 255, 1},
-        {117, 82, 56, 255, 1},
-        {111, 78, 52, 255, 1},
-        {106, 74, 49, 255, 1},
-        {107, 75, 50, 255, 1},
-        {106, 74, 49, 255, 1},
-        {115, 81, 54, 255, 1},
-        {122, 87, 59, 255, 1},
-        {121, 86, 58, 255, 1},
-        {120, 85, 57, 255, 1},
-        {127, 90, 61, 255, 1},
-        {132, 93, 64, 255, 1},
-        {131, 93, 63, 255, 1},
-        {132, 93, 64, 255, 1},
-        {126, 89, 60, 255, 1},
-        {120, 85, 57, 255, 1},
-        {121, 86, 58, 255, 1},
-        {120, 85, 57, 255, 1},
-        {129, 91, 62, 255, 1},
-        {135, 96, 65, 255, 1},
-        {134, 96, 65, 255, 1},
-        {136, 97, 66, 255, 1},
-        {119, 84, 57, 255, 1},
-        {105, 73, 49, 255, 1},
-        {107, 75, 50, 255, 1},
-        {103, 72, 48, 255, 1},
-        {135, 96, 65, 255, 1},
-        {161, 115, 80, 255, 1},
-        {157, 112, 77, 255, 1},
-        {170, 121, 84, 255, 1},
-        {188, 134, 95, 142, 1},
-        {203, 146, 103, 255, 1},
-        {188, 135, 95, 255, 1},
-        {196, 141, 99, 255, 1},
-        {131, 93, 63, 255, 1},
-        {78, 53, 34, 255, 1},
-        {86, 59, 39, 255, 1},
-        {81, 55, 35, 255, 1},
-        {123, 86, 58, 255, 1},
-        {156, 112, 77, 255, 1},
-        {151, 108, 74, 255, 2},
-        {149, 107, 73, 255, 1},
-        {148, 106, 72, 255, 2},
-        {150, 108, 73, 255, 1},
-        {134, 96, 65, 255, 1},
-        {122, 86, 59, 255, 1},
-        {124, 88, 59, 255, 1},
-        {122, 86, 59, 255, 1},
-        {139, 99, 68, 255, 1},
-        {153, 110, 75, 255, 1},
-        {151, 108, 74, 255, 1},
-        {156, 112, 77, 255, 1},
-        {115, 81, 54, 255, 1},
-        {81, 55, 35, 255, 1},
-        {86, 59, 39, 255, 5},
-        {87, 59, 39, 255, 1},
-        {85, 58, 38, 255, 1},
-        {84, 57, 37, 255, 2},
-        {80, 55, 36, 255, 1},
-        {106, 74, 50, 255, 1},
-        {127, 91, 61, 255, 1},
-        {124, 88, 59, 255, 1},
-        {124, 88, 60, 255, 1},
-        {122, 87, 59, 255, 1},
-        {121, 86, 58, 255, 2},
-        {125, 88, 59, 255, 1},
-        {99, 69, 46, 255, 1},
-        {78, 53, 34, 255, 1},
-        {81, 55, 36, 255, 1},
-        {78, 53, 34, 255, 1},
-        {104, 72, 48, 255, 1},
-        {125, 88, 59, 255, 1},
-        {121, 86, 58, 255, 2},
-        {120, 85, 57, 255, 1},
-        {118, 84, 57, 255, 1},
-        {119, 84, 57, 255, 1},
-        {118, 84, 56, 255, 1},
-        {121, 86, 58, 255, 1},
-        {124, 88, 60, 255, 1},
-        {124, 88, 59, 255, 1},
-        {118, 84, 56, 255, 1},
-        {161, 115, 79, 255, 1},
-        {195, 141, 99, 255, 1},
-        {190, 137, 96, 255, 1},
-        {206, 148, 104, 255, 1},
-        {184, 132, 93, 142, 1},
-        {200, 144, 101, 255, 1},
-        {185, 133, 93, 255, 1},
-        {193, 139, 97, 255, 1},
-        {131, 93, 63, 255, 1},
-        {81, 55, 36, 255, 1},
-        {89, 61, 40, 255, 1},
-        {84, 57, 37, 255, 1},
-        {124, 87, 59, 255, 1},
-        {156, 112, 77, 255, 1},
-        {151, 108, 74, 255, 5},
-        {153, 110, 75, 255, 1},
-        {134, 96, 65, 255, 1},
-        {119, 84, 57, 255, 1},
-        {121, 86, 58, 255, 1},
-        {119, 84, 57, 255, 1},
-        {138, 98, 67, 255, 1},
-        {153, 110, 75, 255, 1},
-        {151, 108, 74, 255, 1},
-        {156, 112, 77, 255, 1},
-        {116, 82, 55, 255, 1},
-        {84, 57, 37, 255, 1},
-        {89, 61, 40, 255, 9},
-        {86, 59, 39, 255, 1},
-        {107, 75, 50, 255, 1},
-        {124, 88, 59, 255, 1},
-        {121, 86, 58, 255, 5},
-        {124, 88, 59, 255, 1},
-        {103, 72, 48, 255, 1},
-        {86, 59, 39, 255, 1},
-        {89, 61, 40, 255, 1},
-        {86, 59, 39, 255, 1},
-        {107, 75, 50, 255, 1},
-        {124, 88, 59, 255, 1},
-        {121, 86, 58, 255, 9},
-        {116, 82, 55, 255, 1},
-        {157, 112, 77, 255, 1},
-        {190, 137, 96, 255, 1},
-        {185, 133, 93, 255, 1},
-        {200, 144, 101, 255, 1},
-        {184, 132, 93, 142, 1},
-        {200, 144, 101, 255, 1},
-        {185, 133, 93, 255, 1},
-        {193, 139, 97, 255, 1},
-        {130, 92, 62, 255, 1},
-        {78, 53, 34, 255, 1},
-        {86, 59, 39, 255, 1},
-        {81, 55, 35, 255, 1},
-        {124, 87, 59, 255, 1},
-        {159, 114, 79, 255, 1},
-        {153, 110, 75, 255, 5},
-        {156, 112, 77, 255, 1},
-        {136, 96, 63, 255, 1},
-        {120, 82, 53, 255, 1},
-        {122, 84, 54, 255, 1},
-        {120, 82, 53, 255, 1},
-        {140, 98, 66, 255, 1},
-        {156, 112, 77, 255, 1},
-        {153, 110, 75, 255, 1},
-        {159, 114, 79, 255, 1},
-        {116, 82, 55, 255, 1},
-        {81, 55, 35, 255, 1},
-        {86, 59, 39, 255, 1},
-        {87, 59, 39, 255, 1},
-        {84, 57, 37, 255, 1},
-        {81, 55, 35, 255, 1},
-        {81, 55, 36, 255, 5},
-        {78, 53, 34, 255, 1},
-        {104, 72, 48, 255, 1},
-        {125, 88, 59, 255, 1},
-        {121, 86, 58, 255, 2},
-        {118, 84, 56, 255, 1},
-        {115, 82, 55, 255, 1},
-        {116, 82, 55, 255, 1},
-        {119, 84, 56, 255, 1},
-        {96, 67, 44, 255, 1},
-        {78, 53, 34, 255, 1},
-        {81, 55, 36, 255, 1},
-        {78, 53, 34, 255, 1},
-        {104, 72, 48, 255, 1},
-        {125, 88, 59, 255, 1},
-        {121, 86, 58, 255, 2},
-        {120, 85, 57, 255, 1},
-        {118, 84, 57, 255, 1},
-        {119, 84, 57, 255, 1},
-        {118, 84, 57, 255, 1},
-        {120, 85, 57, 255, 1},
-        {121, 86, 58, 255, 2},
-        {116, 82, 55, 255, 1},
-        {159, 113, 78, 255, 1},
-        {193, 139, 98, 255, 1},
-        {188, 135, 95, 255, 1},
-        {203, 146, 103, 255, 1},
-        {184, 132, 93, 142, 1},
-        {200, 144, 101, 255, 1},
-        {185, 133, 93, 255, 1},
-        {191, 138, 96, 255, 1},
-        {141, 101, 69, 255, 1},
-        {101, 70, 47, 255, 1},
-        {107, 75, 50, 255, 1},
-        {105, 73, 49, 255, 1},
-        {122, 86, 59, 255, 1},
-        {136, 97, 66, 255, 1},
-        {134, 96, 65, 255, 5},
-        {136, 95, 63, 255, 1},
-        {123, 97, 77, 255, 1},
-        {112, 98, 87, 255, 1},
-        {114, 98, 86, 255, 1},
-        {112, 98, 87, 255, 1},
-        {125, 97, 74, 255, 1},
-        {136, 95, 63, 255, 1},
-        {134, 96, 65, 255, 1},
-        {136, 97, 66, 255, 1},
-        {119, 84, 57, 255, 1},
-        {105, 73, 49, 255, 1},
-        {107, 75, 50, 255, 1},
-        {104, 73, 48, 255, 1},
-        {127, 89, 61, 255, 1},
-        {145, 103, 71, 255, 1},
-        {143, 101, 70, 255, 5},
-        {144, 103, 71, 255, 1},
-        {130, 93, 63, 255, 1},
-        {119, 85, 57, 255, 1},
-        {121, 86, 58, 255, 1},
-        {118, 84, 56, 255, 1},
-        {141, 101, 69, 255, 1},
-        {160, 114, 79, 255, 1},
-        {157, 112, 77, 255, 1},
-        {158, 113, 78, 255, 1},
-        {149, 106, 73, 255, 1},
-        {141, 100, 69, 255, 1},
-        {143, 101, 70, 255, 1},
-        {144, 103, 71, 255, 1},
-        {130, 93, 63, 255, 1},
-        {119, 85, 57, 255, 1},
-        {121, 86, 58, 255, 1},
-        {120, 85, 57, 255, 1},
-        {130, 93, 63, 255, 1},
-        {139, 99, 68, 255, 1},
-        {138, 98, 67, 255, 1},
-        {139, 99, 68, 255, 1},
-        {128, 92, 62, 255, 1},
-        {120, 85, 57, 255, 1},
-        {121, 86, 58, 255, 1},
-        {118, 83, 56, 255, 1},
-        {146, 104, 71, 255, 1},
-        {169, 122, 84, 255, 1},
-        {166, 119, 82, 255, 1},
-        {179, 129, 89, 255, 1},
-        {184, 132, 93, 142, 1},
-        {200, 144, 101, 255, 1},
-        {185, 133, 93, 255, 1},
-        {190, 137, 96, 255, 1},
-        {150, 108, 74, 255, 1},
-        {119, 84, 57, 255, 1},
-        {124, 88, 59, 255, 1},
-        {124, 88, 60, 255, 1},
-        {121, 86, 58, 255, 1},
-        {118, 84, 56, 255, 1},
-        {119, 84, 57, 255, 5},
-        {119, 82, 52, 255, 1},
-        {112, 98, 88, 255, 1},
-        {106, 112, 116, 255, 1},
-        {107, 110, 112, 255, 1},
-        {106, 112, 116, 255, 1},
-        {113, 96, 81, 255, 1},
-        {119, 82, 52, 255, 1},
-        {119, 84, 57, 255, 1},
-        {118, 84, 56, 255, 1},
-        {121, 86, 58, 255, 1},
-        {124, 88, 60, 255, 1},
-        {124, 88, 59, 255, 1},
-        {118, 84, 56, 255, 1},
-        {163, 116, 80, 255, 1},
-        {198, 143, 101, 255, 1},
-        {193, 139, 97, 255, 5},
-        {198, 143, 101, 255, 1},
-        {152, 110, 75, 255, 1},
-        {115, 82, 55, 255, 1},
-        {121, 86, 58, 255, 1},
-        {116, 82, 55, 255, 1},
-        {160, 114, 79, 255, 1},
-        {196, 141, 99, 255, 1},
-        {190, 137, 96, 255, 2},
-        {192, 138, 97, 255, 1},
-        {193, 139, 97, 255, 2},
-        {198, 143, 101, 255, 1},
-        {152, 110, 75, 255, 1},
-        {115, 82, 55, 255, 1},
-        {121, 86, 58, 255, 1},
-        {119, 84, 57, 255, 1},
-        {139, 99, 68, 255, 1},
-        {156, 112, 76, 255, 1},
-        {153, 110, 75, 255, 1},
-        {156, 112, 76, 255, 1},
-        {135, 97, 66, 255, 1},
-        {119, 84, 57, 255, 1},
-        {121, 86, 58, 255, 1},
-        {119, 84, 57, 255, 1},
-        {136, 97, 66, 255, 1},
-        {150, 108, 73, 255, 1},
-        {148, 106, 72, 255, 1},
-        {160, 115, 78, 255, 1},
-        {184, 132, 93, 142, 1},
-        {200, 144, 101, 255, 1},
-        {185, 133, 93, 255, 1},
-        {190, 137, 96, 255, 1},
-        {149, 107, 73, 255, 1},
-        {116, 82, 55, 255, 1},
-        {121, 86, 58, 255, 9},
-        {122, 84, 54, 255, 1},
-        {114, 98, 86, 255, 1},
-        {107, 110, 112, 255, 1},
-        {108, 108, 108, 255, 1},
-        {107, 110, 112, 255, 1},
-        {115, 96, 80, 255, 1},
-        {122, 84, 54, 255, 1},
-        {121, 86, 58, 255, 5},
-        {116, 82, 55, 255, 1},
-        {157, 112, 77, 255, 1},
-        {190, 137, 96, 255, 1},
-        {185, 133, 93, 255, 5},
-        {190, 137, 96, 255, 1},
-        {149, 107, 73, 255, 1},
-        {116, 82, 55, 255, 1},
-        {121, 86, 58, 255, 1},
-        {116, 82, 55, 255, 1},
-        {157, 112, 77, 255, 1},
-        {190, 137, 96, 255, 1},
-        {185, 133, 93, 255, 5},
-        {190, 137, 96, 255, 1},
-        {149, 107, 73, 255, 1},
-        {116, 82, 55, 255, 1},
-        {121, 86, 58, 255, 1},
-        {119, 84, 57, 255, 1},
-        {138, 98, 67, 255, 1},
-        {153, 110, 75, 255, 1},
-        {151, 108, 74, 255, 1},
-        {153, 110, 75, 255, 1},
-        {134, 96, 65, 255, 1},
-        {119, 84, 57, 255, 1},
-        {121, 86, 58, 255, 1},
-        {119, 84, 57, 255, 1},
-        {138, 98, 67, 255, 1},
-        {153, 110, 75, 255, 1},
-        {151, 108, 74, 255, 1},
-        {163, 117, 80, 255, 1},
-        {190, 136, 96, 142, 1},
-        {206, 148, 104, 255, 1},
-        {190, 137, 96, 255, 1},
-        {196, 141, 99, 255, 1},
-        {151, 109, 74, 255, 1},
-        {116, 82, 55, 255, 1},
-        {121, 86, 58, 255, 2},
-        {118, 84, 56, 255, 1},
-        {115, 82, 55, 255, 1},
-        {116, 82, 55, 255, 5},
-        {117, 80, 51, 255, 1},
-        {110, 96, 86, 255, 1},
-        {104, 110, 115, 255, 1},
-        {105, 108, 111, 255, 1},
-        {104, 110, 115, 255, 1},
-        {112, 95, 80, 255, 1},
-        {120, 82, 52, 255, 1},
-        {119, 84, 57, 255, 1},
-        {118, 84, 56, 255, 1},
-        {121, 86, 58, 255, 1},
-        {124, 88, 60, 255, 1},
-        {124, 88, 59, 255, 1},
-        {118, 84, 56, 255, 1},
-        {161, 115, 79, 255, 1},
-        {195, 141, 99, 255, 1},
-        {190, 137, 96, 255, 2},
-        {189, 136, 95, 255, 1},
-        {188, 135, 94, 255, 1},
-        {188, 135, 95, 255, 1},
-        {193, 139, 98, 255, 1},
-        {152, 109, 75, 255, 1},
-        {119, 84, 56, 255, 1},
-        {124, 88, 59, 255, 1},
-        {119, 84, 56, 255, 1},
-        {160, 114, 79, 255, 1},
-        {193, 139, 98, 255, 1},
-        {188, 135, 95, 255, 1},
-        {188, 135, 94, 255, 1},
-        {189, 136, 95, 255, 1},
-        {190, 137, 96, 255, 2},
-        {196, 141, 99, 255, 1},
-        {151, 109, 74, 255, 1},
-        {116, 82, 55, 255, 1},
-        {121, 86, 58, 255, 1},
-        {119, 84, 57, 255, 1},
-        {139, 97, 64, 255, 1},
-        {154, 108, 70, 255, 1},
-        {152, 106, 69, 255, 1},
-        {154, 108, 70, 255, 1},
-        {133, 94, 62, 255, 1},
-        {116, 82, 56, 255, 1},
-        {119, 84, 57, 255, 1},
-        {116, 82, 56, 255, 1},
-        {137, 97, 66, 255, 1},
-        {153, 110, 75, 255, 1},
-        {151, 108, 74, 255, 1},
-        {163, 117, 80, 255, 1},
-        {149, 105, 73, 142, 1},
-        {161, 116, 80, 255, 1},
-        {149, 107, 73, 255, 1},
-        {151, 109, 75, 255, 1},
-        {133, 95, 65, 255, 1},
-        {119, 84, 57, 255, 1},
-        {121, 86, 58, 255, 1},
-        {118, 84, 56, 255, 1},
-        {141, 101, 69, 255, 1},
-        {160, 114, 79, 255, 1},
-        {157, 112, 77, 255, 5},
-        {159, 112, 77, 255, 1},
-        {143, 110, 84, 255, 1},
-        {130, 108, 90, 255, 1},
-        {132, 108, 89, 255, 1},
-        {131, 109, 91, 255, 1},
-        {135, 103, 77, 255, 1},
-        {138, 97, 65, 255, 1},
-        {138, 98, 67, 255, 1},
-        {140, 100, 69, 255, 1},
-        {118, 84, 56, 255, 1},
-        {100, 70, 46, 255, 1},
-        {103, 72, 48, 255, 1},
-        {99, 69, 46, 255, 1},
-        {129, 91, 62, 255, 1},
-        {153, 110, 75, 255, 1},
-        {149, 107, 73, 255, 1},
-        {148, 106, 73, 255, 1},
-        {159, 114, 78, 255, 1},
-        {167, 120, 83, 255, 1},
-        {166, 119, 82, 255, 1},
-        {171, 123, 85, 255, 1},
-        {131, 93, 63, 255, 1},
-        {98, 68, 45, 255, 1},
-        {103, 72, 48, 255, 1},
-        {98, 68, 45, 255, 1},
-        {138, 98, 67, 255, 1},
-        {171, 123, 85, 255, 1},
-        {166, 119, 82, 255, 1},
-        {167, 120, 83, 255, 1},
-        {156, 112, 77, 255, 1},
-        {148, 106, 73, 255, 1},
-        {149, 107, 73, 255, 1},
-        {151, 109, 75, 255, 1},
-        {133, 95, 65, 255, 1},
-        {119, 84, 57, 255, 1},
-        {121, 86, 58, 255, 1},
-        {119, 83, 54, 255, 1},
-        {133, 106, 86, 255, 1},
-        {144, 126, 112, 255, 1},
-        {142, 123, 108, 255, 1},
-        {142, 125, 111, 255, 1},
-        {139, 109, 85, 255, 1},
-        {137, 96, 64, 255, 1},
-        {138, 98, 67, 255, 1},
-        {137, 97, 66, 255, 1},
-        {145, 104, 71, 255, 1},
-        {152, 109, 74, 255, 1},
-        {151, 108, 74, 255, 1},
-        {163, 117, 80, 255, 1},
-        {116, 82, 53, 142, 1},
-        {125, 89, 60, 255, 1},
-        {116, 82, 55, 255, 1},
-        {115, 82, 55, 255, 1},
-        {119, 84, 57, 255, 1},
-        {121, 86, 58, 255, 2},
-        {116, 82, 55, 255, 1},
-        {160, 114, 79, 255, 1},
-        {196, 141, 99, 255, 1},
-        {190, 137, 96, 255, 5},
-        {193, 139, 98, 255, 1},
-        {170, 121, 82, 255, 1},
-        {151, 106, 69, 255, 1},
-        {154, 108, 71, 255, 2},
-        {154, 109, 74, 255, 1},
-        {153, 110, 76, 255, 1},
-        {153, 110, 75, 255, 1},
-        {159, 114, 79, 255, 1},
-        {116, 82, 55, 255, 1},
-        {81, 55, 35, 255, 1},
-        {86, 59, 39, 255, 1},
-        {84, 57, 38, 255, 1},
-        {103, 72, 48, 255, 1},
-        {119, 84, 56, 255, 1},
-        {116, 82, 55, 255, 1},
-        {114, 80, 54, 255, 1},
-        {134, 95, 65, 255, 1},
-        {150, 108, 74, 255, 1},
-        {148, 106, 72, 255, 1},
-        {153, 110, 75, 255, 1},
-        {113, 80, 54, 255, 1},
-        {81, 55, 36, 255, 1},
-        {86, 59, 39, 255, 1},
-        {81, 55, 36, 255, 1},
-        {121, 85, 58, 255, 1},
-        {153, 110, 75, 255, 1},
-        {148, 106, 72, 255, 1},
-        {150, 108, 74, 255, 1},
-        {130, 93, 63, 255, 1},
-        {114, 80, 54, 255, 1},
-        {116, 82, 55, 255, 1},
-        {115, 82, 55, 255, 1},
-        {119, 84, 57, 255, 1},
-        {121, 86, 58, 255, 2},
-        {120, 82, 52, 255, 1},
-        {128, 114, 104, 255, 1},
-        {135, 141, 146, 255, 1},
-        {134, 137, 140, 255, 1},
-        {133, 139, 145, 255, 1},
-        {145, 122, 104, 255, 1},
-        {155, 108, 70, 255, 1},
-        {153, 110, 75, 255, 1},
-        {154, 110, 75, 255, 1},
-        {152, 109, 75, 255, 1},
-        {151, 108, 74, 255, 2},
-        {163, 117, 80, 255, 1},
-        {122, 86, 57, 142, 1},
-        {131, 93, 63, 255, 1},
-        {121, 86, 58, 255, 5},
-        {116, 82, 55, 255, 1},
-        {157, 112, 77, 255, 1},
-        {190, 137, 96, 255, 1},
-        {185, 133, 93, 255, 5},
-        {188, 135, 95, 255, 1},
-        {166, 119, 82, 255, 1},
-        {148, 106, 72, 255, 1},
-        {151, 108, 74, 255, 5},
-        {156, 112, 77, 255, 1},
-        {116, 82, 55, 255, 1},
-        {84, 57, 37, 255, 1},
-        {89, 61, 40, 255, 1},
-        {86, 59, 39, 255, 1},
-        {107, 75, 50, 255, 1},
-        {124, 88, 59, 255, 1},
-        {121, 86, 58, 255, 1},
-        {119, 84, 57, 255, 1},
-        {138, 98, 67, 255, 1},
-        {153, 110, 75, 255, 1},
-        {151, 108, 74, 255, 1},
-        {156, 112, 77, 255, 1},
-        {116, 82, 55, 255, 1},
-        {84, 57, 37, 255, 1},
-        {89, 61, 40, 255, 1},
-        {84, 57, 37, 255, 1},
-        {124, 87, 59, 255, 1},
-        {156, 112, 77, 255, 1},
-        {151, 108, 74, 255, 1},
-        {153, 110, 75, 255, 1},
-        {134, 96, 65, 255, 1},
-        {119, 84, 57, 255, 1},
-        {121, 86, 58, 255, 5},
-        {120, 82, 52, 255, 1},
-        {129, 113, 101, 255, 1},
-        {136, 139, 141, 255, 1},
-        {135, 135, 135, 255, 1},
-        {134, 137, 140, 255, 1},
-        {144, 120, 101, 255, 1},
-        {152, 106, 69, 255, 1},
-        {151, 108, 74, 255, 5},
-        {163, 117, 80, 255, 1},
-        {120, 84, 55, 142, 1},
-        {128, 91, 62, 255, 1},
-        {119, 84, 57, 255, 1},
-        {118, 84, 57, 255, 1},
-        {120, 85, 57, 255, 1},
-        {121, 86, 58, 255, 2},
-        {116, 82, 55, 255, 1},
-        {160, 114, 79, 255, 1},
-        {196, 141, 99, 255, 1},
-        {190, 137, 96, 255, 2},
-        {189, 136, 95, 255, 1},
-        {188, 135, 94, 255, 1},
-        {188, 135, 95, 255, 1},
-        {191, 137, 97, 255, 1},
-        {169, 121, 83, 255, 1},
-        {150, 108, 73, 255, 1},
-        {153, 110, 75, 255, 1},
-        {154, 110, 75, 255, 1},
-        {152, 109, 75, 255, 1},
-        {151, 108, 74, 255, 2},
-        {156, 112, 77, 255, 1},
-        {116, 82, 55, 255, 1},
-        {84, 57, 37, 255, 1},
-        {89, 61, 40, 255, 1},
-        {86, 59, 39, 255, 1},
-        {108, 76, 51, 255, 1},
-        {127, 90, 61, 255, 1},
-        {124, 88, 59, 255, 1},
-        {122, 86, 58, 255, 1},
-        {140, 100, 68, 255, 1},
-        {155, 112, 76, 255, 1},
-        {153, 110, 75, 255, 1},
-        {159, 114, 79, 255, 1},
-        {114, 81, 54, 255, 1},
-        {78, 53, 34, 255, 1},
-        {84, 57, 37, 255, 1},
-        {78, 53, 34, 255, 1},
-        {123, 86, 59, 255, 1},
-        {159, 114, 79, 255, 1},
-        {153, 110, 75, 255, 1},
-        {156, 112, 76, 255, 1},
-        {135, 97, 66, 255, 1},
-        {119, 84, 57, 255, 1},
-        {121, 86, 58, 255, 2},
-        {120, 85, 57, 255, 1},
-        {118, 84, 57, 255, 1},
-        {119, 84, 57, 255, 1},
-        {117, 80, 50, 255, 1},
-        {127, 113, 103, 255, 1},
-        {135, 141, 146, 255, 1},
-        {134, 137, 140, 255, 1},
-        {132, 139, 145, 255, 1},
-        {146, 123, 105, 255, 1},
-        {157, 110, 72, 255, 1},
-        {156, 112, 77, 255, 2},
-        {155, 111, 76, 255, 1},
-        {153, 110, 75, 255, 2},
-        {166, 119, 81, 255, 1},
-        {138, 98, 66, 142, 1},
-        {149, 106, 73, 255, 1},
-        {138, 98, 67, 255, 1},
-        {139, 99, 68, 255, 1},
-        {128, 92, 62, 255, 1},
-        {120, 85, 57, 255, 1},
-        {121, 86, 58, 255, 1},
-        {119, 84, 57, 255, 1},
-        {137, 97, 66, 255, 1},
-        {151, 109, 75, 255, 1},
-        {149, 107, 73, 255, 1},
-        {148, 106, 73, 255, 1},
-        {159, 114, 78, 255, 1},
-        {167, 120, 83, 255, 1},
-        {166, 119, 82, 255, 1},
-        {168, 121, 84, 255, 1},
-        {148, 106, 72, 255, 1},
-        {132, 94, 64, 255, 1},
-        {134, 96, 65, 255, 1},
-        {133, 94, 64, 255, 1},
-        {144, 102, 70, 255, 1},
-        {152, 109, 75, 255, 1},
-        {151, 108, 74, 255, 1},
-        {156, 112, 77, 255, 1},
-        {116, 82, 55, 255, 1},
-        {84, 57, 37, 255, 1},
-        {89, 61, 40, 255, 1},
-        {88, 60, 39, 255, 1},
-        {97, 67, 44, 255, 1},
-        {105, 73, 49, 255, 1},
-        {103, 72, 48, 255, 1},
-        {101, 70, 47, 255, 1},
-        {121, 85, 58, 255, 1},
-        {137, 98, 66, 255, 1},
-        {134, 96, 65, 255, 1},
-        {135, 96, 66, 255, 1},
-        {128, 91, 62, 255, 1},
-        {123, 87, 58, 255, 1},
-        {124, 87, 59, 255, 1},
-        {123, 87, 58, 255, 1},
-        {129, 92, 62, 255, 1},
-        {135, 96, 66, 255, 1},
-        {134, 96, 65, 255, 1},
-        {135, 96, 66, 255, 1},
-        {127, 90, 61, 255, 1},
-        {120, 85, 58, 255, 1},
-        {121, 86, 58, 255, 1},
-        {120, 85, 57, 255, 1},
-        {130, 93, 63, 255, 1},
-        {139, 99, 68, 255, 1},
-        {138, 98, 67, 255, 1},
-        {137, 96, 64, 255, 1},
-        {141, 110, 86, 255, 1},
-        {144, 122, 104, 255, 1},
-        {144, 120, 101, 255, 1},
-        {146, 123, 105, 255, 1},
-        {128, 99, 75, 255, 1},
-        {114, 79, 51, 255, 1},
-        {116, 82, 55, 255, 1},
-        {115, 81, 54, 255, 1},
-        {126, 89, 61, 255, 1},
-        {136, 97, 66, 255, 1},
-        {134, 96, 65, 255, 1},
-        {145, 103, 70, 255, 1},
-        {152, 109, 75, 142, 1},
-        {166, 119, 81, 255, 1},
-        {153, 110, 75, 255, 1},
-        {156, 112, 76, 255, 1},
-        {135, 97, 66, 255, 1},
-        {119, 84, 57, 255, 1},
-        {121, 86, 58, 255, 2},
-        {118, 84, 56, 255, 1},
-        {115, 82, 55, 255, 1},
-        {116, 82, 55, 255, 1},
-        {114, 80, 54, 255, 1},
-        {134, 95, 65, 255, 1},
-        {150, 108, 74, 255, 1},
-        {148, 106, 72, 255, 1},
-        {150, 108, 73, 255, 1},
-        {131, 94, 64, 255, 1},
-        {117, 82, 56, 255, 1},
-        {119, 84, 57, 255, 1},
-        {116, 82, 56, 255, 1},
-        {137, 97, 66, 255, 1},
-        {153, 110, 75, 255, 1},
-        {151, 108, 74, 255, 1},
-        {156, 112, 77, 255, 1},
-        {116, 82, 55, 255, 1},
-        {84, 57, 37, 255, 1},
-        {89, 61, 40, 255, 2},
-        {88, 60, 39, 255, 1},
-        {86, 59, 38, 255, 1},
-        {86, 59, 39, 255, 1},
-        {83, 57, 38, 255, 1},
-        {104, 73, 49, 255, 1},
-        {122, 86, 58, 255, 1},
-        {119, 84, 57, 255, 1},
-        {116, 82, 55, 255, 1},
-        {140, 99, 68, 255, 1},
-        {159, 114, 78, 255, 1},
-        {156, 112, 77, 255, 1},
-        {159, 114, 78, 255, 1},
-        {135, 97, 65, 255, 1},
-        {116, 82, 55, 255, 1},
-        {119, 84, 57, 255, 1},
-        {118, 84, 57, 255, 1},
-        {120, 85, 57, 255, 1},
-        {121, 86, 58, 255, 2},
-        {119, 84, 57, 255, 1},
-        {139, 99, 68, 255, 1},
-        {156, 112, 76, 255, 1},
-        {153, 110, 75, 255, 1},
-        {154, 110, 76, 255, 1},
-        {153, 108, 72, 255, 1},
-        {152, 105, 69, 255, 1},
-        {152, 106, 69, 255, 1},
-        {158, 110, 72, 255, 1},
-        {114, 79, 51, 255, 1},
-        {78, 53, 34, 255, 1},
-        {84, 57, 37, 255, 1},
-        {81, 55, 36, 255, 1},
-        {103, 72, 48, 255, 1},
-        {122, 86, 58, 255, 1},
-        {119, 84, 57, 255, 1},
-        {128, 91, 62, 255, 1},
-        {150, 107, 73, 142, 1},
-        {163, 117, 80, 255, 1},
-        {151, 108, 74, 255, 1},
-        {153, 110, 75, 255, 1},
-        {134, 96, 65, 255, 1},
-        {119, 84, 57, 255, 1},
-        {121, 86, 58, 255, 5},
-        {119, 84, 57, 255, 1},
-        {138, 98, 67, 255, 1},
-        {153, 110, 75, 255, 1},
-        {151, 108, 74, 255, 1},
-        {153, 110, 75, 255, 1},
-        {134, 96, 65, 255, 1},
-        {119, 84, 57, 255, 1},
-        {121, 86, 58, 255, 1},
-        {119, 84, 57, 255, 1},
-        {138, 98, 67, 255, 1},
-        {153, 110, 75, 255, 1},
-        {151, 108, 74, 255, 1},
-        {156, 112, 77, 255, 1},
-        {116, 82, 55, 255, 1},
-        {84, 57, 37, 255, 1},
-        {89, 61, 40, 255, 5},
-        {86, 59, 39, 255, 1},
-        {107, 75, 50, 255, 1},
-        {124, 88, 59, 255, 1},
-        {121, 86, 58, 255, 1},
-        {119, 84, 57, 255, 1},
-        {138, 98, 67, 255, 1},
-        {153, 110, 75, 255, 1},
-        {151, 108, 74, 255, 1},
-        {153, 110, 75, 255, 1},
-        {134, 96, 65, 255, 1},
-        {119, 84, 57, 255, 1},
-        {121, 86, 58, 255, 5},
-        {119, 84, 57, 255, 1},
-        {138, 98, 67, 255, 1},
-        {153, 110, 75, 255, 1},
-        {151, 108, 74, 255, 5},
-        {156, 112, 77, 255, 1},
-        {116, 82, 55, 255, 1},
-        {84, 57, 37, 255, 1},
-        {89, 61, 40, 255, 1},
-        {86, 59, 39, 255, 1},
-        {107, 75, 50, 255, 1},
-        {124, 88, 59, 255, 1},
-        {121, 86, 58, 255, 1},
-        {131, 93, 63, 255, 1},
-        {152, 109, 75, 142, 1},
-        {166, 119, 81, 255, 1},
-        {153, 110, 75, 255, 1},
-        {156, 112, 77, 255, 1},
-        {134, 96, 65, 255, 1},
-        {116, 82, 55, 255, 1},
-        {119, 84, 57, 255, 1},
-        {118, 84, 56, 255, 1},
-        {121, 86, 58, 255, 1},
-        {124, 88, 60, 255, 1},
-        {124, 88, 59, 255, 1},
-        {122, 86, 58, 255, 1},
-        {140, 100, 68, 255, 1},
-        {155, 112, 76, 255, 1},
-        {153, 110, 75, 255, 1},
-        {156, 112, 76, 255, 1},
-        {135, 97, 66, 255, 1},
-        {119, 84, 57, 255, 1},
-        {121, 86, 58, 255, 1},
-        {119, 84, 57, 255, 1},
-        {141, 100, 69, 255, 1},
-        {158, 114, 78, 255, 1},
-        {156, 112, 77, 255, 1},
-        {161, 116, 80, 255, 1},
-        {118, 84, 56, 255, 1},
-        {84, 57, 37, 255, 1},
-        {89, 61, 40, 255, 2},
-        {88, 60, 39, 255, 1},
-        {86, 59, 38, 255, 1},
-        {86, 59, 39, 255, 1},
-        {83, 57, 37, 255, 1},
-        {106, 74, 49, 255, 1},
-        {124, 88, 59, 255, 1},
-        {121, 86, 58, 255, 1},
-        {119, 84, 57, 255, 1},
-        {138, 98, 67, 255, 1},
-        {153, 110, 75, 255, 1},
-        {151, 108, 74, 255, 1},
-        {153, 110, 75, 255, 1},
-        {134, 96, 65, 255, 1},
-        {119, 84, 57, 255, 1},
-        {121, 86, 58, 255, 2},
-        {122, 87, 59, 255, 1},
-        {124, 88, 60, 255, 1},
-        {124, 88, 59, 255, 1},
-        {122, 86, 59, 255, 1},
-        {138, 98, 67, 255, 1},
-        {150, 108, 73, 255, 1},
-        {148, 106, 72, 255, 5},
-        {153, 110, 75, 255, 1},
-        {113, 80, 54, 255, 1},
-        {81, 55, 36, 255, 1},
-        {86, 59, 39, 255, 1},
-        {83, 57, 38, 255, 1},
-        {104, 73, 49, 255, 1},
-        {122, 86, 58, 255, 1},
-        {119, 84, 57, 255, 1},
-        {128, 91, 62, 255, 1},
-        {134, 95, 64, 142, 1},
-        {145, 103, 70, 255, 1},
-        {134, 96, 65, 255, 1},
-        {134, 95, 65, 255, 1},
-        {136, 97, 66, 255, 1},
-        {138, 98, 67, 255, 2},
-        {140, 100, 69, 255, 1},
-        {118, 84, 56, 255, 1},
-        {100, 70, 46, 255, 1},
-        {103, 72, 48, 255, 1},
-        {101, 70, 47, 255, 1},
-        {121, 85, 58, 255, 1},
-        {137, 98, 66, 255, 1},
-        {134, 96, 65, 255, 1},
-        {135, 96, 66, 255, 1},
-        {127, 90, 61, 255, 1},
-        {120, 85, 58, 255, 1},
-        {121, 86, 58, 255, 1},
-        {122, 86, 58, 255, 1},
-        {118, 83, 56, 255, 1},
-        {116, 82, 55, 255, 2},
-        {119, 84, 56, 255, 1},
-        {101, 70, 47, 255, 1},
-        {87, 59, 39, 255, 1},
-        {89, 61, 40, 255, 1},
-        {87, 60, 39, 255, 1},
-        {99, 69, 46, 255, 1},
-        {109, 76, 51, 255, 1},
-        {107, 75, 50, 255, 1},
-        {106, 74, 49, 255, 1},
-        {115, 81, 54, 255, 1},
-        {122, 87, 59, 255, 1},
-        {121, 86, 58, 255, 1},
-        {119, 84, 57, 255, 1},
-        {138, 98, 67, 255, 1},
-        {153, 110, 75, 255, 1},
-        {151, 108, 74, 255, 1},
-        {153, 110, 75, 255, 1},
-        {134, 96, 65, 255, 1},
-        {119, 84, 57, 255, 1},
-        {121, 86, 58, 255, 1},
-        {123, 87, 59, 255, 1},
-        {111, 78, 52, 255, 1},
-        {102, 71, 47, 255, 1},
-        {103, 72, 48, 255, 1},
-        {98, 68, 45, 255, 1},
-        {141, 100, 69, 255, 1},
-        {175, 126, 87, 255, 1},
-        {170, 122, 85, 255, 5},
-        {175, 126, 88, 255, 1},
-        {135, 96, 65, 255, 1},
-        {102, 71, 47, 255, 1},
-        {107, 75, 50, 255, 1},
-        {105, 73, 49, 255, 1},
-        {124, 88, 60, 255, 1},
-        {140, 100, 68, 255, 1},
-        {138, 98, 67, 255, 1},
-        {149, 106, 73, 255, 1},
-        {120, 84, 55, 142, 1},
-        {128, 91, 62, 255, 1},
-        {119, 84, 57, 255, 1},
-        {116, 82, 55, 255, 1},
-        {138, 98, 67, 255, 1},
-        {156, 112, 77, 255, 1},
-        {153, 110, 75, 255, 1},
-        {159, 114, 79, 255, 1},
-        {116, 82, 55, 255, 1},
-        {81, 55, 35, 255, 1},
-        {86, 59, 39, 255, 1},
-        {83, 57, 38, 255, 1},
-        {104, 73, 49, 255, 1},
-        {122, 86, 58, 255, 1},
-        {119, 84, 57, 255, 1},
-        {118, 84, 57, 255, 1},
-        {120, 85, 57, 255, 1},
-        {121, 86, 58, 255, 2},
-        {124, 88, 59, 255, 1},
-        {100, 70, 46, 255, 1},
-        {81, 55, 36, 255, 1},
-        {84, 57, 37, 255, 2},
-        {87, 59, 39, 255, 1},
-        {89, 61, 40, 255, 2},
-        {86, 59, 39, 255, 1},
-        {108, 76, 51, 255, 1},
-        {127, 90, 61, 255, 1},
-        {124, 88, 59, 255, 1},
-        {124, 88, 60, 255, 1},
-        {122, 87, 59, 255, 1},
-        {121, 86, 58, 255, 2},
-        {119, 84, 57, 255, 1},
-        {138, 98, 67, 255, 1},
-        {153, 110, 75, 255, 1},
-        {151, 108, 74, 255, 1},
-        {153, 110, 75, 255, 1},
-        {134, 96, 65, 255, 1},
-        {119, 84, 57, 255, 1},
-        {121, 86, 58, 255, 1},
-        {124, 88, 59, 255, 1},
-        {102, 71, 47, 255, 1},
-        {83, 57, 37, 255, 1},
-        {86, 59, 39, 255, 1},
-        {78, 53, 34, 255, 1},
-        {143, 101, 70, 255, 1},
-        {196, 141, 99, 255, 1},
-        {188, 135, 95, 255, 5},
-        {193, 139, 98, 255, 1},
-        {152, 109, 74, 255, 1},
-        {119, 84, 56, 255, 1},
-        {124, 88, 59, 255, 1},
-        {122, 86, 58, 255, 1},
-        {141, 100, 68, 255, 1},
-        {155, 112, 76, 255, 1},
-        {153, 110, 75, 255, 1},
-        {166, 119, 81, 255, 1},
-        {122, 86, 57, 142, 1},
-        {131, 93, 63, 255, 1},
-        {121, 86, 58, 255, 1},
-        {119, 84, 57, 255, 1},
-        {138, 98, 67, 255, 1},
-        {153, 110, 75, 255, 1},
-        {151, 108, 74, 255, 1},
-        {156, 112, 77, 255, 1},
-        {116, 82, 55, 255, 1},
-        {84, 57, 37, 255, 1},
-        {89, 61, 40, 255, 1},
-        {86, 59, 39, 255, 1},
-        {107, 75, 50, 255, 1},
-        {124, 88, 59, 255, 1},
-        {121, 86, 58, 255, 5},
-        {124, 88, 59, 255, 1},
-        {103, 72, 48, 255, 1},
-        {86, 59, 39, 255, 1},
-        {89, 61, 40, 255, 5},
-        {86, 59, 39, 255, 1},
-        {107, 75, 50, 255, 1},
-        {124, 88, 59, 255, 1},
-        {121, 86, 58, 255, 5},
-        {119, 84, 57, 255, 1},
-        {138, 98, 67, 255, 1},
-        {153, 110, 75, 255, 1},
-        {151, 108, 74, 255, 1},
-        {153, 110, 75, 255, 1},
-        {134, 96, 65, 255, 1},
-        {119, 84, 57, 255, 1},
-        {121, 86, 58, 255, 1},
-        {124, 88, 59, 255, 1},
-        {103, 72, 48, 255, 1},
-        {86, 59, 39, 255, 1},
-        {89, 61, 40, 255, 1},
-        {81, 55, 36, 255, 1},
-        {143, 101, 70, 255, 1},
-        {193, 139, 97, 255, 1},
-        {185, 133, 93, 255, 5},
-        {190, 137, 96, 255, 1},
-        {149, 107, 73, 255, 1},
-        {116, 82, 55, 255, 1},
-        {121, 86, 58, 255, 1},
-        {119, 84, 57, 255, 1},
-        {138, 98, 67, 255, 1},
-        {153, 110, 75, 255, 1},
-        {151, 108, 74, 255, 1},
-        {163, 117, 80, 255, 1},
-        {122, 86, 57, 142, 1},
-        {131, 93, 63, 255, 1},
-        {121, 86, 58, 255, 1},
-        {119, 84, 57, 255, 1},
-        {138, 98, 67, 255, 1},
-        {153, 110, 75, 255, 1},
-        {151, 108, 74, 255, 1},
-        {156, 112, 77, 255, 1},
-        {115, 81, 54, 255, 1},
-        {81, 55, 35, 255, 1},
-        {86, 59, 39, 255, 1},
-        {84, 57, 38, 255, 1},
-        {103, 72, 48, 255, 1},
-        {119, 84, 56, 255, 1},
-        {116, 82, 55, 255, 1},
-        {115, 82, 55, 255, 1},
-        {119, 84, 57, 255, 1},
-        {121, 86, 58, 255, 2},
-        {124, 88, 59, 255, 1},
-        {100, 70, 46, 255, 1},
-        {81, 55, 36, 255, 1},
-        {84, 57, 37, 255, 2},
-        {82, 56, 36, 255, 1},
-        {81, 55, 35, 255, 1},
-        {81, 55, 36, 255, 1},
-        {78, 53, 34, 255, 1},
-        {102, 71, 47, 255, 1},
-        {122, 87, 58, 255, 1},
-        {119, 84, 57, 255, 1},
-        {118, 84, 56, 255, 1},
-        {121, 86, 58, 255, 1},
-        {124, 88, 60, 255, 1},
-        {124, 88, 59, 255, 1},
-        {122, 86, 59, 255, 1},
-        {138, 98, 67, 255, 1},
-        {150, 108, 73, 255, 1},
-        {148, 106, 72, 255, 1},
-        {150, 108, 74, 255, 1},
-        {130, 93, 63, 255, 1},
-        {114, 80, 54, 255, 1},
-        {116, 82, 55, 255, 1},
-        {118, 84, 56, 255, 1},
-        {101, 70, 47, 255, 1},
-        {86, 59, 39, 255, 1},
-        {89, 61, 40, 255, 1},
-        {81, 55, 36, 255, 1},
-        {145, 102, 71, 255, 1},
-        {196, 141, 99, 255, 1},
-        {188, 135, 95, 255, 5},
-        {193, 140, 98, 255, 1},
-        {149, 106, 70, 255, 1},
-        {114, 78, 48, 255, 1},
-        {120, 82, 52, 255, 1},
-        {117, 80, 50, 255, 1},
-        {139, 97, 65, 255, 1},
-        {156, 112, 77, 255, 1},
-        {153, 110, 75, 255, 1},
-        {166, 119, 81, 255, 1},
-        {122, 86, 57, 142, 1},
-        {131, 93, 63, 255, 1},
-        {121, 86, 58, 255, 1},
-        {119, 84, 57, 255, 1},
-        {138, 98, 67, 255, 1},
-        {153, 110, 75, 255, 1},
-        {151, 108, 74, 255, 1},
-        {154, 111, 76, 255, 1},
-        {126, 90, 61, 255, 1},
-        {104, 72, 48, 255, 1},
-        {107, 75, 50, 255, 1},
-        {103, 72, 48, 255, 1},
-        {135, 96, 65, 255, 1},
-        {161, 115, 80, 255, 1},
-        {157, 112, 77, 255, 1},
-        {160, 114, 79, 255, 1},
-        {137, 98, 66, 255, 1},
-        {118, 84, 56, 255, 1},
-        {121, 86, 58, 255, 2},
-        {123, 87, 59, 255, 1},
-        {124, 87, 59, 255, 2},
-        {122, 86, 58, 255, 1},
-        {134, 95, 65, 255, 1},
-        {144, 102, 71, 255, 1},
-        {143, 101, 70, 255, 2},
-        {140, 100, 68, 255, 1},
-        {137, 98, 66, 255, 1},
-        {138, 98, 67, 255, 1},
-        {140, 100, 69, 255, 1},
-        {118, 84, 56, 255, 1},
-        {100, 70, 46, 255, 1},
-        {103, 72, 48, 255, 1},
-        {98, 68, 45, 255, 1},
-        {141, 100, 69, 255, 1},
-        {175, 126, 87, 255, 1},
-        {170, 122, 85, 255, 1},
-        {171, 123, 85, 255, 1},
-        {162, 117, 81, 255, 1},
-        {156, 111, 77, 255, 1},
-        {157, 112, 77, 255, 1},
-        {163, 116, 80, 255, 1},
-        {119, 84, 56, 255, 1},
-        {83, 57, 37, 255, 1},
-        {89, 61, 40, 255, 1},
-        {83, 56, 37, 255, 1},
-        {132, 93, 64, 255, 1},
-        {172, 124, 86, 255, 1},
-        {166, 119, 82, 255, 5},
-        {169, 120, 81, 255, 1},
-        {145, 116, 93, 255, 1},
-        {126, 113, 102, 255, 1},
-        {129, 113, 101, 255, 1},
-        {129, 115, 104, 255, 1},
-        {132, 103, 81, 255, 1},
-        {134, 94, 62, 255, 1},
-        {134, 96, 65, 255, 1},
-        {145, 103, 70, 255, 1},
-        {122, 86, 57, 142, 1},
-        {131, 93, 63, 255, 1},
-        {121, 86, 58, 255, 1},
-        {119, 84, 57, 255, 1},
-        {138, 98, 67, 255, 1},
-        {153, 110, 75, 255, 1},
-        {151, 108, 74, 255, 1},
-        {153, 110, 75, 255, 1},
-        {135, 97, 66, 255, 1},
-        {122, 86, 59, 255, 1},
-        {124, 88, 59, 255, 1},
-        {118, 84, 56, 255, 1},
-        {161, 115, 79, 255, 1},
-        {195, 141, 99, 255, 1},
-        {190, 137, 96, 255, 1},
-        {196, 141, 99, 255, 1},
-        {151, 109, 74, 255, 1},
-        {116, 82, 55, 255, 1},
-        {121, 86, 58, 255, 1},
-        {119, 84, 57, 255, 1},
-        {141, 100, 69, 255, 1},
-        {158, 114, 78, 255, 1},
-        {156, 112, 77, 255, 1},
-        {153, 110, 75, 255, 1},
-        {177, 127, 89, 255, 1},
-        {196, 141, 100, 255, 1},
-        {193, 139, 97, 255, 1},
-        {196, 141, 100, 255, 1},
-        {171, 123, 85, 255, 1},
-        {150, 107, 73, 255, 1},
-        {153, 110, 75, 255, 1},
-        {159, 114, 79, 255, 1},
-        {116, 82, 55, 255, 1},
-        {81, 55, 35, 255, 1},
-        {86, 59, 39, 255, 1},
-        {78, 53, 34, 255, 1},
-        {143, 101, 70, 255, 1},
-        {196, 141, 99, 255, 1},
-        {188, 135, 95, 255, 1},
-        {188, 135, 94, 255, 1},
-        {189, 136, 95, 255, 1},
-        {190, 137, 96, 255, 2},
-        {199, 143, 100, 255, 1},
-        {133, 95, 64, 255, 1},
-        {81, 55, 36, 255, 1},
-        {89, 61, 40, 255, 1},
-        {84, 57, 37, 255, 1},
-        {122, 86, 58, 255, 1},
-        {153, 110, 75, 255, 1},
-        {148, 106, 72, 255, 5},
-        {149, 103, 67, 255, 1},
-        {141, 124, 111, 255, 1},
-        {136, 141, 147, 255, 1},
-        {136, 139, 141, 255, 1},
-        {137, 143, 148, 255, 1},
-        {126, 109, 94, 255, 1},
-        {117, 80, 50, 255, 1},
-        {119, 84, 57, 255, 1},
-        {128, 91, 62, 255, 1},
-        {122, 86, 57, 142, 1},
-        {131, 93, 63, 255, 1},
-        {121, 86, 58, 255, 1},
-        {119, 84, 57, 255, 1},
-        {138, 98, 67, 255, 1},
-        {153, 110, 75, 255, 1},
-        {151, 108, 74, 255, 1},
-        {153, 110, 75, 255, 1},
-        {134, 96, 65, 255, 1},
-        {119, 84, 57, 255, 1},
-        {121, 86, 58, 255, 1},
-        {116, 82, 55, 255, 1},
-        {157, 112, 77, 255, 1},
-        {190, 137, 96, 255, 1},
-        {185, 133, 93, 255, 1},
-        {190, 137, 96, 255, 1},
-        {149, 107, 73, 255, 1},
-        {116, 82, 55, 255, 1},
-        {121, 86, 58, 255, 1},
-        {119, 84, 57, 255, 1},
-        {138, 98, 67, 255, 1},
-        {153, 110, 75, 255, 1},
-        {151, 108, 74, 255, 1},
-        {148, 106, 72, 255, 1},
-        {170, 122, 85, 255, 1},
-        {188, 135, 95, 255, 1},
-        {185, 133, 93, 255, 1},
-        {188, 135, 95, 255, 1},
-        {166, 119, 82, 255, 1},
-        {148, 106, 72, 255, 1},
-        {151, 108, 74, 255, 1},
-        {156, 112, 77, 255, 1},
-        {116, 82, 55, 255, 1},
-        {84, 57, 37, 255, 1},
-        {89, 61, 40, 255, 1},
-        {81, 55, 36, 255, 1},
-        {143, 101, 70, 255, 1},
-        {193, 139, 97, 255, 1},
-        {185, 133, 93, 255, 5},
-        {193, 139, 97, 255, 1},
-        {131, 93, 63, 255, 1},
-        {81, 55, 36, 255, 1},
-        {89, 61, 40, 255, 1},
-        {84, 57, 37, 255, 1},
-        {124, 87, 59, 255, 1},
-        {156, 112, 77, 255, 1},
-        {151, 108, 74, 255, 5},
-        {152, 106, 69, 255, 1},
-        {142, 123, 108, 255, 1},
-        {134, 137, 140, 255, 1},
-        {135, 135, 135, 255, 1},
-        {136, 139, 141, 255, 1},
-        {127, 108, 92, 255, 1},
-        {120, 82, 52, 255, 1},
-        {121, 86, 58, 255, 1},
-        {131, 93, 63, 255, 1},
-        {120, 84, 55, 142, 1},
-        {128, 91, 62, 255, 1},
-        {119, 84, 57, 255, 1},
-        {116, 82, 55, 255, 1},
-        {138, 98, 67, 255, 1},
-        {156, 112, 77, 255, 1},
-        {153, 110, 75, 255, 1},
-        {156, 112, 76, 255, 1},
-        {135, 97, 66, 255, 1},
-        {119, 84, 57, 255, 1},
-        {121, 86, 58, 255, 1},
-        {116, 82, 55, 255, 1},
-        {159, 113, 78, 255, 1},
-        {193, 139, 98, 255, 1},
-        {188, 135, 95, 255, 1},
-        {193, 139, 98, 255, 1},
-        {150, 108, 74, 255, 1},
-        {116, 82, 55, 255, 1},
-        {121, 86, 58, 255, 1},
-        {119, 84, 57, 255, 1},
-        {138, 98, 67, 255, 1},
-        {153, 110, 75, 255, 1},
-        {151, 108, 74, 255, 1},
-        {148, 106, 72, 255, 1},
-        {173, 124, 87, 255, 1},
-        {194, 139, 98, 255, 1},
-        {190, 137, 96, 255, 1},
-        {194, 139, 98, 255, 1},
-        {168, 121, 83, 255, 1},
-        {148, 106, 72, 255, 1},
-        {151, 108, 74, 255, 1},
-        {156, 112, 77, 255, 1},
-        {115, 80, 52, 255, 1},
-        {82, 53, 31, 255, 1},
-        {87, 57, 35, 255, 1},
-        {79, 51, 30, 255, 1},
-        {144, 100, 69, 255, 1},
-        {196, 142, 99, 255, 1},
-        {188, 135, 95, 255, 1},
-        {187, 135, 94, 255, 1},
-        {191, 137, 96, 255, 1},
-        {193, 139, 98, 255, 1},
-        {193, 139, 97, 255, 1},
-        {201, 145, 102, 255, 1},
-        {134, 96, 65, 255, 1},
-        {80, 55, 36, 255, 1},
-        {89, 61, 40, 255, 1},
-        {84, 57, 37, 255, 1},
-        {124, 87, 59, 255, 1},
-        {156, 112, 77, 255, 1},
-        {151, 108, 74, 255, 5},
-        {152, 106, 69, 255, 1},
-        {143, 125, 111, 255, 1},
-        {135, 141, 147, 255, 1},
-        {136, 139, 141, 255, 1},
-        {137, 143, 148, 255, 1},
-        {129, 111, 96, 255, 1},
-        {123, 84, 53, 255, 1},
-        {124, 88, 59, 255, 1},
-        {134, 95, 65, 255, 1},
-        {138, 98, 66, 142, 1},
-        {149, 106, 73, 255, 1},
-        {138, 98, 67, 255, 2},
-        {136, 97, 66, 255, 1},
-        {134, 95, 65, 255, 1},
-        {134, 96, 65, 255, 1},
-        {135, 96, 66, 255, 1},
-        {127, 90, 61, 255, 1},
-        {120, 85, 58, 255, 1},
-        {121, 86, 58, 255, 1},
-        {118, 83, 56, 255, 1},
-        {146, 104, 71, 255, 1},
-        {169, 122, 84, 255, 1},
-        {166, 119, 82, 255, 1},
-        {169, 122, 84, 255, 1},
-        {141, 101, 69, 255, 1},
-        {118, 83, 56, 255, 1},
-        {121, 86, 58, 255, 1},
-        {119, 84, 57, 255, 1},
-        {138, 98, 67, 255, 1},
-        {153, 110, 75, 255, 1},
-        {151, 108, 74, 255, 2},
-        {150, 107, 74, 255, 1},
-        {149, 107, 74, 255, 1},
-        {149, 107, 73, 255, 1},
-        {149, 107, 74, 255, 1},
-        {150, 107, 74, 255, 1},
-        {151, 108, 74, 255, 2},
-        {155, 110, 74, 255, 1},
-        {122, 96, 76, 255, 1},
-        {96, 85, 78, 255, 1},
-        {100, 87, 78, 255, 1},
-        {95, 85, 78, 255, 1},
-        {137, 105, 81, 255, 1},
-        {171, 122, 83, 255, 1},
-        {166, 119, 82, 255, 1},
-        {169, 121, 84, 255, 1},
-        {146, 105, 72, 255, 1},
-        {129, 91, 62, 255, 1},
-        {131, 93, 63, 255, 1},
-        {135, 95, 65, 255, 1},
-        {108, 75, 50, 255, 1},
-        {86, 58, 38, 255, 1},
-        {89, 61, 40, 255, 1},
-        {84, 57, 37, 255, 1},
-        {124, 87, 59, 255, 1},
-        {156, 112, 77, 255, 1},
-        {151, 108, 74, 255, 5},
-        {153, 108, 72, 255, 1},
-        {138, 108, 84, 255, 1},
-        {125, 107, 93, 255, 1},
-        {127, 108, 92, 255, 1},
-        {129, 110, 95, 255, 1},
-        {114, 88, 67, 255, 1},
-        {101, 69, 45, 255, 1},
-        {103, 72, 48, 255, 1},
-        {112, 78, 52, 255, 1},
-        {152, 109, 75, 142, 1},
-        {166, 119, 81, 255, 1},
-        {153, 110, 75, 255, 1},
-        {156, 112, 77, 255, 1},
-        {134, 96, 65, 255, 1},
-        {116, 82, 55, 255, 1},
-        {119, 84, 57, 255, 1},
-        {118, 84, 57, 255, 1},
-        {120, 85, 57, 255, 1},
-        {121, 86, 58, 255, 2},
-        {119, 84, 57, 255, 1},
-        {136, 97, 66, 255, 1},
-        {150, 108, 73, 255, 1},
-        {148, 106, 72, 255, 1},
-        {150, 108, 73, 255, 1},
-        {133, 95, 64, 255, 1},
-        {119, 84, 57, 255, 1},
-        {121, 86, 58, 255, 1},
-        {119, 84, 57, 255, 1},
-        {138, 98, 67, 255, 1},
-        {153, 110, 75, 255, 1},
-        {151, 108, 74, 255, 1},
-        {153, 110, 75, 255, 1},
-        {131, 94, 63, 255, 1},
-        {113, 80, 54, 255, 1},
-        {116, 82, 55, 255, 1},
-        {113, 80, 54, 255, 1},
-        {136, 96, 66, 255, 1},
-        {153, 110, 75, 255, 1},
-        {151, 108, 74, 255, 1},
-        {154, 108, 71, 255, 1},
-        {128, 110, 96, 255, 1},
-        {107, 112, 117, 255, 1},
-        {110, 112, 113, 255, 1},
-        {107, 112, 117, 255, 1},
-        {131, 109, 91, 255, 1},
-        {151, 105, 69, 255, 1},
-        {148, 106, 72, 255, 1},
-        {154, 110, 76, 255, 1},
-        {110, 78, 52, 255, 1},
-        {76, 51, 32, 255, 1},
-        {81, 55, 36, 255, 1},
-        {81, 55, 35, 255, 1},
-        {86, 58, 38, 255, 1},
-        {90, 61, 40, 255, 1},
-        {89, 61, 40, 255, 1},
-        {84, 57, 37, 255, 1},
-        {124, 87, 59, 255, 1},
-        {156, 112, 77, 255, 1},
-        {151, 108, 74, 255, 5},
-        {153, 110, 75, 255, 1},
-        {133, 94, 62, 255, 1},
-        {118, 80, 50, 255, 1},
-        {120, 82, 52, 255, 1},
-        {123, 84, 52, 255, 1},
-        {101, 69, 44, 255, 1},
-        {83, 57, 38, 255, 1},
-        {86, 59, 39, 255, 1},
-        {93, 64, 41, 255, 1},
-        {150, 107, 73, 142, 1},
-        {163, 117, 80, 255, 1},
-        {151, 108, 74, 255, 1},
-        {153, 110, 75, 255, 1},
-        {134, 96, 65, 255, 1},
-        {119, 84, 57, 255, 1},
-        {121, 86, 58, 255, 5},
-        {119, 84, 57, 255, 1},
-        {138, 98, 67, 255, 1},
-        {153, 110, 75, 255, 1},
-        {151, 108, 74, 255, 1},
-        {153, 110, 75, 255, 1},
-        {134, 96, 65, 255, 1},
-        {119, 84, 57, 255, 1},
-        {121, 86, 58, 255, 1},
-        {119, 84, 57, 255, 1},
-        {138, 98, 67, 255, 1},
-        {153, 110, 75, 255, 1},
-        {151, 108, 74, 255, 1},
-        {153, 110, 75, 255, 1},
-        {134, 96, 65, 255, 1},
-        {119, 84, 57, 255, 1},
-        {121, 86, 58, 255, 1},
-        {119, 84, 57, 255, 1},
-        {138, 98, 67, 255, 1},
-        {153, 110, 75, 255, 1},
-        {151, 108, 74, 255, 1},
-        {154, 108, 71, 255, 1},
-        {127, 108, 93, 255, 1},
-        {105, 108, 111, 255, 1},
-        {108, 108, 108, 255, 1},
-        {105, 108, 111, 255, 1},
-        {132, 108, 89, 255, 1},
-        {154, 108, 71, 255, 1},
-        {151, 108, 74, 255, 1},
-        {156, 112, 77, 255, 1},
-        {116, 82, 55, 255, 1},
-        {84, 57, 37, 255, 1},
-        {89, 61, 40, 255, 5},
-        {84, 57, 37, 255, 1},
-        {124, 87, 59, 255, 1},
-        {156, 112, 77, 255, 1},
-        {151, 108, 74, 255, 5},
-        {153, 110, 75, 255, 1},
-        {134, 96, 65, 255, 1},
-        {119, 84, 57, 255, 1},
-        {121, 86, 58, 255, 1},
-        {124, 88, 59, 255, 1},
-        {103, 72, 48, 255, 1},
-        {86, 59, 39, 255, 1},
-        {89, 61, 40, 255, 1},
-        {96, 66, 43, 255, 1},
-        {156, 111, 77, 142, 1},
-        {168, 121, 83, 255, 1},
-        {156, 112, 77, 255, 1},
-        {158, 114, 78, 255, 1},
-        {138, 99, 67, 255, 1},
-        {121, 86, 58, 255, 1},
-        {124, 88, 59, 255, 1},
-        {124, 88, 60, 255, 1},
-        {122, 87, 59, 255, 1},
-        {121, 86, 58, 255, 2},
-        {119, 84, 57, 255, 1},
-        {138, 98, 67, 255, 1},
-        {153, 110, 75, 255, 1},
-        {151, 108, 74, 255, 1},
-        {153, 110, 75, 255, 1},
-        {134, 96, 65, 255, 1},
-        {119, 84, 57, 255, 1},
-        {121, 86, 58, 255, 1},
-        {119, 84, 57, 255, 1},
-        {139, 99, 68, 255, 1},
-        {156, 112, 76, 255, 1},
-        {153, 110, 75, 255, 1},
-        {156, 112, 77, 255, 1},
-        {132, 95, 64, 255, 1},
-        {113, 80, 54, 255, 1},
-        {116, 82, 55, 255, 1},
-        {113, 80, 54, 255, 1},
-        {137, 97, 66, 255, 1},
-        {156, 112, 77, 255, 1},
-        {153, 110, 75, 255, 1},
-        {157, 110, 72, 255, 1},
-        {128, 110, 96, 255, 1},
-        {104, 110, 115, 255, 1},
-        {107, 110, 112, 255, 1},
-        {104, 110, 115, 255, 1},
-        {133, 110, 91, 255, 1},
-        {157, 110, 72, 255, 1},
-        {153, 110, 75, 255, 1},
-        {159, 114, 79, 255, 1},
-        {116, 82, 55, 255, 1},
-        {81, 55, 35, 255, 1},
-        {86, 59, 39, 255, 1},
-        {87, 59, 39, 255, 1},
-        {85, 58, 38, 255, 1},
-        {84, 57, 37, 255, 2},
-        {78, 53, 34, 255, 1},
-        {123, 86, 59, 255, 1},
-        {159, 114, 79, 255, 1},
-        {153, 110, 75, 255, 5},
-        {156, 112, 77, 255, 1},
-        {132, 95, 64, 255, 1},
-        {113, 80, 54, 255, 1},
-        {116, 82, 55, 255, 1},
-        {119, 84, 56, 255, 1},
-        {96, 67, 44, 255, 1},
-        {78, 53, 34, 255, 1},
-        {81, 55, 36, 255, 1},
-        {88, 60, 38, 255, 1},
-        {116, 82, 55, 142, 1},
-        {126, 89, 59, 255, 1},
-        {116, 82, 55, 255, 1},
-        {117, 83, 56, 255, 1},
-        {109, 76, 51, 255, 1},
-        {102, 71, 47, 255, 1},
-        {103, 72, 48, 255, 1},
-        {102, 71, 47, 255, 1},
-        {113, 80, 53, 255, 1},
-        {123, 87, 59, 255, 1},
-        {121, 86, 58, 255, 1},
-        {119, 84, 57, 255, 1},
-        {138, 98, 67, 255, 1},
-        {153, 110, 75, 255, 1},
-        {151, 108, 74, 255, 1},
-        {153, 110, 75, 255, 1},
-        {134, 96, 65, 255, 1},
-        {119, 84, 57, 255, 1},
-        {121, 86, 58, 255, 1},
-        {120, 85, 57, 255, 1},
-        {129, 91, 62, 255, 1},
-        {135, 96, 65, 255, 1},
-        {134, 96, 65, 255, 1},
-        {132, 94, 64, 255, 1},
-        {147, 105, 72, 255, 1},
-        {159, 114, 79, 255, 1},
-        {157, 112, 77, 255, 1},
-        {159, 114, 79, 255, 1},
-        {144, 103, 70, 255, 1},
-        {132, 94, 64, 255, 1},
-        {134, 96, 65, 255, 1},
-        {136, 96, 64, 255, 1},
-        {124, 96, 73, 255, 1},
-        {114, 96, 81, 255, 1},
-        {115, 96, 80, 255, 1},
-        {114, 96, 81, 255, 1},
-        {126, 96, 72, 255, 1},
-        {136, 96, 64, 255, 1},
-        {134, 96, 65, 255, 1},
-        {136, 97, 66, 255, 1},
-        {119, 84, 57, 255, 1},
-        {105, 73, 49, 255, 1},
-        {107, 75, 50, 255, 1},
-        {106, 74, 49, 255, 1},
-        {116, 82, 55, 255, 1},
-        {125, 88, 60, 255, 1},
-        {124, 87, 59, 255, 1},
-        {123, 87, 58, 255, 1},
-        {129, 92, 62, 255, 1},
-        {135, 96, 66, 255, 1},
-        {134, 96, 65, 255, 5},
-        {132, 94, 64, 255, 1},
-        {147, 105, 72, 255, 1},
-        {159, 114, 79, 255, 1},
-        {157, 112, 77, 255, 1},
-        {158, 113, 78, 255, 1},
-        {149, 106, 73, 255, 1},
-        {141, 100, 69, 255, 1},
-        {143, 101, 70, 255, 1},
-        {154, 110, 75, 255, 1},
-        {84, 57, 35, 142, 1},
-        {91, 62, 40, 255, 1},
-        {84, 57, 37, 255, 2},
-        {85, 58, 38, 255, 1},
-        {87, 59, 39, 255, 1},
-        {86, 59, 39, 255, 1},
-        {83, 57, 37, 255, 1},
-        {106, 74, 49, 255, 1},
-        {124, 88, 59, 255, 1},
-        {121, 86, 58, 255, 1},
-        {119, 84, 57, 255, 1},
-        {138, 98, 67, 255, 1},
-        {153, 110, 75, 255, 1},
-        {151, 108, 74, 255, 1},
-        {153, 110, 75, 255, 1},
-        {134, 96, 65, 255, 1},
-        {119, 84, 57, 255, 1},
-        {121, 86, 58, 255, 2},
-        {120, 85, 57, 255, 1},
-        {118, 84, 57, 255, 1},
-        {119, 84, 57, 255, 1},
-        {113, 80, 53, 255, 1},
-        {159, 113, 78, 255, 1},
-        {196, 141, 99, 255, 1},
-        {190, 137, 96, 255, 1},
-        {196, 141, 99, 255, 1},
-        {150, 108, 74, 255, 1},
-        {113, 80, 53, 255, 1},
-        {119, 84, 57, 255, 1},
-        {118, 84, 57, 255, 1},
-        {120, 84, 55, 255, 1},
-        {122, 84, 54, 255, 3},
-        {120, 84, 56, 255, 1},
-        {118, 84, 57, 255, 1},
-        {119, 84, 57, 255, 1},
-        {118, 84, 56, 255, 1},
-        {121, 86, 58, 255, 1},
-        {124, 88, 60, 255, 1},
-        {124, 88, 59, 255, 1},
-        {121, 86, 58, 255, 1},
-        {142, 101, 69, 255, 1},
-        {158, 114, 78, 255, 1},
-        {156, 112, 77, 255, 1},
-        {159, 114, 78, 255, 1},
-        {135, 97, 65, 255, 1},
-        {116, 82, 55, 255, 1},
-        {119, 84, 57, 255, 5},
-        {113, 80, 53, 255, 1},
-        {159, 113, 78, 255, 1},
-        {196, 141, 99, 255, 1},
-        {190, 137, 96, 255, 2},
-        {192, 138, 97, 255, 1},
-        {193, 139, 97, 255, 2},
-        {208, 150, 106, 255, 1},
-        {89, 61, 39, 142, 1},
-        {96, 66, 43, 255, 1},
-        {89, 61, 40, 255, 5},
-        {86, 59, 39, 255, 1},
-        {107, 75, 50, 255, 1},
-        {124, 88, 59, 255, 1},
-        {121, 86, 58, 255, 1},
-        {119, 84, 57, 255, 1},
-        {138, 98, 67, 255, 1},
-        {153, 110, 75, 255, 1},
-        {151, 108, 74, 255, 1},
-        {153, 110, 75, 255, 1},
-        {134, 96, 65, 255, 1},
-        {119, 84, 57, 255, 1},
-        {121, 86, 58, 255, 5},
-        {116, 82, 55, 255, 1},
-        {157, 112, 77, 255, 1},
-        {190, 137, 96, 255, 1},
-        {185, 133, 93, 255, 1},
-        {190, 137, 96, 255, 1},
-        {149, 107, 73, 255, 1},
-        {116, 82, 55, 255, 1},
-        {121, 86, 58, 255, 13},
-        {119, 84, 57, 255, 1},
-        {138, 98, 67, 255, 1},
-        {153, 110, 75, 255, 1},
-        {151, 108, 74, 255, 1},
-        {153, 110, 75, 255, 1},
-        {134, 96, 65, 255, 1},
-        {119, 84, 57, 255, 1},
-        {121, 86, 58, 255, 5},
-        {116, 82, 55, 255, 1},
-        {157, 112, 77, 255, 1},
-        {190, 137, 96, 255, 1},
-        {185, 133, 93, 255, 5},
-        {200, 144, 101, 255, 1},
-        {87, 59, 37, 142, 1},
-        {93, 64, 41, 255, 1},
-        {86, 59, 39, 255, 1},
-        {87, 59, 39, 255, 1},
-        {85, 58, 38, 255, 1},
-        {84, 57, 37, 255, 2},
-        {81, 55, 36, 255, 1},
-        {105, 73, 49, 255, 1},
-        {124, 88, 59, 255, 1},
-        {121, 86, 58, 255, 1},
-        {119, 84, 57, 255, 1},
-        {139, 99, 68, 255, 1},
-        {156, 112, 76, 255, 1},
-        {153, 110, 75, 255, 1},
-        {156, 112, 77, 255, 1},
-        {135, 97, 65, 255, 1},
-        {119, 84, 56, 255, 1},
-        {121, 86, 57, 255, 2},
-        {121, 86, 58, 255, 3},
-        {116, 82, 55, 255, 1},
-        {159, 113, 78, 255, 1},
-        {193, 139, 98, 255, 1},
-        {188, 135, 95, 255, 1},
-        {193, 139, 98, 255, 1},
-        {149, 107, 73, 255, 1},
-        {113, 80, 53, 255, 1},
-        {119, 84, 57, 255, 1},
-        {118, 84, 57, 255, 1},
-        {120, 85, 57, 255, 1},
-        {121, 86, 58, 255, 3},
-        {122, 87, 59, 255, 1},
-        {124, 88, 60, 255, 1},
-        {124, 88, 59, 255, 5},
-        {121, 86, 58, 255, 1},
-        {142, 101, 69, 255, 1},
-        {158, 114, 78, 255, 1},
-        {156, 112, 77, 255, 1},
-        {158, 114, 78, 255, 1},
-        {136, 98, 66, 255, 1},
-        {119, 84, 57, 255, 1},
-        {121, 86, 58, 255, 2},
-        {118, 84, 56, 255, 1},
-        {115, 82, 55, 255, 1},
-        {116, 82, 55, 255, 1},
-        {110, 78, 52, 255, 1},
-        {156, 111, 77, 255, 1},
-        {193, 140, 98, 255, 1},
-        {188, 135, 95, 255, 5},
-        {203, 146, 103, 255, 1},
-        {107, 75, 50, 142, 1},
-        {116, 81, 54, 255, 1},
-        {107, 75, 50, 255, 1},
-        {106, 74, 49, 255, 1},
-        {116, 82, 55, 255, 1},
-        {125, 88, 60, 255, 1},
-        {124, 87, 59, 255, 2},
-        {122, 87, 59, 255, 1},
-        {121, 86, 58, 255, 2},
-        {120, 85, 57, 255, 1},
-        {129, 91, 62, 255, 1},
-        {135, 96, 65, 255, 1},
-        {134, 96, 65, 255, 1},
-        {135, 96, 65, 255, 1},
-        {125, 91, 64, 255, 1},
-        {117, 86, 63, 255, 1},
-        {118, 87, 63, 255, 1},
-        {118, 87, 64, 255, 1},
-        {120, 86, 60, 255, 1},
-        {121, 86, 57, 255, 1},
-        {121, 86, 58, 255, 1},
-        {118, 83, 56, 255, 1},
-        {146, 104, 71, 255, 1},
-        {169, 122, 84, 255, 1},
-        {166, 119, 82, 255, 1},
-        {168, 121, 84, 255, 1},
-        {150, 108, 74, 255, 1},
-        {135, 96, 66, 255, 1},
-        {138, 98, 67, 255, 1},
-        {139, 99, 68, 255, 1},
-        {128, 92, 62, 255, 1},
-        {120, 85, 57, 255, 1},
-        {121, 86, 58, 255, 1},
-        {123, 87, 59, 255, 1},
-        {111, 78, 52, 255, 1},
-        {102, 71, 47, 255, 1},
-        {103, 72, 48, 255, 5},
-        {102, 71, 47, 255, 1},
-        {111, 77, 52, 255, 1},
-        {117, 83, 56, 255, 1},
-        {116, 82, 55, 255, 2},
-        {119, 84, 57, 255, 1},
-        {122, 86, 58, 255, 1},
-        {121, 86, 58, 255, 1},
-        {118, 84, 56, 255, 1},
-        {141, 101, 69, 255, 1},
-        {160, 114, 79, 255, 1},
-        {157, 112, 77, 255, 1},
-        {156, 112, 77, 255, 1},
-        {162, 116, 80, 255, 1},
-        {167, 120, 83, 255, 1},
-        {166, 119, 82, 255, 5},
-        {179, 129, 89, 255, 1},
-        {123, 87, 59, 142, 1},
-        {134, 95, 65, 255, 1},
-        {124, 88, 59, 255, 1},
-        {121, 86, 58, 255, 1},
-        {142, 101, 69, 255, 1},
-        {158, 114, 78, 255, 1},
-        {156, 112, 77, 255, 1},
-        {158, 114, 78, 255, 1},
-        {136, 98, 66, 255, 1},
-        {119, 84, 57, 255, 1},
-        {121, 86, 58, 255, 2},
-        {120, 85, 57, 255, 1},
-        {118, 84, 57, 255, 1},
-        {119, 84, 57, 255, 1},
-        {118, 84, 56, 255, 1},
-        {117, 86, 63, 255, 1},
-        {116, 88, 69, 255, 1},
-        {116, 88, 68, 255, 1},
-        {116, 88, 69, 255, 1},
-        {119, 87, 62, 255, 1},
-        {121, 86, 57, 255, 1},
-        {121, 86, 58, 255, 1},
-        {119, 84, 57, 255, 1},
-        {136, 97, 66, 255, 1},
-        {150, 108, 73, 255, 1},
-        {148, 106, 72, 255, 2},
-        {151, 108, 74, 255, 1},
-        {154, 110, 76, 255, 1},
-        {153, 110, 75, 255, 1},
-        {156, 112, 76, 255, 1},
-        {135, 97, 66, 255, 1},
-        {119, 84, 57, 255, 1},
-        {121, 86, 58, 255, 1},
-        {124, 88, 59, 255, 1},
-        {102, 71, 47, 255, 1},
-        {83, 57, 37, 255, 1},
-        {86, 59, 39, 255, 5},
-        {87, 59, 39, 255, 1},
-        {85, 58, 38, 255, 1},
-        {84, 57, 37, 255, 2},
-        {81, 55, 36, 255, 1},
-        {105, 73, 49, 255, 1},
-        {124, 88, 59, 255, 1},
-        {121, 86, 58, 255, 1},
-        {116, 82, 55, 255, 1},
-        {160, 114, 79, 255, 1},
-        {196, 141, 99, 255, 1},
-        {190, 137, 96, 255, 1},
-        {194, 139, 98, 255, 1},
-        {167, 120, 82, 255, 1},
-        {145, 103, 70, 255, 1},
-        {148, 106, 72, 255, 5},
-        {160, 115, 78, 255, 1},
-        {122, 86, 57, 142, 1},
-        {131, 93, 63, 255, 1},
-        {121, 86, 58, 255, 1},
-        {119, 84, 57, 255, 1},
-        {138, 98, 67, 255, 1},
-        {153, 110, 75, 255, 1},
-        {151, 108, 74, 255, 1},
-        {153, 110, 75, 255, 1},
-        {134, 96, 65, 255, 1},
-        {119, 84, 57, 255, 1},
-        {121, 86, 58, 255, 5},
-        {121, 86, 57, 255, 1},
-        {118, 87, 63, 255, 1},
-        {116, 88, 68, 255, 1},
-        {116, 88, 67, 255, 1},
-        {116, 88, 68, 255, 1},
-        {119, 87, 62, 255, 1},
-        {121, 86, 57, 255, 1},
-        {121, 86, 58, 255, 1},
-        {119, 84, 57, 255, 1},
-        {138, 98, 67, 255, 1},
-        {153, 110, 75, 255, 1},
-        {151, 108, 74, 255, 5},
-        {153, 110, 75, 255, 1},
-        {134, 96, 65, 255, 1},
-        {119, 84, 57, 255, 1},
-        {121, 86, 58, 255, 1},
-        {124, 88, 59, 255, 1},
-        {103, 72, 48, 255, 1},
-        {86, 59, 39, 255, 1},
-        {89, 61, 40, 255, 9},
-        {86, 59, 39, 255, 1},
-        {107, 75, 50, 255, 1},
-        {124, 88, 59, 255, 1},
-        {121, 86, 58, 255, 1},
-        {116, 82, 55, 255, 1},
-        {157, 112, 77, 255, 1},
-        {190, 137, 96, 255, 1},
-        {185, 133, 93, 255, 1},
-        {188, 135, 95, 255, 1},
-        {166, 119, 82, 255, 1},
-        {148, 106, 72, 255, 1},
-        {151, 108, 74, 255, 5},
-        {163, 117, 80, 255, 1},
-        {120, 84, 55, 142, 1},
-        {128, 91, 62, 255, 1},
-        {119, 84, 57, 255, 1},
-        {116, 82, 55, 255, 1},
-        {138, 98, 67, 255, 1},
-        {156, 112, 77, 255, 1},
-        {153, 110, 75, 255, 1},
-        {156, 112, 76, 255, 1},
-        {135, 97, 66, 255, 1},
-        {119, 84, 57, 255, 1},
-        {121, 86, 58, 255, 2},
-        {118, 84, 56, 255, 1},
-        {115, 82, 55, 255, 1},
-        {116, 82, 55, 255, 1},
-        {115, 82, 54, 255, 1},
-        {116, 85, 62, 255, 1},
-        {116, 88, 69, 255, 1},
-        {116, 88, 68, 255, 1},
-        {115, 88, 69, 255, 1},
-        {120, 88, 63, 255, 1},
-        {124, 88, 58, 255, 1},
-        {124, 88, 59, 255, 1},
-        {122, 86, 58, 255, 1},
-        {140, 100, 68, 255, 1},
-        {155, 112, 76, 255, 1},
-        {153, 110, 75, 255, 2},
-        {155, 111, 76, 255, 1},
-        {156, 112, 77, 255, 2},
-        {159, 115, 78, 255, 1},
-        {133, 96, 65, 255, 1},
-        {113, 79, 54, 255, 1},
-        {116, 82, 55, 255, 1},
-        {119, 84, 56, 255, 1},
-        {99, 69, 46, 255, 1},
-        {84, 57, 38, 255, 1},
-        {86, 59, 39, 255, 5},
-        {87, 59, 39, 255, 1},
-        {85, 58, 38, 255, 1},
-        {84, 57, 37, 255, 2},
-        {81, 55, 36, 255, 1},
-        {105, 73, 49, 255, 1},
-        {124, 88, 59, 255, 1},
-        {121, 86, 58, 255, 1},
-        {116, 82, 55, 255, 1},
-        {160, 114, 79, 255, 1},
-        {196, 141, 99, 255, 1},
-        {190, 137, 96, 255, 1},
-        {194, 139, 98, 255, 1},
-        {168, 121, 83, 255, 1},
-        {148, 106, 72, 255, 1},
-        {151, 108, 74, 255, 5},
-        {163, 117, 80, 255, 1},
-        {138, 98, 66, 142, 1},
-        {149, 106, 73, 255, 1},
-        {138, 98, 67, 255, 2},
-        {136, 97, 66, 255, 1},
-        {134, 95, 65, 255, 1},
-        {134, 96, 65, 255, 1},
-        {135, 96, 66, 255, 1},
-        {127, 90, 61, 255, 1},
-        {120, 85, 58, 255, 1},
-        {121, 86, 58, 255, 1},
-        {118, 84, 56, 255, 1},
-        {141, 101, 69, 255, 1},
-        {160, 114, 79, 255, 1},
-        {157, 112, 77, 255, 1},
-        {160, 114, 79, 255, 1},
-        {135, 98, 68, 255, 1},
-        {116, 85, 61, 255, 1},
-        {119, 87, 62, 255, 1},
-        {120, 88, 63, 255, 1},
-        {110, 78, 54, 255, 1},
-        {102, 71, 47, 255, 1},
-        {103, 72, 48, 255, 1},
-        {101, 70, 47, 255, 1},
-        {121, 85, 58, 255, 1},
-        {137, 98, 66, 255, 1},
-        {134, 96, 65, 255, 1},
-        {136, 97, 66, 255, 1},
-        {124, 88, 59, 255, 1},
-        {115, 81, 54, 255, 1},
-        {116, 82, 55, 255, 1},
-        {113, 79, 53, 255, 1},
-        {139, 99, 68, 255, 1},
-        {160, 115, 79, 255, 1},
-        {157, 112, 77, 255, 1},
-        {161, 115, 80, 255, 1},
-        {129, 91, 62, 255, 1},
-        {103, 72, 48, 255, 1},
-        {107, 75, 50, 255, 5},
-        {106, 74, 49, 255, 1},
-        {116, 82, 55, 255, 1},
-        {125, 88, 60, 255, 1},
-        {124, 87, 59, 255, 2},
-        {122, 87, 59, 255, 1},
-        {121, 86, 58, 255, 2},
-        {119, 84, 57, 255, 1},
-        {137, 97, 66, 255, 1},
-        {151, 109, 75, 255, 1},
-        {149, 107, 73, 255, 1},
-        {149, 107, 74, 255, 1},
-        {150, 107, 74, 255, 1},
-        {151, 108, 74, 255, 6},
-        {163, 117, 80, 255, 1},
-        {152, 109, 75, 142, 1},
-        {166, 119, 81, 255, 1},
-        {153, 110, 75, 255, 1},
-        {156, 112, 77, 255, 1},
-        {134, 96, 65, 255, 1},
-        {116, 82, 55, 255, 1},
-        {119, 84, 57, 255, 1},
-        {118, 84, 57, 255, 1},
-        {120, 85, 57, 255, 1},
-        {121, 86, 58, 255, 2},
-        {116, 82, 55, 255, 1},
-        {160, 114, 79, 255, 1},
-        {196, 141, 99, 255, 1},
-        {190, 137, 96, 255, 1},
-        {196, 141, 99, 255, 1},
-        {151, 109, 74, 255, 1},
-        {116, 82, 54, 255, 1},
-        {121, 86, 57, 255, 1},
-        {125, 88, 58, 255, 1},
-        {102, 71, 47, 255, 1},
-        {83, 57, 38, 255, 1},
-        {86, 59, 39, 255, 1},
-        {83, 57, 38, 255, 1},
-        {104, 73, 49, 255, 1},
-        {122, 86, 58, 255, 1},
-        {119, 84, 57, 255, 1},
-        {122, 86, 58, 255, 1},
-        {99, 69, 46, 255, 1},
-        {81, 55, 36, 255, 1},
-        {84, 57, 37, 255, 1},
-        {75, 50, 33, 255, 1},
-        {144, 101, 70, 255, 1},
-        {199, 144, 100, 255, 1},
-        {190, 137, 96, 255, 1},
-        {195, 141, 99, 255, 1},
-        {153, 110, 75, 255, 1},
-        {118, 84, 56, 255, 1},
-        {124, 88, 59, 255, 5},
-        {121, 86, 58, 255, 1},
-        {142, 101, 69, 255, 1},
-        {158, 114, 78, 255, 1},
-        {156, 112, 77, 255, 1},
-        {158, 114, 78, 255, 1},
-        {136, 98, 66, 255, 1},
-        {119, 84, 57, 255, 1},
-        {121, 86, 58, 255, 2},
-        {118, 84, 56, 255, 1},
-        {115, 82, 55, 255, 1},
-        {116, 82, 55, 255, 1},
-        {113, 80, 54, 255, 1},
-        {136, 96, 66, 255, 1},
-        {153, 110, 75, 255, 1},
-        {151, 108, 74, 255, 5},
-        {163, 117, 80, 255, 1},
-        {150, 107, 73, 142, 1},
-        {163, 117, 80, 255, 1},
-        {151, 108, 74, 255, 1},
-        {153, 110, 75, 255, 1},
-        {134, 96, 65, 255, 1},
-        {119, 84, 57, 255, 1},
-        {121, 86, 58, 255, 5},
-        {116, 82, 55, 255, 1},
-        {157, 112, 77, 255, 1},
-        {190, 137, 96, 255, 1},
-        {185, 133, 93, 255, 1},
-        {190, 137, 96, 255, 1},
-        {149, 107, 73, 255, 1},
-        {116, 82, 55, 255, 1},
-        {121, 86, 58, 255, 1},
-        {124, 88, 59, 255, 1},
-        {103, 72, 48, 255, 1},
-        {86, 59, 39, 255, 1},
-        {89, 61, 40, 255, 1},
-        {86, 59, 39, 255, 1},
-        {107, 75, 50, 255, 1},
-        {124, 88, 59, 255, 1},
-        {121, 86, 58, 255, 1},
-        {124, 88, 59, 255, 1},
-        {103, 72, 48, 255, 1},
-        {86, 59, 39, 255, 1},
-        {89, 61, 40, 255, 1},
-        {81, 55, 36, 255, 1},
-        {143, 101, 70, 255, 1},
-        {193, 139, 97, 255, 1},
-        {185, 133, 93, 255, 1},
-        {190, 137, 96, 255, 1},
-        {149, 107, 73, 255, 1},
-        {116, 82, 55, 255, 1},
-        {121, 86, 58, 255, 5},
-        {119, 84, 57, 255, 1},
-        {138, 98, 67, 255, 1},
-        {153, 110, 75, 255, 1},
-        {151, 108, 74, 255, 1},
-        {153, 110, 75, 255, 1},
-        {134, 96, 65, 255, 1},
-        {119, 84, 57, 255, 1},
-        {121, 86, 58, 255, 5},
-        {119, 84, 57, 255, 1},
-        {138, 98, 67, 255, 1},
-        {153, 110, 75, 255, 1},
-        {151, 108, 74, 255, 5},
-        {163, 117, 80, 255, 1},
-        {150, 107, 73, 142, 1},
-        {163, 117, 80, 255, 1},
-        {151, 108, 74, 255, 1},
-        {153, 110, 75, 255, 1},
-        {134, 96, 65, 255, 1},
-        {119, 84, 57, 255, 1},
-        {121, 86, 58, 255, 2},
-        {118, 84, 56, 255, 1},
-        {115, 82, 55, 255, 1},
-        {116, 82, 55, 255, 1},
-        {110, 78, 52, 255, 1},
-        {156, 111, 77, 255, 1},
-        {193, 140, 98, 255, 1},
-        {188, 135, 95, 255, 1},
-        {193, 139, 98, 255, 1},
-        {149, 107, 73, 255, 1},
-        {113, 80, 53, 255, 1},
-        {119, 84, 57, 255, 1},
-        {122, 86, 58, 255, 1},
-        {101, 70, 47, 255, 1},
-        {83, 57, 38, 255, 1},
-        {86, 59, 39, 255, 1},
-        {83, 57, 38, 255, 1},
-        {105, 72, 46, 255, 1},
-        {123, 84, 52, 255, 1},
-        {120, 82, 52, 255, 1},
-        {123, 84, 52, 255, 1},
-        {101, 69, 44, 255, 1},
-        {83, 57, 38, 255, 1},
-        {86, 59, 39, 255, 1},
-        {78, 53, 34, 255, 1},
-        {143, 101, 70, 255, 1},
-        {196, 141, 99, 255, 1},
-        {188, 135, 95, 255, 1},
-        {193, 139, 98, 255, 1},
-        {149, 107, 73, 255, 1},
-        {113, 80, 53, 255, 1},
-        {119, 84, 57, 255, 1},
-        {118, 84, 57, 255, 1},
-        {120, 85, 57, 255, 1},
-        {121, 86, 58, 255, 2},
-        {119, 84, 57, 255, 1},
-        {139, 99, 68, 255, 1},
-        {156, 112, 76, 255, 1},
-        {153, 110, 75, 255, 1},
-        {156, 112, 77, 255, 1},
-        {134, 95, 62, 255, 1},
-        {117, 80, 50, 255, 1},
-        {120, 82, 52, 255, 1},
-        {120, 82, 51, 255, 1},
-        {119, 83, 55, 255, 1},
-        {119, 84, 57, 255, 2},
-        {116, 82, 55, 255, 1},
-        {138, 98, 67, 255, 1},
-        {156, 112, 77, 255, 1},
-        {153, 110, 75, 255, 2},
-        {155, 111, 76, 255, 1},
-        {156, 112, 77, 255, 2},
-        {168, 121, 83, 255, 1},
-        {150, 107, 73, 142, 1},
-        {163, 117, 80, 255, 1},
-        {151, 108, 74, 255, 1},
-        {153, 110, 75, 255, 1},
-        {134, 96, 65, 255, 1},
-        {119, 84, 57, 255, 1},
-        {121, 86, 58, 255, 1},
-        {118, 84, 56, 255, 1},
-        {141, 101, 69, 255, 1},
-        {160, 114, 79, 255, 1},
-        {157, 112, 77, 255, 1},
-        {156, 112, 77, 255, 1},
-        {162, 116, 80, 255, 1},
-        {167, 120, 83, 255, 1},
-        {166, 119, 82, 255, 1},
-        {168, 121, 84, 255, 1},
-        {150, 108, 74, 255, 1},
-        {135, 96, 66, 255, 1},
-        {138, 98, 67, 255, 1},
-        {140, 100, 68, 255, 1},
-        {120, 85, 58, 255, 1},
-        {105, 73, 49, 255, 1},
-        {107, 75, 50, 255, 1},
-        {105, 72, 46, 255, 1},
-        {119, 96, 78, 255, 1},
-        {131, 116, 105, 255, 1},
-        {129, 113, 101, 255, 1},
-        {131, 116, 105, 255, 1},
-        {117, 92, 73, 255, 1},
-        {105, 72, 46, 255, 1},
-        {107, 75, 50, 255, 1},
-        {102, 71, 48, 255, 1},
-        {140, 99, 68, 255, 1},
-        {171, 123, 85, 255, 1},
-        {166, 119, 82, 255, 1},
-        {168, 121, 84, 255, 1},
-        {150, 108, 74, 255, 1},
-        {135, 96, 66, 255, 1},
-        {138, 98, 67, 255, 1},
-        {139, 99, 68, 255, 1},
-        {128, 92, 62, 255, 1},
-        {120, 85, 57, 255, 1},
-        {121, 86, 58, 255, 1},
-        {120, 85, 57, 255, 1},
-        {129, 91, 62, 255, 1},
-        {135, 96, 65, 255, 1},
-        {134, 96, 65, 255, 1},
-        {134, 94, 62, 255, 1},
-        {131, 105, 85, 255, 1},
-        {129, 115, 104, 255, 1},
-        {129, 113, 101, 255, 1},
-        {128, 114, 104, 255, 1},
-        {134, 105, 82, 255, 1},
-        {138, 97, 64, 255, 1},
-        {138, 98, 67, 255, 2},
-        {136, 97, 66, 255, 1},
-        {134, 95, 65, 255, 1},
-        {134, 96, 65, 255, 1},
-        {136, 97, 66, 255, 1},
-        {124, 88, 59, 255, 1},
-        {115, 81, 54, 255, 1},
-        {116, 82, 55, 255, 1},
-        {126, 89, 59, 255, 1},
-        {150, 107, 73, 142, 1},
-        {163, 117, 80, 255, 1},
-        {151, 108, 74, 255, 1},
-        {153, 110, 75, 255, 1},
-        {134, 96, 65, 255, 1},
-        {119, 84, 57, 255, 1},
-        {121, 86, 58, 255, 1},
-        {116, 82, 55, 255, 1},
-        {160, 114, 79, 255, 1},
-        {196, 141, 99, 255, 1},
-        {190, 137, 96, 255, 1},
-        {194, 139, 98, 255, 1},
-        {167, 120, 82, 255, 1},
-        {145, 103, 70, 255, 1},
-        {148, 106, 72, 255, 2},
-        {151, 108, 74, 255, 1},
-        {154, 110, 76, 255, 1},
-        {153, 110, 75, 255, 1},
-        {155, 112, 76, 255, 1},
-        {137, 98, 66, 255, 1},
-        {122, 86, 58, 255, 1},
-        {124, 88, 59, 255, 1},
-        {123, 84, 53, 255, 1},
-        {131, 116, 105, 255, 1},
-        {137, 143, 148, 255, 1},
-        {136, 139, 141, 255, 1},
-        {137, 143, 148, 255, 1},
-        {129, 111, 96, 255, 1},
-        {123, 84, 53, 255, 1},
-        {124, 88, 59, 255, 1},
-        {122, 86, 59, 255, 1},
-        {138, 98, 67, 255, 1},
-        {150, 108, 73, 255, 1},
-        {148, 106, 72, 255, 2},
-        {151, 108, 74, 255, 1},
-        {154, 110, 76, 255, 1},
-        {153, 110, 75, 255, 1},
-        {156, 112, 76, 255, 1},
-        {135, 97, 66, 255, 1},
-        {119, 84, 57, 255, 1},
-        {121, 86, 58, 255, 2},
-        {120, 85, 57, 255, 1},
-        {118, 84, 57, 255, 1},
-        {119, 84, 57, 255, 1},
-        {117, 80, 50, 255, 1},
-        {129, 114, 104, 255, 1},
-        {137, 143, 148, 255, 1},
-        {136, 139, 141, 255, 1},
-        {135, 141, 147, 255, 1},
-        {146, 123, 104, 255, 1},
-        {155, 108, 70, 255, 1},
-        {153, 110, 75, 255, 1},
-        {156, 112, 77, 255, 1},
-        {134, 96, 65, 255, 1},
-        {116, 82, 55, 255, 1},
-        {119, 84, 57, 255, 1},
-        {122, 86, 58, 255, 1},
-        {99, 69, 46, 255, 1},
-        {81, 55, 36, 255, 1},
-        {84, 57, 37, 255, 1},
-        {91, 62, 40, 255, 1},
-        {150, 107, 73, 142, 1},
-        {163, 117, 80, 255, 1},
-        {151, 108, 74, 255, 1},
-        {153, 110, 75, 255, 1},
-        {134, 96, 65, 255, 1},
-        {119, 84, 57, 255, 1},
-        {121, 86, 58, 255, 1},
-        {116, 82, 55, 255, 1},
-        {157, 112, 77, 255, 1},
-        {190, 137, 96, 255, 1},
-        {185, 133, 93, 255, 1},
-        {188, 135, 95, 255, 1},
-        {166, 119, 82, 255, 1},
-        {148, 106, 72, 255, 1},
-        {151, 108, 74, 255, 5},
-        {153, 110, 75, 255, 1},
-        {134, 96, 65, 255, 1},
-        {119, 84, 57, 255, 1},
-        {121, 86, 58, 255, 1},
-        {120, 82, 52, 255, 1},
-        {129, 113, 101, 255, 1},
-        {136, 139, 141, 255, 1},
-        {135, 135, 135, 255, 1},
-        {136, 139, 141, 255, 1},
-        {127, 108, 92, 255, 1},
-        {120, 82, 52, 255, 1},
-        {121, 86, 58, 255, 1},
-        {119, 84, 57, 255, 1},
-        {138, 98, 67, 255, 1},
-        {153, 110, 75, 255, 1},
-        {151, 108, 74, 255, 5},
-        {153, 110, 75, 255, 1},
-        {134, 96, 65, 255, 1},
-        {119, 84, 57, 255, 1},
-        {121, 86, 58, 255, 5},
-        {120, 82, 52, 255, 1},
-        {129, 113, 101, 255, 1},
-        {136, 139, 141, 255, 1},
-        {135, 135, 135, 255, 1},
-        {134, 137, 140, 255, 1},
-        {144, 120, 101, 255, 1},
-        {152, 106, 69, 255, 1},
-        {151, 108, 74, 255, 1},
-        {153, 110, 75, 255, 1},
-        {134, 96, 65, 255, 1},
-        {119, 84, 57, 255, 1},
-        {121, 86, 58, 255, 1},
-        {124, 88, 59, 255, 1},
-        {103, 72, 48, 255, 1},
-        {86, 59, 39, 255, 1},
-        {89, 61, 40, 255, 1},
-        {96, 66, 43, 255, 1},
-        {150, 107, 72, 154, 1},
-        {176, 127, 87, 255, 1},
-        {163, 117, 80, 255, 1},
-        {165, 119, 81, 255, 1},
-        {145, 104, 70, 255, 1},
-        {129, 91, 62, 255, 1},
-        {131, 93, 63, 255, 1},
-        {125, 89, 59, 255, 1},
-        {170, 121, 83, 255, 1},
-        {205, 148, 104, 255, 1},
-        {200, 144, 101, 255, 1},
-        {203, 146, 103, 255, 1},
-        {180, 129, 89, 255, 1},
-        {160, 115, 78, 255, 1},
-        {163, 117, 80, 255, 5},
-        {165, 119, 81, 255, 1},
-        {145, 104, 70, 255, 1},
-        {129, 91, 62, 255, 1},
-        {131, 93, 63, 255, 1},
-        {130, 89, 56, 255, 1},
-        {140, 122, 109, 255, 1},
-        {147, 150, 152, 255, 1},
-        {146, 146, 146, 255, 1},
-        {147, 150, 152, 255, 1},
-        {137, 117, 100, 255, 1},
-        {130, 89, 56, 255, 1},
-        {131, 93, 63, 255, 1},
-        {129, 91, 62, 255, 1},
-        {149, 106, 72, 255, 1},
-        {165, 119, 81, 255, 1},
-        {163, 117, 80, 255, 5},
-        {165, 119, 81, 255, 1},
-        {145, 104, 70, 255, 1},
-        {129, 91, 62, 255, 1},
-        {131, 93, 63, 255, 5},
-        {130, 89, 56, 255, 1},
-        {140, 122, 109, 255, 1},
-        {147, 150, 152, 255, 1},
-        {146, 146, 146, 255, 1},
-        {145, 148, 151, 255, 1},
-        {156, 130, 109, 255, 1},
-        {164, 115, 75, 255, 1},
-        {163, 117, 80, 255, 1},
-        {165, 119, 81, 255, 1},
-        {145, 104, 70, 255, 1},
-        {129, 91, 62, 255, 1},
-        {131, 93, 63, 255, 1},
-        {134, 95, 64, 255, 1},
-        {111, 78, 52, 255, 1},
-        {93, 64, 42, 255, 1},
-        {96, 66, 43, 255, 1},
-        {104, 71, 47, 255, 1},
-    };
-
-    static BYTE textureData[64 * 64 * 4];
-
-    BYTE* ptr = textureData;
-    for (const auto& seg : segments) {
-        for (int i = 0; i < seg.count; ++i) {
-            *ptr++ = seg.r;
-            *ptr++ = seg.g;
-            *ptr++ = seg.b;
-            *ptr++ = seg.a;
-        }
-    }
-    bool result = CreateTextureFromData(textureData, size, size, &cachedSRV);
-    *outSRV = cachedSRV;
-    return result;
-}
\ No newline at end of file
@@ -0,0 +1,214 @@
+#include "EditJournal.h"
+#include <cstdio>
+#include <cstring>
+#include <iterator>
+
+namespace {
+
+    const char MAGIC[4] = { 'H', 'V', 'H', 'J' };
+    const uint16_t VERSION = 1;
+
+    void PutF32(std::vector<char>& out, float f)
+    {
+        uint32_t v;
+        memcpy(&v, &f, sizeof(v));
+        out.push_back((char)(v & 0xFF));
+        out.push_back((char)((v >> 8) & 0xFF));
+        out.push_back((char)((v >> 16) & 0xFF));
+        out.push_back((char)((v >> 24) & 0xFF));
+    }
+
+    float GetF32(const char* p)
+    {
+        const unsigned char* b = (const unsigned char*)p;
+        uint32_t v = (uint32_t)b[0] | ((uint32_t)b[1] << 8) | ((uint32_t)b[2] << 16) | ((uint32_t)b[3] << 24);
+        float f;
+        memcpy(&f, &v, sizeof(f));
+        return f;
+    }
+
+    void PutName(std::vector<char>& out, const std::string& name)
+    {
+        size_t len = name.size() < 255 ? name.size() : 255;
+        out.push_back((char)len);
+        out.insert(out.end(), name.begin(), name.begin() + len);
+    }
+
+    void Encode(const EditJournal::Record& record, std::vector<char>& out)
+    {
+        out.push_back((char)record.op);
+        if (record.op == EditJournal::Op::Clear) return;
+
+        PutF32(out, record.x);
+        PutF32(out, record.y);
+        PutF32(out, record.z);
+        if (record.op == EditJournal::Op::Add) PutName(out, record.blockName);
+    }
+
+    std::vector<char> Header(const std::string& baseMap)
+    {
+        std::vector<char> out(MAGIC, MAGIC + 4);
+        out.push_back((char)(VERSION & 0xFF));
+        out.push_back((char)(VERSION >> 8));
+        PutName(out, baseMap);
+        return out;
+    }
+}
+
+bool EditJournal::Begin(const std::string& journalPath, const std::string& baseMap)
+{
+    Close();
+    path = journalPath;
+    file.open(path, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) return false;
+
+    std::vector<char> header = Header(baseMap);
+    file.write(header.data(), (std::streamsize)header.size());
+    file.flush();
+    written = header.size();
+    lastFlush = std::chrono::steady_clock::now();
+    return file.good();
+}
+
+void EditJournal::Close()
+{
+    if (file.is_open()) {
+        Flush();
+        file.close();
+    }
+    pending.clear();
+    sinceSnapshot.clear();
+    snapshotMarked = false;
+    written = 0;
+}
+
+void EditJournal::Discard()
+{
+    Close();
+    if (!path.empty()) std::remove(path.c_str());
+}
+
+void EditJournal::Append(const Record& record)
+{
+    if (!file.is_open()) return;
+
+    size_t start = pending.size();
+    Encode(record, pending);
+    if (snapshotMarked) {
+        sinceSnapshot.insert(sinceSnapshot.end(), pending.begin() + start, pending.end());
+    }
+}
+
+void EditJournal::Add(float x, float y, float z, const std::string& blockName)
+{
+    Record record;
+    record.op = Op::Add;
+    record.x = x; record.y = y; record.z = z;
+    record.blockName = blockName;
+    Append(record);
+}
+
+void EditJournal::Remove(float x, float y, float z)
+{
+    Record record;
+    record.op = Op::Remove;
+    record.x = x; record.y = y; record.z = z;
+    Append(record);
+}
+
+void EditJournal::Clear()
+{
+    Record record;
+    record.op = Op::Clear;
+    Append(record);
+}
+
+void EditJournal::Update()
+{
+    if (pending.empty()) return;
+
+    auto now = std::chrono::steady_clock::now();
+    if (pending.size() >= FLUSH_BYTES ||
+        std::chrono::duration<float>(now - lastFlush).count() >= FLUSH_INTERVAL) {
+        Flush();
+    }
+}
+
+void EditJournal::Flush()
+{
+    lastFlush = std::chrono::steady_clock::now();
+    if (!file.is_open() || pending.empty()) return;
+
+    // reaches the OS right away, so a crash of the game loses at most one interval
+    file.write(pending.data(), (std::streamsize)pending.size());
+    file.flush();
+    written += pending.size();
+    pending.clear();
+}
+
+void EditJournal::MarkSnapshot()
+{
+    sinceSnapshot.clear();
+    snapshotMarked = file.is_open();
+}
+
+void EditJournal::CancelSnapshot()
+{
+    sinceSnapshot.clear();
+    snapshotMarked = false;
+}
+
+bool EditJournal::Rebase(const std::string& baseMap)
+{
+    if (!snapshotMarked) return false;
+
+    std::vector<char> keep;
+    keep.swap(sinceSnapshot);
+    std::string journalPath = path;
+    if (!Begin(journalPath, baseMap)) return false;
+
+    file.write(keep.data(), (std::streamsize)keep.size());
+    file.flush();
+    written += keep.size();
+    return file.good();
+}
+
+bool EditJournal::Read(const std::string& journalPath, std::string& baseMap, std::vector<Record>& records)
+{
+    std::ifstream in(journalPath, std::ios::binary);
+    if (!in.is_open()) return false;
+    std::vector<char> data((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+
+    if (data.size() < 7 || memcmp(data.data(), MAGIC, 4) != 0) return false;
+    if ((uint16_t)((unsigned char)data[4] | ((unsigned char)data[5] << 8)) != VERSION) return false;
+
+    size_t pos = 6;
+    size_t len = (unsigned char)data[pos++];
+    if (pos + len > data.size()) return false;
+    baseMap.assign(data.data() + pos, len);
+    pos += len;
+
+    while (pos < data.size()) {
+        Record record;
+        record.op = (Op)data[pos];
+        size_t next = pos + 1;
+        if (record.op != Op::Clear) {
+            if (record.op != Op::Add && record.op != Op::Remove) break;
+            if (next + 12 > data.size()) break;
+            record.x = GetF32(data.data() + next);
+            record.y = GetF32(data.data() + next + 4);
+            record.z = GetF32(data.data() + next + 8);
+            next += 12;
+            if (record.op == Op::Add) {
+                if (next >= data.size()) break;
+                size_t nameLen = (unsigned char)data[next++];
+                if (next + nameLen > data.size()) break;
+                record.blockName.assign(data.data() + next, nameLen);
+                next += nameLen;
+            }
+        }
+        records.push_back(record);
+        pos = next;
+    }
+    return true;
+}
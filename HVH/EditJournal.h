@@ -0,0 +1,64 @@
+#pragma once
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// Append-only log of block edits made since the map was last written in full.
+// File: "HVHJ", u16 version, u8 length + base map name (empty = the built-in
+// course), then records: u8 op, f32 x, y, z for Add/Remove, u8 length + block
+// name for Add. A record cut short by a crash ends the log.
+class EditJournal
+{
+public:
+    enum class Op : uint8_t { Add = 1, Remove = 2, Clear = 3 };
+
+    struct Record {
+        Op op = Op::Clear;
+        float x = 0.0f, y = 0.0f, z = 0.0f;
+        std::string blockName;
+    };
+
+    static const size_t FLUSH_BYTES = 4096;
+    static constexpr float FLUSH_INTERVAL = 0.25f; // seconds
+
+    // Truncates path and starts logging edits on top of baseMap.
+    bool Begin(const std::string& path, const std::string& baseMap);
+    // Stops logging, e.g. while the world belongs to a server.
+    void Close();
+    // Closes and deletes the file, nothing left to recover.
+    void Discard();
+    bool IsOpen() const { return file.is_open(); }
+
+    // Buffered, no-ops while closed.
+    void Add(float x, float y, float z, const std::string& blockName);
+    void Remove(float x, float y, float z);
+    void Clear();
+
+    // Writes the buffer once it is big or old enough; Flush writes it now.
+    void Update();
+    void Flush();
+    // Bytes on disk plus buffered, what compaction is measured against.
+    size_t GetSize() const { return written + pending.size(); }
+
+    // Compaction: MarkSnapshot when a full save snapshots the world; once that
+    // file is written, Rebase keeps only the records that came after it.
+    void MarkSnapshot();
+    bool Rebase(const std::string& baseMap);
+    void CancelSnapshot();
+
+    // Every complete record in path. False if there is no journal there.
+    static bool Read(const std::string& path, std::string& baseMap, std::vector<Record>& records);
+
+private:
+    void Append(const Record& record);
+
+    std::string path;
+    std::ofstream file;
+    std::vector<char> pending;       // not yet written
+    std::vector<char> sinceSnapshot; // encoded records since MarkSnapshot
+    bool snapshotMarked = false;
+    size_t written = 0;
+    std::chrono::steady_clock::time_point lastFlush;
+};
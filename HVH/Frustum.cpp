@@ -0,0 +1,131 @@
+#include "Frustum.h"
+#include <cmath>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE__)
+#define HVH_FRUSTUM_SSE 1
+#include <xmmintrin.h>
+#endif
+
+void CullBoxList::Clear()
+{
+    minX.clear(); minY.clear(); minZ.clear();
+    maxX.clear(); maxY.clear(); maxZ.clear();
+}
+
+void CullBoxList::Add(float x0, float y0, float z0, float x1, float y1, float z1)
+{
+    minX.push_back(x0); minY.push_back(y0); minZ.push_back(z0);
+    maxX.push_back(x1); maxY.push_back(y1); maxZ.push_back(z1);
+}
+
+void Frustum::Extract(const float m[4][4])
+{
+    // clip = v * M, so each clip component is a column of M
+    for (int i = 0; i < 4; ++i) {
+        planes[0][i] = m[i][3] + m[i][0]; // left
+        planes[1][i] = m[i][3] - m[i][0]; // right
+        planes[2][i] = m[i][3] + m[i][1]; // bottom
+        planes[3][i] = m[i][3] - m[i][1]; // top
+        planes[4][i] = m[i][2];           // near
+        planes[5][i] = m[i][3] - m[i][2]; // far
+    }
+
+    for (int p = 0; p < 6; ++p) {
+        float len = sqrtf(planes[p][0] * planes[p][0] + planes[p][1] * planes[p][1] + planes[p][2] * planes[p][2]);
+        if (len > 0.0f) {
+            for (int i = 0; i < 4; ++i) planes[p][i] /= len;
+        }
+    }
+}
+
+void Frustum::SetViewDistance(const float e[3], float maxDistance)
+{
+    eye[0] = e[0]; eye[1] = e[1]; eye[2] = e[2];
+    maxDistanceSq = maxDistance > 0.0f ? maxDistance * maxDistance : 0.0f;
+}
+
+bool Frustum::TestBox(float x0, float y0, float z0, float x1, float y1, float z1) const
+{
+    for (int p = 0; p < 6; ++p) {
+        // corner furthest along the plane normal
+        float px = planes[p][0] > 0.0f ? x1 : x0;
+        float py = planes[p][1] > 0.0f ? y1 : y0;
+        float pz = planes[p][2] > 0.0f ? z1 : z0;
+        if (planes[p][0] * px + planes[p][1] * py + planes[p][2] * pz + planes[p][3] < 0.0f) {
+            return false;
+        }
+    }
+
+    if (maxDistanceSq > 0.0f) {
+        float dx = fmaxf(fmaxf(x0 - eye[0], eye[0] - x1), 0.0f);
+        float dy = fmaxf(fmaxf(y0 - eye[1], eye[1] - y1), 0.0f);
+        float dz = fmaxf(fmaxf(z0 - eye[2], eye[2] - z1), 0.0f);
+        if (dx * dx + dy * dy + dz * dz > maxDistanceSq) return false;
+    }
+    return true;
+}
+
+size_t Frustum::CullBoxes(const CullBoxList& boxes, std::vector<uint8_t>& visible) const
+{
+    const size_t count = boxes.Size();
+    visible.resize(count);
+    size_t visibleCount = 0;
+    size_t i = 0;
+
+#ifdef HVH_FRUSTUM_SSE
+    const __m128 zero = _mm_setzero_ps();
+    const __m128 eyeX = _mm_set1_ps(eye[0]), eyeY = _mm_set1_ps(eye[1]), eyeZ = _mm_set1_ps(eye[2]);
+    const __m128 maxDist = _mm_set1_ps(maxDistanceSq);
+
+    for (; i + 4 <= count; i += 4) {
+        __m128 x0 = _mm_loadu_ps(&boxes.minX[i]), x1 = _mm_loadu_ps(&boxes.maxX[i]);
+        __m128 y0 = _mm_loadu_ps(&boxes.minY[i]), y1 = _mm_loadu_ps(&boxes.maxY[i]);
+        __m128 z0 = _mm_loadu_ps(&boxes.minZ[i]), z1 = _mm_loadu_ps(&boxes.maxZ[i]);
+
+        __m128 inside = _mm_cmpeq_ps(zero, zero); // all ones
+        for (int p = 0; p < 6; ++p) {
+            __m128 px = planes[p][0] > 0.0f ? x1 : x0;
+            __m128 py = planes[p][1] > 0.0f ? y1 : y0;
+            __m128 pz = planes[p][2] > 0.0f ? z1 : z0;
+            __m128 d = _mm_add_ps(
+                _mm_add_ps(_mm_mul_ps(_mm_set1_ps(planes[p][0]), px), _mm_mul_ps(_mm_set1_ps(planes[p][1]), py)),
+                _mm_add_ps(_mm_mul_ps(_mm_set1_ps(planes[p][2]), pz), _mm_set1_ps(planes[p][3])));
+            inside = _mm_and_ps(inside, _mm_cmpge_ps(d, zero));
+        }
+
+        if (maxDistanceSq > 0.0f) {
+            __m128 dx = _mm_max_ps(_mm_max_ps(_mm_sub_ps(x0, eyeX), _mm_sub_ps(eyeX, x1)), zero);
+            __m128 dy = _mm_max_ps(_mm_max_ps(_mm_sub_ps(y0, eyeY), _mm_sub_ps(eyeY, y1)), zero);
+            __m128 dz = _mm_max_ps(_mm_max_ps(_mm_sub_ps(z0, eyeZ), _mm_sub_ps(eyeZ, z1)), zero);
+            __m128 d2 = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz));
+            inside = _mm_and_ps(inside, _mm_cmple_ps(d2, maxDist));
+        }
+
+        int bits = _mm_movemask_ps(inside);
+        for (int k = 0; k < 4; ++k) {
+            uint8_t v = (uint8_t)((bits >> k) & 1);
+            visible[i + k] = v;
+            visibleCount += v;
+        }
+    }
+#endif
+
+    return visibleCount + CullRange(boxes, i, count, visible);
+}
+
+size_t Frustum::CullBoxesReference(const CullBoxList& boxes, std::vector<uint8_t>& visible) const
+{
+    visible.resize(boxes.Size());
+    return CullRange(boxes, 0, boxes.Size(), visible);
+}
+
+size_t Frustum::CullRange(const CullBoxList& boxes, size_t begin, size_t end, std::vector<uint8_t>& visible) const
+{
+    size_t visibleCount = 0;
+    for (size_t i = begin; i < end; ++i) {
+        bool v = TestBox(boxes.minX[i], boxes.minY[i], boxes.minZ[i], boxes.maxX[i], boxes.maxY[i], boxes.maxZ[i]);
+        visible[i] = v ? 1 : 0;
+        visibleCount += v ? 1 : 0;
+    }
+    return visibleCount;
+}
@@ -0,0 +1,40 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+// Boxes stored as separate min/max arrays so four of them can be tested at once.
+struct CullBoxList {
+    std::vector<float> minX, minY, minZ;
+    std::vector<float> maxX, maxY, maxZ;
+
+    void Clear();
+    void Add(float x0, float y0, float z0, float x1, float y1, float z1);
+    size_t Size() const { return minX.size(); }
+};
+
+// View frustum plus an optional view distance, tested against AABBs.
+// Uses SSE when the target has it, a scalar loop otherwise.
+class Frustum
+{
+public:
+    // viewProj is row-major for row vectors (XMMATRIX layout, D3D 0..1 depth).
+    void Extract(const float viewProj[4][4]);
+    // Boxes farther than maxDistance from eye are rejected too; <= 0 disables it.
+    void SetViewDistance(const float eye[3], float maxDistance);
+
+    bool TestBox(float x0, float y0, float z0, float x1, float y1, float z1) const;
+
+    // Writes 1/0 per box into visible (resized to boxes.Size()), returns the visible count.
+    size_t CullBoxes(const CullBoxList& boxes, std::vector<uint8_t>& visible) const;
+    // The scalar fallback on its own, one TestBox per box. CullBoxes must
+    // agree with it box for box; the tests check that.
+    size_t CullBoxesReference(const CullBoxList& boxes, std::vector<uint8_t>& visible) const;
+
+private:
+    size_t CullRange(const CullBoxList& boxes, size_t begin, size_t end, std::vector<uint8_t>& visible) const;
+
+    float planes[6][4] = {};   // nx, ny, nz, d with inside = dot(n, p) + d >= 0
+    float eye[3] = {};
+    float maxDistanceSq = 0.0f;
+};
@@ -1,6 +1,7 @@
 ﻿#include "GameEngine.h"
 #include "SafeRelease.h"
 #include "map1.h"
+#include "MapFile.h"
 #include "Settings.h"
 #include <wincodec.h>
 #pragma comment(lib, "windowscodecs.lib")
@@ -139,9 +140,7 @@ void GameEngine::SetGameMode(GameMode mode) {
         inventoryBlocks.clear();
     }
     else if (gameMode == BUILD_MODE) {
-        inventoryBlocks = {
-            "grass", "stone", "wood", "metal", "brick", "dirt", "water", "lava", "cube"
-        };
+        inventoryBlocks = BlockRegistry::GetCreativeBlocks();
     }
 }
 
@@ -238,19 +237,10 @@ bool GameEngine::CheckCameraCollision(const XMFLOAT3& cameraPos, float radius) c
         cameraPos.y + radius,
         cameraPos.z + radius
     };
-    for (const auto& obj : mapObjects)
+    std::vector<AABB> blockBoxes;
+    CollectBlockBoxes(cameraAABB, blockBoxes);
+    for (const AABB& blockAABB : blockBoxes)
     {
-        AABB blockAABB;
-        blockAABB.min = {
-            obj.position.x - obj.scale.x,
-            obj.position.y - obj.scale.y,
-            obj.position.z - obj.scale.z
-        };
-        blockAABB.max = {
-            obj.position.x + obj.scale.x,
-            obj.position.y + obj.scale.y,
-            obj.position.z + obj.scale.z
-        };
         bool intersect =
             cameraAABB.min.x <= blockAABB.max.x &&
             cameraAABB.max.x >= blockAABB.min.x &&
@@ -278,7 +268,7 @@ void GameEngine::UpdateCamera()
     if (thirdPerson)
     {
         // thirdperson
-        XMVECTOR playerPosVec = XMLoadFloat3(&playerPos);
+        XMVECTOR playerPosVec = XMLoadFloat3(&renderPlayerPos);
         XMVECTOR desiredEye = XMVectorSubtract(playerPosVec, XMVectorScale(lookDir, thirdPersonDistance));
         desiredEye = XMVectorSetY(desiredEye, XMVectorGetY(desiredEye) + 1.6f);
 
@@ -288,7 +278,7 @@ void GameEngine::UpdateCamera()
     }
     else // firstperson
     {
-        XMVECTOR playerPosVec = XMLoadFloat3(&playerPos);
+        XMVECTOR playerPosVec = XMLoadFloat3(&renderPlayerPos);
         float eyeHeight = 1.8f;
   
         XMVECTOR baseEye = XMVectorAdd(playerPosVec, XMVectorSet(0.0f, eyeHeight, 0.0f, 0.0f));
@@ -318,170 +308,33 @@ void GameEngine::UpdateCamera()
 }
 void GameEngine::Physics(float dt)
 {
-    float playerHeight = 1.8f;
     float eyeHeight = 1.6f;
-    float playerHalfWidth = 0.3f;
 
-    XMFLOAT3 currentVel = velocity;
+    PlayerBody body;
+    body.position[0] = playerPos.x; body.position[1] = playerPos.y; body.position[2] = playerPos.z;
+    body.velocity[0] = velocity.x; body.velocity[1] = velocity.y; body.velocity[2] = velocity.z;
+    body.grounded = isGrounded;
 
-    bool prevGrounded = isGrounded;
+    PlayerMove move;
+    move.wishX = wishDir.x;
+    move.wishZ = wishDir.z;
+    move.speed = currentSpeed;
+    move.fly = flyMode;
 
-    if (!flyMode)
-    {
-        if (!isGrounded)
-            currentVel.y -= gravity * dt;
-        else
-            currentVel.y = 0.0f;
-
-        if (isGrounded)
-        {
-            if (wishDir.x == 0.0f && wishDir.z == 0.0f)
-            {
-                currentVel.x = 0.0f;
-                currentVel.z = 0.0f;
-            }
-            else
-            {
-                currentVel.x = wishDir.x * currentSpeed;
-                currentVel.z = wishDir.z * currentSpeed;
-            }
-        }
-        else
-        {
-            float airAccel = airAcceleration * dt;
-            float wishSpeed = currentSpeed;
-
-            if (wishDir.x != 0.0f || wishDir.z != 0.0f)
-            {
-                float projVel = currentVel.x * wishDir.x + currentVel.z * wishDir.z;
-                float accelVel = airAccel * currentSpeed;
-
-                if (projVel + accelVel > currentSpeed)
-                    accelVel = currentSpeed - projVel;
-
-                if (accelVel > 0.0f)
-                {
-                    currentVel.x += accelVel * wishDir.x;
-                    currentVel.z += accelVel * wishDir.z;
-                }
-            }
-        }
-    }
-    else
-    {
-        XMVECTOR pos = XMLoadFloat3(&playerPos);
-        XMVECTOR velVec = XMLoadFloat3(&currentVel);
-        pos = XMVectorAdd(pos, XMVectorScale(velVec, dt));
-        XMStoreFloat3(&playerPos, pos);
-        cameraPosition = { playerPos.x, playerPos.y + eyeHeight, playerPos.z };
-        velocity = currentVel;
-        return;
-    }
-
-    float horizontalSpeed = sqrtf(currentVel.x * currentVel.x + currentVel.z * currentVel.z);
-    if (horizontalSpeed > currentSpeed)
-    {
-        float ratio = currentSpeed / horizontalSpeed;
-        currentVel.x *= ratio;
-        currentVel.z *= ratio;
-    }
-
-    XMVECTOR pos = XMLoadFloat3(&playerPos);
-    XMVECTOR velVec = XMLoadFloat3(&currentVel);
-    XMVECTOR newPos = XMVectorAdd(pos, XMVectorScale(velVec, dt));
-    XMFLOAT3 newPosF;
-    XMStoreFloat3(&newPosF, newPos);
-
-    AABB playerAABB;
-    playerAABB.min = { newPosF.x - playerHalfWidth, newPosF.y, newPosF.z - playerHalfWidth };
-    playerAABB.max = { newPosF.x + playerHalfWidth, newPosF.y + playerHeight, newPosF.z + playerHalfWidth };
-
-    bool collisionY = false;
-    XMFLOAT3 adjustedPos = newPosF;
-
-    for (const auto& obj : mapObjects)
-    {
-        AABB blockAABB;
-        blockAABB.min = { obj.position.x - obj.scale.x, obj.position.y - obj.scale.y, obj.position.z - obj.scale.z };
-        blockAABB.max = { obj.position.x + obj.scale.x, obj.position.y + obj.scale.y, obj.position.z + obj.scale.z };
-
-        bool intersect = playerAABB.min.x <= blockAABB.max.x && playerAABB.max.x >= blockAABB.min.x &&
-            playerAABB.min.y <= blockAABB.max.y && playerAABB.max.y >= blockAABB.min.y &&
-            playerAABB.min.z <= blockAABB.max.z && playerAABB.max.z >= blockAABB.min.z;
-
-        if (intersect)
-        {
-            float overlapX1 = playerAABB.max.x - blockAABB.min.x;
-            float overlapX2 = blockAABB.max.x - playerAABB.min.x;
-            float overlapY1 = playerAABB.max.y - blockAABB.min.y;
-            float overlapY2 = blockAABB.max.y - playerAABB.min.y;
-            float overlapZ1 = playerAABB.max.z - blockAABB.min.z;
-            float overlapZ2 = blockAABB.max.z - playerAABB.min.z;
-
-            float minOverlap = overlapY2;
-            int axis = 1;
-            if (overlapY1 < minOverlap && overlapY1 > 0) { minOverlap = overlapY1; axis = 1; }
-            if (overlapX1 < minOverlap && overlapX1 > 0) { minOverlap = overlapX1; axis = 0; }
-            if (overlapX2 < minOverlap && overlapX2 > 0) { minOverlap = overlapX2; axis = 0; }
-            if (overlapZ1 < minOverlap && overlapZ1 > 0) { minOverlap = overlapZ1; axis = 2; }
-            if (overlapZ2 < minOverlap && overlapZ2 > 0) { minOverlap = overlapZ2; axis = 2; }
-
-            if (axis == 1)
-            {
-                collisionY = true;
-
-                if (overlapY1 <= overlapY2)
-                {
-                    adjustedPos.y = blockAABB.min.y - playerHeight - 0.001f;
-                    currentVel.y = 0.0f;
-                }
-                else
-                {
-                    adjustedPos.y = blockAABB.max.y;
-                    currentVel.y = 0.0f;
-                    isGrounded = true;
-                }
-                currentVel.y = 0.0f;
-            }
-            else if (axis == 0)
-            {
-                if (overlapX1 <= overlapX2)
-                    adjustedPos.x = blockAABB.min.x - playerHalfWidth - 0.001f;
-                else
-                    adjustedPos.x = blockAABB.max.x + playerHalfWidth + 0.001f;
-                currentVel.x = 0.0f;
-            }
-            else if (axis == 2)
-            {
-                if (overlapZ1 <= overlapZ2)
-                    adjustedPos.z = blockAABB.min.z - playerHalfWidth - 0.001f;
-                else
-                    adjustedPos.z = blockAABB.max.z + playerHalfWidth + 0.001f;
-                currentVel.z = 0.0f;
-            }
-        }
-    }
+    PlayerPhysicsParams params;
+    params.gravity = gravity;
+    params.airAcceleration = airAcceleration;
 
-    const float groundEps = 0.001f;
+    bool landed = StepPlayer(body, move, params, dt, [this](const PhysicsBox& region, std::vector<PhysicsBox>& out) {
+        CollectPhysicsBoxes(region, out);
+        rigidBodies.CollectBoxes(region, out);
+        });
 
-    if (adjustedPos.y < 0.0f)
-    {
-        adjustedPos.y = 0.0f;
-        currentVel.y = 0.0f;
-        isGrounded = true;
-    }
-    else if (fabsf(adjustedPos.y - 0.0f) <= groundEps && currentVel.y <= 0.0f)
-    {
-        adjustedPos.y = 0.0f;
-        currentVel.y = 0.0f;
-        isGrounded = true;
-    }
-    else if (!collisionY)
-    {
-        isGrounded = false;
-    }
+    playerPos = { body.position[0], body.position[1], body.position[2] };
+    velocity = { body.velocity[0], body.velocity[1], body.velocity[2] };
+    isGrounded = body.grounded;
 
-    if (!prevGrounded && isGrounded && pLandSound) {
+    if (landed && pLandSound) {
         pLandSound->Stop();
         pLandSound->FlushSourceBuffers();
         pLandSound->SetVolume(g_Settings.jumpVolume);
@@ -494,12 +347,7 @@ void GameEngine::Physics(float dt)
         pLandSound->Start(0);
     }
 
-    playerPos = adjustedPos;
-    velocity = currentVel;
-
-    prevGrounded = isGrounded;
-
-    if (!thirdPerson)
+    if (flyMode || !thirdPerson)
     {
         cameraPosition = { playerPos.x, playerPos.y + eyeHeight, playerPos.z };
     }
@@ -508,6 +356,17 @@ void GameEngine::Physics(float dt)
 
 void GameEngine::RegisterCommands()
 {
+    // save, load, autosave, clear, players and netstats, the dedicated server has them too
+    HostConsole console;
+    console.store = &mapStore;
+    console.session = &hostSession;
+    console.isHosting = [this]() { return isMultiplayer && networkManager.IsServer(); };
+    console.log = [this](const std::string& text) {
+        std::lock_guard<std::recursive_mutex> lock(consoleHistoryMutex);
+        AddToHistory(text);
+        };
+    RegisterHostCommands(commands, console);
+
     commands["exit"] = [this](const auto&) { consoleActive = false; };
     commands["cls"] = [this](const auto&) {
         std::lock_guard<std::recursive_mutex> lock(consoleHistoryMutex);
@@ -529,7 +388,78 @@ void GameEngine::RegisterCommands()
             networkManager.IsClient() ? "Client" : "None"));
         AddToHistory("Connected: " + std::string(networkManager.IsConnected() ? "Yes" : "No"));
         AddToHistory("Players online: " + std::to_string(networkPlayers.size()));
-        AddToHistory("Map objects: " + std::to_string(mapObjects.size()));
+        const VoxelWorld& voxels = mapStore.GetVoxels();
+        AddToHistory("Map objects: " + std::to_string(mapStore.GetBlockCount()));
+        AddToHistory("Voxel blocks: " + std::to_string(voxels.GetBlockCount()) +
+            " in " + std::to_string(voxels.GetChunkCount()) + " chunks (" +
+            std::to_string(voxels.GetMemoryUsage() / 1024) + " KB)");
+        AddToHistory("Sparse objects: " + std::to_string(mapStore.GetObjects().size()) +
+            ", grid cells: " + std::to_string(mapStore.GetGrid().GetCellCount()));
+        AddToHistory("Inbound queue: " + std::to_string(inboundMessages.ApproxSize()) +
+            " waiting, peak " + std::to_string(netQueueStats.peakDepth) +
+            ", " + std::to_string(netQueueStats.totalProcessed) + " processed");
+        AddToHistory("Last tick: " + std::to_string(netQueueStats.lastProcessed) + " msgs in " +
+            std::to_string(netQueueStats.lastDrainMs) + " ms, latency avg " +
+            std::to_string(netQueueStats.avgLatencyMs) + " ms, max " +
+            std::to_string(netQueueStats.maxLatencyMs) + " ms");
+        if (networkManager.IsServer()) {
+            const auto& snapshotStats = hostSession.GetSnapshotStats();
+            AddToHistory("Snapshots: " + std::to_string(snapshotStats.ticks) + " ticks at " +
+                std::to_string((int)NET_TICK_RATE) + " Hz, " +
+                std::to_string((int)snapshotStats.bytesPerClient) + " bytes/s per client");
+            AddToHistory("Interpolation delay: " + std::to_string((int)(interpolationClock.GetDelay() * 1000.0)) +
+                " ms, position corrections: " + std::to_string(hostSession.GetCorrections()) +
+                " (last " + std::to_string(hostSession.GetLastCorrection()) + ")");
+            AddToHistory("World transfers in progress: " + std::to_string(hostSession.GetTransferCount()));
+        }
+        else {
+            AddToHistory("Interpolation delay: " + std::to_string((int)(interpolationClock.GetDelay() * 1000.0)) +
+                " ms, position corrections: " + std::to_string(reconcileStats.corrections) +
+                " (last " + std::to_string(reconcileStats.lastError) + ")");
+            AddToHistory("World sync: " + std::to_string(worldTransferClient.GetChunksReceived()) + "/" +
+                std::to_string(worldTransferClient.GetChunkCount()) + " chunks, spawn ready after " +
+                std::to_string((int)worldSyncStats.spawnReadyMs) + " ms, complete after " +
+                std::to_string((int)worldSyncStats.totalMs) + " ms");
+        }
+        };
+    commands["renderstats"] = [this](const auto&) {
+        size_t triangles = 0;
+        for (const auto& pair : chunkMeshes) {
+            triangles += pair.second.triangles;
+        }
+        std::lock_guard<std::recursive_mutex> lock(consoleHistoryMutex);
+        AddToHistory("=== Render Stats ===");
+        AddToHistory("Chunk meshes: " + std::to_string(chunkMeshes.size()) +
+            ", triangles: " + std::to_string(triangles) +
+            (greedyMeshing ? " (greedy)" : " (per face)"));
+        AddToHistory("Last remesh: " + std::to_string(lastRemeshCount) + " chunks in " +
+            std::to_string(lastRemeshMs) + " ms");
+        AddToHistory("Instanced objects: " + std::to_string(blockInstances.instances.size()) +
+            " in " + (blockInstances.instances.empty() ? "no draws" : "1 draw"));
+        AddToHistory("Culled chunks: " + std::to_string(cullCounters.chunksVisible) + "/" +
+            std::to_string(cullCounters.chunksTested) + " visible, objects: " +
+            std::to_string(cullCounters.objectsVisible) + "/" + std::to_string(cullCounters.objectsTested) +
+            ", players: " + std::to_string(cullCounters.playersVisible) + "/" +
+            std::to_string(cullCounters.playersTested) + (frustumCulling ? "" : " (culling off)"));
+        };
+    commands["culling"] = [this](const auto&) {
+        frustumCulling = !frustumCulling;
+        std::lock_guard<std::recursive_mutex> lock(consoleHistoryMutex);
+        AddToHistory(frustumCulling ? "Frustum culling enabled" : "Frustum culling disabled");
+        };
+    commands["viewdistance"] = [this](const auto& args) {
+        if (args.size() > 1) {
+            try { viewDistance = std::stof(args[1]); }
+            catch (...) {}
+        }
+        std::lock_guard<std::recursive_mutex> lock(consoleHistoryMutex);
+        AddToHistory("View distance: " + std::to_string(viewDistance));
+        };
+    commands["greedymesh"] = [this](const auto&) {
+        greedyMeshing = !greedyMeshing;
+        mapStore.GetVoxels().MarkAllDirty();
+        std::lock_guard<std::recursive_mutex> lock(consoleHistoryMutex);
+        AddToHistory(greedyMeshing ? "Greedy meshing enabled" : "Greedy meshing disabled");
         };
     commands["host"] = [this](const auto& args) {
         int port = 27015;
@@ -540,6 +470,9 @@ void GameEngine::RegisterCommands()
 
         if (networkManager.StartServer(port)) {
             isMultiplayer = true;
+            localPlayerId = -1;
+            hostSession.Reset();
+            interpolationClock.Reset();
             {
                 std::lock_guard<std::recursive_mutex> lock(consoleHistoryMutex);
                 AddToHistory("Server started on port " + std::to_string(port));
@@ -606,8 +539,13 @@ void GameEngine::RegisterCommands()
                 std::lock_guard<std::recursive_mutex> lock(consoleHistoryMutex);
                 AddToHistory("Connected to " + ip + ":" + std::to_string(port));
             }
-            networkManager.SendData("JOIN");
+            networkManager.SendData(NetMessage::Simple(NetMessageType::Join));
             isSynchronized = false;
+            localPlayerId = -2; // unassigned until ASSIGN_ID, -1 is the host
+            snapshotClient.Reset();
+            worldTransferClient.Reset();
+            interpolationClock.Reset();
+            prediction.Reset();
         }
         else {
             std::lock_guard<std::recursive_mutex> lock(consoleHistoryMutex);
@@ -620,25 +558,23 @@ void GameEngine::RegisterCommands()
         }
         };
     commands["disconnect"] = [this](const auto&) {
-        networkManager.SendData("LEAVE");
+        networkManager.SendData(NetMessage::Simple(NetMessageType::Leave));
         networkManager.Disconnect();
         isMultiplayer = false;
         networkPlayers.clear();
+        hostSession.Reset();
+        snapshotClient.Reset();
+        worldTransferClient.Reset();
+        interpolationClock.Reset();
+        prediction.Reset();
+        localPlayerId = -1;
+        {
+            InboundMessage stale;
+            while (inboundMessages.Pop(stale)) {}
+        }
         std::lock_guard<std::recursive_mutex> lock(consoleHistoryMutex);
         AddToHistory("Disconnected from multiplayer");
         };
-    commands["players"] = [this](const auto&) {
-        std::lock_guard<std::recursive_mutex> lock(consoleHistoryMutex);
-        if (!isMultiplayer) {
-            AddToHistory("Not in multiplayer mode");
-            return;
-        }
-        auto players = networkManager.GetConnectedPlayers();
-        AddToHistory("Connected players: " + std::to_string(players.size()));
-        for (const auto& player : players) {
-            AddToHistory("  " + player);
-        }
-        };
     commands["fov"] = [this](const auto& args) {
         if (args.size() > 1) {
             try {
@@ -695,90 +631,62 @@ void GameEngine::RegisterCommands()
             AddToHistory("Current gravity: " + std::to_string(gravity));
         }
         };
-    commands["save"] = [this](const auto& args) {
+    commands["mapinfo"] = [this](const auto& args) {
+        std::lock_guard<std::recursive_mutex> lock(consoleHistoryMutex);
         if (args.size() < 2) {
-            std::lock_guard<std::recursive_mutex> lock(consoleHistoryMutex);
-            AddToHistory("Usage: save <filename>");
+            AddToHistory("Usage: mapinfo <filename>");
             return;
         }
 
-        std::vector<ParkourObject> parkourObjects;
-        for (const auto& obj : mapObjects) {
-            ParkourObject pObj;
-            pObj.position = obj.position;
-            pObj.rotation = obj.rotation;
-            pObj.scale = obj.scale;
-            pObj.type = obj.type;
-            pObj.color = { 1.0f, 1.0f, 1.0f, 1.0f }; // Default color
-            parkourObjects.push_back(pObj);
-        }
-
-        if (ParkourMap::SaveParkourCourse(parkourObjects, args[1])) {
-            std::lock_guard<std::recursive_mutex> lock(consoleHistoryMutex);
-            AddToHistory("Map saved to Documents/HVHproject/" + args[1]);
-        }
-        else {
-            std::lock_guard<std::recursive_mutex> lock(consoleHistoryMutex);
-            AddToHistory("Failed to save map to Documents/HVHproject/" + args[1]);
-        }
-        };
-
-    commands["load"] = [this](const auto& args) {
-        if (args.size() < 2) {
-            std::lock_guard<std::recursive_mutex> lock(consoleHistoryMutex);
-            AddToHistory("Usage: load <filename>");
+        // header and directory only, no chunk is decoded
+        MapFileReader reader;
+        MapFileStatus status = reader.Open(ParkourMap::GetMapPath(args[1]));
+        if (status == MapFileStatus::NotMapFile) {
+            AddToHistory(args[1] + " is a text map, it is converted when saved again");
             return;
         }
-
-        std::vector<ParkourObject> parkourObjects = ParkourMap::LoadParkourCourse(args[1]);
-        if (parkourObjects.empty()) {
-            std::lock_guard<std::recursive_mutex> lock(consoleHistoryMutex);
-            AddToHistory("Failed to load map from Documents/HVHproject/" + args[1]);
+        if (status != MapFileStatus::Ok) {
+            AddToHistory("Can't read map " + args[1]);
             return;
         }
-
-        mapObjects.clear();
-        for (const auto& pObj : parkourObjects) {
-            MapObject obj;
-            obj.position = pObj.position;
-            obj.rotation = pObj.rotation;
-            obj.scale = pObj.scale;
-            obj.type = pObj.type;
-            mapObjects.push_back(obj);
-        }
-
-        std::lock_guard<std::recursive_mutex> lock(consoleHistoryMutex);
-        AddToHistory("Map loaded from Documents/HVHproject/" + args[1]);
-
-        if (isMultiplayer && networkManager.IsServer()) {
-            for (const auto& obj : mapObjects) {
-                std::string blockData = "BLOCK:ADD|" +
-                    std::to_string(obj.position.x) + "," +
-                    std::to_string(obj.position.y) + "," +
-                    std::to_string(obj.position.z) + "|" +
-                    obj.type;
-                networkManager.BroadcastData(blockData);
-            }
-            AddToHistory("Map sync broadcasted to all clients");
-        }
+        AddToHistory(args[1] + ": " + std::to_string(reader.GetBlockCount()) + " blocks in " +
+            std::to_string(reader.GetChunkCount()) + " chunks, " +
+            std::to_string(reader.GetObjects().size()) + " objects, " +
+            std::to_string(reader.GetFileSize() / 1024) + " KB");
         };
     commands["addcube"] = [this](const auto&) {
-        MapObject obj;
-        obj.position = { floorf(cameraPosition.x + 0.5f), 1.0f, floorf(cameraPosition.z + 0.5f) };
-        obj.rotation = { 0.f, 0.f, 0.f };
-        obj.scale = { 1.f, 1.f, 1.f };
-        obj.type = "cube";
-        mapObjects.push_back(obj);
+        XMFLOAT3 position = { floorf(cameraPosition.x + 0.5f), 1.0f, floorf(cameraPosition.z + 0.5f) };
         std::lock_guard<std::recursive_mutex> lock(consoleHistoryMutex);
+        if (!mapStore.AddBlock(position.x, position.y, position.z, BlockRegistry::Find("cube"))) {
+            AddToHistory("There is already a block there");
+            return;
+        }
         AddToHistory("Cube added at " +
-            std::to_string((int)obj.position.x) + "," +
-            std::to_string((int)obj.position.y) + "," +
-            std::to_string((int)obj.position.z));
+            std::to_string((int)position.x) + "," +
+            std::to_string((int)position.y) + "," +
+            std::to_string((int)position.z));
+        };
+    commands["fps_max"] = [this](const auto& args) {
+        std::lock_guard<std::recursive_mutex> lock(consoleHistoryMutex);
+        if (args.size() > 1) {
+            try {
+                g_Settings.maxFps = (std::max)(0, std::stoi(args[1]));
+                SaveSettings();
+            }
+            catch (...) {
+                AddToHistory("Usage: fps_max <frames per second, 0 = vsync only>");
+                return;
+            }
+        }
+        AddToHistory("Frame limit: " + (g_Settings.maxFps > 0 ? std::to_string(g_Settings.maxFps) + " fps" :
+            std::string("vsync only")));
         };
-    commands["clear"] = [this](const auto&) {
-        mapObjects.clear();
+    commands["simstats"] = [this](const auto&) {
         std::lock_guard<std::recursive_mutex> lock(consoleHistoryMutex);
-        AddToHistory("Map cleared");
+        AddToHistory("Simulation: " + std::to_string(simClock.GetTickRate()) + " Hz, tick " +
+            std::to_string(simClock.GetTick()));
+        AddToHistory("Tick cost: " + std::to_string(tickMilliseconds) + " ms");
+        AddToHistory("Dropped after hitches: " + std::to_string(simClock.GetDroppedSeconds()) + " s");
         };
     commands["volume"] = [this](const auto& args) {
         if (args.size() > 1) {
@@ -798,29 +706,68 @@ void GameEngine::RegisterCommands()
             AddToHistory("Current jump volume: " + std::to_string(GetJumpVolume()));
         }
         };
+    commands["bodies"] = [this](const auto& args) {
+        std::lock_guard<std::recursive_mutex> lock(consoleHistoryMutex);
+        if (args.size() > 1) {
+            try {
+                rigidBodies.SetThreadCount(std::stoi(args[1]));
+            }
+            catch (...) {
+                AddToHistory("Usage: bodies [threads]");
+                return;
+            }
+        }
+        const RigidBodyStats& stats = rigidBodies.GetStats();
+        AddToHistory("Rigid bodies: " + std::to_string(stats.bodies) + ", awake " + std::to_string(stats.awake) +
+            ", step " + std::to_string(stats.milliseconds) + " ms on " + std::to_string(stats.threads) + " of " +
+            std::to_string(rigidBodies.GetThreadCount()) + " threads (split from " +
+            std::to_string(RigidBodyWorld::PARALLEL_MIN_BODIES) + " awake)");
+        };
+    commands["spawnbodies"] = [this](const auto& args) {
+        std::lock_guard<std::recursive_mutex> lock(consoleHistoryMutex);
+        int count = 100;
+        if (args.size() > 1) {
+            try {
+                count = std::stoi(args[1]);
+            }
+            catch (...) {
+                count = -1;
+            }
+        }
+        if (count < 0 || count > 20000) {
+            AddToHistory("Usage: spawnbodies [count], up to 20000 at a time");
+            return;
+        }
+        // a column of balls and crates above the player, for stress tests
+        BlockId metal = BlockRegistry::Intern("metal");
+        BlockId wood = BlockRegistry::Intern("wood");
+        for (int i = 0; i < count; ++i) {
+            const float position[3] = {
+                playerPos.x + (float)(i % 8) - 3.5f,
+                playerPos.y + 6.0f + (float)(i / 64) * 1.5f,
+                playerPos.z + (float)((i / 8) % 8) - 3.5f
+            };
+            if (i % 2 == 0) {
+                rigidBodies.AddSphere(position, 0.35f, metal);
+            }
+            else {
+                const float halfExtents[3] = { 0.35f, 0.35f, 0.35f };
+                rigidBodies.AddBox(position, halfExtents, wood);
+            }
+        }
+        AddToHistory("Spawned " + std::to_string(count) + " bodies, " +
+            std::to_string(rigidBodies.GetCount()) + " in total");
+        };
     commands["restart"] = [this](const auto&) {
-        mapObjects.clear();
+        mapStore.Clear();
         parkourObjects = ParkourMap::CreateParkourCourse();
-        parkourBalls = ParkourMap::CreateParkourBalls();
-        for (const auto& parkourObj : parkourObjects) {
-            MapObject obj;
-            obj.position = parkourObj.position;
-            obj.rotation = parkourObj.rotation;
-            obj.scale = parkourObj.scale;
-            obj.type = parkourObj.type;
-            mapObjects.push_back(obj);
-        }
-        for (const auto& ball : parkourBalls) {
-            MapObject obj;
-            obj.position = ball.position;
-            obj.rotation = ball.rotation;
-            obj.scale = ball.scale;
-            obj.type = ball.type;
-            mapObjects.push_back(obj);
-        }
+        for (const auto& parkourObj : parkourObjects) mapStore.AddObject(parkourObj);
+        SpawnParkourBalls();
         playerPos = { 0.f, 0.f, 0.f };
         velocity = { 0.f, 0.f, 0.f };
         isGrounded = false;
+        pendingTeleport = true;
+        mapStore.GetJournal().Begin(mapStore.GetJournalPath(), "");
         std::lock_guard<std::recursive_mutex> lock(consoleHistoryMutex);
         AddToHistory("Map reloaded");
         };
@@ -873,9 +820,7 @@ void GameEngine::RegisterCommands()
             };
 
     commands["sky_default"] = [this](const std::vector<std::string>& args) {
-        skybox.SetHorizonColor(0.7f, 0.8f, 0.9f);
-        skybox.SetZenithColor(0.1f, 0.2f, 0.4f);
-        skybox.SetHazeColor(0.4f, 0.3f, 0.2f);
+        skybox.SetColors(XMFLOAT3(0.7f, 0.8f, 0.9f), XMFLOAT3(0.1f, 0.2f, 0.4f), XMFLOAT3(0.4f, 0.3f, 0.2f));
         horizon.SetFogColorNear(0.95f, 0.95f, 0.98f);
         horizon.SetFogColorFar(0.9f, 0.92f, 1.0f);
         ApplyLighting(
@@ -885,206 +830,128 @@ void GameEngine::RegisterCommands()
         );
         AddToHistory("Default sky colors and lighting restored");
         };
+    commands["skybench"] = [this](const auto& args) {
+        std::lock_guard<std::recursive_mutex> lock(consoleHistoryMutex);
+        if (args.size() > 1) {
+            try {
+                skybox.SetGeneratorThreads(std::stoi(args[1]));
+            }
+            catch (...) {
+                AddToHistory("Usage: skybench [threads]");
+                return;
+            }
+        }
+        // the default sky through the scalar reference, then the SIMD path
+        const SkyColors colors = { { 0.7f, 0.8f, 0.9f }, { 0.1f, 0.2f, 0.4f }, { 0.4f, 0.3f, 0.2f } };
+        const int size = SKY_FACE_SIZE;
+        std::vector<uint8_t> reference((size_t)size * size * 6 * 4), fast;
+
+        auto start = std::chrono::steady_clock::now();
+        for (int row = 0; row < size * 6; ++row) {
+            GenerateSkyRowReference(colors, row / size, row % size, size, reference.data() + (size_t)row * size * 4);
+        }
+        auto mid = std::chrono::steady_clock::now();
+        GenerateSky(colors, size, skybox.GetGeneratorPool(), fast);
+        auto end = std::chrono::steady_clock::now();
+
+        int maxDiff = 0;
+        size_t differing = 0;
+        for (size_t i = 0; i < reference.size(); ++i) {
+            int diff = abs((int)reference[i] - (int)fast[i]);
+            maxDiff = (std::max)(maxDiff, diff);
+            if (diff) ++differing;
+        }
+        AddToHistory("Sky: reference " + std::to_string(std::chrono::duration<float, std::milli>(mid - start).count()) +
+            " ms, SIMD on " + std::to_string(skybox.GetGeneratorThreads()) + " threads " +
+            std::to_string(std::chrono::duration<float, std::milli>(end - mid).count()) + " ms");
+        AddToHistory("Max channel difference " + std::to_string(maxDiff) + ", " + std::to_string(differing) +
+            " of " + std::to_string(reference.size()) + " bytes differ");
+        float lastMs = skybox.GetLastGenerateMs();
+        AddToHistory("Last sky update: " + (lastMs > 0.0f ? std::to_string(lastMs) + " ms" : std::string("from cache")) +
+            ", " + std::to_string(skybox.GetCachedCount()) + "/" + std::to_string(Skybox::SKY_CACHE_SIZE) + " skies cached");
+        };
+    commands["sky_mode"] = [this](const auto& args) {
+        std::lock_guard<std::recursive_mutex> lock(consoleHistoryMutex);
+        if (args.size() > 1) {
+            if (args[1] == "baked") skybox.SetMode(Skybox::Mode::Baked);
+            else if (args[1] == "analytic") skybox.SetMode(Skybox::Mode::Analytic);
+            else {
+                AddToHistory("Usage: sky_mode [baked|analytic] [fade seconds]");
+                return;
+            }
+        }
+        if (args.size() > 2) {
+            try {
+                skybox.SetFadeTime(std::stof(args[2]));
+            }
+            catch (...) {
+                AddToHistory("Usage: sky_mode [baked|analytic] [fade seconds]");
+                return;
+            }
+        }
+        // analytic: presets are a constant buffer write and fade in
+        bool analytic = skybox.GetMode() == Skybox::Mode::Analytic;
+        AddToHistory(std::string("Sky mode: ") + (analytic ? "analytic" : "baked") +
+            (analytic ? ", fades over " + std::to_string(skybox.GetFadeTime()) + " s" : std::string()));
+        };
 
     commands["world_preset"] = [this](const std::vector<std::string>& args) {
         if (args.size() < 2) {
             AddToHistory("Usage: world_preset <name>");
-            AddToHistory("Available presets: default, sunset, storm, day, night, mars, fantasy, arctic, morning, evening, winter, autumn, tropical, desert, cherry, ocean, lavender, candy, neon, moonlight");
+            AddToHistory("Available presets: " + worldPresets.ListNames());
             return;
         }
 
-        std::string preset = args[1];
-
-        if (preset == "default") {
-            skybox.SetHorizonColor(0.7f, 0.8f, 0.9f);
-            skybox.SetZenithColor(0.1f, 0.2f, 0.4f);
-            skybox.SetHazeColor(0.4f, 0.3f, 0.2f);
-            horizon.SetFogColorNear(0.95f, 0.95f, 0.98f);
-            horizon.SetFogColorFar(0.9f, 0.92f, 1.0f);
-            ApplyLighting(XMFLOAT3(0.4f, -0.7f, 0.3f), XMFLOAT3(1.0f, 0.98f, 0.95f), XMFLOAT3(0.2f, 0.2f, 0.25f));
-            AddToHistory("Default preset applied");
-        }
-        else if (preset == "sunset") {
-            skybox.SetHorizonColor(1.0f, 0.5f, 0.3f);
-            skybox.SetZenithColor(0.3f, 0.1f, 0.4f);
-            skybox.SetHazeColor(0.8f, 0.4f, 0.2f);
-            horizon.SetFogColorNear(1.0f, 0.7f, 0.5f);
-            horizon.SetFogColorFar(0.8f, 0.5f, 0.3f);
-            ApplyLighting(XMFLOAT3(0.2f, -0.5f, 0.3f), XMFLOAT3(1.0f, 0.6f, 0.4f), XMFLOAT3(0.4f, 0.3f, 0.2f));
-            AddToHistory("Sunset preset applied with warm lighting");
-        }
-        else if (preset == "storm") {
-            skybox.SetHorizonColor(0.4f, 0.4f, 0.5f);
-            skybox.SetZenithColor(0.1f, 0.1f, 0.2f);
-            skybox.SetHazeColor(0.3f, 0.3f, 0.3f);
-            horizon.SetFogColorNear(0.5f, 0.5f, 0.6f);
-            horizon.SetFogColorFar(0.3f, 0.3f, 0.4f);
-            ApplyLighting(XMFLOAT3(0.1f, -0.8f, 0.1f), XMFLOAT3(0.6f, 0.6f, 0.7f), XMFLOAT3(0.2f, 0.2f, 0.25f));
-            AddToHistory("Storm preset applied with gloomy lighting");
-        }
-        else if (preset == "day") {
-            skybox.SetHorizonColor(0.7f, 0.8f, 0.9f);
-            skybox.SetZenithColor(0.1f, 0.2f, 0.4f);
-            skybox.SetHazeColor(0.4f, 0.3f, 0.2f);
-            horizon.SetFogColorNear(0.95f, 0.95f, 0.98f);
-            horizon.SetFogColorFar(0.9f, 0.92f, 1.0f);
-            ApplyLighting(XMFLOAT3(0.4f, -0.7f, 0.3f), XMFLOAT3(1.0f, 0.98f, 0.95f), XMFLOAT3(0.3f, 0.3f, 0.35f));
-            AddToHistory("Clear day preset applied with bright lighting");
-        }
-        else if (preset == "night") {
-            skybox.SetHorizonColor(0.1f, 0.1f, 0.2f);
-            skybox.SetZenithColor(0.02f, 0.02f, 0.05f);
-            skybox.SetHazeColor(0.05f, 0.05f, 0.1f);
-            horizon.SetFogColorNear(0.2f, 0.2f, 0.3f);
-            horizon.SetFogColorFar(0.1f, 0.1f, 0.2f);
-            ApplyLighting(XMFLOAT3(-0.3f, -0.5f, 0.2f), XMFLOAT3(0.3f, 0.4f, 0.8f), XMFLOAT3(0.1f, 0.1f, 0.15f));
-            AddToHistory("Night preset applied with moonlight");
-        }
-        else if (preset == "mars") {
-            skybox.SetHorizonColor(0.8f, 0.4f, 0.2f);
-            skybox.SetZenithColor(0.4f, 0.2f, 0.1f);
-            skybox.SetHazeColor(0.6f, 0.3f, 0.1f);
-            horizon.SetFogColorNear(0.9f, 0.5f, 0.3f);
-            horizon.SetFogColorFar(0.7f, 0.4f, 0.2f);
-            ApplyLighting(XMFLOAT3(0.3f, -0.6f, 0.2f), XMFLOAT3(1.0f, 0.7f, 0.5f), XMFLOAT3(0.4f, 0.2f, 0.1f));
-            AddToHistory("Mars preset applied with reddish lighting");
-        }
-        else if (preset == "fantasy") {
-            skybox.SetHorizonColor(0.8f, 0.6f, 1.0f);
-            skybox.SetZenithColor(0.3f, 0.1f, 0.6f);
-            skybox.SetHazeColor(0.5f, 0.3f, 0.8f);
-            horizon.SetFogColorNear(0.9f, 0.7f, 1.0f);
-            horizon.SetFogColorFar(0.7f, 0.5f, 0.9f);
-            ApplyLighting(XMFLOAT3(0.2f, -0.4f, 0.4f), XMFLOAT3(0.8f, 0.6f, 1.0f), XMFLOAT3(0.3f, 0.2f, 0.4f));
-            AddToHistory("Fantasy preset applied with magical lighting");
-        }
-        else if (preset == "arctic") {
-            skybox.SetHorizonColor(0.8f, 0.9f, 1.0f);
-            skybox.SetZenithColor(0.4f, 0.6f, 0.8f);
-            skybox.SetHazeColor(0.6f, 0.7f, 0.9f);
-            horizon.SetFogColorNear(0.95f, 0.97f, 1.0f);
-            horizon.SetFogColorFar(0.85f, 0.9f, 1.0f);
-            ApplyLighting(XMFLOAT3(0.3f, -0.5f, 0.1f), XMFLOAT3(0.7f, 0.8f, 1.0f), XMFLOAT3(0.4f, 0.5f, 0.6f));
-            AddToHistory("Arctic preset applied with cold lighting");
-        }
-        else if (preset == "morning") {
-            skybox.SetHorizonColor(1.0f, 0.7f, 0.5f);
-            skybox.SetZenithColor(0.2f, 0.3f, 0.6f);
-            skybox.SetHazeColor(0.9f, 0.6f, 0.4f);
-            horizon.SetFogColorNear(1.0f, 0.8f, 0.7f);
-            horizon.SetFogColorFar(0.8f, 0.7f, 0.9f);
-            ApplyLighting(XMFLOAT3(0.1f, -0.3f, 0.2f), XMFLOAT3(1.0f, 0.8f, 0.6f), XMFLOAT3(0.4f, 0.4f, 0.3f));
-            AddToHistory("Morning preset applied with soft golden light");
-        }
-        else if (preset == "evening") {
-            skybox.SetHorizonColor(0.9f, 0.4f, 0.2f);
-            skybox.SetZenithColor(0.4f, 0.1f, 0.3f);
-            skybox.SetHazeColor(0.7f, 0.3f, 0.1f);
-            horizon.SetFogColorNear(0.95f, 0.6f, 0.4f);
-            horizon.SetFogColorFar(0.8f, 0.4f, 0.3f);
-            ApplyLighting(XMFLOAT3(-0.1f, -0.6f, 0.3f), XMFLOAT3(0.9f, 0.5f, 0.3f), XMFLOAT3(0.3f, 0.2f, 0.2f));
-            AddToHistory("Evening preset applied with deep orange tones");
-        }
-        else if (preset == "winter") {
-            skybox.SetHorizonColor(0.9f, 0.95f, 1.0f);
-            skybox.SetZenithColor(0.5f, 0.7f, 0.9f);
-            skybox.SetHazeColor(0.7f, 0.8f, 0.95f);
-            horizon.SetFogColorNear(0.98f, 0.98f, 1.0f);
-            horizon.SetFogColorFar(0.9f, 0.92f, 1.0f);
-            ApplyLighting(XMFLOAT3(0.2f, -0.4f, 0.1f), XMFLOAT3(0.8f, 0.9f, 1.0f), XMFLOAT3(0.5f, 0.6f, 0.7f));
-            AddToHistory("Winter preset applied with icy blue tones");
-        }
-        else if (preset == "autumn") {
-            skybox.SetHorizonColor(0.9f, 0.6f, 0.3f);
-            skybox.SetZenithColor(0.3f, 0.2f, 0.1f);
-            skybox.SetHazeColor(0.7f, 0.5f, 0.2f);
-            horizon.SetFogColorNear(0.95f, 0.8f, 0.6f);
-            horizon.SetFogColorFar(0.8f, 0.6f, 0.4f);
-            ApplyLighting(XMFLOAT3(0.3f, -0.5f, 0.2f), XMFLOAT3(0.9f, 0.7f, 0.4f), XMFLOAT3(0.4f, 0.3f, 0.2f));
-            AddToHistory("Autumn preset applied with golden brown tones");
-        }
-        else if (preset == "tropical") {
-            skybox.SetHorizonColor(0.3f, 0.8f, 1.0f);
-            skybox.SetZenithColor(0.1f, 0.4f, 0.7f);
-            skybox.SetHazeColor(0.2f, 0.6f, 0.9f);
-            horizon.SetFogColorNear(0.7f, 0.9f, 1.0f);
-            horizon.SetFogColorFar(0.5f, 0.8f, 1.0f);
-            ApplyLighting(XMFLOAT3(0.4f, -0.6f, 0.3f), XMFLOAT3(0.6f, 0.9f, 1.0f), XMFLOAT3(0.3f, 0.5f, 0.6f));
-            AddToHistory("Tropical preset applied with vibrant blue tones");
-        }
-        else if (preset == "desert") {
-            skybox.SetHorizonColor(1.0f, 0.8f, 0.4f);
-            skybox.SetZenithColor(0.6f, 0.4f, 0.2f);
-            skybox.SetHazeColor(0.9f, 0.7f, 0.3f);
-            horizon.SetFogColorNear(1.0f, 0.9f, 0.7f);
-            horizon.SetFogColorFar(0.9f, 0.8f, 0.5f);
-            ApplyLighting(XMFLOAT3(0.5f, -0.7f, 0.2f), XMFLOAT3(1.0f, 0.9f, 0.6f), XMFLOAT3(0.5f, 0.4f, 0.3f));
-            AddToHistory("Desert preset applied with sandy yellow tones");
-        }
-        else if (preset == "cherry") {
-            skybox.SetHorizonColor(1.0f, 0.7f, 0.8f);
-            skybox.SetZenithColor(0.4f, 0.2f, 0.3f);
-            skybox.SetHazeColor(0.9f, 0.6f, 0.7f);
-            horizon.SetFogColorNear(1.0f, 0.8f, 0.9f);
-            horizon.SetFogColorFar(0.9f, 0.7f, 0.8f);
-            ApplyLighting(XMFLOAT3(0.2f, -0.4f, 0.3f), XMFLOAT3(1.0f, 0.8f, 0.9f), XMFLOAT3(0.4f, 0.3f, 0.35f));
-            AddToHistory("Cherry blossom preset applied with pink tones");
-        }
-        else if (preset == "ocean") {
-            skybox.SetHorizonColor(0.2f, 0.5f, 0.8f);
-            skybox.SetZenithColor(0.1f, 0.2f, 0.4f);
-            skybox.SetHazeColor(0.15f, 0.35f, 0.6f);
-            horizon.SetFogColorNear(0.7f, 0.8f, 1.0f);
-            horizon.SetFogColorFar(0.4f, 0.6f, 0.9f);
-            ApplyLighting(XMFLOAT3(0.3f, -0.5f, 0.4f), XMFLOAT3(0.5f, 0.7f, 1.0f), XMFLOAT3(0.2f, 0.3f, 0.4f));
-            AddToHistory("Ocean deep preset applied with deep blue tones");
-        }
-        else if (preset == "lavender") {
-            skybox.SetHorizonColor(0.7f, 0.6f, 1.0f);
-            skybox.SetZenithColor(0.3f, 0.2f, 0.5f);
-            skybox.SetHazeColor(0.6f, 0.5f, 0.9f);
-            horizon.SetFogColorNear(0.9f, 0.8f, 1.0f);
-            horizon.SetFogColorFar(0.8f, 0.7f, 1.0f);
-            ApplyLighting(XMFLOAT3(0.2f, -0.4f, 0.3f), XMFLOAT3(0.8f, 0.7f, 1.0f), XMFLOAT3(0.3f, 0.25f, 0.4f));
-            AddToHistory("Lavender field preset applied with purple tones");
-        }
-        else if (preset == "candy") {
-            skybox.SetHorizonColor(1.0f, 0.9f, 0.95f);
-            skybox.SetZenithColor(0.8f, 0.6f, 0.9f);
-            skybox.SetHazeColor(0.95f, 0.8f, 0.9f);
-            horizon.SetFogColorNear(1.0f, 0.95f, 1.0f);
-            horizon.SetFogColorFar(0.95f, 0.9f, 1.0f);
-            ApplyLighting(XMFLOAT3(0.1f, -0.3f, 0.2f), XMFLOAT3(1.0f, 0.95f, 1.0f), XMFLOAT3(0.4f, 0.35f, 0.45f));
-            AddToHistory("Candy land preset applied with pastel colors");
-        }
-        else if (preset == "neon") {
-            skybox.SetHorizonColor(0.3f, 1.0f, 0.8f);
-            skybox.SetZenithColor(0.1f, 0.3f, 0.6f);
-            skybox.SetHazeColor(0.2f, 0.8f, 0.7f);
-            horizon.SetFogColorNear(0.6f, 1.0f, 0.9f);
-            horizon.SetFogColorFar(0.3f, 0.8f, 0.7f);
-            ApplyLighting(XMFLOAT3(0.1f, -0.5f, 0.4f), XMFLOAT3(0.4f, 1.0f, 0.8f), XMFLOAT3(0.1f, 0.3f, 0.25f));
-            AddToHistory("Neon cyberpunk preset applied with electric colors");
-        }
-        else if (preset == "moonlight") {
-            skybox.SetHorizonColor(0.15f, 0.15f, 0.3f);
-            skybox.SetZenithColor(0.05f, 0.05f, 0.1f);
-            skybox.SetHazeColor(0.1f, 0.1f, 0.2f);
-            horizon.SetFogColorNear(0.25f, 0.25f, 0.4f);
-            horizon.SetFogColorFar(0.15f, 0.15f, 0.3f);
-            ApplyLighting(XMFLOAT3(-0.2f, -0.8f, 0.1f), XMFLOAT3(0.2f, 0.3f, 0.6f), XMFLOAT3(0.05f, 0.05f, 0.1f));
-            AddToHistory("Moonlight preset applied with deep night tones");
-        }
-        else {
-            AddToHistory("Error: Unknown preset '" + preset + "'");
-            AddToHistory("Available presets: default, sunset, storm, day, night, mars, fantasy, arctic, morning, evening, winter, autumn, tropical, desert, cherry, ocean, lavender, candy, neon, moonlight");
+        int preset = worldPresets.Find(args[1]);
+        if (preset < 0) {
+            AddToHistory("Error: Unknown preset '" + args[1] + "'");
+            AddToHistory("Available presets: " + worldPresets.ListNames());
+            return;
         }
+        cycleFrom = -1;   // a fixed preset ends world_cycle
+        ApplyWorldPreset(worldPresets.Get(preset), true);
+        AddToHistory(worldPresets.GetDescription(preset));
     };
+    commands["world_cycle"] = [this](const auto& args) {
+        std::lock_guard<std::recursive_mutex> lock(consoleHistoryMutex);
+        if (args.size() == 2 && args[1] == "off") {
+            cycleFrom = -1;
+            AddToHistory("World cycle stopped");
+            return;
+        }
+        float period = 0.0f;
+        if (args.size() == 4) {
+            try {
+                period = std::stof(args[3]);
+            }
+            catch (...) {}
+        }
+        if (period <= 0.0f) {
+            AddToHistory("Usage: world_cycle <from> <to> <period seconds> | world_cycle off");
+            if (cycleFrom >= 0) {
+                AddToHistory("Cycling " + worldPresets.GetName(cycleFrom) + " and " + worldPresets.GetName(cycleTo) +
+                    " every " + std::to_string(cyclePeriod) + " s");
+            }
+            return;
+        }
+        int from = worldPresets.Find(args[1]), to = worldPresets.Find(args[2]);
+        if (from < 0 || to < 0) {
+            AddToHistory("Error: Unknown preset '" + (from < 0 ? args[1] : args[2]) + "'");
+            AddToHistory("Available presets: " + worldPresets.ListNames());
+            return;
+        }
+        // new sky colors every frame: the analytic sky takes them as a
+        // constant buffer write, the baked one would regenerate its cubemap
+        skybox.SetMode(Skybox::Mode::Analytic);
+        cycleFrom = from;
+        cycleTo = to;
+        cyclePeriod = period;
+        cycleTime = 0.0f;
+        AddToHistory("Cycling " + args[1] + " and " + args[2] + " every " + args[3] + " s (analytic sky)");
+        };
 
     commands["sky_default"] = [this](const std::vector<std::string>& args) {
-    skybox.SetHorizonColor(0.7f, 0.8f, 0.9f);
-    skybox.SetZenithColor(0.1f, 0.2f, 0.4f);
-    skybox.SetHazeColor(0.4f, 0.3f, 0.2f);
+    skybox.SetColors(XMFLOAT3(0.7f, 0.8f, 0.9f), XMFLOAT3(0.1f, 0.2f, 0.4f), XMFLOAT3(0.4f, 0.3f, 0.2f));
     horizon.SetFogColorNear(0.95f, 0.95f, 0.98f);
     horizon.SetFogColorFar(0.9f, 0.92f, 1.0f);
     
@@ -1151,9 +1018,7 @@ void GameEngine::RegisterCommands()
         };
    
     commands["scene_default"] = [this](const std::vector<std::string>& args) {
-        skybox.SetHorizonColor(0.7f, 0.8f, 0.9f);
-        skybox.SetZenithColor(0.1f, 0.2f, 0.4f);
-        skybox.SetHazeColor(0.4f, 0.3f, 0.2f);
+        skybox.SetColors(XMFLOAT3(0.7f, 0.8f, 0.9f), XMFLOAT3(0.1f, 0.2f, 0.4f), XMFLOAT3(0.4f, 0.3f, 0.2f));
         horizon.SetFogColorNear(0.95f, 0.95f, 0.98f);
         horizon.SetFogColorFar(0.9f, 0.92f, 1.0f);
 
@@ -1209,9 +1074,78 @@ void GameEngine::AddToHistory(const std::string& command)
     }
 }
 
-void GameEngine::Update(float dt)
+bool GameEngine::LoadWorldPresets()
+{
+    // next to the exe once built, under the project dir when run from Visual Studio
+    char exePath[MAX_PATH] = {};
+    GetModuleFileNameA(NULL, exePath, MAX_PATH);
+    std::string exeDir = exePath;
+    exeDir.erase(exeDir.find_last_of("\\/") + 1);
+
+    std::string error;
+    if (worldPresets.Load(exeDir + "WorldPresets.txt", error) || worldPresets.Load("WorldPresets.txt", error)) return true;
+
+    // not fatal, the current sky stays and world_preset has nothing to offer
+    std::lock_guard<std::recursive_mutex> lock(consoleHistoryMutex);
+    AddToHistory("Error: world presets not loaded, " + error);
+    return false;
+}
+
+void GameEngine::ApplyWorldPreset(const WorldPreset& preset, bool fadeSky)
+{
+    skybox.SetColors(XMFLOAT3(preset.horizon), XMFLOAT3(preset.zenith), XMFLOAT3(preset.haze), fadeSky);
+    horizon.SetFogColorNear(preset.fogNear[0], preset.fogNear[1], preset.fogNear[2]);
+    horizon.SetFogColorFar(preset.fogFar[0], preset.fogFar[1], preset.fogFar[2]);
+    ApplyLighting(XMFLOAT3(preset.lightDir), XMFLOAT3(preset.lightColor), XMFLOAT3(preset.ambient));
+}
+
+void GameEngine::UpdateWorldCycle(float frameSeconds)
+{
+    if (cycleFrom < 0) return;
+    // switched back to the baked sky: every frame would be a new cubemap
+    if (skybox.GetMode() != Skybox::Mode::Analytic) {
+        cycleFrom = -1;
+        return;
+    }
+    cycleTime = fmodf(cycleTime + frameSeconds, cyclePeriod);
+    // eased, so each preset is held a moment before turning back
+    float t = 0.5f - 0.5f * cosf(cycleTime / cyclePeriod * XM_2PI);
+    ApplyWorldPreset(LerpPresets(worldPresets.Get(cycleFrom), worldPresets.Get(cycleTo), t), false);
+}
+
+void GameEngine::Update(float frameSeconds)
+{
+    int ticks = simClock.Advance(frameSeconds);
+    for (int i = 0; i < ticks; ++i) {
+        auto tickStart = std::chrono::steady_clock::now();
+        previousPlayerPos = playerPos;
+        Tick((float)simClock.GetTickSeconds() * GAME_TIME_SCALE);
+        float ms = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - tickStart).count();
+        tickMilliseconds += (ms - tickMilliseconds) * 0.05f;
+    }
+
+    float dx = playerPos.x - previousPlayerPos.x;
+    float dy = playerPos.y - previousPlayerPos.y;
+    float dz = playerPos.z - previousPlayerPos.z;
+    if (dx * dx + dy * dy + dz * dz > SNAP_DISTANCE * SNAP_DISTANCE) {
+        dx = dy = dz = 0.0f;
+        previousPlayerPos = playerPos;
+    }
+    float alpha = simClock.GetAlpha();
+    renderPlayerPos = {
+        previousPlayerPos.x + dx * alpha,
+        previousPlayerPos.y + dy * alpha,
+        previousPlayerPos.z + dz * alpha
+    };
+    UpdateCamera();
+    UpdateWorldCycle(frameSeconds);
+}
+
+void GameEngine::Tick(float dt)
 {
     ResetKeyProcessing();
+    ProcessNetworkMessages();
+    mapStore.Update();
 
     XMFLOAT3 oldPos = playerPos;
     HandleInput(dt);
@@ -1223,37 +1157,254 @@ void GameEngine::Update(float dt)
         (playerPos.y - oldPos.y) / dt,
         (playerPos.z - oldPos.z) / dt
     };
+    StepRigidBodies(dt);
 
     if (isMultiplayer) {
-        networkUpdateTimer += dt;
-        if (networkUpdateTimer > 0.2f) {
-            networkUpdateTimer = 0;
-            int myId = networkManager.IsServer() ? -1 : 0;
-            std::string playerData = "POS:" + std::to_string(myId) + ":" +
-                std::to_string(playerPos.x) + "," +
-                std::to_string(playerPos.y) + "," +
-                std::to_string(playerPos.z);
+        UpdateReplication();
+        if (networkManager.IsServer()) hostSession.PumpWorldTransfers();
+        networkManager.Update(dt);
+    }
+}
 
-            if (networkManager.IsServer()) {
-                networkManager.BroadcastData(playerData);
-            }
-            else {
-                networkManager.SendData(playerData);
+void GameEngine::UpdateReplication()
+{
+    // wall clock, the game dt is slowed down and would stretch the tick
+    auto now = std::chrono::steady_clock::now();
+    float elapsed = std::chrono::duration<float>(now - lastNetTickTime).count();
+    lastNetTickTime = now;
+    elapsed = (std::min)(elapsed, 0.25f);
+    netTickAccumulator += elapsed;
+
+    // remote players are drawn a little in the past, between two known states
+    interpolationClock.Advance(elapsed);
+    if (interpolationClock.IsRunning()) {
+        for (auto& pair : networkPlayers) {
+            NetworkPlayer& player = pair.second;
+            EntitySample sample;
+            if (player.history.Sample(interpolationClock.Now(), sample)) {
+                player.position = XMFLOAT3(sample.position[0], sample.position[1], sample.position[2]);
+                player.rotation = XMFLOAT3(sample.pitch, sample.yaw, 0.0f);
             }
         }
-        networkManager.Update();
+    }
+
+    const float tickInterval = 1.0f / NET_TICK_RATE;
+    if (netTickAccumulator < tickInterval) return;
+    netTickAccumulator -= tickInterval;
+    if (netTickAccumulator > tickInterval) netTickAccumulator = 0.0f; // don't try to catch up
+
+    if (networkManager.IsServer()) {
+        SendSnapshots();
+    }
+    else {
+        const float predicted[3] = { playerPos.x, playerPos.y, playerPos.z };
+        NetMessage upload = NetMessage::Position(localPlayerId, playerPos.x, playerPos.y, playerPos.z,
+            cameraRotation.y, cameraRotation.x);
+        upload.teleport = pendingTeleport;
+        if (pendingTeleport) prediction.Reset();
+        upload.sequence = prediction.Record(predicted);
+        pendingTeleport = false;
+        networkManager.SendData(upload);
     }
 }
-bool GameEngine::IsBlockAtPosition(const XMFLOAT3& position, float tolerance) const
+
+void GameEngine::ReconcileLocalPlayer(uint32_t inputAck, const NetQuantizedState& state)
 {
-    for (const auto& obj : mapObjects) {
-        if (fabs(obj.position.x - position.x) < tolerance &&
-            fabs(obj.position.y - position.y) < tolerance &&
-            fabs(obj.position.z - position.z) < tolerance) {
-            return true;
+    const float authoritative[3] = {
+        NetDequantizePosition(state.x), NetDequantizePosition(state.y), NetDequantizePosition(state.z)
+    };
+    float correction[3];
+    if (!prediction.Reconcile(inputAck, authoritative, correction)) return;
+
+    // anything below this is quantization, the host accepted our move
+    float error = sqrtf(correction[0] * correction[0] + correction[1] * correction[1] + correction[2] * correction[2]);
+    if (error < 0.05f) return;
+
+    // applied at once: the remaining predictions were already shifted by the
+    // same amount, easing it in would make the next ack undo part of it
+    playerPos.x += correction[0];
+    playerPos.y += correction[1];
+    playerPos.z += correction[2];
+    reconcileStats.corrections++;
+    reconcileStats.lastError = error;
+}
+
+void GameEngine::SendSnapshots()
+{
+    // the remote players come from the session's own accepted states
+    NetEntityMap host;
+    NetQuantizedState q;
+    q.x = NetQuantizePosition(playerPos.x);
+    q.y = NetQuantizePosition(playerPos.y);
+    q.z = NetQuantizePosition(playerPos.z);
+    q.yaw = NetQuantizeAngle(cameraRotation.y);
+    q.pitch = NetQuantizeAngle(cameraRotation.x);
+    host[localPlayerId] = q;
+    hostSession.SendSnapshots(host);
+}
+
+void GameEngine::InitHostSession()
+{
+    mapStore.SetFiles({ "session.hvhj", "session.hvhm", "autosave.hvhm" });
+    mapStore.SetLog([this](const std::string& text) {
+        std::lock_guard<std::recursive_mutex> lock(consoleHistoryMutex);
+        AddToHistory(text);
+        });
+    mapStore.SetRemovedCallback([this](const PhysicsBox& box) { rigidBodies.WakeInBox(box); });
+    mapStore.SetReplacedCallback([this]() {
+        rigidBodies.WakeAll();
+        if (isMultiplayer && networkManager.IsServer()) hostSession.RestartWorldTransfers();
+        });
+    hostSession.SetWorld(mapStore.MakeHostWorld());
+
+    hostSession.SetLog([this](const std::string& text) {
+        std::lock_guard<std::recursive_mutex> lock(consoleHistoryMutex);
+        AddToHistory(text);
+        });
+    // the host draws the other players from the states it accepted
+    hostSession.SetPlayerMovedCallback([this](int clientId, const EntitySample& sample, bool teleport) {
+        auto it = networkPlayers.find(clientId);
+        if (it == networkPlayers.end()) {
+            NetworkPlayer newPlayer;
+            newPlayer.clientId = clientId;
+            newPlayer.name = "Player" + std::to_string(clientId);
+            newPlayer.position = XMFLOAT3(sample.position[0], sample.position[1], sample.position[2]);
+            newPlayer.rotation = XMFLOAT3(sample.pitch, sample.yaw, 0.0f);
+            it = networkPlayers.emplace(clientId, newPlayer).first;
+        }
+        if (teleport) {
+            it->second.history.Clear();
+        }
+        it->second.history.Push(sample);
+        interpolationClock.OnSample(sample.time);
+        });
+    hostSession.SetPlayerLeftCallback([this](int clientId) {
+        networkPlayers.erase(clientId);
+        });
+}
+
+void GameEngine::ApplySnapshotWorld(const NetEntityMap& world, double serverTime)
+{
+    for (auto it = networkPlayers.begin(); it != networkPlayers.end();) {
+        if (world.find(it->first) == world.end()) {
+            it = networkPlayers.erase(it);
+        }
+        else {
+            ++it;
         }
     }
-    return false;
+
+    for (const auto& pair : world) {
+        auto it = networkPlayers.find(pair.first);
+        if (it == networkPlayers.end()) {
+            NetworkPlayer newPlayer;
+            newPlayer.clientId = pair.first;
+            newPlayer.name = "Player" + std::to_string(pair.first);
+            it = networkPlayers.emplace(pair.first, newPlayer).first;
+        }
+        NetworkPlayer& player = it->second;
+
+        EntitySample sample;
+        sample.time = serverTime;
+        sample.position[0] = NetDequantizePosition(pair.second.x);
+        sample.position[1] = NetDequantizePosition(pair.second.y);
+        sample.position[2] = NetDequantizePosition(pair.second.z);
+        sample.yaw = NetDequantizeAngle(pair.second.yaw);
+        sample.pitch = NetDequantizeAngle(pair.second.pitch);
+        if (player.history.Size() == 0) {
+            player.position = XMFLOAT3(sample.position[0], sample.position[1], sample.position[2]);
+            player.rotation = XMFLOAT3(sample.pitch, sample.yaw, 0.0f);
+        }
+        player.history.Push(sample);
+    }
+    interpolationClock.OnSample(serverTime);
+}
+void GameEngine::CollectBlockBoxes(const AABB& region, std::vector<AABB>& out) const
+{
+    PhysicsBox query = {
+        { region.min.x, region.min.y, region.min.z },
+        { region.max.x, region.max.y, region.max.z }
+    };
+    std::vector<PhysicsBox> boxes;
+    mapStore.CollectBoxes(query, boxes);
+    for (const PhysicsBox& box : boxes) {
+        AABB aabb;
+        aabb.min = { box.min[0], box.min[1], box.min[2] };
+        aabb.max = { box.max[0], box.max[1], box.max[2] };
+        out.push_back(aabb);
+    }
+}
+
+void GameEngine::CollectPhysicsBoxes(const PhysicsBox& region, std::vector<PhysicsBox>& out) const
+{
+    mapStore.CollectBoxes(region, out);
+}
+
+void GameEngine::SpawnParkourBalls()
+{
+    parkourBalls = ParkourMap::CreateParkourBalls();
+    rigidBodies.Clear();
+    for (const auto& ball : parkourBalls) {
+        const float position[3] = { ball.position.x, ball.position.y, ball.position.z };
+        rigidBodies.AddSphere(position, ball.scale.x, BlockRegistry::Intern(ball.type));
+    }
+}
+
+void GameEngine::StepRigidBodies(float dt)
+{
+    // walking into a body shoves it; the one underfoot is left alone
+    const float reach = 0.05f;
+    PhysicsBox player = {
+        { playerPos.x - 0.3f - reach, playerPos.y + reach, playerPos.z - 0.3f - reach },
+        { playerPos.x + 0.3f + reach, playerPos.y + 1.8f, playerPos.z + 0.3f + reach }
+    };
+    const float push[3] = { playerVelocity.x, playerVelocity.y, playerVelocity.z };
+    rigidBodies.Push(player, push);
+
+    // only reads the map, so the threaded step can share it
+    rigidBodies.Step(dt, gravity, [this](const PhysicsBox& region, std::vector<PhysicsBox>& out) {
+        CollectPhysicsBoxes(region, out);
+        });
+}
+
+bool GameEngine::RaycastBlocks(const XMFLOAT3& rayOrigin, const XMFLOAT3& rayDir, float maxDist, BlockRayHit& hit)
+{
+    const float origin[3] = { rayOrigin.x, rayOrigin.y, rayOrigin.z };
+    const float dir[3] = { rayDir.x, rayDir.y, rayDir.z };
+    hit.t = maxDist;
+    bool found = false;
+
+    VoxelRayHit voxelHit;
+    if (RaycastVoxels(mapStore.GetVoxels(), origin, dir, maxDist, voxelHit)) {
+        found = true;
+        hit.t = voxelHit.t;
+        hit.normal = { (float)voxelHit.normal[0], (float)voxelHit.normal[1], (float)voxelHit.normal[2] };
+        hit.blockPosition = { (float)voxelHit.position[0], (float)voxelHit.position[1], (float)voxelHit.position[2] };
+        hit.block = voxelHit.block;
+    }
+
+    // the few blocks off the lattice, each against its box
+    std::vector<uint32_t> candidates;
+    mapStore.QueryObjectsAlongRay(origin, dir, hit.t, candidates);
+    for (uint32_t id : candidates) {
+        const MapObject& obj = mapStore.GetObjects()[id];
+        const float boxMin[3] = { obj.position.x - obj.scale.x, obj.position.y - obj.scale.y, obj.position.z - obj.scale.z };
+        const float boxMax[3] = { obj.position.x + obj.scale.x, obj.position.y + obj.scale.y, obj.position.z + obj.scale.z };
+        float t;
+        int axis, sign;
+        if (!RayEntersBox(origin, dir, boxMin, boxMax, t, axis, sign) || t >= hit.t) continue;
+
+        found = true;
+        hit.t = t;
+        hit.normal = { axis == 0 ? (float)sign : 0.f, axis == 1 ? (float)sign : 0.f, axis == 2 ? (float)sign : 0.f };
+        hit.blockPosition = obj.position;
+        hit.block = obj.block;
+    }
+
+    if (found) {
+        hit.point = { rayOrigin.x + hit.t * rayDir.x, rayOrigin.y + hit.t * rayDir.y, rayOrigin.z + hit.t * rayDir.z };
+    }
+    return found;
 }
 
 void GameEngine::SetJumpVolume(float volume) {
@@ -1286,12 +1437,7 @@ void GameEngine::PlaceBlock(const XMFLOAT3& position)
         playerAABB.min.z <= newBlockAABB.max.z && playerAABB.max.z >= newBlockAABB.min.z);
 
     if (!intersectsPlayer) {
-        MapObject obj;
-        obj.position = position;
-        obj.rotation = { 0.f, 0.f, 0.f };
-        obj.scale = { 1.f, 1.f, 1.f };
-        obj.type = inventoryBlocks[selectedInventorySlot];
-        mapObjects.push_back(obj);
+        if (!mapStore.AddBlock(position.x, position.y, position.z, inventoryBlocks[selectedInventorySlot])) return;
 
         std::lock_guard<std::recursive_mutex> lock(consoleHistoryMutex);
         AddToHistory("Block placed at " +
@@ -1300,11 +1446,8 @@ void GameEngine::PlaceBlock(const XMFLOAT3& position)
             std::to_string((int)position.z));
 
         if (isMultiplayer && isSynchronized) {
-            std::string blockData = "BLOCK:ADD|" +
-                std::to_string(position.x) + "," +
-                std::to_string(position.y) + "," +
-                std::to_string(position.z) + "|" +
-                inventoryBlocks[selectedInventorySlot];
+            NetMessage blockData = NetMessage::BlockAdd(position.x, position.y, position.z,
+                BlockRegistry::GetName(inventoryBlocks[selectedInventorySlot]));
             if (networkManager.IsServer()) {
                 networkManager.BroadcastData(blockData);
             }
@@ -1319,284 +1462,175 @@ void GameEngine::PlaceBlock(const XMFLOAT3& position)
     }
 }
 
-bool GameEngine::Initialize()
+void GameEngine::ProcessNetworkMessages()
 {
-    mouseLocked = true;
-    ShowCursor(FALSE);
-
-    networkManager.Initialize();
+    auto start = std::chrono::steady_clock::now();
+    size_t depth = inboundMessages.ApproxSize();
+    netQueueStats.lastDepth = depth;
+    if (depth > netQueueStats.peakDepth) netQueueStats.peakDepth = depth;
+
+    // bounded so a burst (map sync on join) is spread over several ticks
+    size_t processed = 0;
+    float latencySum = 0.0f;
+    float latencyMax = 0.0f;
+    InboundMessage inbound;
+    while (processed < maxMessagesPerTick && inboundMessages.Pop(inbound)) {
+        float latency = std::chrono::duration<float, std::milli>(start - inbound.received).count();
+        latencySum += latency;
+        if (latency > latencyMax) latencyMax = latency;
+
+        HandleNetworkMessage(inbound.msg, inbound.clientId);
+        processed++;
+    }
 
-    networkManager.SetDataReceivedCallback([this](const std::string& data, int clientId) {
-        {
-            std::lock_guard<std::recursive_mutex> lock(consoleHistoryMutex);
-            //AddToHistory("Received: " + data + " from " + std::to_string(clientId));
-        }
+    netQueueStats.lastProcessed = processed;
+    netQueueStats.totalProcessed += processed;
+    if (processed > 0) {
+        netQueueStats.avgLatencyMs = latencySum / processed;
+        netQueueStats.maxLatencyMs = latencyMax;
+        netQueueStats.lastDrainMs = std::chrono::duration<float, std::milli>(
+            std::chrono::steady_clock::now() - start).count();
+    }
+}
 
-        if (data == "MAP:CLEAR" && !networkManager.IsServer()) {
-            mapObjects.clear();
+void GameEngine::HandleNetworkMessage(const NetMessage& msg, int clientId)
+{
+    if (networkManager.IsServer() && hostSession.HandleMessage(msg, clientId)) return;
+
+    switch (msg.type) {
+    case NetMessageType::MapClear:
+        if (!networkManager.IsServer()) {
+            // the server's world from here on, not ours to recover
+            mapStore.GetJournal().Close();
+            mapStore.Clear();
             std::lock_guard<std::recursive_mutex> lock(consoleHistoryMutex);
             AddToHistory("Client map cleared by server");
         }
-        else if (data.find("POS:") == 0) {
-            std::string posStr = data.substr(4);
-            size_t colon1 = posStr.find(':');
-            if (colon1 != std::string::npos) {
-                std::string idStr = posStr.substr(0, colon1);
-                std::string coordStr = posStr.substr(colon1 + 1);
+        break;
 
-                try {
-                    int senderId = std::stoi(idStr);
-
-                    size_t comma1 = coordStr.find(',');
-                    size_t comma2 = coordStr.find(',', comma1 + 1);
-                    if (comma1 != std::string::npos && comma2 != std::string::npos) {
-                        float x = std::stof(coordStr.substr(0, comma1));
-                        float y = std::stof(coordStr.substr(comma1 + 1, comma2 - comma1 - 1));
-                        float z = std::stof(coordStr.substr(comma2 + 1));
-
-                        if (networkPlayers.find(senderId) == networkPlayers.end()) {
-                            NetworkPlayer newPlayer;
-                            newPlayer.clientId = senderId;
-                            newPlayer.name = "Player" + std::to_string(senderId);
-                            newPlayer.position = XMFLOAT3(x, y, z);
-                            networkPlayers[senderId] = newPlayer;
-                            {
-                                std::lock_guard<std::recursive_mutex> lock(consoleHistoryMutex);
-                                AddToHistory("Player " + std::to_string(senderId) + " added/updated");
-                            }
-                        }
-                        else {
-                            networkPlayers[senderId].position = XMFLOAT3(x, y, z);
-                            {
-                                std::lock_guard<std::recursive_mutex> lock(consoleHistoryMutex);
-                                //AddToHistory("Position updated for player " + std::to_string(senderId));
-                            }
-                        }
+    case NetMessageType::Snapshot: {
+        if (networkManager.IsServer()) break;
 
-                        if (networkManager.IsServer()) {
-                            networkManager.BroadcastData(data);
-                        }
-                    }
-                }
-                catch (...) {
-                    std::lock_guard<std::recursive_mutex> lock(consoleHistoryMutex);
-                    AddToHistory("Invalid position data");
-                }
-            }
-        }
-        else if (data.find("BLOCK:ADD|") == 0) {
-            std::string blockStr = data.substr(10);
-            size_t pipePos = blockStr.find('|');
-
-            if (pipePos != std::string::npos) {
-                std::string posStr = blockStr.substr(0, pipePos);
-                std::string type = blockStr.substr(pipePos + 1);
-
-                size_t comma1 = posStr.find(',');
-                size_t comma2 = posStr.find(',', comma1 + 1);
-
-                if (comma1 != std::string::npos && comma2 != std::string::npos) {
-                    try {
-                        float x = std::stof(posStr.substr(0, comma1));
-                        float y = std::stof(posStr.substr(comma1 + 1, comma2 - comma1 - 1));
-                        float z = std::stof(posStr.substr(comma2 + 1));
-
-                        bool blockExists = false;
-                        for (const auto& obj : mapObjects) {
-                            if (fabs(obj.position.x - x) < 0.1f &&
-                                fabs(obj.position.y - y) < 0.1f &&
-                                fabs(obj.position.z - z) < 0.1f) {
-                                blockExists = true;
-                                break;
-                            }
-                        }
+        NetEntityMap world;
+        if (!snapshotClient.Apply(msg, world)) break;
+        networkManager.SendData(NetMessage::SnapshotAck(msg.sequence));
 
-                        if (!blockExists) {
-                            MapObject newBlock;
-                            newBlock.position = XMFLOAT3(x, y, z);
-                            newBlock.rotation = XMFLOAT3(0.f, 0.f, 0.f);
-                            newBlock.scale = XMFLOAT3(1.f, 1.f, 1.f);
-                            newBlock.type = type;
-                            mapObjects.push_back(newBlock);
-
-                            if (networkManager.IsServer()) {
-                                networkManager.BroadcastData(data);
-                                {
-                                    std::lock_guard<std::recursive_mutex> lock(consoleHistoryMutex);
-                                    //AddToHistory("Block added and broadcasted");
-                                }
-                            }
-                            else {
-                                {
-                                    std::lock_guard<std::recursive_mutex> lock(consoleHistoryMutex);
-                                    //AddToHistory("Block added by network at (" +
-                                    //    std::to_string(x) + "," +
-                                    //    std::to_string(y) + "," +
-                                    //    std::to_string(z) + ")");
-                                }
-                            }
-                        }
-                    }
-                    catch (...) {
-                        std::lock_guard<std::recursive_mutex> lock(consoleHistoryMutex);
-                        AddToHistory("Invalid block data format");
-                    }
-                }
-            }
+        auto own = world.find(localPlayerId);
+        if (own != world.end()) {
+            ReconcileLocalPlayer(msg.inputAck, own->second);
+            world.erase(own);
         }
-        else if (data.find("BLOCK:REMOVE|") == 0) {
-            std::string posStr = data.substr(13);
-            size_t comma1 = posStr.find(',');
-            size_t comma2 = posStr.find(',', comma1 + 1);
-
-            if (comma1 != std::string::npos && comma2 != std::string::npos) {
-                try {
-                    float x = std::stof(posStr.substr(0, comma1));
-                    float y = std::stof(posStr.substr(comma1 + 1, comma2 - comma1 - 1));
-                    float z = std::stof(posStr.substr(comma2 + 1));
-
-                    bool blockRemoved = false;
-                    for (auto it = mapObjects.begin(); it != mapObjects.end(); ) {
-                        if (fabs(it->position.x - x) < 0.1f &&
-                            fabs(it->position.y - y) < 0.1f &&
-                            fabs(it->position.z - z) < 0.1f) {
-                            it = mapObjects.erase(it);
-                            blockRemoved = true;
-
-                            if (networkManager.IsServer()) {
-                                networkManager.BroadcastData(data);
-                                {
-                                    std::lock_guard<std::recursive_mutex> lock(consoleHistoryMutex);
-                                    AddToHistory("Block removal broadcasted to all clients");
-                                }
-                            }
-                            else {
-                                {
-                                    std::lock_guard<std::recursive_mutex> lock(consoleHistoryMutex);
-                                    AddToHistory("Block removed by network at (" +
-                                        std::to_string(x) + "," +
-                                        std::to_string(y) + "," +
-                                        std::to_string(z) + ")");
-                                }
-                            }
-                            break;
-                        }
-                        else {
-                            ++it;
-                        }
-                    }
+        // snapshots are taken once per host tick, so the sequence is the host's clock
+        ApplySnapshotWorld(world, msg.sequence / (double)NET_TICK_RATE);
+        break;
+    }
 
-                    if (!blockRemoved) {
-                        std::lock_guard<std::recursive_mutex> lock(consoleHistoryMutex);
-                        AddToHistory("Block not found for removal");
-                    }
-                }
-                catch (...) {
-                    std::lock_guard<std::recursive_mutex> lock(consoleHistoryMutex);
-                    AddToHistory("Invalid remove data format");
-                }
-            }
+    case NetMessageType::WorldBegin:
+        if (!networkManager.IsServer()) {
+            worldTransferClient.Begin(msg.count);
+            worldSyncStats = WorldSyncStats();
+            worldSyncStats.start = std::chrono::steady_clock::now();
+            std::lock_guard<std::recursive_mutex> lock(consoleHistoryMutex);
+            AddToHistory("Receiving world: " + std::to_string(msg.count) + " chunks");
         }
-        else if (data == "JOIN") {
-            if (networkManager.IsServer()) {
-                int assignedId = nextClientId++;
-                {
-                    std::lock_guard<std::recursive_mutex> lock(consoleHistoryMutex);
-                    AddToHistory("Player joined, assigned ID: " + std::to_string(assignedId));
-                }
-
-                // Send client ID
-                std::string idData = "ASSIGN_ID:" + std::to_string(assignedId);
-                networkManager.SendToClient(clientId, idData);
+        break;
 
-                networkManager.SendToClient(clientId, "MAP:CLEAR");
+    case NetMessageType::WorldBatch: {
+        if (networkManager.IsServer() || !worldTransferClient.IsActive()) break;
 
-                // Send server map to client
-                for (const auto& obj : mapObjects) {
-                    std::string blockData = "BLOCK:ADD|" +
-                        std::to_string(obj.position.x) + "," +
-                        std::to_string(obj.position.y) + "," +
-                        std::to_string(obj.position.z) + "|" +
-                        obj.type;
-                    networkManager.SendToClient(clientId, blockData);
-                }
+        bool wasSpawnReady = worldTransferClient.IsSpawnReady();
+        if (!worldTransferClient.Apply(msg, mapStore.GetVoxels())) {
+            std::lock_guard<std::recursive_mutex> lock(consoleHistoryMutex);
+            AddToHistory("Malformed world batch " + std::to_string(msg.sequence));
+        }
+        networkManager.SendData(NetMessage::WorldAck(msg.sequence));
 
-                // Send existing players pos
-                for (const auto& pair : networkPlayers) {
-                    std::string posData = "POS:" + std::to_string(pair.first) + ":" +
-                        std::to_string(pair.second.position.x) + "," +
-                        std::to_string(pair.second.position.y) + "," +
-                        std::to_string(pair.second.position.z);
-                    networkManager.SendToClient(clientId, posData);
-                }
+        float elapsedMs = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - worldSyncStats.start).count();
+        std::lock_guard<std::recursive_mutex> lock(consoleHistoryMutex);
+        if (!wasSpawnReady && worldTransferClient.IsSpawnReady()) {
+            worldSyncStats.spawnReadyMs = elapsedMs;
+            AddToHistory("Spawn area loaded in " + std::to_string((int)elapsedMs) + " ms");
+        }
+        uint32_t total = worldTransferClient.GetChunkCount();
+        int quarter = total ? (int)(worldTransferClient.GetChunksReceived() * 4 / total) : 4;
+        if (worldTransferClient.IsActive() && quarter > worldSyncStats.reportedQuarter && quarter < 4) {
+            worldSyncStats.reportedQuarter = quarter;
+            AddToHistory("World sync " + std::to_string(quarter * 25) + "%");
+        }
+        if (!worldTransferClient.IsActive()) {
+            worldSyncStats.totalMs = elapsedMs;
+            AddToHistory("World sync complete: " + std::to_string(mapStore.GetVoxels().GetBlockCount()) +
+                " blocks in " + std::to_string((int)elapsedMs) + " ms");
+        }
+        break;
+    }
 
-                // Notify other clients about new player
-                std::string newPlayerData = "NEW_PLAYER:" + std::to_string(assignedId);
-                networkManager.BroadcastData(newPlayerData);
-            }
-        }
-        else if (data == "LEAVE") {
-            if (networkManager.IsServer()) {
-                networkPlayers.erase(clientId);
-                {
-                    std::lock_guard<std::recursive_mutex> lock(consoleHistoryMutex);
-                    AddToHistory("Player " + std::to_string(clientId) + " left");
-                }
+    case NetMessageType::BlockAdd: {
+        mapStore.AddBlock(msg.x, msg.y, msg.z, BlockRegistry::Intern(msg.blockName));
+        break;
+    }
 
-                networkManager.BroadcastData("PLAYER_LEFT:" + std::to_string(clientId));
-            }
+    case NetMessageType::BlockRemove: {
+        if (mapStore.RemoveBlock(msg.x, msg.y, msg.z)) {
+            std::lock_guard<std::recursive_mutex> lock(consoleHistoryMutex);
+            AddToHistory("Block removed by network at (" +
+                std::to_string(msg.x) + "," +
+                std::to_string(msg.y) + "," +
+                std::to_string(msg.z) + ")");
         }
-        else if (data.find("PLAYER_LEFT:") == 0) {
-            std::string idStr = data.substr(12);
-            try {
-                int leftId = std::stoi(idStr);
-                networkPlayers.erase(leftId);
-                {
-                    std::lock_guard<std::recursive_mutex> lock(consoleHistoryMutex);
-                    AddToHistory("Player " + std::to_string(leftId) + " disconnected");
-                }
-            }
-            catch (...) {
-                std::lock_guard<std::recursive_mutex> lock(consoleHistoryMutex);
-                AddToHistory("Invalid player leave message");
-            }
+        else {
+            std::lock_guard<std::recursive_mutex> lock(consoleHistoryMutex);
+            AddToHistory("Block not found for removal");
         }
-        else if (data.find("ASSIGN_ID:") == 0 && !networkManager.IsServer()) {
-            std::string idStr = data.substr(10);
-            try {
-                int assignedId = std::stoi(idStr);
-                {
-                    std::lock_guard<std::recursive_mutex> lock(consoleHistoryMutex);
-                    AddToHistory("Assigned client ID: " + std::to_string(assignedId));
-                }
-                isSynchronized = true; // Synchronization complete after receiving ID
-            }
-            catch (...) {
+        break;
+    }
+
+    case NetMessageType::PlayerLeft: {
+        networkPlayers.erase(msg.playerId);
+        std::lock_guard<std::recursive_mutex> lock(consoleHistoryMutex);
+        AddToHistory("Player " + std::to_string(msg.playerId) + " disconnected");
+        break;
+    }
+
+    case NetMessageType::AssignId:
+        if (!networkManager.IsServer()) {
+            {
                 std::lock_guard<std::recursive_mutex> lock(consoleHistoryMutex);
-                AddToHistory("Invalid assign ID data");
+                AddToHistory("Assigned client ID: " + std::to_string(msg.playerId));
             }
+            localPlayerId = msg.playerId;
+            isSynchronized = true; // Synchronization complete after receiving ID
         }
-        else if (data.find("NEW_PLAYER:") == 0) {
-            std::string idStr = data.substr(11);
-            try {
-                int newId = std::stoi(idStr);
-                if (networkPlayers.find(newId) == networkPlayers.end()) {
-                    NetworkPlayer newPlayer;
-                    newPlayer.clientId = newId;
-                    newPlayer.name = "Player" + std::to_string(newId);
-                    newPlayer.position = XMFLOAT3(0.f, 0.f, 0.f);
-                    networkPlayers[newId] = newPlayer;
-                    {
-                        std::lock_guard<std::recursive_mutex> lock(consoleHistoryMutex);
-                        AddToHistory("New player " + std::to_string(newId) + " joined");
-                    }
-                }
-            }
-            catch (...) {
-                std::lock_guard<std::recursive_mutex> lock(consoleHistoryMutex);
-                AddToHistory("Invalid new player data");
-            }
+        break;
+
+    case NetMessageType::NewPlayer:
+        // the player itself shows up in snapshots once it reports a position
+        if (msg.playerId != localPlayerId) {
+            std::lock_guard<std::recursive_mutex> lock(consoleHistoryMutex);
+            AddToHistory("New player " + std::to_string(msg.playerId) + " joined");
         }
+        break;
+
+    default:
+        break;
+    }
+}
+
+bool GameEngine::Initialize()
+{
+    mouseLocked = true;
+    ShowCursor(FALSE);
+
+    networkManager.Initialize();
+    InitHostSession();
+
+    networkManager.SetDataReceivedCallback([this](const NetMessage& msg, int clientId) {
+        // runs on the network threads, game state is only touched in Update
+        InboundMessage inbound;
+        inbound.msg = msg;
+        inbound.clientId = clientId;
+        inbound.received = std::chrono::steady_clock::now();
+        inboundMessages.Push(std::move(inbound));
         });
 
         HRESULT hr = S_OK;
@@ -1750,16 +1784,12 @@ bool GameEngine::Initialize()
         projectionMatrix = XMMatrixPerspectiveFovLH(XM_PIDIV2, width / (float)height, 0.01f, 500.f);
 
         if (!CreateShaders()) return false;
+        if (!CreateBlockShaders()) return false;
         if (!Create2DShaders()) return false;
-        if (!CreateCheckerTextureSRV(64, 16, &pCubeSRV)) return false;
-        if (!CreateGrassTextureSRV(64, &pGrassSRV)) return false;
-        if (!CreateStoneTextureSRV(64, &pStoneSRV)) return false;
-        if (!CreateWoodTextureSRV(64, &pWoodSRV)) return false;
-        if (!CreateMetalTextureSRV(64, &pMetalSRV)) return false;
-        if (!CreateBrickTextureSRV(64, &pBrickSRV)) return false;
-        if (!CreateDirtTextureSRV(64, &pDirtSRV)) return false;
-        if (!CreateWaterTextureSRV(2048, &pWaterSRV)) return false;
-        if (!CreateLavaTextureSRV(2048, &pLavaSRV)) return false;
+        TextureArchive textures;
+        if (!OpenTextureArchive(textures)) return false;
+        if (!CreateBlockTextures(textures)) return false;
+        textures.Close();
         if (!CreatePlayerTextureSRV(2048, &pPlayerSRV)) return false;
         if (!CreateWhiteTexture()) return false;
         if (!CreateInventoryMesh()) return false;
@@ -1784,25 +1814,13 @@ bool GameEngine::Initialize()
 
         UpdateCamera();
         RegisterCommands();
+        LoadWorldPresets();
 
         parkourObjects = ParkourMap::CreateParkourCourse();
-        parkourBalls = ParkourMap::CreateParkourBalls();
-        for (const auto& parkourObj : parkourObjects) {
-            MapObject obj;
-            obj.position = parkourObj.position;
-            obj.rotation = parkourObj.rotation;
-            obj.scale = parkourObj.scale;
-            obj.type = parkourObj.type;
-            mapObjects.push_back(obj);
-        }
-        for (const auto& ball : parkourBalls) {
-            MapObject obj;
-            obj.position = ball.position;
-            obj.rotation = ball.rotation;
-            obj.scale = ball.scale;
-            obj.type = ball.type;
-            mapObjects.push_back(obj);
-        }
+        for (const auto& parkourObj : parkourObjects) mapStore.AddObject(parkourObj);
+        rigidBodies.SetThreadCount((int)(std::min)(4u, std::thread::hardware_concurrency()));
+        SpawnParkourBalls();
+        mapStore.Recover();
 
         return true;
 }
@@ -2033,10 +2051,10 @@ void GameEngine::Render()
     ID3D11RasterizerState* oldRasterState = nullptr;
     pContext->RSGetState(&oldRasterState);
 
-    skybox.Render(pContext, viewMatrix, projectionMatrix);
+    float time = GetTimeSeconds();
+    skybox.Render(pContext, viewMatrix, projectionMatrix, time);
 
     // Clouds
-    float time = GetTimeSeconds();
     //clouds.Render(pContext, viewMatrix, projectionMatrix, time);
 
     // --- Fog ---
@@ -2084,46 +2102,17 @@ void GameEngine::Render()
     pContext->DrawIndexed(floorIndexCount, 0, 0);
 
     // Render map obj
-    pContext->IASetVertexBuffers(0, 1, &pCubeVB, &stride3D, &offset3D);
-    pContext->IASetIndexBuffer(pCubeIB, DXGI_FORMAT_R16_UINT, 0);
-
-    for (auto& obj : mapObjects) {
-        XMMATRIX world = XMMatrixScaling(obj.scale.x, obj.scale.y, obj.scale.z) *
-            XMMatrixRotationRollPitchYaw(obj.rotation.x, obj.rotation.y, obj.rotation.z) *
-            XMMatrixTranslation(obj.position.x, obj.position.y, obj.position.z);
-
-        ID3D11ShaderResourceView* texture = nullptr;
-        if (obj.type == "grass") texture = pGrassSRV;
-        else if (obj.type == "stone") texture = pStoneSRV;
-        else if (obj.type == "wood") texture = pWoodSRV;
-        else if (obj.type == "metal") texture = pMetalSRV;
-        else if (obj.type == "brick") texture = pBrickSRV;
-        else if (obj.type == "dirt") texture = pDirtSRV;
-        else if (obj.type == "water") texture = pWaterSRV;
-        else if (obj.type == "lava") texture = pLavaSRV;
-        else texture = pCubeSRV;
-
-        pContext->Map(pCB, 0, D3D11_MAP_WRITE_DISCARD, 0, &mapped3D);
-        cb3D = reinterpret_cast<ConstantBuffer*>(mapped3D.pData);
-        cb3D->world = XMMatrixTranspose(world);
-        cb3D->view = XMMatrixTranspose(viewMatrix);
-        cb3D->projection = XMMatrixTranspose(projectionMatrix);
-        cb3D->cameraPos = cameraPosition;
-        cb3D->lightDir = lightDir;
-        cb3D->lightColor = lightColor;
-        cb3D->ambient = ambient;
-        pContext->Unmap(pCB, 0);
-
-        pContext->PSSetShaderResources(0, 1, &texture);
-        pContext->DrawIndexed(cubeIndexCount, 0, 0);
-    }
+    UpdateViewFrustum();
+    UpdateChunkMeshes();
+    RenderChunkMeshes(lightDir, lightColor, ambient);
+    RenderMapBlocks(lightDir, lightColor, ambient);
 
     // Render Player
     if (thirdPerson) {
-        RenderPlayer(playerPos, cameraRotation.y, true, cameraRotation.x);
+        RenderPlayer(renderPlayerPos, cameraRotation.y, true, cameraRotation.x);
     }
     else { // firstperson
-        RenderPlayer(playerPos, cameraRotation.y, true, cameraRotation.x);
+        RenderPlayer(renderPlayerPos, cameraRotation.y, true, cameraRotation.x);
     }
 
     if (inventoryOpen) {
@@ -2134,10 +2123,17 @@ void GameEngine::Render()
     if (isMultiplayer && !networkPlayers.empty()) {
         for (const auto& pair : networkPlayers) {
             const NetworkPlayer& player = pair.second;
-            int currentId = networkManager.IsServer() ? -1 : 0;
-            if (pair.first == currentId && !thirdPerson /*|| thirdPerson*/) continue;
+            if (pair.first == localPlayerId && !thirdPerson /*|| thirdPerson*/) continue;
+
+            cullCounters.playersTested++;
+            if (frustumCulling && !viewFrustum.TestBox(
+                player.position.x - 1.0f, player.position.y, player.position.z - 1.0f,
+                player.position.x + 1.0f, player.position.y + 2.5f, player.position.z + 1.0f)) {
+                continue;
+            }
+            cullCounters.playersVisible++;
 
-            RenderPlayer(player.position, 0.0f, false);
+            RenderPlayer(player.position, player.rotation.y, false, player.rotation.x);
         }
     }
 
@@ -2189,16 +2185,7 @@ void GameEngine::Render()
 
         for (int i = 0; i < INVENTORY_SLOTS; ++i)
         {
-            ID3D11ShaderResourceView* texture = nullptr;
-            if (inventoryBlocks[i] == "grass") texture = pGrassSRV;
-            else if (inventoryBlocks[i] == "stone") texture = pStoneSRV;
-            else if (inventoryBlocks[i] == "wood") texture = pWoodSRV;
-            else if (inventoryBlocks[i] == "metal") texture = pMetalSRV;
-            else if (inventoryBlocks[i] == "brick") texture = pBrickSRV;
-            else if (inventoryBlocks[i] == "dirt") texture = pDirtSRV;
-            else if (inventoryBlocks[i] == "water") texture = pWaterSRV;
-            else if (inventoryBlocks[i] == "lava") texture = pLavaSRV;
-            else texture = pCubeSRV;
+            ID3D11ShaderResourceView* texture = GetTextureForBlock(inventoryBlocks[i]);
 
             pContext->PSSetShaderResources(0, 1, &texture);
             pContext->PSSetSamplers(0, 1, &pSampler);
@@ -2269,10 +2256,10 @@ void GameEngine::Render()
                 if (i < inventoryBlocks.size()) 
                 { 
                     if (i == selectedInventorySlot) {
-                        inventoryInfo += "[" + inventoryBlocks[i] + "] ";
+                        inventoryInfo += "[" + BlockRegistry::GetName(inventoryBlocks[i]) + "] ";
                     }
                     else {
-                        inventoryInfo += inventoryBlocks[i] + " ";
+                        inventoryInfo += BlockRegistry::GetName(inventoryBlocks[i]) + " ";
                     }
                 }
                 else {
@@ -2324,9 +2311,18 @@ void GameEngine::Cleanup()
     SafeRelease(&pDirtSRV);
     SafeRelease(&pWaterSRV);
     SafeRelease(&pLavaSRV);
+    SafeRelease(&pBlockTextureArraySRV);
     SafeRelease(&pSampler);
     SafeRelease(&pCB);
     SafeRelease(&pInputLayout);
+    ReleaseChunkMeshes();
+    SafeRelease(&pInstanceVB);
+    SafeRelease(&pFrameCB);
+    SafeRelease(&pInstancedInputLayout);
+    SafeRelease(&pBlockPS);
+    SafeRelease(&pInstancedVS);
+    SafeRelease(&pChunkInputLayout);
+    SafeRelease(&pChunkVS);
     SafeRelease(&pPS);
     SafeRelease(&pVS);
     SafeRelease(&p2DVS);
@@ -2356,43 +2352,14 @@ void GameEngine::Cleanup()
     SafeRelease(&pContext);
     SafeRelease(&pDevice);
 
-    mapObjects.clear();
+    // a clean exit keeps the old behaviour: edits that weren't saved are dropped
+    mapStore.GetJournal().Discard();
     networkPlayers.clear();
 
     // XAudio2
     CoUninitialize();
 }
 
-bool GameEngine::RayIntersectsAABB(const XMFLOAT3& rayOrigin, const XMFLOAT3& rayDir, const AABB& box, float& tNear) {
-    float tMin = -INFINITY;
-    float tMax = INFINITY;
-
-    for (int i = 0; i < 3; ++i) {
-        float r = (i == 0) ? rayDir.x : (i == 1) ? rayDir.y : rayDir.z;
-        float o = (i == 0) ? rayOrigin.x : (i == 1) ? rayOrigin.y : rayOrigin.z;
-        float bmin = (i == 0) ? box.min.x : (i == 1) ? box.min.y : box.min.z;
-        float bmax = (i == 0) ? box.max.x : (i == 1) ? box.max.y : box.max.z;
-
-        if (std::abs(r) < 0.0001f) {
-            if (o < bmin || o > bmax) return false;
-        }
-        else {
-            float ood = 1.0f / r;
-            float t1 = (bmin - o) * ood;
-            float t2 = (bmax - o) * ood;
-            if (t1 > t2) std::swap(t1, t2);
-#undef max
-            tMin = std::max(tMin, t1);
-#undef min
-            tMax = std::min(tMax, t2);
-            if (tMin > tMax) return false;
-        }
-    }
-
-    tNear = (tMin > 0.0f) ? tMin : tMax;
-    return tNear > 0.0f && tNear < buildReach;
-}
-
 XMFLOAT3 GameEngine::GetPlacementPosition(const XMFLOAT3& hitPoint, const XMFLOAT3& normal) {
     XMFLOAT3 pos = hitPoint;
     pos.x += normal.x;
@@ -2451,12 +2418,7 @@ void GameEngine::HandleBuilding()
                     playerAABB.min.z <= newBlockAABB.max.z && playerAABB.max.z >= newBlockAABB.min.z);
 
                 if (!intersectsPlayer || newPos.y < playerPos.y + 0.001f) {
-                    MapObject obj;
-                    obj.position = newPos;
-                    obj.rotation = { 0.f, 0.f, 0.f };
-                    obj.scale = { 1.f, 1.f, 1.f };
-                    obj.type = inventoryBlocks[selectedInventorySlot];
-                    mapObjects.push_back(obj);
+                    mapStore.AddBlock(newPos.x, newPos.y, newPos.z, inventoryBlocks[selectedInventorySlot]);
 
                     /*AddToHistory("Block placed at " +
                         std::to_string((int)newPos.x) + "," +
@@ -2464,11 +2426,8 @@ void GameEngine::HandleBuilding()
                         std::to_string((int)newPos.z));*/
 
                     if (isMultiplayer && isSynchronized) {
-                        std::string blockData = "BLOCK:ADD|" +
-                            std::to_string(newPos.x) + "," +
-                            std::to_string(newPos.y) + "," +
-                            std::to_string(newPos.z) + "|" +
-                            inventoryBlocks[selectedInventorySlot];
+                        NetMessage blockData = NetMessage::BlockAdd(newPos.x, newPos.y, newPos.z,
+                            BlockRegistry::GetName(inventoryBlocks[selectedInventorySlot]));
                         if (networkManager.IsServer()) {
                             networkManager.BroadcastData(blockData);
                             AddToHistory("Block placement broadcasted to all clients");
@@ -2493,44 +2452,14 @@ void GameEngine::HandleBuilding()
         }
     }
 
-    float closestT = buildReach;
-    int hitIndex = -1;
-    XMFLOAT3 hitNormal = { 0.f, 0.f, 0.f };
-    XMFLOAT3 hitPoint = { 0.0f, 0.0f, 0.0f };
+    BlockRayHit hit;
+    if (RaycastBlocks(rayOrigin, rayDir, buildReach, hit)) {
+        const XMFLOAT3& hitNormal = hit.normal;
+        const XMFLOAT3& hitPoint = hit.point;
 
-    for (int i = 0; i < (int)mapObjects.size(); ++i) {
-        const auto& obj = mapObjects[i];
-        AABB box;
-        box.min = { obj.position.x - obj.scale.x, obj.position.y - obj.scale.y, obj.position.z - obj.scale.z };
-        box.max = { obj.position.x + obj.scale.x, obj.position.y + obj.scale.y, obj.position.z + obj.scale.z };
-
-        float t;
-        if (RayIntersectsAABB(rayOrigin, rayDir, box, t) && t < closestT) {
-            closestT = t;
-            hitIndex = i;
-            hitPoint.x = rayOrigin.x + t * rayDir.x;
-            hitPoint.y = rayOrigin.y + t * rayDir.y;
-            hitPoint.z = rayOrigin.z + t * rayDir.z;
-
-            float eps = 0.01f;
-            if (abs(hitPoint.x - box.min.x) < eps) hitNormal = { -1.f, 0.f, 0.f };
-            else if (abs(hitPoint.x - box.max.x) < eps) hitNormal = { 1.f, 0.f, 0.f };
-            else if (abs(hitPoint.y - box.min.y) < eps) hitNormal = { 0.f, -1.f, 0.f };
-            else if (abs(hitPoint.y - box.max.y) < eps) hitNormal = { 0.f, 1.f, 0.f };
-            else if (abs(hitPoint.z - box.min.z) < eps) hitNormal = { 0.f, 0.f, -1.f };
-            else if (abs(hitPoint.z - box.max.z) < eps) hitNormal = { 0.f, 0.f, 1.f };
-        }
-    }
-
-    if (hitIndex != -1) {
         if (doBreaking) {
-            const auto& obj = mapObjects[hitIndex];
-
             if (isMultiplayer) {
-                std::string removeData = "BLOCK:REMOVE|" +
-                    std::to_string(obj.position.x) + "," +
-                    std::to_string(obj.position.y) + "," +
-                    std::to_string(obj.position.z);
+                NetMessage removeData = NetMessage::BlockRemove(hit.blockPosition.x, hit.blockPosition.y, hit.blockPosition.z);
 
                 if (networkManager.IsServer()) {
                     networkManager.BroadcastData(removeData);
@@ -2542,7 +2471,7 @@ void GameEngine::HandleBuilding()
                 }
             }
 
-            mapObjects.erase(mapObjects.begin() + hitIndex);
+            mapStore.RemoveBlock(hit.blockPosition.x, hit.blockPosition.y, hit.blockPosition.z);
             mouseStates[0] = false;
         }
         else if (doPlacing) {
@@ -2562,19 +2491,11 @@ void GameEngine::HandleBuilding()
                     playerAABB.min.z <= newBlockAABB.max.z && playerAABB.max.z >= newBlockAABB.min.z);
 
                 if (!intersectsPlayer) {
-                    MapObject obj;
-                    obj.position = newPos;
-                    obj.rotation = { 0.f, 0.f, 0.f };
-                    obj.scale = { 1.f, 1.f, 1.f };
-                    obj.type = inventoryBlocks[selectedInventorySlot];
-                    mapObjects.push_back(obj);
+                    mapStore.AddBlock(newPos.x, newPos.y, newPos.z, inventoryBlocks[selectedInventorySlot]);
 
                     if (isMultiplayer) {
-                        std::string blockData = "BLOCK:ADD|" +
-                            std::to_string(newPos.x) + "," +
-                            std::to_string(newPos.y) + "," +
-                            std::to_string(newPos.z) + "|" +
-                            inventoryBlocks[selectedInventorySlot];
+                        NetMessage blockData = NetMessage::BlockAdd(newPos.x, newPos.y, newPos.z,
+                            BlockRegistry::GetName(inventoryBlocks[selectedInventorySlot]));
 
                         if (networkManager.IsServer()) {
                             networkManager.BroadcastData(blockData);
@@ -2594,35 +2515,18 @@ void GameEngine::HandleBuilding()
 
 bool GameEngine::CreateTextureFromData(const BYTE* data, UINT width, UINT height, ID3D11ShaderResourceView** outSRV)
 {
-    HRESULT hr;
-    D3D11_TEXTURE2D_DESC texDesc = {};
-    texDesc.Width = width;
-    texDesc.Height = height;
-    texDesc.MipLevels = 0;
-    texDesc.ArraySize = 1;
-    texDesc.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
-    texDesc.SampleDesc.Count = 1;
-    texDesc.Usage = D3D11_USAGE_DEFAULT;
-    texDesc.BindFlags = D3D11_BIND_SHADER_RESOURCE | D3D11_BIND_RENDER_TARGET;
-    texDesc.MiscFlags = D3D11_RESOURCE_MISC_GENERATE_MIPS;
-
-    ID3D11Texture2D* pTexture = nullptr;
-    hr = pDevice->CreateTexture2D(&texDesc, nullptr, &pTexture);
-    if (FAILED(hr)) return false;
-
-    pContext->UpdateSubresource(pTexture, 0, nullptr, data, width * 4, 0);
-
-    D3D11_SHADER_RESOURCE_VIEW_DESC srvDesc = {};
-    srvDesc.Format = texDesc.Format;
-    srvDesc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURE2D;
-    srvDesc.Texture2D.MostDetailedMip = 0;
-    srvDesc.Texture2D.MipLevels = -1;
-    hr = pDevice->CreateShaderResourceView(pTexture, &srvDesc, outSRV);
-    if (FAILED(hr)) { SafeRelease(&pTexture); return false; }
-
-    pContext->GenerateMips(*outSRV);
-    SafeRelease(&pTexture);
-    return true;
+    // mips built here on the CPU, so the texture can be immutable and nothing
+    // waits on GenerateMips at startup
+    std::vector<std::vector<uint8_t>> chain;
+    BuildMipChain(width, height, std::vector<uint8_t>(data, data + (size_t)width * height * 4), chain);
+
+    std::vector<TextureMip> mips(chain.size());
+    for (size_t level = 0; level < chain.size(); ++level) {
+        mips[level].width = MipDimension(width, (int)level);
+        mips[level].height = MipDimension(height, (int)level);
+        mips[level].pixels = chain[level].data();
+    }
+    return CreateMippedTextureSRV(mips, outSRV);
 }
 
 
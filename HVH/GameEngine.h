@@ -15,10 +15,31 @@
 #include <sstream>
 #include <algorithm>
 #include <unordered_map>
+#include <chrono>
 #include "map1.h"
 #include "Jmp.h"
 #include <map>
 #include "NetworkManager.h"
+#include "HostSession.h"
+#include "HostCommands.h"
+#include "MpscQueue.h"
+#include "Replication.h"
+#include "NetSmoothing.h"
+#include "WorldTransfer.h"
+#include "WorldStore.h"
+#include "GameLoop.h"
+#include "PlayerPhysics.h"
+#include "RigidBodies.h"
+#include "TextureArchive.h"
+#include "MipChain.h"
+#include "VoxelRaycast.h"
+#include "SpatialGrid.h"
+#include "VoxelWorld.h"
+#include "BlockRegistry.h"
+#include "BlockInstancing.h"
+#include "ChunkMesher.h"
+#include "Frustum.h"
+#include "WorldPresets.h"
 #include <d2d1.h>
 #include <dwrite.h> 
 #include "SafeRelease.h"
@@ -66,7 +87,8 @@ public:
     }
 
     bool Initialize();
-    void Update(float dt);
+    // real seconds since the last frame; runs whatever fixed ticks are due
+    void Update(float frameSeconds);
     void Render();
     void OnResize(UINT width, UINT height);
     void OnKeyDown(UINT key);
@@ -76,7 +98,15 @@ public:
     void OnChar(UINT ch);
     void OnMouseMove(int x, int y, bool captureMouse);
     void Cleanup();
+    void Tick(float dt);
     void Physics(float dt);
+    void ProcessNetworkMessages();
+    void HandleNetworkMessage(const NetMessage& msg, int clientId);
+    void UpdateReplication();
+    void SendSnapshots();
+    void InitHostSession();
+    void ApplySnapshotWorld(const NetEntityMap& world, double serverTime);
+    void ReconcileLocalPlayer(uint32_t inputAck, const NetQuantizedState& state);
 
     //players
     bool CreatePlayerTextureSRV(UINT size, ID3D11ShaderResourceView** outSRV);
@@ -95,6 +125,11 @@ public:
         ambient = currentAmbient;
     };
 
+    // world_preset / world_cycle, the presets come from WorldPresets.txt
+    bool LoadWorldPresets();
+    void ApplyWorldPreset(const WorldPreset& preset, bool fadeSky);
+    void UpdateWorldCycle(float frameSeconds);
+
     //methods
 
     //inventory
@@ -104,8 +139,9 @@ public:
     bool IsKeySpecial(UINT key);
     void OpenInventory();
     void CloseInventory();
-    ID3D11ShaderResourceView* GetTextureForBlock(const std::string& blockType);
-    void RenderBlockInInventorySlot(int slotIndex, const std::string& blockType);
+    ID3D11ShaderResourceView* GetTextureForBlock(BlockId block);
+    ID3D11ShaderResourceView* GetBlockTextureSRV(BlockTexture texture);
+    void RenderBlockInInventorySlot(int slotIndex, BlockId block);
     void RenderCreativeInventory();
     bool CreateCreativeInventoryMesh();
     bool CreateWhiteTexture();
@@ -113,15 +149,10 @@ public:
 
     //---base
     bool CreateTextureFromData(const BYTE* data, UINT width, UINT height, ID3D11ShaderResourceView** outSRV);
-    bool CreateCheckerTextureSRV(UINT size, UINT tiles, ID3D11ShaderResourceView** outSRV);
-    bool CreateGrassTextureSRV(UINT size, ID3D11ShaderResourceView** outSRV);
-    bool CreateMetalTextureSRV(UINT size, ID3D11ShaderResourceView** outSRV);
-    bool CreateStoneTextureSRV(UINT size, ID3D11ShaderResourceView** outSRV);
-    bool CreateWoodTextureSRV(UINT size, ID3D11ShaderResourceView** outSRV);
-    bool CreateBrickTextureSRV(UINT size, ID3D11ShaderResourceView** outSRV);
-    bool CreateDirtTextureSRV(UINT size, ID3D11ShaderResourceView** outSRV);
-    bool CreateWaterTextureSRV(UINT size, ID3D11ShaderResourceView** outSRV);
-    bool CreateLavaTextureSRV(UINT size, ID3D11ShaderResourceView** outSRV);
+    bool CreateMippedTextureSRV(const std::vector<TextureMip>& mips, ID3D11ShaderResourceView** outSRV);
+    // block textures come prebuilt, mips included, from Textures\blocks.hvht
+    bool OpenTextureArchive(TextureArchive& archive);
+    bool CreateBlockTextures(const TextureArchive& archive);
     //---base
 
     //crosshair
@@ -194,7 +225,7 @@ public:
 
     std::string currentTabCompletionPrefix;
     std::vector<std::string> currentTabMatches;
-    const std::unordered_map<std::string, std::function<void(const std::vector<std::string>&)>>& GetCommands() const {
+    const ConsoleCommands& GetCommands() const {
         return commands;
     };
 
@@ -210,6 +241,7 @@ public:
         XMFLOAT3 rotation = { 0.0f, 0.0f, 0.0f };
         std::string name = "";
         int clientId = 0;
+        EntityHistory history; // received states, position/rotation are sampled from it
     };
 
     struct NetworkBlock {
@@ -225,36 +257,68 @@ public:
         }
     };
 
-    struct MapObject {
-        XMFLOAT3 position;
-        XMFLOAT3 rotation;
-        XMFLOAT3 scale;
-        std::string type;
-        ID3D11ShaderResourceView* texture;
-
-        MapObject()
-            : position(0.0f, 0.0f, 0.0f)
-            , rotation(0.0f, 0.0f, 0.0f)
-            , scale(1.0f, 1.0f, 1.0f)
-            , type("")
-            , texture(nullptr)
-        {
-        }
-    };
-
 
 private:
     NetworkManager networkManager;
+    // joins, snapshots, world transfers and edits while hosting, the same
+    // code the dedicated server runs
+    HostSession hostSession{ networkManager };
     bool isMultiplayer = false;
     std::unordered_map<int, XMFLOAT3> otherPlayers; // ID -> pos
 
     std::unordered_map<int, NetworkPlayer> networkPlayers;
     std::vector<NetworkBlock> pendingBlocks; // blocs on serv
-    float networkUpdateTimer = 0.0f;
     std::vector<std::string> consoleHistory;
     std::recursive_mutex consoleHistoryMutex;
     const size_t maxConsoleHistorySize = 100;
-    int nextClientId = 1;
+
+    // snapshot replication: the host sends a delta per client every tick,
+    // clients upload only their own player
+    SnapshotClient snapshotClient;
+    std::chrono::steady_clock::time_point lastNetTickTime;
+    float netTickAccumulator = 0.0f;
+    int localPlayerId = -1; // host is -1, clients get their connection id
+
+    // remote players render at a delay between buffered states; the local
+    // player is predicted and corrected when the host disagrees
+    struct ReconcileStats {
+        size_t corrections = 0;
+        float lastError = 0.0f;
+    };
+    InterpolationClock interpolationClock;
+    PredictionHistory prediction;
+    ReconcileStats reconcileStats;
+    bool pendingTeleport = false;
+
+    // join-time world transfer: chunk batches nearest to spawn first, the
+    // client stays frozen until the ones around spawn are in
+    struct WorldSyncStats {
+        std::chrono::steady_clock::time_point start;
+        float spawnReadyMs = 0.0f;
+        float totalMs = 0.0f;
+        int reportedQuarter = 0;
+    };
+    WorldTransferClient worldTransferClient;
+    WorldSyncStats worldSyncStats;
+
+    // messages decoded on the network threads, applied in Update
+    struct InboundMessage {
+        NetMessage msg;
+        int clientId = 0;
+        std::chrono::steady_clock::time_point received;
+    };
+    struct NetQueueStats {
+        size_t lastDepth = 0;
+        size_t peakDepth = 0;
+        size_t lastProcessed = 0;
+        size_t totalProcessed = 0;
+        float lastDrainMs = 0.0f;
+        float avgLatencyMs = 0.0f;
+        float maxLatencyMs = 0.0f;
+    };
+    MpscQueue<InboundMessage> inboundMessages;
+    NetQueueStats netQueueStats;
+    size_t maxMessagesPerTick = 256;
 
     float blockUpdateTimer;
     bool isSynchronized = false;
@@ -264,6 +328,12 @@ private:
     XMFLOAT3 currentLightColor;
     XMFLOAT3 currentAmbient;
 
+    WorldPresetTable worldPresets;
+    // world_cycle: from -> to -> from once per cyclePeriod seconds, -1 = off
+    int cycleFrom = -1, cycleTo = -1;
+    float cyclePeriod = 0.0f;
+    float cycleTime = 0.0f;
+
 
     struct Vertex
     {
@@ -289,20 +359,27 @@ private:
         DirectX::XMFLOAT3 ambient;   float _pad3 = 0.f;
     };
 
+    // b0 of the instanced block shader, world comes from the instance stream
+    struct FrameConstantBuffer
+    {
+        DirectX::XMMATRIX view;
+        DirectX::XMMATRIX projection;
+        DirectX::XMFLOAT3 cameraPos; float _pad0 = 0.f;
+        DirectX::XMFLOAT3 lightDir;  float _pad1 = 0.f;
+        DirectX::XMFLOAT3 lightColor;float _pad2 = 0.f;
+        DirectX::XMFLOAT3 ambient;   float _pad3 = 0.f;
+    };
+
     struct AABB {
         XMFLOAT3 min;
         XMFLOAT3 max;
     };
 
-    std::vector<std::string> inventoryBlocks = {
-    "grass", "stone", "wood", "metal", "brick", "dirt", "water", "lava", "cube"
-    };
+    std::vector<BlockId> inventoryBlocks = BlockRegistry::GetCreativeBlocks();
     int selectedInventorySlot = 0;
     const int INVENTORY_SLOTS = 9;
     bool inventoryOpen = false;
-    std::vector<std::string> creativeBlocks = {
-        "grass", "stone", "wood", "metal", "brick", "dirt", "water", "lava", "cube"
-    };
+    std::vector<BlockId> creativeBlocks = BlockRegistry::GetCreativeBlocks();
     int creativeSelectedSlot = 0;
     const int CREATIVE_SLOTS_PER_PAGE = 36; 
     int creativeCurrentPage = 0;
@@ -310,7 +387,7 @@ private:
     bool isDragging = false;
     int dragSourceSlot = -1;
     int dragTargetSlot = -1;
-    std::string draggedBlockType = "";
+    BlockId draggedBlockType = BLOCK_AIR;
 
     ID3D11Buffer* pCreativeInventoryVB = nullptr;
     ID3D11Buffer* pCreativeInventoryIB = nullptr;
@@ -333,6 +410,14 @@ private:
     bool CheckCameraCollision(const XMFLOAT3& cameraPos, float radius = 0.2f) const;
 
     bool CreateShaders();
+    bool CreateBlockShaders();
+    bool UpdateFrameConstants(const XMFLOAT3& lightDir, const XMFLOAT3& lightColor, const XMFLOAT3& ambient);
+    bool EnsureInstanceBuffer(UINT instanceCount);
+    void RenderMapBlocks(const XMFLOAT3& lightDir, const XMFLOAT3& lightColor, const XMFLOAT3& ambient);
+    void UpdateChunkMeshes();
+    void RenderChunkMeshes(const XMFLOAT3& lightDir, const XMFLOAT3& lightColor, const XMFLOAT3& ambient);
+    void ReleaseChunkMeshes();
+    void UpdateViewFrustum();
 
     void CreateCube(std::vector<Vertex>& vertices, std::vector<uint16_t>& indices, float x, float y, float z, float width, float height, float depth);
     bool CreateCubeMesh();
@@ -351,11 +436,23 @@ private:
     bool mouseStates[3] = { false, false, false }; // 0: left, 1: middle, 2: right
     float buildReach = 10.0f;
 
-    bool RayIntersectsAABB(const XMFLOAT3& rayOrigin, const XMFLOAT3& rayDir, const AABB& box, float& tNear);
     XMFLOAT3 GetPlacementPosition(const XMFLOAT3& hitPoint, const XMFLOAT3& normal);
     void HandleBuilding();
 
-    bool IsBlockAtPosition(const XMFLOAT3& position, float tolerance = 0.1f) const;
+    bool IsBlockAtPosition(const XMFLOAT3& position) const { return mapStore.IsOccupied(position.x, position.y, position.z); }
+    void CollectBlockBoxes(const AABB& region, std::vector<AABB>& out) const;
+    void CollectPhysicsBoxes(const PhysicsBox& region, std::vector<PhysicsBox>& out) const;
+    void SpawnParkourBalls();
+    void StepRigidBodies(float dt);
+
+    struct BlockRayHit {
+        float t;
+        XMFLOAT3 point;
+        XMFLOAT3 normal;
+        XMFLOAT3 blockPosition;
+        BlockId block;
+    };
+    bool RaycastBlocks(const XMFLOAT3& rayOrigin, const XMFLOAT3& rayDir, float maxDist, BlockRayHit& hit);
 
     bool Create2DShaders();
 
@@ -385,6 +482,51 @@ private:
     ID3D11Buffer* pCB = nullptr;
     ID3D11SamplerState* pSampler = nullptr;
 
+    // map blocks: instanced objects and chunk meshes share the pixel shader,
+    // which samples pBlockTextureArraySRV by each vertex's texture slice
+    ID3D11VertexShader* pInstancedVS = nullptr;
+    ID3D11InputLayout* pInstancedInputLayout = nullptr;
+    ID3D11VertexShader* pChunkVS = nullptr;
+    ID3D11InputLayout* pChunkInputLayout = nullptr;
+    ID3D11PixelShader* pBlockPS = nullptr;
+    ID3D11Buffer* pFrameCB = nullptr;
+    FrameConstantBuffer frameConstants;   // what pFrameCB holds, unchanged frames skip the Map
+    bool frameConstantsValid = false;
+    ID3D11Buffer* pInstanceVB = nullptr;
+    UINT instanceCapacity = 0;
+    InstanceList blockInstances;
+    std::vector<InstanceObject> instanceObjects;
+
+    // voxel chunk meshes, rebuilt only for chunks the VoxelWorld marks dirty
+    struct ChunkRenderData {
+        ID3D11Buffer* vb = nullptr;
+        ID3D11Buffer* ib = nullptr;
+        UINT indexCount = 0;
+        size_t triangles = 0;
+        float boundsMin[3] = {};
+        float boundsMax[3] = {};
+    };
+    std::unordered_map<int64_t, ChunkRenderData> chunkMeshes;
+    std::vector<ChunkCoords> dirtyChunkScratch;
+    ChunkMesh meshScratch;
+    bool greedyMeshing = true;
+    size_t lastRemeshCount = 0;
+    float lastRemeshMs = 0.0f;
+
+    // frustum + view distance culling, rebuilt once per Render
+    struct CullCounters {
+        size_t chunksTested = 0, chunksVisible = 0;
+        size_t objectsTested = 0, objectsVisible = 0;
+        size_t playersTested = 0, playersVisible = 0;
+    };
+    Frustum viewFrustum;
+    CullBoxList cullBoxes;
+    std::vector<uint8_t> cullVisible;
+    std::vector<const ChunkRenderData*> chunkDrawList;
+    CullCounters cullCounters;
+    bool frustumCulling = true;
+    float viewDistance = 500.0f;
+
     //player
     ID3D11ShaderResourceView* pPlayerSRV;
     ID3D11Buffer* pPlayerVB;
@@ -432,6 +574,8 @@ private:
     ID3D11ShaderResourceView* pDirtSRV = nullptr;
     ID3D11ShaderResourceView* pWaterSRV = nullptr;
     ID3D11ShaderResourceView* pLavaSRV = nullptr;
+    // every block texture as one Texture2DArray, slice = BlockTexture
+    ID3D11ShaderResourceView* pBlockTextureArraySRV = nullptr;
     //---------------textures 
 
 
@@ -456,10 +600,20 @@ private:
     DirectX::XMMATRIX        projectionMatrix;
 
     XMFLOAT3                 playerPos;
+    // simulation runs at a fixed rate, frames draw the player between its last two ticks
+    static constexpr float GAME_TIME_SCALE = 1.0f / 3.25f; // movement is tuned for game time
+    static constexpr float SNAP_DISTANCE = 4.0f;           // more than this in one tick is a teleport
+    FixedTimestep simClock;
+    XMFLOAT3 previousPlayerPos = { 0.f, 0.f, 0.f };
+    XMFLOAT3 renderPlayerPos = { 0.f, 0.f, 0.f };
+    float tickMilliseconds = 0.0f; // smoothed cost of one tick
     DirectX::XMFLOAT3        cameraPosition;
     DirectX::XMFLOAT3        cameraRotation; // pitch (x), yaw (y)
 
-    std::vector<MapObject> mapObjects;
+    // the map, its journal and background saves, the same store the dedicated
+    // server runs; saves and loads finish at the start of Tick
+    WorldStore mapStore;
+    RigidBodyWorld rigidBodies; // the parkour balls and anything spawned to roll around, not saved with the map
 
     // physics
     DirectX::XMFLOAT3 velocity;
@@ -488,7 +642,7 @@ private:
     std::string consoleInput;
     size_t historyIndex = 0;
 
-    std::unordered_map<std::string, std::function<void(const std::vector<std::string>&)>> commands;
+    ConsoleCommands commands;
 
     void ProcessCommand(const std::string& command);
     void RegisterCommands();
@@ -0,0 +1,61 @@
+#include "GameLoop.h"
+#include <thread>
+
+namespace {
+
+    const auto SPIN_MARGIN = std::chrono::microseconds(2000);
+}
+
+FixedTimestep::FixedTimestep(int tickRate)
+    : tickRate(tickRate > 0 ? tickRate : DEFAULT_TICK_RATE),
+    tickSeconds(1.0 / this->tickRate)
+{
+}
+
+int FixedTimestep::Advance(double frameSeconds)
+{
+    if (frameSeconds > 0.0) accumulator += frameSeconds;
+
+    int ticks = (int)(accumulator / tickSeconds);
+    if (ticks > MAX_TICKS_PER_FRAME) {
+        ticks = MAX_TICKS_PER_FRAME;
+        dropped += accumulator - ticks * tickSeconds;
+        accumulator = ticks * tickSeconds;
+    }
+    accumulator -= ticks * tickSeconds;
+    tick += ticks;
+    return ticks;
+}
+
+void FixedTimestep::Reset()
+{
+    accumulator = 0.0;
+    dropped = 0.0;
+    tick = 0;
+}
+
+void FrameLimiter::SetMaxFps(int fps)
+{
+    maxFps = fps > 0 ? fps : 0;
+    next = std::chrono::steady_clock::now();
+}
+
+void FrameLimiter::Wait()
+{
+    if (maxFps <= 0) return;
+
+    auto period = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+        std::chrono::duration<double>(1.0 / maxFps));
+    auto now = std::chrono::steady_clock::now();
+    next += period;
+    if (next < now) {
+        // a slow frame shouldn't be followed by a burst of fast ones
+        next = now;
+        return;
+    }
+
+    if (next - now > SPIN_MARGIN) std::this_thread::sleep_until(next - SPIN_MARGIN);
+    while (std::chrono::steady_clock::now() < next) {
+        std::this_thread::yield();
+    }
+}
@@ -0,0 +1,50 @@
+#pragma once
+#include <cstdint>
+#include <chrono>
+
+// Fixed simulation step driven by the variable frame clock. Each frame adds
+// its real duration and gets back the number of whole ticks that are due; the
+// remainder is how far rendering is between the last two ticks.
+class FixedTimestep
+{
+public:
+    static const int DEFAULT_TICK_RATE = 120;
+    // after a hitch the rest is dropped instead of catching up tick by tick
+    static const int MAX_TICKS_PER_FRAME = 8;
+
+    explicit FixedTimestep(int tickRate = DEFAULT_TICK_RATE);
+
+    int Advance(double frameSeconds);
+    void Reset();
+
+    int GetTickRate() const { return tickRate; }
+    double GetTickSeconds() const { return tickSeconds; }
+    // 0 = the previous tick, 1 = the latest one
+    float GetAlpha() const { return (float)(accumulator / tickSeconds); }
+    uint64_t GetTick() const { return tick; }
+    double GetDroppedSeconds() const { return dropped; }
+
+private:
+    int tickRate;
+    double tickSeconds;
+    double accumulator = 0.0;
+    double dropped = 0.0;
+    uint64_t tick = 0;
+};
+
+// Holds frames to a maximum rate. Sleeps most of the wait and spins the last
+// bit, since a sleep can overshoot by a whole scheduler quantum.
+class FrameLimiter
+{
+public:
+    // 0 = no limit (presenting with vsync still paces frames)
+    void SetMaxFps(int fps);
+    int GetMaxFps() const { return maxFps; }
+
+    // Once per frame, after presenting.
+    void Wait();
+
+private:
+    int maxFps = 0;
+    std::chrono::steady_clock::time_point next;
+};
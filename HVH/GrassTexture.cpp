@@ -1,3995 +0,0 @@
-//H V H   T E X T U R E   D A T A
-//================================
-//Generated by HVH Texture Editor v1.0
-#include <vector>
-#include "GameEngine.h"
-bool GameEngine::CreateGrassTextureSRV(UINT size, ID3D11ShaderResourceView** outSRV) {
-    static ID3D11ShaderResourceView* cachedSRV = nullptr;
-    if (cachedSRV) {
-        *outSRV = cachedSRV;
-        return true;
-    }
-
-    if (size != 64) return false;
-
-    static const struct PixelSegment {
-        BYTE r, g, b, a;
-        int count;
-    } segments[] = {
-        {38, 124, 32, 86, 1},
-        {39, 136, 34, 148, 1},
-        {39, 129, 34, 148, 1},
-        {39, 127, 34, 148, 1},
-        {39, 129, 34, 148, 1},
-        {41, 130, 37, 148, 1},
-        {17, 106, 13, 148, 1},
-        {5, 94, 0, 148, 1},
-        {31, 120, 25, 148, 1},
-        {43, 132, 37, 148, 1},
-        {39, 129, 34, 148, 1},
-        {39, 127, 34, 148, 1},
-        {48, 137, 44, 148, 1},
-        {53, 143, 49, 148, 1},
-        {46, 136, 41, 148, 1},
-        {43, 132, 37, 148, 1},
-        {51, 141, 46, 148, 1},
-        {55, 144, 49, 148, 1},
-        {41, 130, 37, 148, 1},
-        {34, 122, 29, 148, 1},
-        {53, 143, 48, 148, 1},
-        {63, 153, 58, 148, 1},
-        {51, 141, 46, 148, 1},
-        {46, 136, 41, 148, 2},
-        {46, 134, 41, 148, 1},
-        {37, 127, 32, 148, 1},
-        {34, 124, 29, 148, 1},
-        {24, 113, 18, 148, 1},
-        {17, 106, 13, 148, 1},
-        {18, 108, 13, 148, 1},
-        {17, 106, 12, 148, 1},
-        {34, 124, 29, 148, 1},
-        {43, 132, 37, 148, 1},
-        {58, 148, 53, 148, 1},
-        {72, 161, 67, 148, 1},
-        {29, 118, 24, 148, 1},
-        {3, 91, 0, 148, 1},
-        {15, 105, 10, 148, 1},
-        {17, 106, 12, 148, 1},
-        {43, 132, 37, 148, 1},
-        {60, 149, 55, 148, 1},
-        {53, 143, 48, 148, 1},
-        {49, 139, 44, 148, 1},
-        {43, 132, 37, 148, 1},
-        {37, 125, 32, 148, 1},
-        {46, 136, 41, 148, 1},
-        {56, 144, 51, 148, 1},
-        {41, 130, 36, 148, 1},
-        {29, 118, 24, 148, 1},
-        {39, 129, 34, 148, 1},
-        {46, 136, 41, 148, 1},
-        {44, 132, 39, 148, 1},
-        {44, 134, 39, 148, 1},
-        {34, 124, 29, 148, 1},
-        {25, 115, 20, 148, 1},
-        {34, 124, 29, 148, 1},
-        {39, 129, 34, 148, 1},
-        {39, 127, 34, 148, 1},
-        {39, 129, 36, 148, 1},
-        {39, 127, 36, 148, 1},
-        {37, 127, 34, 148, 1},
-        {36, 125, 32, 148, 1},
-        {39, 134, 32, 148, 1},
-        {38, 125, 33, 160, 1},
-        {43, 147, 37, 255, 1},
-        {42, 138, 36, 255, 2},
-        {43, 139, 38, 255, 1},
-        {45, 142, 40, 255, 1},
-        {18, 114, 12, 255, 1},
-        {3, 99, 0, 255, 1},
-        {33, 130, 28, 255, 1},
-        {47, 143, 42, 255, 1},
-        {44, 140, 38, 255, 1},
-        {42, 139, 37, 255, 1},
-        {54, 150, 48, 255, 1},
-        {59, 155, 54, 255, 1},
-        {51, 147, 46, 255, 1},
-        {46, 143, 41, 255, 1},
-        {56, 152, 50, 255, 1},
-        {60, 157, 55, 255, 1},
-        {45, 142, 40, 255, 1},
-        {37, 133, 31, 255, 1},
-        {58, 154, 53, 255, 1},
-        {71, 167, 65, 255, 1},
-        {57, 154, 52, 255, 1},
-        {51, 147, 46, 255, 1},
-        {49, 146, 44, 255, 1},
-        {49, 145, 43, 255, 1},
-        {40, 136, 35, 255, 1},
-        {36, 132, 31, 255, 1},
-        {25, 121, 20, 255, 1},
-        {19, 115, 13, 255, 1},
-        {20, 116, 14, 255, 1},
-        {17, 114, 12, 255, 1},
-        {36, 132, 31, 255, 1},
-        {46, 142, 40, 255, 1},
-        {63, 160, 58, 255, 1},
-        {79, 176, 74, 255, 1},
-        {31, 127, 26, 255, 1},
-        {1, 97, 0, 255, 1},
-        {16, 112, 10, 255, 1},
-        {18, 114, 13, 255, 1},
-        {47, 143, 41, 255, 1},
-        {66, 162, 61, 255, 1},
-        {58, 154, 53, 255, 1},
-        {55, 151, 49, 255, 1},
-        {47, 143, 42, 255, 1},
-        {40, 136, 35, 255, 1},
-        {51, 147, 46, 255, 1},
-        {61, 157, 55, 255, 1},
-        {44, 140, 39, 255, 1},
-        {31, 128, 26, 255, 1},
-        {43, 139, 38, 255, 1},
-        {50, 146, 45, 255, 1},
-        {48, 144, 42, 255, 1},
-        {49, 145, 43, 255, 1},
-        {37, 133, 31, 255, 1},
-        {29, 125, 23, 255, 1},
-        {38, 134, 32, 255, 1},
-        {43, 140, 38, 255, 1},
-        {43, 139, 38, 255, 1},
-        {44, 140, 39, 255, 1},
-        {42, 138, 39, 255, 1},
-        {41, 137, 38, 255, 1},
-        {40, 136, 35, 255, 1},
-        {42, 145, 35, 255, 1},
-        {34, 124, 29, 148, 1},
-        {37, 132, 31, 255, 1},
-        {39, 128, 34, 255, 1},
-        {42, 131, 37, 255, 1},
-        {38, 127, 33, 255, 1},
-        {37, 126, 32, 255, 1},
-        {38, 127, 33, 255, 2},
-        {36, 125, 31, 255, 1},
-        {34, 123, 29, 255, 1},
-        {36, 125, 31, 255, 2},
-        {41, 130, 36, 255, 1},
-        {44, 133, 39, 255, 1},
-        {42, 131, 37, 255, 1},
-        {40, 129, 35, 255, 1},
-        {39, 128, 34, 255, 4},
-        {40, 129, 35, 255, 1},
-        {41, 130, 36, 255, 1},
-        {34, 123, 29, 255, 1},
-        {29, 118, 24, 255, 1},
-        {50, 139, 45, 255, 1},
-        {61, 150, 56, 255, 1},
-        {48, 137, 43, 255, 1},
-        {41, 130, 36, 255, 1},
-        {33, 122, 28, 255, 1},
-        {27, 116, 22, 255, 1},
-        {32, 121, 27, 255, 2},
-        {43, 132, 38, 255, 1},
-        {51, 140, 46, 255, 1},
-        {47, 136, 42, 255, 2},
-        {36, 125, 31, 255, 1},
-        {29, 118, 24, 255, 1},
-        {35, 124, 30, 255, 1},
-        {38, 127, 33, 255, 1},
-        {42, 131, 37, 255, 1},
-        {44, 133, 39, 255, 1},
-        {41, 130, 36, 255, 1},
-        {40, 129, 35, 255, 1},
-        {37, 126, 32, 255, 1},
-        {34, 123, 29, 255, 1},
-        {44, 133, 39, 255, 1},
-        {50, 139, 45, 255, 1},
-        {45, 134, 40, 255, 1},
-        {44, 133, 39, 255, 1},
-        {42, 131, 37, 255, 1},
-        {39, 128, 34, 255, 1},
-        {43, 132, 38, 255, 1},
-        {48, 137, 43, 255, 1},
-        {32, 121, 27, 255, 1},
-        {21, 110, 16, 255, 1},
-        {23, 112, 18, 255, 1},
-        {22, 111, 17, 255, 1},
-        {29, 118, 23, 255, 1},
-        {34, 123, 30, 255, 1},
-        {36, 125, 34, 255, 1},
-        {38, 127, 35, 255, 1},
-        {42, 131, 38, 255, 1},
-        {48, 144, 43, 255, 1},
-        {34, 124, 31, 148, 1},
-        {36, 132, 33, 255, 1},
-        {39, 128, 36, 255, 1},
-        {42, 131, 38, 255, 1},
-        {38, 127, 35, 255, 1},
-        {37, 126, 33, 255, 1},
-        {48, 137, 44, 255, 1},
-        {54, 143, 51, 255, 1},
-        {37, 126, 33, 255, 1},
-        {29, 118, 24, 255, 1},
-        {34, 123, 29, 255, 1},
-        {35, 124, 30, 255, 1},
-        {36, 125, 31, 255, 1},
-        {37, 126, 32, 255, 1},
-        {39, 128, 34, 255, 1},
-        {40, 129, 35, 255, 1},
-        {33, 122, 28, 255, 1},
-        {30, 119, 25, 255, 1},
-        {38, 127, 33, 255, 1},
-        {43, 132, 38, 255, 1},
-        {33, 122, 28, 255, 1},
-        {29, 118, 24, 255, 1},
-        {24, 113, 19, 255, 1},
-        {19, 108, 14, 255, 1},
-        {51, 140, 46, 255, 1},
-        {70, 159, 65, 255, 1},
-        {52, 141, 47, 255, 1},
-        {44, 133, 39, 255, 1},
-        {37, 126, 32, 255, 1},
-        {32, 121, 27, 255, 1},
-        {38, 127, 33, 255, 1},
-        {40, 129, 35, 255, 1},
-        {48, 137, 43, 255, 1},
-        {55, 144, 50, 255, 1},
-        {43, 132, 38, 255, 1},
-        {35, 124, 30, 255, 1},
-        {39, 128, 34, 255, 1},
-        {41, 130, 36, 255, 1},
-        {44, 133, 39, 255, 1},
-        {47, 136, 42, 255, 1},
-        {40, 129, 35, 255, 1},
-        {36, 125, 31, 255, 1},
-        {35, 124, 30, 255, 1},
-        {34, 123, 29, 255, 1},
-        {33, 122, 28, 255, 1},
-        {32, 121, 27, 255, 1},
-        {42, 131, 37, 255, 1},
-        {48, 137, 43, 255, 2},
-        {50, 139, 45, 255, 1},
-        {43, 132, 38, 255, 1},
-        {38, 127, 33, 255, 1},
-        {44, 133, 39, 255, 1},
-        {50, 139, 45, 255, 1},
-        {31, 120, 26, 255, 1},
-        {18, 107, 13, 255, 1},
-        {16, 105, 11, 255, 1},
-        {12, 101, 7, 255, 1},
-        {23, 112, 18, 255, 1},
-        {30, 119, 25, 255, 1},
-        {34, 123, 30, 255, 1},
-        {38, 127, 33, 255, 1},
-        {44, 133, 39, 255, 1},
-        {53, 149, 48, 255, 1},
-        {34, 122, 31, 148, 1},
-        {35, 131, 32, 255, 1},
-        {50, 139, 47, 255, 1},
-        {59, 148, 56, 255, 1},
-        {37, 126, 34, 255, 1},
-        {26, 115, 23, 255, 1},
-        {43, 132, 40, 255, 1},
-        {50, 139, 48, 255, 1},
-        {42, 131, 38, 255, 1},
-        {38, 127, 33, 255, 1},
-        {36, 125, 31, 255, 1},
-        {35, 124, 30, 255, 1},
-        {46, 135, 41, 255, 1},
-        {53, 142, 48, 255, 1},
-        {39, 128, 34, 255, 1},
-        {31, 120, 26, 255, 1},
-        {40, 129, 35, 255, 1},
-        {45, 134, 40, 255, 1},
-        {34, 123, 29, 255, 1},
-        {27, 116, 22, 255, 1},
-        {36, 125, 30, 255, 1},
-        {40, 129, 35, 255, 1},
-        {36, 125, 31, 255, 1},
-        {34, 123, 29, 255, 1},
-        {41, 130, 36, 255, 1},
-        {45, 134, 40, 255, 1},
-        {53, 142, 48, 255, 1},
-        {61, 150, 56, 255, 1},
-        {39, 128, 34, 255, 1},
-        {28, 117, 23, 255, 1},
-        {26, 115, 21, 255, 1},
-        {22, 111, 17, 255, 1},
-        {39, 128, 34, 255, 1},
-        {51, 140, 46, 255, 1},
-        {45, 134, 40, 255, 1},
-        {42, 131, 37, 255, 3},
-        {46, 135, 41, 255, 1},
-        {48, 137, 43, 255, 1},
-        {43, 132, 38, 255, 1},
-        {39, 128, 34, 255, 1},
-        {45, 134, 40, 255, 1},
-        {48, 137, 43, 255, 1},
-        {49, 138, 44, 255, 1},
-        {52, 141, 47, 255, 1},
-        {45, 134, 40, 255, 1},
-        {41, 130, 36, 255, 1},
-        {46, 135, 41, 255, 1},
-        {53, 142, 48, 255, 1},
-        {31, 120, 26, 255, 1},
-        {14, 103, 9, 255, 1},
-        {29, 118, 24, 255, 1},
-        {39, 128, 34, 255, 1},
-        {34, 123, 29, 255, 1},
-        {33, 122, 28, 255, 1},
-        {34, 123, 29, 255, 2},
-        {40, 129, 35, 255, 1},
-        {45, 134, 39, 255, 1},
-        {42, 131, 37, 255, 1},
-        {41, 130, 36, 255, 1},
-        {40, 129, 35, 255, 1},
-        {41, 137, 36, 255, 1},
-        {34, 122, 31, 148, 1},
-        {34, 131, 31, 255, 1},
-        {56, 145, 52, 255, 1},
-        {69, 158, 66, 255, 1},
-        {36, 125, 33, 255, 1},
-        {20, 109, 17, 255, 1},
-        {42, 131, 39, 255, 1},
-        {51, 140, 49, 255, 1},
-        {44, 133, 40, 255, 1},
-        {42, 131, 37, 255, 1},
-        {37, 126, 32, 255, 1},
-        {36, 125, 31, 255, 1},
-        {51, 140, 46, 255, 1},
-        {61, 150, 56, 255, 1},
-        {38, 127, 33, 255, 1},
-        {25, 114, 20, 255, 1},
-        {42, 131, 37, 255, 1},
-        {51, 140, 46, 255, 1},
-        {32, 121, 27, 255, 1},
-        {21, 110, 16, 255, 1},
-        {36, 125, 31, 255, 1},
-        {42, 131, 37, 255, 1},
-        {41, 130, 36, 255, 2},
-        {38, 127, 33, 255, 1},
-        {34, 123, 29, 255, 1},
-        {55, 144, 50, 255, 1},
-        {70, 159, 65, 255, 1},
-        {40, 129, 35, 255, 1},
-        {26, 115, 21, 255, 1},
-        {20, 109, 15, 255, 1},
-        {11, 100, 6, 255, 1},
-        {35, 124, 30, 255, 1},
-        {50, 139, 45, 255, 1},
-        {45, 134, 40, 255, 1},
-        {44, 133, 39, 255, 1},
-        {45, 134, 40, 255, 2},
-        {48, 137, 43, 255, 1},
-        {50, 139, 45, 255, 1},
-        {43, 132, 38, 255, 1},
-        {40, 129, 35, 255, 1},
-        {49, 138, 44, 255, 1},
-        {55, 144, 50, 255, 1},
-        {57, 146, 52, 255, 1},
-        {62, 151, 57, 255, 1},
-        {47, 136, 42, 255, 1},
-        {36, 125, 31, 255, 1},
-        {46, 135, 41, 255, 1},
-        {56, 145, 51, 255, 1},
-        {24, 113, 19, 255, 1},
-        {1, 90, 0, 255, 1},
-        {21, 110, 16, 255, 1},
-        {34, 123, 29, 255, 1},
-        {37, 126, 32, 255, 1},
-        {41, 130, 36, 255, 1},
-        {43, 132, 38, 255, 1},
-        {44, 133, 39, 255, 1},
-        {48, 137, 43, 255, 1},
-        {52, 141, 47, 255, 1},
-        {45, 134, 40, 255, 1},
-        {41, 130, 36, 255, 1},
-        {37, 126, 32, 255, 1},
-        {36, 132, 31, 255, 1},
-        {39, 129, 34, 148, 1},
-        {42, 139, 37, 255, 1},
-        {46, 135, 41, 255, 1},
-        {51, 140, 47, 255, 1},
-        {33, 122, 30, 255, 1},
-        {24, 113, 21, 255, 1},
-        {36, 125, 33, 255, 1},
-        {40, 129, 37, 255, 1},
-        {48, 137, 44, 255, 1},
-        {54, 143, 48, 255, 1},
-        {34, 123, 29, 255, 1},
-        {24, 113, 19, 255, 1},
-        {43, 132, 38, 255, 1},
-        {51, 140, 46, 255, 1},
-        {44, 133, 39, 255, 1},
-        {40, 129, 35, 255, 1},
-        {53, 143, 48, 255, 1},
-        {63, 153, 58, 255, 1},
-        {23, 112, 21, 255, 1},
-        {5, 88, 5, 255, 1},
-        {44, 133, 41, 255, 1},
-        {68, 158, 63, 255, 1},
-        {38, 127, 33, 255, 1},
-        {25, 114, 20, 255, 1},
-        {32, 121, 27, 255, 1},
-        {35, 124, 30, 255, 1},
-        {44, 133, 39, 255, 1},
-        {50, 139, 45, 255, 1},
-        {39, 128, 34, 255, 1},
-        {32, 121, 27, 255, 1},
-        {40, 129, 35, 255, 1},
-        {45, 134, 40, 255, 1},
-        {38, 127, 33, 255, 1},
-        {33, 122, 28, 255, 1},
-        {44, 133, 39, 255, 1},
-        {51, 140, 46, 255, 1},
-        {42, 131, 37, 255, 1},
-        {36, 125, 31, 255, 1},
-        {40, 129, 35, 255, 1},
-        {43, 132, 38, 255, 1},
-        {44, 133, 39, 255, 1},
-        {46, 135, 41, 255, 1},
-        {44, 133, 39, 255, 2},
-        {43, 132, 38, 255, 1},
-        {44, 133, 39, 255, 1},
-        {35, 124, 30, 255, 1},
-        {28, 117, 23, 255, 1},
-        {32, 121, 27, 255, 1},
-        {34, 123, 29, 255, 1},
-        {33, 122, 28, 255, 1},
-        {33, 122, 29, 255, 1},
-        {33, 122, 28, 255, 1},
-        {34, 123, 29, 255, 1},
-        {23, 112, 18, 255, 1},
-        {13, 102, 9, 255, 1},
-        {31, 120, 26, 255, 1},
-        {43, 132, 38, 255, 1},
-        {44, 133, 39, 255, 1},
-        {45, 134, 40, 255, 1},
-        {51, 140, 46, 255, 1},
-        {56, 145, 51, 255, 1},
-        {42, 131, 37, 255, 1},
-        {33, 129, 28, 255, 1},
-        {43, 132, 37, 148, 1},
-        {47, 143, 42, 255, 1},
-        {42, 131, 37, 255, 1},
-        {43, 132, 40, 255, 1},
-        {31, 120, 28, 255, 1},
-        {25, 114, 22, 255, 1},
-        {33, 122, 30, 255, 1},
-        {34, 123, 31, 255, 1},
-        {51, 140, 47, 255, 1},
-        {61, 150, 56, 255, 1},
-        {34, 123, 29, 255, 1},
-        {19, 108, 14, 255, 1},
-        {40, 129, 35, 255, 1},
-        {49, 138, 44, 255, 1},
-        {47, 136, 42, 255, 1},
-        {46, 135, 41, 255, 1},
-        {60, 150, 55, 255, 1},
-        {72, 161, 66, 255, 1},
-        {19, 107, 18, 255, 1},
-        {0, 75, 0, 255, 1},
-        {48, 137, 45, 255, 1},
-        {82, 172, 76, 255, 1},
-        {37, 126, 32, 255, 1},
-        {17, 106, 12, 255, 1},
-        {30, 119, 25, 255, 1},
-        {34, 123, 29, 255, 1},
-        {40, 129, 35, 255, 1},
-        {44, 133, 39, 255, 1},
-        {38, 127, 33, 255, 1},
-        {34, 123, 29, 255, 1},
-        {49, 138, 44, 255, 1},
-        {60, 149, 55, 255, 1},
-        {39, 128, 34, 255, 1},
-        {25, 114, 20, 255, 1},
-        {45, 134, 40, 255, 1},
-        {57, 146, 52, 255, 1},
-        {41, 130, 36, 255, 1},
-        {31, 120, 26, 255, 1},
-        {38, 127, 33, 255, 1},
-        {41, 130, 36, 255, 1},
-        {45, 134, 40, 255, 1},
-        {49, 138, 44, 255, 1},
-        {42, 131, 38, 255, 1},
-        {39, 128, 34, 255, 1},
-        {38, 127, 33, 255, 1},
-        {39, 128, 33, 255, 1},
-        {30, 119, 25, 255, 1},
-        {25, 114, 20, 255, 2},
-        {24, 113, 19, 255, 1},
-        {38, 127, 33, 255, 1},
-        {47, 136, 42, 255, 1},
-        {38, 127, 33, 255, 1},
-        {34, 123, 29, 255, 1},
-        {15, 104, 10, 255, 1},
-        {0, 88, 0, 255, 1},
-        {26, 115, 21, 255, 1},
-        {43, 132, 38, 255, 1},
-        {42, 131, 37, 255, 1},
-        {43, 132, 38, 255, 1},
-        {54, 143, 49, 255, 1},
-        {65, 154, 60, 255, 1},
-        {44, 133, 39, 255, 1},
-        {31, 127, 25, 255, 1},
-        {32, 120, 27, 148, 1},
-        {35, 131, 29, 255, 1},
-        {35, 124, 30, 255, 1},
-        {35, 124, 31, 255, 1},
-        {33, 122, 29, 255, 1},
-        {31, 120, 27, 255, 1},
-        {37, 126, 33, 255, 1},
-        {40, 129, 36, 255, 1},
-        {38, 127, 33, 255, 1},
-        {37, 126, 32, 255, 1},
-        {32, 121, 27, 255, 1},
-        {30, 119, 25, 255, 1},
-        {37, 126, 32, 255, 1},
-        {39, 128, 34, 255, 1},
-        {43, 132, 38, 255, 1},
-        {46, 135, 41, 255, 1},
-        {42, 131, 36, 255, 1},
-        {39, 129, 34, 255, 1},
-        {36, 125, 32, 255, 1},
-        {34, 122, 32, 255, 1},
-        {45, 134, 40, 255, 1},
-        {52, 141, 47, 255, 1},
-        {37, 126, 33, 255, 1},
-        {30, 119, 26, 255, 1},
-        {29, 118, 24, 255, 1},
-        {28, 117, 23, 255, 1},
-        {33, 122, 28, 255, 1},
-        {35, 124, 30, 255, 1},
-        {45, 134, 40, 255, 1},
-        {51, 140, 46, 255, 1},
-        {42, 131, 38, 255, 1},
-        {38, 127, 34, 255, 1},
-        {30, 119, 25, 255, 1},
-        {23, 112, 18, 255, 1},
-        {25, 114, 20, 255, 2},
-        {33, 122, 28, 255, 1},
-        {38, 127, 33, 255, 1},
-        {39, 128, 34, 255, 2},
-        {45, 134, 40, 255, 1},
-        {50, 139, 45, 255, 1},
-        {45, 134, 39, 255, 1},
-        {42, 131, 37, 255, 1},
-        {34, 123, 30, 255, 1},
-        {28, 117, 24, 255, 1},
-        {34, 123, 30, 255, 1},
-        {39, 128, 34, 255, 1},
-        {40, 129, 35, 255, 1},
-        {43, 132, 38, 255, 1},
-        {38, 127, 33, 255, 1},
-        {34, 123, 29, 255, 1},
-        {41, 130, 36, 255, 1},
-        {48, 137, 43, 255, 1},
-        {40, 129, 35, 255, 1},
-        {35, 124, 30, 255, 1},
-        {46, 135, 41, 255, 1},
-        {55, 144, 50, 255, 1},
-        {49, 138, 44, 255, 1},
-        {46, 135, 41, 255, 1},
-        {37, 126, 32, 255, 1},
-        {29, 118, 24, 255, 1},
-        {32, 121, 27, 255, 1},
-        {37, 133, 32, 255, 1},
-        {25, 115, 20, 148, 1},
-        {28, 125, 23, 255, 1},
-        {30, 119, 25, 255, 1},
-        {32, 121, 26, 255, 1},
-        {34, 123, 29, 255, 1},
-        {35, 124, 30, 255, 1},
-        {40, 129, 35, 255, 1},
-        {43, 132, 38, 255, 1},
-        {31, 120, 26, 255, 1},
-        {24, 113, 19, 255, 1},
-        {31, 120, 26, 255, 1},
-        {34, 123, 29, 255, 1},
-        {35, 124, 30, 255, 1},
-        {33, 122, 28, 255, 1},
-        {41, 130, 36, 255, 1},
-        {47, 136, 42, 255, 1},
-        {33, 122, 28, 255, 1},
-        {23, 112, 18, 255, 1},
-        {43, 132, 37, 255, 1},
-        {53, 142, 47, 255, 1},
-        {44, 133, 39, 255, 1},
-        {40, 129, 35, 255, 1},
-        {37, 126, 33, 255, 1},
-        {35, 124, 32, 255, 1},
-        {29, 118, 25, 255, 1},
-        {25, 114, 20, 255, 1},
-        {29, 118, 24, 255, 2},
-        {48, 137, 43, 255, 1},
-        {61, 150, 56, 255, 1},
-        {39, 128, 35, 255, 1},
-        {27, 116, 24, 255, 1},
-        {25, 114, 21, 255, 1},
-        {22, 111, 17, 255, 1},
-        {14, 103, 9, 255, 1},
-        {8, 97, 3, 255, 1},
-        {30, 119, 25, 255, 1},
-        {44, 133, 39, 255, 1},
-        {40, 129, 35, 255, 1},
-        {38, 127, 33, 255, 1},
-        {45, 134, 40, 255, 1},
-        {51, 140, 46, 255, 1},
-        {46, 135, 40, 255, 1},
-        {44, 133, 39, 255, 1},
-        {31, 120, 28, 255, 1},
-        {20, 109, 18, 255, 1},
-        {36, 125, 32, 255, 1},
-        {45, 134, 40, 255, 1},
-        {46, 135, 41, 255, 1},
-        {51, 140, 46, 255, 1},
-        {38, 127, 33, 255, 1},
-        {29, 118, 24, 255, 1},
-        {45, 134, 40, 255, 1},
-        {56, 145, 51, 255, 1},
-        {53, 142, 48, 255, 1},
-        {51, 140, 46, 255, 1},
-        {56, 145, 51, 255, 1},
-        {62, 151, 57, 255, 1},
-        {52, 141, 47, 255, 1},
-        {46, 135, 41, 255, 1},
-        {28, 117, 23, 255, 1},
-        {11, 100, 6, 255, 1},
-        {27, 116, 22, 255, 1},
-        {40, 136, 35, 255, 1},
-        {36, 124, 31, 148, 1},
-        {38, 134, 33, 255, 1},
-        {31, 120, 26, 255, 1},
-        {30, 119, 25, 255, 1},
-        {31, 120, 26, 255, 2},
-        {34, 123, 29, 255, 1},
-        {35, 124, 30, 255, 1},
-        {44, 133, 39, 255, 1},
-        {49, 138, 44, 255, 1},
-        {41, 130, 36, 255, 1},
-        {37, 126, 32, 255, 1},
-        {33, 122, 28, 255, 1},
-        {30, 119, 25, 255, 1},
-        {40, 129, 35, 255, 1},
-        {44, 133, 39, 255, 1},
-        {42, 131, 37, 255, 1},
-        {40, 129, 35, 255, 1},
-        {52, 141, 47, 255, 1},
-        {60, 149, 55, 255, 1},
-        {40, 129, 35, 255, 1},
-        {27, 116, 23, 255, 1},
-        {40, 129, 37, 255, 1},
-        {46, 135, 44, 255, 1},
-        {31, 120, 28, 255, 1},
-        {22, 111, 17, 255, 1},
-        {40, 129, 35, 255, 1},
-        {50, 139, 45, 255, 1},
-        {41, 130, 36, 255, 1},
-        {35, 124, 31, 255, 1},
-        {44, 133, 40, 255, 1},
-        {50, 139, 47, 255, 1},
-        {31, 120, 27, 255, 1},
-        {18, 107, 13, 255, 1},
-        {29, 118, 24, 255, 1},
-        {35, 124, 30, 255, 1},
-        {23, 112, 18, 255, 1},
-        {15, 104, 11, 255, 1},
-        {33, 122, 28, 255, 1},
-        {43, 132, 38, 255, 1},
-        {42, 131, 37, 255, 1},
-        {43, 132, 38, 255, 1},
-        {40, 129, 34, 255, 1},
-        {36, 125, 32, 255, 1},
-        {42, 131, 39, 255, 1},
-        {46, 135, 43, 255, 1},
-        {46, 135, 41, 255, 1},
-        {45, 134, 40, 255, 1},
-        {49, 138, 44, 255, 1},
-        {52, 141, 47, 255, 1},
-        {36, 125, 31, 255, 1},
-        {24, 113, 19, 255, 1},
-        {29, 118, 24, 255, 1},
-        {30, 119, 25, 255, 1},
-        {40, 129, 35, 255, 1},
-        {47, 136, 42, 255, 3},
-        {51, 140, 46, 255, 1},
-        {55, 144, 50, 255, 1},
-        {42, 131, 37, 255, 1},
-        {33, 122, 28, 255, 1},
-        {31, 120, 26, 255, 1},
-        {31, 127, 25, 255, 1},
-        {39, 129, 34, 148, 1},
-        {43, 139, 37, 255, 1},
-        {31, 120, 26, 255, 1},
-        {27, 116, 22, 255, 1},
-        {28, 117, 23, 255, 2},
-        {32, 121, 27, 255, 1},
-        {31, 120, 26, 255, 1},
-        {51, 140, 46, 255, 1},
-        {62, 151, 57, 255, 1},
-        {46, 135, 41, 255, 1},
-        {39, 128, 34, 255, 1},
-        {33, 122, 28, 255, 1},
-        {29, 118, 24, 255, 1},
-        {39, 128, 34, 255, 1},
-        {43, 132, 38, 255, 1},
-        {47, 136, 42, 255, 1},
-        {49, 138, 44, 255, 1},
-        {59, 148, 54, 255, 1},
-        {67, 156, 62, 255, 1},
-        {37, 126, 32, 255, 1},
-        {19, 108, 14, 255, 1},
-        {42, 131, 37, 255, 1},
-        {53, 142, 49, 255, 1},
-        {33, 122, 28, 255, 1},
-        {20, 109, 15, 255, 1},
-        {45, 134, 40, 255, 1},
-        {61, 150, 56, 255, 1},
-        {37, 126, 32, 255, 1},
-        {22, 111, 17, 255, 1},
-        {47, 136, 42, 255, 1},
-        {63, 152, 58, 255, 1},
-        {33, 122, 28, 255, 1},
-        {14, 103, 9, 255, 1},
-        {34, 123, 29, 255, 1},
-        {46, 135, 41, 255, 1},
-        {18, 107, 13, 255, 1},
-        {0, 87, 0, 255, 1},
-        {29, 118, 24, 255, 1},
-        {45, 134, 40, 255, 1},
-        {41, 130, 36, 255, 1},
-        {41, 130, 37, 255, 1},
-        {37, 126, 34, 255, 1},
-        {32, 121, 29, 255, 1},
-        {48, 137, 45, 255, 1},
-        {59, 148, 56, 255, 1},
-        {52, 141, 47, 255, 1},
-        {47, 136, 42, 255, 1},
-        {50, 139, 45, 255, 1},
-        {54, 143, 49, 255, 1},
-        {34, 123, 29, 255, 1},
-        {20, 109, 15, 255, 2},
-        {17, 106, 12, 255, 1},
-        {34, 123, 29, 255, 1},
-        {45, 134, 40, 255, 1},
-        {42, 131, 37, 255, 1},
-        {40, 129, 35, 255, 1},
-        {51, 140, 46, 255, 1},
-        {60, 149, 55, 255, 1},
-        {49, 138, 44, 255, 1},
-        {43, 132, 38, 255, 1},
-        {32, 121, 27, 255, 1},
-        {24, 121, 19, 255, 1},
-        {37, 125, 32, 148, 1},
-        {39, 135, 34, 255, 1},
-        {40, 129, 35, 255, 1},
-        {42, 131, 37, 255, 1},
-        {43, 132, 38, 255, 1},
-        {45, 134, 40, 255, 1},
-        {35, 124, 30, 255, 1},
-        {29, 118, 24, 255, 1},
-        {39, 128, 34, 255, 1},
-        {43, 132, 38, 255, 1},
-        {36, 125, 31, 255, 1},
-        {33, 122, 28, 255, 1},
-        {25, 114, 20, 255, 1},
-        {19, 108, 14, 255, 1},
-        {39, 128, 34, 255, 1},
-        {49, 138, 44, 255, 1},
-        {36, 125, 31, 255, 1},
-        {30, 119, 25, 255, 1},
-        {38, 127, 33, 255, 1},
-        {41, 130, 36, 255, 2},
-        {42, 131, 37, 255, 1},
-        {41, 130, 36, 255, 2},
-        {33, 122, 28, 255, 1},
-        {29, 118, 24, 255, 1},
-        {33, 122, 28, 255, 1},
-        {35, 124, 30, 255, 2},
-        {37, 126, 32, 255, 1},
-        {30, 119, 25, 255, 1},
-        {25, 114, 20, 255, 1},
-        {35, 124, 30, 255, 1},
-        {41, 130, 36, 255, 1},
-        {48, 137, 43, 255, 1},
-        {54, 143, 49, 255, 1},
-        {41, 130, 36, 255, 1},
-        {33, 122, 28, 255, 1},
-        {41, 130, 36, 255, 1},
-        {45, 134, 40, 255, 1},
-        {34, 123, 29, 255, 1},
-        {26, 115, 23, 255, 1},
-        {33, 122, 30, 255, 1},
-        {35, 124, 32, 255, 1},
-        {43, 132, 40, 255, 1},
-        {49, 138, 46, 255, 1},
-        {40, 129, 36, 255, 1},
-        {35, 124, 30, 255, 1},
-        {41, 130, 36, 255, 1},
-        {45, 134, 40, 255, 1},
-        {43, 132, 38, 255, 1},
-        {42, 131, 37, 255, 1},
-        {40, 129, 35, 255, 1},
-        {37, 126, 32, 255, 1},
-        {46, 135, 41, 255, 1},
-        {55, 144, 50, 255, 1},
-        {44, 133, 39, 255, 1},
-        {34, 123, 29, 255, 1},
-        {50, 139, 45, 255, 1},
-        {65, 154, 60, 255, 1},
-        {50, 139, 45, 255, 1},
-        {42, 131, 37, 255, 1},
-        {35, 124, 30, 255, 1},
-        {30, 126, 25, 255, 1},
-        {37, 127, 32, 148, 1},
-        {39, 136, 34, 255, 1},
-        {46, 135, 41, 255, 1},
-        {50, 139, 45, 255, 1},
-        {51, 140, 46, 255, 1},
-        {54, 143, 49, 255, 1},
-        {37, 126, 32, 255, 1},
-        {28, 117, 23, 255, 1},
-        {33, 122, 28, 255, 1},
-        {35, 124, 30, 255, 1},
-        {31, 120, 26, 255, 1},
-        {30, 119, 25, 255, 1},
-        {21, 110, 16, 255, 1},
-        {14, 103, 9, 255, 1},
-        {38, 127, 33, 255, 1},
-        {52, 141, 47, 255, 1},
-        {32, 121, 27, 255, 1},
-        {21, 110, 16, 255, 1},
-        {27, 116, 22, 255, 2},
-        {43, 132, 38, 255, 1},
-        {54, 143, 49, 255, 1},
-        {41, 130, 36, 255, 1},
-        {36, 125, 31, 255, 1},
-        {33, 122, 28, 255, 1},
-        {32, 121, 27, 255, 1},
-        {27, 116, 22, 255, 1},
-        {23, 112, 18, 255, 1},
-        {35, 124, 30, 255, 1},
-        {43, 132, 38, 255, 1},
-        {22, 111, 17, 255, 1},
-        {8, 97, 3, 255, 1},
-        {38, 127, 33, 255, 1},
-        {56, 145, 51, 255, 1},
-        {57, 146, 52, 255, 1},
-        {59, 148, 54, 255, 1},
-        {53, 142, 48, 255, 1},
-        {48, 137, 43, 255, 1},
-        {47, 136, 42, 255, 2},
-        {30, 119, 25, 255, 1},
-        {17, 106, 14, 255, 1},
-        {30, 119, 27, 255, 1},
-        {37, 126, 33, 255, 1},
-        {41, 130, 38, 255, 1},
-        {46, 135, 43, 255, 1},
-        {35, 124, 31, 255, 1},
-        {28, 117, 23, 255, 1},
-        {36, 125, 31, 255, 1},
-        {41, 130, 36, 255, 1},
-        {47, 136, 42, 255, 1},
-        {52, 141, 47, 255, 1},
-        {49, 138, 44, 255, 1},
-        {46, 135, 41, 255, 1},
-        {53, 142, 48, 255, 1},
-        {60, 149, 55, 255, 1},
-        {44, 133, 39, 255, 1},
-        {30, 119, 25, 255, 1},
-        {51, 140, 46, 255, 1},
-        {68, 157, 63, 255, 1},
-        {52, 141, 47, 255, 1},
-        {43, 132, 38, 255, 1},
-        {36, 125, 31, 255, 1},
-        {33, 128, 27, 255, 1},
-        {18, 108, 13, 148, 1},
-        {19, 115, 14, 255, 1},
-        {35, 124, 30, 255, 1},
-        {42, 131, 37, 255, 1},
-        {39, 128, 34, 255, 1},
-        {38, 127, 33, 255, 1},
-        {29, 118, 24, 255, 1},
-        {23, 112, 18, 255, 1},
-        {39, 128, 34, 255, 1},
-        {47, 136, 42, 255, 1},
-        {38, 127, 33, 255, 1},
-        {34, 123, 29, 255, 1},
-        {24, 113, 19, 255, 1},
-        {17, 106, 12, 255, 1},
-        {38, 127, 33, 255, 1},
-        {48, 137, 43, 255, 1},
-        {33, 122, 28, 255, 1},
-        {25, 114, 20, 255, 1},
-        {39, 128, 34, 255, 1},
-        {46, 135, 41, 255, 1},
-        {44, 133, 39, 255, 2},
-        {35, 124, 30, 255, 1},
-        {30, 119, 25, 255, 1},
-        {33, 122, 28, 255, 1},
-        {34, 123, 29, 255, 1},
-        {38, 127, 33, 255, 1},
-        {41, 130, 36, 255, 1},
-        {40, 129, 35, 255, 2},
-        {31, 120, 26, 255, 1},
-        {23, 112, 18, 255, 1},
-        {33, 122, 28, 255, 1},
-        {39, 128, 34, 255, 1},
-        {37, 126, 32, 255, 2},
-        {38, 127, 33, 255, 1},
-        {39, 128, 34, 255, 1},
-        {35, 124, 30, 255, 1},
-        {32, 121, 26, 255, 1},
-        {36, 125, 32, 255, 1},
-        {40, 129, 37, 255, 1},
-        {36, 125, 33, 255, 1},
-        {33, 122, 29, 255, 1},
-        {36, 125, 30, 255, 1},
-        {36, 125, 31, 255, 1},
-        {38, 127, 33, 255, 1},
-        {40, 129, 35, 255, 1},
-        {37, 126, 32, 255, 1},
-        {34, 123, 29, 255, 1},
-        {41, 130, 36, 255, 1},
-        {45, 134, 40, 255, 1},
-        {41, 130, 36, 255, 1},
-        {39, 128, 34, 255, 1},
-        {41, 130, 36, 255, 1},
-        {42, 131, 37, 255, 1},
-        {38, 127, 33, 255, 1},
-        {34, 123, 29, 255, 1},
-        {43, 132, 38, 255, 1},
-        {50, 139, 45, 255, 1},
-        {42, 131, 37, 255, 1},
-        {37, 126, 32, 255, 1},
-        {34, 123, 29, 255, 1},
-        {34, 130, 28, 255, 1},
-        {6, 96, 1, 148, 1},
-        {7, 103, 1, 255, 1},
-        {29, 118, 24, 255, 1},
-        {39, 128, 34, 255, 1},
-        {32, 121, 27, 255, 1},
-        {30, 119, 25, 255, 1},
-        {23, 112, 18, 255, 1},
-        {18, 107, 13, 255, 1},
-        {41, 130, 36, 255, 1},
-        {52, 141, 47, 255, 1},
-        {39, 128, 34, 255, 1},
-        {34, 123, 29, 255, 1},
-        {24, 113, 19, 255, 1},
-        {17, 106, 12, 255, 1},
-        {36, 125, 31, 255, 1},
-        {46, 135, 41, 255, 1},
-        {33, 122, 28, 255, 1},
-        {26, 115, 21, 255, 1},
-        {45, 134, 40, 255, 1},
-        {55, 144, 50, 255, 1},
-        {44, 133, 39, 255, 1},
-        {40, 129, 35, 255, 1},
-        {31, 120, 26, 255, 1},
-        {25, 114, 20, 255, 1},
-        {33, 122, 28, 255, 1},
-        {37, 126, 32, 255, 1},
-        {44, 133, 39, 255, 1},
-        {50, 139, 45, 255, 1},
-        {42, 131, 37, 255, 1},
-        {39, 128, 34, 255, 1},
-        {34, 123, 28, 255, 1},
-        {30, 119, 25, 255, 2},
-        {31, 120, 25, 255, 1},
-        {28, 117, 23, 255, 1},
-        {26, 115, 21, 255, 1},
-        {32, 121, 27, 255, 1},
-        {36, 125, 31, 255, 1},
-        {28, 117, 23, 255, 1},
-        {21, 110, 16, 255, 1},
-        {40, 129, 35, 255, 1},
-        {53, 142, 50, 255, 1},
-        {39, 128, 36, 255, 1},
-        {31, 120, 27, 255, 1},
-        {32, 121, 27, 255, 1},
-        {30, 119, 25, 255, 1},
-        {40, 129, 35, 255, 1},
-        {47, 136, 42, 255, 1},
-        {37, 126, 32, 255, 1},
-        {31, 120, 26, 255, 1},
-        {38, 127, 33, 255, 1},
-        {42, 131, 37, 255, 1},
-        {38, 127, 33, 255, 1},
-        {36, 125, 31, 255, 1},
-        {34, 123, 29, 255, 1},
-        {32, 121, 27, 255, 1},
-        {35, 124, 30, 255, 1},
-        {36, 125, 31, 255, 1},
-        {38, 127, 33, 255, 1},
-        {41, 130, 36, 255, 1},
-        {37, 126, 32, 255, 1},
-        {35, 124, 30, 255, 1},
-        {33, 122, 28, 255, 1},
-        {33, 129, 28, 255, 1},
-        {25, 115, 20, 148, 1},
-        {28, 124, 22, 255, 1},
-        {33, 122, 28, 255, 1},
-        {35, 124, 30, 255, 1},
-        {41, 130, 36, 255, 1},
-        {45, 134, 40, 255, 1},
-        {43, 132, 38, 255, 1},
-        {41, 130, 36, 255, 1},
-        {53, 142, 48, 255, 1},
-        {59, 148, 54, 255, 1},
-        {51, 140, 46, 255, 1},
-        {47, 136, 42, 255, 2},
-        {46, 135, 41, 255, 1},
-        {47, 136, 42, 255, 1},
-        {48, 137, 43, 255, 1},
-        {36, 125, 31, 255, 1},
-        {28, 117, 23, 255, 1},
-        {41, 130, 36, 255, 1},
-        {49, 138, 44, 255, 1},
-        {44, 133, 39, 255, 2},
-        {37, 126, 32, 255, 1},
-        {34, 123, 29, 255, 1},
-        {25, 114, 20, 255, 1},
-        {19, 108, 14, 255, 1},
-        {29, 118, 24, 255, 1},
-        {33, 122, 28, 255, 1},
-        {36, 125, 31, 255, 1},
-        {37, 126, 32, 255, 1},
-        {38, 127, 34, 255, 1},
-        {40, 129, 36, 255, 1},
-        {36, 125, 31, 255, 1},
-        {34, 123, 30, 255, 1},
-        {28, 117, 24, 255, 1},
-        {23, 112, 19, 255, 1},
-        {28, 117, 23, 255, 1},
-        {30, 119, 25, 255, 1},
-        {38, 127, 33, 255, 1},
-        {43, 132, 38, 255, 1},
-        {39, 128, 34, 255, 1},
-        {39, 128, 35, 255, 1},
-        {29, 118, 25, 255, 1},
-        {21, 110, 17, 255, 1},
-        {33, 122, 29, 255, 1},
-        {41, 130, 36, 255, 1},
-        {34, 123, 29, 255, 1},
-        {31, 120, 26, 255, 1},
-        {25, 114, 20, 255, 1},
-        {21, 110, 16, 255, 1},
-        {30, 119, 25, 255, 1},
-        {36, 125, 31, 255, 1},
-        {37, 126, 32, 255, 1},
-        {39, 128, 34, 255, 1},
-        {41, 130, 36, 255, 1},
-        {42, 131, 37, 255, 1},
-        {44, 133, 39, 255, 1},
-        {46, 135, 41, 255, 1},
-        {39, 128, 34, 255, 1},
-        {35, 124, 30, 255, 1},
-        {32, 121, 27, 255, 1},
-        {29, 118, 24, 255, 1},
-        {33, 122, 28, 255, 1},
-        {40, 136, 35, 255, 1},
-        {36, 125, 31, 148, 1},
-        {39, 135, 33, 255, 1},
-        {34, 123, 29, 255, 1},
-        {32, 121, 27, 255, 1},
-        {46, 135, 41, 255, 1},
-        {53, 142, 48, 255, 1},
-        {54, 143, 49, 255, 1},
-        {56, 145, 51, 255, 1},
-        {61, 150, 56, 255, 1},
-        {64, 153, 59, 255, 1},
-        {59, 148, 54, 255, 1},
-        {55, 144, 50, 255, 1},
-        {60, 149, 55, 255, 1},
-        {63, 152, 58, 255, 1},
-        {54, 143, 49, 255, 1},
-        {51, 140, 46, 255, 1},
-        {37, 126, 32, 255, 1},
-        {27, 116, 22, 255, 1},
-        {40, 129, 35, 255, 1},
-        {47, 136, 42, 255, 1},
-        {46, 135, 41, 255, 1},
-        {48, 137, 43, 255, 1},
-        {41, 130, 36, 255, 1},
-        {40, 129, 35, 255, 1},
-        {19, 108, 14, 255, 1},
-        {7, 96, 2, 255, 1},
-        {19, 108, 14, 255, 1},
-        {23, 112, 18, 255, 1},
-        {32, 121, 27, 255, 1},
-        {36, 125, 31, 255, 1},
-        {42, 131, 39, 255, 1},
-        {47, 136, 44, 255, 1},
-        {39, 128, 36, 255, 1},
-        {35, 124, 33, 255, 1},
-        {26, 115, 23, 255, 1},
-        {19, 108, 16, 255, 1},
-        {25, 114, 19, 255, 1},
-        {25, 114, 20, 255, 1},
-        {43, 132, 38, 255, 1},
-        {56, 145, 51, 255, 1},
-        {39, 128, 34, 255, 1},
-        {31, 120, 26, 255, 1},
-        {23, 112, 18, 255, 1},
-        {15, 104, 10, 255, 1},
-        {33, 122, 28, 255, 1},
-        {45, 134, 40, 255, 1},
-        {29, 118, 24, 255, 1},
-        {20, 109, 15, 255, 1},
-        {17, 106, 12, 255, 1},
-        {14, 103, 9, 255, 1},
-        {25, 114, 20, 255, 1},
-        {32, 121, 27, 255, 1},
-        {37, 126, 32, 255, 1},
-        {41, 130, 36, 255, 1},
-        {45, 134, 40, 255, 1},
-        {49, 138, 44, 255, 1},
-        {50, 139, 45, 255, 1},
-        {52, 141, 47, 255, 1},
-        {39, 128, 34, 255, 1},
-        {29, 118, 24, 255, 1},
-        {28, 117, 23, 255, 1},
-        {25, 114, 20, 255, 1},
-        {33, 122, 28, 255, 1},
-        {43, 139, 38, 255, 1},
-        {36, 125, 31, 148, 1},
-        {38, 135, 33, 255, 1},
-        {41, 130, 36, 255, 1},
-        {44, 133, 39, 255, 1},
-        {46, 135, 41, 255, 1},
-        {48, 137, 43, 255, 1},
-        {34, 123, 29, 255, 1},
-        {28, 117, 23, 255, 1},
-        {39, 128, 34, 255, 1},
-        {43, 132, 38, 255, 1},
-        {50, 139, 45, 255, 1},
-        {55, 144, 50, 255, 1},
-        {46, 135, 41, 255, 1},
-        {43, 132, 38, 255, 1},
-        {37, 126, 32, 255, 1},
-        {33, 122, 28, 255, 1},
-        {43, 132, 38, 255, 1},
-        {49, 138, 44, 255, 1},
-        {35, 124, 30, 255, 1},
-        {29, 118, 24, 255, 1},
-        {31, 120, 26, 255, 2},
-        {29, 118, 24, 255, 1},
-        {28, 117, 23, 255, 1},
-        {35, 124, 30, 255, 1},
-        {37, 126, 32, 255, 1},
-        {42, 131, 37, 255, 1},
-        {46, 135, 41, 255, 1},
-        {38, 127, 33, 255, 1},
-        {34, 123, 28, 255, 1},
-        {35, 124, 32, 255, 2},
-        {33, 122, 30, 255, 1},
-        {32, 121, 29, 255, 1},
-        {34, 123, 32, 255, 1},
-        {36, 125, 32, 255, 1},
-        {35, 124, 30, 255, 2},
-        {34, 123, 29, 255, 1},
-        {31, 120, 26, 255, 1},
-        {38, 127, 33, 255, 1},
-        {43, 132, 38, 255, 1},
-        {35, 124, 30, 255, 1},
-        {28, 117, 23, 255, 1},
-        {47, 136, 42, 255, 1},
-        {60, 149, 55, 255, 1},
-        {50, 139, 45, 255, 1},
-        {45, 134, 40, 255, 1},
-        {43, 132, 38, 255, 1},
-        {41, 130, 36, 255, 1},
-        {38, 127, 32, 255, 1},
-        {35, 124, 30, 255, 1},
-        {32, 121, 26, 255, 1},
-        {29, 118, 24, 255, 1},
-        {26, 115, 21, 255, 1},
-        {22, 111, 17, 255, 1},
-        {35, 124, 30, 255, 1},
-        {45, 134, 40, 255, 1},
-        {44, 133, 39, 255, 1},
-        {46, 135, 41, 255, 1},
-        {31, 120, 26, 255, 1},
-        {19, 108, 14, 255, 1},
-        {34, 124, 29, 255, 1},
-        {48, 144, 43, 255, 1},
-        {36, 125, 31, 148, 1},
-        {38, 135, 33, 255, 1},
-        {47, 136, 42, 255, 1},
-        {52, 141, 47, 255, 1},
-        {47, 136, 42, 255, 1},
-        {46, 135, 41, 255, 1},
-        {24, 113, 19, 255, 1},
-        {12, 101, 7, 255, 1},
-        {27, 116, 22, 255, 1},
-        {32, 121, 27, 255, 1},
-        {48, 137, 43, 255, 1},
-        {57, 146, 52, 255, 1},
-        {39, 128, 34, 255, 1},
-        {33, 122, 28, 255, 1},
-        {27, 116, 22, 255, 1},
-        {21, 110, 16, 255, 1},
-        {47, 136, 42, 255, 1},
-        {63, 152, 58, 255, 1},
-        {32, 121, 27, 255, 1},
-        {18, 107, 13, 255, 1},
-        {22, 111, 17, 255, 2},
-        {23, 112, 18, 255, 1},
-        {21, 110, 16, 255, 1},
-        {41, 130, 37, 255, 1},
-        {51, 140, 48, 255, 1},
-        {54, 143, 50, 255, 1},
-        {57, 146, 53, 255, 1},
-        {40, 129, 36, 255, 1},
-        {31, 120, 27, 255, 1},
-        {31, 120, 28, 255, 1},
-        {29, 118, 27, 255, 1},
-        {31, 120, 27, 255, 1},
-        {30, 119, 26, 255, 1},
-        {39, 128, 35, 255, 1},
-        {45, 134, 40, 255, 1},
-        {41, 130, 36, 255, 1},
-        {40, 129, 35, 255, 1},
-        {28, 117, 23, 255, 1},
-        {19, 108, 14, 255, 1},
-        {37, 126, 32, 255, 1},
-        {48, 137, 43, 255, 1},
-        {41, 130, 36, 255, 1},
-        {36, 125, 31, 255, 1},
-        {57, 146, 52, 255, 1},
-        {70, 159, 65, 255, 1},
-        {63, 152, 58, 255, 1},
-        {61, 150, 56, 255, 1},
-        {57, 146, 52, 255, 1},
-        {55, 144, 51, 255, 1},
-        {44, 133, 40, 255, 1},
-        {37, 126, 34, 255, 1},
-        {28, 117, 24, 255, 1},
-        {21, 110, 18, 255, 1},
-        {14, 103, 10, 255, 1},
-        {6, 95, 1, 255, 1},
-        {28, 117, 23, 255, 1},
-        {43, 132, 38, 255, 1},
-        {46, 135, 41, 255, 1},
-        {53, 142, 48, 255, 1},
-        {31, 120, 26, 255, 1},
-        {14, 103, 9, 255, 1},
-        {34, 124, 29, 255, 1},
-        {52, 148, 47, 255, 1},
-        {46, 136, 41, 148, 1},
-        {51, 147, 45, 255, 1},
-        {35, 124, 30, 255, 1},
-        {29, 118, 24, 255, 1},
-        {38, 127, 33, 255, 1},
-        {41, 130, 36, 255, 1},
-        {37, 126, 32, 255, 1},
-        {36, 125, 31, 255, 1},
-        {31, 120, 26, 255, 1},
-        {29, 118, 24, 255, 1},
-        {38, 127, 33, 255, 1},
-        {41, 130, 36, 255, 1},
-        {46, 135, 41, 255, 1},
-        {49, 138, 44, 255, 1},
-        {47, 136, 42, 255, 2},
-        {34, 123, 29, 255, 1},
-        {26, 115, 21, 255, 1},
-        {33, 122, 28, 255, 1},
-        {36, 125, 31, 255, 1},
-        {38, 127, 33, 255, 1},
-        {39, 128, 34, 255, 1},
-        {38, 127, 33, 255, 1},
-        {37, 126, 32, 255, 1},
-        {47, 136, 43, 255, 1},
-        {52, 141, 50, 255, 1},
-        {51, 140, 49, 255, 1},
-        {53, 142, 50, 255, 1},
-        {42, 131, 39, 255, 1},
-        {36, 125, 33, 255, 1},
-        {34, 123, 31, 255, 1},
-        {32, 121, 29, 255, 1},
-        {37, 126, 33, 255, 1},
-        {39, 128, 34, 255, 1},
-        {30, 119, 24, 255, 1},
-        {23, 112, 18, 255, 1},
-        {35, 124, 30, 255, 1},
-        {44, 133, 39, 255, 1},
-        {39, 128, 34, 255, 2},
-        {41, 130, 36, 255, 1},
-        {43, 132, 38, 255, 1},
-        {31, 120, 26, 255, 1},
-        {22, 111, 17, 255, 1},
-        {37, 126, 32, 255, 1},
-        {48, 137, 43, 255, 1},
-        {35, 124, 30, 255, 1},
-        {25, 114, 20, 255, 1},
-        {44, 133, 39, 255, 1},
-        {58, 147, 55, 255, 1},
-        {45, 134, 42, 255, 1},
-        {37, 126, 35, 255, 1},
-        {38, 127, 36, 255, 1},
-        {38, 127, 35, 255, 1},
-        {39, 128, 35, 255, 1},
-        {40, 129, 35, 255, 1},
-        {37, 126, 32, 255, 1},
-        {34, 123, 29, 255, 1},
-        {44, 133, 39, 255, 1},
-        {53, 142, 48, 255, 1},
-        {41, 130, 36, 255, 1},
-        {33, 122, 28, 255, 1},
-        {34, 123, 29, 255, 1},
-        {36, 132, 30, 255, 1},
-        {53, 143, 48, 148, 1},
-        {60, 156, 54, 255, 1},
-        {28, 117, 23, 255, 1},
-        {15, 104, 10, 255, 1},
-        {32, 121, 27, 255, 1},
-        {39, 128, 34, 255, 1},
-        {45, 134, 40, 255, 1},
-        {49, 138, 44, 255, 1},
-        {32, 121, 27, 255, 1},
-        {25, 114, 20, 255, 1},
-        {31, 120, 26, 255, 1},
-        {32, 121, 27, 255, 1},
-        {50, 139, 45, 255, 1},
-        {59, 148, 54, 255, 2},
-        {63, 152, 58, 255, 1},
-        {27, 116, 22, 255, 1},
-        {4, 93, 0, 255, 1},
-        {33, 122, 28, 255, 1},
-        {46, 135, 41, 255, 2},
-        {47, 136, 42, 255, 1},
-        {46, 135, 41, 255, 2},
-        {51, 140, 47, 255, 1},
-        {54, 143, 51, 255, 1},
-        {52, 141, 49, 255, 1},
-        {53, 142, 50, 255, 1},
-        {43, 132, 40, 255, 1},
-        {38, 127, 35, 255, 1},
-        {35, 124, 32, 255, 1},
-        {32, 121, 29, 255, 1},
-        {40, 129, 36, 255, 1},
-        {44, 133, 39, 255, 1},
-        {24, 113, 19, 255, 1},
-        {10, 99, 5, 255, 1},
-        {33, 122, 28, 255, 1},
-        {46, 135, 41, 255, 1},
-        {47, 136, 42, 255, 1},
-        {49, 138, 44, 255, 1},
-        {43, 132, 38, 255, 1},
-        {42, 131, 37, 255, 1},
-        {26, 115, 21, 255, 1},
-        {13, 102, 8, 255, 1},
-        {27, 116, 22, 255, 1},
-        {36, 125, 31, 255, 1},
-        {18, 107, 13, 255, 1},
-        {3, 92, 0, 255, 1},
-        {38, 127, 33, 255, 1},
-        {64, 153, 61, 255, 1},
-        {46, 135, 43, 255, 1},
-        {37, 126, 33, 255, 1},
-        {43, 132, 40, 255, 1},
-        {46, 135, 43, 255, 1},
-        {53, 142, 49, 255, 1},
-        {60, 149, 55, 255, 1},
-        {42, 131, 37, 255, 1},
-        {27, 116, 22, 255, 1},
-        {43, 132, 38, 255, 1},
-        {55, 144, 50, 255, 1},
-        {48, 137, 43, 255, 1},
-        {45, 134, 40, 255, 1},
-        {32, 121, 27, 255, 1},
-        {24, 120, 18, 255, 1},
-        {37, 127, 34, 148, 1},
-        {41, 137, 36, 255, 1},
-        {38, 127, 33, 255, 1},
-        {39, 128, 34, 255, 1},
-        {35, 124, 30, 255, 1},
-        {33, 122, 28, 255, 1},
-        {35, 124, 30, 255, 1},
-        {37, 126, 32, 255, 1},
-        {35, 124, 30, 255, 1},
-        {34, 123, 29, 255, 1},
-        {37, 126, 32, 255, 1},
-        {39, 128, 34, 255, 1},
-        {41, 130, 36, 255, 1},
-        {43, 132, 38, 255, 1},
-        {41, 130, 36, 255, 2},
-        {31, 120, 26, 255, 1},
-        {23, 112, 18, 255, 1},
-        {36, 125, 31, 255, 1},
-        {41, 130, 36, 255, 1},
-        {49, 138, 44, 255, 1},
-        {55, 144, 50, 255, 1},
-        {48, 137, 43, 255, 1},
-        {44, 133, 39, 255, 1},
-        {48, 137, 43, 255, 1},
-        {51, 140, 46, 255, 1},
-        {41, 130, 36, 255, 1},
-        {34, 123, 29, 255, 1},
-        {46, 135, 41, 255, 1},
-        {54, 143, 49, 255, 1},
-        {37, 126, 32, 255, 1},
-        {27, 116, 22, 255, 1},
-        {33, 122, 28, 255, 1},
-        {36, 125, 31, 255, 1},
-        {30, 119, 25, 255, 1},
-        {26, 115, 21, 255, 1},
-        {31, 120, 26, 255, 1},
-        {35, 124, 30, 255, 1},
-        {34, 123, 29, 255, 2},
-        {30, 119, 25, 255, 1},
-        {27, 116, 22, 255, 1},
-        {30, 119, 25, 255, 1},
-        {32, 121, 27, 255, 1},
-        {35, 124, 30, 255, 2},
-        {39, 128, 34, 255, 1},
-        {42, 131, 37, 255, 1},
-        {44, 133, 39, 255, 1},
-        {47, 136, 42, 255, 1},
-        {45, 134, 40, 255, 1},
-        {42, 131, 37, 255, 1},
-        {48, 137, 43, 255, 1},
-        {53, 142, 48, 255, 1},
-        {44, 133, 39, 255, 1},
-        {39, 128, 34, 255, 3},
-        {35, 124, 30, 255, 1},
-        {32, 121, 27, 255, 1},
-        {34, 123, 29, 255, 1},
-        {35, 124, 30, 255, 1},
-        {42, 131, 37, 255, 1},
-        {52, 149, 47, 255, 1},
-        {29, 118, 24, 148, 1},
-        {31, 127, 25, 255, 1},
-        {43, 132, 38, 255, 1},
-        {50, 139, 45, 255, 1},
-        {35, 124, 30, 255, 1},
-        {28, 117, 23, 255, 1},
-        {31, 120, 26, 255, 1},
-        {32, 121, 27, 255, 1},
-        {37, 126, 32, 255, 1},
-        {40, 129, 35, 255, 1},
-        {41, 130, 36, 255, 1},
-        {43, 132, 38, 255, 1},
-        {37, 126, 32, 255, 1},
-        {35, 124, 30, 255, 1},
-        {32, 121, 27, 255, 1},
-        {31, 120, 26, 255, 2},
-        {30, 119, 25, 255, 1},
-        {38, 127, 33, 255, 1},
-        {40, 129, 35, 255, 1},
-        {53, 142, 48, 255, 1},
-        {61, 150, 56, 255, 1},
-        {50, 139, 45, 255, 1},
-        {45, 134, 40, 255, 1},
-        {48, 137, 43, 255, 1},
-        {52, 141, 47, 255, 1},
-        {35, 124, 30, 255, 1},
-        {23, 112, 18, 255, 1},
-        {49, 138, 44, 255, 1},
-        {65, 154, 60, 255, 1},
-        {39, 128, 34, 255, 1},
-        {24, 113, 19, 255, 1},
-        {30, 119, 25, 255, 1},
-        {33, 122, 27, 255, 1},
-        {33, 122, 28, 255, 2},
-        {30, 119, 25, 255, 1},
-        {29, 118, 24, 255, 1},
-        {27, 116, 22, 255, 1},
-        {26, 115, 21, 255, 1},
-        {22, 111, 17, 255, 1},
-        {18, 107, 13, 255, 1},
-        {31, 120, 26, 255, 1},
-        {39, 128, 34, 255, 1},
-        {37, 126, 32, 255, 1},
-        {35, 124, 30, 255, 1},
-        {50, 139, 45, 255, 1},
-        {62, 151, 57, 255, 1},
-        {49, 138, 44, 255, 1},
-        {40, 129, 35, 255, 1},
-        {44, 133, 39, 255, 2},
-        {52, 141, 47, 255, 1},
-        {60, 149, 55, 255, 1},
-        {42, 131, 37, 255, 1},
-        {29, 118, 24, 255, 1},
-        {38, 127, 33, 255, 1},
-        {45, 134, 40, 255, 1},
-        {31, 120, 26, 255, 1},
-        {18, 107, 13, 255, 1},
-        {26, 115, 21, 255, 1},
-        {30, 119, 25, 255, 1},
-        {48, 137, 43, 255, 1},
-        {69, 165, 64, 255, 1},
-        {43, 132, 37, 148, 1},
-        {48, 144, 42, 255, 1},
-        {43, 132, 38, 255, 1},
-        {42, 131, 37, 255, 1},
-        {51, 140, 46, 255, 1},
-        {55, 144, 50, 255, 1},
-        {41, 130, 36, 255, 1},
-        {35, 124, 30, 255, 3},
-        {25, 114, 20, 255, 1},
-        {19, 108, 14, 255, 1},
-        {38, 127, 33, 255, 1},
-        {47, 136, 42, 255, 1},
-        {41, 130, 36, 255, 1},
-        {38, 127, 33, 255, 1},
-        {41, 130, 36, 255, 2},
-        {44, 133, 39, 255, 1},
-        {45, 134, 40, 255, 1},
-        {48, 137, 43, 255, 1},
-        {51, 140, 46, 255, 1},
-        {33, 122, 28, 255, 1},
-        {23, 112, 18, 255, 1},
-        {34, 123, 29, 255, 1},
-        {41, 130, 36, 255, 1},
-        {30, 119, 26, 255, 1},
-        {24, 113, 19, 255, 1},
-        {32, 121, 27, 255, 1},
-        {36, 125, 31, 255, 1},
-        {37, 126, 32, 255, 1},
-        {38, 127, 33, 255, 1},
-        {35, 124, 30, 255, 1},
-        {33, 122, 29, 255, 1},
-        {36, 125, 32, 255, 1},
-        {37, 126, 33, 255, 1},
-        {35, 124, 31, 255, 1},
-        {34, 123, 29, 255, 1},
-        {37, 126, 32, 255, 1},
-        {40, 129, 35, 255, 1},
-        {30, 119, 25, 255, 1},
-        {21, 110, 16, 255, 1},
-        {35, 124, 30, 255, 1},
-        {45, 134, 40, 255, 1},
-        {34, 123, 29, 255, 1},
-        {28, 117, 23, 255, 1},
-        {30, 119, 25, 255, 2},
-        {34, 123, 29, 255, 1},
-        {36, 125, 31, 255, 1},
-        {43, 132, 38, 255, 1},
-        {49, 138, 44, 255, 1},
-        {37, 126, 32, 255, 1},
-        {28, 117, 23, 255, 1},
-        {36, 125, 31, 255, 1},
-        {41, 130, 36, 255, 1},
-        {42, 131, 37, 255, 1},
-        {43, 132, 38, 255, 1},
-        {38, 127, 33, 255, 1},
-        {33, 122, 28, 255, 1},
-        {37, 126, 32, 255, 1},
-        {40, 129, 35, 255, 1},
-        {35, 124, 30, 255, 1},
-        {35, 131, 30, 255, 1},
-        {51, 141, 46, 148, 1},
-        {57, 153, 51, 255, 1},
-        {45, 134, 40, 255, 1},
-        {40, 129, 35, 255, 1},
-        {61, 150, 56, 255, 1},
-        {72, 161, 67, 255, 1},
-        {45, 134, 40, 255, 1},
-        {34, 123, 29, 255, 3},
-        {16, 105, 11, 255, 1},
-        {5, 94, 0, 255, 1},
-        {38, 127, 33, 255, 1},
-        {54, 143, 49, 255, 1},
-        {46, 135, 41, 255, 1},
-        {43, 132, 38, 255, 1},
-        {47, 136, 42, 255, 3},
-        {48, 137, 43, 255, 1},
-        {46, 135, 41, 255, 1},
-        {47, 136, 42, 255, 1},
-        {21, 110, 16, 255, 1},
-        {8, 97, 3, 255, 1},
-        {25, 114, 20, 255, 1},
-        {33, 122, 30, 255, 1},
-        {27, 116, 24, 255, 1},
-        {24, 114, 21, 255, 1},
-        {23, 112, 20, 255, 1},
-        {20, 109, 17, 255, 1},
-        {36, 125, 32, 255, 1},
-        {47, 136, 42, 255, 1},
-        {38, 127, 34, 255, 1},
-        {33, 122, 30, 255, 1},
-        {38, 127, 35, 255, 1},
-        {42, 131, 39, 255, 1},
-        {37, 126, 34, 255, 1},
-        {34, 123, 31, 255, 1},
-        {43, 132, 38, 255, 1},
-        {49, 138, 44, 255, 1},
-        {33, 122, 28, 255, 1},
-        {19, 108, 14, 255, 1},
-        {37, 126, 32, 255, 1},
-        {49, 138, 44, 255, 1},
-        {33, 122, 28, 255, 1},
-        {23, 112, 18, 255, 1},
-        {18, 107, 13, 255, 1},
-        {11, 100, 6, 255, 1},
-        {25, 114, 20, 255, 1},
-        {34, 123, 29, 255, 1},
-        {42, 131, 37, 255, 1},
-        {52, 141, 47, 255, 1},
-        {27, 116, 22, 255, 1},
-        {8, 97, 3, 255, 1},
-        {33, 122, 28, 255, 1},
-        {50, 139, 45, 255, 1},
-        {44, 133, 39, 255, 1},
-        {41, 130, 36, 255, 2},
-        {39, 128, 34, 255, 1},
-        {42, 131, 37, 255, 1},
-        {45, 134, 40, 255, 1},
-        {28, 117, 23, 255, 1},
-        {17, 113, 11, 255, 1},
-        {44, 134, 39, 148, 1},
-        {49, 145, 43, 255, 1},
-        {34, 123, 29, 255, 1},
-        {28, 117, 23, 255, 1},
-        {46, 135, 41, 255, 1},
-        {55, 144, 50, 255, 1},
-        {51, 140, 46, 255, 1},
-        {50, 139, 45, 255, 1},
-        {35, 124, 30, 255, 1},
-        {28, 117, 23, 255, 1},
-        {29, 118, 24, 255, 1},
-        {28, 117, 23, 255, 1},
-        {33, 122, 28, 255, 1},
-        {35, 124, 30, 255, 1},
-        {32, 121, 27, 255, 1},
-        {28, 117, 23, 255, 1},
-        {47, 136, 42, 255, 1},
-        {58, 147, 53, 255, 1},
-        {50, 139, 45, 255, 1},
-        {46, 135, 41, 255, 1},
-        {42, 131, 37, 255, 1},
-        {39, 128, 34, 255, 1},
-        {41, 130, 36, 255, 1},
-        {42, 131, 36, 255, 1},
-        {42, 131, 37, 255, 1},
-        {45, 134, 42, 255, 1},
-        {21, 110, 19, 255, 1},
-        {8, 95, 7, 255, 1},
-        {20, 109, 18, 255, 1},
-        {26, 115, 23, 255, 1},
-        {30, 119, 25, 255, 1},
-        {32, 121, 27, 255, 1},
-        {34, 123, 29, 255, 1},
-        {35, 124, 32, 255, 1},
-        {32, 121, 29, 255, 1},
-        {29, 118, 26, 255, 1},
-        {39, 128, 36, 255, 1},
-        {46, 135, 43, 255, 1},
-        {37, 126, 32, 255, 1},
-        {32, 121, 27, 255, 1},
-        {41, 130, 36, 255, 1},
-        {47, 136, 42, 255, 1},
-        {39, 128, 34, 255, 1},
-        {33, 122, 28, 255, 2},
-        {32, 121, 27, 255, 1},
-        {38, 127, 33, 255, 1},
-        {45, 134, 40, 255, 1},
-        {29, 118, 24, 255, 1},
-        {16, 105, 11, 255, 1},
-        {35, 124, 30, 255, 1},
-        {48, 137, 43, 255, 1},
-        {42, 131, 37, 255, 1},
-        {40, 129, 35, 255, 1},
-        {33, 122, 28, 255, 1},
-        {25, 114, 20, 255, 1},
-        {44, 133, 39, 255, 1},
-        {59, 148, 54, 255, 1},
-        {52, 141, 47, 255, 1},
-        {47, 136, 42, 255, 1},
-        {44, 133, 39, 255, 1},
-        {42, 131, 37, 255, 1},
-        {36, 125, 31, 255, 1},
-        {32, 128, 27, 255, 1},
-        {43, 132, 37, 148, 1},
-        {47, 143, 42, 255, 1},
-        {28, 117, 23, 255, 1},
-        {19, 108, 14, 255, 1},
-        {39, 128, 34, 255, 1},
-        {48, 137, 43, 255, 1},
-        {55, 144, 50, 255, 1},
-        {62, 151, 57, 255, 1},
-        {35, 124, 30, 255, 1},
-        {22, 111, 17, 255, 1},
-        {34, 123, 29, 255, 1},
-        {40, 129, 35, 255, 1},
-        {29, 118, 24, 255, 1},
-        {24, 113, 19, 255, 1},
-        {22, 111, 17, 255, 1},
-        {18, 107, 13, 255, 1},
-        {50, 139, 45, 255, 1},
-        {69, 158, 64, 255, 1},
-        {52, 141, 47, 255, 1},
-        {45, 134, 40, 255, 1},
-        {39, 128, 34, 255, 1},
-        {34, 123, 29, 255, 1},
-        {51, 140, 46, 255, 1},
-        {60, 149, 55, 255, 1},
-        {52, 141, 48, 255, 1},
-        {52, 141, 49, 255, 1},
-        {16, 104, 14, 255, 1},
-        {0, 79, 0, 255, 1},
-        {14, 103, 12, 255, 1},
-        {26, 115, 22, 255, 1},
-        {24, 113, 19, 255, 2},
-        {31, 120, 26, 255, 1},
-        {36, 125, 31, 255, 1},
-        {27, 116, 23, 255, 1},
-        {21, 110, 16, 255, 1},
-        {40, 129, 36, 255, 1},
-        {53, 142, 49, 255, 1},
-        {34, 123, 29, 255, 1},
-        {21, 110, 16, 255, 1},
-        {47, 136, 42, 255, 1},
-        {65, 154, 60, 255, 1},
-        {40, 129, 35, 255, 1},
-        {25, 114, 20, 255, 1},
-        {35, 124, 30, 255, 1},
-        {37, 126, 32, 255, 1},
-        {51, 140, 46, 255, 1},
-        {65, 154, 60, 255, 1},
-        {30, 119, 25, 255, 1},
-        {2, 91, 0, 255, 1},
-        {31, 120, 26, 255, 1},
-        {47, 136, 42, 255, 1},
-        {51, 140, 46, 255, 1},
-        {59, 148, 54, 255, 1},
-        {31, 120, 26, 255, 1},
-        {9, 98, 4, 255, 1},
-        {45, 134, 40, 255, 1},
-        {71, 160, 66, 255, 1},
-        {60, 149, 55, 255, 1},
-        {54, 143, 49, 255, 1},
-        {46, 135, 41, 255, 1},
-        {40, 129, 35, 255, 1},
-        {38, 127, 33, 255, 1},
-        {38, 135, 33, 255, 1},
-        {27, 117, 22, 148, 1},
-        {29, 125, 23, 255, 1},
-        {28, 117, 23, 255, 1},
-        {29, 118, 24, 255, 1},
-        {36, 125, 31, 255, 1},
-        {40, 129, 35, 255, 1},
-        {37, 126, 32, 255, 1},
-        {35, 124, 30, 255, 1},
-        {40, 129, 35, 255, 1},
-        {42, 131, 37, 255, 1},
-        {43, 132, 38, 255, 1},
-        {44, 133, 39, 255, 1},
-        {40, 129, 35, 255, 1},
-        {38, 127, 33, 255, 1},
-        {34, 123, 29, 255, 1},
-        {32, 121, 27, 255, 1},
-        {31, 120, 26, 255, 1},
-        {28, 117, 23, 255, 1},
-        {42, 131, 37, 255, 1},
-        {50, 138, 45, 255, 1},
-        {38, 127, 33, 255, 1},
-        {30, 119, 25, 255, 1},
-        {55, 144, 50, 255, 1},
-        {69, 158, 64, 255, 1},
-        {47, 136, 42, 255, 1},
-        {36, 125, 33, 255, 1},
-        {38, 127, 36, 255, 1},
-        {38, 126, 36, 255, 1},
-        {47, 136, 44, 255, 1},
-        {54, 143, 51, 255, 1},
-        {42, 131, 38, 255, 1},
-        {36, 125, 31, 255, 1},
-        {40, 129, 35, 255, 1},
-        {43, 132, 38, 255, 1},
-        {35, 124, 30, 255, 1},
-        {29, 118, 24, 255, 1},
-        {38, 127, 33, 255, 1},
-        {44, 133, 39, 255, 1},
-        {39, 128, 34, 255, 1},
-        {36, 125, 31, 255, 1},
-        {47, 136, 42, 255, 1},
-        {55, 144, 50, 255, 1},
-        {36, 125, 31, 255, 1},
-        {23, 112, 18, 255, 1},
-        {32, 121, 27, 255, 1},
-        {35, 124, 30, 255, 1},
-        {40, 129, 35, 255, 1},
-        {44, 133, 39, 255, 1},
-        {38, 127, 33, 255, 1},
-        {33, 122, 28, 255, 1},
-        {34, 123, 29, 255, 1},
-        {35, 124, 30, 255, 1},
-        {34, 123, 29, 255, 2},
-        {31, 120, 26, 255, 1},
-        {27, 116, 22, 255, 1},
-        {38, 127, 33, 255, 1},
-        {45, 134, 40, 255, 1},
-        {40, 129, 35, 255, 1},
-        {35, 124, 30, 255, 1},
-        {42, 131, 37, 255, 1},
-        {47, 136, 42, 255, 1},
-        {44, 133, 39, 255, 1},
-        {47, 143, 42, 255, 1},
-        {15, 105, 10, 148, 1},
-        {17, 113, 11, 255, 1},
-        {28, 117, 23, 255, 1},
-        {33, 122, 28, 255, 1},
-        {34, 123, 29, 255, 1},
-        {35, 124, 30, 255, 1},
-        {25, 114, 20, 255, 1},
-        {19, 108, 14, 255, 1},
-        {44, 133, 39, 255, 1},
-        {56, 145, 51, 255, 1},
-        {50, 139, 45, 255, 1},
-        {49, 138, 44, 255, 1},
-        {46, 135, 41, 255, 1},
-        {45, 134, 40, 255, 1},
-        {39, 128, 34, 255, 1},
-        {38, 127, 33, 255, 1},
-        {18, 107, 13, 255, 1},
-        {4, 93, 0, 255, 1},
-        {37, 126, 32, 255, 1},
-        {54, 143, 49, 255, 1},
-        {39, 128, 33, 255, 1},
-        {28, 118, 23, 255, 1},
-        {59, 148, 54, 255, 1},
-        {77, 166, 72, 255, 1},
-        {45, 134, 41, 255, 1},
-        {27, 116, 24, 255, 1},
-        {51, 140, 48, 255, 1},
-        {62, 152, 59, 255, 1},
-        {66, 155, 63, 255, 1},
-        {71, 160, 68, 255, 1},
-        {52, 141, 48, 255, 1},
-        {41, 130, 36, 255, 1},
-        {46, 135, 41, 255, 1},
-        {48, 137, 43, 255, 1},
-        {38, 127, 33, 255, 1},
-        {32, 121, 27, 255, 1},
-        {36, 125, 31, 255, 1},
-        {39, 128, 34, 255, 1},
-        {42, 131, 37, 255, 1},
-        {43, 132, 38, 255, 1},
-        {48, 137, 43, 255, 1},
-        {52, 141, 47, 255, 1},
-        {34, 123, 29, 255, 1},
-        {21, 110, 16, 255, 1},
-        {30, 119, 25, 255, 1},
-        {36, 125, 31, 255, 1},
-        {34, 123, 29, 255, 2},
-        {43, 132, 38, 255, 1},
-        {51, 140, 46, 255, 1},
-        {35, 124, 30, 255, 1},
-        {26, 115, 21, 255, 1},
-        {24, 113, 19, 255, 1},
-        {21, 110, 16, 255, 1},
-        {30, 119, 25, 255, 1},
-        {36, 125, 31, 255, 1},
-        {33, 122, 28, 255, 1},
-        {32, 121, 27, 255, 1},
-        {29, 118, 24, 255, 1},
-        {24, 113, 19, 255, 1},
-        {40, 129, 35, 255, 1},
-        {52, 141, 47, 255, 1},
-        {50, 139, 45, 255, 1},
-        {55, 151, 49, 255, 1},
-        {29, 118, 25, 148, 1},
-        {32, 128, 27, 255, 1},
-        {34, 123, 29, 255, 1},
-        {37, 126, 32, 255, 1},
-        {31, 120, 26, 255, 1},
-        {27, 116, 22, 255, 1},
-        {39, 128, 34, 255, 1},
-        {45, 134, 40, 255, 1},
-        {38, 127, 34, 255, 1},
-        {35, 124, 32, 255, 1},
-        {36, 125, 33, 255, 1},
-        {37, 126, 32, 255, 1},
-        {33, 122, 29, 255, 1},
-        {31, 120, 26, 255, 1},
-        {45, 134, 40, 255, 1},
-        {53, 142, 48, 255, 1},
-        {39, 128, 34, 255, 1},
-        {31, 120, 26, 255, 1},
-        {32, 121, 27, 255, 1},
-        {33, 122, 29, 255, 1},
-        {18, 106, 16, 255, 1},
-        {9, 94, 8, 255, 1},
-        {42, 131, 41, 255, 1},
-        {60, 150, 56, 255, 1},
-        {42, 132, 37, 255, 1},
-        {34, 123, 31, 255, 1},
-        {41, 130, 38, 255, 1},
-        {45, 134, 42, 255, 1},
-        {52, 141, 49, 255, 1},
-        {58, 147, 55, 255, 1},
-        {51, 140, 46, 255, 1},
-        {49, 138, 44, 255, 1},
-        {43, 132, 38, 255, 1},
-        {38, 127, 33, 255, 1},
-        {46, 135, 41, 255, 1},
-        {51, 140, 46, 255, 1},
-        {47, 136, 42, 255, 1},
-        {46, 135, 41, 255, 3},
-        {41, 130, 36, 255, 1},
-        {37, 126, 32, 255, 1},
-        {34, 123, 29, 255, 1},
-        {32, 121, 27, 255, 1},
-        {29, 118, 24, 255, 1},
-        {25, 114, 20, 255, 1},
-        {35, 124, 30, 255, 1},
-        {42, 131, 37, 255, 1},
-        {30, 119, 25, 255, 1},
-        {21, 110, 16, 255, 1},
-        {36, 125, 31, 255, 1},
-        {45, 134, 40, 255, 1},
-        {44, 133, 39, 255, 1},
-        {45, 134, 40, 255, 1},
-        {39, 128, 34, 255, 1},
-        {35, 124, 30, 255, 2},
-        {34, 123, 29, 255, 1},
-        {38, 127, 33, 255, 1},
-        {39, 128, 34, 255, 2},
-        {40, 129, 35, 255, 1},
-        {35, 124, 31, 255, 1},
-        {34, 130, 30, 255, 1},
-        {37, 127, 32, 148, 1},
-        {40, 137, 35, 255, 1},
-        {39, 128, 34, 255, 1},
-        {40, 129, 35, 255, 1},
-        {27, 116, 22, 255, 1},
-        {19, 108, 14, 255, 1},
-        {46, 135, 41, 255, 1},
-        {60, 149, 55, 255, 1},
-        {37, 126, 32, 255, 1},
-        {26, 116, 24, 255, 1},
-        {28, 117, 25, 255, 1},
-        {28, 117, 23, 255, 1},
-        {26, 115, 21, 255, 1},
-        {23, 112, 18, 255, 1},
-        {50, 139, 45, 255, 1},
-        {65, 154, 60, 255, 1},
-        {51, 140, 46, 255, 1},
-        {46, 135, 41, 255, 1},
-        {29, 118, 24, 255, 1},
-        {20, 109, 20, 255, 1},
-        {3, 90, 5, 255, 1},
-        {0, 74, 0, 255, 1},
-        {31, 119, 30, 255, 1},
-        {52, 142, 47, 255, 1},
-        {41, 131, 36, 255, 1},
-        {36, 125, 34, 255, 1},
-        {37, 126, 34, 255, 1},
-        {36, 125, 33, 255, 1},
-        {48, 137, 45, 255, 1},
-        {54, 143, 51, 255, 1},
-        {52, 141, 47, 255, 1},
-        {53, 142, 48, 255, 1},
-        {42, 131, 37, 255, 1},
-        {32, 121, 27, 255, 1},
-        {52, 141, 47, 255, 1},
-        {65, 154, 60, 255, 1},
-        {56, 145, 51, 255, 1},
-        {52, 141, 47, 255, 1},
-        {51, 140, 46, 255, 2},
-        {37, 126, 32, 255, 1},
-        {27, 116, 22, 255, 1},
-        {34, 123, 29, 255, 1},
-        {38, 127, 33, 255, 1},
-        {27, 116, 22, 255, 1},
-        {19, 108, 14, 255, 1},
-        {35, 124, 30, 255, 1},
-        {48, 137, 43, 255, 1},
-        {23, 112, 18, 255, 1},
-        {2, 91, 0, 255, 1},
-        {36, 125, 31, 255, 1},
-        {58, 147, 53, 255, 2},
-        {62, 151, 57, 255, 1},
-        {46, 135, 41, 255, 1},
-        {34, 123, 29, 255, 1},
-        {36, 125, 31, 255, 1},
-        {35, 124, 30, 255, 1},
-        {42, 131, 37, 255, 1},
-        {49, 138, 44, 255, 1},
-        {39, 128, 34, 255, 1},
-        {34, 123, 29, 255, 1},
-        {26, 115, 23, 255, 1},
-        {21, 117, 18, 255, 1},
-        {34, 122, 29, 148, 1},
-        {37, 133, 32, 255, 1},
-        {31, 120, 27, 255, 1},
-        {29, 118, 24, 255, 1},
-        {40, 129, 35, 255, 1},
-        {45, 134, 40, 255, 1},
-        {43, 132, 38, 255, 1},
-        {44, 133, 39, 255, 1},
-        {20, 109, 17, 255, 1},
-        {10, 95, 9, 255, 1},
-        {38, 127, 35, 255, 1},
-        {54, 143, 49, 255, 1},
-        {38, 127, 33, 255, 1},
-        {32, 121, 27, 255, 1},
-        {38, 127, 33, 255, 1},
-        {40, 129, 35, 255, 1},
-        {36, 125, 31, 255, 1},
-        {35, 124, 30, 255, 1},
-        {32, 121, 27, 255, 1},
-        {30, 119, 26, 255, 1},
-        {30, 119, 27, 255, 1},
-        {30, 117, 29, 255, 1},
-        {44, 132, 41, 255, 1},
-        {51, 140, 46, 255, 1},
-        {44, 133, 39, 255, 1},
-        {41, 130, 37, 255, 1},
-        {45, 134, 41, 255, 1},
-        {48, 137, 45, 255, 1},
-        {32, 121, 29, 255, 1},
-        {21, 110, 18, 255, 1},
-        {47, 136, 42, 255, 1},
-        {63, 152, 58, 255, 1},
-        {41, 130, 36, 255, 1},
-        {29, 118, 24, 255, 1},
-        {36, 125, 31, 255, 1},
-        {39, 128, 34, 255, 1},
-        {37, 126, 32, 255, 2},
-        {36, 125, 31, 255, 2},
-        {35, 124, 30, 255, 1},
-        {34, 123, 29, 255, 1},
-        {40, 129, 35, 255, 1},
-        {45, 134, 40, 255, 1},
-        {31, 120, 26, 255, 1},
-        {22, 111, 17, 255, 1},
-        {31, 120, 26, 255, 1},
-        {36, 125, 31, 255, 1},
-        {28, 117, 23, 255, 1},
-        {20, 109, 15, 255, 1},
-        {37, 126, 32, 255, 1},
-        {50, 139, 45, 255, 1},
-        {35, 124, 30, 255, 1},
-        {24, 113, 19, 255, 1},
-        {38, 127, 33, 255, 1},
-        {48, 137, 43, 255, 1},
-        {34, 123, 29, 255, 1},
-        {25, 114, 20, 255, 1},
-        {26, 115, 21, 255, 4},
-        {28, 117, 23, 255, 1},
-        {31, 127, 27, 255, 1},
-        {34, 124, 31, 148, 1},
-        {37, 133, 34, 255, 1},
-        {25, 114, 22, 255, 1},
-        {19, 108, 14, 255, 1},
-        {47, 136, 42, 255, 1},
-        {62, 151, 57, 255, 1},
-        {41, 130, 38, 255, 1},
-        {36, 125, 32, 255, 1},
-        {7, 96, 5, 255, 1},
-        {0, 78, 0, 255, 1},
-        {43, 134, 39, 255, 1},
-        {72, 161, 67, 255, 1},
-        {47, 136, 42, 255, 1},
-        {38, 127, 33, 255, 1},
-        {29, 118, 24, 255, 1},
-        {23, 112, 18, 255, 1},
-        {26, 115, 21, 255, 1},
-        {27, 116, 22, 255, 1},
-        {33, 122, 28, 255, 1},
-        {35, 124, 29, 255, 1},
-        {46, 136, 41, 255, 1},
-        {54, 144, 49, 255, 1},
-        {50, 139, 45, 255, 1},
-        {49, 138, 44, 255, 1},
-        {46, 135, 41, 255, 1},
-        {44, 133, 39, 255, 1},
-        {50, 139, 45, 255, 1},
-        {57, 146, 54, 255, 1},
-        {21, 110, 18, 255, 1},
-        {0, 85, 0, 255, 1},
-        {44, 133, 39, 255, 1},
-        {72, 161, 67, 255, 1},
-        {42, 131, 37, 255, 1},
-        {26, 115, 21, 255, 1},
-        {24, 113, 19, 255, 1},
-        {21, 110, 16, 255, 1},
-        {25, 114, 20, 255, 1},
-        {27, 116, 22, 255, 1},
-        {25, 114, 20, 255, 1},
-        {24, 113, 19, 255, 1},
-        {33, 122, 28, 255, 1},
-        {37, 126, 32, 255, 1},
-        {45, 134, 40, 255, 1},
-        {52, 141, 47, 255, 1},
-        {34, 123, 29, 255, 1},
-        {22, 111, 17, 255, 1},
-        {26, 115, 21, 255, 1},
-        {27, 116, 22, 255, 1},
-        {30, 119, 25, 255, 2},
-        {39, 128, 34, 255, 1},
-        {47, 136, 42, 255, 1},
-        {21, 110, 16, 255, 1},
-        {0, 87, 0, 255, 1},
-        {33, 122, 28, 255, 1},
-        {58, 147, 53, 255, 1},
-        {33, 122, 28, 255, 1},
-        {17, 106, 12, 255, 1},
-        {15, 104, 10, 255, 1},
-        {11, 100, 6, 255, 1},
-        {18, 107, 13, 255, 1},
-        {21, 110, 16, 255, 1},
-        {28, 117, 23, 255, 1},
-        {36, 133, 31, 255, 1},
-        {20, 111, 18, 148, 1},
-        {22, 119, 19, 255, 1},
-        {38, 127, 35, 255, 1},
-        {46, 135, 41, 255, 1},
-        {47, 136, 42, 255, 1},
-        {48, 137, 44, 255, 1},
-        {38, 127, 35, 255, 1},
-        {33, 122, 30, 255, 1},
-        {34, 124, 32, 255, 1},
-        {36, 125, 34, 255, 1},
-        {35, 126, 30, 255, 1},
-        {36, 125, 30, 255, 1},
-        {34, 123, 29, 255, 1},
-        {32, 121, 27, 255, 1},
-        {39, 128, 34, 255, 1},
-        {43, 132, 38, 255, 1},
-        {45, 134, 40, 255, 1},
-        {47, 136, 42, 255, 1},
-        {40, 129, 35, 255, 1},
-        {37, 126, 32, 255, 2},
-        {36, 125, 31, 255, 1},
-        {47, 136, 42, 255, 1},
-        {54, 143, 49, 255, 1},
-        {44, 133, 39, 255, 1},
-        {39, 128, 34, 255, 1},
-        {37, 126, 32, 255, 1},
-        {36, 125, 32, 255, 1},
-        {27, 116, 24, 255, 1},
-        {21, 110, 18, 255, 1},
-        {38, 127, 33, 255, 1},
-        {49, 138, 44, 255, 1},
-        {33, 122, 28, 255, 1},
-        {22, 111, 17, 255, 1},
-        {38, 127, 33, 255, 1},
-        {46, 135, 41, 255, 1},
-        {39, 128, 34, 255, 1},
-        {35, 124, 30, 255, 1},
-        {39, 128, 34, 255, 1},
-        {40, 129, 35, 255, 1},
-        {41, 130, 36, 255, 1},
-        {44, 133, 39, 255, 1},
-        {35, 124, 30, 255, 1},
-        {28, 117, 23, 255, 1},
-        {37, 126, 32, 255, 1},
-        {42, 131, 37, 255, 1},
-        {44, 133, 39, 255, 1},
-        {47, 136, 42, 255, 1},
-        {38, 127, 33, 255, 1},
-        {31, 120, 26, 255, 1},
-        {32, 121, 27, 255, 1},
-        {31, 120, 26, 255, 1},
-        {32, 121, 27, 255, 2},
-        {38, 127, 33, 255, 1},
-        {43, 132, 38, 255, 1},
-        {33, 122, 28, 255, 1},
-        {27, 116, 22, 255, 1},
-        {28, 117, 23, 255, 2},
-        {27, 116, 22, 255, 2},
-        {28, 117, 23, 255, 1},
-        {31, 128, 26, 255, 1},
-        {12, 99, 8, 148, 1},
-        {10, 106, 7, 255, 1},
-        {45, 134, 42, 255, 1},
-        {62, 151, 57, 255, 1},
-        {48, 137, 43, 255, 1},
-        {43, 132, 38, 255, 1},
-        {35, 124, 31, 255, 1},
-        {29, 118, 25, 255, 1},
-        {49, 139, 45, 255, 1},
-        {61, 151, 56, 255, 1},
-        {30, 120, 24, 255, 1},
-        {14, 104, 9, 255, 1},
-        {26, 115, 21, 255, 1},
-        {28, 117, 23, 255, 1},
-        {45, 134, 40, 255, 1},
-        {54, 143, 49, 255, 1},
-        {56, 145, 51, 255, 1},
-        {60, 149, 55, 255, 1},
-        {45, 134, 40, 255, 1},
-        {39, 128, 34, 255, 1},
-        {32, 121, 27, 255, 1},
-        {25, 114, 20, 255, 1},
-        {47, 136, 42, 255, 1},
-        {60, 149, 55, 255, 1},
-        {43, 132, 38, 255, 1},
-        {35, 124, 30, 255, 1},
-        {29, 118, 24, 255, 1},
-        {24, 113, 20, 255, 1},
-        {30, 119, 26, 255, 1},
-        {33, 122, 29, 255, 1},
-        {33, 122, 28, 255, 1},
-        {36, 125, 31, 255, 1},
-        {27, 116, 22, 255, 1},
-        {19, 108, 14, 255, 1},
-        {46, 135, 41, 255, 1},
-        {62, 151, 57, 255, 1},
-        {48, 137, 43, 255, 1},
-        {40, 129, 35, 255, 1},
-        {46, 135, 41, 255, 1},
-        {49, 138, 44, 255, 1},
-        {47, 136, 42, 255, 1},
-        {49, 138, 44, 255, 1},
-        {28, 117, 23, 255, 1},
-        {11, 100, 6, 255, 1},
-        {39, 128, 34, 255, 1},
-        {55, 144, 50, 255, 1},
-        {56, 145, 51, 255, 1},
-        {61, 150, 56, 255, 1},
-        {44, 133, 39, 255, 1},
-        {33, 122, 28, 255, 1},
-        {28, 117, 23, 255, 1},
-        {21, 110, 16, 255, 1},
-        {37, 126, 32, 255, 1},
-        {50, 139, 45, 255, 1},
-        {39, 128, 34, 255, 1},
-        {33, 122, 28, 255, 1},
-        {32, 121, 27, 255, 2},
-        {34, 123, 29, 255, 1},
-        {36, 125, 31, 255, 1},
-        {31, 120, 26, 255, 1},
-        {28, 117, 23, 255, 1},
-        {26, 115, 21, 255, 1},
-        {27, 123, 22, 255, 1},
-        {39, 129, 36, 148, 1},
-        {43, 139, 40, 255, 1},
-        {48, 137, 45, 255, 1},
-        {51, 140, 47, 255, 1},
-        {41, 130, 36, 255, 1},
-        {36, 125, 31, 255, 1},
-        {42, 131, 37, 255, 1},
-        {44, 133, 39, 255, 1},
-        {52, 141, 47, 255, 1},
-        {57, 146, 52, 255, 1},
-        {41, 129, 36, 255, 1},
-        {32, 121, 27, 255, 1},
-        {34, 123, 29, 255, 1},
-        {33, 122, 28, 255, 1},
-        {39, 128, 34, 255, 1},
-        {41, 130, 36, 255, 1},
-        {44, 133, 39, 255, 1},
-        {47, 136, 42, 255, 1},
-        {33, 122, 28, 255, 1},
-        {25, 114, 20, 255, 1},
-        {38, 127, 33, 255, 1},
-        {44, 133, 39, 255, 1},
-        {41, 130, 36, 255, 1},
-        {40, 129, 35, 255, 1},
-        {41, 130, 36, 255, 1},
-        {43, 132, 38, 255, 1},
-        {33, 122, 28, 255, 1},
-        {27, 116, 22, 255, 1},
-        {31, 120, 26, 255, 1},
-        {33, 122, 28, 255, 1},
-        {32, 121, 27, 255, 2},
-        {29, 118, 24, 255, 1},
-        {27, 116, 22, 255, 1},
-        {32, 121, 27, 255, 1},
-        {36, 125, 31, 255, 1},
-        {32, 121, 27, 255, 1},
-        {29, 118, 24, 255, 1},
-        {37, 126, 32, 255, 1},
-        {42, 131, 37, 255, 1},
-        {41, 130, 36, 255, 2},
-        {38, 127, 33, 255, 1},
-        {35, 124, 30, 255, 1},
-        {40, 129, 35, 255, 1},
-        {44, 133, 39, 255, 1},
-        {36, 125, 31, 255, 1},
-        {31, 120, 26, 255, 1},
-        {28, 117, 23, 255, 1},
-        {26, 115, 21, 255, 1},
-        {24, 113, 19, 255, 1},
-        {21, 110, 16, 255, 1},
-        {31, 120, 26, 255, 1},
-        {36, 125, 31, 255, 1},
-        {44, 133, 39, 255, 1},
-        {50, 139, 45, 255, 1},
-        {45, 134, 40, 255, 1},
-        {42, 131, 37, 255, 1},
-        {38, 127, 33, 255, 1},
-        {34, 123, 29, 255, 1},
-        {40, 129, 35, 255, 1},
-        {43, 132, 38, 255, 1},
-        {41, 130, 36, 255, 1},
-        {43, 139, 37, 255, 1},
-        {58, 148, 55, 148, 1},
-        {63, 159, 60, 255, 1},
-        {50, 139, 47, 255, 1},
-        {47, 136, 42, 255, 1},
-        {37, 126, 32, 255, 1},
-        {31, 120, 26, 255, 1},
-        {47, 136, 42, 255, 1},
-        {54, 143, 49, 255, 1},
-        {55, 144, 50, 255, 1},
-        {57, 146, 52, 255, 1},
-        {47, 136, 42, 255, 1},
-        {42, 131, 37, 255, 1},
-        {38, 127, 33, 255, 1},
-        {37, 126, 32, 255, 1},
-        {36, 125, 31, 255, 1},
-        {34, 123, 29, 255, 1},
-        {38, 127, 33, 255, 1},
-        {39, 128, 34, 255, 1},
-        {25, 114, 20, 255, 1},
-        {15, 104, 10, 255, 1},
-        {42, 131, 37, 255, 1},
-        {57, 146, 52, 255, 1},
-        {37, 126, 32, 255, 1},
-        {27, 116, 22, 255, 1},
-        {41, 130, 36, 255, 1},
-        {48, 137, 43, 255, 1},
-        {35, 124, 30, 255, 1},
-        {27, 116, 22, 255, 1},
-        {31, 120, 26, 255, 1},
-        {33, 122, 28, 255, 1},
-        {29, 118, 24, 255, 1},
-        {27, 116, 22, 255, 1},
-        {29, 118, 24, 255, 1},
-        {31, 120, 26, 255, 1},
-        {24, 113, 19, 255, 1},
-        {21, 110, 16, 255, 1},
-        {22, 111, 17, 255, 1},
-        {21, 110, 16, 255, 1},
-        {30, 119, 25, 255, 1},
-        {37, 126, 32, 255, 1},
-        {38, 127, 33, 255, 1},
-        {37, 126, 32, 255, 1},
-        {45, 134, 40, 255, 1},
-        {50, 139, 45, 255, 1},
-        {41, 130, 36, 255, 1},
-        {37, 126, 32, 255, 1},
-        {23, 112, 18, 255, 1},
-        {12, 101, 7, 255, 1},
-        {18, 107, 13, 255, 1},
-        {20, 109, 15, 255, 1},
-        {19, 108, 14, 255, 1},
-        {18, 107, 13, 255, 1},
-        {27, 116, 22, 255, 1},
-        {30, 119, 25, 255, 1},
-        {47, 136, 42, 255, 1},
-        {61, 150, 56, 255, 1},
-        {53, 142, 48, 255, 1},
-        {50, 139, 45, 255, 1},
-        {41, 130, 36, 255, 1},
-        {32, 121, 27, 255, 1},
-        {46, 135, 41, 255, 1},
-        {55, 144, 50, 255, 1},
-        {51, 140, 46, 255, 1},
-        {54, 150, 48, 255, 1},
-        {56, 144, 51, 148, 1},
-        {61, 157, 56, 255, 1},
-        {45, 134, 40, 255, 1},
-        {41, 130, 36, 255, 1},
-        {31, 120, 26, 255, 1},
-        {24, 113, 19, 255, 1},
-        {42, 131, 37, 255, 1},
-        {48, 137, 43, 255, 1},
-        {56, 145, 51, 255, 1},
-        {62, 151, 57, 255, 1},
-        {44, 133, 39, 255, 1},
-        {36, 125, 31, 255, 1},
-        {32, 121, 26, 255, 1},
-        {28, 117, 24, 255, 1},
-        {30, 119, 27, 255, 2},
-        {41, 130, 37, 255, 1},
-        {47, 136, 43, 255, 1},
-        {33, 122, 30, 255, 1},
-        {26, 115, 22, 255, 1},
-        {37, 126, 33, 255, 1},
-        {42, 131, 39, 255, 1},
-        {40, 129, 36, 255, 1},
-        {40, 129, 35, 255, 1},
-        {41, 130, 36, 255, 2},
-        {40, 129, 35, 255, 1},
-        {38, 127, 33, 255, 1},
-        {43, 132, 38, 255, 1},
-        {46, 135, 41, 255, 1},
-        {40, 129, 35, 255, 1},
-        {34, 123, 29, 255, 1},
-        {45, 134, 40, 255, 1},
-        {53, 142, 48, 255, 1},
-        {32, 121, 27, 255, 1},
-        {20, 109, 15, 255, 1},
-        {30, 119, 25, 255, 1},
-        {32, 121, 27, 255, 1},
-        {51, 140, 46, 255, 1},
-        {63, 152, 58, 255, 1},
-        {47, 136, 42, 255, 1},
-        {38, 127, 33, 255, 1},
-        {37, 126, 32, 255, 1},
-        {36, 125, 31, 255, 1},
-        {44, 133, 39, 255, 1},
-        {50, 139, 45, 255, 1},
-        {35, 124, 30, 255, 1},
-        {26, 115, 21, 255, 1},
-        {23, 112, 18, 255, 1},
-        {19, 108, 14, 255, 1},
-        {31, 120, 26, 255, 1},
-        {39, 128, 34, 255, 1},
-        {35, 124, 30, 255, 1},
-        {33, 122, 28, 255, 1},
-        {37, 126, 32, 255, 1},
-        {39, 128, 34, 255, 1},
-        {43, 132, 38, 255, 1},
-        {45, 134, 40, 255, 1},
-        {48, 137, 43, 255, 1},
-        {50, 139, 45, 255, 1},
-        {45, 134, 40, 255, 1},
-        {42, 131, 37, 255, 1},
-        {45, 134, 40, 255, 1},
-        {52, 148, 47, 255, 1},
-        {58, 146, 53, 148, 1},
-        {63, 159, 57, 255, 1},
-        {42, 131, 37, 255, 1},
-        {35, 124, 30, 255, 1},
-        {26, 115, 21, 255, 1},
-        {19, 108, 14, 255, 1},
-        {40, 129, 35, 255, 1},
-        {47, 136, 42, 255, 1},
-        {59, 148, 54, 255, 1},
-        {67, 156, 62, 255, 1},
-        {44, 133, 39, 255, 1},
-        {33, 122, 28, 255, 1},
-        {27, 116, 22, 255, 1},
-        {23, 112, 18, 255, 1},
-        {25, 114, 22, 255, 1},
-        {24, 113, 21, 255, 1},
-        {42, 131, 39, 255, 1},
-        {53, 142, 50, 255, 1},
-        {37, 126, 34, 255, 1},
-        {30, 119, 28, 255, 1},
-        {33, 122, 31, 255, 1},
-        {34, 123, 30, 255, 1},
-        {44, 133, 38, 255, 1},
-        {50, 139, 45, 255, 1},
-        {42, 131, 37, 255, 1},
-        {38, 127, 33, 255, 1},
-        {44, 133, 39, 255, 1},
-        {46, 135, 41, 255, 1},
-        {52, 141, 47, 255, 1},
-        {55, 144, 50, 255, 1},
-        {47, 136, 42, 255, 1},
-        {39, 128, 34, 255, 1},
-        {55, 144, 50, 255, 1},
-        {68, 157, 63, 255, 1},
-        {37, 126, 32, 255, 1},
-        {17, 106, 12, 255, 1},
-        {33, 122, 28, 255, 1},
-        {39, 128, 34, 255, 1},
-        {64, 153, 59, 255, 1},
-        {81, 170, 76, 255, 1},
-        {53, 142, 48, 255, 1},
-        {37, 126, 32, 255, 1},
-        {34, 123, 29, 255, 1},
-        {28, 117, 23, 255, 1},
-        {47, 136, 42, 255, 1},
-        {58, 147, 53, 255, 1},
-        {42, 131, 37, 255, 1},
-        {33, 122, 28, 255, 1},
-        {26, 115, 21, 255, 1},
-        {17, 106, 12, 255, 1},
-        {39, 128, 34, 255, 1},
-        {54, 143, 49, 255, 1},
-        {42, 131, 37, 255, 1},
-        {36, 125, 31, 255, 1},
-        {31, 120, 26, 255, 1},
-        {25, 114, 20, 255, 1},
-        {37, 126, 32, 255, 1},
-        {42, 131, 37, 255, 1},
-        {52, 141, 47, 255, 1},
-        {62, 151, 57, 255, 1},
-        {46, 135, 41, 255, 1},
-        {35, 124, 30, 255, 1},
-        {43, 132, 38, 255, 1},
-        {52, 148, 47, 255, 1},
-        {43, 132, 37, 148, 1},
-        {46, 142, 41, 255, 1},
-        {47, 136, 43, 255, 1},
-        {50, 139, 45, 255, 1},
-        {34, 123, 29, 255, 1},
-        {26, 115, 21, 255, 1},
-        {35, 124, 30, 255, 1},
-        {38, 127, 33, 255, 1},
-        {42, 131, 37, 255, 1},
-        {46, 135, 41, 255, 1},
-        {32, 121, 27, 255, 1},
-        {25, 114, 20, 255, 1},
-        {37, 126, 32, 255, 1},
-        {42, 131, 37, 255, 1},
-        {42, 131, 39, 255, 1},
-        {43, 132, 40, 255, 1},
-        {36, 125, 33, 255, 1},
-        {32, 121, 30, 255, 1},
-        {40, 129, 37, 255, 1},
-        {43, 132, 40, 255, 1},
-        {44, 133, 41, 255, 1},
-        {45, 134, 42, 255, 1},
-        {31, 120, 26, 255, 1},
-        {23, 112, 18, 255, 1},
-        {32, 121, 28, 255, 1},
-        {37, 126, 32, 255, 1},
-        {35, 124, 30, 255, 1},
-        {34, 123, 29, 255, 3},
-        {33, 122, 28, 255, 1},
-        {31, 120, 26, 255, 1},
-        {43, 132, 38, 255, 1},
-        {52, 141, 47, 255, 1},
-        {34, 123, 29, 255, 1},
-        {22, 111, 17, 255, 1},
-        {32, 121, 27, 255, 1},
-        {37, 126, 32, 255, 1},
-        {45, 134, 40, 255, 1},
-        {51, 140, 46, 255, 1},
-        {42, 131, 37, 255, 1},
-        {38, 127, 33, 255, 1},
-        {36, 125, 31, 255, 1},
-        {35, 124, 30, 255, 1},
-        {40, 129, 35, 255, 1},
-        {45, 134, 40, 255, 1},
-        {37, 126, 32, 255, 1},
-        {33, 122, 28, 255, 2},
-        {32, 121, 27, 255, 1},
-        {33, 122, 28, 255, 1},
-        {34, 123, 29, 255, 1},
-        {30, 119, 25, 255, 1},
-        {28, 117, 23, 255, 1},
-        {35, 124, 30, 255, 1},
-        {39, 128, 34, 255, 1},
-        {41, 130, 36, 255, 1},
-        {42, 131, 37, 255, 1},
-        {46, 135, 41, 255, 1},
-        {49, 138, 44, 255, 1},
-        {43, 132, 38, 255, 1},
-        {39, 128, 34, 255, 1},
-        {47, 136, 42, 255, 1},
-        {57, 153, 52, 255, 1},
-        {32, 122, 31, 148, 1},
-        {34, 130, 30, 255, 1},
-        {50, 139, 47, 255, 1},
-        {60, 149, 55, 255, 1},
-        {40, 129, 35, 255, 1},
-        {30, 119, 25, 255, 1},
-        {31, 120, 26, 255, 1},
-        {30, 119, 25, 255, 2},
-        {31, 120, 26, 255, 1},
-        {23, 112, 18, 255, 1},
-        {19, 108, 14, 255, 1},
-        {43, 132, 38, 255, 1},
-        {54, 143, 49, 255, 1},
-        {53, 142, 50, 255, 1},
-        {58, 147, 55, 255, 1},
-        {32, 121, 30, 255, 1},
-        {17, 106, 15, 255, 1},
-        {41, 130, 39, 255, 1},
-        {53, 142, 50, 255, 1},
-        {51, 140, 48, 255, 1},
-        {54, 143, 51, 255, 1},
-        {22, 111, 19, 255, 1},
-        {5, 94, 2, 255, 1},
-        {26, 115, 23, 255, 1},
-        {38, 127, 33, 255, 1},
-        {30, 119, 25, 255, 1},
-        {26, 115, 21, 255, 1},
-        {23, 112, 18, 255, 1},
-        {20, 109, 15, 255, 1},
-        {24, 113, 19, 255, 1},
-        {26, 115, 21, 255, 1},
-        {37, 126, 32, 255, 1},
-        {44, 133, 39, 255, 1},
-        {33, 122, 28, 255, 1},
-        {24, 113, 19, 255, 1},
-        {31, 120, 26, 255, 1},
-        {35, 124, 30, 255, 1},
-        {33, 122, 28, 255, 1},
-        {32, 121, 27, 255, 1},
-        {37, 126, 32, 255, 1},
-        {40, 129, 35, 255, 1},
-        {38, 127, 33, 255, 2},
-        {37, 126, 32, 255, 1},
-        {38, 127, 33, 255, 1},
-        {36, 125, 31, 255, 1},
-        {34, 123, 29, 255, 1},
-        {37, 126, 32, 255, 1},
-        {42, 131, 37, 255, 1},
-        {30, 119, 25, 255, 1},
-        {21, 110, 16, 255, 1},
-        {24, 113, 19, 255, 1},
-        {25, 114, 20, 255, 1},
-        {38, 127, 33, 255, 1},
-        {47, 136, 42, 255, 1},
-        {43, 132, 38, 255, 1},
-        {42, 131, 37, 255, 1},
-        {44, 133, 39, 255, 2},
-        {43, 132, 38, 255, 1},
-        {40, 129, 35, 255, 1},
-        {50, 139, 45, 255, 1},
-        {62, 158, 57, 255, 1},
-        {39, 129, 36, 148, 1},
-        {42, 138, 39, 255, 1},
-        {47, 136, 44, 255, 1},
-        {51, 140, 46, 255, 1},
-        {39, 128, 34, 255, 1},
-        {34, 123, 29, 255, 1},
-        {45, 134, 40, 255, 1},
-        {49, 138, 44, 255, 1},
-        {40, 129, 35, 255, 1},
-        {36, 125, 31, 255, 1},
-        {28, 117, 23, 255, 1},
-        {21, 110, 16, 255, 1},
-        {41, 130, 36, 255, 1},
-        {51, 140, 46, 255, 1},
-        {37, 126, 35, 255, 1},
-        {31, 120, 29, 255, 1},
-        {35, 124, 31, 255, 1},
-        {36, 125, 31, 255, 1},
-        {42, 132, 37, 255, 1},
-        {47, 136, 43, 255, 1},
-        {41, 130, 39, 255, 1},
-        {39, 128, 37, 255, 1},
-        {29, 118, 26, 255, 1},
-        {22, 111, 20, 255, 1},
-        {25, 114, 22, 255, 1},
-        {27, 116, 22, 255, 1},
-        {31, 120, 26, 255, 1},
-        {34, 123, 29, 255, 1},
-        {33, 122, 28, 255, 1},
-        {32, 121, 27, 255, 1},
-        {35, 124, 30, 255, 1},
-        {38, 127, 33, 255, 1},
-        {39, 128, 34, 255, 1},
-        {40, 129, 35, 255, 1},
-        {33, 122, 28, 255, 1},
-        {27, 116, 22, 255, 1},
-        {41, 130, 36, 255, 1},
-        {52, 141, 47, 255, 1},
-        {39, 128, 34, 255, 1},
-        {34, 123, 29, 255, 1},
-        {30, 119, 25, 255, 1},
-        {25, 114, 20, 255, 1},
-        {30, 119, 25, 255, 1},
-        {34, 123, 29, 255, 1},
-        {31, 120, 26, 255, 1},
-        {29, 118, 24, 255, 1},
-        {32, 121, 27, 255, 1},
-        {33, 122, 28, 255, 2},
-        {32, 121, 27, 255, 1},
-        {33, 122, 28, 255, 1},
-        {34, 123, 29, 255, 1},
-        {22, 111, 17, 255, 1},
-        {12, 101, 7, 255, 1},
-        {33, 122, 28, 255, 1},
-        {46, 135, 41, 255, 1},
-        {43, 132, 38, 255, 1},
-        {44, 133, 39, 255, 1},
-        {33, 122, 28, 255, 1},
-        {24, 113, 19, 255, 1},
-        {34, 123, 29, 255, 1},
-        {40, 129, 35, 255, 1},
-        {43, 132, 38, 255, 1},
-        {49, 145, 44, 255, 1},
-        {43, 132, 41, 148, 1},
-        {47, 144, 44, 255, 1},
-        {46, 135, 43, 255, 1},
-        {47, 136, 43, 255, 1},
-        {40, 129, 35, 255, 1},
-        {36, 125, 31, 255, 1},
-        {54, 143, 49, 255, 1},
-        {63, 152, 58, 255, 1},
-        {45, 134, 40, 255, 1},
-        {39, 128, 34, 255, 1},
-        {29, 118, 24, 255, 1},
-        {21, 110, 16, 255, 1},
-        {41, 130, 36, 255, 1},
-        {52, 141, 48, 255, 1},
-        {27, 116, 23, 255, 1},
-        {12, 101, 9, 255, 1},
-        {36, 125, 31, 255, 1},
-        {48, 138, 42, 255, 1},
-        {44, 134, 38, 255, 1},
-        {45, 134, 41, 255, 1},
-        {35, 124, 32, 255, 1},
-        {29, 118, 26, 255, 1},
-        {31, 120, 27, 255, 1},
-        {32, 121, 28, 255, 1},
-        {23, 112, 19, 255, 1},
-        {16, 105, 11, 255, 1},
-        {31, 120, 26, 255, 1},
-        {39, 128, 34, 255, 1},
-        {38, 127, 33, 255, 2},
-        {41, 130, 36, 255, 1},
-        {44, 133, 39, 255, 1},
-        {40, 129, 35, 255, 1},
-        {38, 127, 33, 255, 1},
-        {31, 120, 26, 255, 1},
-        {25, 114, 20, 255, 1},
-        {49, 138, 44, 255, 1},
-        {66, 155, 61, 255, 1},
-        {46, 135, 41, 255, 1},
-        {36, 125, 31, 255, 1},
-        {24, 113, 19, 255, 1},
-        {15, 104, 10, 255, 1},
-        {25, 114, 20, 255, 1},
-        {31, 120, 26, 255, 1},
-        {24, 113, 19, 255, 1},
-        {21, 110, 16, 255, 1},
-        {28, 117, 23, 255, 1},
-        {32, 121, 27, 255, 1},
-        {29, 118, 24, 255, 1},
-        {27, 116, 22, 255, 1},
-        {34, 123, 29, 255, 1},
-        {42, 131, 37, 255, 1},
-        {20, 109, 15, 255, 1},
-        {1, 90, 0, 255, 1},
-        {30, 119, 25, 255, 1},
-        {49, 138, 44, 255, 1},
-        {44, 133, 39, 255, 1},
-        {45, 134, 40, 255, 1},
-        {24, 113, 19, 255, 1},
-        {5, 94, 0, 255, 1},
-        {27, 116, 22, 255, 1},
-        {42, 131, 37, 255, 1},
-        {38, 127, 33, 255, 1},
-        {40, 136, 35, 255, 1},
-        {41, 130, 39, 148, 1},
-        {45, 141, 42, 255, 1},
-        {36, 125, 33, 255, 1},
-        {34, 123, 29, 255, 1},
-        {43, 132, 38, 255, 1},
-        {47, 136, 42, 255, 1},
-        {52, 141, 47, 255, 1},
-        {56, 145, 51, 255, 1},
-        {44, 133, 39, 255, 1},
-        {39, 128, 34, 255, 1},
-        {32, 121, 27, 255, 1},
-        {27, 116, 22, 255, 1},
-        {36, 125, 31, 255, 1},
-        {41, 130, 36, 255, 1},
-        {32, 121, 27, 255, 1},
-        {28, 117, 22, 255, 1},
-        {38, 127, 33, 255, 1},
-        {43, 132, 38, 255, 1},
-        {33, 122, 28, 255, 1},
-        {29, 118, 24, 255, 1},
-        {33, 122, 28, 255, 1},
-        {35, 124, 29, 255, 1},
-        {32, 121, 26, 255, 1},
-        {30, 119, 25, 255, 1},
-        {31, 120, 26, 255, 1},
-        {30, 119, 25, 255, 1},
-        {31, 120, 26, 255, 2},
-        {41, 130, 36, 255, 1},
-        {47, 136, 42, 255, 1},
-        {46, 135, 41, 255, 1},
-        {48, 137, 43, 255, 1},
-        {33, 122, 28, 255, 1},
-        {21, 110, 16, 255, 1},
-        {47, 136, 42, 255, 1},
-        {63, 152, 58, 255, 1},
-        {47, 136, 42, 255, 1},
-        {39, 128, 34, 255, 1},
-        {29, 118, 24, 255, 1},
-        {22, 111, 17, 255, 2},
-        {20, 109, 15, 255, 1},
-        {33, 122, 28, 255, 1},
-        {41, 130, 36, 255, 1},
-        {37, 126, 32, 255, 1},
-        {34, 123, 29, 255, 1},
-        {38, 127, 33, 255, 1},
-        {40, 129, 35, 255, 1},
-        {35, 124, 30, 255, 1},
-        {32, 121, 27, 255, 1},
-        {31, 120, 26, 255, 2},
-        {26, 115, 21, 255, 1},
-        {21, 110, 16, 255, 1},
-        {25, 114, 20, 255, 1},
-        {26, 115, 21, 255, 1},
-        {37, 126, 32, 255, 1},
-        {44, 133, 39, 255, 1},
-        {42, 131, 37, 255, 2},
-        {39, 128, 34, 255, 1},
-        {36, 125, 31, 255, 1},
-        {41, 130, 36, 255, 1},
-        {49, 145, 44, 255, 1},
-        {41, 130, 37, 148, 1},
-        {45, 141, 42, 255, 1},
-        {30, 119, 28, 255, 1},
-        {25, 114, 20, 255, 1},
-        {47, 136, 42, 255, 1},
-        {57, 146, 52, 255, 1},
-        {53, 142, 48, 255, 1},
-        {52, 141, 47, 255, 1},
-        {44, 133, 39, 255, 1},
-        {41, 130, 36, 255, 1},
-        {35, 124, 30, 255, 1},
-        {31, 120, 26, 255, 1},
-        {32, 121, 27, 255, 1},
-        {33, 122, 28, 255, 1},
-        {36, 125, 31, 255, 1},
-        {37, 126, 32, 255, 1},
-        {39, 128, 34, 255, 1},
-        {41, 130, 36, 255, 1},
-        {26, 115, 21, 255, 1},
-        {17, 106, 12, 255, 1},
-        {31, 120, 26, 255, 1},
-        {37, 126, 32, 255, 1},
-        {31, 120, 26, 255, 1},
-        {28, 117, 23, 255, 1},
-        {35, 124, 30, 255, 1},
-        {37, 126, 32, 255, 1},
-        {29, 118, 24, 255, 1},
-        {23, 112, 18, 255, 1},
-        {43, 132, 38, 255, 1},
-        {55, 144, 50, 255, 1},
-        {50, 139, 45, 255, 1},
-        {51, 140, 46, 255, 1},
-        {27, 116, 22, 255, 1},
-        {8, 97, 3, 255, 1},
-        {58, 147, 53, 255, 1},
-        {90, 179, 85, 255, 1},
-        {47, 136, 42, 255, 1},
-        {21, 110, 16, 255, 1},
-        {17, 106, 12, 255, 1},
-        {11, 100, 6, 255, 1},
-        {19, 108, 14, 255, 1},
-        {21, 110, 16, 255, 1},
-        {37, 126, 32, 255, 1},
-        {49, 138, 44, 255, 1},
-        {45, 134, 40, 255, 1},
-        {43, 132, 38, 255, 1},
-        {44, 133, 39, 255, 2},
-        {38, 127, 33, 255, 1},
-        {35, 124, 30, 255, 1},
-        {28, 117, 23, 255, 1},
-        {22, 111, 17, 255, 1},
-        {27, 116, 22, 255, 1},
-        {32, 121, 27, 255, 1},
-        {19, 108, 14, 255, 1},
-        {7, 96, 2, 255, 1},
-        {30, 119, 25, 255, 1},
-        {45, 134, 40, 255, 1},
-        {54, 143, 49, 255, 1},
-        {65, 154, 60, 255, 1},
-        {47, 136, 42, 255, 1},
-        {33, 122, 28, 255, 1},
-        {45, 134, 40, 255, 1},
-        {57, 153, 51, 255, 1},
-        {37, 127, 32, 148, 1},
-        {42, 138, 37, 255, 1},
-        {27, 116, 23, 255, 1},
-        {20, 109, 15, 255, 1},
-        {33, 122, 28, 255, 1},
-        {38, 127, 33, 255, 1},
-        {48, 137, 43, 255, 1},
-        {52, 141, 47, 255, 1},
-        {38, 127, 33, 255, 1},
-        {31, 120, 26, 255, 1},
-        {32, 121, 27, 255, 2},
-        {33, 122, 28, 255, 1},
-        {34, 123, 29, 255, 1},
-        {31, 120, 26, 255, 1},
-        {28, 117, 23, 255, 1},
-        {42, 131, 37, 255, 1},
-        {51, 140, 46, 255, 1},
-        {37, 126, 32, 255, 1},
-        {31, 120, 26, 255, 1},
-        {30, 119, 25, 255, 1},
-        {28, 117, 23, 255, 1},
-        {38, 127, 33, 255, 1},
-        {43, 132, 38, 255, 1},
-        {44, 133, 39, 255, 1},
-        {45, 134, 40, 255, 1},
-        {43, 132, 38, 255, 1},
-        {41, 130, 36, 255, 1},
-        {47, 136, 42, 255, 1},
-        {50, 139, 45, 255, 1},
-        {44, 133, 39, 255, 1},
-        {42, 131, 37, 255, 1},
-        {35, 124, 30, 255, 1},
-        {29, 118, 24, 255, 1},
-        {45, 134, 40, 255, 1},
-        {55, 144, 50, 255, 1},
-        {40, 129, 35, 255, 1},
-        {32, 121, 27, 255, 1},
-        {29, 118, 24, 255, 1},
-        {25, 114, 20, 255, 1},
-        {29, 118, 24, 255, 1},
-        {30, 119, 25, 255, 1},
-        {35, 124, 30, 255, 1},
-        {40, 129, 35, 255, 1},
-        {36, 125, 31, 255, 1},
-        {32, 121, 27, 255, 1},
-        {43, 132, 38, 255, 1},
-        {52, 141, 47, 255, 1},
-        {37, 126, 32, 255, 1},
-        {27, 116, 22, 255, 1},
-        {37, 126, 32, 255, 1},
-        {42, 131, 37, 255, 1},
-        {40, 129, 35, 255, 1},
-        {38, 127, 33, 255, 1},
-        {43, 132, 38, 255, 1},
-        {47, 136, 42, 255, 1},
-        {43, 132, 38, 255, 1},
-        {39, 128, 34, 255, 1},
-        {48, 137, 43, 255, 1},
-        {58, 147, 53, 255, 1},
-        {36, 125, 31, 255, 1},
-        {19, 108, 14, 255, 1},
-        {28, 117, 23, 255, 1},
-        {37, 133, 31, 255, 1},
-        {34, 124, 29, 148, 1},
-        {38, 134, 32, 255, 1},
-        {22, 111, 17, 255, 1},
-        {15, 104, 10, 255, 1},
-        {24, 113, 19, 255, 1},
-        {27, 116, 22, 255, 1},
-        {44, 133, 39, 255, 1},
-        {54, 143, 49, 255, 1},
-        {32, 121, 27, 255, 1},
-        {23, 112, 18, 255, 1},
-        {30, 119, 25, 255, 1},
-        {32, 121, 27, 255, 1},
-        {33, 122, 28, 255, 1},
-        {34, 123, 29, 255, 1},
-        {27, 116, 22, 255, 1},
-        {22, 111, 17, 255, 1},
-        {45, 134, 40, 255, 1},
-        {59, 148, 54, 255, 1},
-        {45, 134, 40, 255, 1},
-        {39, 128, 34, 255, 1},
-        {28, 117, 23, 255, 1},
-        {19, 108, 14, 255, 1},
-        {43, 132, 38, 255, 1},
-        {54, 143, 49, 255, 1},
-        {52, 141, 47, 255, 1},
-        {51, 140, 46, 255, 1},
-        {53, 142, 48, 255, 1},
-        {54, 143, 49, 255, 1},
-        {50, 139, 45, 255, 1},
-        {48, 137, 43, 255, 1},
-        {42, 131, 37, 255, 1},
-        {37, 126, 32, 255, 1},
-        {41, 130, 36, 255, 1},
-        {43, 132, 38, 255, 1},
-        {37, 126, 32, 255, 1},
-        {34, 123, 29, 255, 1},
-        {35, 124, 30, 255, 3},
-        {34, 123, 29, 255, 1},
-        {35, 124, 30, 255, 1},
-        {34, 123, 29, 255, 3},
-        {30, 119, 25, 255, 1},
-        {25, 114, 20, 255, 1},
-        {43, 132, 38, 255, 1},
-        {59, 148, 54, 255, 1},
-        {37, 126, 32, 255, 1},
-        {20, 109, 15, 255, 1},
-        {42, 131, 37, 255, 1},
-        {55, 144, 50, 255, 1},
-        {49, 138, 44, 255, 1},
-        {44, 133, 39, 255, 1},
-        {62, 151, 57, 255, 1},
-        {77, 166, 72, 255, 1},
-        {52, 141, 47, 255, 1},
-        {34, 123, 29, 255, 1},
-        {46, 135, 41, 255, 1},
-        {55, 144, 50, 255, 1},
-        {27, 116, 22, 255, 1},
-        {5, 94, 0, 255, 1},
-        {16, 105, 11, 255, 1},
-        {24, 120, 18, 255, 1},
-        {44, 132, 39, 148, 1},
-        {48, 144, 42, 255, 1},
-        {36, 125, 31, 255, 1},
-        {33, 122, 28, 255, 1},
-        {28, 117, 23, 255, 1},
-        {25, 114, 20, 255, 1},
-        {36, 125, 31, 255, 1},
-        {41, 130, 36, 255, 1},
-        {39, 128, 34, 255, 1},
-        {38, 127, 33, 255, 1},
-        {36, 125, 31, 255, 1},
-        {35, 124, 30, 255, 1},
-        {37, 126, 32, 255, 1},
-        {38, 127, 33, 255, 1},
-        {32, 121, 27, 255, 1},
-        {29, 118, 24, 255, 1},
-        {44, 133, 39, 255, 1},
-        {53, 142, 48, 255, 1},
-        {42, 131, 37, 255, 1},
-        {38, 127, 33, 255, 2},
-        {37, 126, 32, 255, 1},
-        {43, 132, 38, 255, 1},
-        {45, 134, 40, 255, 1},
-        {51, 140, 46, 255, 1},
-        {55, 144, 50, 255, 1},
-        {50, 139, 45, 255, 1},
-        {47, 136, 42, 255, 1},
-        {43, 132, 38, 255, 1},
-        {41, 130, 36, 255, 1},
-        {34, 123, 29, 255, 1},
-        {30, 119, 25, 255, 1},
-        {32, 121, 27, 255, 2},
-        {39, 128, 34, 255, 1},
-        {43, 132, 38, 255, 1},
-        {46, 135, 41, 255, 1},
-        {50, 139, 45, 255, 1},
-        {36, 125, 31, 255, 1},
-        {27, 116, 22, 255, 1},
-        {38, 127, 33, 255, 1},
-        {45, 134, 40, 255, 1},
-        {43, 132, 38, 255, 2},
-        {35, 124, 30, 255, 1},
-        {29, 118, 24, 255, 1},
-        {41, 130, 36, 255, 1},
-        {51, 140, 46, 255, 1},
-        {40, 129, 35, 255, 1},
-        {31, 120, 26, 255, 1},
-        {45, 134, 40, 255, 1},
-        {54, 143, 49, 255, 1},
-        {49, 138, 44, 255, 1},
-        {46, 135, 41, 255, 1},
-        {43, 132, 38, 255, 1},
-        {42, 131, 37, 255, 1},
-        {41, 130, 36, 255, 1},
-        {39, 128, 34, 255, 1},
-        {47, 136, 42, 255, 1},
-        {55, 144, 50, 255, 1},
-        {37, 126, 32, 255, 1},
-        {25, 114, 20, 255, 2},
-        {25, 121, 20, 255, 1},
-        {49, 137, 44, 148, 1},
-        {54, 150, 49, 255, 1},
-        {47, 136, 42, 255, 2},
-        {30, 119, 25, 255, 1},
-        {21, 110, 16, 255, 1},
-        {30, 119, 25, 255, 1},
-        {32, 121, 27, 255, 1},
-        {43, 132, 38, 255, 1},
-        {49, 138, 44, 255, 1},
-        {40, 129, 35, 255, 1},
-        {35, 124, 30, 255, 1},
-        {39, 128, 34, 255, 1},
-        {40, 129, 35, 255, 1},
-        {37, 126, 32, 255, 1},
-        {33, 122, 28, 255, 1},
-        {43, 132, 38, 255, 1},
-        {49, 138, 44, 255, 1},
-        {42, 131, 37, 255, 1},
-        {38, 127, 33, 255, 1},
-        {46, 135, 41, 255, 1},
-        {51, 140, 46, 255, 1},
-        {43, 132, 38, 255, 1},
-        {38, 127, 33, 255, 1},
-        {52, 141, 47, 255, 1},
-        {60, 149, 55, 255, 1},
-        {48, 137, 43, 255, 1},
-        {42, 131, 37, 255, 1},
-        {39, 128, 34, 255, 1},
-        {37, 126, 32, 255, 1},
-        {28, 117, 23, 255, 1},
-        {21, 110, 16, 255, 1},
-        {24, 113, 19, 255, 2},
-        {39, 128, 34, 255, 1},
-        {48, 137, 43, 255, 1},
-        {56, 145, 51, 255, 1},
-        {64, 153, 59, 255, 1},
-        {39, 128, 34, 255, 1},
-        {22, 111, 17, 255, 1},
-        {42, 131, 37, 255, 1},
-        {54, 143, 49, 255, 1},
-        {50, 139, 45, 255, 2},
-        {39, 128, 34, 255, 1},
-        {31, 120, 26, 255, 1},
-        {40, 129, 35, 255, 1},
-        {44, 133, 39, 255, 1},
-        {42, 131, 37, 255, 1},
-        {41, 130, 36, 255, 1},
-        {50, 139, 45, 255, 1},
-        {56, 145, 51, 255, 1},
-        {51, 140, 46, 255, 1},
-        {49, 138, 44, 255, 1},
-        {32, 121, 27, 255, 1},
-        {17, 106, 12, 255, 1},
-        {33, 122, 28, 255, 1},
-        {43, 132, 38, 255, 1},
-        {48, 137, 43, 255, 1},
-        {56, 145, 51, 255, 1},
-        {44, 133, 39, 255, 1},
-        {37, 126, 32, 255, 1},
-        {29, 118, 24, 255, 1},
-        {24, 120, 18, 255, 1},
-        {51, 141, 46, 148, 1},
-        {56, 153, 51, 255, 1},
-        {46, 135, 41, 255, 1},
-        {44, 133, 39, 255, 1},
-        {37, 126, 32, 255, 1},
-        {33, 122, 28, 255, 1},
-        {30, 119, 25, 255, 1},
-        {28, 117, 23, 255, 1},
-        {32, 121, 27, 255, 1},
-        {34, 123, 29, 255, 1},
-        {48, 137, 43, 255, 1},
-        {56, 145, 51, 255, 1},
-        {46, 135, 41, 255, 1},
-        {43, 132, 38, 255, 1},
-        {36, 125, 31, 255, 1},
-        {31, 120, 26, 255, 1},
-        {45, 134, 40, 255, 1},
-        {52, 141, 47, 255, 1},
-        {43, 132, 38, 255, 1},
-        {38, 127, 33, 255, 1},
-        {40, 129, 35, 255, 1},
-        {41, 130, 36, 255, 1},
-        {44, 133, 39, 255, 1},
-        {47, 136, 42, 255, 1},
-        {45, 134, 40, 255, 1},
-        {43, 132, 38, 255, 1},
-        {52, 141, 47, 255, 1},
-        {59, 148, 54, 255, 1},
-        {37, 126, 32, 255, 1},
-        {23, 112, 18, 255, 1},
-        {38, 127, 33, 255, 1},
-        {46, 135, 41, 255, 1},
-        {41, 130, 36, 255, 1},
-        {39, 128, 34, 255, 1},
-        {43, 132, 38, 255, 1},
-        {45, 134, 40, 255, 1},
-        {41, 130, 36, 255, 2},
-        {33, 122, 28, 255, 1},
-        {26, 115, 21, 255, 1},
-        {39, 128, 34, 255, 1},
-        {48, 137, 43, 255, 1},
-        {42, 131, 37, 255, 1},
-        {39, 128, 34, 255, 2},
-        {37, 126, 32, 255, 1},
-        {47, 136, 42, 255, 1},
-        {55, 144, 50, 255, 1},
-        {43, 132, 38, 255, 1},
-        {34, 123, 29, 255, 1},
-        {38, 127, 33, 255, 1},
-        {40, 129, 35, 255, 3},
-        {37, 126, 32, 255, 1},
-        {34, 123, 29, 255, 1},
-        {32, 121, 27, 255, 1},
-        {30, 119, 25, 255, 1},
-        {36, 125, 31, 255, 1},
-        {40, 129, 35, 255, 1},
-        {45, 134, 40, 255, 1},
-        {51, 140, 46, 255, 1},
-        {39, 128, 34, 255, 1},
-        {34, 130, 28, 255, 1},
-        {56, 146, 51, 148, 1},
-        {62, 158, 56, 255, 1},
-        {48, 137, 43, 255, 1},
-        {43, 132, 38, 255, 1},
-        {41, 130, 36, 255, 1},
-        {42, 131, 37, 255, 1},
-        {28, 117, 23, 255, 1},
-        {21, 110, 16, 255, 1},
-        {24, 113, 19, 255, 1},
-        {22, 111, 17, 255, 1},
-        {55, 144, 50, 255, 1},
-        {74, 163, 69, 255, 1},
-        {53, 142, 48, 255, 1},
-        {45, 134, 40, 255, 1},
-        {36, 125, 31, 255, 1},
-        {30, 119, 25, 255, 1},
-        {45, 134, 40, 255, 1},
-        {53, 142, 48, 255, 1},
-        {42, 131, 37, 255, 1},
-        {37, 126, 32, 255, 2},
-        {36, 125, 31, 255, 1},
-        {47, 136, 42, 255, 1},
-        {53, 142, 48, 255, 1},
-        {40, 129, 35, 255, 1},
-        {31, 120, 26, 255, 1},
-        {55, 144, 50, 255, 1},
-        {72, 161, 67, 255, 1},
-        {34, 123, 29, 255, 1},
-        {12, 101, 7, 255, 1},
-        {45, 134, 40, 255, 1},
-        {63, 152, 58, 255, 1},
-        {53, 142, 48, 255, 1},
-        {50, 139, 45, 255, 1},
-        {46, 135, 41, 255, 1},
-        {44, 133, 39, 255, 1},
-        {33, 122, 28, 255, 1},
-        {26, 115, 21, 255, 1},
-        {28, 117, 23, 255, 1},
-        {27, 116, 22, 255, 1},
-        {36, 125, 31, 255, 1},
-        {42, 131, 37, 255, 1},
-        {36, 125, 31, 255, 1},
-        {32, 121, 27, 255, 1},
-        {40, 129, 35, 255, 1},
-        {42, 131, 37, 255, 1},
-        {54, 143, 49, 255, 1},
-        {65, 154, 60, 255, 1},
-        {46, 135, 41, 255, 1},
-        {32, 121, 27, 255, 1},
-        {31, 120, 26, 255, 1},
-        {28, 117, 23, 255, 1},
-        {31, 120, 26, 255, 1},
-        {32, 121, 27, 255, 1},
-        {40, 129, 35, 255, 1},
-        {47, 136, 42, 255, 1},
-        {31, 120, 26, 255, 1},
-        {20, 109, 15, 255, 1},
-        {27, 116, 22, 255, 1},
-        {29, 118, 24, 255, 1},
-        {48, 137, 43, 255, 1},
-        {63, 152, 58, 255, 1},
-        {48, 137, 43, 255, 1},
-        {40, 136, 35, 255, 1},
-        {34, 124, 29, 148, 1},
-        {38, 134, 32, 255, 1},
-        {43, 132, 38, 255, 1},
-        {47, 136, 42, 255, 1},
-        {38, 127, 33, 255, 1},
-        {35, 124, 30, 255, 1},
-        {39, 128, 34, 255, 1},
-        {41, 130, 36, 255, 1},
-        {38, 127, 33, 255, 1},
-        {36, 125, 31, 255, 1},
-        {51, 140, 46, 255, 1},
-        {59, 148, 54, 255, 1},
-        {45, 134, 40, 255, 1},
-        {38, 127, 33, 255, 1},
-        {33, 122, 28, 255, 1},
-        {28, 117, 23, 255, 1},
-        {52, 141, 47, 255, 1},
-        {66, 155, 61, 255, 1},
-        {47, 136, 42, 255, 1},
-        {38, 127, 33, 255, 2},
-        {36, 125, 31, 255, 1},
-        {40, 129, 35, 255, 1},
-        {42, 131, 37, 255, 1},
-        {43, 132, 38, 255, 2},
-        {54, 143, 49, 255, 1},
-        {63, 152, 58, 255, 1},
-        {43, 132, 38, 255, 1},
-        {33, 122, 28, 255, 1},
-        {44, 133, 39, 255, 1},
-        {51, 140, 46, 255, 1},
-        {41, 130, 36, 255, 1},
-        {36, 125, 31, 255, 1},
-        {39, 128, 34, 255, 1},
-        {42, 131, 37, 255, 1},
-        {32, 121, 27, 255, 1},
-        {24, 113, 19, 255, 1},
-        {34, 123, 29, 255, 1},
-        {38, 127, 33, 255, 1},
-        {46, 135, 41, 255, 1},
-        {53, 142, 48, 255, 1},
-        {39, 128, 34, 255, 1},
-        {29, 118, 24, 255, 1},
-        {37, 126, 32, 255, 1},
-        {43, 132, 38, 255, 1},
-        {35, 124, 30, 255, 1},
-        {31, 120, 26, 255, 1},
-        {24, 113, 19, 255, 1},
-        {17, 106, 12, 255, 1},
-        {31, 120, 26, 255, 1},
-        {41, 130, 36, 255, 1},
-        {39, 128, 34, 255, 2},
-        {30, 119, 25, 255, 1},
-        {23, 112, 18, 255, 1},
-        {25, 114, 20, 255, 2},
-        {29, 118, 24, 255, 1},
-        {30, 119, 25, 255, 1},
-        {42, 131, 37, 255, 1},
-        {52, 141, 47, 255, 1},
-        {46, 135, 41, 255, 1},
-        {45, 141, 40, 255, 1},
-        {17, 105, 12, 148, 1},
-        {17, 114, 12, 255, 1},
-        {38, 127, 33, 255, 1},
-        {49, 138, 44, 255, 1},
-        {37, 126, 32, 255, 1},
-        {30, 119, 25, 255, 1},
-        {48, 137, 43, 255, 1},
-        {56, 145, 51, 255, 1},
-        {48, 137, 43, 255, 1},
-        {45, 134, 40, 255, 1},
-        {51, 140, 46, 255, 1},
-        {54, 143, 49, 255, 1},
-        {40, 129, 35, 255, 1},
-        {33, 122, 28, 255, 1},
-        {31, 120, 26, 255, 1},
-        {25, 114, 20, 255, 1},
-        {59, 148, 54, 255, 1},
-        {80, 169, 75, 255, 1},
-        {52, 141, 47, 255, 1},
-        {40, 129, 35, 255, 1},
-        {36, 125, 31, 255, 1},
-        {32, 121, 27, 255, 1},
-        {35, 124, 30, 255, 2},
-        {46, 135, 41, 255, 1},
-        {51, 140, 46, 255, 1},
-        {55, 144, 50, 255, 1},
-        {57, 146, 52, 255, 1},
-        {51, 140, 46, 255, 1},
-        {48, 137, 43, 255, 1},
-        {45, 134, 40, 255, 1},
-        {43, 132, 38, 255, 1},
-        {33, 122, 28, 255, 1},
-        {25, 114, 20, 255, 1},
-        {34, 123, 29, 255, 1},
-        {39, 128, 34, 255, 1},
-        {28, 117, 23, 255, 1},
-        {19, 108, 14, 255, 1},
-        {37, 126, 32, 255, 1},
-        {47, 136, 42, 255, 1},
-        {54, 143, 49, 255, 1},
-        {63, 152, 58, 255, 1},
-        {41, 130, 36, 255, 1},
-        {24, 113, 19, 255, 1},
-        {36, 125, 31, 255, 1},
-        {45, 134, 40, 255, 1},
-        {20, 109, 15, 255, 1},
-        {4, 93, 0, 255, 1},
-        {6, 95, 1, 255, 1},
-        {2, 91, 0, 255, 1},
-        {30, 119, 25, 255, 1},
-        {50, 139, 45, 255, 1},
-        {44, 133, 39, 255, 1},
-        {45, 134, 40, 255, 1},
-        {21, 110, 16, 255, 1},
-        {4, 93, 0, 255, 1},
-        {18, 107, 13, 255, 1},
-        {25, 114, 20, 255, 1},
-        {27, 116, 22, 255, 1},
-        {29, 118, 24, 255, 1},
-        {39, 128, 34, 255, 1},
-        {46, 135, 41, 255, 1},
-        {47, 136, 42, 255, 1},
-        {52, 148, 46, 255, 1},
-        {39, 127, 34, 148, 1},
-        {42, 139, 37, 255, 1},
-        {40, 129, 35, 255, 1},
-        {42, 131, 37, 255, 1},
-        {35, 124, 30, 255, 1},
-        {31, 120, 26, 255, 1},
-        {44, 133, 39, 255, 1},
-        {49, 138, 44, 255, 1},
-        {44, 133, 39, 255, 1},
-        {43, 132, 38, 255, 1},
-        {33, 122, 28, 255, 1},
-        {26, 115, 21, 255, 1},
-        {35, 124, 30, 255, 1},
-        {37, 126, 32, 255, 1},
-        {39, 128, 34, 255, 1},
-        {40, 129, 35, 255, 1},
-        {45, 134, 40, 255, 1},
-        {48, 137, 43, 255, 1},
-        {40, 129, 35, 255, 1},
-        {37, 126, 32, 255, 1},
-        {44, 133, 39, 255, 1},
-        {48, 137, 43, 255, 1},
-        {39, 128, 34, 255, 1},
-        {33, 122, 28, 255, 1},
-        {38, 127, 33, 255, 1},
-        {39, 128, 34, 255, 1},
-        {49, 138, 44, 255, 1},
-        {56, 145, 51, 255, 1},
-        {39, 128, 34, 255, 1},
-        {28, 117, 23, 255, 1},
-        {39, 128, 34, 255, 1},
-        {46, 135, 41, 255, 1},
-        {37, 126, 32, 255, 1},
-        {30, 119, 25, 255, 1},
-        {39, 128, 34, 255, 1},
-        {45, 134, 40, 255, 1},
-        {37, 126, 32, 255, 1},
-        {32, 121, 27, 255, 1},
-        {40, 129, 35, 255, 1},
-        {45, 134, 40, 255, 1},
-        {41, 130, 36, 255, 1},
-        {39, 128, 34, 255, 1},
-        {36, 125, 31, 255, 1},
-        {35, 124, 30, 255, 1},
-        {29, 118, 24, 255, 1},
-        {25, 114, 20, 255, 1},
-        {31, 120, 26, 255, 1},
-        {36, 125, 31, 255, 1},
-        {30, 119, 25, 255, 1},
-        {25, 114, 20, 255, 1},
-        {36, 125, 31, 255, 1},
-        {43, 132, 38, 255, 1},
-        {35, 124, 30, 255, 1},
-        {31, 120, 26, 255, 1},
-        {28, 117, 23, 255, 1},
-        {24, 113, 19, 255, 1},
-        {36, 125, 31, 255, 1},
-        {44, 133, 39, 255, 1},
-        {35, 124, 30, 255, 1},
-        {28, 117, 23, 255, 1},
-        {31, 120, 26, 255, 1},
-        {32, 121, 27, 255, 1},
-        {31, 120, 26, 255, 1},
-        {32, 128, 27, 255, 1},
-        {53, 143, 48, 148, 1},
-        {57, 154, 52, 255, 1},
-        {42, 131, 37, 255, 1},
-        {38, 127, 33, 255, 1},
-        {33, 122, 28, 255, 1},
-        {30, 119, 25, 255, 1},
-        {43, 132, 38, 255, 1},
-        {48, 137, 43, 255, 1},
-        {44, 133, 39, 255, 2},
-        {20, 109, 15, 255, 1},
-        {6, 95, 1, 255, 1},
-        {30, 119, 25, 255, 1},
-        {40, 129, 35, 255, 1},
-        {46, 135, 41, 255, 1},
-        {51, 140, 46, 255, 1},
-        {37, 126, 32, 255, 1},
-        {29, 118, 24, 255, 1},
-        {33, 122, 28, 255, 1},
-        {34, 123, 29, 255, 1},
-        {49, 138, 44, 255, 1},
-        {60, 149, 55, 255, 1},
-        {41, 130, 36, 255, 1},
-        {32, 121, 27, 255, 1},
-        {34, 123, 29, 255, 1},
-        {32, 121, 27, 255, 1},
-        {45, 134, 40, 255, 1},
-        {54, 143, 49, 255, 1},
-        {30, 119, 25, 255, 1},
-        {15, 104, 10, 255, 1},
-        {37, 126, 32, 255, 1},
-        {49, 138, 44, 255, 1},
-        {38, 127, 33, 255, 1},
-        {32, 121, 27, 255, 1},
-        {42, 131, 37, 255, 1},
-        {48, 137, 43, 255, 1},
-        {44, 133, 39, 255, 1},
-        {41, 130, 36, 255, 1},
-        {42, 131, 37, 255, 1},
-        {45, 134, 40, 255, 1},
-        {33, 122, 28, 255, 1},
-        {23, 112, 18, 255, 1},
-        {34, 123, 29, 255, 1},
-        {41, 130, 36, 255, 1},
-        {23, 112, 18, 255, 1},
-        {9, 98, 4, 255, 1},
-        {37, 126, 32, 255, 1},
-        {56, 145, 51, 255, 1},
-        {46, 135, 41, 255, 1},
-        {39, 128, 34, 255, 1},
-        {40, 129, 35, 255, 1},
-        {42, 131, 37, 255, 1},
-        {29, 118, 24, 255, 1},
-        {18, 107, 13, 255, 1},
-        {30, 119, 25, 255, 1},
-        {35, 124, 30, 255, 1},
-        {47, 136, 42, 255, 1},
-        {60, 149, 55, 255, 1},
-        {41, 130, 36, 255, 1},
-        {28, 117, 23, 255, 1},
-        {25, 114, 20, 255, 1},
-        {22, 111, 17, 255, 1},
-        {19, 108, 14, 255, 1},
-        {18, 114, 13, 255, 1},
-        {55, 144, 49, 148, 1},
-        {61, 157, 56, 255, 1},
-        {38, 127, 33, 255, 1},
-        {30, 119, 25, 255, 1},
-        {34, 123, 29, 255, 1},
-        {35, 124, 30, 255, 1},
-        {34, 123, 29, 255, 2},
-        {30, 119, 25, 255, 1},
-        {29, 118, 24, 255, 1},
-        {18, 107, 13, 255, 1},
-        {12, 101, 7, 255, 1},
-        {32, 121, 27, 255, 1},
-        {42, 131, 37, 255, 1},
-        {41, 130, 36, 255, 2},
-        {27, 116, 22, 255, 1},
-        {18, 107, 13, 255, 1},
-        {35, 124, 30, 255, 1},
-        {43, 132, 38, 255, 1},
-        {45, 134, 40, 255, 1},
-        {48, 137, 43, 255, 1},
-        {35, 124, 30, 255, 1},
-        {29, 118, 24, 255, 1},
-        {28, 117, 23, 255, 1},
-        {25, 114, 20, 255, 1},
-        {40, 129, 35, 255, 1},
-        {49, 138, 44, 255, 1},
-        {35, 124, 30, 255, 1},
-        {28, 117, 23, 255, 1},
-        {37, 126, 32, 255, 1},
-        {42, 131, 37, 255, 1},
-        {41, 130, 36, 255, 1},
-        {42, 131, 37, 255, 1},
-        {44, 133, 39, 255, 1},
-        {46, 135, 41, 255, 1},
-        {41, 130, 36, 255, 1},
-        {38, 127, 33, 255, 1},
-        {45, 134, 40, 255, 1},
-        {50, 139, 45, 255, 1},
-        {35, 124, 30, 255, 1},
-        {24, 113, 19, 255, 1},
-        {41, 130, 36, 255, 1},
-        {52, 141, 47, 255, 1},
-        {42, 131, 37, 255, 1},
-        {35, 124, 30, 255, 1},
-        {41, 130, 36, 255, 1},
-        {45, 134, 40, 255, 1},
-        {42, 131, 37, 255, 1},
-        {40, 129, 35, 255, 1},
-        {30, 119, 25, 255, 1},
-        {22, 111, 17, 255, 1},
-        {30, 119, 25, 255, 1},
-        {34, 123, 29, 255, 1},
-        {43, 132, 38, 255, 1},
-        {49, 138, 44, 255, 1},
-        {43, 132, 38, 255, 1},
-        {41, 130, 36, 255, 1},
-        {30, 119, 25, 255, 1},
-        {21, 110, 16, 255, 1},
-        {26, 115, 21, 255, 1},
-        {30, 119, 25, 255, 1},
-        {29, 118, 24, 255, 1},
-        {32, 128, 27, 255, 1},
-        {60, 149, 55, 148, 1},
-        {66, 162, 61, 255, 1},
-        {35, 124, 30, 255, 1},
-        {23, 112, 18, 255, 1},
-        {33, 122, 28, 255, 1},
-        {37, 126, 32, 255, 1},
-        {26, 115, 21, 255, 1},
-        {23, 112, 18, 255, 1},
-        {19, 108, 14, 255, 1},
-        {17, 106, 12, 255, 1},
-        {14, 103, 9, 255, 1},
-        {9, 98, 4, 255, 1},
-        {31, 120, 26, 255, 1},
-        {42, 131, 37, 255, 1},
-        {36, 125, 31, 255, 1},
-        {35, 124, 30, 255, 1},
-        {17, 106, 12, 255, 1},
-        {3, 92, 0, 255, 1},
-        {34, 123, 29, 255, 1},
-        {49, 138, 44, 255, 1},
-        {43, 132, 38, 255, 1},
-        {42, 131, 37, 255, 1},
-        {31, 120, 26, 255, 1},
-        {25, 114, 20, 255, 1},
-        {22, 111, 17, 255, 1},
-        {18, 107, 13, 255, 1},
-        {35, 124, 30, 255, 1},
-        {46, 135, 41, 255, 1},
-        {38, 127, 33, 255, 1},
-        {35, 124, 30, 255, 1},
-        {37, 126, 32, 255, 1},
-        {38, 127, 33, 255, 1},
-        {45, 134, 40, 255, 1},
-        {50, 139, 45, 255, 1},
-        {45, 134, 40, 255, 1},
-        {43, 132, 38, 255, 1},
-        {41, 130, 36, 255, 1},
-        {39, 128, 34, 255, 1},
-        {47, 136, 42, 255, 1},
-        {52, 141, 47, 255, 1},
-        {34, 123, 29, 255, 1},
-        {22, 111, 17, 255, 1},
-        {46, 135, 41, 255, 1},
-        {62, 151, 57, 255, 1},
-        {55, 144, 50, 255, 1},
-        {53, 142, 48, 255, 1},
-        {45, 134, 40, 255, 1},
-        {38, 127, 33, 255, 1},
-        {40, 129, 35, 255, 1},
-        {44, 133, 39, 255, 1},
-        {23, 112, 18, 255, 1},
-        {7, 96, 2, 255, 1},
-        {30, 119, 25, 255, 1},
-        {45, 134, 40, 255, 1},
-        {54, 143, 49, 255, 1},
-        {63, 152, 58, 255, 1},
-        {42, 131, 37, 255, 1},
-        {30, 119, 25, 255, 1},
-        {22, 111, 17, 255, 1},
-        {13, 102, 8, 255, 1},
-        {26, 115, 21, 255, 1},
-        {34, 123, 29, 255, 1},
-        {36, 125, 31, 255, 1},
-        {43, 139, 38, 255, 1},
-        {48, 137, 43, 148, 1},
-        {53, 150, 48, 255, 1},
-        {34, 123, 29, 255, 1},
-        {27, 116, 22, 255, 1},
-        {35, 124, 30, 255, 1},
-        {38, 127, 33, 255, 1},
-        {32, 121, 27, 255, 1},
-        {30, 119, 25, 255, 2},
-        {28, 117, 23, 255, 1},
-        {39, 128, 33, 255, 1},
-        {43, 132, 38, 255, 1},
-        {48, 137, 43, 255, 1},
-        {51, 140, 46, 255, 1},
-        {42, 131, 37, 255, 1},
-        {38, 127, 33, 255, 1},
-        {35, 124, 30, 255, 1},
-        {32, 121, 27, 255, 1},
-        {37, 126, 32, 255, 1},
-        {39, 128, 34, 255, 1},
-        {28, 117, 23, 255, 1},
-        {21, 110, 16, 255, 1},
-        {37, 126, 32, 255, 1},
-        {46, 135, 41, 255, 1},
-        {36, 125, 31, 255, 1},
-        {30, 119, 25, 255, 1},
-        {36, 125, 31, 255, 1},
-        {38, 127, 33, 255, 1},
-        {41, 130, 36, 255, 1},
-        {44, 133, 39, 255, 1},
-        {37, 126, 32, 255, 1},
-        {32, 121, 27, 255, 1},
-        {39, 128, 34, 255, 1},
-        {42, 131, 37, 255, 1},
-        {46, 135, 41, 255, 1},
-        {49, 138, 44, 255, 1},
-        {40, 129, 35, 255, 1},
-        {33, 122, 28, 255, 1},
-        {41, 130, 36, 255, 1},
-        {46, 135, 41, 255, 1},
-        {32, 121, 27, 255, 1},
-        {21, 110, 16, 255, 1},
-        {39, 128, 34, 255, 1},
-        {52, 141, 47, 255, 1},
-        {48, 137, 43, 255, 1},
-        {47, 136, 42, 255, 1},
-        {44, 133, 39, 255, 1},
-        {41, 130, 36, 255, 1},
-        {39, 128, 34, 255, 1},
-        {40, 129, 35, 255, 1},
-        {22, 111, 17, 255, 1},
-        {7, 96, 2, 255, 1},
-        {29, 118, 24, 255, 1},
-        {43, 132, 38, 255, 2},
-        {47, 136, 42, 255, 1},
-        {31, 120, 26, 255, 1},
-        {19, 108, 14, 255, 1},
-        {29, 118, 24, 255, 1},
-        {35, 124, 30, 255, 1},
-        {36, 125, 31, 255, 1},
-        {38, 127, 33, 255, 1},
-        {33, 122, 28, 255, 1},
-        {31, 127, 26, 255, 1},
-        {41, 130, 36, 148, 1},
-        {45, 141, 39, 255, 1},
-        {34, 123, 29, 255, 1},
-        {30, 119, 25, 255, 1},
-        {36, 125, 31, 255, 1},
-        {39, 128, 34, 255, 1},
-        {34, 123, 29, 255, 1},
-        {32, 121, 27, 255, 1},
-        {36, 125, 31, 255, 1},
-        {36, 125, 32, 255, 1},
-        {59, 148, 54, 255, 1},
-        {71, 160, 67, 255, 1},
-        {62, 151, 58, 255, 1},
-        {60, 149, 55, 255, 1},
-        {49, 138, 44, 255, 1},
-        {42, 131, 37, 255, 1},
-        {50, 139, 45, 255, 1},
-        {55, 144, 50, 255, 1},
-        {38, 127, 33, 255, 1},
-        {32, 121, 27, 255, 1},
-        {14, 103, 9, 255, 1},
-        {0, 89, 0, 255, 1},
-        {43, 132, 38, 255, 1},
-        {66, 155, 61, 255, 1},
-        {47, 136, 42, 255, 1},
-        {39, 128, 34, 255, 1},
-        {35, 124, 30, 255, 1},
-        {31, 120, 26, 255, 1},
-        {43, 132, 38, 255, 1},
-        {51, 140, 46, 255, 1},
-        {36, 125, 31, 255, 1},
-        {26, 115, 21, 255, 1},
-        {35, 124, 30, 255, 1},
-        {39, 128, 34, 255, 1},
-        {46, 135, 41, 255, 1},
-        {53, 142, 48, 255, 1},
-        {38, 127, 33, 255, 1},
-        {29, 118, 24, 255, 1},
-        {36, 125, 31, 255, 1},
-        {41, 130, 36, 255, 1},
-        {29, 118, 24, 255, 1},
-        {21, 110, 16, 255, 1},
-        {36, 125, 31, 255, 1},
-        {46, 135, 41, 255, 1},
-        {44, 133, 39, 255, 2},
-        {43, 132, 38, 255, 2},
-        {39, 128, 34, 255, 1},
-        {38, 127, 33, 255, 1},
-        {19, 108, 14, 255, 1},
-        {3, 92, 0, 255, 1},
-        {27, 116, 22, 255, 1},
-        {45, 134, 40, 255, 1},
-        {37, 126, 32, 255, 1},
-        {35, 124, 30, 255, 1},
-        {21, 110, 16, 255, 1},
-        {7, 96, 2, 255, 1},
-        {33, 122, 28, 255, 1},
-        {54, 143, 49, 255, 1},
-        {44, 133, 39, 255, 1},
-        {41, 130, 36, 255, 1},
-        {30, 119, 25, 255, 1},
-        {23, 119, 18, 255, 1},
-        {32, 122, 29, 148, 1},
-        {36, 133, 31, 255, 1},
-        {25, 114, 20, 255, 1},
-        {20, 109, 15, 255, 1},
-        {36, 125, 31, 255, 1},
-        {42, 131, 37, 255, 1},
-        {47, 136, 42, 255, 1},
-        {50, 139, 45, 255, 1},
-        {36, 125, 33, 255, 1},
-        {29, 118, 26, 255, 1},
-        {51, 140, 48, 255, 1},
-        {63, 152, 60, 255, 1},
-        {51, 140, 49, 255, 1},
-        {49, 138, 45, 255, 1},
-        {31, 120, 26, 255, 1},
-        {20, 109, 15, 255, 1},
-        {38, 127, 33, 255, 1},
-        {47, 136, 42, 255, 1},
-        {40, 129, 35, 255, 1},
-        {37, 126, 32, 255, 1},
-        {30, 119, 25, 255, 1},
-        {25, 114, 20, 255, 1},
-        {34, 123, 29, 255, 1},
-        {38, 127, 33, 255, 1},
-        {39, 128, 34, 255, 1},
-        {40, 129, 35, 255, 1},
-        {33, 122, 28, 255, 1},
-        {28, 117, 23, 255, 1},
-        {44, 133, 39, 255, 1},
-        {52, 141, 47, 255, 1},
-        {40, 129, 35, 255, 1},
-        {34, 123, 29, 255, 1},
-        {32, 121, 27, 255, 1},
-        {28, 117, 23, 255, 1},
-        {47, 136, 42, 255, 1},
-        {61, 150, 56, 255, 1},
-        {41, 130, 36, 255, 1},
-        {28, 117, 23, 255, 1},
-        {38, 127, 33, 255, 1},
-        {45, 134, 40, 255, 1},
-        {30, 119, 25, 255, 1},
-        {20, 109, 15, 255, 1},
-        {29, 118, 24, 255, 1},
-        {33, 122, 28, 255, 1},
-        {38, 127, 33, 255, 1},
-        {42, 131, 37, 255, 1},
-        {40, 129, 35, 255, 2},
-        {32, 121, 27, 255, 1},
-        {26, 115, 21, 255, 2},
-        {24, 113, 19, 255, 1},
-        {31, 120, 26, 255, 1},
-        {37, 126, 32, 255, 1},
-        {32, 121, 27, 255, 1},
-        {28, 117, 23, 255, 1},
-        {32, 121, 27, 255, 1},
-        {34, 123, 29, 255, 1},
-        {38, 127, 33, 255, 1},
-        {42, 131, 37, 255, 1},
-        {41, 130, 36, 255, 1},
-        {43, 132, 38, 255, 1},
-        {31, 120, 26, 255, 1},
-        {24, 120, 19, 255, 1},
-        {25, 115, 20, 148, 1},
-        {28, 125, 23, 255, 1},
-        {17, 106, 12, 255, 1},
-        {11, 100, 6, 255, 1},
-        {36, 125, 31, 255, 1},
-        {47, 136, 42, 255, 1},
-        {59, 148, 54, 255, 1},
-        {66, 155, 61, 255, 1},
-        {37, 126, 33, 255, 1},
-        {21, 110, 19, 255, 1},
-        {48, 137, 45, 255, 1},
-        {62, 151, 59, 255, 1},
-        {47, 136, 44, 255, 1},
-        {43, 132, 39, 255, 1},
-        {18, 107, 13, 255, 1},
-        {1, 90, 0, 255, 1},
-        {30, 119, 25, 255, 1},
-        {46, 135, 41, 255, 1},
-        {43, 132, 38, 255, 1},
-        {42, 131, 37, 255, 2},
-        {43, 132, 38, 255, 1},
-        {27, 116, 22, 255, 1},
-        {18, 107, 13, 255, 1},
-        {32, 121, 27, 255, 1},
-        {40, 129, 35, 255, 1},
-        {31, 120, 26, 255, 1},
-        {25, 114, 20, 255, 1},
-        {44, 133, 39, 255, 1},
-        {56, 145, 51, 255, 1},
-        {44, 133, 39, 255, 1},
-        {40, 129, 35, 255, 1},
-        {28, 117, 23, 255, 1},
-        {16, 105, 11, 255, 1},
-        {48, 137, 43, 255, 1},
-        {67, 156, 62, 255, 1},
-        {42, 131, 37, 255, 1},
-        {27, 116, 22, 255, 1},
-        {40, 129, 35, 255, 1},
-        {48, 137, 43, 255, 1},
-        {30, 119, 25, 255, 1},
-        {18, 107, 13, 255, 1},
-        {20, 109, 15, 255, 2},
-        {34, 123, 29, 255, 1},
-        {44, 133, 39, 255, 1},
-        {39, 128, 34, 255, 1},
-        {37, 126, 32, 255, 1},
-        {27, 116, 22, 255, 1},
-        {17, 106, 12, 255, 1},
-        {31, 120, 26, 255, 1},
-        {42, 131, 37, 255, 1},
-        {33, 122, 28, 255, 1},
-        {29, 118, 24, 255, 1},
-        {25, 114, 20, 255, 1},
-        {21, 110, 16, 255, 1},
-        {40, 129, 35, 255, 1},
-        {55, 144, 50, 255, 1},
-        {43, 132, 38, 255, 1},
-        {34, 123, 29, 255, 1},
-        {40, 129, 35, 255, 1},
-        {45, 134, 40, 255, 1},
-        {32, 121, 27, 255, 1},
-        {23, 119, 18, 255, 1},
-        {27, 115, 22, 148, 1},
-        {29, 125, 23, 255, 1},
-        {32, 121, 27, 255, 1},
-        {34, 123, 29, 255, 1},
-        {35, 124, 30, 255, 1},
-        {34, 123, 29, 255, 1},
-        {46, 135, 41, 255, 1},
-        {51, 140, 46, 255, 1},
-        {49, 138, 44, 255, 1},
-        {49, 138, 45, 255, 1},
-        {43, 132, 39, 255, 1},
-        {41, 130, 37, 255, 1},
-        {32, 121, 28, 255, 1},
-        {28, 117, 23, 255, 1},
-        {24, 113, 19, 255, 1},
-        {21, 110, 16, 255, 1},
-        {28, 117, 23, 255, 1},
-        {32, 121, 27, 255, 1},
-        {31, 120, 26, 255, 1},
-        {30, 120, 25, 255, 1},
-        {29, 118, 24, 255, 2},
-        {30, 119, 25, 255, 2},
-        {41, 130, 36, 255, 1},
-        {48, 137, 43, 255, 1},
-        {38, 127, 33, 255, 1},
-        {32, 121, 27, 255, 1},
-        {43, 132, 38, 255, 1},
-        {49, 138, 44, 255, 1},
-        {38, 127, 33, 255, 1},
-        {31, 120, 26, 255, 1},
-        {36, 125, 31, 255, 1},
-        {37, 126, 32, 255, 1},
-        {52, 141, 47, 255, 1},
-        {63, 152, 58, 255, 1},
-        {47, 136, 42, 255, 1},
-        {37, 126, 32, 255, 1},
-        {42, 131, 37, 255, 1},
-        {46, 135, 41, 255, 1},
-        {33, 122, 28, 255, 1},
-        {23, 112, 18, 255, 1},
-        {34, 123, 29, 255, 1},
-        {42, 131, 37, 255, 1},
-        {28, 117, 23, 255, 1},
-        {18, 107, 15, 255, 1},
-        {31, 120, 26, 255, 1},
-        {40, 129, 35, 255, 1},
-        {31, 120, 26, 255, 1},
-        {25, 114, 20, 255, 1},
-        {27, 116, 22, 255, 2},
-        {34, 123, 29, 255, 1},
-        {40, 129, 35, 255, 1},
-        {35, 124, 30, 255, 1},
-        {33, 122, 28, 255, 1},
-        {34, 123, 29, 255, 1},
-        {35, 124, 30, 255, 1},
-        {39, 128, 34, 255, 1},
-        {43, 132, 38, 255, 1},
-        {38, 127, 33, 255, 1},
-        {35, 124, 30, 255, 1},
-        {31, 120, 26, 255, 1},
-        {29, 125, 24, 255, 1},
-        {27, 114, 22, 160, 1},
-        {31, 134, 25, 255, 1},
-        {45, 141, 40, 255, 1},
-        {55, 151, 49, 255, 1},
-        {36, 132, 30, 255, 1},
-        {27, 123, 21, 255, 1},
-        {40, 136, 34, 255, 1},
-        {44, 140, 38, 255, 1},
-        {63, 160, 58, 255, 1},
-        {77, 173, 71, 255, 1},
-        {42, 138, 37, 255, 1},
-        {25, 122, 20, 255, 1},
-        {21, 117, 15, 255, 1},
-        {16, 112, 11, 255, 1},
-        {29, 126, 24, 255, 1},
-        {37, 133, 31, 255, 1},
-        {28, 124, 22, 255, 1},
-        {23, 119, 17, 255, 1},
-        {24, 120, 18, 255, 2},
-        {23, 119, 17, 255, 1},
-        {22, 118, 16, 255, 1},
-        {34, 130, 29, 255, 1},
-        {40, 136, 34, 255, 1},
-        {51, 147, 46, 255, 1},
-        {59, 155, 54, 255, 1},
-        {48, 144, 42, 255, 1},
-        {41, 137, 35, 255, 1},
-        {44, 140, 39, 255, 1},
-        {46, 143, 41, 255, 1},
-        {35, 131, 30, 255, 1},
-        {26, 122, 21, 255, 1},
-        {46, 142, 40, 255, 1},
-        {57, 154, 52, 255, 1},
-        {61, 157, 56, 255, 1},
-        {65, 161, 59, 255, 1},
-        {54, 150, 49, 255, 1},
-        {48, 144, 43, 255, 1},
-        {48, 144, 42, 255, 1},
-        {48, 145, 43, 255, 1},
-        {38, 134, 33, 255, 1},
-        {30, 126, 24, 255, 1},
-        {47, 143, 42, 255, 1},
-        {63, 159, 58, 255, 1},
-        {25, 121, 19, 255, 1},
-        {0, 94, 0, 255, 1},
-        {27, 123, 22, 255, 1},
-        {46, 142, 40, 255, 1},
-        {37, 133, 32, 255, 1},
-        {33, 129, 28, 255, 1},
-        {26, 122, 21, 255, 1},
-        {18, 115, 13, 255, 1},
-        {38, 134, 33, 255, 1},
-        {52, 148, 47, 255, 1},
-        {46, 142, 41, 255, 1},
-        {44, 140, 39, 255, 1},
-        {33, 129, 27, 255, 1},
-        {22, 118, 16, 255, 1},
-        {39, 135, 34, 255, 1},
-        {53, 150, 48, 255, 1},
-        {40, 136, 34, 255, 1},
-        {30, 126, 24, 255, 1},
-        {33, 129, 28, 255, 1},
-        {38, 142, 31, 255, 1},
- };
-
-    static BYTE textureData[64 * 64 * 4];
-    
-    BYTE* ptr = textureData;
-    for (const auto& seg : segments) {
-        for (int i = 0; i < seg.count; ++i) {
-            *ptr++ = seg.r;
-            *ptr++ = seg.g;
-            *ptr++ = seg.b;
-            *ptr++ = seg.a;
-        }
-    }
-
-    bool result = CreateTextureFromData(textureData, size, size, &cachedSRV);
-    *outSRV = cachedSRV;
-    return result;
-}
\ No newline at end of file
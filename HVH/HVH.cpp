@@ -10,7 +10,10 @@
 #include "Skybox.h"
 #include <ShellScalingApi.h>
 #include "Gamemod.h"
+#include "GameLoop.h"
+#include <timeapi.h>
 #pragma comment(lib, "Shcore.lib")
+#pragma comment(lib, "winmm.lib")
 
 #pragma comment(lib, "d2d1.lib")
 #pragma comment(lib, "dwrite.lib")
@@ -28,6 +31,8 @@ bool isFullscreen = false;
 bool isMenuState = true;
 bool particlesInitialized = false;
 HWND hWndMain = nullptr;
+bool mainLoopRunning = false;
+FrameLimiter frameLimiter;
 
 // Direct2D 
 ID2D1Factory* pD2DFactory = nullptr;
@@ -130,6 +135,7 @@ void InitializeMenuButtons(int windowWidth, int windowHeight);
 void InitializePauseMenuButtons(int windowWidth, int windowHeight);
 void InitializeSettingsMenuButtons(int windowWidth, int windowHeight);
 void InitializeGameModeButtons(int windowWidth, int windowHeight);
+bool RunFrame(HWND hWnd);
 void StartGame(HWND hWnd);
 void UpdateAllMenuButtons(HWND hWnd);
 void ToggleFullscreen(HWND hWnd);
@@ -160,16 +166,36 @@ int APIENTRY wWinMain(_In_ HINSTANCE hInstance,
 
     HACCEL hAccelTable = LoadAccelerators(hInstance, MAKEINTRESOURCE(IDC_HVH));
 
-    MSG msg;
+    MSG msg = {};
 
-    while (GetMessage(&msg, nullptr, 0, 0))
+    // 1 ms sleeps for the frame limiter instead of the default ~15.6 ms
+    timeBeginPeriod(1);
+    while (msg.message != WM_QUIT)
     {
-        if (!TranslateAccelerator(msg.hwnd, hAccelTable, &msg))
+        if (PeekMessage(&msg, nullptr, 0, 0, PM_REMOVE))
         {
-            TranslateMessage(&msg);
-            DispatchMessage(&msg);
+            if (!TranslateAccelerator(msg.hwnd, hAccelTable, &msg))
+            {
+                TranslateMessage(&msg);
+                DispatchMessage(&msg);
+            }
+            continue;
+        }
+
+        if (!mainLoopRunning)
+        {
+            WaitMessage();
+            continue;
         }
+
+        // nothing presented means no vsync wait either, so don't spin
+        if (!RunFrame(hWndMain))
+            MsgWaitForMultipleObjects(0, nullptr, FALSE, 1, QS_ALLINPUT);
+        if (frameLimiter.GetMaxFps() != g_Settings.maxFps)
+            frameLimiter.SetMaxFps(g_Settings.maxFps);
+        frameLimiter.Wait();
     }
+    timeEndPeriod(1);
 
     return (int)msg.wParam;
 }
@@ -340,12 +366,13 @@ void DiscardGraphicsResources()
 
 void StartMainLoop(HWND hWnd) {
     lastFrameTime = std::chrono::steady_clock::now();
-    SetTimer(hWnd, 1, 16, NULL);
+    mainLoopRunning = true;
 }
 
 void StopMainLoop(HWND hWnd) {
-    KillTimer(hWnd, 1);
+    mainLoopRunning = false;
 }
+
 void InitParticles(int width, int height, int count = 40) {
     if (width <= 0 || height <= 0) return;
     particles.clear();
@@ -372,6 +399,40 @@ void UpdateAnimation(float deltaTime, int width, int height) {
     }
 }
 
+// One pass of the game loop: advances the game (its simulation runs in fixed
+// ticks inside Update) and paints right away instead of waiting for WM_PAINT
+// to come round in the message queue. False if nothing was painted.
+bool RunFrame(HWND hWnd)
+{
+    auto now = std::chrono::steady_clock::now();
+    float dt = std::chrono::duration<float>(now - lastFrameTime).count();
+    lastFrameTime = now;
+
+    RECT rc;
+    GetClientRect(hWnd, &rc);
+    int w = rc.right - rc.left;
+    int h = rc.bottom - rc.top;
+    bool paint = false;
+    if (currentMenuState == IN_GAME && pGameEngine)
+    {
+        UpdateAnimation(dt, w, h);
+        pGameEngine->Update(dt);
+        if (!pGameEngine->IsConsoleActive()) {
+            InvalidateRect(hWnd, nullptr, FALSE);
+            ShowCursor(TRUE);
+            paint = true;
+        }
+    }
+    else if (currentMenuState != IN_GAME)
+    {
+        UpdateAnimation(dt, w, h);
+        InvalidateRect(hWnd, nullptr, FALSE);
+        paint = true;
+    }
+    UpdateWindow(hWnd);
+    return paint;
+}
+
 
 
 void InitializeMenuButtons(int windowWidth, int windowHeight)
@@ -1210,9 +1271,6 @@ void ChangeResolution(HWND hWnd, int width, int height)
 
 LRESULT CALLBACK WndProc(HWND hWnd, UINT message, WPARAM wParam, LPARAM lParam)
 {
-    static LARGE_INTEGER frequency;
-    static LARGE_INTEGER lastTime;
-    static bool timerInitialized = false;
     switch (message)
     {
     case WM_CREATE:
@@ -1227,10 +1285,6 @@ LRESULT CALLBACK WndProc(HWND hWnd, UINT message, WPARAM wParam, LPARAM lParam)
 
         StartMainLoop(hWnd);
         isMenuState = (currentMenuState != IN_GAME);
-        SetTimer(hWnd, 1, 5, nullptr);
-        QueryPerformanceFrequency(&frequency);
-        QueryPerformanceCounter(&lastTime);
-        timerInitialized = true;
         return 0;
     }
     case WM_SIZE:
@@ -1536,39 +1590,6 @@ LRESULT CALLBACK WndProc(HWND hWnd, UINT message, WPARAM wParam, LPARAM lParam)
         EndPaint(hWnd, &ps);
         return 0;
     }
-    case WM_TIMER:
-    {
-        // static LARGE_INTEGER frequency;
-        // static LARGE_INTEGER lastTime;
-        // static bool timerInitialized = false;
-        LARGE_INTEGER currentTime;
-        QueryPerformanceCounter(&currentTime);
-        float dt = 1.0f;
-        if (timerInitialized) {
-            dt = static_cast<float>(currentTime.QuadPart - lastTime.QuadPart) / frequency.QuadPart;
-        }
-        lastTime = currentTime;
-        timerInitialized = true;
-        RECT rc;
-        GetClientRect(hWnd, &rc);
-        int w = rc.right - rc.left;
-        int h = rc.bottom - rc.top;
-        if (currentMenuState == IN_GAME && pGameEngine)
-        {
-            UpdateAnimation(dt, w, h);
-            pGameEngine->Update(dt / 3.25f);
-            if (!pGameEngine->IsConsoleActive()) {
-                InvalidateRect(hWnd, nullptr, FALSE);
-                ShowCursor(TRUE);
-            }
-        }
-        else if (currentMenuState != IN_GAME)
-        {
-            UpdateAnimation(dt, w, h);
-            InvalidateRect(hWnd, nullptr, FALSE);
-        }
-        return 0;
-    }
     case WM_DESTROY:
     {
         if (pGameEngine)
@@ -1579,7 +1600,6 @@ LRESULT CALLBACK WndProc(HWND hWnd, UINT message, WPARAM wParam, LPARAM lParam)
         }
         StopMainLoop(hWnd);
         DiscardGraphicsResources();
-        KillTimer(hWnd, 1);
         PostQuitMessage(0);
         return 0;
     }
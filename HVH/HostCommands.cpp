@@ -0,0 +1,78 @@
+#include "HostCommands.h"
+
+void RegisterHostCommands(ConsoleCommands& commands, const HostConsole& console)
+{
+    WorldStore& store = *console.store;
+    HostSession& session = *console.session;
+    auto isHosting = console.isHosting;
+    auto log = console.log;
+
+    commands["save"] = [&store, log](const auto& args) {
+        if (args.size() < 2) {
+            log("Usage: save <filename>");
+            return;
+        }
+        if (!store.StartSave(args[1])) {
+            log("A map save or load is already running");
+            return;
+        }
+        log("Saving map to " + ParkourMap::GetMapPath(args[1]) + "...");
+        };
+    commands["load"] = [&store, log](const auto& args) {
+        if (args.size() < 2) {
+            log("Usage: load <filename>");
+            return;
+        }
+        if (!store.StartLoad(args[1])) {
+            log("A map save or load is already running");
+            return;
+        }
+        log("Loading map from " + ParkourMap::GetMapPath(args[1]) + "...");
+        };
+    commands["autosave"] = [&store, log](const auto& args) {
+        if (args.size() > 1) {
+            try { store.SetAutosaveMinutes(std::stof(args[1])); }
+            catch (...) {
+                log("Usage: autosave <minutes, 0 = off>");
+                return;
+            }
+        }
+        log(store.GetAutosaveMinutes() > 0.0f ?
+            "Autosave every " + std::to_string(store.GetAutosaveMinutes()) + " min to " +
+            ParkourMap::GetMapPath(store.GetFiles().autosave) :
+            std::string("Autosave off"));
+        };
+    commands["clear"] = [&store, log](const auto&) {
+        store.Clear();
+        log("Map cleared");
+        };
+    commands["players"] = [&session, isHosting, log](const auto&) {
+        if (!isHosting()) {
+            log("Not hosting a session");
+            return;
+        }
+        if (session.GetPlayers().empty()) {
+            log("No players connected");
+            return;
+        }
+        for (const auto& pair : session.GetPlayers()) {
+            const EntitySample& latest = pair.second.latest;
+            log("Player " + std::to_string(pair.first) + (pair.second.reported ?
+                " at " + std::to_string(latest.position[0]) + ", " + std::to_string(latest.position[1]) +
+                ", " + std::to_string(latest.position[2]) : std::string(", loading")));
+        }
+        };
+    commands["netstats"] = [&session, isHosting, log](const auto&) {
+        if (!isHosting()) {
+            log("Not hosting a session");
+            return;
+        }
+        const auto& snapshotStats = session.GetSnapshotStats();
+        log("Snapshots: " + std::to_string(snapshotStats.ticks) + " ticks at " +
+            std::to_string((int)NET_TICK_RATE) + " Hz, " +
+            std::to_string((int)snapshotStats.bytesPerClient) + " bytes/s per client");
+        log("Position corrections: " + std::to_string(session.GetCorrections()) +
+            " (last " + std::to_string(session.GetLastCorrection()) + ")");
+        log("World transfers in progress: " + std::to_string(session.GetTransferCount()));
+        };
+}
@@ -0,0 +1,24 @@
+#pragma once
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "HostSession.h"
+#include "WorldStore.h"
+
+// Console commands by name, each given the whole line split on spaces.
+using ConsoleCommands = std::unordered_map<std::string, std::function<void(const std::vector<std::string>&)>>;
+
+// What the host commands act on.
+struct HostConsole {
+    WorldStore* store = nullptr;
+    HostSession* session = nullptr;
+    // players and netstats only mean something while a session is hosted
+    std::function<bool()> isHosting;
+    std::function<void(const std::string&)> log;
+};
+
+// save, load, autosave, clear, players and netstats: the commands every host
+// has, with or without a window. The game adds its client-only commands to
+// the same table, the dedicated server its own few.
+void RegisterHostCommands(ConsoleCommands& commands, const HostConsole& console);
@@ -0,0 +1,190 @@
+#include "HostSession.h"
+#include <cmath>
+
+void HostSession::Reset()
+{
+    snapshotServer.Reset();
+    worldTransferServer.Reset();
+    players.clear();
+    snapshotStats = SnapshotStats();
+    snapshotStats.windowStart = std::chrono::steady_clock::now();
+    corrections = 0;
+    lastCorrection = 0.0f;
+}
+
+bool HostSession::HandleMessage(const NetMessage& msg, int clientId)
+{
+    switch (msg.type) {
+    case NetMessageType::Position:
+        // clients only report their own player, the host hands it out in snapshots
+        if (snapshotServer.HasClient(clientId)) OnPosition(msg, clientId);
+        return true;
+
+    case NetMessageType::SnapshotAck:
+        snapshotServer.Acknowledge(clientId, msg.sequence);
+        return true;
+
+    case NetMessageType::WorldAck:
+        worldTransferServer.Acknowledge(clientId, msg.sequence);
+        return true;
+
+    case NetMessageType::BlockAdd:
+        if (world.addBlock && world.addBlock(msg.x, msg.y, msg.z, msg.blockName)) {
+            network.BroadcastData(msg);
+        }
+        return true;
+
+    case NetMessageType::BlockRemove:
+        if (world.removeBlock && world.removeBlock(msg.x, msg.y, msg.z)) {
+            network.BroadcastData(msg);
+            Log("Block removal broadcasted to all clients");
+        }
+        else {
+            Log("Block not found for removal");
+        }
+        return true;
+
+    case NetMessageType::Join:
+        // player ids are connection ids so Leave/Disconnected map back to them
+        snapshotServer.AddClient(clientId);
+        players[clientId] = Player();
+        Log("Player joined, assigned ID: " + std::to_string(clientId));
+
+        network.SendToClient(clientId, NetMessage::Player(NetMessageType::AssignId, clientId));
+        StartWorldTransfer(clientId);
+        // existing players arrive with the first (full) snapshot
+        network.BroadcastData(NetMessage::Player(NetMessageType::NewPlayer, clientId));
+        return true;
+
+    case NetMessageType::Leave:
+    case NetMessageType::Disconnected:
+        // a clean leave delivers both, only act on the first
+        if (snapshotServer.RemoveClient(clientId)) {
+            players.erase(clientId);
+            worldTransferServer.Cancel(clientId);
+            if (playerLeft) playerLeft(clientId);
+            Log("Player " + std::to_string(clientId) + " left");
+            network.BroadcastData(NetMessage::Player(NetMessageType::PlayerLeft, clientId));
+        }
+        return true;
+
+    default:
+        return false;
+    }
+}
+
+void HostSession::OnPosition(const NetMessage& msg, int clientId)
+{
+    double now = std::chrono::duration<double>(std::chrono::steady_clock::now().time_since_epoch()).count();
+    EntitySample sample;
+    sample.time = now;
+    sample.position[0] = msg.x; sample.position[1] = msg.y; sample.position[2] = msg.z;
+    sample.yaw = msg.yaw;
+    sample.pitch = msg.pitch;
+
+    Player& player = players[clientId];
+
+    // remote players aren't simulated here, only how far one may move between
+    // reports is bounded; the client reconciles to the result
+    if (!msg.teleport && player.reported) {
+        const EntitySample& last = player.latest;
+        float d[3] = { msg.x - last.position[0], msg.y - last.position[1], msg.z - last.position[2] };
+        float distance = sqrtf(d[0] * d[0] + d[1] * d[1] + d[2] * d[2]);
+        float maxDistance = maxPlayerSpeed * (float)(now - last.time) + 0.5f;
+        if (distance > maxDistance) {
+            float scale = maxDistance / distance;
+            for (int k = 0; k < 3; ++k) {
+                sample.position[k] = last.position[k] + d[k] * scale;
+            }
+            corrections++;
+            lastCorrection = distance - maxDistance;
+        }
+    }
+
+    if (!player.reported) Log("Player " + std::to_string(clientId) + " added/updated");
+    player.latest = sample;
+    player.reported = true;
+    player.lastInputSequence = msg.sequence;
+    if (playerMoved) playerMoved(clientId, sample, msg.teleport);
+}
+
+void HostSession::StartWorldTransfer(int clientId)
+{
+    network.SendToClient(clientId, NetMessage::Simple(NetMessageType::MapClear));
+    if (!world.voxels) return;
+
+    // everyone spawns at the origin, so that's where the client needs blocks first
+    uint32_t chunks = worldTransferServer.Begin(clientId, *world.voxels, 0, 0);
+    network.SendToClient(clientId, NetMessage::WorldBegin(chunks));
+
+    // rotated/scaled objects aren't in chunks, there are few of them
+    if (world.collectObjects) {
+        std::vector<ParkourObject> objects;
+        world.collectObjects(objects);
+        for (const auto& obj : objects) {
+            network.SendToClient(clientId, NetMessage::BlockAdd(obj.position.x, obj.position.y, obj.position.z, obj.type));
+        }
+    }
+}
+
+void HostSession::RestartWorldTransfers()
+{
+    for (int clientId : snapshotServer.GetClients()) {
+        StartWorldTransfer(clientId);
+    }
+    Log("Map sync started for all clients");
+}
+
+void HostSession::PumpWorldTransfers()
+{
+    if (!worldTransferServer.HasTransfers() || !world.voxels) return;
+
+    NetMessage batch;
+    for (int clientId : worldTransferServer.GetClients()) {
+        while (worldTransferServer.NextBatch(clientId, *world.voxels, batch)) {
+            if (!network.SendToClient(clientId, batch)) {
+                worldTransferServer.Cancel(clientId);
+                break;
+            }
+        }
+    }
+}
+
+void HostSession::SendSnapshots(const NetEntityMap& hostEntities)
+{
+    // newest accepted state of every player
+    NetEntityMap entities = hostEntities;
+    for (const auto& pair : players) {
+        if (!pair.second.reported) continue;
+        const EntitySample& latest = pair.second.latest;
+        NetQuantizedState q;
+        q.x = NetQuantizePosition(latest.position[0]);
+        q.y = NetQuantizePosition(latest.position[1]);
+        q.z = NetQuantizePosition(latest.position[2]);
+        q.yaw = NetQuantizeAngle(latest.yaw);
+        q.pitch = NetQuantizeAngle(latest.pitch);
+        entities[pair.first] = q;
+    }
+
+    snapshotServer.BeginTick();
+    std::vector<int> clients = snapshotServer.GetClients();
+    NetMessage snapshot;
+    for (int clientId : clients) {
+        // the client's own player is included so it can reconcile against it
+        if (snapshotServer.BuildSnapshot(clientId, entities, snapshot)) {
+            auto own = players.find(clientId);
+            snapshot.inputAck = own != players.end() ? own->second.lastInputSequence : 0;
+            network.SendToClient(clientId, snapshot);
+            snapshotStats.windowBytes += NetMessageSize(snapshot);
+        }
+    }
+
+    snapshotStats.ticks++;
+    auto now = std::chrono::steady_clock::now();
+    float window = std::chrono::duration<float>(now - snapshotStats.windowStart).count();
+    if (window >= 1.0f) {
+        snapshotStats.bytesPerClient = clients.empty() ? 0.0f : snapshotStats.windowBytes / window / clients.size();
+        snapshotStats.windowBytes = 0;
+        snapshotStats.windowStart = now;
+    }
+}
@@ -0,0 +1,96 @@
+#pragma once
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "NetworkManager.h"
+#include "NetSmoothing.h"
+#include "Replication.h"
+#include "WorldTransfer.h"
+#include "map1.h"
+
+// snapshots and client uploads, per second
+const float NET_TICK_RATE = 30.0f;
+
+// How a HostSession reaches the world it serves. The owner applies (and
+// journals) the edits; the session validates and relays them.
+struct HostWorld {
+    const VoxelWorld* voxels = nullptr;
+    // blocks off the lattice, sent one by one after the chunk transfer
+    std::function<void(std::vector<ParkourObject>&)> collectObjects;
+    // false if the cell is already taken
+    std::function<bool(float x, float y, float z, const std::string& blockName)> addBlock;
+    // false if nothing was there
+    std::function<bool(float x, float y, float z)> removeBlock;
+};
+
+// The authoritative half of a multiplayer session, shared by the in-game host
+// and the dedicated server: joins and leaves, bounded player movement, delta
+// snapshots, join-time world transfers and block edits. Nothing here renders.
+class HostSession
+{
+public:
+    struct Player {
+        EntitySample latest;
+        bool reported = false;         // has sent a position yet
+        uint32_t lastInputSequence = 0;
+    };
+
+    struct SnapshotStats {
+        size_t ticks = 0;
+        size_t windowBytes = 0;
+        float bytesPerClient = 0.0f;
+        std::chrono::steady_clock::time_point windowStart;
+    };
+
+    explicit HostSession(NetworkManager& network) : network(network) {}
+
+    void SetWorld(const HostWorld& hostWorld) { world = hostWorld; }
+    void SetLog(std::function<void(const std::string&)> callback) { log = callback; }
+    // accepted positions, for a host that draws the other players
+    void SetPlayerMovedCallback(std::function<void(int, const EntitySample&, bool teleport)> callback) { playerMoved = callback; }
+    void SetPlayerLeftCallback(std::function<void(int)> callback) { playerLeft = callback; }
+
+    void Reset();
+
+    // Handles a message only the host acts on. False for anything else.
+    bool HandleMessage(const NetMessage& msg, int clientId);
+
+    // MapClear, WorldBegin, then chunk batches from PumpWorldTransfers.
+    void StartWorldTransfer(int clientId);
+    void RestartWorldTransfers();
+    // every tick, the ack window keeps it from flooding the socket
+    void PumpWorldTransfers();
+
+    // One snapshot per client; hostEntities are added to the reported players
+    // (the in-game host's own player, nothing on a dedicated server).
+    void SendSnapshots(const NetEntityMap& hostEntities);
+
+    const std::unordered_map<int, Player>& GetPlayers() const { return players; }
+    const SnapshotStats& GetSnapshotStats() const { return snapshotStats; }
+    size_t GetCorrections() const { return corrections; }
+    float GetLastCorrection() const { return lastCorrection; }
+    size_t GetTransferCount() const { return worldTransferServer.GetClients().size(); }
+
+    // units per real second, generous for falls and fly mode
+    float maxPlayerSpeed = 150.0f;
+
+private:
+    void Log(const std::string& text) { if (log) log(text); }
+    void OnPosition(const NetMessage& msg, int clientId);
+
+    NetworkManager& network;
+    HostWorld world;
+    std::function<void(const std::string&)> log;
+    std::function<void(int, const EntitySample&, bool)> playerMoved;
+    std::function<void(int)> playerLeft;
+
+    SnapshotServer snapshotServer;
+    WorldTransferServer worldTransferServer;
+    std::unordered_map<int, Player> players;
+    SnapshotStats snapshotStats;
+    size_t corrections = 0;
+    float lastCorrection = 0.0f;
+};
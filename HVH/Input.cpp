@@ -151,7 +151,10 @@ void GameEngine::HandleInput(float dt)
         return;
     }
 
-    Physics(dt);
+    // hold still until the blocks around spawn have arrived
+    if (worldTransferClient.IsSpawnReady()) {
+        Physics(dt);
+    }
     UpdateCamera();
 
     if (gameMode == BUILD_MODE && (mouseStates[0] || mouseStates[2])) {
@@ -478,29 +481,11 @@ void GameEngine::HandleBuildModeMouseClick(UINT button)
         XMFLOAT3 rayDir;
         XMStoreFloat3(&rayDir, XMVector3Normalize(lookDir));
         XMFLOAT3 rayOrigin = cameraPosition;
-        float closestT = buildReach;
-        int hitIndex = -1;
-
-        for (int i = 0; i < (int)mapObjects.size(); ++i) {
-            const auto& obj = mapObjects[i];
-            AABB box;
-            box.min = { obj.position.x - obj.scale.x, obj.position.y - obj.scale.y, obj.position.z - obj.scale.z };
-            box.max = { obj.position.x + obj.scale.x, obj.position.y + obj.scale.y, obj.position.z + obj.scale.z };
-
-            float t;
-            if (RayIntersectsAABB(rayOrigin, rayDir, box, t) && t < closestT) {
-                closestT = t;
-                hitIndex = i;
-            }
-        }
 
-        if (hitIndex != -1) {
-            const auto& obj = mapObjects[hitIndex];
+        BlockRayHit hit;
+        if (RaycastBlocks(rayOrigin, rayDir, buildReach, hit)) {
             if (isMultiplayer) {
-                std::string removeData = "BLOCK:REMOVE|" +
-                    std::to_string(obj.position.x) + "," +
-                    std::to_string(obj.position.y) + "," +
-                    std::to_string(obj.position.z);
+                NetMessage removeData = NetMessage::BlockRemove(hit.blockPosition.x, hit.blockPosition.y, hit.blockPosition.z);
                 if (networkManager.IsServer()) {
                     networkManager.BroadcastData(removeData);
                 }
@@ -508,7 +493,7 @@ void GameEngine::HandleBuildModeMouseClick(UINT button)
                     networkManager.SendData(removeData);
                 }
             }
-            mapObjects.erase(mapObjects.begin() + hitIndex);
+            mapStore.RemoveBlock(hit.blockPosition.x, hit.blockPosition.y, hit.blockPosition.z);
             breakCooldown = BREAK_DELAY;
         }
     }
@@ -521,34 +506,8 @@ void GameEngine::HandleBuildModeMouseClick(UINT button)
         XMStoreFloat3(&rayDir, XMVector3Normalize(lookDir));
         XMFLOAT3 rayOrigin = cameraPosition;
 
-        float closestT = buildReach;
-        int hitIndex = -1;
-        XMFLOAT3 hitNormal = { 0.f, 0.f, 0.f };
-        XMFLOAT3 hitPoint = { 0.0f, 0.0f, 0.0f };
-
-        for (int i = 0; i < (int)mapObjects.size(); ++i) {
-            const auto& obj = mapObjects[i];
-            AABB box;
-            box.min = { obj.position.x - obj.scale.x, obj.position.y - obj.scale.y, obj.position.z - obj.scale.z };
-            box.max = { obj.position.x + obj.scale.x, obj.position.y + obj.scale.y, obj.position.z + obj.scale.z };
-
-            float t;
-            if (RayIntersectsAABB(rayOrigin, rayDir, box, t) && t < closestT) {
-                closestT = t;
-                hitIndex = i;
-                hitPoint.x = rayOrigin.x + t * rayDir.x;
-                hitPoint.y = rayOrigin.y + t * rayDir.y;
-                hitPoint.z = rayOrigin.z + t * rayDir.z;
-
-                float eps = 0.01f;
-                if (abs(hitPoint.x - box.min.x) < eps) hitNormal = { -1.f, 0.f, 0.f };
-                else if (abs(hitPoint.x - box.max.x) < eps) hitNormal = { 1.f, 0.f, 0.f };
-                else if (abs(hitPoint.y - box.min.y) < eps) hitNormal = { 0.f, -1.f, 0.f };
-                else if (abs(hitPoint.y - box.max.y) < eps) hitNormal = { 0.f, 1.f, 0.f };
-                else if (abs(hitPoint.z - box.min.z) < eps) hitNormal = { 0.f, 0.f, -1.f };
-                else if (abs(hitPoint.z - box.max.z) < eps) hitNormal = { 0.f, 0.f, 1.f };
-            }
-        }
+        BlockRayHit hit;
+        bool hitBlock = RaycastBlocks(rayOrigin, rayDir, buildReach, hit);
 
         bool hitFloor = false;
         float tFloor = -rayOrigin.y / rayDir.y;
@@ -565,8 +524,8 @@ void GameEngine::HandleBuildModeMouseClick(UINT button)
                 placeCooldown = PLACE_DELAY;
             }
         }
-        else if (hitIndex != -1) {
-            XMFLOAT3 newPos = GetPlacementPosition(hitPoint, hitNormal);
+        else if (hitBlock) {
+            XMFLOAT3 newPos = GetPlacementPosition(hit.point, hit.normal);
             if (!IsBlockAtPosition(newPos)) {
                 PlaceBlock(newPos);
                 placeCooldown = PLACE_DELAY;
@@ -581,25 +540,9 @@ void GameEngine::HandleBuildModeMouseClick(UINT button)
         XMStoreFloat3(&rayDir, XMVector3Normalize(lookDir));
         XMFLOAT3 rayOrigin = cameraPosition;
 
-        float closestT = buildReach;
-        int hitIndex = -1;
-
-        for (int i = 0; i < (int)mapObjects.size(); ++i) {
-            const auto& obj = mapObjects[i];
-            AABB box;
-            box.min = { obj.position.x - obj.scale.x, obj.position.y - obj.scale.y, obj.position.z - obj.scale.z };
-            box.max = { obj.position.x + obj.scale.x, obj.position.y + obj.scale.y, obj.position.z + obj.scale.z };
-
-            float t;
-            if (RayIntersectsAABB(rayOrigin, rayDir, box, t) && t < closestT) {
-                closestT = t;
-                hitIndex = i;
-            }
-        }
-
-        if (hitIndex != -1) {
-            const auto& obj = mapObjects[hitIndex];
-            inventoryBlocks[selectedInventorySlot] = obj.type;
+        BlockRayHit hit;
+        if (RaycastBlocks(rayOrigin, rayDir, buildReach, hit)) {
+            inventoryBlocks[selectedInventorySlot] = hit.block;
             UpdateInventorySelection();
         }
     }
@@ -635,10 +578,15 @@ void GameEngine::HandleHvHModeMouseClick(UINT button)
             }
         }
 
+        // no shooting through walls
+        BlockRayHit wall;
+        if (hitPlayerId != -1 && RaycastBlocks(rayOrigin, rayDir, closestT, wall)) {
+            hitPlayerId = -1;
+        }
+
         if (hitPlayerId != -1) {
             if (isMultiplayer) {
-                std::string hitData = "HIT:" + std::to_string(hitPlayerId);
-                networkManager.SendData(hitData);
+                networkManager.SendData(NetMessage::Player(NetMessageType::Hit, hitPlayerId));
             }
         }
     }
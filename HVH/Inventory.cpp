@@ -206,26 +206,33 @@ void GameEngine::CloseInventory()
         UpdateInventorySelection();
 
         std::lock_guard<std::recursive_mutex> lock(consoleHistoryMutex);
-        AddToHistory("Selected: " + creativeBlocks[creativeSelectedSlot]);
+        AddToHistory("Selected: " + BlockRegistry::GetName(creativeBlocks[creativeSelectedSlot]));
     }
 
     firstMouse = true;
 }
 
-ID3D11ShaderResourceView* GameEngine::GetTextureForBlock(const std::string& blockType)
+ID3D11ShaderResourceView* GameEngine::GetTextureForBlock(BlockId block)
 {
-    if (blockType == "grass") return pGrassSRV;
-    else if (blockType == "stone") return pStoneSRV;
-    else if (blockType == "wood") return pWoodSRV;
-    else if (blockType == "metal") return pMetalSRV;
-    else if (blockType == "brick") return pBrickSRV;
-    else if (blockType == "dirt") return pDirtSRV;
-    else if (blockType == "water") return pWaterSRV;
-    else if (blockType == "lava") return pLavaSRV;
-    else return pCubeSRV;
+    return GetBlockTextureSRV(BlockRegistry::Get(block).texture);
 }
 
-void GameEngine::RenderBlockInInventorySlot(int slotIndex, const std::string& blockType)
+ID3D11ShaderResourceView* GameEngine::GetBlockTextureSRV(BlockTexture texture)
+{
+    switch (texture) {
+    case BlockTexture::Grass: return pGrassSRV;
+    case BlockTexture::Stone: return pStoneSRV;
+    case BlockTexture::Wood: return pWoodSRV;
+    case BlockTexture::Metal: return pMetalSRV;
+    case BlockTexture::Brick: return pBrickSRV;
+    case BlockTexture::Dirt: return pDirtSRV;
+    case BlockTexture::Water: return pWaterSRV;
+    case BlockTexture::Lava: return pLavaSRV;
+    default: return pCubeSRV;
+    }
+}
+
+void GameEngine::RenderBlockInInventorySlot(int slotIndex, BlockId block)
 {
     const float slotSize = 40.0f;
     const float spacing = 5.0f;
@@ -288,7 +295,7 @@ void GameEngine::RenderBlockInInventorySlot(int slotIndex, const std::string& bl
     D3D11_SUBRESOURCE_DATA ibd = { iconIndices.data(), 0, 0 };
     pDevice->CreateBuffer(&ibDesc, &ibd, &tempIB);
 
-    ID3D11ShaderResourceView* texture = GetTextureForBlock(blockType);
+    ID3D11ShaderResourceView* texture = GetTextureForBlock(block);
 
     UINT stride2D = sizeof(XMFLOAT2) + sizeof(XMFLOAT4) + sizeof(XMFLOAT2);
     UINT offset2D = 0;
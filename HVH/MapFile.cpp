@@ -0,0 +1,488 @@
+#include "MapFile.h"
+#include "BlockRegistry.h"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <unordered_map>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <cstdio>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+    const char MAGIC[4] = { 'H', 'V', 'H', 'M' };
+
+    // LZ sequences: token (literal count << 4 | match length - 4, 15 = more
+    // bytes follow), literals, u16 offset. The last sequence has no match.
+    const size_t LZ_MIN_MATCH = 4;
+    const int LZ_HASH_BITS = 12;
+
+    void PutU16(std::vector<char>& out, uint16_t v)
+    {
+        out.push_back((char)(v & 0xFF));
+        out.push_back((char)((v >> 8) & 0xFF));
+    }
+
+    void PutU32(std::vector<char>& out, uint32_t v)
+    {
+        out.push_back((char)(v & 0xFF));
+        out.push_back((char)((v >> 8) & 0xFF));
+        out.push_back((char)((v >> 16) & 0xFF));
+        out.push_back((char)((v >> 24) & 0xFF));
+    }
+
+    void PutF32(std::vector<char>& out, float f)
+    {
+        uint32_t v;
+        memcpy(&v, &f, sizeof(v));
+        PutU32(out, v);
+    }
+
+    void SetU32(std::vector<char>& out, size_t pos, uint32_t v)
+    {
+        out[pos] = (char)(v & 0xFF);
+        out[pos + 1] = (char)((v >> 8) & 0xFF);
+        out[pos + 2] = (char)((v >> 16) & 0xFF);
+        out[pos + 3] = (char)((v >> 24) & 0xFF);
+    }
+
+    uint16_t GetU16(const char* p)
+    {
+        const unsigned char* b = (const unsigned char*)p;
+        return (uint16_t)(b[0] | (b[1] << 8));
+    }
+
+    uint32_t GetU32(const char* p)
+    {
+        const unsigned char* b = (const unsigned char*)p;
+        return (uint32_t)b[0] | ((uint32_t)b[1] << 8) | ((uint32_t)b[2] << 16) | ((uint32_t)b[3] << 24);
+    }
+
+    float GetF32(const char* p)
+    {
+        uint32_t v = GetU32(p);
+        float f;
+        memcpy(&f, &v, sizeof(f));
+        return f;
+    }
+
+    void PutVarint(std::vector<char>& out, uint32_t v)
+    {
+        while (v >= 0x80) {
+            out.push_back((char)((v & 0x7F) | 0x80));
+            v >>= 7;
+        }
+        out.push_back((char)v);
+    }
+
+    bool GetVarint(const char* data, size_t size, size_t& pos, uint32_t& v)
+    {
+        v = 0;
+        for (int shift = 0; shift < 35; shift += 7) {
+            if (pos >= size) return false;
+            unsigned char b = (unsigned char)data[pos++];
+            v |= (uint32_t)(b & 0x7F) << shift;
+            if (!(b & 0x80)) return true;
+        }
+        return false;
+    }
+
+    uint32_t Crc32(const char* data, size_t size)
+    {
+        // built once, thread-safe; saves and loads run on the map worker
+        static const std::vector<uint32_t> table = [] {
+            std::vector<uint32_t> t(256);
+            for (uint32_t i = 0; i < 256; ++i) {
+                uint32_t c = i;
+                for (int k = 0; k < 8; ++k) c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+                t[i] = c;
+            }
+            return t;
+            }();
+
+        uint32_t crc = 0xFFFFFFFFu;
+        for (size_t i = 0; i < size; ++i) {
+            crc = table[(crc ^ (unsigned char)data[i]) & 0xFF] ^ (crc >> 8);
+        }
+        return crc ^ 0xFFFFFFFFu;
+    }
+
+    void PutLzLength(std::vector<char>& out, size_t length)
+    {
+        while (length >= 255) {
+            out.push_back((char)255);
+            length -= 255;
+        }
+        out.push_back((char)length);
+    }
+
+    void LzCompress(const std::vector<char>& in, std::vector<char>& out)
+    {
+        const size_t n = in.size();
+        std::vector<int> table(1 << LZ_HASH_BITS, -1);
+
+        auto emit = [&](size_t literalStart, size_t literalEnd, size_t offset, size_t matchLength) {
+            size_t literals = literalEnd - literalStart;
+            size_t match = matchLength ? matchLength - LZ_MIN_MATCH : 0;
+            out.push_back((char)(((literals < 15 ? literals : 15) << 4) | (match < 15 ? match : 15)));
+            if (literals >= 15) PutLzLength(out, literals - 15);
+            out.insert(out.end(), in.begin() + literalStart, in.begin() + literalEnd);
+            if (matchLength) {
+                PutU16(out, (uint16_t)offset);
+                if (match >= 15) PutLzLength(out, match - 15);
+            }
+            };
+
+        size_t anchor = 0;
+        size_t i = 0;
+        while (i + LZ_MIN_MATCH <= n) {
+            uint32_t word;
+            memcpy(&word, in.data() + i, sizeof(word));
+            uint32_t hash = (word * 2654435761u) >> (32 - LZ_HASH_BITS);
+            int candidate = table[hash];
+            table[hash] = (int)i;
+
+            if (candidate >= 0 && i - candidate <= 0xFFFF && memcmp(in.data() + candidate, in.data() + i, LZ_MIN_MATCH) == 0) {
+                size_t length = LZ_MIN_MATCH;
+                while (i + length < n && in[candidate + length] == in[i + length]) ++length;
+                emit(anchor, i, i - candidate, length);
+                i += length;
+                anchor = i;
+            }
+            else {
+                ++i;
+            }
+        }
+        emit(anchor, n, 0, 0);
+    }
+
+    bool GetLzLength(const char* data, size_t size, size_t& pos, size_t& length)
+    {
+        unsigned char b;
+        do {
+            if (pos >= size) return false;
+            b = (unsigned char)data[pos++];
+            length += b;
+        } while (b == 255);
+        return true;
+    }
+
+    bool LzDecompress(const char* data, size_t size, std::vector<char>& out, size_t expected)
+    {
+        out.clear();
+        out.reserve(expected);
+        size_t pos = 0;
+        while (pos < size) {
+            unsigned char token = (unsigned char)data[pos++];
+            size_t literals = token >> 4;
+            if (literals == 15 && !GetLzLength(data, size, pos, literals)) return false;
+            if (pos + literals > size || out.size() + literals > expected) return false;
+            out.insert(out.end(), data + pos, data + pos + literals);
+            pos += literals;
+            if (pos == size) break;
+
+            if (pos + 2 > size) return false;
+            size_t offset = GetU16(data + pos);
+            pos += 2;
+            size_t length = token & 15;
+            if (length == 15 && !GetLzLength(data, size, pos, length)) return false;
+            length += LZ_MIN_MATCH;
+            if (offset == 0 || offset > out.size() || out.size() + length > expected) return false;
+
+            // byte by byte, a match may overlap what it is copying
+            size_t from = out.size() - offset;
+            for (size_t k = 0; k < length; ++k) out.push_back(out[from + k]);
+        }
+        return out.size() == expected;
+    }
+}
+
+bool SaveMapFile(const std::string& path, const VoxelWorld& world,
+    const std::vector<ParkourObject>& objects, bool compress,
+    const std::function<void(float)>& progress)
+{
+    std::vector<std::string> typeNames;
+    std::unordered_map<std::string, uint32_t> typeIndex;
+    auto indexOf = [&](const std::string& name) {
+        std::string stored = name.substr(0, 255);
+        auto it = typeIndex.find(stored);
+        if (it != typeIndex.end()) return it->second;
+        typeNames.push_back(stored);
+        return typeIndex[stored] = (uint32_t)typeNames.size();
+        };
+
+    // same map, same bytes
+    std::vector<ChunkCoords> coords;
+    world.GetChunkCoords(coords);
+    std::sort(coords.begin(), coords.end(), [](const ChunkCoords& a, const ChunkCoords& b) {
+        if (a.cy != b.cy) return a.cy < b.cy;
+        if (a.cz != b.cz) return a.cz < b.cz;
+        return a.cx < b.cx;
+        });
+
+    std::vector<char> directory;
+    std::vector<char> payloads;
+    std::vector<char> raw, packed;
+    for (size_t n = 0; n < coords.size(); ++n) {
+        const ChunkCoords& c = coords[n];
+        const VoxelChunk* chunk = world.FindChunk(c.cx, c.cy, c.cz);
+        if (progress && (n & 255) == 0) progress((float)n / coords.size());
+
+        raw.clear();
+        int i = 0;
+        while (i < VOXEL_CHUNK_VOLUME) {
+            BlockId id = chunk->blocks[i];
+            int end = i + 1;
+            while (end < VOXEL_CHUNK_VOLUME && chunk->blocks[end] == id) ++end;
+            PutVarint(raw, id == BLOCK_AIR ? 0 : indexOf(BlockRegistry::GetName(id)));
+            PutVarint(raw, (uint32_t)(end - i));
+            i = end;
+        }
+
+        const std::vector<char>* stored = &raw;
+        uint8_t encoding = MAP_CHUNK_RLE;
+        if (compress) {
+            packed.clear();
+            LzCompress(raw, packed);
+            if (packed.size() < raw.size()) {
+                stored = &packed;
+                encoding = MAP_CHUNK_RLE_LZ;
+            }
+        }
+
+        PutU32(directory, (uint32_t)c.cx);
+        PutU32(directory, (uint32_t)c.cy);
+        PutU32(directory, (uint32_t)c.cz);
+        PutU32(directory, (uint32_t)payloads.size());
+        PutU32(directory, (uint32_t)stored->size());
+        PutU16(directory, (uint16_t)raw.size());
+        directory.push_back((char)encoding);
+        directory.push_back(0);
+        PutU32(directory, Crc32(stored->data(), stored->size()));
+        payloads.insert(payloads.end(), stored->begin(), stored->end());
+    }
+
+    std::vector<char> objectData;
+    for (const ParkourObject& obj : objects) {
+        PutU32(objectData, indexOf(obj.type));
+        PutF32(objectData, obj.position.x); PutF32(objectData, obj.position.y); PutF32(objectData, obj.position.z);
+        PutF32(objectData, obj.rotation.x); PutF32(objectData, obj.rotation.y); PutF32(objectData, obj.rotation.z);
+        PutF32(objectData, obj.scale.x); PutF32(objectData, obj.scale.y); PutF32(objectData, obj.scale.z);
+        PutF32(objectData, obj.color.x); PutF32(objectData, obj.color.y); PutF32(objectData, obj.color.z);
+        PutF32(objectData, obj.color.w);
+    }
+
+    std::vector<char> file(MAGIC, MAGIC + 4);
+    PutU16(file, MAP_FILE_VERSION);
+    PutU16(file, 0);
+    PutU32(file, (uint32_t)typeNames.size());
+    PutU32(file, (uint32_t)coords.size());
+    PutU32(file, (uint32_t)objects.size());
+    PutU32(file, (uint32_t)world.GetBlockCount());
+    PutU32(file, 0); // checksum, below
+    PutU32(file, 0); // data offset, below
+
+    for (const std::string& name : typeNames) {
+        file.push_back((char)name.size());
+        file.insert(file.end(), name.begin(), name.end());
+    }
+    file.insert(file.end(), directory.begin(), directory.end());
+    file.insert(file.end(), objectData.begin(), objectData.end());
+
+    SetU32(file, 24, Crc32(file.data() + MAP_FILE_HEADER_SIZE, file.size() - MAP_FILE_HEADER_SIZE));
+    SetU32(file, 28, (uint32_t)file.size());
+    file.insert(file.end(), payloads.begin(), payloads.end());
+
+    std::string temp = path + ".tmp";
+    {
+        std::ofstream out(temp, std::ios::binary | std::ios::trunc);
+        if (!out.is_open()) return false;
+        out.write(file.data(), (std::streamsize)file.size());
+        if (!out.good()) return false;
+    }
+#ifdef _WIN32
+    if (!MoveFileExA(temp.c_str(), path.c_str(), MOVEFILE_REPLACE_EXISTING)) return false;
+#else
+    if (std::rename(temp.c_str(), path.c_str()) != 0) return false;
+#endif
+    if (progress) progress(1.0f);
+    return true;
+}
+
+MapFileStatus MapFileReader::Open(const std::string& path)
+{
+    Close();
+
+#ifdef _WIN32
+    HANDLE handle = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+        FILE_ATTRIBUTE_NORMAL, NULL);
+    if (handle == INVALID_HANDLE_VALUE) return MapFileStatus::OpenFailed;
+    file = handle;
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(handle, &fileSize)) {
+        Close();
+        return MapFileStatus::OpenFailed;
+    }
+    // an empty file can't be mapped, and isn't a map either
+    if (fileSize.QuadPart < (LONGLONG)MAP_FILE_HEADER_SIZE) {
+        Close();
+        return MapFileStatus::NotMapFile;
+    }
+
+    mapping = CreateFileMappingA(handle, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (mapping) {
+        data = (const char*)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    }
+    if (!data) {
+        Close();
+        return MapFileStatus::OpenFailed;
+    }
+    size = (size_t)fileSize.QuadPart;
+#else
+    // the mapping outlives the descriptor, so there's nothing else to keep
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) return MapFileStatus::OpenFailed;
+
+    struct stat info;
+    if (fstat(fd, &info) != 0) {
+        close(fd);
+        return MapFileStatus::OpenFailed;
+    }
+    if (info.st_size < (off_t)MAP_FILE_HEADER_SIZE) {
+        close(fd);
+        return MapFileStatus::NotMapFile;
+    }
+
+    void* view = mmap(nullptr, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (view == MAP_FAILED) return MapFileStatus::OpenFailed;
+    data = (const char*)view;
+    size = (size_t)info.st_size;
+#endif
+
+    MapFileStatus status = Parse();
+    if (status != MapFileStatus::Ok) Close();
+    return status;
+}
+
+void MapFileReader::Close()
+{
+#ifdef _WIN32
+    if (data) UnmapViewOfFile(data);
+    if (mapping) CloseHandle(mapping);
+    if (file) CloseHandle(file);
+#else
+    if (data) munmap((void*)data, size);
+#endif
+    data = nullptr;
+    mapping = nullptr;
+    file = nullptr;
+    size = 0;
+
+    dataOffset = 0;
+    blockCount = 0;
+    types.clear();
+    directory.clear();
+    objects.clear();
+}
+
+MapFileStatus MapFileReader::Parse()
+{
+    if (memcmp(data, MAGIC, 4) != 0) return MapFileStatus::NotMapFile;
+    if (GetU16(data + 4) != MAP_FILE_VERSION) return MapFileStatus::UnsupportedVersion;
+
+    uint32_t typeCount = GetU32(data + 8);
+    uint32_t chunkCount = GetU32(data + 12);
+    uint32_t objectCount = GetU32(data + 16);
+    blockCount = GetU32(data + 20);
+    dataOffset = GetU32(data + 28);
+    if (dataOffset < MAP_FILE_HEADER_SIZE || dataOffset > size) return MapFileStatus::Corrupt;
+    if (Crc32(data + MAP_FILE_HEADER_SIZE, dataOffset - MAP_FILE_HEADER_SIZE) != GetU32(data + 24)) {
+        return MapFileStatus::Corrupt;
+    }
+
+    size_t pos = MAP_FILE_HEADER_SIZE;
+    types.assign(1, BLOCK_AIR);
+    std::vector<std::string> names(1);
+    for (uint32_t i = 0; i < typeCount; ++i) {
+        if (pos >= dataOffset) return MapFileStatus::Corrupt;
+        size_t len = (unsigned char)data[pos++];
+        if (pos + len > dataOffset) return MapFileStatus::Corrupt;
+        names.emplace_back(data + pos, len);
+        types.push_back(BlockRegistry::Intern(names.back()));
+        pos += len;
+    }
+
+    if ((dataOffset - pos) / MAP_FILE_DIRECTORY_ENTRY_SIZE < chunkCount) return MapFileStatus::Corrupt;
+    directory.resize(chunkCount);
+    for (DirectoryEntry& entry : directory) {
+        entry.coords.cx = (int32_t)GetU32(data + pos);
+        entry.coords.cy = (int32_t)GetU32(data + pos + 4);
+        entry.coords.cz = (int32_t)GetU32(data + pos + 8);
+        entry.offset = GetU32(data + pos + 12);
+        entry.storedSize = GetU32(data + pos + 16);
+        entry.decodedSize = GetU16(data + pos + 20);
+        entry.encoding = (uint8_t)data[pos + 22];
+        entry.checksum = GetU32(data + pos + 24);
+        pos += MAP_FILE_DIRECTORY_ENTRY_SIZE;
+
+        if ((uint64_t)entry.offset + entry.storedSize > size - dataOffset) return MapFileStatus::Corrupt;
+    }
+
+    if ((uint64_t)objectCount * MAP_FILE_OBJECT_SIZE != dataOffset - pos) return MapFileStatus::Corrupt;
+    objects.resize(objectCount);
+    for (ParkourObject& obj : objects) {
+        uint32_t type = GetU32(data + pos);
+        if (type == 0 || type >= names.size()) return MapFileStatus::Corrupt;
+        obj.type = names[type];
+        const char* f = data + pos + 4;
+        obj.position = { GetF32(f), GetF32(f + 4), GetF32(f + 8) };
+        obj.rotation = { GetF32(f + 12), GetF32(f + 16), GetF32(f + 20) };
+        obj.scale = { GetF32(f + 24), GetF32(f + 28), GetF32(f + 32) };
+        obj.color = { GetF32(f + 36), GetF32(f + 40), GetF32(f + 44), GetF32(f + 48) };
+        pos += MAP_FILE_OBJECT_SIZE;
+    }
+    return MapFileStatus::Ok;
+}
+
+ChunkCoords MapFileReader::GetChunkCoords(size_t index) const
+{
+    return directory[index].coords;
+}
+
+bool MapFileReader::DecodeChunk(size_t index, BlockId blocks[VOXEL_CHUNK_VOLUME]) const
+{
+    const DirectoryEntry& entry = directory[index];
+    const char* stored = data + dataOffset + entry.offset;
+    if (Crc32(stored, entry.storedSize) != entry.checksum) return false;
+
+    const char* runs = stored;
+    size_t runsSize = entry.storedSize;
+    std::vector<char> decompressed;
+    if (entry.encoding == MAP_CHUNK_RLE_LZ) {
+        if (!LzDecompress(stored, entry.storedSize, decompressed, entry.decodedSize)) return false;
+        runs = decompressed.data();
+        runsSize = decompressed.size();
+    }
+    else if (entry.encoding != MAP_CHUNK_RLE) {
+        return false;
+    }
+
+    size_t pos = 0;
+    uint32_t voxel = 0;
+    while (pos < runsSize) {
+        uint32_t type, length;
+        if (!GetVarint(runs, runsSize, pos, type) || !GetVarint(runs, runsSize, pos, length)) return false;
+        if (type >= types.size() || length > (uint32_t)VOXEL_CHUNK_VOLUME - voxel) return false;
+        std::fill(blocks + voxel, blocks + voxel + length, types[type]);
+        voxel += length;
+    }
+    return voxel == (uint32_t)VOXEL_CHUNK_VOLUME;
+}
@@ -0,0 +1,97 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+#include "VoxelWorld.h"
+#include "map1.h"
+
+// Binary map file, little endian:
+//   header (MAP_FILE_HEADER_SIZE bytes): "HVHM", u16 version, u16 reserved,
+//     u32 type count, u32 chunk count, u32 object count, u32 block count,
+//     u32 CRC-32 of everything from the end of the header to the data offset,
+//     u32 data offset
+//   block type table: u8 length + name per type, file type index 1.. (0 = air)
+//   chunk directory: i32 cx, cy, cz, u32 offset from the data offset,
+//     u32 stored size, u16 decoded size, u8 encoding, u8 reserved, u32 CRC-32
+//     of the stored bytes
+//   sparse objects: u32 type index, position, rotation, scale, color (f32 each)
+//   chunk payloads: runs of (varint type index, varint length) in
+//     VoxelChunk::Index order, optionally LZ compressed
+// The directory is all a reader needs up front; chunks are decoded (and their
+// checksum verified) one at a time, straight from the mapped file, with no
+// copy of the payloads. MapIoWorker still decodes every chunk before handing
+// the world over, not on first touch (see MapIoWorker::StartLoad).
+const uint16_t MAP_FILE_VERSION = 1;
+const size_t MAP_FILE_HEADER_SIZE = 32;
+const size_t MAP_FILE_DIRECTORY_ENTRY_SIZE = 28;
+const size_t MAP_FILE_OBJECT_SIZE = 4 + 13 * 4;
+
+enum MapChunkEncoding : uint8_t {
+    MAP_CHUNK_RLE = 0,
+    MAP_CHUNK_RLE_LZ = 1
+};
+
+enum class MapFileStatus {
+    Ok,
+    OpenFailed,
+    NotMapFile,     // no magic, probably an old text map
+    UnsupportedVersion,
+    Corrupt
+};
+
+// Voxel chunks plus the objects that don't fit the lattice. LZ is kept per
+// chunk only where it actually shrinks it. The file is written next to path
+// and renamed over it, so an interrupted save leaves the old map intact.
+// progress, if set, gets the fraction of chunks encoded.
+bool SaveMapFile(const std::string& path, const VoxelWorld& world,
+    const std::vector<ParkourObject>& objects, bool compress = true,
+    const std::function<void(float)>& progress = nullptr);
+
+class MapFileReader
+{
+public:
+    MapFileReader() {}
+    ~MapFileReader() { Close(); }
+    MapFileReader(const MapFileReader&) = delete;
+    MapFileReader& operator=(const MapFileReader&) = delete;
+
+    // Maps the file and checks the header, type table, directory and objects.
+    // Chunk payloads aren't touched until decoded.
+    MapFileStatus Open(const std::string& path);
+    void Close();
+
+    size_t GetChunkCount() const { return directory.size(); }
+    ChunkCoords GetChunkCoords(size_t index) const;
+    uint32_t GetBlockCount() const { return blockCount; }
+    size_t GetFileSize() const { return size; }
+    const std::vector<ParkourObject>& GetObjects() const { return objects; }
+
+    // Decodes one chunk into blocks, file types interned through BlockRegistry.
+    // False on a checksum or encoding error.
+    bool DecodeChunk(size_t index, BlockId blocks[VOXEL_CHUNK_VOLUME]) const;
+
+private:
+    struct DirectoryEntry {
+        ChunkCoords coords;
+        uint32_t offset;
+        uint32_t storedSize;
+        uint16_t decodedSize;
+        uint8_t encoding;
+        uint32_t checksum;
+    };
+
+    MapFileStatus Parse();
+
+    void* file = nullptr;      // HANDLEs on Windows, kept out of the header
+    void* mapping = nullptr;
+    const char* data = nullptr;
+    size_t size = 0;
+
+    size_t dataOffset = 0;
+    uint32_t blockCount = 0;
+    std::vector<BlockId> types;  // file type index -> BlockId, [0] is air
+    std::vector<DirectoryEntry> directory;
+    std::vector<ParkourObject> objects;
+};
@@ -0,0 +1,139 @@
+#include "MapIo.h"
+#include "BlockRegistry.h"
+#include <chrono>
+
+namespace {
+
+    float MillisecondsSince(std::chrono::steady_clock::time_point start)
+    {
+        return std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+
+    // same rule WorldStore::AddObject uses to put a block in the voxel world
+    bool ToVoxel(const ParkourObject& obj, int& x, int& y, int& z)
+    {
+        return obj.scale.x == 1.0f && obj.scale.y == 1.0f && obj.scale.z == 1.0f &&
+            obj.rotation.x == 0.0f && obj.rotation.y == 0.0f && obj.rotation.z == 0.0f &&
+            VoxelWorld::ToLattice(obj.position.x, obj.position.y, obj.position.z, x, y, z);
+    }
+}
+
+MapIoWorker::~MapIoWorker()
+{
+    // an unfinished save is still worth finishing
+    if (worker.joinable()) worker.join();
+}
+
+void MapIoWorker::Start()
+{
+    if (worker.joinable()) worker.join();
+
+    result = MapIoResult();
+    result.kind = kind;
+    progress = 0.0f;
+    finished = false;
+    busy = true;
+}
+
+bool MapIoWorker::StartSave(const std::string& path, const std::string& name,
+    VoxelWorld snapshot, std::vector<ParkourObject> objects)
+{
+    if (busy) return false;
+    kind = MapIoResult::Kind::Save;
+    Start();
+    result.name = name;
+
+    worker = std::thread([this, path, name, world = std::move(snapshot), objects = std::move(objects)]() {
+        auto start = std::chrono::steady_clock::now();
+        result.ok = !path.empty() && SaveMapFile(path, world, objects, true,
+            [this](float fraction) { progress = fraction; });
+        result.milliseconds = MillisecondsSince(start);
+        result.message = result.ok ?
+            "Map saved to Documents/HVHproject/" + name + " (" + std::to_string((int)result.milliseconds) + " ms)" :
+            "Failed to save map to Documents/HVHproject/" + name;
+        finished = true;
+        });
+    return true;
+}
+
+bool MapIoWorker::StartLoad(const std::string& name)
+{
+    if (busy) return false;
+    kind = MapIoResult::Kind::Load;
+    Start();
+    result.name = name;
+
+    worker = std::thread([this, name]() {
+        auto start = std::chrono::steady_clock::now();
+        LoadJob(name);
+        result.milliseconds = MillisecondsSince(start);
+        finished = true;
+        });
+    return true;
+}
+
+void MapIoWorker::LoadJob(const std::string& name)
+{
+    MapFileReader reader;
+    MapFileStatus status = reader.Open(ParkourMap::GetMapPath(name));
+
+    if (status == MapFileStatus::Ok) {
+        std::vector<BlockId> blocks(VOXEL_CHUNK_VOLUME);
+        size_t badChunks = 0;
+        size_t count = reader.GetChunkCount();
+        for (size_t i = 0; i < count; ++i) {
+            if (!reader.DecodeChunk(i, blocks.data())) {
+                badChunks++;
+                continue;
+            }
+            ChunkCoords c = reader.GetChunkCoords(i);
+            result.world.SetChunk(c.cx, c.cy, c.cz, blocks.data());
+            if ((i & 255) == 0) progress = (float)i / count;
+        }
+        result.objects = reader.GetObjects();
+        result.ok = true;
+        result.message = "Map loaded from Documents/HVHproject/" + name;
+        if (badChunks > 0) {
+            result.message += ", skipped " + std::to_string(badChunks) + " damaged chunks";
+        }
+        return;
+    }
+
+    if (status != MapFileStatus::NotMapFile) {
+        result.message = status == MapFileStatus::UnsupportedVersion ?
+            "Map file version not supported: " + name :
+            "Failed to load map from Documents/HVHproject/" + name;
+        return;
+    }
+
+    // maps saved before the binary format, one text line per object
+    std::vector<ParkourObject> parkourObjects = ParkourMap::LoadParkourCourse(name);
+    if (parkourObjects.empty()) {
+        result.message = "Failed to load map from Documents/HVHproject/" + name;
+        return;
+    }
+    for (size_t i = 0; i < parkourObjects.size(); ++i) {
+        const ParkourObject& obj = parkourObjects[i];
+        int x, y, z;
+        if (ToVoxel(obj, x, y, z)) {
+            result.world.SetBlock(x, y, z, BlockRegistry::Intern(obj.type));
+        }
+        else {
+            result.objects.push_back(obj);
+        }
+        if ((i & 4095) == 0) progress = (float)i / parkourObjects.size();
+    }
+    result.ok = true;
+    result.message = "Map loaded from Documents/HVHproject/" + name;
+}
+
+bool MapIoWorker::Poll(MapIoResult& out)
+{
+    if (!busy || !finished) return false;
+
+    worker.join();
+    out = std::move(result);
+    result = MapIoResult();
+    busy = false;
+    return true;
+}
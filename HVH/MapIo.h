@@ -0,0 +1,60 @@
+#pragma once
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+#include "MapFile.h"
+
+// A finished background save or load, handed back to the main thread.
+struct MapIoResult {
+    enum class Kind { Save, Load };
+
+    Kind kind = Kind::Save;
+    bool ok = false;
+    std::string name;                   // file under Documents/HVHproject
+    std::string message;                // for the console
+    VoxelWorld world;                   // Load: every unit block
+    std::vector<ParkourObject> objects; // Load: whatever doesn't fit the lattice
+    float milliseconds = 0.0f;
+};
+
+// Runs one map save or load at a time on a worker thread. A save serializes a
+// VoxelWorld::Snapshot, so the live world can keep changing; a load builds a
+// separate world for the main thread to swap in once Poll hands it over.
+class MapIoWorker
+{
+public:
+    ~MapIoWorker();
+
+    // False while another job is running. snapshot's source world keeps
+    // copying edited chunks until Poll has returned this save and the caller
+    // calls its ReleaseSnapshots.
+    bool StartSave(const std::string& path, const std::string& name,
+        VoxelWorld snapshot, std::vector<ParkourObject> objects);
+    // name is the file under Documents/HVHproject, old text maps load too.
+    // Every chunk is decoded here, on the worker, rather than lazily the first
+    // time it's touched: VoxelWorld's const lookups run on the rigid body
+    // threads, and its chunks are shared with save snapshots read on this
+    // worker, so decoding on a miss would need a lock on every lookup.
+    // Decoding a 1M block map takes ~20 ms, off the main thread (hvh-bench
+    // map_file).
+    bool StartLoad(const std::string& name);
+
+    bool IsBusy() const { return busy; }
+    MapIoResult::Kind GetKind() const { return kind; }
+    float GetProgress() const { return progress; }
+
+    // Main thread, once per tick. True once per job, when it has finished.
+    bool Poll(MapIoResult& out);
+
+private:
+    void Start();
+    void LoadJob(const std::string& name);
+
+    std::thread worker;
+    std::atomic<bool> busy{ false };
+    std::atomic<bool> finished{ false };
+    std::atomic<float> progress{ 0.0f };
+    MapIoResult::Kind kind = MapIoResult::Kind::Save;
+    MapIoResult result; // the worker's until finished is set
+};
@@ -1,4084 +0,0 @@
-#include "GameEngine.h"
-//H V H   T E X T U R E   D A T A
-//================================
-//Generated by HVH Texture Editor v1.0
-#include <vector>
-bool GameEngine::CreateMetalTextureSRV(UINT size, ID3D11ShaderResourceView** outSRV) {
-    static ID3D11ShaderResourceView* cachedSRV = nullptr;
-    if (cachedSRV) {
-        *outSRV = cachedSRV;
-        return true;
-    }
-
-    if (size != 64) return false;
-
-    static const struct PixelSegment {
-        BYTE r, g, b, a;
-        int count;
-    } segments[] = {
-        {178, 178, 178, 77, 1},
-        {165, 165, 165, 140, 1},
-        {132, 132, 132, 140, 1},
-        {187, 187, 187, 140, 1},
-        {162, 162, 162, 140, 1},
-        {178, 178, 178, 140, 1},
-        {203, 203, 203, 140, 1},
-        {205, 205, 205, 140, 1},
-        {145, 145, 145, 140, 1},
-        {52, 52, 52, 140, 1},
-        {169, 169, 169, 140, 1},
-        {111, 111, 111, 140, 1},
-        {185, 185, 185, 140, 1},
-        {162, 162, 162, 140, 1},
-        {178, 178, 178, 140, 1},
-        {173, 173, 173, 140, 1},
-        {185, 185, 185, 140, 2},
-        {54, 54, 54, 140, 1},
-        {145, 145, 145, 140, 1},
-        {123, 123, 123, 140, 1},
-        {154, 154, 154, 140, 1},
-        {180, 180, 180, 140, 1},
-        {165, 165, 165, 140, 1},
-        {183, 183, 183, 140, 1},
-        {202, 202, 202, 140, 1},
-        {198, 198, 198, 140, 1},
-        {92, 92, 92, 140, 1},
-        {91, 91, 91, 140, 1},
-        {162, 162, 162, 140, 1},
-        {140, 140, 140, 140, 1},
-        {185, 185, 185, 140, 1},
-        {156, 156, 156, 140, 1},
-        {163, 163, 163, 140, 1},
-        {198, 198, 198, 140, 1},
-        {213, 213, 213, 140, 1},
-        {143, 143, 143, 140, 1},
-        {54, 54, 54, 140, 1},
-        {162, 162, 162, 140, 1},
-        {120, 120, 120, 140, 1},
-        {185, 185, 185, 140, 1},
-        {158, 158, 158, 140, 1},
-        {167, 167, 167, 140, 1},
-        {193, 193, 193, 140, 1},
-        {205, 205, 205, 140, 1},
-        {189, 189, 189, 140, 1},
-        {61, 61, 61, 140, 1},
-        {149, 149, 149, 140, 1},
-        {123, 123, 123, 140, 1},
-        {154, 154, 154, 140, 1},
-        {169, 169, 169, 140, 1},
-        {171, 171, 171, 140, 1},
-        {183, 183, 183, 140, 1},
-        {202, 202, 202, 140, 1},
-        {198, 198, 198, 140, 1},
-        {85, 85, 85, 140, 1},
-        {89, 89, 89, 140, 1},
-        {156, 156, 156, 140, 1},
-        {131, 131, 131, 140, 1},
-        {176, 176, 176, 140, 1},
-        {167, 167, 167, 140, 1},
-        {183, 183, 183, 140, 1},
-        {203, 203, 203, 140, 1},
-        {220, 220, 220, 140, 1},
-        {113, 113, 113, 151, 1},
-        {130, 130, 130, 255, 1},
-        {115, 115, 115, 255, 1},
-        {194, 194, 194, 255, 1},
-        {200, 200, 200, 255, 1},
-        {202, 202, 202, 255, 1},
-        {162, 162, 162, 255, 1},
-        {149, 149, 149, 255, 1},
-        {207, 207, 207, 255, 1},
-        {149, 149, 149, 255, 1},
-        {110, 110, 110, 255, 1},
-        {96, 96, 96, 255, 1},
-        {167, 167, 167, 255, 1},
-        {202, 202, 202, 255, 2},
-        {145, 145, 145, 255, 1},
-        {125, 125, 125, 255, 1},
-        {194, 194, 194, 255, 1},
-        {178, 178, 178, 255, 1},
-        {110, 110, 110, 255, 1},
-        {102, 102, 102, 255, 1},
-        {131, 131, 131, 255, 1},
-        {207, 207, 207, 255, 1},
-        {203, 203, 203, 255, 1},
-        {176, 176, 176, 255, 1},
-        {133, 133, 133, 255, 1},
-        {169, 169, 169, 255, 1},
-        {202, 202, 202, 255, 1},
-        {115, 115, 115, 255, 1},
-        {107, 107, 107, 255, 1},
-        {122, 122, 122, 255, 1},
-        {199, 199, 199, 255, 2},
-        {189, 189, 189, 255, 1},
-        {145, 145, 145, 255, 1},
-        {152, 152, 152, 255, 1},
-        {203, 203, 203, 255, 1},
-        {143, 143, 143, 255, 1},
-        {109, 109, 109, 255, 1},
-        {95, 95, 95, 255, 1},
-        {167, 167, 167, 255, 1},
-        {203, 203, 203, 255, 1},
-        {205, 205, 205, 255, 1},
-        {175, 175, 175, 255, 1},
-        {137, 137, 137, 255, 1},
-        {195, 195, 195, 255, 1},
-        {178, 178, 178, 255, 1},
-        {105, 105, 105, 255, 2},
-        {132, 132, 132, 255, 1},
-        {201, 201, 201, 255, 1},
-        {209, 209, 209, 255, 1},
-        {188, 188, 188, 255, 1},
-        {133, 133, 133, 255, 1},
-        {167, 167, 167, 255, 1},
-        {201, 201, 201, 255, 1},
-        {108, 108, 108, 255, 1},
-        {103, 103, 103, 255, 1},
-        {111, 111, 111, 255, 1},
-        {194, 194, 194, 255, 1},
-        {204, 204, 204, 255, 1},
-        {196, 196, 196, 255, 1},
-        {151, 151, 151, 255, 1},
-        {169, 169, 169, 255, 1},
-        {182, 182, 182, 140, 1},
-        {169, 169, 169, 255, 1},
-        {123, 123, 123, 255, 1},
-        {174, 174, 174, 255, 1},
-        {161, 161, 161, 255, 1},
-        {96, 96, 96, 255, 1},
-        {97, 97, 97, 255, 1},
-        {124, 124, 124, 255, 1},
-        {197, 197, 197, 255, 1},
-        {190, 190, 190, 255, 1},
-        {160, 160, 160, 255, 1},
-        {110, 110, 110, 255, 1},
-        {152, 152, 152, 255, 1},
-        {199, 199, 199, 255, 1},
-        {101, 101, 101, 255, 1},
-        {100, 100, 100, 255, 1},
-        {94, 94, 94, 255, 1},
-        {180, 180, 180, 255, 1},
-        {189, 189, 189, 255, 2},
-        {122, 122, 122, 255, 1},
-        {124, 124, 124, 255, 1},
-        {204, 204, 204, 255, 1},
-        {134, 134, 134, 255, 1},
-        {96, 96, 96, 255, 1},
-        {85, 85, 85, 255, 1},
-        {152, 152, 152, 255, 1},
-        {193, 193, 193, 255, 1},
-        {190, 190, 190, 255, 1},
-        {146, 146, 146, 255, 1},
-        {120, 120, 120, 255, 1},
-        {189, 189, 189, 255, 1},
-        {172, 172, 172, 255, 1},
-        {96, 96, 96, 255, 1},
-        {93, 93, 93, 255, 1},
-        {125, 125, 125, 255, 1},
-        {189, 189, 189, 255, 1},
-        {193, 193, 193, 255, 1},
-        {158, 158, 158, 255, 1},
-        {111, 111, 111, 255, 1},
-        {154, 154, 154, 255, 1},
-        {204, 204, 204, 255, 1},
-        {111, 111, 111, 255, 1},
-        {102, 102, 102, 255, 1},
-        {93, 93, 93, 255, 1},
-        {180, 180, 180, 255, 1},
-        {190, 190, 190, 255, 1},
-        {167, 167, 167, 255, 1},
-        {121, 121, 121, 255, 1},
-        {133, 133, 133, 255, 1},
-        {197, 197, 197, 255, 1},
-        {126, 126, 126, 255, 1},
-        {100, 100, 100, 255, 1},
-        {87, 87, 87, 255, 1},
-        {159, 159, 159, 255, 1},
-        {196, 196, 196, 255, 1},
-        {187, 187, 187, 255, 1},
-        {148, 148, 148, 255, 1},
-        {116, 116, 116, 255, 1},
-        {188, 188, 188, 255, 1},
-        {166, 166, 166, 255, 1},
-        {96, 96, 96, 255, 1},
-        {97, 97, 97, 255, 1},
-        {145, 145, 145, 255, 1},
-        {160, 160, 160, 140, 1},
-        {191, 191, 191, 255, 1},
-        {206, 206, 206, 255, 1},
-        {154, 154, 154, 255, 1},
-        {79, 79, 79, 255, 1},
-        {158, 158, 158, 255, 1},
-        {104, 104, 104, 255, 1},
-        {175, 175, 175, 255, 1},
-        {180, 180, 180, 255, 1},
-        {170, 170, 170, 255, 1},
-        {171, 171, 171, 255, 1},
-        {182, 182, 182, 255, 1},
-        {184, 184, 184, 255, 1},
-        {85, 85, 85, 255, 1},
-        {136, 136, 136, 255, 1},
-        {120, 120, 120, 255, 1},
-        {134, 134, 134, 255, 1},
-        {186, 186, 186, 255, 1},
-        {169, 169, 169, 255, 1},
-        {177, 177, 177, 255, 1},
-        {173, 173, 173, 255, 1},
-        {201, 201, 201, 255, 1},
-        {120, 120, 120, 255, 1},
-        {101, 101, 101, 255, 1},
-        {139, 139, 139, 255, 1},
-        {105, 105, 105, 255, 1},
-        {190, 190, 190, 255, 1},
-        {178, 178, 178, 255, 1},
-        {171, 171, 171, 255, 1},
-        {176, 176, 176, 255, 1},
-        {205, 205, 205, 255, 1},
-        {166, 166, 166, 255, 1},
-        {82, 82, 82, 255, 1},
-        {152, 152, 152, 255, 1},
-        {98, 98, 98, 255, 1},
-        {175, 175, 175, 255, 1},
-        {172, 172, 172, 255, 1},
-        {169, 169, 169, 255, 1},
-        {177, 177, 177, 255, 1},
-        {197, 197, 197, 255, 1},
-        {196, 196, 196, 255, 1},
-        {92, 92, 92, 255, 1},
-        {139, 139, 139, 255, 1},
-        {113, 113, 113, 255, 1},
-        {135, 135, 135, 255, 1},
-        {184, 184, 184, 255, 1},
-        {170, 170, 170, 255, 1},
-        {165, 165, 165, 255, 1},
-        {187, 187, 187, 255, 1},
-        {200, 200, 200, 255, 1},
-        {118, 118, 118, 255, 1},
-        {99, 99, 99, 255, 1},
-        {140, 140, 140, 255, 1},
-        {103, 103, 103, 255, 1},
-        {193, 193, 193, 255, 1},
-        {172, 172, 172, 255, 1},
-        {174, 174, 174, 255, 1},
-        {186, 186, 186, 255, 1},
-        {207, 207, 207, 255, 1},
-        {156, 156, 156, 255, 1},
-        {83, 83, 83, 255, 1},
-        {158, 158, 158, 255, 1},
-        {96, 96, 96, 255, 1},
-        {193, 193, 193, 255, 1},
-        {165, 165, 165, 140, 1},
-        {190, 190, 190, 255, 1},
-        {172, 172, 172, 255, 1},
-        {83, 83, 83, 255, 1},
-        {191, 191, 191, 255, 1},
-        {101, 101, 101, 255, 1},
-        {140, 140, 140, 255, 1},
-        {194, 194, 194, 255, 1},
-        {167, 167, 167, 255, 1},
-        {175, 175, 175, 255, 1},
-        {172, 172, 172, 255, 1},
-        {185, 185, 185, 255, 1},
-        {92, 92, 92, 255, 1},
-        {132, 132, 132, 255, 1},
-        {142, 142, 142, 255, 1},
-        {97, 97, 97, 255, 1},
-        {194, 194, 194, 255, 1},
-        {163, 163, 163, 255, 1},
-        {169, 169, 169, 255, 2},
-        {176, 176, 176, 255, 1},
-        {130, 130, 130, 255, 1},
-        {103, 103, 103, 255, 1},
-        {173, 173, 173, 255, 1},
-        {80, 80, 80, 255, 1},
-        {182, 182, 182, 255, 1},
-        {176, 176, 176, 255, 1},
-        {175, 175, 175, 255, 1},
-        {176, 176, 176, 255, 1},
-        {177, 177, 177, 255, 2},
-        {85, 85, 85, 255, 1},
-        {184, 184, 184, 255, 1},
-        {100, 100, 100, 255, 1},
-        {140, 140, 140, 255, 1},
-        {186, 186, 186, 255, 1},
-        {158, 158, 158, 255, 1},
-        {174, 174, 174, 255, 1},
-        {177, 177, 177, 255, 1},
-        {195, 195, 195, 255, 1},
-        {107, 107, 107, 255, 1},
-        {150, 150, 150, 255, 1},
-        {145, 145, 145, 255, 1},
-        {105, 105, 105, 255, 1},
-        {188, 188, 188, 255, 1},
-        {165, 165, 165, 255, 1},
-        {176, 176, 176, 255, 1},
-        {160, 160, 160, 255, 1},
-        {187, 187, 187, 255, 1},
-        {130, 130, 130, 255, 1},
-        {97, 97, 97, 255, 1},
-        {179, 179, 179, 255, 1},
-        {81, 81, 81, 255, 1},
-        {163, 163, 163, 255, 1},
-        {173, 173, 173, 255, 2},
-        {175, 175, 175, 255, 1},
-        {185, 185, 185, 255, 1},
-        {175, 175, 175, 255, 1},
-        {85, 85, 85, 255, 1},
-        {191, 191, 191, 255, 1},
-        {97, 97, 97, 255, 1},
-        {138, 138, 138, 255, 1},
-        {204, 204, 204, 255, 1},
-        {171, 171, 171, 140, 1},
-        {197, 197, 197, 255, 1},
-        {109, 109, 109, 255, 1},
-        {135, 135, 135, 255, 1},
-        {91, 91, 91, 255, 1},
-        {122, 122, 122, 255, 1},
-        {189, 189, 189, 255, 1},
-        {190, 190, 190, 255, 1},
-        {189, 189, 189, 255, 1},
-        {167, 167, 167, 255, 1},
-        {175, 175, 175, 255, 1},
-        {143, 143, 143, 255, 1},
-        {97, 97, 97, 255, 1},
-        {113, 113, 113, 255, 1},
-        {92, 92, 92, 255, 1},
-        {179, 179, 179, 255, 1},
-        {176, 176, 176, 255, 1},
-        {185, 185, 185, 255, 1},
-        {168, 168, 168, 255, 1},
-        {169, 169, 169, 255, 1},
-        {165, 165, 165, 255, 1},
-        {90, 90, 90, 255, 1},
-        {141, 141, 141, 255, 1},
-        {81, 81, 81, 255, 1},
-        {168, 168, 168, 255, 1},
-        {191, 191, 191, 255, 2},
-        {180, 180, 180, 255, 1},
-        {172, 172, 172, 255, 1},
-        {197, 197, 197, 255, 1},
-        {116, 116, 116, 255, 1},
-        {126, 126, 126, 255, 1},
-        {92, 92, 92, 255, 1},
-        {126, 126, 126, 255, 1},
-        {184, 184, 184, 255, 1},
-        {177, 177, 177, 255, 1},
-        {179, 179, 179, 255, 1},
-        {159, 159, 159, 255, 1},
-        {183, 183, 183, 255, 1},
-        {141, 141, 141, 255, 1},
-        {107, 107, 107, 255, 1},
-        {120, 120, 120, 255, 1},
-        {93, 93, 93, 255, 1},
-        {184, 184, 184, 255, 1},
-        {177, 177, 177, 255, 1},
-        {182, 182, 182, 255, 1},
-        {177, 177, 177, 255, 1},
-        {172, 172, 172, 255, 1},
-        {161, 161, 161, 255, 1},
-        {92, 92, 92, 255, 1},
-        {127, 127, 127, 255, 1},
-        {71, 71, 71, 255, 1},
-        {157, 157, 157, 255, 1},
-        {175, 175, 175, 255, 1},
-        {181, 181, 181, 255, 2},
-        {173, 173, 173, 255, 1},
-        {191, 191, 191, 255, 1},
-        {112, 112, 112, 255, 1},
-        {135, 135, 135, 255, 1},
-        {95, 95, 95, 255, 1},
-        {139, 139, 139, 255, 1},
-        {197, 197, 197, 255, 1},
-        {199, 199, 199, 255, 1},
-        {198, 198, 198, 140, 1},
-        {171, 171, 171, 255, 1},
-        {86, 86, 86, 255, 1},
-        {102, 102, 102, 255, 1},
-        {144, 144, 144, 255, 1},
-        {205, 205, 205, 255, 1},
-        {130, 130, 130, 255, 1},
-        {101, 101, 101, 255, 1},
-        {151, 151, 151, 255, 1},
-        {198, 198, 198, 255, 1},
-        {193, 193, 193, 255, 1},
-        {99, 99, 99, 255, 1},
-        {92, 92, 92, 255, 1},
-        {131, 131, 131, 255, 1},
-        {187, 187, 187, 255, 1},
-        {146, 146, 146, 255, 1},
-        {81, 81, 81, 255, 1},
-        {130, 130, 130, 255, 1},
-        {174, 174, 174, 255, 1},
-        {181, 181, 181, 255, 1},
-        {118, 118, 118, 255, 1},
-        {80, 80, 80, 255, 1},
-        {114, 114, 114, 255, 1},
-        {188, 188, 188, 255, 1},
-        {194, 194, 194, 255, 1},
-        {104, 104, 104, 255, 1},
-        {119, 119, 119, 255, 1},
-        {170, 170, 170, 255, 1},
-        {203, 203, 203, 255, 1},
-        {170, 170, 170, 255, 1},
-        {84, 84, 84, 255, 1},
-        {100, 100, 100, 255, 1},
-        {159, 159, 159, 255, 1},
-        {202, 202, 202, 255, 1},
-        {116, 116, 116, 255, 1},
-        {98, 98, 98, 255, 1},
-        {143, 143, 143, 255, 1},
-        {181, 181, 181, 255, 1},
-        {187, 187, 187, 255, 1},
-        {98, 98, 98, 255, 1},
-        {93, 93, 93, 255, 1},
-        {133, 133, 133, 255, 1},
-        {205, 205, 205, 255, 1},
-        {165, 165, 165, 255, 1},
-        {94, 94, 94, 255, 1},
-        {129, 129, 129, 255, 1},
-        {181, 181, 181, 255, 1},
-        {188, 188, 188, 255, 1},
-        {112, 112, 112, 255, 1},
-        {82, 82, 82, 255, 1},
-        {111, 111, 111, 255, 1},
-        {159, 159, 159, 255, 1},
-        {172, 172, 172, 255, 1},
-        {98, 98, 98, 255, 1},
-        {109, 109, 109, 255, 1},
-        {171, 171, 171, 255, 1},
-        {203, 203, 203, 255, 1},
-        {160, 160, 160, 255, 1},
-        {84, 84, 84, 255, 1},
-        {107, 107, 107, 255, 1},
-        {163, 163, 163, 255, 1},
-        {213, 213, 213, 255, 1},
-        {130, 130, 130, 255, 1},
-        {123, 123, 123, 255, 1},
-        {163, 163, 163, 140, 1},
-        {181, 181, 181, 255, 1},
-        {144, 144, 144, 255, 1},
-        {181, 181, 181, 255, 1},
-        {176, 176, 176, 255, 1},
-        {181, 181, 181, 255, 1},
-        {163, 163, 163, 255, 1},
-        {95, 95, 95, 255, 1},
-        {113, 113, 113, 255, 1},
-        {101, 101, 101, 255, 1},
-        {186, 186, 186, 255, 1},
-        {153, 153, 153, 255, 1},
-        {179, 179, 179, 255, 1},
-        {189, 189, 189, 255, 1},
-        {176, 176, 176, 255, 1},
-        {170, 170, 170, 255, 1},
-        {97, 97, 97, 255, 1},
-        {102, 102, 102, 255, 1},
-        {78, 78, 78, 255, 1},
-        {157, 157, 157, 255, 2},
-        {150, 150, 150, 255, 1},
-        {192, 192, 192, 255, 1},
-        {182, 182, 182, 255, 1},
-        {188, 188, 188, 255, 1},
-        {132, 132, 132, 255, 1},
-        {101, 101, 101, 255, 1},
-        {90, 90, 90, 255, 1},
-        {141, 141, 141, 255, 1},
-        {187, 187, 187, 255, 1},
-        {153, 153, 153, 255, 1},
-        {190, 190, 190, 255, 1},
-        {188, 188, 188, 255, 1},
-        {181, 181, 181, 255, 1},
-        {142, 142, 142, 255, 1},
-        {99, 99, 99, 255, 1},
-        {111, 111, 111, 255, 1},
-        {98, 98, 98, 255, 1},
-        {190, 190, 190, 255, 1},
-        {159, 159, 159, 255, 1},
-        {180, 180, 180, 255, 1},
-        {190, 190, 190, 255, 1},
-        {173, 173, 173, 255, 1},
-        {181, 181, 181, 255, 1},
-        {99, 99, 99, 255, 1},
-        {115, 115, 115, 255, 1},
-        {83, 83, 83, 255, 1},
-        {167, 167, 167, 255, 1},
-        {164, 164, 164, 255, 1},
-        {157, 157, 157, 255, 1},
-        {188, 188, 188, 255, 1},
-        {172, 172, 172, 255, 1},
-        {175, 175, 175, 255, 1},
-        {105, 105, 105, 255, 1},
-        {106, 106, 106, 255, 1},
-        {94, 94, 94, 255, 1},
-        {142, 142, 142, 255, 1},
-        {186, 186, 186, 255, 1},
-        {154, 154, 154, 255, 1},
-        {192, 192, 192, 255, 1},
-        {188, 188, 188, 255, 1},
-        {185, 185, 185, 255, 1},
-        {163, 163, 163, 255, 1},
-        {110, 110, 110, 255, 1},
-        {71, 71, 71, 140, 1},
-        {125, 125, 125, 255, 1},
-        {193, 193, 193, 255, 1},
-        {166, 166, 166, 255, 1},
-        {169, 169, 169, 255, 1},
-        {173, 173, 173, 255, 1},
-        {193, 193, 193, 255, 1},
-        {117, 117, 117, 255, 1},
-        {133, 133, 133, 255, 1},
-        {139, 139, 139, 255, 1},
-        {98, 98, 98, 255, 1},
-        {201, 201, 201, 255, 1},
-        {180, 180, 180, 255, 1},
-        {173, 173, 173, 255, 1},
-        {167, 167, 167, 255, 1},
-        {181, 181, 181, 255, 1},
-        {153, 153, 153, 255, 1},
-        {94, 94, 94, 255, 1},
-        {168, 168, 168, 255, 1},
-        {82, 82, 82, 255, 1},
-        {170, 170, 170, 255, 1},
-        {186, 186, 186, 255, 1},
-        {169, 169, 169, 255, 1},
-        {179, 179, 179, 255, 1},
-        {175, 175, 175, 255, 1},
-        {181, 181, 181, 255, 1},
-        {95, 95, 95, 255, 1},
-        {165, 165, 165, 255, 1},
-        {100, 100, 100, 255, 1},
-        {135, 135, 135, 255, 1},
-        {201, 201, 201, 255, 1},
-        {168, 168, 168, 255, 1},
-        {173, 173, 173, 255, 1},
-        {179, 179, 179, 255, 1},
-        {185, 185, 185, 255, 1},
-        {107, 107, 107, 255, 1},
-        {140, 140, 140, 255, 1},
-        {143, 143, 143, 255, 1},
-        {101, 101, 101, 255, 1},
-        {204, 204, 204, 255, 1},
-        {175, 175, 175, 255, 1},
-        {173, 173, 173, 255, 2},
-        {182, 182, 182, 255, 1},
-        {148, 148, 148, 255, 1},
-        {94, 94, 94, 255, 1},
-        {163, 163, 163, 255, 1},
-        {81, 81, 81, 255, 1},
-        {179, 179, 179, 255, 1},
-        {189, 189, 189, 255, 1},
-        {170, 170, 170, 255, 1},
-        {171, 171, 171, 255, 1},
-        {174, 174, 174, 255, 1},
-        {168, 168, 168, 255, 1},
-        {89, 89, 89, 255, 1},
-        {167, 167, 167, 255, 1},
-        {100, 100, 100, 255, 1},
-        {133, 133, 133, 255, 1},
-        {203, 203, 203, 255, 1},
-        {169, 169, 169, 255, 1},
-        {175, 175, 175, 255, 1},
-        {176, 176, 176, 255, 1},
-        {192, 192, 192, 255, 1},
-        {120, 120, 120, 255, 1},
-        {200, 200, 200, 140, 1},
-        {103, 103, 103, 255, 1},
-        {135, 135, 135, 255, 1},
-        {177, 177, 177, 255, 1},
-        {163, 163, 163, 255, 1},
-        {172, 172, 172, 255, 1},
-        {182, 182, 182, 255, 1},
-        {200, 200, 200, 255, 1},
-        {88, 88, 88, 255, 1},
-        {148, 148, 148, 255, 1},
-        {120, 120, 120, 255, 1},
-        {127, 127, 127, 255, 1},
-        {193, 193, 193, 255, 1},
-        {172, 172, 172, 255, 1},
-        {181, 181, 181, 255, 1},
-        {169, 169, 169, 255, 1},
-        {203, 203, 203, 255, 1},
-        {121, 121, 121, 255, 1},
-        {114, 114, 114, 255, 1},
-        {159, 159, 159, 255, 1},
-        {94, 94, 94, 255, 1},
-        {187, 187, 187, 255, 1},
-        {172, 172, 172, 255, 1},
-        {177, 177, 177, 255, 1},
-        {172, 172, 172, 255, 1},
-        {198, 198, 198, 255, 1},
-        {170, 170, 170, 255, 1},
-        {86, 86, 86, 255, 1},
-        {171, 171, 171, 255, 1},
-        {93, 93, 93, 255, 1},
-        {158, 158, 158, 255, 1},
-        {181, 181, 181, 255, 1},
-        {171, 171, 171, 255, 1},
-        {169, 169, 169, 255, 1},
-        {162, 162, 162, 255, 1},
-        {187, 187, 187, 255, 1},
-        {88, 88, 88, 255, 1},
-        {156, 156, 156, 255, 1},
-        {120, 120, 120, 255, 1},
-        {125, 125, 125, 255, 1},
-        {191, 191, 191, 255, 1},
-        {173, 173, 173, 255, 1},
-        {177, 177, 177, 255, 1},
-        {174, 174, 174, 255, 1},
-        {209, 209, 209, 255, 1},
-        {124, 124, 124, 255, 1},
-        {111, 111, 111, 255, 1},
-        {152, 152, 152, 255, 1},
-        {90, 90, 90, 255, 1},
-        {183, 183, 183, 255, 1},
-        {173, 173, 173, 255, 1},
-        {176, 176, 176, 255, 1},
-        {174, 174, 174, 255, 1},
-        {196, 196, 196, 255, 1},
-        {162, 162, 162, 255, 1},
-        {84, 84, 84, 255, 1},
-        {161, 161, 161, 255, 1},
-        {94, 94, 94, 255, 1},
-        {169, 169, 169, 255, 1},
-        {184, 184, 184, 255, 1},
-        {173, 173, 173, 255, 1},
-        {174, 174, 174, 255, 1},
-        {181, 181, 181, 255, 1},
-        {197, 197, 197, 255, 1},
-        {122, 122, 122, 140, 1},
-        {139, 139, 139, 255, 1},
-        {89, 89, 89, 255, 1},
-        {172, 172, 172, 255, 1},
-        {178, 178, 178, 255, 1},
-        {196, 196, 196, 255, 1},
-        {170, 170, 170, 255, 1},
-        {158, 158, 158, 255, 1},
-        {186, 186, 186, 255, 1},
-        {92, 92, 92, 255, 1},
-        {108, 108, 108, 255, 1},
-        {94, 94, 94, 255, 1},
-        {176, 176, 176, 255, 1},
-        {182, 182, 182, 255, 1},
-        {188, 188, 188, 255, 1},
-        {181, 181, 181, 255, 1},
-        {148, 148, 148, 255, 1},
-        {194, 194, 194, 255, 1},
-        {128, 128, 128, 255, 1},
-        {100, 100, 100, 255, 1},
-        {96, 96, 96, 255, 1},
-        {139, 139, 139, 255, 1},
-        {188, 188, 188, 255, 1},
-        {179, 179, 179, 255, 1},
-        {193, 193, 193, 255, 1},
-        {160, 160, 160, 255, 1},
-        {174, 174, 174, 255, 1},
-        {165, 165, 165, 255, 1},
-        {90, 90, 90, 255, 1},
-        {114, 114, 114, 255, 1},
-        {108, 108, 108, 255, 1},
-        {185, 185, 185, 255, 1},
-        {179, 179, 179, 255, 1},
-        {181, 181, 181, 255, 1},
-        {130, 130, 130, 255, 2},
-        {177, 177, 177, 255, 1},
-        {92, 92, 92, 255, 1},
-        {113, 113, 113, 255, 1},
-        {93, 93, 93, 255, 1},
-        {171, 171, 171, 255, 1},
-        {176, 176, 176, 255, 1},
-        {191, 191, 191, 255, 1},
-        {186, 186, 186, 255, 1},
-        {150, 150, 150, 255, 1},
-        {195, 195, 195, 255, 1},
-        {126, 126, 126, 255, 1},
-        {92, 92, 92, 255, 1},
-        {98, 98, 98, 255, 1},
-        {140, 140, 140, 255, 1},
-        {186, 186, 186, 255, 1},
-        {182, 182, 182, 255, 1},
-        {193, 193, 193, 255, 1},
-        {147, 147, 147, 255, 1},
-        {175, 175, 175, 255, 1},
-        {165, 165, 165, 255, 1},
-        {89, 89, 89, 255, 1},
-        {111, 111, 111, 255, 1},
-        {112, 112, 112, 255, 1},
-        {183, 183, 183, 255, 1},
-        {174, 174, 174, 255, 1},
-        {198, 198, 198, 255, 1},
-        {166, 166, 166, 255, 1},
-        {171, 171, 171, 255, 1},
-        {156, 156, 156, 140, 1},
-        {130, 130, 130, 255, 1},
-        {94, 94, 94, 255, 1},
-        {163, 163, 163, 255, 1},
-        {196, 196, 196, 255, 1},
-        {124, 124, 124, 255, 1},
-        {89, 89, 89, 255, 1},
-        {105, 105, 105, 255, 1},
-        {194, 194, 194, 255, 1},
-        {193, 193, 193, 255, 1},
-        {133, 133, 133, 255, 1},
-        {92, 92, 92, 255, 1},
-        {144, 144, 144, 255, 1},
-        {206, 206, 206, 255, 1},
-        {145, 145, 145, 255, 1},
-        {99, 99, 99, 255, 1},
-        {89, 89, 89, 255, 1},
-        {178, 178, 178, 255, 1},
-        {203, 203, 203, 255, 1},
-        {154, 154, 154, 255, 1},
-        {100, 100, 100, 255, 1},
-        {112, 112, 112, 255, 1},
-        {203, 203, 203, 255, 1},
-        {174, 174, 174, 255, 1},
-        {103, 103, 103, 255, 1},
-        {83, 83, 83, 255, 1},
-        {142, 142, 142, 255, 1},
-        {205, 205, 205, 255, 1},
-        {185, 185, 185, 255, 1},
-        {122, 122, 122, 255, 1},
-        {93, 93, 93, 255, 1},
-        {180, 180, 180, 255, 1},
-        {199, 199, 199, 255, 1},
-        {103, 103, 103, 255, 1},
-        {79, 79, 79, 255, 1},
-        {102, 102, 102, 255, 1},
-        {185, 185, 185, 255, 1},
-        {198, 198, 198, 255, 1},
-        {145, 145, 145, 255, 1},
-        {97, 97, 97, 255, 1},
-        {141, 141, 141, 255, 1},
-        {207, 207, 207, 255, 1},
-        {138, 138, 138, 255, 1},
-        {90, 90, 90, 255, 1},
-        {84, 84, 84, 255, 1},
-        {180, 180, 180, 255, 1},
-        {198, 198, 198, 255, 1},
-        {159, 159, 159, 255, 1},
-        {106, 106, 106, 255, 1},
-        {115, 115, 115, 255, 1},
-        {208, 208, 208, 255, 1},
-        {171, 171, 171, 255, 1},
-        {103, 103, 103, 255, 1},
-        {79, 79, 79, 255, 1},
-        {144, 144, 144, 255, 1},
-        {204, 204, 204, 255, 1},
-        {181, 181, 181, 255, 1},
-        {120, 120, 120, 255, 1},
-        {93, 93, 93, 255, 1},
-        {181, 181, 181, 255, 1},
-        {199, 199, 199, 255, 1},
-        {123, 123, 123, 255, 1},
-        {90, 90, 90, 255, 1},
-        {127, 127, 127, 255, 1},
-        {169, 169, 169, 140, 1},
-        {190, 190, 190, 255, 1},
-        {180, 180, 180, 255, 2},
-        {86, 86, 86, 255, 1},
-        {125, 125, 125, 255, 1},
-        {104, 104, 104, 255, 1},
-        {156, 156, 156, 255, 1},
-        {185, 185, 185, 255, 1},
-        {176, 176, 176, 255, 1},
-        {185, 185, 185, 255, 1},
-        {183, 183, 183, 255, 1},
-        {193, 193, 193, 255, 1},
-        {108, 108, 108, 255, 1},
-        {99, 99, 99, 255, 1},
-        {118, 118, 118, 255, 1},
-        {122, 122, 122, 255, 1},
-        {194, 194, 194, 255, 1},
-        {171, 171, 171, 255, 1},
-        {176, 176, 176, 255, 1},
-        {178, 178, 178, 255, 1},
-        {183, 183, 183, 255, 1},
-        {159, 159, 159, 255, 1},
-        {86, 86, 86, 255, 1},
-        {139, 139, 139, 255, 1},
-        {101, 101, 101, 255, 1},
-        {186, 186, 186, 255, 1},
-        {175, 175, 175, 255, 1},
-        {177, 177, 177, 255, 1},
-        {189, 189, 189, 255, 1},
-        {179, 179, 179, 255, 1},
-        {187, 187, 187, 255, 1},
-        {87, 87, 87, 255, 1},
-        {128, 128, 128, 255, 1},
-        {100, 100, 100, 255, 1},
-        {152, 152, 152, 255, 1},
-        {182, 182, 182, 255, 1},
-        {178, 178, 178, 255, 1},
-        {189, 189, 189, 255, 1},
-        {183, 183, 183, 255, 1},
-        {195, 195, 195, 255, 1},
-        {121, 121, 121, 255, 1},
-        {103, 103, 103, 255, 1},
-        {118, 118, 118, 255, 1},
-        {126, 126, 126, 255, 1},
-        {188, 188, 188, 255, 1},
-        {167, 167, 167, 255, 1},
-        {188, 188, 188, 255, 2},
-        {194, 194, 194, 255, 1},
-        {161, 161, 161, 255, 1},
-        {84, 84, 84, 255, 1},
-        {133, 133, 133, 255, 1},
-        {92, 92, 92, 255, 1},
-        {181, 181, 181, 255, 1},
-        {172, 172, 172, 255, 1},
-        {177, 177, 177, 255, 1},
-        {190, 190, 190, 255, 1},
-        {187, 187, 187, 255, 2},
-        {87, 87, 87, 255, 1},
-        {131, 131, 131, 255, 1},
-        {101, 101, 101, 255, 1},
-        {168, 168, 168, 255, 1},
-        {162, 162, 162, 140, 1},
-        {184, 184, 184, 255, 1},
-        {193, 193, 193, 255, 1},
-        {88, 88, 88, 255, 1},
-        {161, 161, 161, 255, 1},
-        {131, 131, 131, 255, 1},
-        {104, 104, 104, 255, 1},
-        {189, 189, 189, 255, 1},
-        {175, 175, 175, 255, 1},
-        {179, 179, 179, 255, 1},
-        {170, 170, 170, 255, 1},
-        {195, 195, 195, 255, 1},
-        {129, 129, 129, 255, 1},
-        {109, 109, 109, 255, 1},
-        {163, 163, 163, 255, 1},
-        {89, 89, 89, 255, 1},
-        {177, 177, 177, 255, 1},
-        {172, 172, 172, 255, 1},
-        {174, 174, 174, 255, 1},
-        {164, 164, 164, 255, 1},
-        {176, 176, 176, 255, 1},
-        {162, 162, 162, 255, 1},
-        {85, 85, 85, 255, 1},
-        {192, 192, 192, 255, 1},
-        {91, 91, 91, 255, 1},
-        {154, 154, 154, 255, 1},
-        {182, 182, 182, 255, 1},
-        {176, 176, 176, 255, 1},
-        {177, 177, 177, 255, 1},
-        {172, 172, 172, 255, 1},
-        {195, 195, 195, 255, 1},
-        {88, 88, 88, 255, 1},
-        {160, 160, 160, 255, 1},
-        {128, 128, 128, 255, 1},
-        {113, 113, 113, 255, 1},
-        {185, 185, 185, 255, 1},
-        {167, 167, 167, 255, 1},
-        {170, 170, 170, 255, 1},
-        {158, 158, 158, 255, 1},
-        {194, 194, 194, 255, 1},
-        {128, 128, 128, 255, 1},
-        {115, 115, 115, 255, 1},
-        {175, 175, 175, 255, 1},
-        {85, 85, 85, 255, 1},
-        {186, 186, 186, 255, 1},
-        {170, 170, 170, 255, 1},
-        {177, 177, 177, 255, 1},
-        {172, 172, 172, 255, 1},
-        {182, 182, 182, 255, 1},
-        {162, 162, 162, 255, 1},
-        {86, 86, 86, 255, 1},
-        {186, 186, 186, 255, 1},
-        {85, 85, 85, 255, 1},
-        {145, 145, 145, 255, 1},
-        {175, 175, 175, 255, 1},
-        {171, 171, 171, 255, 2},
-        {168, 168, 168, 255, 1},
-        {193, 193, 193, 255, 1},
-        {84, 84, 84, 255, 1},
-        {161, 161, 161, 255, 1},
-        {132, 132, 132, 255, 1},
-        {117, 117, 117, 255, 1},
-        {203, 203, 203, 255, 1},
-        {160, 160, 160, 140, 1},
-        {205, 205, 205, 255, 1},
-        {126, 126, 126, 255, 1},
-        {125, 125, 125, 255, 1},
-        {122, 122, 122, 255, 1},
-        {77, 77, 77, 255, 1},
-        {185, 185, 185, 255, 2},
-        {179, 179, 179, 255, 1},
-        {174, 174, 174, 255, 1},
-        {186, 186, 186, 255, 1},
-        {168, 168, 168, 255, 1},
-        {104, 104, 104, 255, 1},
-        {147, 147, 147, 255, 1},
-        {83, 83, 83, 255, 1},
-        {181, 181, 181, 255, 1},
-        {196, 196, 196, 255, 1},
-        {177, 177, 177, 255, 1},
-        {172, 172, 172, 255, 1},
-        {176, 176, 176, 255, 1},
-        {181, 181, 181, 255, 1},
-        {98, 98, 98, 255, 1},
-        {152, 152, 152, 255, 1},
-        {93, 93, 93, 255, 1},
-        {140, 140, 140, 255, 1},
-        {209, 209, 209, 255, 1},
-        {182, 182, 182, 255, 1},
-        {176, 176, 176, 255, 1},
-        {170, 170, 170, 255, 1},
-        {195, 195, 195, 255, 1},
-        {134, 134, 134, 255, 1},
-        {123, 123, 123, 255, 1},
-        {120, 120, 120, 255, 1},
-        {101, 101, 101, 255, 1},
-        {198, 198, 198, 255, 1},
-        {191, 191, 191, 255, 1},
-        {180, 180, 180, 255, 1},
-        {147, 147, 147, 255, 1},
-        {161, 161, 161, 255, 1},
-        {154, 154, 154, 255, 1},
-        {97, 97, 97, 255, 1},
-        {144, 144, 144, 255, 1},
-        {80, 80, 80, 255, 1},
-        {171, 171, 171, 255, 1},
-        {200, 200, 200, 255, 1},
-        {180, 180, 180, 255, 1},
-        {165, 165, 165, 255, 1},
-        {169, 169, 169, 255, 1},
-        {191, 191, 191, 255, 1},
-        {99, 99, 99, 255, 1},
-        {137, 137, 137, 255, 1},
-        {84, 84, 84, 255, 1},
-        {139, 139, 139, 255, 1},
-        {197, 197, 197, 255, 1},
-        {182, 182, 182, 255, 1},
-        {173, 173, 173, 255, 2},
-        {195, 195, 195, 255, 1},
-        {125, 125, 125, 255, 1},
-        {129, 129, 129, 255, 1},
-        {124, 124, 124, 255, 1},
-        {107, 107, 107, 255, 1},
-        {206, 206, 206, 255, 1},
-        {204, 204, 204, 255, 1},
-        {182, 182, 182, 140, 1},
-        {186, 186, 186, 255, 1},
-        {90, 90, 90, 255, 1},
-        {98, 98, 98, 255, 1},
-        {83, 83, 83, 255, 1},
-        {173, 173, 173, 255, 1},
-        {139, 139, 139, 255, 1},
-        {112, 112, 112, 255, 1},
-        {166, 166, 166, 255, 1},
-        {190, 190, 190, 255, 1},
-        {194, 194, 194, 255, 1},
-        {106, 106, 106, 255, 1},
-        {92, 92, 92, 255, 1},
-        {103, 103, 103, 255, 1},
-        {190, 190, 190, 255, 1},
-        {180, 180, 180, 255, 1},
-        {113, 113, 113, 255, 1},
-        {148, 148, 148, 255, 1},
-        {184, 184, 184, 255, 1},
-        {185, 185, 185, 255, 1},
-        {139, 139, 139, 255, 1},
-        {89, 89, 89, 255, 1},
-        {102, 102, 102, 255, 1},
-        {150, 150, 150, 255, 1},
-        {193, 193, 193, 255, 1},
-        {120, 120, 120, 255, 1},
-        {140, 140, 140, 255, 1},
-        {191, 191, 191, 255, 1},
-        {190, 190, 190, 255, 1},
-        {181, 181, 181, 255, 1},
-        {92, 92, 92, 255, 1},
-        {97, 97, 97, 255, 1},
-        {117, 117, 117, 255, 1},
-        {191, 191, 191, 255, 1},
-        {144, 144, 144, 255, 1},
-        {123, 123, 123, 255, 1},
-        {156, 156, 156, 255, 1},
-        {164, 164, 164, 255, 1},
-        {177, 177, 177, 255, 1},
-        {98, 98, 98, 255, 1},
-        {87, 87, 87, 255, 1},
-        {94, 94, 94, 255, 1},
-        {178, 178, 178, 255, 1},
-        {172, 172, 172, 255, 1},
-        {114, 114, 114, 255, 1},
-        {164, 164, 164, 255, 1},
-        {195, 195, 195, 255, 1},
-        {193, 193, 193, 255, 1},
-        {145, 145, 145, 255, 1},
-        {77, 77, 77, 255, 1},
-        {83, 83, 83, 255, 1},
-        {140, 140, 140, 255, 1},
-        {188, 188, 188, 255, 1},
-        {114, 114, 114, 255, 1},
-        {134, 134, 134, 255, 1},
-        {194, 194, 194, 255, 1},
-        {181, 181, 181, 255, 1},
-        {165, 165, 165, 255, 1},
-        {84, 84, 84, 255, 1},
-        {99, 99, 99, 255, 1},
-        {125, 125, 125, 255, 1},
-        {211, 211, 211, 255, 1},
-        {145, 145, 145, 255, 1},
-        {144, 144, 144, 255, 1},
-        {176, 176, 176, 140, 1},
-        {182, 182, 182, 255, 1},
-        {107, 107, 107, 255, 1},
-        {139, 139, 139, 255, 1},
-        {171, 171, 171, 255, 1},
-        {187, 187, 187, 255, 1},
-        {137, 137, 137, 255, 1},
-        {80, 80, 80, 255, 1},
-        {90, 90, 90, 255, 1},
-        {128, 128, 128, 255, 1},
-        {199, 199, 199, 255, 1},
-        {125, 125, 125, 255, 1},
-        {151, 151, 151, 255, 1},
-        {188, 188, 188, 255, 2},
-        {179, 179, 179, 255, 1},
-        {92, 92, 92, 255, 1},
-        {99, 99, 99, 255, 1},
-        {102, 102, 102, 255, 1},
-        {188, 188, 188, 255, 1},
-        {138, 138, 138, 255, 1},
-        {121, 121, 121, 255, 1},
-        {187, 187, 187, 255, 1},
-        {188, 188, 188, 255, 1},
-        {180, 180, 180, 255, 1},
-        {103, 103, 103, 255, 1},
-        {92, 92, 92, 255, 1},
-        {98, 98, 98, 255, 1},
-        {176, 176, 176, 255, 1},
-        {180, 180, 180, 255, 1},
-        {124, 124, 124, 255, 1},
-        {173, 173, 173, 255, 1},
-        {193, 193, 193, 255, 1},
-        {176, 176, 176, 255, 1},
-        {134, 134, 134, 255, 1},
-        {93, 93, 93, 255, 1},
-        {84, 84, 84, 255, 1},
-        {113, 113, 113, 255, 1},
-        {184, 184, 184, 255, 1},
-        {115, 115, 115, 255, 1},
-        {133, 133, 133, 255, 1},
-        {180, 180, 180, 255, 1},
-        {186, 186, 186, 255, 1},
-        {178, 178, 178, 255, 1},
-        {89, 89, 89, 255, 1},
-        {101, 101, 101, 255, 1},
-        {116, 116, 116, 255, 1},
-        {206, 206, 206, 255, 1},
-        {146, 146, 146, 255, 1},
-        {116, 116, 116, 255, 1},
-        {167, 167, 167, 255, 1},
-        {184, 184, 184, 255, 1},
-        {179, 179, 179, 255, 1},
-        {104, 104, 104, 255, 1},
-        {101, 101, 101, 255, 1},
-        {102, 102, 102, 255, 1},
-        {170, 170, 170, 255, 1},
-        {163, 163, 163, 255, 1},
-        {117, 117, 117, 255, 1},
-        {171, 171, 171, 255, 1},
-        {192, 192, 192, 255, 1},
-        {187, 187, 187, 255, 1},
-        {147, 147, 147, 255, 1},
-        {100, 100, 100, 255, 1},
-        {72, 72, 72, 140, 1},
-        {163, 163, 163, 255, 1},
-        {196, 196, 196, 255, 1},
-        {171, 171, 171, 255, 1},
-        {167, 167, 167, 255, 1},
-        {149, 149, 149, 255, 1},
-        {170, 170, 170, 255, 1},
-        {86, 86, 86, 255, 1},
-        {147, 147, 147, 255, 1},
-        {98, 98, 98, 255, 1},
-        {133, 133, 133, 255, 1},
-        {213, 213, 213, 255, 1},
-        {183, 183, 183, 255, 1},
-        {170, 170, 170, 255, 1},
-        {168, 168, 168, 255, 1},
-        {192, 192, 192, 255, 1},
-        {131, 131, 131, 255, 1},
-        {114, 114, 114, 255, 1},
-        {128, 128, 128, 255, 1},
-        {90, 90, 90, 255, 1},
-        {182, 182, 182, 255, 1},
-        {187, 187, 187, 255, 1},
-        {180, 180, 180, 255, 1},
-        {178, 178, 178, 255, 1},
-        {182, 182, 182, 255, 1},
-        {159, 159, 159, 255, 1},
-        {103, 103, 103, 255, 1},
-        {156, 156, 156, 255, 1},
-        {85, 85, 85, 255, 1},
-        {171, 171, 171, 255, 1},
-        {200, 200, 200, 255, 1},
-        {177, 177, 177, 255, 1},
-        {173, 173, 173, 255, 1},
-        {171, 171, 171, 255, 1},
-        {175, 175, 175, 255, 1},
-        {99, 99, 99, 255, 1},
-        {148, 148, 148, 255, 1},
-        {96, 96, 96, 255, 1},
-        {109, 109, 109, 255, 1},
-        {183, 183, 183, 255, 1},
-        {175, 175, 175, 255, 1},
-        {170, 170, 170, 255, 1},
-        {172, 172, 172, 255, 1},
-        {195, 195, 195, 255, 1},
-        {136, 136, 136, 255, 1},
-        {125, 125, 125, 255, 1},
-        {135, 135, 134, 255, 1},
-        {99, 99, 99, 255, 1},
-        {198, 198, 198, 255, 1},
-        {189, 189, 189, 255, 1},
-        {162, 162, 162, 255, 1},
-        {161, 161, 161, 255, 1},
-        {178, 178, 178, 255, 1},
-        {149, 149, 149, 255, 1},
-        {102, 102, 102, 255, 1},
-        {158, 158, 158, 255, 1},
-        {81, 81, 81, 255, 1},
-        {165, 165, 165, 255, 1},
-        {198, 198, 198, 255, 1},
-        {177, 177, 177, 255, 1},
-        {171, 171, 171, 255, 1},
-        {170, 170, 170, 255, 1},
-        {187, 187, 187, 255, 1},
-        {110, 110, 110, 255, 1},
-        {158, 158, 158, 140, 1},
-        {100, 100, 100, 255, 1},
-        {172, 172, 172, 255, 1},
-        {178, 178, 178, 255, 1},
-        {156, 156, 156, 255, 1},
-        {136, 136, 136, 255, 1},
-        {182, 182, 182, 255, 1},
-        {157, 157, 157, 255, 1},
-        {80, 80, 80, 255, 1},
-        {183, 183, 183, 255, 1},
-        {98, 98, 98, 255, 1},
-        {156, 156, 156, 255, 1},
-        {185, 185, 185, 255, 1},
-        {165, 165, 165, 255, 1},
-        {172, 172, 172, 255, 1},
-        {175, 175, 175, 255, 1},
-        {195, 195, 195, 255, 1},
-        {88, 88, 88, 255, 1},
-        {146, 146, 146, 255, 1},
-        {132, 132, 132, 255, 1},
-        {105, 105, 105, 255, 1},
-        {189, 189, 189, 255, 1},
-        {172, 172, 172, 255, 1},
-        {178, 178, 178, 255, 1},
-        {167, 167, 167, 255, 1},
-        {198, 198, 198, 255, 1},
-        {131, 131, 131, 255, 1},
-        {106, 106, 106, 255, 1},
-        {176, 176, 176, 255, 1},
-        {89, 89, 89, 255, 1},
-        {178, 178, 178, 255, 1},
-        {171, 171, 171, 255, 1},
-        {174, 174, 174, 255, 1},
-        {172, 172, 172, 255, 1},
-        {184, 184, 184, 255, 1},
-        {164, 164, 164, 255, 1},
-        {82, 82, 82, 255, 1},
-        {193, 193, 193, 255, 1},
-        {93, 93, 93, 255, 1},
-        {134, 134, 134, 255, 1},
-        {179, 179, 179, 255, 1},
-        {176, 176, 176, 255, 1},
-        {170, 170, 170, 255, 1},
-        {167, 167, 167, 255, 1},
-        {201, 201, 201, 255, 1},
-        {96, 96, 96, 255, 1},
-        {159, 159, 159, 255, 1},
-        {138, 138, 138, 255, 1},
-        {109, 109, 109, 255, 1},
-        {191, 191, 191, 255, 1},
-        {166, 166, 166, 255, 2},
-        {163, 163, 163, 255, 1},
-        {194, 194, 194, 255, 1},
-        {129, 129, 129, 255, 1},
-        {114, 114, 114, 255, 1},
-        {179, 179, 179, 255, 1},
-        {85, 85, 85, 255, 1},
-        {186, 186, 186, 255, 1},
-        {166, 166, 166, 255, 1},
-        {173, 173, 173, 255, 1},
-        {170, 170, 170, 255, 1},
-        {181, 181, 181, 255, 1},
-        {176, 176, 176, 255, 1},
-        {152, 152, 152, 140, 1},
-        {139, 139, 139, 255, 1},
-        {117, 117, 117, 255, 1},
-        {187, 187, 187, 255, 1},
-        {154, 154, 154, 255, 1},
-        {159, 159, 159, 255, 1},
-        {176, 176, 176, 255, 1},
-        {175, 175, 175, 255, 1},
-        {157, 157, 157, 255, 1},
-        {78, 78, 78, 255, 1},
-        {133, 133, 133, 255, 1},
-        {105, 105, 104, 255, 1},
-        {192, 192, 192, 255, 1},
-        {168, 168, 168, 255, 1},
-        {179, 179, 179, 255, 1},
-        {195, 195, 195, 255, 1},
-        {181, 181, 181, 255, 1},
-        {189, 189, 189, 255, 1},
-        {97, 97, 97, 255, 1},
-        {126, 126, 126, 255, 1},
-        {107, 107, 107, 255, 1},
-        {161, 161, 161, 255, 1},
-        {179, 179, 179, 255, 1},
-        {178, 178, 178, 255, 1},
-        {193, 193, 193, 255, 1},
-        {172, 172, 172, 255, 1},
-        {183, 183, 183, 255, 1},
-        {126, 126, 126, 255, 1},
-        {95, 95, 95, 255, 1},
-        {120, 120, 120, 255, 1},
-        {126, 126, 126, 255, 1},
-        {194, 194, 194, 255, 1},
-        {169, 169, 169, 255, 1},
-        {185, 185, 185, 255, 1},
-        {176, 176, 176, 255, 1},
-        {182, 182, 182, 255, 1},
-        {157, 157, 157, 255, 1},
-        {64, 64, 64, 255, 1},
-        {138, 138, 138, 255, 1},
-        {90, 90, 90, 255, 1},
-        {162, 162, 162, 255, 1},
-        {174, 174, 174, 255, 1},
-        {177, 177, 177, 255, 1},
-        {195, 195, 195, 255, 1},
-        {187, 187, 187, 255, 1},
-        {192, 192, 192, 255, 1},
-        {98, 98, 98, 255, 1},
-        {126, 126, 126, 255, 1},
-        {107, 107, 107, 255, 1},
-        {158, 158, 158, 255, 1},
-        {185, 185, 185, 255, 1},
-        {174, 174, 174, 255, 1},
-        {186, 186, 186, 255, 1},
-        {177, 177, 177, 255, 1},
-        {190, 190, 190, 255, 1},
-        {112, 112, 112, 255, 1},
-        {101, 101, 101, 255, 1},
-        {124, 124, 124, 255, 1},
-        {116, 116, 116, 255, 1},
-        {185, 185, 185, 255, 1},
-        {172, 172, 172, 255, 1},
-        {182, 182, 182, 255, 1},
-        {191, 191, 191, 255, 1},
-        {199, 199, 199, 255, 1},
-        {140, 140, 140, 140, 1},
-        {125, 125, 125, 255, 1},
-        {86, 86, 86, 255, 1},
-        {171, 171, 171, 255, 1},
-        {185, 185, 185, 255, 1},
-        {133, 133, 133, 255, 1},
-        {91, 91, 91, 255, 2},
-        {190, 190, 190, 255, 1},
-        {179, 179, 179, 255, 1},
-        {125, 125, 125, 255, 1},
-        {88, 88, 88, 255, 1},
-        {146, 146, 146, 255, 1},
-        {207, 207, 207, 255, 1},
-        {180, 180, 180, 255, 1},
-        {117, 117, 117, 255, 1},
-        {89, 89, 89, 255, 1},
-        {178, 178, 178, 255, 1},
-        {204, 204, 204, 255, 1},
-        {130, 130, 130, 255, 1},
-        {88, 88, 88, 255, 1},
-        {112, 112, 112, 255, 1},
-        {195, 195, 195, 255, 1},
-        {186, 186, 186, 255, 1},
-        {114, 114, 114, 255, 1},
-        {81, 81, 81, 255, 1},
-        {137, 137, 137, 255, 1},
-        {213, 213, 213, 255, 1},
-        {150, 150, 150, 255, 1},
-        {94, 94, 94, 255, 1},
-        {91, 91, 91, 255, 1},
-        {182, 182, 182, 255, 1},
-        {205, 205, 205, 255, 1},
-        {159, 159, 159, 255, 1},
-        {90, 90, 90, 255, 1},
-        {102, 102, 102, 255, 1},
-        {196, 196, 196, 255, 1},
-        {152, 152, 152, 255, 1},
-        {99, 99, 99, 255, 1},
-        {78, 78, 78, 255, 1},
-        {122, 122, 122, 255, 1},
-        {199, 199, 199, 255, 1},
-        {183, 183, 183, 255, 1},
-        {124, 124, 124, 255, 1},
-        {89, 89, 89, 255, 1},
-        {184, 184, 184, 255, 1},
-        {204, 204, 204, 255, 1},
-        {132, 132, 132, 255, 1},
-        {89, 89, 89, 255, 1},
-        {111, 111, 111, 255, 1},
-        {204, 204, 204, 255, 1},
-        {196, 196, 196, 255, 1},
-        {132, 132, 132, 255, 1},
-        {90, 90, 90, 255, 1},
-        {141, 141, 141, 255, 1},
-        {199, 199, 199, 255, 1},
-        {136, 136, 136, 255, 1},
-        {97, 97, 97, 255, 1},
-        {87, 87, 87, 255, 1},
-        {177, 177, 177, 255, 1},
-        {205, 205, 205, 255, 1},
-        {142, 142, 142, 255, 1},
-        {97, 97, 97, 255, 1},
-        {130, 130, 130, 255, 1},
-        {180, 180, 180, 140, 1},
-        {193, 193, 193, 255, 1},
-        {160, 160, 160, 255, 1},
-        {195, 195, 195, 255, 1},
-        {106, 106, 106, 255, 1},
-        {96, 96, 96, 255, 1},
-        {102, 102, 102, 255, 1},
-        {132, 132, 132, 255, 1},
-        {184, 184, 184, 255, 1},
-        {177, 177, 177, 255, 1},
-        {196, 196, 196, 255, 1},
-        {168, 168, 168, 255, 1},
-        {183, 183, 183, 255, 1},
-        {164, 164, 164, 255, 1},
-        {86, 86, 86, 255, 1},
-        {110, 110, 110, 255, 1},
-        {104, 104, 104, 255, 1},
-        {193, 193, 193, 255, 1},
-        {180, 180, 180, 255, 1},
-        {189, 189, 189, 255, 1},
-        {171, 171, 171, 255, 1},
-        {167, 167, 167, 255, 1},
-        {171, 171, 171, 255, 1},
-        {74, 74, 74, 255, 1},
-        {115, 115, 115, 255, 1},
-        {98, 98, 98, 255, 1},
-        {171, 171, 171, 255, 1},
-        {182, 182, 182, 255, 1},
-        {185, 185, 185, 255, 1},
-        {181, 181, 181, 255, 1},
-        {162, 162, 162, 255, 1},
-        {191, 191, 191, 255, 1},
-        {122, 122, 122, 255, 1},
-        {101, 101, 101, 255, 1},
-        {96, 96, 96, 255, 1},
-        {143, 143, 143, 255, 1},
-        {186, 186, 186, 255, 1},
-        {169, 169, 169, 255, 1},
-        {181, 181, 181, 255, 1},
-        {162, 162, 162, 255, 1},
-        {180, 180, 180, 255, 1},
-        {152, 152, 152, 255, 1},
-        {85, 85, 85, 255, 1},
-        {99, 99, 99, 255, 1},
-        {115, 115, 115, 255, 1},
-        {195, 195, 195, 255, 1},
-        {171, 171, 171, 255, 1},
-        {193, 193, 193, 255, 1},
-        {172, 172, 172, 255, 1},
-        {166, 166, 166, 255, 1},
-        {183, 183, 183, 255, 1},
-        {84, 84, 84, 255, 1},
-        {121, 121, 121, 255, 1},
-        {98, 98, 98, 255, 1},
-        {176, 176, 176, 255, 1},
-        {178, 178, 178, 255, 1},
-        {183, 183, 183, 255, 1},
-        {185, 185, 185, 255, 1},
-        {161, 161, 161, 255, 1},
-        {189, 189, 189, 255, 1},
-        {116, 116, 116, 255, 1},
-        {104, 104, 104, 255, 1},
-        {98, 98, 98, 255, 1},
-        {165, 165, 165, 255, 1},
-        {152, 152, 152, 140, 1},
-        {179, 179, 179, 255, 1},
-        {206, 206, 206, 255, 1},
-        {120, 120, 120, 255, 2},
-        {150, 150, 150, 255, 1},
-        {90, 90, 90, 255, 1},
-        {194, 194, 194, 255, 1},
-        {176, 176, 176, 255, 1},
-        {177, 177, 177, 255, 1},
-        {166, 166, 166, 255, 1},
-        {198, 198, 198, 255, 1},
-        {166, 166, 166, 255, 1},
-        {88, 88, 88, 255, 1},
-        {165, 165, 165, 255, 1},
-        {91, 91, 91, 255, 1},
-        {168, 168, 168, 255, 1},
-        {180, 180, 180, 255, 1},
-        {176, 176, 176, 255, 1},
-        {168, 168, 168, 255, 1},
-        {180, 180, 180, 255, 1},
-        {181, 181, 181, 255, 1},
-        {78, 78, 78, 255, 1},
-        {161, 161, 161, 255, 1},
-        {111, 111, 111, 255, 1},
-        {123, 123, 123, 255, 1},
-        {191, 191, 191, 255, 1},
-        {171, 171, 171, 255, 1},
-        {174, 174, 174, 255, 1},
-        {173, 173, 173, 255, 1},
-        {207, 207, 207, 255, 1},
-        {116, 116, 116, 255, 1},
-        {122, 122, 122, 255, 1},
-        {152, 152, 152, 255, 1},
-        {96, 96, 96, 255, 1},
-        {189, 189, 189, 255, 1},
-        {173, 173, 173, 255, 1},
-        {153, 153, 153, 255, 1},
-        {160, 160, 160, 255, 1},
-        {198, 198, 198, 255, 1},
-        {162, 162, 162, 255, 1},
-        {89, 89, 89, 255, 1},
-        {165, 165, 165, 255, 1},
-        {89, 89, 89, 255, 1},
-        {176, 176, 176, 255, 1},
-        {178, 178, 178, 255, 1},
-        {176, 176, 176, 255, 1},
-        {170, 170, 170, 255, 1},
-        {182, 182, 182, 255, 1},
-        {195, 195, 195, 255, 1},
-        {87, 87, 87, 255, 1},
-        {163, 163, 163, 255, 1},
-        {117, 117, 117, 255, 1},
-        {122, 122, 122, 255, 1},
-        {186, 186, 186, 255, 1},
-        {160, 160, 160, 255, 1},
-        {173, 173, 173, 255, 1},
-        {174, 174, 174, 255, 1},
-        {201, 201, 201, 255, 1},
-        {115, 115, 115, 255, 1},
-        {126, 126, 126, 255, 1},
-        {151, 151, 151, 255, 1},
-        {103, 103, 103, 255, 1},
-        {207, 207, 207, 255, 1},
-        {163, 163, 163, 140, 1},
-        {204, 204, 204, 255, 1},
-        {143, 143, 143, 255, 1},
-        {99, 99, 99, 255, 1},
-        {158, 158, 158, 255, 1},
-        {77, 77, 77, 255, 1},
-        {171, 171, 171, 255, 1},
-        {192, 192, 192, 255, 1},
-        {172, 172, 172, 255, 1},
-        {178, 178, 178, 255, 1},
-        {180, 180, 180, 255, 1},
-        {181, 181, 181, 255, 1},
-        {93, 93, 93, 255, 1},
-        {160, 160, 160, 255, 1},
-        {93, 93, 93, 255, 1},
-        {141, 141, 141, 255, 1},
-        {208, 208, 208, 255, 1},
-        {170, 170, 170, 255, 1},
-        {172, 172, 172, 255, 1},
-        {174, 174, 174, 255, 1},
-        {182, 182, 182, 255, 1},
-        {96, 96, 96, 255, 1},
-        {142, 142, 142, 255, 1},
-        {130, 130, 130, 255, 1},
-        {94, 94, 94, 255, 1},
-        {196, 196, 196, 255, 1},
-        {176, 176, 176, 255, 1},
-        {174, 174, 174, 255, 1},
-        {167, 167, 167, 255, 1},
-        {176, 176, 176, 255, 1},
-        {140, 140, 140, 255, 1},
-        {108, 108, 108, 255, 1},
-        {162, 162, 162, 255, 1},
-        {86, 86, 86, 255, 1},
-        {188, 188, 188, 255, 1},
-        {186, 186, 186, 255, 1},
-        {170, 170, 170, 255, 1},
-        {167, 167, 167, 255, 2},
-        {177, 177, 177, 255, 1},
-        {96, 96, 96, 255, 1},
-        {157, 157, 157, 255, 1},
-        {93, 93, 93, 255, 1},
-        {152, 152, 152, 255, 1},
-        {204, 204, 204, 255, 1},
-        {171, 171, 171, 255, 1},
-        {172, 172, 172, 255, 1},
-        {175, 175, 175, 255, 1},
-        {192, 192, 192, 255, 1},
-        {114, 114, 114, 255, 1},
-        {139, 139, 139, 255, 1},
-        {129, 129, 129, 255, 1},
-        {96, 96, 96, 255, 1},
-        {190, 190, 190, 255, 1},
-        {175, 175, 175, 255, 1},
-        {153, 153, 153, 255, 1},
-        {162, 162, 162, 255, 1},
-        {185, 185, 185, 255, 1},
-        {136, 136, 136, 255, 1},
-        {107, 107, 107, 255, 1},
-        {157, 157, 157, 255, 1},
-        {77, 77, 77, 255, 1},
-        {176, 176, 176, 255, 1},
-        {202, 202, 202, 255, 1},
-        {182, 182, 182, 140, 1},
-        {196, 196, 196, 255, 1},
-        {100, 100, 100, 255, 1},
-        {115, 115, 115, 255, 1},
-        {90, 90, 90, 255, 1},
-        {169, 169, 169, 255, 1},
-        {164, 164, 164, 255, 1},
-        {155, 155, 155, 255, 1},
-        {192, 192, 192, 255, 1},
-        {182, 182, 182, 255, 1},
-        {193, 193, 193, 255, 1},
-        {118, 118, 118, 255, 1},
-        {97, 97, 97, 255, 1},
-        {84, 84, 84, 255, 1},
-        {132, 132, 132, 255, 1},
-        {180, 180, 180, 255, 1},
-        {135, 135, 135, 255, 1},
-        {182, 182, 182, 255, 1},
-        {190, 190, 190, 255, 1},
-        {181, 181, 181, 255, 1},
-        {127, 127, 127, 255, 1},
-        {92, 92, 92, 255, 1},
-        {109, 109, 109, 255, 1},
-        {94, 94, 94, 255, 1},
-        {178, 178, 178, 255, 1},
-        {151, 151, 151, 255, 1},
-        {173, 173, 173, 255, 1},
-        {189, 189, 189, 255, 1},
-        {176, 176, 176, 255, 1},
-        {177, 177, 177, 255, 1},
-        {90, 90, 90, 255, 1},
-        {109, 109, 109, 255, 1},
-        {92, 92, 92, 255, 1},
-        {181, 181, 181, 255, 1},
-        {162, 162, 162, 255, 1},
-        {156, 156, 156, 255, 1},
-        {191, 191, 191, 255, 1},
-        {176, 176, 176, 255, 1},
-        {183, 183, 183, 255, 1},
-        {122, 122, 122, 255, 1},
-        {101, 101, 101, 255, 1},
-        {93, 93, 93, 255, 1},
-        {156, 156, 156, 255, 1},
-        {188, 188, 188, 255, 1},
-        {140, 140, 140, 255, 1},
-        {174, 174, 174, 255, 1},
-        {179, 179, 179, 255, 1},
-        {178, 178, 178, 255, 1},
-        {149, 149, 149, 255, 1},
-        {96, 96, 96, 255, 1},
-        {105, 105, 105, 255, 1},
-        {111, 111, 111, 255, 1},
-        {177, 177, 177, 255, 1},
-        {134, 134, 134, 255, 1},
-        {159, 159, 159, 255, 1},
-        {181, 181, 181, 255, 1},
-        {166, 166, 166, 255, 1},
-        {174, 174, 174, 255, 1},
-        {98, 98, 98, 255, 1},
-        {112, 112, 112, 255, 1},
-        {81, 81, 81, 255, 1},
-        {176, 176, 176, 255, 1},
-        {157, 157, 157, 255, 1},
-        {169, 169, 169, 255, 1},
-        {203, 203, 203, 140, 1},
-        {168, 168, 168, 255, 1},
-        {92, 92, 92, 255, 1},
-        {131, 131, 131, 255, 1},
-        {193, 193, 193, 255, 1},
-        {203, 203, 203, 255, 1},
-        {136, 136, 136, 255, 1},
-        {82, 82, 82, 255, 1},
-        {101, 101, 101, 255, 1},
-        {172, 172, 172, 255, 1},
-        {204, 204, 204, 255, 1},
-        {103, 103, 103, 255, 1},
-        {107, 107, 107, 255, 1},
-        {164, 164, 164, 255, 1},
-        {190, 190, 190, 255, 1},
-        {154, 154, 154, 255, 1},
-        {80, 80, 80, 255, 1},
-        {97, 97, 97, 255, 1},
-        {138, 138, 138, 255, 1},
-        {199, 199, 199, 255, 1},
-        {101, 101, 101, 255, 1},
-        {94, 94, 94, 255, 1},
-        {145, 145, 145, 255, 1},
-        {190, 190, 190, 255, 1},
-        {185, 185, 185, 255, 1},
-        {98, 98, 98, 255, 1},
-        {94, 94, 94, 255, 1},
-        {108, 108, 108, 255, 1},
-        {192, 192, 192, 255, 1},
-        {165, 165, 165, 255, 1},
-        {95, 95, 95, 255, 1},
-        {133, 133, 133, 255, 1},
-        {192, 192, 192, 255, 1},
-        {196, 196, 196, 255, 1},
-        {118, 118, 118, 255, 1},
-        {84, 84, 84, 255, 1},
-        {111, 111, 111, 255, 1},
-        {185, 185, 185, 255, 1},
-        {197, 197, 197, 255, 1},
-        {108, 108, 108, 255, 1},
-        {120, 120, 120, 255, 1},
-        {174, 174, 174, 255, 1},
-        {200, 200, 200, 255, 1},
-        {169, 169, 169, 255, 1},
-        {76, 76, 76, 255, 1},
-        {93, 93, 93, 255, 1},
-        {134, 134, 134, 255, 1},
-        {202, 202, 202, 255, 1},
-        {122, 122, 122, 255, 1},
-        {92, 92, 92, 255, 1},
-        {140, 140, 140, 255, 1},
-        {199, 199, 199, 255, 1},
-        {161, 161, 161, 255, 1},
-        {75, 75, 75, 255, 1},
-        {96, 96, 96, 255, 1},
-        {107, 107, 107, 255, 1},
-        {192, 192, 192, 255, 1},
-        {159, 159, 159, 255, 1},
-        {96, 96, 96, 255, 1},
-        {133, 133, 133, 255, 1},
-        {176, 176, 176, 255, 1},
-        {202, 202, 202, 255, 1},
-        {128, 128, 128, 255, 1},
-        {95, 95, 95, 255, 1},
-        {112, 112, 112, 140, 1},
-        {178, 178, 178, 255, 1},
-        {173, 173, 173, 255, 1},
-        {179, 179, 179, 255, 1},
-        {170, 170, 170, 255, 1},
-        {173, 173, 173, 255, 1},
-        {180, 180, 180, 255, 1},
-        {103, 103, 103, 255, 1},
-        {143, 143, 143, 255, 1},
-        {81, 81, 81, 255, 1},
-        {166, 166, 166, 255, 1},
-        {196, 196, 196, 255, 1},
-        {187, 187, 187, 255, 1},
-        {178, 178, 178, 255, 1},
-        {170, 170, 170, 255, 1},
-        {172, 172, 172, 255, 1},
-        {93, 93, 93, 255, 1},
-        {133, 133, 133, 255, 1},
-        {96, 96, 96, 255, 1},
-        {117, 117, 117, 255, 1},
-        {167, 167, 167, 255, 1},
-        {173, 173, 173, 255, 1},
-        {181, 181, 181, 255, 1},
-        {172, 172, 172, 255, 1},
-        {191, 191, 191, 255, 1},
-        {144, 144, 144, 255, 1},
-        {111, 111, 111, 255, 1},
-        {126, 126, 126, 255, 1},
-        {85, 85, 85, 255, 1},
-        {189, 189, 189, 255, 1},
-        {192, 192, 192, 255, 1},
-        {193, 193, 193, 255, 1},
-        {182, 182, 182, 255, 1},
-        {173, 173, 173, 255, 1},
-        {163, 163, 163, 255, 1},
-        {92, 92, 92, 255, 1},
-        {134, 134, 134, 255, 1},
-        {83, 83, 83, 255, 1},
-        {165, 165, 165, 255, 1},
-        {193, 193, 193, 255, 1},
-        {190, 190, 190, 255, 1},
-        {181, 181, 181, 255, 1},
-        {172, 172, 172, 255, 1},
-        {194, 194, 194, 255, 1},
-        {116, 116, 116, 255, 1},
-        {130, 130, 130, 255, 1},
-        {89, 89, 89, 255, 1},
-        {128, 128, 128, 255, 1},
-        {173, 173, 173, 255, 1},
-        {159, 159, 159, 255, 1},
-        {183, 183, 183, 255, 1},
-        {181, 181, 181, 255, 1},
-        {169, 169, 169, 255, 1},
-        {108, 108, 108, 255, 1},
-        {111, 111, 111, 255, 1},
-        {124, 124, 124, 255, 1},
-        {95, 95, 95, 255, 1},
-        {190, 190, 190, 255, 1},
-        {188, 188, 188, 255, 1},
-        {191, 191, 191, 255, 1},
-        {174, 174, 174, 255, 1},
-        {176, 176, 176, 255, 1},
-        {183, 183, 183, 255, 1},
-        {109, 109, 109, 255, 1},
-        {101, 101, 101, 140, 1},
-        {109, 109, 109, 255, 1},
-        {187, 187, 187, 255, 1},
-        {164, 164, 164, 255, 1},
-        {173, 173, 173, 255, 2},
-        {187, 187, 187, 255, 1},
-        {148, 148, 148, 255, 1},
-        {99, 99, 99, 255, 1},
-        {183, 183, 183, 255, 1},
-        {83, 83, 83, 255, 1},
-        {169, 169, 169, 255, 1},
-        {171, 171, 171, 255, 1},
-        {173, 173, 173, 255, 1},
-        {160, 160, 160, 255, 1},
-        {155, 155, 155, 255, 1},
-        {166, 166, 166, 255, 1},
-        {82, 82, 82, 255, 1},
-        {189, 189, 189, 255, 1},
-        {108, 108, 108, 255, 1},
-        {101, 101, 101, 255, 1},
-        {176, 176, 176, 255, 1},
-        {164, 164, 164, 255, 1},
-        {171, 171, 171, 255, 1},
-        {174, 174, 174, 255, 1},
-        {186, 186, 186, 255, 1},
-        {101, 101, 101, 255, 1},
-        {143, 143, 143, 255, 1},
-        {155, 155, 155, 255, 1},
-        {95, 95, 95, 255, 1},
-        {195, 195, 195, 255, 1},
-        {174, 174, 174, 255, 1},
-        {181, 181, 181, 255, 1},
-        {175, 175, 175, 255, 1},
-        {184, 184, 184, 255, 1},
-        {138, 138, 138, 255, 1},
-        {98, 98, 98, 255, 1},
-        {182, 182, 182, 255, 1},
-        {82, 82, 82, 255, 1},
-        {177, 177, 177, 255, 2},
-        {174, 174, 174, 255, 1},
-        {178, 178, 178, 255, 1},
-        {179, 179, 179, 255, 1},
-        {174, 174, 174, 255, 1},
-        {78, 78, 78, 255, 1},
-        {182, 182, 182, 255, 1},
-        {103, 103, 103, 255, 1},
-        {108, 108, 108, 255, 1},
-        {185, 185, 185, 255, 1},
-        {171, 171, 171, 255, 1},
-        {182, 182, 182, 255, 1},
-        {167, 167, 167, 255, 1},
-        {161, 161, 161, 255, 1},
-        {91, 91, 91, 255, 1},
-        {148, 148, 148, 255, 1},
-        {149, 149, 149, 255, 1},
-        {95, 95, 95, 255, 1},
-        {187, 187, 187, 255, 1},
-        {162, 162, 162, 255, 1},
-        {178, 178, 178, 255, 1},
-        {173, 173, 173, 255, 1},
-        {190, 190, 190, 255, 1},
-        {157, 157, 157, 255, 1},
-        {176, 176, 176, 140, 1},
-        {124, 124, 124, 255, 1},
-        {127, 127, 127, 255, 1},
-        {183, 183, 183, 255, 1},
-        {171, 171, 171, 255, 1},
-        {175, 175, 175, 255, 1},
-        {179, 179, 179, 255, 1},
-        {204, 204, 204, 255, 1},
-        {130, 130, 130, 255, 1},
-        {92, 92, 92, 255, 1},
-        {147, 147, 147, 255, 1},
-        {101, 101, 101, 255, 1},
-        {178, 178, 178, 255, 1},
-        {163, 163, 163, 255, 1},
-        {173, 173, 173, 255, 1},
-        {175, 175, 175, 255, 1},
-        {187, 187, 187, 255, 1},
-        {164, 164, 164, 255, 1},
-        {85, 85, 85, 255, 1},
-        {152, 152, 152, 255, 1},
-        {96, 96, 96, 255, 1},
-        {137, 137, 137, 255, 1},
-        {173, 173, 173, 255, 1},
-        {175, 175, 175, 255, 1},
-        {184, 184, 184, 255, 1},
-        {193, 193, 193, 255, 1},
-        {184, 184, 184, 255, 1},
-        {92, 92, 92, 255, 1},
-        {125, 125, 125, 255, 1},
-        {115, 115, 115, 255, 1},
-        {127, 127, 127, 255, 1},
-        {188, 188, 188, 255, 1},
-        {166, 166, 166, 255, 1},
-        {174, 174, 174, 255, 1},
-        {180, 180, 180, 255, 1},
-        {195, 195, 195, 255, 1},
-        {128, 128, 128, 255, 1},
-        {97, 97, 97, 255, 1},
-        {136, 136, 136, 255, 1},
-        {105, 105, 105, 255, 1},
-        {192, 192, 192, 255, 1},
-        {175, 175, 175, 255, 2},
-        {188, 188, 188, 255, 1},
-        {195, 195, 195, 255, 1},
-        {150, 150, 150, 255, 1},
-        {76, 76, 76, 255, 1},
-        {154, 154, 154, 255, 1},
-        {94, 94, 94, 255, 1},
-        {158, 158, 158, 255, 1},
-        {177, 177, 177, 255, 1},
-        {176, 176, 176, 255, 1},
-        {178, 178, 178, 255, 1},
-        {175, 175, 175, 255, 1},
-        {169, 169, 169, 255, 1},
-        {84, 84, 84, 255, 1},
-        {130, 130, 130, 255, 1},
-        {117, 117, 117, 255, 1},
-        {135, 135, 135, 255, 1},
-        {182, 182, 182, 255, 1},
-        {172, 172, 172, 255, 1},
-        {181, 181, 181, 255, 1},
-        {186, 186, 186, 255, 1},
-        {203, 203, 203, 255, 1},
-        {107, 107, 107, 140, 1},
-        {112, 112, 112, 255, 1},
-        {84, 84, 84, 255, 1},
-        {172, 172, 172, 255, 1},
-        {197, 197, 197, 255, 1},
-        {176, 176, 176, 255, 1},
-        {106, 106, 106, 255, 1},
-        {121, 121, 121, 255, 1},
-        {206, 206, 206, 255, 1},
-        {150, 150, 150, 255, 1},
-        {101, 101, 101, 255, 1},
-        {83, 83, 83, 255, 1},
-        {139, 139, 139, 255, 1},
-        {186, 186, 186, 255, 2},
-        {126, 126, 126, 255, 1},
-        {102, 102, 102, 255, 1},
-        {180, 180, 180, 255, 1},
-        {184, 184, 184, 255, 1},
-        {100, 100, 100, 255, 1},
-        {94, 94, 94, 255, 1},
-        {111, 111, 111, 255, 1},
-        {185, 185, 185, 255, 1},
-        {194, 194, 194, 255, 1},
-        {167, 167, 167, 255, 1},
-        {110, 110, 110, 255, 1},
-        {146, 146, 146, 255, 1},
-        {201, 201, 201, 255, 1},
-        {110, 110, 110, 255, 1},
-        {95, 95, 95, 255, 1},
-        {91, 91, 91, 255, 1},
-        {171, 171, 171, 255, 1},
-        {190, 190, 190, 255, 1},
-        {164, 164, 164, 255, 1},
-        {109, 109, 109, 255, 1},
-        {121, 121, 121, 255, 1},
-        {203, 203, 203, 255, 1},
-        {149, 149, 149, 255, 1},
-        {94, 94, 94, 255, 1},
-        {84, 84, 84, 255, 1},
-        {156, 156, 156, 255, 1},
-        {195, 195, 195, 255, 1},
-        {193, 193, 193, 255, 1},
-        {146, 146, 146, 255, 1},
-        {106, 106, 106, 255, 1},
-        {175, 175, 175, 255, 1},
-        {159, 159, 159, 255, 1},
-        {93, 93, 93, 255, 1},
-        {90, 90, 90, 255, 1},
-        {109, 109, 109, 255, 1},
-        {189, 189, 189, 255, 1},
-        {196, 196, 196, 255, 1},
-        {154, 154, 154, 255, 1},
-        {101, 101, 101, 255, 1},
-        {146, 146, 146, 255, 1},
-        {190, 190, 190, 255, 1},
-        {118, 118, 118, 255, 1},
-        {101, 101, 101, 255, 1},
-        {96, 96, 96, 255, 1},
-        {180, 180, 180, 255, 1},
-        {194, 194, 194, 255, 1},
-        {180, 180, 180, 255, 1},
-        {121, 121, 121, 255, 1},
-        {129, 129, 129, 255, 1},
-        {173, 173, 173, 140, 1},
-        {163, 163, 163, 255, 1},
-        {121, 121, 121, 255, 1},
-        {184, 184, 184, 255, 1},
-        {159, 159, 159, 255, 1},
-        {97, 97, 97, 255, 1},
-        {98, 98, 98, 255, 1},
-        {125, 125, 125, 255, 1},
-        {192, 192, 192, 255, 1},
-        {191, 191, 191, 255, 1},
-        {175, 175, 175, 255, 1},
-        {121, 121, 121, 255, 1},
-        {163, 163, 163, 255, 1},
-        {175, 175, 175, 255, 1},
-        {89, 89, 89, 255, 1},
-        {104, 104, 104, 255, 1},
-        {93, 93, 93, 255, 1},
-        {184, 184, 184, 255, 1},
-        {186, 186, 186, 255, 1},
-        {190, 190, 190, 255, 1},
-        {142, 142, 142, 255, 1},
-        {132, 132, 132, 255, 1},
-        {194, 194, 194, 255, 1},
-        {119, 119, 119, 255, 1},
-        {92, 92, 92, 255, 1},
-        {81, 81, 81, 255, 1},
-        {142, 142, 142, 255, 1},
-        {184, 184, 184, 255, 1},
-        {196, 196, 196, 255, 1},
-        {166, 166, 166, 255, 1},
-        {126, 126, 126, 255, 1},
-        {184, 184, 184, 255, 1},
-        {143, 143, 143, 255, 1},
-        {91, 91, 91, 255, 1},
-        {93, 93, 93, 255, 1},
-        {120, 120, 120, 255, 1},
-        {191, 191, 191, 255, 1},
-        {196, 196, 196, 255, 1},
-        {175, 175, 175, 255, 1},
-        {126, 126, 126, 255, 1},
-        {167, 167, 167, 255, 1},
-        {190, 190, 190, 255, 1},
-        {98, 98, 98, 255, 1},
-        {103, 103, 103, 255, 1},
-        {98, 98, 98, 255, 1},
-        {184, 184, 184, 255, 1},
-        {185, 185, 185, 255, 2},
-        {139, 139, 139, 255, 1},
-        {136, 136, 136, 255, 1},
-        {204, 204, 204, 255, 1},
-        {125, 125, 125, 255, 1},
-        {101, 101, 101, 255, 1},
-        {91, 91, 91, 255, 1},
-        {157, 157, 157, 255, 1},
-        {188, 188, 188, 255, 1},
-        {193, 193, 193, 255, 1},
-        {156, 156, 156, 255, 1},
-        {115, 115, 115, 255, 1},
-        {179, 179, 179, 255, 1},
-        {158, 158, 158, 255, 1},
-        {96, 96, 96, 255, 1},
-        {91, 91, 91, 255, 1},
-        {141, 141, 141, 255, 1},
-        {152, 152, 152, 140, 1},
-        {179, 179, 179, 255, 1},
-        {204, 204, 204, 255, 1},
-        {150, 150, 150, 255, 1},
-        {90, 90, 90, 255, 1},
-        {161, 161, 161, 255, 1},
-        {95, 95, 95, 255, 1},
-        {178, 178, 178, 255, 1},
-        {177, 177, 177, 255, 1},
-        {174, 174, 174, 255, 1},
-        {175, 175, 175, 255, 1},
-        {195, 195, 195, 255, 1},
-        {185, 185, 185, 255, 1},
-        {83, 83, 83, 255, 1},
-        {152, 152, 152, 255, 1},
-        {115, 115, 115, 255, 1},
-        {147, 147, 147, 255, 1},
-        {190, 190, 190, 255, 1},
-        {172, 172, 172, 255, 1},
-        {173, 173, 173, 255, 1},
-        {184, 184, 184, 255, 1},
-        {194, 194, 194, 255, 1},
-        {107, 107, 107, 255, 1},
-        {121, 121, 121, 255, 1},
-        {138, 138, 138, 255, 1},
-        {100, 100, 100, 255, 1},
-        {178, 178, 178, 255, 1},
-        {176, 176, 176, 255, 1},
-        {178, 178, 178, 255, 1},
-        {181, 181, 181, 255, 1},
-        {206, 206, 206, 255, 1},
-        {153, 153, 153, 255, 1},
-        {93, 93, 93, 255, 1},
-        {161, 161, 161, 255, 1},
-        {89, 89, 89, 255, 1},
-        {174, 174, 174, 255, 1},
-        {183, 183, 183, 255, 1},
-        {178, 178, 178, 255, 1},
-        {174, 174, 174, 255, 1},
-        {194, 194, 194, 255, 1},
-        {187, 187, 187, 255, 1},
-        {84, 84, 84, 255, 1},
-        {156, 156, 156, 255, 1},
-        {112, 112, 112, 255, 1},
-        {146, 146, 146, 255, 1},
-        {186, 186, 186, 255, 1},
-        {177, 177, 177, 255, 1},
-        {176, 176, 176, 255, 1},
-        {185, 185, 185, 255, 1},
-        {207, 207, 207, 255, 1},
-        {110, 110, 110, 255, 1},
-        {119, 119, 119, 255, 1},
-        {140, 140, 140, 255, 1},
-        {107, 107, 107, 255, 1},
-        {181, 181, 181, 255, 1},
-        {174, 174, 174, 255, 1},
-        {173, 173, 173, 255, 1},
-        {171, 171, 171, 255, 1},
-        {195, 195, 195, 255, 1},
-        {138, 138, 138, 255, 1},
-        {85, 85, 85, 255, 1},
-        {147, 147, 147, 255, 1},
-        {99, 99, 99, 255, 1},
-        {193, 193, 193, 255, 1},
-        {165, 165, 165, 140, 1},
-        {192, 192, 192, 255, 1},
-        {166, 166, 166, 255, 1},
-        {89, 89, 89, 255, 1},
-        {189, 189, 189, 255, 1},
-        {93, 93, 93, 255, 1},
-        {153, 153, 153, 255, 1},
-        {191, 191, 191, 255, 1},
-        {166, 166, 166, 255, 1},
-        {175, 175, 175, 255, 1},
-        {171, 171, 171, 255, 1},
-        {185, 185, 185, 255, 1},
-        {96, 96, 96, 255, 1},
-        {158, 158, 158, 255, 1},
-        {131, 131, 131, 255, 1},
-        {106, 106, 106, 255, 1},
-        {197, 197, 197, 255, 1},
-        {168, 168, 168, 255, 1},
-        {176, 176, 176, 255, 1},
-        {173, 173, 173, 255, 1},
-        {179, 179, 179, 255, 1},
-        {113, 113, 113, 255, 1},
-        {109, 109, 109, 255, 1},
-        {173, 173, 173, 255, 1},
-        {86, 86, 86, 255, 1},
-        {180, 180, 180, 255, 1},
-        {174, 174, 174, 255, 1},
-        {175, 175, 175, 255, 1},
-        {178, 178, 178, 255, 1},
-        {183, 183, 183, 255, 1},
-        {173, 173, 173, 255, 1},
-        {90, 90, 90, 255, 1},
-        {189, 189, 189, 255, 1},
-        {88, 88, 88, 255, 1},
-        {145, 145, 145, 255, 1},
-        {186, 186, 186, 255, 1},
-        {171, 171, 171, 255, 1},
-        {178, 178, 178, 255, 1},
-        {173, 173, 173, 255, 1},
-        {189, 189, 189, 255, 1},
-        {95, 95, 95, 255, 1},
-        {164, 164, 164, 255, 1},
-        {131, 131, 131, 255, 1},
-        {115, 115, 115, 255, 1},
-        {197, 197, 197, 255, 1},
-        {170, 170, 170, 255, 1},
-        {175, 175, 175, 255, 1},
-        {178, 178, 178, 255, 1},
-        {185, 185, 185, 255, 1},
-        {128, 128, 128, 255, 1},
-        {118, 118, 118, 255, 1},
-        {173, 173, 173, 255, 1},
-        {83, 83, 83, 255, 1},
-        {174, 174, 174, 255, 1},
-        {172, 172, 172, 255, 1},
-        {176, 176, 176, 255, 1},
-        {177, 177, 177, 255, 1},
-        {183, 183, 183, 255, 1},
-        {155, 155, 155, 255, 1},
-        {85, 85, 85, 255, 1},
-        {176, 176, 176, 255, 1},
-        {92, 92, 92, 255, 1},
-        {159, 159, 159, 255, 1},
-        {204, 204, 204, 255, 1},
-        {169, 169, 169, 140, 1},
-        {201, 201, 201, 255, 1},
-        {112, 112, 112, 255, 1},
-        {132, 132, 132, 255, 1},
-        {88, 88, 88, 255, 1},
-        {144, 144, 144, 255, 1},
-        {194, 194, 194, 255, 1},
-        {176, 176, 176, 255, 1},
-        {184, 184, 184, 255, 1},
-        {170, 170, 170, 255, 1},
-        {189, 189, 189, 255, 1},
-        {142, 142, 142, 255, 1},
-        {110, 110, 110, 255, 1},
-        {111, 111, 111, 255, 1},
-        {104, 104, 104, 255, 1},
-        {176, 176, 176, 255, 1},
-        {153, 153, 153, 255, 1},
-        {186, 186, 186, 255, 1},
-        {180, 180, 180, 255, 1},
-        {179, 179, 179, 255, 1},
-        {172, 172, 172, 255, 1},
-        {91, 91, 91, 255, 1},
-        {126, 126, 126, 255, 1},
-        {81, 81, 81, 255, 1},
-        {173, 173, 173, 255, 1},
-        {177, 177, 177, 255, 1},
-        {182, 182, 182, 255, 1},
-        {186, 186, 186, 255, 1},
-        {174, 174, 174, 255, 1},
-        {195, 195, 195, 255, 1},
-        {115, 115, 115, 255, 1},
-        {132, 132, 132, 255, 1},
-        {86, 86, 86, 255, 1},
-        {130, 130, 130, 255, 1},
-        {181, 181, 181, 255, 1},
-        {183, 183, 183, 255, 1},
-        {187, 187, 187, 255, 1},
-        {173, 173, 173, 255, 1},
-        {192, 192, 192, 255, 1},
-        {148, 148, 148, 255, 1},
-        {113, 113, 113, 255, 1},
-        {110, 110, 110, 255, 2},
-        {196, 196, 196, 255, 1},
-        {174, 174, 174, 255, 1},
-        {189, 189, 189, 255, 1},
-        {182, 182, 182, 255, 1},
-        {175, 175, 175, 255, 1},
-        {145, 145, 145, 255, 1},
-        {92, 92, 92, 255, 1},
-        {128, 128, 128, 255, 1},
-        {88, 88, 88, 255, 1},
-        {181, 181, 181, 255, 1},
-        {175, 175, 175, 255, 1},
-        {180, 180, 180, 255, 1},
-        {185, 185, 185, 255, 1},
-        {172, 172, 172, 255, 1},
-        {189, 189, 189, 255, 1},
-        {102, 102, 102, 255, 1},
-        {125, 125, 125, 255, 1},
-        {83, 83, 83, 255, 1},
-        {148, 148, 148, 255, 1},
-        {189, 189, 189, 255, 1},
-        {197, 197, 197, 255, 1},
-        {203, 203, 203, 140, 1},
-        {177, 177, 177, 255, 1},
-        {90, 90, 90, 255, 1},
-        {96, 96, 96, 255, 1},
-        {162, 162, 162, 255, 1},
-        {209, 209, 209, 255, 1},
-        {125, 125, 125, 255, 1},
-        {88, 88, 88, 255, 1},
-        {141, 141, 141, 255, 1},
-        {196, 196, 196, 255, 1},
-        {186, 186, 186, 255, 1},
-        {95, 95, 95, 255, 1},
-        {93, 93, 93, 255, 1},
-        {142, 142, 142, 255, 1},
-        {198, 198, 198, 255, 1},
-        {139, 139, 139, 255, 1},
-        {87, 87, 87, 255, 1},
-        {113, 113, 113, 255, 1},
-        {174, 174, 174, 255, 1},
-        {208, 208, 208, 255, 1},
-        {124, 124, 124, 255, 1},
-        {86, 86, 86, 255, 1},
-        {122, 122, 122, 255, 1},
-        {188, 188, 188, 255, 1},
-        {184, 184, 184, 255, 1},
-        {95, 95, 95, 255, 1},
-        {107, 107, 107, 255, 1},
-        {155, 155, 155, 255, 1},
-        {201, 201, 201, 255, 1},
-        {161, 161, 161, 255, 1},
-        {89, 89, 89, 255, 1},
-        {113, 113, 113, 255, 1},
-        {170, 170, 170, 255, 1},
-        {204, 204, 204, 255, 1},
-        {122, 122, 122, 255, 1},
-        {97, 97, 97, 255, 1},
-        {123, 123, 123, 255, 1},
-        {194, 194, 194, 255, 1},
-        {191, 191, 191, 255, 1},
-        {98, 98, 98, 255, 1},
-        {102, 102, 102, 255, 1},
-        {151, 151, 151, 255, 1},
-        {203, 203, 203, 255, 1},
-        {161, 161, 161, 255, 1},
-        {83, 83, 83, 255, 1},
-        {112, 112, 112, 255, 1},
-        {180, 180, 180, 255, 1},
-        {186, 186, 186, 255, 1},
-        {113, 113, 113, 255, 1},
-        {82, 82, 82, 255, 1},
-        {115, 115, 115, 255, 1},
-        {193, 193, 193, 255, 1},
-        {195, 195, 195, 255, 1},
-        {94, 94, 94, 255, 1},
-        {99, 99, 99, 255, 1},
-        {154, 154, 154, 255, 1},
-        {202, 202, 202, 255, 1},
-        {152, 152, 152, 255, 1},
-        {79, 79, 79, 255, 1},
-        {108, 108, 108, 255, 1},
-        {172, 172, 172, 255, 1},
-        {207, 207, 207, 255, 1},
-        {124, 124, 124, 255, 1},
-        {113, 113, 113, 255, 1},
-        {160, 160, 160, 140, 1},
-        {198, 198, 198, 255, 1},
-        {163, 163, 163, 255, 1},
-        {181, 181, 181, 255, 1},
-        {177, 177, 177, 255, 1},
-        {174, 174, 174, 255, 1},
-        {170, 170, 170, 255, 1},
-        {94, 94, 94, 255, 1},
-        {114, 114, 114, 255, 1},
-        {97, 97, 97, 255, 1},
-        {172, 172, 172, 255, 1},
-        {152, 152, 152, 255, 1},
-        {175, 175, 175, 255, 1},
-        {188, 188, 188, 255, 1},
-        {170, 170, 170, 255, 1},
-        {174, 174, 174, 255, 1},
-        {107, 107, 107, 255, 1},
-        {123, 123, 123, 255, 1},
-        {79, 79, 79, 255, 1},
-        {158, 158, 158, 255, 1},
-        {165, 165, 165, 255, 1},
-        {164, 164, 164, 255, 1},
-        {195, 195, 195, 255, 1},
-        {178, 178, 178, 255, 1},
-        {191, 191, 191, 255, 1},
-        {130, 130, 130, 255, 1},
-        {113, 113, 113, 255, 1},
-        {101, 101, 101, 255, 1},
-        {124, 124, 124, 255, 1},
-        {182, 182, 182, 255, 1},
-        {168, 168, 168, 255, 1},
-        {196, 196, 196, 255, 1},
-        {184, 184, 184, 255, 1},
-        {181, 181, 181, 255, 1},
-        {171, 171, 171, 255, 1},
-        {97, 97, 97, 255, 1},
-        {119, 119, 119, 255, 1},
-        {88, 88, 88, 255, 1},
-        {174, 174, 174, 255, 1},
-        {164, 164, 164, 255, 1},
-        {183, 183, 183, 255, 1},
-        {193, 193, 193, 255, 1},
-        {167, 167, 167, 255, 1},
-        {174, 174, 174, 255, 1},
-        {91, 91, 91, 255, 1},
-        {118, 118, 118, 255, 1},
-        {83, 83, 83, 255, 1},
-        {151, 151, 151, 255, 1},
-        {173, 173, 173, 255, 1},
-        {167, 167, 167, 255, 1},
-        {187, 187, 187, 255, 1},
-        {170, 170, 170, 255, 1},
-        {189, 189, 189, 255, 1},
-        {113, 113, 113, 255, 1},
-        {110, 110, 110, 255, 1},
-        {91, 91, 91, 255, 1},
-        {119, 119, 119, 255, 1},
-        {190, 190, 190, 255, 1},
-        {163, 163, 163, 255, 1},
-        {190, 190, 190, 255, 1},
-        {184, 184, 184, 255, 1},
-        {177, 177, 177, 255, 1},
-        {164, 164, 164, 255, 1},
-        {105, 105, 105, 255, 1},
-        {72, 72, 72, 140, 1},
-        {135, 135, 135, 255, 1},
-        {198, 198, 198, 255, 1},
-        {163, 163, 163, 255, 1},
-        {169, 169, 169, 255, 1},
-        {177, 177, 177, 255, 1},
-        {195, 195, 195, 255, 1},
-        {129, 129, 129, 255, 1},
-        {118, 118, 118, 255, 1},
-        {150, 150, 150, 255, 1},
-        {87, 87, 87, 255, 1},
-        {183, 183, 183, 255, 1},
-        {168, 168, 168, 255, 1},
-        {170, 170, 170, 255, 1},
-        {166, 166, 166, 255, 1},
-        {180, 180, 180, 255, 1},
-        {152, 152, 152, 255, 1},
-        {90, 90, 90, 255, 1},
-        {185, 185, 185, 255, 1},
-        {88, 88, 88, 255, 1},
-        {150, 150, 150, 255, 1},
-        {183, 183, 183, 255, 1},
-        {169, 169, 169, 255, 1},
-        {172, 172, 172, 255, 1},
-        {180, 180, 180, 255, 1},
-        {185, 185, 185, 255, 1},
-        {91, 91, 91, 255, 1},
-        {168, 168, 168, 255, 1},
-        {117, 117, 117, 255, 1},
-        {111, 111, 111, 255, 1},
-        {196, 196, 196, 255, 1},
-        {171, 171, 171, 255, 1},
-        {170, 170, 170, 255, 1},
-        {171, 171, 171, 255, 1},
-        {190, 190, 190, 255, 1},
-        {117, 117, 117, 255, 1},
-        {120, 120, 120, 255, 1},
-        {155, 155, 155, 255, 1},
-        {93, 93, 93, 255, 1},
-        {201, 201, 201, 255, 1},
-        {175, 175, 175, 255, 1},
-        {168, 168, 168, 255, 1},
-        {174, 174, 174, 255, 1},
-        {180, 180, 180, 255, 1},
-        {143, 143, 143, 255, 1},
-        {87, 87, 87, 255, 1},
-        {169, 169, 169, 255, 1},
-        {80, 80, 80, 255, 1},
-        {168, 168, 168, 255, 1},
-        {182, 182, 182, 255, 1},
-        {169, 169, 169, 255, 1},
-        {170, 170, 170, 255, 1},
-        {175, 175, 175, 255, 1},
-        {168, 168, 168, 255, 1},
-        {89, 89, 89, 255, 1},
-        {154, 154, 154, 255, 1},
-        {104, 104, 104, 255, 1},
-        {129, 129, 129, 255, 1},
-        {203, 203, 203, 255, 1},
-        {172, 172, 172, 255, 1},
-        {177, 177, 177, 255, 1},
-        {168, 168, 168, 255, 1},
-        {186, 186, 186, 255, 1},
-        {132, 132, 132, 255, 1},
-        {193, 193, 193, 140, 1},
-        {112, 112, 112, 255, 1},
-        {146, 146, 146, 255, 1},
-        {179, 179, 179, 255, 1},
-        {166, 166, 166, 255, 1},
-        {171, 171, 171, 255, 1},
-        {181, 181, 181, 255, 1},
-        {208, 208, 208, 255, 1},
-        {104, 104, 104, 255, 1},
-        {126, 126, 126, 255, 1},
-        {133, 133, 133, 255, 1},
-        {118, 118, 118, 255, 1},
-        {180, 180, 180, 255, 1},
-        {171, 171, 171, 255, 2},
-        {172, 172, 172, 255, 1},
-        {202, 202, 202, 255, 1},
-        {129, 129, 129, 255, 1},
-        {105, 105, 105, 255, 1},
-        {165, 165, 165, 255, 1},
-        {87, 87, 87, 255, 1},
-        {171, 171, 171, 255, 1},
-        {178, 178, 178, 255, 1},
-        {176, 176, 176, 255, 1},
-        {178, 178, 178, 255, 1},
-        {198, 198, 198, 255, 1},
-        {179, 179, 179, 255, 1},
-        {86, 86, 86, 255, 1},
-        {169, 169, 169, 255, 1},
-        {104, 104, 104, 255, 1},
-        {161, 161, 161, 255, 1},
-        {183, 183, 183, 255, 1},
-        {164, 164, 164, 255, 1},
-        {166, 166, 166, 255, 1},
-        {184, 184, 184, 255, 1},
-        {193, 193, 193, 255, 1},
-        {88, 88, 88, 255, 1},
-        {134, 134, 134, 255, 1},
-        {129, 129, 129, 255, 1},
-        {120, 120, 120, 255, 1},
-        {193, 193, 193, 255, 1},
-        {166, 166, 166, 255, 1},
-        {167, 167, 167, 255, 1},
-        {171, 171, 171, 255, 1},
-        {200, 200, 200, 255, 1},
-        {126, 126, 126, 255, 1},
-        {98, 98, 98, 255, 1},
-        {148, 148, 148, 255, 1},
-        {93, 93, 93, 255, 1},
-        {175, 175, 175, 255, 1},
-        {168, 168, 168, 255, 1},
-        {170, 170, 170, 255, 2},
-        {182, 182, 182, 255, 1},
-        {164, 164, 164, 255, 1},
-        {79, 79, 79, 255, 1},
-        {157, 157, 157, 255, 1},
-        {97, 97, 97, 255, 1},
-        {160, 160, 160, 255, 1},
-        {184, 184, 184, 255, 1},
-        {174, 174, 174, 255, 1},
-        {176, 176, 176, 255, 1},
-        {185, 185, 185, 255, 1},
-        {210, 210, 210, 255, 1},
-        {103, 103, 103, 140, 1},
-        {124, 124, 124, 255, 1},
-        {90, 90, 90, 255, 1},
-        {180, 180, 180, 255, 1},
-        {174, 174, 174, 255, 1},
-        {184, 184, 184, 255, 1},
-        {157, 157, 157, 255, 1},
-        {151, 151, 151, 255, 1},
-        {200, 200, 200, 255, 1},
-        {109, 109, 109, 255, 1},
-        {99, 99, 99, 255, 1},
-        {87, 87, 87, 255, 1},
-        {160, 160, 160, 255, 1},
-        {183, 183, 183, 255, 1},
-        {181, 181, 181, 255, 1},
-        {154, 154, 154, 255, 1},
-        {124, 124, 124, 255, 1},
-        {188, 188, 188, 255, 1},
-        {128, 128, 128, 255, 1},
-        {82, 82, 82, 255, 1},
-        {96, 96, 96, 255, 1},
-        {127, 127, 127, 255, 1},
-        {186, 186, 186, 255, 1},
-        {187, 187, 187, 255, 1},
-        {185, 185, 185, 255, 1},
-        {140, 140, 140, 255, 1},
-        {172, 172, 172, 255, 1},
-        {181, 181, 181, 255, 1},
-        {93, 93, 93, 255, 1},
-        {112, 112, 112, 255, 1},
-        {110, 110, 110, 255, 1},
-        {186, 186, 186, 255, 1},
-        {180, 180, 180, 255, 1},
-        {185, 185, 185, 255, 1},
-        {143, 143, 143, 255, 1},
-        {144, 144, 144, 255, 1},
-        {189, 189, 189, 255, 1},
-        {93, 93, 93, 255, 1},
-        {102, 102, 102, 255, 1},
-        {98, 98, 98, 255, 1},
-        {175, 175, 175, 255, 1},
-        {183, 183, 183, 255, 1},
-        {185, 185, 185, 255, 1},
-        {168, 168, 168, 255, 1},
-        {131, 131, 131, 255, 1},
-        {187, 187, 187, 255, 1},
-        {138, 138, 138, 255, 1},
-        {87, 87, 87, 255, 1},
-        {84, 84, 84, 255, 1},
-        {122, 122, 122, 255, 1},
-        {188, 188, 188, 255, 1},
-        {168, 168, 168, 255, 1},
-        {161, 161, 161, 255, 1},
-        {127, 127, 127, 255, 1},
-        {170, 170, 170, 255, 1},
-        {176, 176, 176, 255, 1},
-        {87, 87, 87, 255, 1},
-        {103, 103, 103, 255, 1},
-        {106, 106, 106, 255, 1},
-        {192, 192, 192, 255, 1},
-        {181, 181, 181, 255, 1},
-        {196, 196, 196, 255, 1},
-        {162, 162, 162, 255, 1},
-        {165, 165, 165, 255, 1},
-        {169, 169, 169, 140, 1},
-        {137, 137, 137, 255, 1},
-        {95, 95, 95, 255, 1},
-        {177, 177, 177, 255, 2},
-        {101, 101, 101, 255, 1},
-        {84, 84, 84, 255, 1},
-        {116, 116, 116, 255, 1},
-        {198, 198, 198, 255, 1},
-        {191, 191, 191, 255, 1},
-        {151, 151, 151, 255, 1},
-        {98, 98, 98, 255, 1},
-        {146, 146, 146, 255, 1},
-        {202, 202, 202, 255, 1},
-        {118, 118, 118, 255, 1},
-        {86, 86, 86, 255, 1},
-        {83, 83, 83, 255, 1},
-        {174, 174, 174, 255, 1},
-        {186, 186, 186, 255, 1},
-        {143, 143, 143, 255, 1},
-        {98, 98, 98, 255, 1},
-        {109, 109, 109, 255, 1},
-        {208, 208, 208, 255, 1},
-        {162, 162, 162, 255, 1},
-        {98, 98, 98, 255, 1},
-        {82, 82, 82, 255, 1},
-        {153, 153, 153, 255, 1},
-        {202, 202, 202, 255, 1},
-        {190, 190, 190, 255, 1},
-        {138, 138, 138, 255, 1},
-        {106, 106, 106, 255, 1},
-        {185, 185, 185, 255, 1},
-        {189, 189, 189, 255, 1},
-        {102, 102, 102, 255, 1},
-        {86, 86, 86, 255, 1},
-        {108, 108, 108, 255, 1},
-        {199, 199, 199, 255, 1},
-        {185, 185, 185, 255, 1},
-        {142, 142, 142, 255, 1},
-        {106, 106, 106, 255, 1},
-        {154, 154, 154, 255, 1},
-        {208, 208, 208, 255, 1},
-        {134, 134, 134, 255, 1},
-        {90, 90, 90, 255, 1},
-        {81, 81, 81, 255, 1},
-        {182, 182, 182, 255, 1},
-        {194, 194, 194, 255, 1},
-        {154, 154, 154, 255, 1},
-        {99, 99, 99, 255, 1},
-        {114, 114, 114, 255, 1},
-        {200, 200, 200, 255, 1},
-        {131, 131, 131, 255, 1},
-        {87, 87, 87, 255, 1},
-        {82, 82, 82, 255, 1},
-        {148, 148, 148, 255, 1},
-        {200, 200, 200, 255, 1},
-        {187, 187, 187, 255, 1},
-        {134, 134, 134, 255, 1},
-        {104, 104, 104, 255, 1},
-        {185, 185, 185, 255, 1},
-        {192, 192, 192, 255, 1},
-        {114, 114, 114, 255, 1},
-        {90, 90, 90, 255, 1},
-        {137, 137, 137, 255, 1},
-        {163, 163, 163, 140, 1},
-        {191, 191, 191, 255, 1},
-        {192, 192, 192, 255, 1},
-        {172, 172, 172, 255, 1},
-        {75, 75, 75, 255, 1},
-        {127, 127, 127, 255, 1},
-        {98, 98, 98, 255, 1},
-        {171, 171, 171, 255, 1},
-        {182, 182, 182, 255, 1},
-        {164, 164, 164, 255, 1},
-        {179, 179, 179, 255, 1},
-        {190, 190, 190, 255, 1},
-        {199, 199, 199, 255, 1},
-        {102, 102, 102, 255, 1},
-        {105, 105, 105, 255, 1},
-        {116, 116, 116, 255, 1},
-        {127, 127, 127, 255, 1},
-        {188, 188, 188, 255, 1},
-        {172, 172, 172, 255, 1},
-        {176, 176, 176, 255, 1},
-        {174, 174, 174, 255, 1},
-        {188, 188, 188, 255, 1},
-        {142, 142, 142, 255, 1},
-        {87, 87, 87, 255, 1},
-        {129, 129, 129, 255, 1},
-        {101, 101, 101, 255, 1},
-        {195, 195, 195, 255, 1},
-        {171, 171, 171, 255, 1},
-        {179, 179, 179, 255, 1},
-        {190, 190, 190, 255, 1},
-        {196, 196, 196, 255, 1},
-        {173, 173, 173, 255, 1},
-        {82, 82, 82, 255, 1},
-        {138, 138, 138, 255, 1},
-        {101, 101, 101, 255, 1},
-        {155, 155, 155, 255, 1},
-        {180, 180, 180, 255, 1},
-        {170, 170, 170, 255, 1},
-        {183, 183, 183, 255, 1},
-        {191, 191, 191, 255, 1},
-        {193, 193, 193, 255, 1},
-        {105, 105, 105, 255, 1},
-        {108, 108, 108, 255, 1},
-        {104, 104, 104, 255, 1},
-        {133, 133, 133, 255, 1},
-        {197, 197, 197, 255, 1},
-        {170, 170, 170, 255, 1},
-        {171, 171, 171, 255, 1},
-        {183, 183, 183, 255, 1},
-        {197, 197, 197, 255, 1},
-        {140, 140, 140, 255, 1},
-        {87, 87, 87, 255, 1},
-        {147, 147, 147, 255, 1},
-        {92, 92, 92, 255, 1},
-        {184, 184, 184, 255, 1},
-        {175, 175, 175, 255, 1},
-        {177, 177, 177, 255, 1},
-        {184, 184, 184, 255, 1},
-        {197, 197, 197, 255, 1},
-        {179, 179, 179, 255, 1},
-        {82, 82, 82, 255, 1},
-        {139, 139, 139, 255, 1},
-        {105, 105, 105, 255, 1},
-        {186, 186, 186, 255, 1},
-        {167, 167, 167, 140, 1},
-        {170, 170, 170, 255, 1},
-        {172, 172, 172, 255, 1},
-        {82, 82, 82, 255, 1},
-        {174, 174, 174, 255, 1},
-        {117, 117, 117, 255, 1},
-        {122, 122, 122, 255, 1},
-        {190, 190, 190, 255, 1},
-        {168, 168, 168, 255, 1},
-        {177, 177, 177, 255, 1},
-        {169, 169, 169, 255, 1},
-        {195, 195, 195, 255, 1},
-        {116, 116, 116, 255, 1},
-        {130, 130, 130, 255, 1},
-        {162, 162, 162, 255, 1},
-        {84, 84, 84, 255, 1},
-        {188, 188, 188, 255, 1},
-        {171, 171, 171, 255, 1},
-        {173, 173, 173, 255, 2},
-        {184, 184, 184, 255, 1},
-        {155, 155, 155, 255, 1},
-        {85, 85, 85, 255, 1},
-        {178, 178, 178, 255, 1},
-        {80, 80, 80, 255, 1},
-        {166, 166, 166, 255, 1},
-        {181, 181, 181, 255, 1},
-        {171, 171, 171, 255, 1},
-        {176, 176, 176, 255, 1},
-        {174, 174, 174, 255, 1},
-        {177, 177, 177, 255, 1},
-        {78, 78, 78, 255, 1},
-        {174, 174, 174, 255, 1},
-        {108, 108, 108, 255, 1},
-        {98, 98, 98, 255, 1},
-        {189, 189, 189, 255, 1},
-        {162, 162, 162, 255, 1},
-        {173, 173, 173, 255, 1},
-        {172, 172, 172, 255, 1},
-        {194, 194, 194, 255, 1},
-        {111, 111, 111, 255, 1},
-        {123, 123, 123, 255, 1},
-        {146, 146, 146, 255, 1},
-        {91, 91, 91, 255, 1},
-        {193, 193, 193, 255, 1},
-        {173, 173, 173, 255, 1},
-        {177, 177, 177, 255, 1},
-        {170, 170, 170, 255, 1},
-        {183, 183, 183, 255, 1},
-        {154, 154, 154, 255, 1},
-        {92, 92, 92, 255, 1},
-        {192, 192, 192, 255, 1},
-        {85, 85, 85, 255, 1},
-        {160, 160, 160, 255, 1},
-        {181, 181, 181, 255, 1},
-        {175, 175, 175, 255, 1},
-        {179, 179, 179, 255, 1},
-        {174, 174, 174, 255, 1},
-        {189, 189, 189, 255, 1},
-        {87, 87, 87, 255, 1},
-        {178, 178, 178, 255, 1},
-        {112, 112, 112, 255, 1},
-        {121, 121, 121, 255, 1},
-        {196, 196, 196, 255, 1},
-        {169, 169, 169, 140, 1},
-        {171, 171, 171, 255, 1},
-        {85, 85, 85, 255, 1},
-        {127, 127, 127, 255, 1},
-        {111, 111, 111, 255, 1},
-        {113, 113, 113, 255, 1},
-        {200, 200, 200, 255, 1},
-        {189, 189, 189, 255, 1},
-        {181, 181, 181, 255, 1},
-        {174, 174, 174, 255, 1},
-        {187, 187, 187, 255, 1},
-        {162, 162, 162, 255, 1},
-        {100, 100, 100, 255, 1},
-        {138, 138, 138, 255, 1},
-        {87, 87, 87, 255, 1},
-        {180, 180, 180, 255, 1},
-        {193, 193, 193, 255, 1},
-        {182, 182, 182, 255, 1},
-        {174, 174, 174, 255, 1},
-        {179, 179, 179, 255, 1},
-        {182, 182, 182, 255, 1},
-        {99, 99, 99, 255, 1},
-        {135, 135, 135, 255, 1},
-        {78, 78, 78, 255, 1},
-        {152, 152, 152, 255, 1},
-        {206, 206, 206, 255, 1},
-        {187, 187, 187, 255, 1},
-        {174, 174, 174, 255, 1},
-        {172, 172, 172, 255, 1},
-        {192, 192, 192, 255, 1},
-        {113, 113, 113, 255, 1},
-        {133, 133, 133, 255, 1},
-        {107, 107, 107, 255, 1},
-        {104, 104, 104, 255, 1},
-        {164, 164, 164, 255, 1},
-        {166, 166, 166, 255, 1},
-        {175, 175, 175, 255, 1},
-        {170, 170, 170, 255, 1},
-        {189, 189, 189, 255, 1},
-        {156, 156, 156, 255, 1},
-        {101, 101, 101, 255, 1},
-        {126, 126, 126, 255, 1},
-        {87, 87, 87, 255, 1},
-        {189, 189, 189, 255, 1},
-        {196, 196, 196, 255, 1},
-        {184, 184, 184, 255, 1},
-        {177, 177, 177, 255, 1},
-        {180, 180, 180, 255, 2},
-        {101, 101, 101, 255, 1},
-        {149, 149, 149, 255, 1},
-        {83, 83, 83, 255, 1},
-        {153, 153, 153, 255, 1},
-        {198, 198, 198, 255, 1},
-        {186, 186, 186, 255, 1},
-        {177, 177, 177, 255, 1},
-        {170, 170, 170, 255, 1},
-        {196, 196, 196, 255, 1},
-        {122, 122, 122, 255, 1},
-        {130, 130, 130, 255, 1},
-        {108, 108, 108, 255, 1},
-        {119, 119, 119, 255, 1},
-        {201, 201, 201, 255, 1},
-        {200, 200, 200, 255, 1},
-        {185, 185, 185, 140, 1},
-        {159, 159, 159, 255, 1},
-        {75, 75, 75, 255, 1},
-        {90, 90, 90, 255, 1},
-        {122, 122, 122, 255, 1},
-        {211, 211, 211, 255, 1},
-        {140, 140, 140, 255, 1},
-        {112, 112, 112, 255, 1},
-        {160, 160, 160, 255, 1},
-        {195, 195, 195, 255, 1},
-        {192, 192, 192, 255, 1},
-        {105, 105, 105, 255, 1},
-        {84, 84, 84, 255, 1},
-        {108, 108, 108, 255, 1},
-        {194, 194, 194, 255, 1},
-        {172, 172, 172, 255, 1},
-        {105, 105, 105, 255, 1},
-        {150, 150, 150, 255, 1},
-        {196, 196, 196, 255, 1},
-        {197, 197, 197, 255, 1},
-        {134, 134, 134, 255, 1},
-        {80, 80, 80, 255, 1},
-        {97, 97, 97, 255, 1},
-        {170, 170, 170, 255, 1},
-        {198, 198, 198, 255, 1},
-        {108, 108, 108, 255, 1},
-        {126, 126, 126, 255, 1},
-        {184, 184, 184, 255, 1},
-        {198, 198, 198, 255, 1},
-        {169, 169, 169, 255, 1},
-        {81, 81, 81, 255, 1},
-        {99, 99, 99, 255, 1},
-        {136, 136, 136, 255, 1},
-        {194, 194, 194, 255, 1},
-        {116, 116, 116, 255, 1},
-        {90, 90, 90, 255, 1},
-        {153, 153, 153, 255, 1},
-        {197, 197, 197, 255, 1},
-        {193, 193, 193, 255, 1},
-        {99, 99, 99, 255, 1},
-        {80, 80, 80, 255, 1},
-        {105, 105, 105, 255, 1},
-        {192, 192, 192, 255, 1},
-        {167, 167, 167, 255, 1},
-        {103, 103, 103, 255, 1},
-        {149, 149, 149, 255, 1},
-        {193, 193, 193, 255, 1},
-        {196, 196, 196, 255, 1},
-        {135, 135, 135, 255, 1},
-        {85, 85, 85, 255, 1},
-        {105, 105, 105, 255, 1},
-        {165, 165, 165, 255, 1},
-        {198, 198, 198, 255, 1},
-        {111, 111, 111, 255, 1},
-        {129, 129, 129, 255, 1},
-        {182, 182, 182, 255, 1},
-        {195, 195, 195, 255, 1},
-        {169, 169, 169, 255, 1},
-        {78, 78, 78, 255, 1},
-        {96, 96, 96, 255, 1},
-        {140, 140, 140, 255, 1},
-        {213, 213, 213, 255, 1},
-        {133, 133, 133, 255, 1},
-        {131, 131, 131, 255, 1},
-        {187, 187, 187, 140, 1},
-        {186, 186, 186, 255, 1},
-        {128, 128, 128, 255, 1},
-        {164, 164, 164, 255, 1},
-        {189, 189, 189, 255, 1},
-        {190, 190, 190, 255, 1},
-        {156, 156, 156, 255, 1},
-        {92, 92, 92, 255, 1},
-        {101, 101, 101, 255, 1},
-        {121, 121, 121, 255, 1},
-        {191, 191, 191, 255, 1},
-        {134, 134, 134, 255, 1},
-        {162, 162, 162, 255, 1},
-        {181, 181, 181, 255, 1},
-        {183, 183, 183, 255, 1},
-        {184, 184, 184, 255, 1},
-        {96, 96, 96, 255, 1},
-        {106, 106, 106, 255, 1},
-        {102, 102, 102, 255, 1},
-        {183, 183, 183, 255, 1},
-        {150, 150, 150, 255, 1},
-        {138, 138, 138, 255, 1},
-        {190, 190, 190, 255, 1},
-        {186, 186, 186, 255, 1},
-        {192, 192, 192, 255, 1},
-        {110, 110, 110, 255, 1},
-        {94, 94, 94, 255, 1},
-        {95, 95, 95, 255, 1},
-        {168, 168, 168, 255, 1},
-        {180, 180, 180, 255, 1},
-        {122, 122, 122, 255, 1},
-        {178, 178, 178, 255, 1},
-        {197, 197, 197, 255, 1},
-        {189, 189, 189, 255, 1},
-        {132, 132, 132, 255, 1},
-        {88, 88, 88, 255, 1},
-        {94, 94, 94, 255, 1},
-        {129, 129, 129, 255, 1},
-        {199, 199, 199, 255, 1},
-        {133, 133, 133, 255, 1},
-        {152, 152, 152, 255, 1},
-        {195, 195, 195, 255, 1},
-        {184, 184, 184, 255, 1},
-        {173, 173, 173, 255, 1},
-        {91, 91, 91, 255, 1},
-        {99, 99, 99, 255, 1},
-        {98, 98, 98, 255, 1},
-        {194, 194, 194, 255, 1},
-        {159, 159, 159, 255, 1},
-        {143, 143, 143, 255, 1},
-        {192, 192, 192, 255, 1},
-        {189, 189, 189, 255, 2},
-        {112, 112, 112, 255, 1},
-        {98, 98, 98, 255, 1},
-        {94, 94, 94, 255, 1},
-        {167, 167, 167, 255, 1},
-        {180, 180, 180, 255, 1},
-        {128, 128, 128, 255, 1},
-        {179, 179, 179, 255, 1},
-        {193, 193, 193, 255, 1},
-        {187, 187, 187, 255, 1},
-        {145, 145, 145, 255, 1},
-        {99, 99, 99, 255, 1},
-        {71, 71, 71, 140, 1},
-        {164, 164, 164, 255, 1},
-        {200, 200, 200, 255, 1},
-        {173, 173, 173, 255, 1},
-        {174, 174, 174, 255, 1},
-        {177, 177, 177, 255, 1},
-        {187, 187, 187, 255, 1},
-        {110, 110, 110, 255, 1},
-        {148, 148, 148, 255, 1},
-        {111, 111, 111, 255, 1},
-        {118, 118, 118, 255, 1},
-        {208, 208, 208, 255, 1},
-        {180, 180, 180, 255, 1},
-        {170, 170, 170, 255, 1},
-        {173, 173, 173, 255, 1},
-        {190, 190, 190, 255, 1},
-        {132, 132, 132, 255, 1},
-        {112, 112, 112, 255, 1},
-        {145, 145, 145, 255, 1},
-        {84, 84, 84, 255, 1},
-        {176, 176, 176, 255, 1},
-        {181, 181, 181, 255, 1},
-        {169, 169, 169, 255, 1},
-        {171, 171, 171, 255, 1},
-        {178, 178, 178, 255, 1},
-        {174, 174, 174, 255, 1},
-        {95, 95, 95, 255, 1},
-        {157, 157, 157, 255, 1},
-        {90, 90, 90, 255, 1},
-        {159, 159, 159, 255, 1},
-        {202, 202, 202, 255, 1},
-        {176, 176, 176, 255, 1},
-        {179, 179, 179, 255, 1},
-        {175, 175, 175, 255, 1},
-        {183, 183, 183, 255, 1},
-        {97, 97, 97, 255, 1},
-        {145, 145, 145, 255, 1},
-        {113, 113, 113, 255, 1},
-        {114, 114, 114, 255, 1},
-        {205, 205, 205, 255, 1},
-        {184, 184, 184, 255, 1},
-        {175, 175, 175, 255, 1},
-        {174, 174, 174, 255, 1},
-        {191, 191, 191, 255, 1},
-        {140, 140, 140, 255, 1},
-        {114, 114, 114, 255, 1},
-        {143, 143, 143, 255, 1},
-        {88, 88, 88, 255, 1},
-        {196, 196, 196, 255, 1},
-        {191, 191, 191, 255, 1},
-        {172, 172, 172, 255, 1},
-        {173, 173, 173, 255, 1},
-        {174, 174, 174, 255, 1},
-        {158, 158, 158, 255, 1},
-        {96, 96, 96, 255, 1},
-        {160, 160, 160, 255, 1},
-        {86, 86, 86, 255, 1},
-        {164, 164, 164, 255, 1},
-        {204, 204, 204, 255, 1},
-        {175, 175, 175, 255, 2},
-        {174, 174, 174, 255, 1},
-        {188, 188, 188, 255, 1},
-        {111, 111, 111, 255, 1},
-        {171, 171, 171, 140, 1},
-        {102, 102, 102, 255, 1},
-        {172, 172, 172, 255, 1},
-        {178, 178, 178, 255, 1},
-        {163, 163, 163, 255, 1},
-        {148, 148, 148, 255, 1},
-        {178, 178, 178, 255, 1},
-        {180, 180, 180, 255, 1},
-        {79, 79, 79, 255, 1},
-        {179, 179, 179, 255, 1},
-        {106, 106, 106, 255, 1},
-        {136, 136, 136, 255, 1},
-        {190, 190, 190, 255, 1},
-        {166, 166, 166, 255, 1},
-        {171, 171, 171, 255, 1},
-        {172, 172, 172, 255, 1},
-        {192, 192, 192, 255, 1},
-        {99, 99, 99, 255, 1},
-        {139, 139, 139, 255, 1},
-        {143, 143, 143, 255, 1},
-        {94, 94, 94, 255, 1},
-        {187, 187, 187, 255, 1},
-        {169, 169, 169, 255, 1},
-        {175, 175, 175, 255, 1},
-        {166, 166, 166, 255, 1},
-        {194, 194, 194, 255, 1},
-        {146, 146, 146, 255, 1},
-        {98, 98, 98, 255, 1},
-        {181, 181, 181, 255, 1},
-        {89, 89, 89, 255, 1},
-        {178, 178, 178, 255, 1},
-        {179, 179, 179, 255, 1},
-        {177, 177, 177, 255, 1},
-        {165, 165, 165, 255, 1},
-        {184, 184, 184, 255, 1},
-        {177, 177, 177, 255, 1},
-        {84, 84, 84, 255, 1},
-        {183, 183, 183, 255, 1},
-        {102, 102, 102, 255, 1},
-        {131, 131, 131, 255, 1},
-        {185, 185, 185, 255, 1},
-        {177, 177, 177, 255, 1},
-        {176, 176, 176, 255, 1},
-        {171, 171, 171, 255, 1},
-        {204, 204, 204, 255, 1},
-        {103, 103, 103, 255, 1},
-        {141, 141, 141, 255, 1},
-        {146, 146, 146, 255, 1},
-        {109, 109, 109, 255, 1},
-        {185, 185, 185, 255, 1},
-        {171, 171, 171, 255, 1},
-        {177, 177, 177, 255, 1},
-        {165, 165, 165, 255, 1},
-        {188, 188, 188, 255, 1},
-        {143, 143, 143, 255, 1},
-        {101, 101, 101, 255, 1},
-        {175, 175, 175, 255, 1},
-        {84, 84, 84, 255, 1},
-        {175, 175, 175, 255, 1},
-        {176, 176, 176, 255, 1},
-        {178, 178, 178, 255, 1},
-        {172, 172, 172, 255, 1},
-        {183, 183, 183, 255, 1},
-        {191, 191, 191, 255, 1},
-        {136, 136, 136, 140, 1},
-        {132, 132, 132, 255, 1},
-        {113, 113, 113, 255, 1},
-        {193, 193, 193, 255, 1},
-        {153, 153, 153, 255, 1},
-        {156, 156, 156, 255, 1},
-        {173, 173, 173, 255, 1},
-        {168, 168, 168, 255, 1},
-        {167, 167, 167, 255, 1},
-        {80, 80, 80, 255, 1},
-        {129, 129, 129, 255, 1},
-        {101, 101, 101, 255, 1},
-        {185, 185, 185, 255, 1},
-        {172, 172, 172, 255, 1},
-        {176, 176, 176, 255, 1},
-        {193, 193, 193, 255, 1},
-        {167, 167, 167, 255, 1},
-        {184, 184, 184, 255, 1},
-        {103, 103, 103, 255, 1},
-        {110, 110, 110, 255, 1},
-        {105, 105, 105, 255, 1},
-        {144, 144, 144, 255, 1},
-        {184, 184, 184, 255, 1},
-        {178, 178, 178, 255, 1},
-        {194, 194, 194, 255, 1},
-        {171, 171, 171, 255, 1},
-        {189, 189, 189, 255, 1},
-        {144, 144, 144, 255, 1},
-        {95, 95, 95, 255, 1},
-        {120, 120, 120, 255, 1},
-        {123, 123, 123, 255, 1},
-        {194, 194, 194, 255, 1},
-        {170, 170, 170, 255, 1},
-        {182, 182, 182, 255, 1},
-        {180, 180, 180, 255, 1},
-        {179, 179, 179, 255, 1},
-        {167, 167, 167, 255, 1},
-        {66, 66, 66, 255, 1},
-        {125, 125, 125, 255, 1},
-        {92, 92, 92, 255, 1},
-        {171, 171, 171, 255, 1},
-        {175, 175, 175, 255, 1},
-        {184, 184, 184, 255, 1},
-        {191, 191, 191, 255, 1},
-        {174, 174, 174, 255, 1},
-        {191, 191, 191, 255, 1},
-        {105, 105, 105, 255, 1},
-        {117, 117, 117, 255, 1},
-        {104, 104, 104, 255, 1},
-        {140, 140, 140, 255, 1},
-        {182, 182, 182, 255, 1},
-        {174, 174, 174, 255, 1},
-        {186, 186, 186, 255, 1},
-        {161, 161, 161, 255, 1},
-        {184, 184, 184, 255, 1},
-        {146, 146, 146, 255, 1},
-        {94, 94, 94, 255, 1},
-        {115, 115, 115, 255, 1},
-        {114, 114, 114, 255, 1},
-        {190, 190, 190, 255, 1},
-        {171, 171, 171, 255, 1},
-        {191, 191, 191, 255, 1},
-        {187, 187, 187, 255, 1},
-        {192, 192, 192, 255, 1},
-        {136, 136, 136, 140, 1},
-        {122, 122, 122, 255, 1},
-        {85, 85, 85, 255, 1},
-        {162, 162, 162, 255, 1},
-        {172, 172, 172, 255, 1},
-        {125, 125, 125, 255, 1},
-        {84, 84, 84, 255, 1},
-        {96, 96, 96, 255, 1},
-        {196, 196, 196, 255, 1},
-        {176, 176, 176, 255, 1},
-        {122, 122, 122, 255, 1},
-        {90, 90, 90, 255, 1},
-        {146, 146, 146, 255, 1},
-        {210, 210, 210, 255, 1},
-        {173, 173, 173, 255, 1},
-        {112, 112, 112, 255, 1},
-        {83, 83, 83, 255, 1},
-        {163, 163, 163, 255, 1},
-        {194, 194, 194, 255, 1},
-        {120, 120, 120, 255, 1},
-        {92, 92, 92, 255, 1},
-        {101, 101, 101, 255, 1},
-        {203, 203, 203, 255, 1},
-        {180, 180, 180, 255, 1},
-        {106, 106, 106, 255, 1},
-        {86, 86, 86, 255, 1},
-        {144, 144, 144, 255, 1},
-        {210, 210, 210, 255, 1},
-        {170, 170, 170, 255, 1},
-        {112, 112, 112, 255, 1},
-        {88, 88, 88, 255, 1},
-        {183, 183, 183, 255, 1},
-        {199, 199, 199, 255, 1},
-        {120, 120, 120, 255, 1},
-        {93, 93, 93, 255, 1},
-        {103, 103, 103, 255, 1},
-        {185, 185, 185, 255, 1},
-        {155, 155, 155, 255, 1},
-        {106, 106, 106, 255, 1},
-        {82, 82, 82, 255, 1},
-        {138, 138, 138, 255, 1},
-        {199, 199, 199, 255, 1},
-        {157, 157, 157, 255, 1},
-        {107, 107, 107, 255, 1},
-        {92, 92, 92, 255, 1},
-        {181, 181, 181, 255, 1},
-        {205, 205, 205, 255, 1},
-        {141, 141, 141, 255, 1},
-        {90, 90, 90, 255, 1},
-        {97, 97, 97, 255, 1},
-        {192, 192, 192, 255, 1},
-        {169, 169, 169, 255, 1},
-        {100, 100, 100, 255, 1},
-        {85, 85, 85, 255, 1},
-        {134, 134, 134, 255, 1},
-        {214, 214, 214, 255, 1},
-        {148, 148, 148, 255, 1},
-        {92, 92, 92, 255, 1},
-        {88, 88, 88, 255, 1},
-        {180, 180, 180, 255, 1},
-        {203, 203, 203, 255, 1},
-        {148, 148, 148, 255, 1},
-        {95, 95, 95, 255, 1},
-        {131, 131, 131, 255, 1},
-        {167, 167, 167, 140, 1},
-        {185, 185, 185, 255, 1},
-        {157, 157, 157, 255, 1},
-        {173, 173, 173, 255, 1},
-        {87, 87, 87, 255, 1},
-        {99, 99, 99, 255, 1},
-        {90, 90, 90, 255, 1},
-        {126, 126, 126, 255, 1},
-        {176, 176, 176, 255, 1},
-        {172, 172, 172, 255, 1},
-        {191, 191, 191, 255, 1},
-        {175, 175, 175, 255, 1},
-        {191, 191, 191, 255, 1},
-        {149, 149, 149, 255, 1},
-        {90, 90, 90, 255, 1},
-        {118, 118, 118, 255, 1},
-        {113, 113, 113, 255, 1},
-        {176, 176, 176, 255, 1},
-        {169, 169, 169, 255, 1},
-        {185, 185, 185, 255, 1},
-        {170, 170, 170, 255, 1},
-        {172, 172, 172, 255, 1},
-        {178, 178, 178, 255, 1},
-        {84, 84, 84, 255, 1},
-        {119, 119, 119, 255, 1},
-        {94, 94, 94, 255, 1},
-        {175, 175, 175, 255, 1},
-        {176, 176, 176, 255, 2},
-        {196, 196, 196, 255, 1},
-        {172, 172, 172, 255, 1},
-        {196, 196, 196, 255, 1},
-        {108, 108, 108, 255, 1},
-        {110, 110, 110, 255, 1},
-        {103, 103, 103, 255, 1},
-        {127, 127, 127, 255, 1},
-        {176, 176, 176, 255, 1},
-        {175, 175, 175, 255, 1},
-        {174, 174, 174, 255, 1},
-        {155, 155, 155, 255, 1},
-        {177, 177, 177, 255, 1},
-        {129, 129, 129, 255, 1},
-        {89, 89, 89, 255, 1},
-        {115, 115, 115, 255, 1},
-        {119, 119, 119, 255, 1},
-        {195, 195, 195, 255, 1},
-        {166, 166, 166, 255, 1},
-        {192, 192, 192, 255, 1},
-        {182, 182, 182, 255, 1},
-        {174, 174, 174, 255, 1},
-        {154, 154, 154, 255, 1},
-        {78, 78, 78, 255, 1},
-        {128, 128, 128, 255, 1},
-        {92, 92, 92, 255, 1},
-        {175, 175, 175, 255, 1},
-        {180, 180, 180, 255, 1},
-        {183, 183, 183, 255, 1},
-        {182, 182, 182, 255, 1},
-        {164, 164, 164, 255, 1},
-        {191, 191, 191, 255, 1},
-        {108, 108, 108, 255, 1},
-        {109, 109, 109, 255, 1},
-        {98, 98, 98, 255, 1},
-        {171, 171, 171, 255, 1},
-        {152, 152, 152, 140, 1},
-        {179, 179, 179, 255, 1},
-        {197, 197, 197, 255, 1},
-        {96, 96, 96, 255, 1},
-        {131, 131, 131, 255, 1},
-        {139, 139, 139, 255, 1},
-        {91, 91, 91, 255, 1},
-        {170, 170, 170, 255, 1},
-        {173, 173, 173, 255, 1},
-        {174, 174, 174, 255, 1},
-        {165, 165, 165, 255, 1},
-        {196, 196, 196, 255, 1},
-        {156, 156, 156, 255, 1},
-        {91, 91, 91, 255, 1},
-        {159, 159, 159, 255, 1},
-        {81, 81, 81, 255, 1},
-        {177, 177, 177, 255, 1},
-        {172, 172, 172, 255, 1},
-        {161, 161, 161, 255, 1},
-        {167, 167, 167, 255, 1},
-        {179, 179, 179, 255, 1},
-        {181, 181, 181, 255, 1},
-        {82, 82, 82, 255, 1},
-        {175, 175, 175, 255, 1},
-        {106, 106, 106, 255, 1},
-        {140, 140, 140, 255, 1},
-        {185, 185, 185, 255, 1},
-        {168, 168, 168, 255, 1},
-        {172, 172, 172, 255, 1},
-        {169, 169, 169, 255, 1},
-        {197, 197, 197, 255, 1},
-        {106, 106, 106, 255, 1},
-        {140, 140, 140, 255, 1},
-        {143, 143, 143, 255, 1},
-        {99, 99, 99, 255, 1},
-        {181, 181, 181, 255, 1},
-        {169, 169, 169, 255, 1},
-        {148, 148, 148, 255, 2},
-        {186, 186, 186, 255, 1},
-        {130, 130, 130, 255, 1},
-        {92, 92, 92, 255, 1},
-        {170, 170, 170, 255, 1},
-        {88, 88, 88, 255, 1},
-        {183, 183, 183, 255, 1},
-        {176, 176, 176, 255, 1},
-        {168, 168, 168, 255, 1},
-        {172, 172, 172, 255, 1},
-        {183, 183, 183, 255, 1},
-        {178, 178, 178, 255, 1},
-        {74, 74, 74, 255, 1},
-        {183, 183, 183, 255, 1},
-        {106, 106, 106, 255, 1},
-        {131, 131, 131, 255, 1},
-        {184, 184, 184, 255, 1},
-        {179, 179, 179, 255, 1},
-        {177, 177, 177, 255, 1},
-        {171, 171, 171, 255, 1},
-        {202, 202, 202, 255, 1},
-        {97, 97, 97, 255, 1},
-        {135, 135, 135, 255, 1},
-        {144, 144, 144, 255, 1},
-        {104, 104, 104, 255, 1},
-        {200, 200, 200, 255, 1},
-        {163, 163, 163, 140, 1},
-        {195, 195, 195, 255, 1},
-        {129, 129, 129, 255, 1},
-        {106, 106, 106, 255, 1},
-        {145, 145, 145, 255, 1},
-        {74, 74, 74, 255, 1},
-        {178, 178, 178, 255, 1},
-        {182, 182, 182, 255, 1},
-        {175, 175, 175, 255, 1},
-        {168, 168, 168, 255, 1},
-        {175, 175, 175, 255, 1},
-        {183, 183, 183, 255, 1},
-        {93, 93, 93, 255, 1},
-        {140, 140, 140, 255, 1},
-        {86, 86, 86, 255, 1},
-        {159, 159, 159, 255, 1},
-        {205, 205, 205, 255, 1},
-        {175, 175, 175, 255, 1},
-        {172, 172, 172, 255, 1},
-        {168, 168, 168, 255, 1},
-        {184, 184, 184, 255, 1},
-        {102, 102, 102, 255, 1},
-        {148, 148, 148, 255, 1},
-        {118, 118, 118, 255, 1},
-        {120, 120, 120, 255, 1},
-        {209, 209, 209, 255, 1},
-        {169, 169, 169, 255, 1},
-        {171, 171, 171, 255, 1},
-        {172, 172, 172, 255, 1},
-        {191, 191, 191, 255, 1},
-        {140, 140, 140, 255, 1},
-        {108, 108, 108, 255, 1},
-        {141, 141, 141, 255, 1},
-        {91, 91, 91, 255, 1},
-        {190, 190, 190, 255, 1},
-        {189, 189, 189, 255, 1},
-        {173, 173, 173, 255, 1},
-        {144, 144, 144, 255, 1},
-        {164, 164, 164, 255, 1},
-        {158, 158, 158, 255, 1},
-        {89, 89, 89, 255, 1},
-        {152, 152, 152, 255, 1},
-        {86, 86, 86, 255, 1},
-        {168, 168, 168, 255, 1},
-        {206, 206, 206, 255, 1},
-        {171, 171, 171, 255, 1},
-        {167, 167, 167, 255, 1},
-        {173, 173, 173, 255, 1},
-        {194, 194, 194, 255, 1},
-        {105, 105, 105, 255, 1},
-        {153, 153, 153, 255, 1},
-        {117, 117, 117, 255, 1},
-        {108, 108, 108, 255, 1},
-        {203, 203, 203, 255, 1},
-        {182, 182, 182, 255, 1},
-        {173, 173, 173, 255, 2},
-        {195, 195, 195, 255, 1},
-        {143, 143, 143, 255, 1},
-        {114, 114, 114, 255, 1},
-        {138, 138, 138, 255, 1},
-        {90, 90, 90, 255, 1},
-        {201, 201, 201, 255, 1},
-        {202, 202, 202, 255, 1},
-        {182, 182, 182, 140, 1},
-        {188, 188, 188, 255, 1},
-        {84, 84, 84, 255, 1},
-        {101, 101, 101, 255, 1},
-        {79, 79, 79, 255, 1},
-        {161, 161, 161, 255, 1},
-        {146, 146, 146, 255, 1},
-        {124, 124, 124, 255, 1},
-        {178, 178, 178, 255, 1},
-        {177, 177, 177, 255, 1},
-        {196, 196, 196, 255, 1},
-        {119, 119, 119, 255, 1},
-        {85, 85, 85, 255, 1},
-        {99, 99, 99, 255, 1},
-        {173, 173, 173, 255, 1},
-        {183, 183, 183, 255, 1},
-        {134, 134, 134, 255, 1},
-        {182, 182, 182, 255, 1},
-        {193, 193, 193, 255, 1},
-        {189, 189, 189, 255, 1},
-        {144, 144, 144, 255, 1},
-        {92, 92, 92, 255, 1},
-        {96, 96, 96, 255, 1},
-        {119, 119, 119, 255, 1},
-        {191, 191, 191, 255, 1},
-        {128, 128, 128, 255, 1},
-        {153, 153, 153, 255, 1},
-        {197, 197, 197, 255, 1},
-        {178, 178, 178, 255, 1},
-        {181, 181, 181, 255, 1},
-        {93, 93, 93, 255, 1},
-        {99, 99, 99, 255, 1},
-        {104, 104, 104, 255, 1},
-        {197, 197, 197, 255, 1},
-        {152, 152, 152, 255, 1},
-        {139, 139, 139, 255, 1},
-        {179, 179, 179, 255, 1},
-        {167, 167, 167, 255, 1},
-        {177, 177, 177, 255, 1},
-        {99, 99, 99, 255, 1},
-        {95, 95, 95, 255, 1},
-        {85, 85, 85, 255, 1},
-        {171, 171, 171, 255, 1},
-        {183, 183, 183, 255, 1},
-        {138, 138, 138, 255, 1},
-        {186, 186, 186, 255, 1},
-        {192, 192, 192, 255, 1},
-        {187, 187, 187, 255, 1},
-        {152, 152, 152, 255, 1},
-        {91, 91, 91, 255, 1},
-        {102, 102, 102, 255, 1},
-        {134, 134, 134, 255, 1},
-        {195, 195, 195, 255, 1},
-        {132, 132, 132, 255, 1},
-        {160, 160, 160, 255, 1},
-        {179, 179, 179, 255, 1},
-        {188, 188, 188, 255, 1},
-        {171, 171, 171, 255, 1},
-        {85, 85, 85, 255, 1},
-        {103, 103, 103, 255, 2},
-        {189, 189, 189, 255, 1},
-        {156, 156, 156, 255, 1},
-        {165, 165, 165, 255, 1},
-        {213, 213, 213, 140, 1},
-        {184, 184, 184, 255, 1},
-        {102, 102, 102, 255, 1},
-        {145, 145, 145, 255, 1},
-        {179, 179, 179, 255, 1},
-        {185, 185, 185, 255, 1},
-        {126, 126, 126, 255, 1},
-        {86, 86, 86, 255, 1},
-        {91, 91, 91, 255, 1},
-        {159, 159, 159, 255, 1},
-        {207, 207, 207, 255, 1},
-        {110, 110, 110, 255, 1},
-        {133, 133, 133, 255, 1},
-        {192, 192, 192, 255, 1},
-        {197, 197, 197, 255, 1},
-        {169, 169, 169, 255, 1},
-        {84, 84, 84, 255, 1},
-        {101, 101, 101, 255, 1},
-        {135, 135, 135, 255, 1},
-        {208, 208, 208, 255, 1},
-        {134, 134, 134, 255, 1},
-        {112, 112, 112, 255, 1},
-        {152, 152, 152, 255, 1},
-        {189, 189, 189, 255, 1},
-        {182, 182, 182, 255, 1},
-        {106, 106, 106, 255, 1},
-        {88, 88, 88, 255, 1},
-        {109, 109, 109, 255, 1},
-        {193, 193, 193, 255, 1},
-        {161, 161, 161, 255, 1},
-        {105, 105, 105, 255, 1},
-        {151, 151, 151, 255, 1},
-        {197, 197, 197, 255, 1},
-        {196, 196, 196, 255, 1},
-        {131, 131, 131, 255, 1},
-        {84, 84, 84, 255, 1},
-        {101, 101, 101, 255, 1},
-        {146, 146, 146, 255, 1},
-        {186, 186, 186, 255, 1},
-        {104, 104, 104, 255, 1},
-        {114, 114, 114, 255, 1},
-        {177, 177, 177, 255, 1},
-        {193, 193, 193, 255, 1},
-        {175, 175, 175, 255, 1},
-        {83, 83, 83, 255, 1},
-        {97, 97, 97, 255, 1},
-        {145, 145, 145, 255, 1},
-        {211, 211, 211, 255, 1},
-        {130, 130, 130, 255, 1},
-        {109, 109, 109, 255, 1},
-        {172, 172, 172, 255, 1},
-        {197, 197, 197, 255, 1},
-        {194, 194, 194, 255, 1},
-        {94, 94, 94, 255, 1},
-        {86, 86, 86, 255, 1},
-        {101, 101, 101, 255, 1},
-        {181, 181, 181, 255, 1},
-        {163, 163, 163, 255, 1},
-        {100, 100, 100, 255, 1},
-        {139, 139, 139, 255, 1},
-        {197, 197, 197, 255, 1},
-        {192, 192, 192, 255, 1},
-        {129, 129, 129, 255, 1},
-        {100, 100, 100, 255, 1},
-        {105, 105, 105, 140, 1},
-        {187, 187, 187, 255, 1},
-        {196, 196, 196, 255, 1},
-        {190, 190, 190, 255, 1},
-        {158, 158, 158, 255, 1},
-        {156, 156, 156, 255, 1},
-        {181, 181, 181, 255, 1},
-        {105, 105, 105, 255, 1},
-        {140, 140, 140, 255, 1},
-        {85, 85, 85, 255, 1},
-        {156, 156, 156, 255, 1},
-        {206, 206, 206, 255, 1},
-        {192, 192, 192, 255, 1},
-        {175, 175, 175, 255, 1},
-        {170, 170, 170, 255, 1},
-        {193, 193, 193, 255, 1},
-        {118, 118, 118, 255, 1},
-        {130, 130, 130, 255, 1},
-        {108, 108, 108, 255, 1},
-        {104, 104, 104, 255, 1},
-        {190, 190, 190, 255, 2},
-        {174, 174, 174, 255, 1},
-        {166, 166, 166, 255, 1},
-        {192, 192, 192, 255, 1},
-        {158, 158, 158, 255, 1},
-        {101, 101, 101, 255, 1},
-        {131, 131, 131, 255, 1},
-        {84, 84, 84, 255, 1},
-        {183, 183, 183, 255, 1},
-        {199, 199, 199, 255, 1},
-        {183, 183, 183, 255, 1},
-        {172, 172, 172, 255, 1},
-        {174, 174, 174, 255, 1},
-        {183, 183, 183, 255, 1},
-        {98, 98, 98, 255, 1},
-        {146, 146, 146, 255, 1},
-        {77, 77, 77, 255, 1},
-        {135, 135, 135, 255, 1},
-        {200, 200, 200, 255, 1},
-        {185, 185, 185, 255, 1},
-        {181, 181, 181, 255, 1},
-        {168, 168, 168, 255, 1},
-        {195, 195, 195, 255, 1},
-        {125, 125, 125, 255, 1},
-        {130, 130, 130, 255, 1},
-        {105, 105, 105, 255, 1},
-        {118, 118, 118, 255, 1},
-        {198, 198, 198, 255, 1},
-        {185, 185, 185, 255, 1},
-        {184, 184, 184, 255, 1},
-        {175, 175, 175, 255, 1},
-        {185, 185, 185, 255, 1},
-        {147, 147, 147, 255, 1},
-        {102, 102, 102, 255, 1},
-        {135, 135, 135, 255, 1},
-        {82, 82, 82, 255, 1},
-        {180, 180, 180, 255, 1},
-        {196, 196, 196, 255, 1},
-        {186, 186, 186, 255, 1},
-        {175, 175, 175, 255, 1},
-        {179, 179, 179, 255, 1},
-        {185, 185, 185, 255, 1},
-        {113, 113, 113, 255, 1},
-        {116, 116, 116, 140, 1},
-        {107, 107, 107, 255, 1},
-        {187, 187, 187, 255, 1},
-        {171, 171, 171, 255, 1},
-        {164, 164, 164, 255, 1},
-        {154, 154, 154, 255, 1},
-        {179, 179, 179, 255, 1},
-        {164, 164, 164, 255, 1},
-        {86, 86, 86, 255, 1},
-        {186, 186, 186, 255, 1},
-        {90, 90, 90, 255, 1},
-        {169, 169, 169, 255, 1},
-        {182, 182, 182, 255, 1},
-        {172, 172, 172, 255, 1},
-        {176, 176, 176, 255, 1},
-        {173, 173, 173, 255, 1},
-        {188, 188, 188, 255, 1},
-        {87, 87, 87, 255, 1},
-        {175, 175, 175, 255, 1},
-        {122, 122, 122, 255, 1},
-        {110, 110, 110, 255, 1},
-        {186, 186, 186, 255, 1},
-        {160, 160, 160, 255, 1},
-        {158, 158, 158, 255, 1},
-        {175, 175, 175, 255, 1},
-        {187, 187, 187, 255, 1},
-        {110, 110, 110, 255, 1},
-        {122, 122, 122, 255, 1},
-        {156, 156, 156, 255, 1},
-        {93, 93, 93, 255, 1},
-        {188, 188, 188, 255, 1},
-        {170, 170, 170, 255, 1},
-        {173, 173, 173, 255, 1},
-        {171, 171, 171, 255, 1},
-        {186, 186, 186, 255, 1},
-        {150, 150, 150, 255, 1},
-        {89, 89, 89, 255, 1},
-        {195, 195, 195, 255, 1},
-        {79, 79, 79, 255, 1},
-        {163, 163, 163, 255, 1},
-        {183, 183, 183, 255, 1},
-        {176, 176, 176, 255, 1},
-        {177, 177, 177, 255, 1},
-        {174, 174, 174, 255, 1},
-        {190, 190, 190, 255, 1},
-        {85, 85, 85, 255, 1},
-        {166, 166, 166, 255, 1},
-        {112, 112, 112, 255, 1},
-        {123, 123, 123, 255, 1},
-        {190, 190, 190, 255, 1},
-        {169, 169, 169, 255, 1},
-        {176, 176, 176, 255, 1},
-        {171, 171, 171, 255, 1},
-        {187, 187, 187, 255, 1},
-        {97, 97, 97, 255, 1},
-        {130, 130, 130, 255, 1},
-        {167, 167, 167, 255, 1},
-        {84, 84, 84, 255, 1},
-        {181, 181, 181, 255, 1},
-        {172, 172, 172, 255, 1},
-        {173, 173, 173, 255, 1},
-        {167, 167, 167, 255, 1},
-        {185, 185, 185, 255, 1},
-        {165, 165, 165, 255, 1},
-        {165, 165, 165, 140, 1},
-        {124, 124, 124, 255, 2},
-        {192, 192, 192, 255, 1},
-        {160, 160, 160, 255, 1},
-        {171, 171, 171, 255, 1},
-        {184, 184, 184, 255, 1},
-        {200, 200, 200, 255, 1},
-        {144, 144, 144, 255, 1},
-        {87, 87, 87, 255, 1},
-        {137, 137, 137, 255, 1},
-        {101, 101, 101, 255, 1},
-        {186, 186, 186, 255, 1},
-        {169, 169, 169, 255, 1},
-        {170, 170, 170, 255, 1},
-        {181, 181, 181, 255, 1},
-        {190, 190, 190, 255, 1},
-        {183, 183, 183, 255, 1},
-        {83, 83, 83, 255, 1},
-        {146, 146, 146, 255, 1},
-        {100, 100, 100, 255, 1},
-        {145, 145, 145, 255, 1},
-        {178, 178, 178, 255, 1},
-        {155, 155, 155, 255, 1},
-        {175, 175, 175, 255, 1},
-        {189, 189, 189, 255, 1},
-        {198, 198, 198, 255, 1},
-        {104, 104, 104, 255, 1},
-        {116, 116, 116, 255, 1},
-        {117, 117, 117, 255, 1},
-        {127, 127, 127, 255, 1},
-        {193, 193, 193, 255, 1},
-        {172, 172, 172, 255, 1},
-        {182, 182, 182, 255, 1},
-        {188, 188, 188, 255, 1},
-        {200, 200, 200, 255, 1},
-        {142, 142, 142, 255, 1},
-        {86, 86, 86, 255, 1},
-        {139, 139, 139, 255, 1},
-        {106, 106, 106, 255, 1},
-        {192, 192, 192, 255, 1},
-        {174, 174, 174, 255, 1},
-        {178, 178, 178, 255, 1},
-        {189, 189, 189, 255, 1},
-        {193, 193, 193, 255, 1},
-        {174, 174, 174, 255, 1},
-        {73, 73, 73, 255, 1},
-        {135, 135, 135, 255, 1},
-        {102, 102, 102, 255, 1},
-        {171, 171, 171, 255, 1},
-        {183, 183, 183, 255, 1},
-        {173, 173, 173, 255, 1},
-        {180, 180, 180, 255, 1},
-        {179, 179, 179, 255, 1},
-        {180, 180, 180, 255, 1},
-        {91, 91, 91, 255, 1},
-        {115, 115, 115, 255, 1},
-        {121, 121, 121, 255, 1},
-        {129, 129, 129, 255, 1},
-        {193, 193, 193, 255, 1},
-        {175, 175, 175, 255, 1},
-        {170, 170, 170, 255, 1},
-        {181, 181, 181, 255, 1},
-        {205, 205, 205, 255, 1},
-        {118, 118, 118, 140, 1},
-        {112, 112, 112, 255, 1},
-        {92, 92, 92, 255, 1},
-        {177, 177, 177, 255, 1},
-        {196, 196, 196, 255, 1},
-        {173, 173, 173, 255, 1},
-        {118, 118, 118, 255, 1},
-        {117, 117, 117, 255, 1},
-        {205, 205, 205, 255, 1},
-        {165, 165, 165, 255, 1},
-        {105, 105, 105, 255, 1},
-        {84, 84, 84, 255, 1},
-        {138, 138, 138, 255, 1},
-        {194, 194, 194, 255, 1},
-        {172, 172, 172, 255, 1},
-        {124, 124, 124, 255, 1},
-        {96, 96, 96, 255, 1},
-        {173, 173, 173, 255, 1},
-        {187, 187, 187, 255, 1},
-        {101, 101, 101, 255, 1},
-        {81, 81, 81, 255, 1},
-        {101, 101, 101, 255, 1},
-        {195, 195, 195, 255, 1},
-        {183, 183, 183, 255, 1},
-        {134, 134, 134, 255, 1},
-        {98, 98, 98, 255, 1},
-        {154, 154, 154, 255, 1},
-        {197, 197, 197, 255, 1},
-        {125, 125, 125, 255, 1},
-        {100, 100, 100, 255, 1},
-        {88, 88, 88, 255, 1},
-        {181, 181, 181, 255, 1},
-        {199, 199, 199, 255, 1},
-        {167, 167, 167, 255, 1},
-        {107, 107, 107, 255, 1},
-        {118, 118, 118, 255, 1},
-        {204, 204, 204, 255, 1},
-        {155, 155, 155, 255, 1},
-        {101, 101, 101, 255, 1},
-        {85, 85, 85, 255, 1},
-        {147, 147, 147, 255, 1},
-        {200, 200, 200, 255, 1},
-        {192, 192, 192, 255, 1},
-        {137, 137, 137, 255, 1},
-        {95, 95, 95, 255, 1},
-        {173, 173, 173, 255, 1},
-        {170, 170, 170, 255, 1},
-        {98, 98, 98, 255, 1},
-        {92, 92, 92, 255, 1},
-        {109, 109, 109, 255, 1},
-        {193, 193, 193, 255, 1},
-        {198, 198, 198, 255, 1},
-        {129, 129, 129, 255, 1},
-        {87, 87, 87, 255, 1},
-        {146, 146, 146, 255, 1},
-        {197, 197, 197, 255, 1},
-        {110, 110, 110, 255, 1},
-        {94, 94, 94, 255, 1},
-        {95, 95, 95, 255, 1},
-        {182, 182, 182, 255, 1},
-        {193, 193, 193, 255, 1},
-        {169, 169, 169, 255, 1},
-        {110, 110, 110, 255, 1},
-        {136, 136, 136, 255, 1},
-        {180, 180, 180, 140, 1},
-        {168, 168, 168, 255, 1},
-        {125, 125, 125, 255, 1},
-        {181, 181, 181, 255, 1},
-        {150, 150, 150, 255, 1},
-        {100, 100, 100, 255, 1},
-        {98, 98, 98, 255, 1},
-        {138, 138, 138, 255, 1},
-        {190, 190, 190, 255, 1},
-        {188, 188, 188, 255, 1},
-        {193, 193, 193, 255, 1},
-        {145, 145, 145, 255, 1},
-        {169, 169, 169, 255, 1},
-        {168, 168, 168, 255, 1},
-        {80, 80, 80, 255, 1},
-        {112, 112, 112, 255, 1},
-        {90, 90, 90, 255, 1},
-        {172, 172, 172, 255, 1},
-        {185, 185, 185, 255, 1},
-        {184, 184, 184, 255, 1},
-        {124, 124, 124, 255, 1},
-        {138, 138, 138, 255, 1},
-        {191, 191, 191, 255, 1},
-        {99, 99, 99, 255, 1},
-        {96, 96, 96, 255, 1},
-        {89, 89, 89, 255, 1},
-        {172, 172, 172, 255, 1},
-        {182, 182, 182, 255, 1},
-        {188, 188, 188, 255, 1},
-        {180, 180, 180, 255, 1},
-        {140, 140, 140, 255, 1},
-        {189, 189, 189, 255, 1},
-        {144, 144, 144, 255, 1},
-        {93, 93, 93, 255, 1},
-        {95, 95, 95, 255, 1},
-        {123, 123, 123, 255, 1},
-        {180, 180, 180, 255, 1},
-        {186, 186, 186, 255, 2},
-        {146, 146, 146, 255, 1},
-        {174, 174, 174, 255, 1},
-        {175, 175, 175, 255, 1},
-        {92, 92, 92, 255, 1},
-        {104, 104, 104, 255, 1},
-        {103, 103, 103, 255, 1},
-        {183, 183, 183, 255, 1},
-        {179, 179, 179, 255, 1},
-        {191, 191, 191, 255, 1},
-        {138, 138, 138, 255, 1},
-        {128, 128, 128, 255, 1},
-        {184, 184, 184, 255, 1},
-        {98, 98, 98, 255, 1},
-        {108, 108, 108, 255, 1},
-        {85, 85, 85, 255, 1},
-        {152, 152, 152, 255, 1},
-        {182, 182, 182, 255, 1},
-        {185, 185, 185, 255, 1},
-        {173, 173, 173, 255, 1},
-        {139, 139, 139, 255, 1},
-        {190, 190, 190, 255, 1},
-        {124, 124, 124, 255, 1},
-        {95, 95, 95, 255, 2},
-        {150, 150, 150, 255, 1},
-        {158, 158, 158, 140, 1},
-        {178, 178, 178, 255, 1},
-        {196, 196, 196, 255, 1},
-        {136, 136, 136, 255, 1},
-        {103, 103, 103, 255, 1},
-        {162, 162, 162, 255, 1},
-        {95, 95, 95, 255, 1},
-        {187, 187, 187, 255, 1},
-        {177, 177, 177, 255, 1},
-        {176, 176, 176, 255, 1},
-        {174, 174, 174, 255, 1},
-        {196, 196, 196, 255, 1},
-        {171, 171, 171, 255, 1},
-        {80, 80, 80, 255, 1},
-        {169, 169, 169, 255, 1},
-        {99, 99, 99, 255, 1},
-        {136, 136, 136, 255, 1},
-        {182, 182, 182, 255, 1},
-        {173, 173, 173, 255, 1},
-        {175, 175, 175, 255, 1},
-        {165, 165, 165, 255, 1},
-        {190, 190, 190, 255, 1},
-        {90, 90, 90, 255, 1},
-        {126, 126, 126, 255, 1},
-        {129, 129, 129, 255, 1},
-        {114, 114, 114, 255, 1},
-        {188, 188, 188, 255, 1},
-        {175, 175, 175, 255, 1},
-        {170, 170, 170, 255, 1},
-        {176, 176, 176, 255, 1},
-        {210, 210, 210, 255, 1},
-        {131, 131, 131, 255, 1},
-        {96, 96, 96, 255, 1},
-        {156, 156, 156, 255, 1},
-        {92, 92, 92, 255, 1},
-        {175, 175, 175, 255, 1},
-        {171, 171, 171, 255, 1},
-        {172, 172, 172, 255, 1},
-        {171, 171, 171, 255, 1},
-        {196, 196, 196, 255, 1},
-        {180, 180, 180, 255, 1},
-        {87, 87, 87, 255, 1},
-        {167, 167, 167, 255, 1},
-        {101, 101, 101, 255, 1},
-        {155, 155, 155, 255, 1},
-        {183, 183, 183, 255, 1},
-        {170, 170, 170, 255, 1},
-        {165, 165, 165, 255, 1},
-        {161, 161, 161, 255, 1},
-        {189, 189, 189, 255, 1},
-        {94, 94, 94, 255, 1},
-        {138, 138, 138, 255, 1},
-        {129, 129, 129, 255, 1},
-        {88, 88, 88, 255, 1},
-        {181, 181, 181, 255, 1},
-        {167, 167, 167, 255, 1},
-        {169, 169, 169, 255, 1},
-        {179, 179, 179, 255, 1},
-        {205, 205, 205, 255, 1},
-        {126, 126, 126, 255, 1},
-        {97, 97, 97, 255, 1},
-        {155, 155, 155, 255, 1},
-        {97, 97, 97, 255, 1},
-        {201, 201, 201, 255, 1},
-        {169, 169, 169, 140, 1},
-        {197, 197, 197, 255, 1},
-        {158, 158, 158, 255, 1},
-        {93, 93, 93, 255, 1},
-        {182, 182, 182, 255, 1},
-        {91, 91, 91, 255, 1},
-        {171, 171, 171, 255, 1},
-        {191, 191, 191, 255, 1},
-        {172, 172, 172, 255, 1},
-        {176, 176, 176, 255, 2},
-        {183, 183, 183, 255, 1},
-        {85, 85, 85, 255, 1},
-        {168, 168, 168, 255, 1},
-        {123, 123, 123, 255, 1},
-        {102, 102, 102, 255, 1},
-        {186, 186, 186, 255, 1},
-        {169, 169, 169, 255, 1},
-        {177, 177, 177, 255, 1},
-        {179, 179, 179, 255, 1},
-        {175, 175, 175, 255, 1},
-        {94, 94, 94, 255, 1},
-        {123, 123, 123, 255, 1},
-        {145, 145, 145, 255, 1},
-        {92, 92, 92, 255, 1},
-        {190, 190, 190, 255, 1},
-        {172, 172, 172, 255, 1},
-        {170, 170, 170, 255, 1},
-        {176, 176, 176, 255, 1},
-        {186, 186, 186, 255, 1},
-        {157, 157, 157, 255, 1},
-        {91, 91, 91, 255, 1},
-        {171, 171, 171, 255, 1},
-        {83, 83, 83, 255, 1},
-        {162, 162, 162, 255, 1},
-        {183, 183, 183, 255, 1},
-        {165, 165, 165, 255, 1},
-        {173, 173, 173, 255, 1},
-        {177, 177, 177, 255, 1},
-        {186, 186, 186, 255, 1},
-        {90, 90, 90, 255, 1},
-        {170, 170, 170, 255, 1},
-        {117, 117, 117, 255, 1},
-        {128, 128, 128, 255, 1},
-        {195, 195, 195, 255, 1},
-        {163, 163, 163, 255, 1},
-        {158, 158, 158, 255, 1},
-        {160, 160, 160, 255, 1},
-        {167, 167, 167, 255, 1},
-        {109, 109, 109, 255, 1},
-        {130, 130, 130, 255, 1},
-        {159, 159, 159, 255, 1},
-        {77, 77, 77, 255, 1},
-        {168, 168, 168, 255, 3},
-        {172, 172, 172, 255, 1},
-        {181, 181, 181, 255, 1},
-        {152, 152, 152, 255, 1},
-        {89, 89, 89, 255, 1},
-        {173, 173, 173, 255, 1},
-        {86, 86, 86, 255, 1},
-        {170, 170, 170, 255, 1},
-        {201, 201, 201, 255, 1},
-        {174, 174, 174, 140, 1},
-        {189, 189, 189, 255, 1},
-        {104, 104, 104, 255, 1},
-        {123, 123, 123, 255, 1},
-        {87, 87, 87, 255, 1},
-        {155, 155, 155, 255, 1},
-        {169, 169, 169, 255, 1},
-        {168, 168, 168, 255, 1},
-        {196, 196, 196, 255, 1},
-        {176, 176, 176, 255, 1},
-        {192, 192, 192, 255, 1},
-        {135, 135, 135, 255, 1},
-        {114, 114, 114, 255, 1},
-        {98, 98, 98, 255, 1},
-        {112, 112, 112, 255, 1},
-        {173, 173, 173, 255, 1},
-        {151, 151, 151, 255, 1},
-        {181, 181, 181, 255, 1},
-        {187, 187, 187, 255, 1},
-        {177, 177, 177, 255, 1},
-        {148, 148, 148, 255, 1},
-        {85, 85, 85, 255, 1},
-        {123, 123, 123, 255, 1},
-        {92, 92, 92, 255, 1},
-        {192, 192, 192, 255, 1},
-        {169, 169, 169, 255, 1},
-        {176, 176, 176, 255, 1},
-        {190, 190, 190, 255, 1},
-        {176, 176, 176, 255, 1},
-        {189, 189, 189, 255, 1},
-        {100, 100, 100, 255, 1},
-        {117, 117, 117, 255, 1},
-        {81, 81, 81, 255, 1},
-        {147, 147, 147, 255, 1},
-        {168, 168, 168, 255, 1},
-        {164, 164, 164, 255, 1},
-        {188, 188, 188, 255, 1},
-        {176, 176, 176, 255, 1},
-        {174, 174, 174, 255, 1},
-        {118, 118, 118, 255, 1},
-        {112, 112, 112, 255, 1},
-        {103, 103, 103, 255, 1},
-        {129, 129, 129, 255, 1},
-        {196, 196, 196, 255, 1},
-        {157, 157, 157, 255, 1},
-        {173, 173, 173, 255, 1},
-        {175, 175, 175, 255, 1},
-        {182, 182, 182, 255, 1},
-        {137, 137, 137, 255, 1},
-        {91, 91, 91, 255, 1},
-        {119, 119, 119, 255, 1},
-        {95, 95, 95, 255, 1},
-        {177, 177, 177, 255, 1},
-        {151, 151, 151, 255, 1},
-        {165, 165, 165, 255, 1},
-        {183, 183, 183, 255, 1},
-        {180, 180, 180, 255, 1},
-        {190, 190, 190, 255, 1},
-        {99, 99, 99, 255, 1},
-        {126, 126, 126, 255, 1},
-        {86, 86, 86, 255, 1},
-        {164, 164, 164, 255, 1},
-        {179, 179, 179, 255, 1},
-        {176, 176, 176, 255, 1},
-        {194, 194, 194, 140, 1},
-        {165, 165, 165, 255, 1},
-        {84, 84, 84, 255, 1},
-        {112, 112, 112, 255, 1},
-        {187, 187, 187, 255, 1},
-        {207, 207, 207, 255, 1},
-        {123, 123, 123, 255, 1},
-        {85, 85, 85, 255, 1},
-        {123, 123, 123, 255, 1},
-        {191, 191, 191, 255, 1},
-        {194, 194, 194, 255, 1},
-        {100, 100, 100, 255, 1},
-        {104, 104, 104, 255, 1},
-        {134, 134, 134, 255, 1},
-        {197, 197, 197, 255, 1},
-        {151, 151, 151, 255, 1},
-        {84, 84, 84, 255, 1},
-        {108, 108, 108, 255, 1},
-        {176, 176, 176, 255, 1},
-        {213, 213, 213, 255, 1},
-        {129, 129, 129, 255, 1},
-        {93, 93, 93, 255, 1},
-        {123, 123, 123, 255, 1},
-        {195, 195, 195, 255, 1},
-        {196, 196, 196, 255, 1},
-        {98, 98, 98, 255, 1},
-        {94, 94, 94, 255, 1},
-        {141, 141, 141, 255, 1},
-        {207, 207, 207, 255, 1},
-        {165, 165, 165, 255, 1},
-        {86, 86, 86, 255, 1},
-        {111, 111, 111, 255, 1},
-        {171, 171, 171, 255, 1},
-        {195, 195, 195, 255, 1},
-        {109, 109, 109, 255, 1},
-        {87, 87, 87, 255, 1},
-        {123, 123, 123, 255, 1},
-        {194, 194, 194, 255, 1},
-        {191, 191, 191, 255, 1},
-        {95, 95, 95, 255, 1},
-        {106, 106, 106, 255, 1},
-        {159, 159, 159, 255, 1},
-        {208, 208, 208, 255, 1},
-        {160, 160, 160, 255, 1},
-        {84, 84, 84, 255, 1},
-        {103, 103, 103, 255, 1},
-        {156, 156, 156, 255, 1},
-        {203, 203, 203, 255, 1},
-        {115, 115, 115, 255, 1},
-        {90, 90, 90, 255, 1},
-        {135, 135, 135, 255, 1},
-        {200, 200, 200, 255, 1},
-        {193, 193, 193, 255, 1},
-        {97, 97, 97, 255, 1},
-        {99, 99, 99, 255, 1},
-        {135, 135, 135, 255, 1},
-        {207, 207, 207, 255, 1},
-        {161, 161, 161, 255, 1},
-        {81, 81, 81, 255, 1},
-        {113, 113, 113, 255, 1},
-        {179, 179, 179, 255, 1},
-        {209, 209, 209, 255, 1},
-        {131, 131, 131, 255, 1},
-        {100, 100, 100, 255, 1},
-        {130, 130, 130, 151, 1},
-        {188, 188, 188, 255, 1},
-        {181, 181, 181, 255, 1},
-        {205, 205, 205, 255, 1},
-        {198, 198, 198, 255, 1},
-        {186, 186, 186, 255, 1},
-        {180, 180, 180, 255, 1},
-        {125, 125, 125, 255, 1},
-        {139, 139, 139, 255, 1},
-        {100, 100, 100, 255, 1},
-        {182, 182, 182, 255, 1},
-        {187, 187, 187, 255, 1},
-        {198, 198, 198, 255, 1},
-        {199, 199, 199, 255, 1},
-        {187, 187, 187, 255, 1},
-        {197, 197, 197, 255, 1},
-        {131, 131, 131, 255, 1},
-        {144, 144, 144, 255, 1},
-        {102, 102, 102, 255, 1},
-        {163, 163, 163, 255, 1},
-        {194, 194, 194, 255, 1},
-        {184, 184, 184, 255, 1},
-        {201, 201, 201, 255, 1},
-        {190, 190, 190, 255, 1},
-        {195, 195, 195, 255, 1},
-        {139, 139, 139, 255, 1},
-        {136, 136, 136, 255, 1},
-        {118, 118, 118, 255, 1},
-        {122, 122, 122, 255, 1},
-        {198, 198, 198, 255, 1},
-        {186, 186, 186, 255, 1},
-        {201, 201, 201, 255, 1},
-        {181, 181, 181, 255, 1},
-        {179, 179, 179, 255, 1},
-        {167, 167, 167, 255, 1},
-        {119, 119, 119, 255, 1},
-        {135, 135, 135, 255, 1},
-        {95, 95, 95, 255, 1},
-        {180, 180, 180, 255, 1},
-        {186, 186, 186, 255, 1},
-        {203, 203, 203, 255, 1},
-        {200, 200, 200, 255, 1},
-        {183, 183, 183, 255, 1},
-        {198, 198, 198, 255, 1},
-        {129, 129, 129, 255, 1},
-        {150, 150, 150, 255, 1},
-        {97, 97, 97, 255, 1},
-        {152, 152, 152, 255, 1},
-        {193, 193, 193, 255, 1},
-        {188, 188, 188, 255, 1},
-        {205, 205, 205, 255, 1},
-        {182, 182, 182, 255, 1},
-        {197, 197, 197, 255, 1},
-        {149, 149, 149, 255, 1},
-        {136, 136, 136, 255, 1},
-        {115, 115, 115, 255, 1},
-        {116, 116, 116, 255, 1},
-        {185, 185, 185, 255, 1},
-        {173, 173, 173, 255, 1},
-        {194, 194, 194, 255, 1},
-        {196, 196, 196, 255, 1},
-        {192, 192, 192, 255, 1},
-        {184, 184, 184, 255, 1},
-        {126, 126, 126, 255, 1},
-    };
-
-    static BYTE textureData[64 * 64 * 4];
-
-    BYTE* ptr = textureData;
-    for (const auto& seg : segments) {
-        for (int i = 0; i < seg.count; ++i) {
-            *ptr++ = seg.r;
-            *ptr++ = seg.g;
-            *ptr++ = seg.b;
-            *ptr++ = seg.a;
-        }
-    }
-
-    bool result = CreateTextureFromData(textureData, size, size, &cachedSRV);
-    *outSRV = cachedSRV;
-    return result;
-}
\ No newline at end of file
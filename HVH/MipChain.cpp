@@ -0,0 +1,114 @@
+#include "MipChain.h"
+#include <algorithm>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define MIPCHAIN_SSE2 1
+#endif
+
+namespace {
+
+    // output texels [begin, end) of one row, from the two source rows above it
+    void DownsampleSpan(const uint8_t* row0, const uint8_t* row1, uint32_t width,
+        uint32_t begin, uint32_t end, uint8_t* out)
+    {
+        for (uint32_t x = begin; x < end; ++x) {
+            uint32_t x0 = (std::min)(x * 2, width - 1), x1 = (std::min)(x * 2 + 1, width - 1);
+            for (int c = 0; c < 4; ++c) {
+                unsigned sum = row0[x0 * 4 + c] + row0[x1 * 4 + c] + row1[x0 * 4 + c] + row1[x1 * 4 + c];
+                out[x * 4 + c] = (uint8_t)((sum + 2) / 4);
+            }
+        }
+    }
+
+#ifdef MIPCHAIN_SSE2
+    // four output texels per iteration: 8 source texels from each row split
+    // into even and odd columns, widened to 16 bits and summed, so the
+    // rounding is exactly the reference's
+    uint32_t DownsampleSpanSSE2(const uint8_t* row0, const uint8_t* row1, uint32_t outWidth, uint8_t* out)
+    {
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i two = _mm_set1_epi16(2);
+        uint32_t x = 0;
+        for (; x + 4 <= outWidth; x += 4) {
+            __m128 a0 = _mm_castsi128_ps(_mm_loadu_si128((const __m128i*)(row0 + x * 8)));
+            __m128 b0 = _mm_castsi128_ps(_mm_loadu_si128((const __m128i*)(row0 + x * 8 + 16)));
+            __m128 a1 = _mm_castsi128_ps(_mm_loadu_si128((const __m128i*)(row1 + x * 8)));
+            __m128 b1 = _mm_castsi128_ps(_mm_loadu_si128((const __m128i*)(row1 + x * 8 + 16)));
+
+            __m128i even0 = _mm_castps_si128(_mm_shuffle_ps(a0, b0, _MM_SHUFFLE(2, 0, 2, 0)));
+            __m128i odd0 = _mm_castps_si128(_mm_shuffle_ps(a0, b0, _MM_SHUFFLE(3, 1, 3, 1)));
+            __m128i even1 = _mm_castps_si128(_mm_shuffle_ps(a1, b1, _MM_SHUFFLE(2, 0, 2, 0)));
+            __m128i odd1 = _mm_castps_si128(_mm_shuffle_ps(a1, b1, _MM_SHUFFLE(3, 1, 3, 1)));
+
+            __m128i lo = _mm_add_epi16(
+                _mm_add_epi16(_mm_unpacklo_epi8(even0, zero), _mm_unpacklo_epi8(odd0, zero)),
+                _mm_add_epi16(_mm_unpacklo_epi8(even1, zero), _mm_unpacklo_epi8(odd1, zero)));
+            __m128i hi = _mm_add_epi16(
+                _mm_add_epi16(_mm_unpackhi_epi8(even0, zero), _mm_unpackhi_epi8(odd0, zero)),
+                _mm_add_epi16(_mm_unpackhi_epi8(even1, zero), _mm_unpackhi_epi8(odd1, zero)));
+            lo = _mm_srli_epi16(_mm_add_epi16(lo, two), 2);
+            hi = _mm_srli_epi16(_mm_add_epi16(hi, two), 2);
+            _mm_storeu_si128((__m128i*)(out + x * 4), _mm_packus_epi16(lo, hi));
+        }
+        return x;
+    }
+#endif
+}
+
+uint32_t MipDimension(uint32_t size, int level)
+{
+    return (std::max)(1u, size >> level);
+}
+
+int MipCount(uint32_t width, uint32_t height)
+{
+    int count = 1;
+    while (MipDimension(width, count - 1) > 1 || MipDimension(height, count - 1) > 1) ++count;
+    return count;
+}
+
+void DownsampleRGBA8Reference(const uint8_t* src, uint32_t width, uint32_t height, uint8_t* dst)
+{
+    uint32_t w = MipDimension(width, 1), h = MipDimension(height, 1);
+    for (uint32_t y = 0; y < h; ++y) {
+        const uint8_t* row0 = src + (size_t)(std::min)(y * 2, height - 1) * width * 4;
+        const uint8_t* row1 = src + (size_t)(std::min)(y * 2 + 1, height - 1) * width * 4;
+        DownsampleSpan(row0, row1, width, 0, w, dst + (size_t)y * w * 4);
+    }
+}
+
+void DownsampleRGBA8(const uint8_t* src, uint32_t width, uint32_t height, uint8_t* dst)
+{
+#ifdef MIPCHAIN_SSE2
+    // a 1 texel wide image repeats its column, which the pairing above doesn't do
+    if (width < 2) {
+        DownsampleRGBA8Reference(src, width, height, dst);
+        return;
+    }
+    uint32_t w = MipDimension(width, 1), h = MipDimension(height, 1);
+    for (uint32_t y = 0; y < h; ++y) {
+        const uint8_t* row0 = src + (size_t)(std::min)(y * 2, height - 1) * width * 4;
+        const uint8_t* row1 = src + (size_t)(std::min)(y * 2 + 1, height - 1) * width * 4;
+        uint8_t* out = dst + (size_t)y * w * 4;
+        uint32_t done = DownsampleSpanSSE2(row0, row1, w, out);
+        DownsampleSpan(row0, row1, width, done, w, out);
+    }
+#else
+    DownsampleRGBA8Reference(src, width, height, dst);
+#endif
+}
+
+void BuildMipChain(uint32_t width, uint32_t height, std::vector<uint8_t> pixels,
+    std::vector<std::vector<uint8_t>>& mips)
+{
+    int mipCount = MipCount(width, height);
+    mips.clear();
+    mips.reserve(mipCount);
+    mips.push_back(std::move(pixels));
+    for (int level = 1; level < mipCount; ++level) {
+        std::vector<uint8_t> mip((size_t)MipDimension(width, level) * MipDimension(height, level) * 4);
+        DownsampleRGBA8(mips.back().data(), MipDimension(width, level - 1), MipDimension(height, level - 1), mip.data());
+        mips.push_back(std::move(mip));
+    }
+}
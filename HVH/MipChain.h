@@ -0,0 +1,26 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+
+// CPU mip generation for RGBA8 images, free of Windows and DirectX so the
+// texture packer builds it too. Textures get every mip up front and are
+// created immutable; nothing runs GenerateMips on the device at startup.
+
+// Size of a side at a mip level, never below 1.
+uint32_t MipDimension(uint32_t size, int level);
+// Levels down to 1x1, mip 0 included.
+int MipCount(uint32_t width, uint32_t height);
+
+// Halves a width x height RGBA8 image into dst (MipDimension(width, 1) x
+// MipDimension(height, 1)). Each texel is the rounded average of the 2x2
+// above it, (a + b + c + d + 2) / 4 per channel; a side that is already 1
+// texel just repeats it. Uses SSE2 where the compiler has it.
+void DownsampleRGBA8(const uint8_t* src, uint32_t width, uint32_t height, uint8_t* dst);
+// The same filter one channel at a time, what DownsampleRGBA8 must match bit
+// for bit. HVHTests checks that over odd and 1 x N sizes, hvh-bench
+// mip_chain times both.
+void DownsampleRGBA8Reference(const uint8_t* src, uint32_t width, uint32_t height, uint8_t* dst);
+
+// mips[0] is pixels, then every level down to 1x1.
+void BuildMipChain(uint32_t width, uint32_t height, std::vector<uint8_t> pixels,
+    std::vector<std::vector<uint8_t>>& mips);
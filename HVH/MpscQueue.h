@@ -0,0 +1,64 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <utility>
+
+// Unbounded lock-free queue for many producers and a single consumer
+// (Vyukov's intrusive MPSC list). Push never blocks; Pop must only be
+// called from one thread at a time.
+template <typename T>
+class MpscQueue
+{
+public:
+    MpscQueue()
+    {
+        Node* stub = new Node();
+        head.store(stub, std::memory_order_relaxed);
+        tail = stub;
+    }
+
+    ~MpscQueue()
+    {
+        T discard;
+        while (Pop(discard)) {}
+        delete tail;
+    }
+
+    MpscQueue(const MpscQueue&) = delete;
+    MpscQueue& operator=(const MpscQueue&) = delete;
+
+    void Push(T value)
+    {
+        Node* node = new Node();
+        node->value = std::move(value);
+        count.fetch_add(1, std::memory_order_relaxed);
+        Node* prev = head.exchange(node, std::memory_order_acq_rel);
+        // until this store lands the consumer sees the queue as ending at prev
+        prev->next.store(node, std::memory_order_release);
+    }
+
+    bool Pop(T& out)
+    {
+        Node* next = tail->next.load(std::memory_order_acquire);
+        if (!next) return false;
+
+        out = std::move(next->value);
+        delete tail;
+        tail = next; // next becomes the new stub
+        count.fetch_sub(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    // may be momentarily off while producers are mid-push
+    size_t ApproxSize() const { return count.load(std::memory_order_relaxed); }
+
+private:
+    struct Node {
+        std::atomic<Node*> next{ nullptr };
+        T value{};
+    };
+
+    std::atomic<Node*> head;  // producers push here
+    Node* tail;               // consumer only
+    std::atomic<size_t> count{ 0 };
+};
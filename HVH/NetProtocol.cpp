@@ -0,0 +1,423 @@
+#include "NetProtocol.h"
+#include <cstring>
+#include <cmath>
+
+namespace {
+
+    void PutU32(std::vector<char>& out, uint32_t v)
+    {
+        out.push_back((char)(v & 0xFF));
+        out.push_back((char)((v >> 8) & 0xFF));
+        out.push_back((char)((v >> 16) & 0xFF));
+        out.push_back((char)((v >> 24) & 0xFF));
+    }
+
+    void PutF32(std::vector<char>& out, float f)
+    {
+        uint32_t v;
+        memcpy(&v, &f, sizeof(v));
+        PutU32(out, v);
+    }
+
+    uint32_t GetU32(const char* p)
+    {
+        const unsigned char* b = (const unsigned char*)p;
+        return (uint32_t)b[0] | ((uint32_t)b[1] << 8) | ((uint32_t)b[2] << 16) | ((uint32_t)b[3] << 24);
+    }
+
+    void PutU16(std::vector<char>& out, uint16_t v)
+    {
+        out.push_back((char)(v & 0xFF));
+        out.push_back((char)((v >> 8) & 0xFF));
+    }
+
+    void PutI24(std::vector<char>& out, int32_t v)
+    {
+        uint32_t u = (uint32_t)v;
+        out.push_back((char)(u & 0xFF));
+        out.push_back((char)((u >> 8) & 0xFF));
+        out.push_back((char)((u >> 16) & 0xFF));
+    }
+
+    uint16_t GetU16(const char* p)
+    {
+        const unsigned char* b = (const unsigned char*)p;
+        return (uint16_t)(b[0] | (b[1] << 8));
+    }
+
+    int32_t GetI24(const char* p)
+    {
+        const unsigned char* b = (const unsigned char*)p;
+        uint32_t u = (uint32_t)b[0] | ((uint32_t)b[1] << 8) | ((uint32_t)b[2] << 16);
+        if (u & 0x800000) u |= 0xFF000000; // sign extend
+        return (int32_t)u;
+    }
+
+    float GetF32(const char* p)
+    {
+        uint32_t v = GetU32(p);
+        float f;
+        memcpy(&f, &v, sizeof(f));
+        return f;
+    }
+
+    const int VARIABLE_SIZE = -2;
+
+    // fixed payload size per type, -1 for types that are never on the wire
+    int PayloadSize(NetMessageType type)
+    {
+        switch (type) {
+        case NetMessageType::Join:
+        case NetMessageType::Leave:
+        case NetMessageType::Ping:
+        case NetMessageType::MapClear:
+            return 0;
+        case NetMessageType::AssignId:
+        case NetMessageType::NewPlayer:
+        case NetMessageType::PlayerLeft:
+        case NetMessageType::Hit:
+        case NetMessageType::SnapshotAck:
+        case NetMessageType::WorldBegin:
+        case NetMessageType::WorldAck:
+            return 4;
+        case NetMessageType::Position:
+            return 32;
+        case NetMessageType::Snapshot:
+        case NetMessageType::WorldBatch:
+            return VARIABLE_SIZE;
+        case NetMessageType::BlockAdd:
+            return 12 + (int)NET_BLOCK_NAME_SIZE;
+        case NetMessageType::BlockRemove:
+            return 12;
+        default:
+            return -1;
+        }
+    }
+}
+
+NetMessage NetMessage::Simple(NetMessageType type)
+{
+    NetMessage msg;
+    msg.type = type;
+    return msg;
+}
+
+NetMessage NetMessage::Player(NetMessageType type, int32_t playerId)
+{
+    NetMessage msg;
+    msg.type = type;
+    msg.playerId = playerId;
+    return msg;
+}
+
+NetMessage NetMessage::Position(int32_t playerId, float x, float y, float z, float yaw, float pitch)
+{
+    NetMessage msg;
+    msg.type = NetMessageType::Position;
+    msg.playerId = playerId;
+    msg.x = x; msg.y = y; msg.z = z;
+    msg.yaw = yaw; msg.pitch = pitch;
+    return msg;
+}
+
+NetMessage NetMessage::BlockAdd(float x, float y, float z, const std::string& blockName)
+{
+    NetMessage msg;
+    msg.type = NetMessageType::BlockAdd;
+    msg.x = x; msg.y = y; msg.z = z;
+    msg.blockName = blockName.substr(0, NET_BLOCK_NAME_SIZE);
+    return msg;
+}
+
+NetMessage NetMessage::BlockRemove(float x, float y, float z)
+{
+    NetMessage msg;
+    msg.type = NetMessageType::BlockRemove;
+    msg.x = x; msg.y = y; msg.z = z;
+    return msg;
+}
+
+NetMessage NetMessage::SnapshotAck(uint32_t sequence)
+{
+    NetMessage msg;
+    msg.type = NetMessageType::SnapshotAck;
+    msg.sequence = sequence;
+    return msg;
+}
+
+NetMessage NetMessage::WorldBegin(uint32_t chunkCount)
+{
+    NetMessage msg;
+    msg.type = NetMessageType::WorldBegin;
+    msg.count = chunkCount;
+    return msg;
+}
+
+NetMessage NetMessage::WorldAck(uint32_t sequence)
+{
+    NetMessage msg;
+    msg.type = NetMessageType::WorldAck;
+    msg.sequence = sequence;
+    return msg;
+}
+
+int32_t NetQuantizePosition(float v)
+{
+    const float limit = 8388607.0f / NET_POSITION_SCALE;
+    if (v > limit) v = limit;
+    if (v < -limit) v = -limit;
+    return (int32_t)lroundf(v * NET_POSITION_SCALE);
+}
+
+float NetDequantizePosition(int32_t q)
+{
+    return q / NET_POSITION_SCALE;
+}
+
+uint16_t NetQuantizeAngle(float radians)
+{
+    const float twoPi = 6.28318531f;
+    float turns = radians / twoPi;
+    turns -= floorf(turns);
+    return (uint16_t)((uint32_t)lroundf(turns * 65536.0f) & 0xFFFF);
+}
+
+float NetDequantizeAngle(uint16_t q)
+{
+    const float twoPi = 6.28318531f;
+    float radians = q * (twoPi / 65536.0f);
+    return radians > twoPi * 0.5f ? radians - twoPi : radians;
+}
+
+size_t NetMessageSize(const NetMessage& msg)
+{
+    int size = PayloadSize(msg.type);
+    if (msg.type == NetMessageType::WorldBatch) {
+        size_t data = msg.data.size() < NET_MAX_WORLD_BATCH ? msg.data.size() : NET_MAX_WORLD_BATCH;
+        return NET_HEADER_SIZE + 4 + data;
+    }
+    if (size == VARIABLE_SIZE) {
+        size_t payload = NET_SNAPSHOT_HEADER_SIZE;
+        size_t count = msg.entities.size() < NET_MAX_SNAPSHOT_ENTITIES ? msg.entities.size() : NET_MAX_SNAPSHOT_ENTITIES;
+        for (size_t i = 0; i < count; i++) {
+            uint8_t flags = msg.entities[i].flags;
+            payload += 3;
+            if (flags & NET_ENTITY_POSITION) payload += 9;
+            if (flags & NET_ENTITY_ROTATION) payload += 4;
+        }
+        return NET_HEADER_SIZE + payload;
+    }
+    return size < 0 ? 0 : NET_HEADER_SIZE + size;
+}
+
+void EncodeNetMessage(const NetMessage& msg, std::vector<char>& out)
+{
+    int size = PayloadSize(msg.type);
+    if (size == VARIABLE_SIZE) {
+        size = (int)(NetMessageSize(msg) - NET_HEADER_SIZE);
+    }
+    if (size < 0) return;
+
+    out.push_back((char)(size & 0xFF));
+    out.push_back((char)((size >> 8) & 0xFF));
+    out.push_back((char)msg.type);
+    out.push_back(0);
+
+    switch (msg.type) {
+    case NetMessageType::AssignId:
+    case NetMessageType::NewPlayer:
+    case NetMessageType::PlayerLeft:
+    case NetMessageType::Hit:
+        PutU32(out, (uint32_t)msg.playerId);
+        break;
+    case NetMessageType::SnapshotAck:
+    case NetMessageType::WorldAck:
+        PutU32(out, msg.sequence);
+        break;
+    case NetMessageType::WorldBegin:
+        PutU32(out, msg.count);
+        break;
+    case NetMessageType::WorldBatch:
+        PutU32(out, msg.sequence);
+        out.insert(out.end(), msg.data.begin(), msg.data.begin() + (size - 4));
+        break;
+    case NetMessageType::Position:
+        PutU32(out, (uint32_t)msg.playerId);
+        PutU32(out, msg.sequence);
+        PutF32(out, msg.x); PutF32(out, msg.y); PutF32(out, msg.z);
+        PutF32(out, msg.yaw); PutF32(out, msg.pitch);
+        PutU32(out, msg.teleport ? 1u : 0u);
+        break;
+    case NetMessageType::Snapshot: {
+        size_t count = msg.entities.size() < NET_MAX_SNAPSHOT_ENTITIES ? msg.entities.size() : NET_MAX_SNAPSHOT_ENTITIES;
+        PutU32(out, msg.sequence);
+        PutU32(out, msg.baseline);
+        PutU32(out, msg.inputAck);
+        out.push_back((char)count);
+        for (size_t i = 0; i < count; i++) {
+            const NetEntityState& e = msg.entities[i];
+            PutU16(out, (uint16_t)(int16_t)e.id);
+            out.push_back((char)e.flags);
+            if (e.flags & NET_ENTITY_POSITION) {
+                PutI24(out, e.state.x); PutI24(out, e.state.y); PutI24(out, e.state.z);
+            }
+            if (e.flags & NET_ENTITY_ROTATION) {
+                PutU16(out, e.state.yaw); PutU16(out, e.state.pitch);
+            }
+        }
+        break;
+    }
+    case NetMessageType::BlockAdd: {
+        PutF32(out, msg.x); PutF32(out, msg.y); PutF32(out, msg.z);
+        // zero padded, not necessarily terminated
+        size_t len = msg.blockName.size() < NET_BLOCK_NAME_SIZE ? msg.blockName.size() : NET_BLOCK_NAME_SIZE;
+        out.insert(out.end(), msg.blockName.begin(), msg.blockName.begin() + len);
+        out.insert(out.end(), NET_BLOCK_NAME_SIZE - len, '\0');
+        break;
+    }
+    case NetMessageType::BlockRemove:
+        PutF32(out, msg.x); PutF32(out, msg.y); PutF32(out, msg.z);
+        break;
+    default:
+        break;
+    }
+}
+
+bool DecodeNetMessage(NetMessageType type, const char* payload, size_t size, NetMessage& out)
+{
+    int expected = PayloadSize(type);
+    if (expected == VARIABLE_SIZE) {
+        size_t minimum = type == NetMessageType::WorldBatch ? 4 : NET_SNAPSHOT_HEADER_SIZE;
+        if (size < minimum) return false;
+    }
+    else if (expected < 0 || (size_t)expected != size) {
+        return false;
+    }
+
+    out = NetMessage();
+    out.type = type;
+
+    switch (type) {
+    case NetMessageType::AssignId:
+    case NetMessageType::NewPlayer:
+    case NetMessageType::PlayerLeft:
+    case NetMessageType::Hit:
+        out.playerId = (int32_t)GetU32(payload);
+        break;
+    case NetMessageType::SnapshotAck:
+    case NetMessageType::WorldAck:
+        out.sequence = GetU32(payload);
+        break;
+    case NetMessageType::WorldBegin:
+        out.count = GetU32(payload);
+        break;
+    case NetMessageType::WorldBatch:
+        out.sequence = GetU32(payload);
+        out.data.assign(payload + 4, payload + size);
+        break;
+    case NetMessageType::Position:
+        out.playerId = (int32_t)GetU32(payload);
+        out.sequence = GetU32(payload + 4);
+        out.x = GetF32(payload + 8); out.y = GetF32(payload + 12); out.z = GetF32(payload + 16);
+        out.yaw = GetF32(payload + 20); out.pitch = GetF32(payload + 24);
+        out.teleport = (GetU32(payload + 28) & 1) != 0;
+        break;
+    case NetMessageType::Snapshot: {
+        out.sequence = GetU32(payload);
+        out.baseline = GetU32(payload + 4);
+        out.inputAck = GetU32(payload + 8);
+        size_t count = (unsigned char)payload[12];
+        size_t pos = NET_SNAPSHOT_HEADER_SIZE;
+        out.entities.resize(count);
+        for (size_t i = 0; i < count; i++) {
+            NetEntityState& e = out.entities[i];
+            if (pos + 3 > size) return false;
+            e.id = (int16_t)GetU16(payload + pos);
+            e.flags = (uint8_t)payload[pos + 2];
+            pos += 3;
+            if (e.flags & NET_ENTITY_POSITION) {
+                if (pos + 9 > size) return false;
+                e.state.x = GetI24(payload + pos);
+                e.state.y = GetI24(payload + pos + 3);
+                e.state.z = GetI24(payload + pos + 6);
+                pos += 9;
+            }
+            if (e.flags & NET_ENTITY_ROTATION) {
+                if (pos + 4 > size) return false;
+                e.state.yaw = GetU16(payload + pos);
+                e.state.pitch = GetU16(payload + pos + 2);
+                pos += 4;
+            }
+        }
+        return pos == size;
+    }
+    case NetMessageType::BlockAdd: {
+        out.x = GetF32(payload); out.y = GetF32(payload + 4); out.z = GetF32(payload + 8);
+        const char* name = payload + 12;
+        size_t len = 0;
+        while (len < NET_BLOCK_NAME_SIZE && name[len] != '\0') ++len;
+        out.blockName.assign(name, len);
+        break;
+    }
+    case NetMessageType::BlockRemove:
+        out.x = GetF32(payload); out.y = GetF32(payload + 4); out.z = GetF32(payload + 8);
+        break;
+    default:
+        break;
+    }
+    return true;
+}
+
+void NetFrameReader::Append(const char* data, size_t size)
+{
+    if (error) return;
+
+    // drop consumed bytes before growing so the buffer stays small
+    if (readPos > 0 && readPos >= buffer.size() / 2) {
+        buffer.erase(buffer.begin(), buffer.begin() + readPos);
+        readPos = 0;
+    }
+    buffer.insert(buffer.end(), data, data + size);
+}
+
+bool NetFrameReader::Next(NetMessage& msg, const char** frame, size_t* frameSize)
+{
+    while (!error) {
+        size_t available = buffer.size() - readPos;
+        if (available < NET_HEADER_SIZE) return false;
+
+        const unsigned char* header = (const unsigned char*)&buffer[readPos];
+        size_t length = (size_t)header[0] | ((size_t)header[1] << 8);
+        NetMessageType type = (NetMessageType)header[2];
+
+        if (length > NET_MAX_PAYLOAD) {
+            error = true;
+            return false;
+        }
+        if (available < NET_HEADER_SIZE + length) return false;
+
+        const char* start = &buffer[readPos];
+        readPos += NET_HEADER_SIZE + length;
+
+        if (!DecodeNetMessage(type, start + NET_HEADER_SIZE, length, msg)) {
+            // a known type with the wrong size means we've lost sync
+            if (PayloadSize(type) != -1) {
+                error = true;
+                return false;
+            }
+            continue; // unknown type from a newer peer, skip it
+        }
+
+        if (frame) *frame = start;
+        if (frameSize) *frameSize = NET_HEADER_SIZE + length;
+        return true;
+    }
+    return false;
+}
+
+void NetFrameReader::Reset()
+{
+    buffer.clear();
+    readPos = 0;
+    error = false;
+}
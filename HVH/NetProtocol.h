@@ -0,0 +1,125 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+// Wire format: every message is a 4 byte header (u16 payload length, u8 type,
+// u8 reserved, little endian) followed by a fixed-size packed payload.
+enum class NetMessageType : uint8_t {
+    None = 0,
+    Join,
+    Leave,
+    Ping,
+    AssignId,
+    NewPlayer,
+    PlayerLeft,
+    Position,
+    BlockAdd,
+    BlockRemove,
+    MapClear,
+    Hit,
+    Snapshot,
+    SnapshotAck,
+    WorldBegin,
+    WorldBatch,
+    WorldAck,
+    Disconnected  // raised locally when a connection drops, never sent
+};
+
+const size_t NET_HEADER_SIZE = 4;
+const size_t NET_MAX_PAYLOAD = 4096;
+const size_t NET_BLOCK_NAME_SIZE = 32;
+// client ids go out as i16 in snapshots, so the host never hands out more
+const int NET_MAX_CLIENT_ID = 32767;
+
+// Snapshot payload: u32 sequence, u32 baseline, u32 input ack, u8 count, then
+// per entity i16 id, u8 flags, [3 x i24 position], [2 x u16 angle]
+const size_t NET_SNAPSHOT_HEADER_SIZE = 13;
+const size_t NET_SNAPSHOT_ENTITY_SIZE = 3 + 9 + 4;
+const size_t NET_MAX_SNAPSHOT_ENTITIES = 255;
+// WorldBatch payload: u32 sequence, then the data described in WorldTransfer.h
+const size_t NET_MAX_WORLD_BATCH = NET_MAX_PAYLOAD - 4;
+
+const float NET_POSITION_SCALE = 256.0f; // position steps of 1/256 unit
+
+enum NetEntityFlags : uint8_t {
+    NET_ENTITY_POSITION = 1,
+    NET_ENTITY_ROTATION = 2,
+    NET_ENTITY_REMOVED = 4
+};
+
+// Entity state on the wire quantized the same way on both ends, so the
+// server can tell what actually changed from the client's point of view.
+struct NetQuantizedState {
+    int32_t x = 0, y = 0, z = 0;
+    uint16_t yaw = 0, pitch = 0;
+
+    bool SamePosition(const NetQuantizedState& o) const { return x == o.x && y == o.y && z == o.z; }
+    bool SameRotation(const NetQuantizedState& o) const { return yaw == o.yaw && pitch == o.pitch; }
+};
+
+struct NetEntityState {
+    int32_t id = 0;
+    uint8_t flags = 0;      // NetEntityFlags, which fields below are present
+    NetQuantizedState state;
+};
+
+int32_t NetQuantizePosition(float v);
+float NetDequantizePosition(int32_t q);
+uint16_t NetQuantizeAngle(float radians);
+float NetDequantizeAngle(uint16_t q);       // (-pi, pi]
+
+struct NetMessage {
+    NetMessageType type = NetMessageType::None;
+    int32_t playerId = 0;   // Position, AssignId, NewPlayer, PlayerLeft, Hit, Disconnected
+    float x = 0.0f, y = 0.0f, z = 0.0f; // Position, BlockAdd, BlockRemove
+    float yaw = 0.0f, pitch = 0.0f;     // Position
+    bool teleport = false;  // Position, skip the host's movement check once
+    std::string blockName;  // BlockAdd, at most NET_BLOCK_NAME_SIZE bytes
+    uint32_t sequence = 0;  // Snapshot, SnapshotAck, WorldBatch, WorldAck, Position (input sequence)
+    uint32_t baseline = 0;  // Snapshot, sequence the delta is against, 0 = none
+    uint32_t inputAck = 0;  // Snapshot, last Position input the host applied for the receiver
+    std::vector<NetEntityState> entities; // Snapshot
+    uint32_t count = 0;     // WorldBegin, chunks the transfer will send
+    std::vector<char> data; // WorldBatch, at most NET_MAX_WORLD_BATCH bytes
+
+    static NetMessage Simple(NetMessageType type);
+    static NetMessage Player(NetMessageType type, int32_t playerId);
+    static NetMessage Position(int32_t playerId, float x, float y, float z, float yaw = 0.0f, float pitch = 0.0f);
+    static NetMessage BlockAdd(float x, float y, float z, const std::string& blockName);
+    static NetMessage BlockRemove(float x, float y, float z);
+    static NetMessage SnapshotAck(uint32_t sequence);
+    static NetMessage WorldBegin(uint32_t chunkCount);
+    static NetMessage WorldAck(uint32_t sequence);
+};
+
+// Appends one framed message to out.
+void EncodeNetMessage(const NetMessage& msg, std::vector<char>& out);
+
+// Bytes EncodeNetMessage would append, header included.
+size_t NetMessageSize(const NetMessage& msg);
+
+// Parses a payload; false if its size doesn't match the type.
+bool DecodeNetMessage(NetMessageType type, const char* payload, size_t size, NetMessage& out);
+
+// Per-socket reassembly: feed it whatever recv returned and pull whole
+// messages out, however TCP split or coalesced them.
+class NetFrameReader
+{
+public:
+    void Append(const char* data, size_t size);
+
+    // Returns the next complete message, false when more bytes are needed or
+    // the stream is corrupt (see HasError). frame/frameSize, if given, point
+    // at the raw frame so it can be relayed without re-encoding.
+    bool Next(NetMessage& msg, const char** frame = nullptr, size_t* frameSize = nullptr);
+
+    bool HasError() const { return error; }
+    void Reset();
+
+private:
+    std::vector<char> buffer;
+    size_t readPos = 0;
+    bool error = false;
+};
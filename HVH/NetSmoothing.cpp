@@ -0,0 +1,143 @@
+#include "NetSmoothing.h"
+#include <cmath>
+
+namespace {
+
+    const size_t MAX_PREDICTIONS = 128;
+
+    float LerpAngle(float a, float b, float t)
+    {
+        const float pi = 3.14159265f;
+        float d = b - a;
+        while (d > pi) d -= 2.0f * pi;
+        while (d < -pi) d += 2.0f * pi;
+        return a + d * t;
+    }
+}
+
+void EntityHistory::Push(const EntitySample& sample)
+{
+    if (count > 0 && sample.time <= At(count - 1).time) return;
+
+    if (count == CAPACITY) {
+        samples[head] = sample;
+        head = (head + 1) % CAPACITY;
+    }
+    else {
+        samples[(head + count) % CAPACITY] = sample;
+        count++;
+    }
+}
+
+bool EntityHistory::Latest(EntitySample& out) const
+{
+    if (count == 0) return false;
+    out = At(count - 1);
+    return true;
+}
+
+bool EntityHistory::Sample(double time, EntitySample& out) const
+{
+    if (count == 0) return false;
+
+    if (time <= At(0).time) {
+        out = At(0);
+        return true;
+    }
+    if (time >= At(count - 1).time) {
+        out = At(count - 1);
+        return true;
+    }
+
+    // newest first, playback time is almost always near the end
+    size_t i = count - 1;
+    while (i > 0 && At(i - 1).time > time) i--;
+
+    const EntitySample& a = At(i - 1);
+    const EntitySample& b = At(i);
+    float t = (float)((time - a.time) / (b.time - a.time));
+
+    out.time = time;
+    for (int k = 0; k < 3; ++k) {
+        out.position[k] = a.position[k] + (b.position[k] - a.position[k]) * t;
+    }
+    out.yaw = LerpAngle(a.yaw, b.yaw, t);
+    out.pitch = LerpAngle(a.pitch, b.pitch, t);
+    return true;
+}
+
+void InterpolationClock::OnSample(double sampleTime)
+{
+    if (!running) {
+        running = true;
+        latest = sampleTime;
+        time = sampleTime - delay;
+        return;
+    }
+    if (sampleTime > latest) latest = sampleTime;
+}
+
+void InterpolationClock::Advance(double dt)
+{
+    if (!running) return;
+
+    double error = (latest - delay) - time;
+    if (error > 0.25) {
+        // too far behind to drift back, e.g. a backlog after a stall
+        time = latest - delay;
+        return;
+    }
+
+    // when samples stop coming, hold at the newest one: running past it only
+    // freezes the entity anyway, and would have to jump back later
+    double rate = 1.0 + fmax(-0.1, fmin(0.1, error * 2.0));
+    time = fmin(time + dt * rate, latest);
+}
+
+void InterpolationClock::Reset()
+{
+    time = 0.0;
+    latest = 0.0;
+    running = false;
+}
+
+uint32_t PredictionHistory::Record(const float position[3])
+{
+    Entry entry;
+    entry.sequence = nextSequence++;
+    if (nextSequence == 0) nextSequence = 1;
+    entry.position[0] = position[0];
+    entry.position[1] = position[1];
+    entry.position[2] = position[2];
+
+    if (entries.size() >= MAX_PREDICTIONS) {
+        entries.pop_front();
+    }
+    entries.push_back(entry);
+    return entry.sequence;
+}
+
+bool PredictionHistory::Reconcile(uint32_t sequence, const float authoritative[3], float correction[3])
+{
+    while (!entries.empty() && (int32_t)(entries.front().sequence - sequence) < 0) {
+        entries.pop_front();
+    }
+    if (entries.empty() || entries.front().sequence != sequence) return false;
+
+    for (int k = 0; k < 3; ++k) {
+        correction[k] = authoritative[k] - entries.front().position[k];
+    }
+    entries.pop_front();
+
+    for (Entry& entry : entries) {
+        for (int k = 0; k < 3; ++k) {
+            entry.position[k] += correction[k];
+        }
+    }
+    return true;
+}
+
+void PredictionHistory::Reset()
+{
+    entries.clear();
+}
@@ -0,0 +1,83 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <deque>
+
+struct EntitySample {
+    double time = 0.0;      // seconds on the sender's clock
+    float position[3] = {};
+    float yaw = 0.0f, pitch = 0.0f;
+};
+
+// Ring of timestamped states for one remote entity.
+class EntityHistory
+{
+public:
+    static const size_t CAPACITY = 32;
+
+    // samples that aren't newer than the latest one are dropped
+    void Push(const EntitySample& sample);
+
+    // State at time: interpolated between the samples around it, clamped to
+    // the oldest/newest sample outside the buffered range (no extrapolation).
+    bool Sample(double time, EntitySample& out) const;
+    bool Latest(EntitySample& out) const;
+
+    size_t Size() const { return count; }
+    void Clear() { head = 0; count = 0; }
+
+private:
+    const EntitySample& At(size_t i) const { return samples[(head + i) % CAPACITY]; }
+
+    EntitySample samples[CAPACITY];
+    size_t head = 0;   // oldest sample
+    size_t count = 0;
+};
+
+// Playback time for remote entities. Trails the newest sample time by a fixed
+// delay and absorbs jitter by running up to 10% fast or slow instead of jumping.
+// It never passes the newest sample, so it never has to go back in time.
+class InterpolationClock
+{
+public:
+    void SetDelay(double seconds) { delay = seconds; }
+    double GetDelay() const { return delay; }
+
+    void OnSample(double sampleTime);
+    void Advance(double dt);
+    void Reset();
+
+    double Now() const { return time; }
+    bool IsRunning() const { return running; }
+
+private:
+    double time = 0.0;
+    double latest = 0.0;
+    double delay = 0.1;
+    bool running = false;
+};
+
+// Local player positions as predicted when each input was sent, so the host's
+// answer for an input can be compared with the prediction for that input.
+class PredictionHistory
+{
+public:
+    // Stores the prediction and returns the input sequence to send with it.
+    uint32_t Record(const float position[3]);
+
+    // correction = authoritative - predicted for sequence. Later predictions
+    // are shifted by it too, since they were built on the wrong position.
+    // False if the sequence is unknown (too old or from before a Reset).
+    bool Reconcile(uint32_t sequence, const float authoritative[3], float correction[3]);
+
+    void Reset();
+
+private:
+    struct Entry {
+        uint32_t sequence;
+        float position[3];
+    };
+
+    std::deque<Entry> entries;
+    uint32_t nextSequence = 1;
+};
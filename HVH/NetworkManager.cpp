@@ -1,6 +1,13 @@
 ﻿#include "NetworkManager.h"
+#include <chrono>
 #include <iostream>
 
+namespace {
+    // a client that stops reading gets dropped instead of growing this forever
+    const size_t MAX_OUTBOX_BYTES = 8 * 1024 * 1024;
+    const int POLL_TIMEOUT_MS = 10;
+}
+
 NetworkManager::NetworkManager() {}
 
 NetworkManager::~NetworkManager()
@@ -10,10 +17,9 @@ NetworkManager::~NetworkManager()
 
 bool NetworkManager::Initialize()
 {
-    WSADATA wsaData;
-    int result = WSAStartup(MAKEWORD(2, 2), &wsaData);
+    int result = SocketStartup();
     if (result != 0) {
-        std::cerr << "WSAStartup failed: " << result << std::endl;
+        std::cerr << "Socket startup failed: " << result << std::endl;
         return false;
     }
     return true;
@@ -40,18 +46,21 @@ bool NetworkManager::StartServer(int port)
     if (bind(serverSocket, (sockaddr*)&serverAddr, sizeof(serverAddr)) == SOCKET_ERROR) {
         std::cerr << "Bind failed on port " << port << std::endl;
         closesocket(serverSocket);
+        serverSocket = INVALID_SOCKET;
         return false;
     }
 
     if (listen(serverSocket, SOMAXCONN) == SOCKET_ERROR) {
         std::cerr << "Listen failed" << std::endl;
         closesocket(serverSocket);
+        serverSocket = INVALID_SOCKET;
         return false;
     }
+    MakeNonBlocking(serverSocket);
 
     role = NetworkRole::SERVER;
     running = true;
-    networkThread = std::thread(&NetworkManager::ServerThread, this);
+    networkThread = std::thread(&NetworkManager::IoThread, this);
 
     std::cout << "Server started on port " << port << std::endl;
     return true;
@@ -61,7 +70,7 @@ bool NetworkManager::ConnectToServer(const std::string& ip, int port)
 {
     if (role != NetworkRole::NONE) Disconnect();
 
-    clientSocket = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+    SOCKET clientSocket = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
     if (clientSocket == INVALID_SOCKET) {
         std::cerr << "Socket creation failed" << std::endl;
         return false;
@@ -77,20 +86,25 @@ bool NetworkManager::ConnectToServer(const std::string& ip, int port)
         return false;
     }
 
-    DWORD timeout = 5000; // 5 
-    setsockopt(clientSocket, SOL_SOCKET, SO_RCVTIMEO, (char*)&timeout, sizeof(timeout));
-    setsockopt(clientSocket, SOL_SOCKET, SO_SNDTIMEO, (char*)&timeout, sizeof(timeout));
-
+    // connect stays blocking, everything after it goes through the poller
     if (connect(clientSocket, (sockaddr*)&serverAddr, sizeof(serverAddr)) == SOCKET_ERROR) {
         std::cerr << "Connect failed to " << ip << ":" << port << std::endl;
         closesocket(clientSocket);
         return false;
     }
+    MakeNonBlocking(clientSocket);
+
+    {
+        std::lock_guard<std::mutex> lock(connectionsMutex);
+        connections.push_back(std::make_unique<Connection>());
+        connections.back()->socket = clientSocket;
+    }
 
     role = NetworkRole::CLIENT;
     connected = true;
+    pingTimer = 0.0f;
     running = true;
-    networkThread = std::thread(&NetworkManager::ClientThread, this);
+    networkThread = std::thread(&NetworkManager::IoThread, this);
 
     std::cout << "Connected to server " << ip << ":" << port << std::endl;
     return true;
@@ -105,167 +119,322 @@ void NetworkManager::Disconnect()
         networkThread.join();
     }
 
-    for (SOCKET socket : clientSockets) {
-        closesocket(socket);
+    {
+        std::lock_guard<std::mutex> lock(connectionsMutex);
+        for (auto& conn : connections) {
+            if (conn && conn->socket != INVALID_SOCKET) {
+                closesocket(conn->socket);
+            }
+        }
+        connections.clear();
     }
-    clientSockets.clear();
 
     if (serverSocket != INVALID_SOCKET) {
         closesocket(serverSocket);
         serverSocket = INVALID_SOCKET;
     }
 
-    if (clientSocket != INVALID_SOCKET) {
-        closesocket(clientSocket);
-        clientSocket = INVALID_SOCKET;
-    }
-
     role = NetworkRole::NONE;
     std::cout << "Disconnected from network" << std::endl;
 }
 
-void NetworkManager::SendData(const std::string& data)
+void NetworkManager::MakeNonBlocking(SOCKET socket)
+{
+    SocketSetNonBlocking(socket);
+
+    // frames are small and latency matters more than packet count
+    int noDelay = 1;
+    setsockopt(socket, IPPROTO_TCP, TCP_NODELAY, (char*)&noDelay, sizeof(noDelay));
+}
+
+bool NetworkManager::QueueFrame(Connection& conn, const char* data, size_t size)
+{
+    if (conn.closing) return false;
+
+    // nothing pending, so try the socket directly and only buffer the rest
+    if (conn.outbox.empty()) {
+        int sent = send(conn.socket, data, (int)size, SOCKET_SEND_FLAGS);
+        if (sent == SOCKET_ERROR) {
+            if (!SocketWouldBlock()) {
+                conn.closing = true;
+                return false;
+            }
+            sent = 0;
+        }
+        data += sent;
+        size -= sent;
+    }
+
+    if (size > 0) {
+        if (conn.outbox.size() + size > MAX_OUTBOX_BYTES) {
+            conn.closing = true;
+            return false;
+        }
+        conn.outbox.insert(conn.outbox.end(), data, data + size);
+    }
+    return true;
+}
+
+void NetworkManager::SendData(const NetMessage& msg)
 {
     if (!connected) return;
 
-    if (role == NetworkRole::CLIENT && clientSocket != INVALID_SOCKET) {
-        int result = send(clientSocket, data.c_str(), (int)data.size(), 0);
-        if (result == SOCKET_ERROR) {
+    if (role == NetworkRole::CLIENT) {
+        std::vector<char> frame;
+        EncodeNetMessage(msg, frame);
+
+        std::lock_guard<std::mutex> lock(connectionsMutex);
+        if (connections.empty() || !connections[0] || !QueueFrame(*connections[0], frame.data(), frame.size())) {
             connected = false;
         }
     }
 }
 
-void NetworkManager::BroadcastData(const std::string& data)
+void NetworkManager::BroadcastData(const NetMessage& msg)
 {
     if (role == NetworkRole::SERVER) {
-        for (SOCKET client : clientSockets) {
-            send(client, data.c_str(), (int)data.size(), 0);
+        std::vector<char> frame;
+        EncodeNetMessage(msg, frame);
+
+        std::lock_guard<std::mutex> lock(connectionsMutex);
+        for (auto& conn : connections) {
+            if (conn) {
+                QueueFrame(*conn, frame.data(), frame.size());
+            }
         }
     }
 }
 
-void NetworkManager::SetDataReceivedCallback(std::function<void(const std::string&, int)> callback)
+bool NetworkManager::SendToClient(int clientId, const NetMessage& msg)
+{
+    if (role != NetworkRole::SERVER || clientId < 0) {
+        return false;
+    }
+
+    std::vector<char> frame;
+    EncodeNetMessage(msg, frame);
+
+    std::lock_guard<std::mutex> lock(connectionsMutex);
+    if (clientId >= (int)connections.size() || !connections[clientId]) {
+        return false;
+    }
+    return QueueFrame(*connections[clientId], frame.data(), frame.size());
+}
+
+int NetworkManager::GetClientCount() const
+{
+    if (role != NetworkRole::SERVER) return 0;
+
+    std::lock_guard<std::mutex> lock(connectionsMutex);
+    int count = 0;
+    for (const auto& conn : connections) {
+        if (conn) count++;
+    }
+    return count;
+}
+
+void NetworkManager::SetDataReceivedCallback(std::function<void(const NetMessage&, int)> callback)
 {
     dataCallback = callback;
 }
 
-void NetworkManager::Update()
+void NetworkManager::Update(float dt)
 {
     if (role == NetworkRole::CLIENT && connected) {
-        static float pingTimer = 0;
-        pingTimer += 0.1f;
-        if (pingTimer > 5.0f) {
-            pingTimer = 0;
-            SendData("PING");
+        pingTimer += dt;
+        if (pingTimer >= PING_INTERVAL) {
+            pingTimer = 0.0f;
+            SendData(NetMessage::Simple(NetMessageType::Ping));
         }
     }
 }
 
-void NetworkManager::ServerThread()
+void NetworkManager::IoThread()
 {
+    std::vector<SocketPollFd> fds;
+    std::vector<int> ids; // client id per fd, -1 for the listen socket
+    std::vector<int> closing;
+
     while (running) {
-        fd_set readSet;
-        FD_ZERO(&readSet);
-        FD_SET(serverSocket, &readSet);
-
-        timeval timeout{ 0, 100000 }; // 100ms
-
-        int activity = select(0, &readSet, nullptr, nullptr, &timeout);
-        if (activity > 0 && FD_ISSET(serverSocket, &readSet)) {
-            SOCKET clientSocket = accept(serverSocket, nullptr, nullptr);
-            if (clientSocket != INVALID_SOCKET) {
-                clientSockets.push_back(clientSocket);
-                std::thread clientThread(&NetworkManager::HandleClient, this, clientSocket, (int)clientSockets.size() - 1);
-                clientThread.detach();
-
-                if (dataCallback) {
-                    dataCallback("JOIN", (int)clientSockets.size() - 1);
+        fds.clear();
+        ids.clear();
+        closing.clear();
+
+        if (serverSocket != INVALID_SOCKET) {
+            SocketPollFd fd{};
+            fd.fd = serverSocket;
+            fd.events = POLLRDNORM;
+            fds.push_back(fd);
+            ids.push_back(-1);
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(connectionsMutex);
+            for (int i = 0; i < (int)connections.size(); i++) {
+                Connection* conn = connections[i].get();
+                if (!conn) continue;
+                if (conn->closing) {
+                    closing.push_back(i);
+                    continue;
                 }
+
+                SocketPollFd fd{};
+                fd.fd = conn->socket;
+                fd.events = POLLRDNORM;
+                if (!conn->outbox.empty()) fd.events |= POLLWRNORM;
+                fds.push_back(fd);
+                ids.push_back(i);
             }
         }
-    }
-}
 
-void NetworkManager::ClientThread()
-{
-    char buffer[1024];
+        for (int id : closing) {
+            CloseConnection(id, *connections[id]);
+        }
 
-    while (running && connected) {
-        int bytesReceived = recv(clientSocket, buffer, sizeof(buffer) - 1, 0);
-        if (bytesReceived > 0) {
-            buffer[bytesReceived] = '\0';
-            if (dataCallback) {
-                dataCallback(std::string(buffer, bytesReceived), 0);
-            }
+        if (fds.empty()) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(POLL_TIMEOUT_MS));
+            continue;
         }
-        else if (bytesReceived == 0) {
-            // Connection closed
-            connected = false;
-            if (dataCallback) {
-                dataCallback("DISCONNECT", 0);
-            }
-            break;
+
+        int ready = SocketPoll(fds.data(), fds.size(), POLL_TIMEOUT_MS);
+        if (ready == SOCKET_ERROR) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(POLL_TIMEOUT_MS));
+            continue;
         }
-        else {
-            // Error or timeout
-            if (WSAGetLastError() != WSAETIMEDOUT) {
-                connected = false;
-                if (dataCallback) {
-                    dataCallback("DISCONNECT", 0);
-                }
-                break;
+        if (ready == 0) continue;
+
+        for (size_t k = 0; k < fds.size(); k++) {
+            short revents = fds[k].revents;
+            if (revents == 0) continue;
+
+            if (ids[k] < 0) {
+                AcceptClients();
+                continue;
+            }
+
+            // the vector may have grown, but entries are only reset on this thread
+            Connection* conn = nullptr;
+            {
+                std::lock_guard<std::mutex> lock(connectionsMutex);
+                conn = connections[ids[k]].get();
+            }
+            if (!conn) continue;
+
+            // hang-ups and errors surface as a failed recv
+            if (revents & (POLLRDNORM | POLLHUP | POLLERR | POLLNVAL)) {
+                ReadConnection(ids[k], *conn);
+            }
+            if (revents & POLLWRNORM) {
+                std::lock_guard<std::mutex> lock(connectionsMutex);
+                FlushConnection(*conn);
             }
         }
     }
 }
 
-bool NetworkManager::SendToClient(int clientId, const std::string& data)
+void NetworkManager::AcceptClients()
 {
-    if (role != NetworkRole::SERVER || clientId < 0 || clientId >= clientSockets.size()) {
-        return false;
-    }
+    for (;;) {
+        SOCKET socket = accept(serverSocket, nullptr, nullptr);
+        if (socket == INVALID_SOCKET) {
+            return; // would block once the backlog is empty
+        }
+        MakeNonBlocking(socket);
+
+        // reuse the lowest closed slot so ids stay small; CloseConnection
+        // reports the old owner's Disconnected before its slot is free
+        int clientId = -1;
+        {
+            std::lock_guard<std::mutex> lock(connectionsMutex);
+            for (int i = 0; i < (int)connections.size(); i++) {
+                if (!connections[i]) {
+                    clientId = i;
+                    break;
+                }
+            }
+            if (clientId < 0 && (int)connections.size() <= NET_MAX_CLIENT_ID) {
+                clientId = (int)connections.size();
+                connections.emplace_back();
+            }
+            if (clientId >= 0) {
+                connections[clientId] = std::make_unique<Connection>();
+                connections[clientId]->socket = socket;
+            }
+        }
+        if (clientId < 0) {
+            std::cerr << "Too many connections, refusing one" << std::endl;
+            closesocket(socket);
+            continue;
+        }
 
-    if (clientSockets[clientId] != INVALID_SOCKET) {
-        int result = send(clientSockets[clientId], data.c_str(), (int)data.size(), 0);
-        return result != SOCKET_ERROR;
+        if (dataCallback) {
+            dataCallback(NetMessage::Simple(NetMessageType::Join), clientId);
+        }
     }
-
-    return false;
 }
 
-void NetworkManager::HandleClient(SOCKET clientSocket, int clientId)
+void NetworkManager::ReadConnection(int clientId, Connection& conn)
 {
-    char buffer[1024];
-
-    while (running) {
-        int bytesReceived = recv(clientSocket, buffer, sizeof(buffer) - 1, 0);
-        if (bytesReceived > 0) {
-            buffer[bytesReceived] = '\0';
-            std::string receivedData(buffer, bytesReceived);
-
-            if (dataCallback) {
-                dataCallback(receivedData, clientId);
-            }
-
-            if (role == NetworkRole::SERVER) {
-                for (size_t i = 0; i < clientSockets.size(); i++) {
-                    if (i != clientId && clientSockets[i] != INVALID_SOCKET) {
-                        send(clientSockets[i], receivedData.c_str(), receivedData.size(), 0);
-                    }
-                }
+    char buffer[8192];
+    NetMessage msg;
+    int senderId = role == NetworkRole::SERVER ? clientId : 0;
+
+    for (;;) {
+        int bytesReceived = recv(conn.socket, buffer, sizeof(buffer), 0);
+        if (bytesReceived <= 0) {
+            if (bytesReceived == 0 || !SocketWouldBlock()) {
+                std::lock_guard<std::mutex> lock(connectionsMutex);
+                conn.closing = true;
             }
+            break;
         }
-        else {
+
+        conn.reader.Append(buffer, bytesReceived);
+        // nothing is relayed blindly, the game decides what to rebroadcast
+        while (conn.reader.Next(msg)) {
             if (dataCallback) {
-                dataCallback("DISCONNECTED:" + std::to_string(clientId), clientId);
+                dataCallback(msg, senderId);
             }
+        }
 
-            closesocket(clientSocket);
-            if (clientId < clientSockets.size()) {
-                clientSockets[clientId] = INVALID_SOCKET;
-            }
+        if (conn.reader.HasError()) {
+            std::cerr << "Malformed data from connection " << clientId << std::endl;
+            std::lock_guard<std::mutex> lock(connectionsMutex);
+            conn.closing = true;
             break;
         }
     }
-}
\ No newline at end of file
+}
+
+void NetworkManager::FlushConnection(Connection& conn)
+{
+    if (conn.closing || conn.outbox.empty()) return;
+
+    int sent = send(conn.socket, conn.outbox.data(), (int)conn.outbox.size(), SOCKET_SEND_FLAGS);
+    if (sent == SOCKET_ERROR) {
+        if (!SocketWouldBlock()) {
+            conn.closing = true;
+        }
+        return;
+    }
+    conn.outbox.erase(conn.outbox.begin(), conn.outbox.begin() + sent);
+}
+
+void NetworkManager::CloseConnection(int clientId, Connection& conn)
+{
+    closesocket(conn.socket);
+    {
+        std::lock_guard<std::mutex> lock(connectionsMutex);
+        connections[clientId].reset();
+    }
+
+    if (role == NetworkRole::CLIENT) {
+        connected = false;
+        if (dataCallback) {
+            dataCallback(NetMessage::Simple(NetMessageType::Disconnected), 0);
+        }
+    }
+    else if (dataCallback) {
+        dataCallback(NetMessage::Player(NetMessageType::Disconnected, clientId), clientId);
+    }
+}
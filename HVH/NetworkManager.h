@@ -1,16 +1,14 @@
 ﻿#pragma once
 
-#define WIN32_LEAN_AND_MEAN
-#include <winsock2.h>
-#include <ws2tcpip.h> 
-#include <windows.h>
+#include "SocketPlatform.h"
 #include <vector>
 #include <string>
 #include <functional>
 #include <thread>
 #include <atomic>
-
-#pragma comment(lib, "ws2_32.lib")
+#include <mutex>
+#include <memory>
+#include "NetProtocol.h"
 
 class NetworkManager
 {
@@ -25,10 +23,10 @@ public:
     bool ConnectToServer(const std::string& ip, int port = 27015);
     void Disconnect();
 
-    void SendData(const std::string& data);
-    void BroadcastData(const std::string& data);
+    void SendData(const NetMessage& msg);
+    void BroadcastData(const NetMessage& msg);
 
-    void SetDataReceivedCallback(std::function<void(const std::string&, int)> callback);
+    void SetDataReceivedCallback(std::function<void(const NetMessage&, int)> callback);
 
     NetworkRole GetRole() const { return role; }
     bool IsConnected() const { return connected; }
@@ -36,29 +34,50 @@ public:
 
     bool IsServer() const { return role == NetworkRole::SERVER; }
     bool IsClient() const { return role == NetworkRole::CLIENT; }
-    int GetClientCount() const { return (int)clientSockets.size(); }
+    int GetClientCount() const;
 
-    int GetConnectedClientsCount() const { return (int)clientSockets.size(); }
+    int GetConnectedClientsCount() const { return GetClientCount(); }
 
-    bool SendToClient(int clientId, const std::string& data);
+    bool SendToClient(int clientId, const NetMessage& msg);
 
-    void Update();
+    // dt in seconds since the last call; clients ping the server every
+    // PING_INTERVAL seconds
+    void Update(float dt);
+    static constexpr float PING_INTERVAL = 5.0f;
 
 private:
-    void ServerThread();
-    void ClientThread();
-    void HandleClient(SOCKET clientSocket, int clientId);
+    // one socket plus its stream state, owned by the I/O thread
+    struct Connection {
+        SOCKET socket = INVALID_SOCKET;
+        NetFrameReader reader;
+        std::vector<char> outbox;   // bytes send() hasn't accepted yet
+        bool closing = false;
+    };
+
+    // single thread multiplexing the listen socket and every connection
+    void IoThread();
+    void AcceptClients();
+    void ReadConnection(int clientId, Connection& conn);
+    void FlushConnection(Connection& conn);
+    void CloseConnection(int clientId, Connection& conn);
+    // appends a frame and writes as much as the socket takes right now;
+    // caller holds connectionsMutex
+    bool QueueFrame(Connection& conn, const char* data, size_t size);
+    static void MakeNonBlocking(SOCKET socket);
 
     SOCKET serverSocket = INVALID_SOCKET;
-    SOCKET clientSocket = INVALID_SOCKET;
 
     std::thread networkThread;
     std::atomic<bool> running{ false };
     std::atomic<bool> connected{ false };
+    float pingTimer = 0.0f;
 
     NetworkRole role = NetworkRole::NONE;
-    std::vector<SOCKET> clientSockets;
+    // server: one entry per client id, null once closed until an accept reuses
+    // it; client: [0] is the server
+    std::vector<std::unique_ptr<Connection>> connections;
+    mutable std::mutex connectionsMutex;
     std::vector<std::string> connectedPlayers;
 
-    std::function<void(const std::string&, int)> dataCallback;
+    std::function<void(const NetMessage&, int)> dataCallback;
 };
\ No newline at end of file
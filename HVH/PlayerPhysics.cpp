@@ -0,0 +1,160 @@
+#include "PlayerPhysics.h"
+#include "BlockRegistry.h"
+#include <algorithm>
+#include <cmath>
+
+// boxes closer than this count as touching, not overlapping, so sliding
+// along a wall doesn't catch on the seams between its blocks
+static const float CONTACT_EPSILON = 0.001f;
+static const float GROUND_PROBE = 0.01f;
+
+static PhysicsBox PlayerBox(const float position[3], const PlayerPhysicsParams& params)
+{
+    PhysicsBox box;
+    box.min[0] = position[0] - params.halfWidth;
+    box.min[1] = position[1];
+    box.min[2] = position[2] - params.halfWidth;
+    box.max[0] = position[0] + params.halfWidth;
+    box.max[1] = position[1] + params.height;
+    box.max[2] = position[2] + params.halfWidth;
+    return box;
+}
+
+float SweepAxis(const PhysicsBox& player, int axis, float distance, const std::vector<PhysicsBox>& boxes)
+{
+    int a1 = (axis + 1) % 3, a2 = (axis + 2) % 3;
+    for (const PhysicsBox& block : boxes) {
+        if (player.max[a1] <= block.min[a1] + CONTACT_EPSILON || player.min[a1] >= block.max[a1] - CONTACT_EPSILON ||
+            player.max[a2] <= block.min[a2] + CONTACT_EPSILON || player.min[a2] >= block.max[a2] - CONTACT_EPSILON) {
+            continue;
+        }
+        if (distance > 0.0f && player.max[axis] <= block.min[axis] + CONTACT_EPSILON) {
+            distance = (std::min)(distance, (std::max)(0.0f, block.min[axis] - player.max[axis]));
+        }
+        else if (distance < 0.0f && player.min[axis] >= block.max[axis] - CONTACT_EPSILON) {
+            distance = (std::max)(distance, (std::min)(0.0f, block.max[axis] - player.min[axis]));
+        }
+    }
+    return distance;
+}
+
+bool StepPlayer(PlayerBody& body, const PlayerMove& move, const PlayerPhysicsParams& params,
+    float dt, const PhysicsBoxSource& boxes)
+{
+    float vel[3] = { body.velocity[0], body.velocity[1], body.velocity[2] };
+    bool prevGrounded = body.grounded;
+
+    if (move.fly) {
+        for (int i = 0; i < 3; ++i) body.position[i] += vel[i] * dt;
+        return false;
+    }
+
+    if (!body.grounded)
+        vel[1] -= params.gravity * dt;
+    else
+        vel[1] = 0.0f;
+
+    if (body.grounded) {
+        vel[0] = move.wishX * move.speed;
+        vel[2] = move.wishZ * move.speed;
+    }
+    else if (move.wishX != 0.0f || move.wishZ != 0.0f) {
+        float projVel = vel[0] * move.wishX + vel[2] * move.wishZ;
+        float accelVel = params.airAcceleration * dt * move.speed;
+
+        if (projVel + accelVel > move.speed)
+            accelVel = move.speed - projVel;
+
+        if (accelVel > 0.0f) {
+            vel[0] += accelVel * move.wishX;
+            vel[2] += accelVel * move.wishZ;
+        }
+    }
+
+    float horizontalSpeed = sqrtf(vel[0] * vel[0] + vel[2] * vel[2]);
+    if (horizontalSpeed > move.speed) {
+        float ratio = move.speed / horizontalSpeed;
+        vel[0] *= ratio;
+        vel[2] *= ratio;
+    }
+
+    // sub-steps keep the per-axis sweeps close to the diagonal path and the
+    // broadphase query small; past the budget the steps just get longer
+    float longest = 0.0f;
+    for (int i = 0; i < 3; ++i) longest = (std::max)(longest, fabsf(vel[i] * dt));
+    int steps = (int)ceilf(longest / params.maxStepDistance);
+    steps = (std::max)(1, (std::min)(steps, params.maxSubsteps));
+    float stepDt = dt / steps;
+
+    std::vector<PhysicsBox> blockBoxes;
+    float adjusted[3] = { body.position[0], body.position[1], body.position[2] };
+    PhysicsBox player = PlayerBox(adjusted, params);
+    for (int step = 0; step < steps; ++step) {
+        float delta[3];
+        for (int i = 0; i < 3; ++i) delta[i] = vel[i] * stepDt;
+
+        // everything the box can touch on the way, queried once per sub-step
+        PhysicsBox region = player;
+        for (int i = 0; i < 3; ++i) {
+            if (delta[i] < 0.0f) region.min[i] += delta[i];
+            else region.max[i] += delta[i];
+        }
+        blockBoxes.clear();
+        boxes(region, blockBoxes);
+
+        // vertical first, so a landing is settled before sliding along the ground
+        static const int axes[3] = { 1, 0, 2 };
+        for (int axis : axes) {
+            if (delta[axis] == 0.0f) continue;
+            float moved = SweepAxis(player, axis, delta[axis], blockBoxes);
+            if (moved != delta[axis]) {
+                if (axis == 1 && delta[axis] < 0.0f) body.grounded = true;
+                vel[axis] = 0.0f;
+            }
+            adjusted[axis] += moved;
+            player = PlayerBox(adjusted, params);
+        }
+        if (vel[0] == 0.0f && vel[1] == 0.0f && vel[2] == 0.0f) break;
+    }
+
+    // the floor plane at y = 0
+    const float groundEps = 0.001f;
+    if (adjusted[1] < 0.0f || (fabsf(adjusted[1]) <= groundEps && vel[1] <= 0.0f)) {
+        adjusted[1] = 0.0f;
+        vel[1] = 0.0f;
+        body.grounded = true;
+    }
+    else if (vel[1] > 0.0f) {
+        body.grounded = false;
+    }
+    else {
+        // standing still on a block moves nothing, so probe just below the feet
+        blockBoxes.clear();
+        PhysicsBox below = player;
+        below.min[1] -= GROUND_PROBE;
+        boxes(below, blockBoxes);
+        body.grounded = SweepAxis(player, 1, -GROUND_PROBE, blockBoxes) > -GROUND_PROBE;
+        if (body.grounded) vel[1] = 0.0f;
+    }
+
+    for (int i = 0; i < 3; ++i) {
+        body.position[i] = adjusted[i];
+        body.velocity[i] = vel[i];
+    }
+    return !prevGrounded && body.grounded;
+}
+
+void CollectVoxelBoxes(const VoxelWorld& world, const PhysicsBox& region, std::vector<PhysicsBox>& out)
+{
+    int x0 = (int)ceilf(region.min[0] - 1.0f), x1 = (int)floorf(region.max[0] + 1.0f);
+    int y0 = (int)ceilf(region.min[1] - 1.0f), y1 = (int)floorf(region.max[1] + 1.0f);
+    int z0 = (int)ceilf(region.min[2] - 1.0f), z1 = (int)floorf(region.max[2] + 1.0f);
+    world.ForEachBlockInBox(x0, y0, z0, x1, y1, z1, [&](int x, int y, int z, BlockId id) {
+        if (!BlockRegistry::Get(id).solid) return;
+        PhysicsBox box = {
+            { x - 1.0f, y - 1.0f, z - 1.0f },
+            { x + 1.0f, y + 1.0f, z + 1.0f }
+        };
+        out.push_back(box);
+        });
+}
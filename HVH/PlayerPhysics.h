@@ -0,0 +1,52 @@
+#pragma once
+#include <functional>
+#include <vector>
+#include "VoxelWorld.h"
+
+// Player movement and collision, kept free of Windows and DirectX so the
+// simulation can be stepped headlessly. Positions are the player's feet.
+struct PhysicsBox {
+    float min[3];
+    float max[3];
+};
+
+struct PlayerBody {
+    float position[3] = {};
+    float velocity[3] = {};
+    bool grounded = false;
+};
+
+struct PlayerMove {
+    float wishX = 0.0f, wishZ = 0.0f; // unit length or zero
+    float speed = 0.0f;
+    bool fly = false;
+};
+
+struct PlayerPhysicsParams {
+    float gravity = 350.0f;
+    float airAcceleration = 0.0f;
+    float height = 1.8f;
+    float halfWidth = 0.3f;
+    // motion per tick is swept in sub-steps of at most this far, up to maxSubsteps
+    float maxStepDistance = 1.0f;
+    int maxSubsteps = 8;
+};
+
+// Appends every solid box that may touch region.
+using PhysicsBoxSource = std::function<void(const PhysicsBox& region, std::vector<PhysicsBox>& out)>;
+
+// One step of dt seconds (game time). The box is swept one axis at a time
+// against what boxes returns for the path, so no speed tunnels through a
+// block and the result doesn't depend on the order of the boxes. True if the
+// body landed during it.
+bool StepPlayer(PlayerBody& body, const PlayerMove& move, const PlayerPhysicsParams& params,
+    float dt, const PhysicsBoxSource& boxes);
+
+// How far box can move by distance along axis before hitting one of boxes.
+// Boxes it already overlaps don't stop it, so it can't get stuck in a block
+// placed on top of it.
+float SweepAxis(const PhysicsBox& box, int axis, float distance, const std::vector<PhysicsBox>& boxes);
+
+// The unit blocks of world that may touch region, each spanning +-1 around
+// its lattice point.
+void CollectVoxelBoxes(const VoxelWorld& world, const PhysicsBox& region, std::vector<PhysicsBox>& out);
@@ -0,0 +1,191 @@
+#include "Replication.h"
+
+namespace {
+
+    // unacknowledged snapshots kept per client; past this the oldest go and an
+    // ack for them is ignored, which only costs a bigger delta
+    const size_t MAX_SNAPSHOT_HISTORY = 64;
+
+    bool SameEntities(const NetEntityMap& a, const NetEntityMap& b)
+    {
+        if (a.size() != b.size()) return false;
+        for (const auto& pair : a) {
+            auto it = b.find(pair.first);
+            if (it == b.end() ||
+                !pair.second.SamePosition(it->second) ||
+                !pair.second.SameRotation(it->second)) {
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+void SnapshotServer::AddClient(int clientId)
+{
+    clients[clientId] = ClientState();
+}
+
+bool SnapshotServer::RemoveClient(int clientId)
+{
+    return clients.erase(clientId) > 0;
+}
+
+bool SnapshotServer::HasClient(int clientId) const
+{
+    return clients.find(clientId) != clients.end();
+}
+
+std::vector<int> SnapshotServer::GetClients() const
+{
+    std::vector<int> ids;
+    ids.reserve(clients.size());
+    for (const auto& pair : clients) {
+        ids.push_back(pair.first);
+    }
+    return ids;
+}
+
+void SnapshotServer::Reset()
+{
+    clients.clear();
+    sequence = 0;
+}
+
+void SnapshotServer::Acknowledge(int clientId, uint32_t ackSequence)
+{
+    auto it = clients.find(clientId);
+    if (it == clients.end()) return;
+
+    ClientState& client = it->second;
+    while (!client.history.empty()) {
+        SentSnapshot& sent = client.history.front();
+        if (sent.sequence == ackSequence) {
+            client.baseline = std::move(sent.states);
+            client.baselineSequence = ackSequence;
+            client.history.pop_front();
+            return;
+        }
+        // acks arrive in order, anything before this one is superseded
+        if ((int32_t)(ackSequence - sent.sequence) < 0) return;
+        client.history.pop_front();
+    }
+}
+
+uint32_t SnapshotServer::BeginTick()
+{
+    if (++sequence == 0) sequence = 1; // 0 means "no baseline"
+    return sequence;
+}
+
+bool SnapshotServer::BuildSnapshot(int clientId, const NetEntityMap& world, NetMessage& out)
+{
+    auto it = clients.find(clientId);
+    if (it == clients.end()) return false;
+    ClientState& client = it->second;
+
+    out = NetMessage();
+    out.type = NetMessageType::Snapshot;
+    out.sequence = sequence;
+    out.baseline = client.baselineSequence;
+
+    // what the client will hold after applying this snapshot
+    NetEntityMap result = client.baseline;
+
+    for (const auto& pair : world) {
+        if (out.entities.size() >= NET_MAX_SNAPSHOT_ENTITIES) break;
+
+        uint8_t flags = 0;
+        auto base = client.baseline.find(pair.first);
+        if (base == client.baseline.end()) {
+            flags = NET_ENTITY_POSITION | NET_ENTITY_ROTATION;
+        }
+        else {
+            if (!pair.second.SamePosition(base->second)) flags |= NET_ENTITY_POSITION;
+            if (!pair.second.SameRotation(base->second)) flags |= NET_ENTITY_ROTATION;
+        }
+        if (flags == 0) continue;
+
+        NetEntityState entity;
+        entity.id = pair.first;
+        entity.flags = flags;
+        entity.state = pair.second;
+        out.entities.push_back(entity);
+        result[pair.first] = pair.second;
+    }
+
+    for (const auto& pair : client.baseline) {
+        if (out.entities.size() >= NET_MAX_SNAPSHOT_ENTITIES) break;
+        if (world.find(pair.first) != world.end()) continue;
+
+        NetEntityState entity;
+        entity.id = pair.first;
+        entity.flags = NET_ENTITY_REMOVED;
+        out.entities.push_back(entity);
+        result.erase(pair.first);
+    }
+
+    // an empty delta still matters if an unacked snapshot moved the client
+    // away from the baseline (something changed and changed back)
+    const NetEntityMap& latest = client.history.empty() ? client.baseline : client.history.back().states;
+    if (out.entities.empty() && SameEntities(latest, result)) {
+        return false;
+    }
+
+    if (client.history.size() >= MAX_SNAPSHOT_HISTORY) {
+        client.history.pop_front();
+    }
+    SentSnapshot sent;
+    sent.sequence = sequence;
+    sent.states = std::move(result);
+    client.history.push_back(std::move(sent));
+    return true;
+}
+
+bool SnapshotClient::Apply(const NetMessage& snapshot, NetEntityMap& world)
+{
+    NetEntityMap state;
+    if (snapshot.baseline != 0) {
+        bool found = false;
+        for (const auto& entry : received) {
+            if (entry.first == snapshot.baseline) {
+                state = entry.second;
+                found = true;
+                break;
+            }
+        }
+        if (!found) return false;
+    }
+
+    for (const NetEntityState& entity : snapshot.entities) {
+        if (entity.flags & NET_ENTITY_REMOVED) {
+            state.erase(entity.id);
+            continue;
+        }
+        NetQuantizedState& s = state[entity.id];
+        if (entity.flags & NET_ENTITY_POSITION) {
+            s.x = entity.state.x; s.y = entity.state.y; s.z = entity.state.z;
+        }
+        if (entity.flags & NET_ENTITY_ROTATION) {
+            s.yaw = entity.state.yaw; s.pitch = entity.state.pitch;
+        }
+    }
+
+    // the server never deltas against anything older than this baseline again
+    while (!received.empty() && snapshot.baseline != 0 &&
+        (int32_t)(received.front().first - snapshot.baseline) < 0) {
+        received.pop_front();
+    }
+    if (received.size() >= MAX_SNAPSHOT_HISTORY) {
+        received.pop_front();
+    }
+    received.emplace_back(snapshot.sequence, state);
+
+    world = std::move(state);
+    return true;
+}
+
+void SnapshotClient::Reset()
+{
+    received.clear();
+}
@@ -0,0 +1,57 @@
+#pragma once
+#include <cstdint>
+#include <deque>
+#include <unordered_map>
+#include <vector>
+#include "NetProtocol.h"
+
+typedef std::unordered_map<int32_t, NetQuantizedState> NetEntityMap;
+
+// Server half of snapshot replication. For every client it remembers the
+// entity set each sent snapshot leaves that client with, and deltas new
+// snapshots against the newest one the client acknowledged.
+class SnapshotServer
+{
+public:
+    void AddClient(int clientId);
+    bool RemoveClient(int clientId);   // false if it wasn't registered
+    bool HasClient(int clientId) const;
+    std::vector<int> GetClients() const;
+    void Reset();
+
+    void Acknowledge(int clientId, uint32_t sequence);
+
+    // Starts a new tick; every snapshot built until the next call shares its sequence.
+    uint32_t BeginTick();
+
+    // Fills out with the entities of world that changed for this client.
+    // False when the client is already up to date and nothing needs sending.
+    bool BuildSnapshot(int clientId, const NetEntityMap& world, NetMessage& out);
+
+private:
+    struct SentSnapshot {
+        uint32_t sequence;
+        NetEntityMap states;
+    };
+    struct ClientState {
+        uint32_t baselineSequence = 0;
+        NetEntityMap baseline;
+        std::deque<SentSnapshot> history; // sent but not yet acknowledged
+    };
+
+    std::unordered_map<int, ClientState> clients;
+    uint32_t sequence = 0;
+};
+
+// Client half: rebuilds the full entity set from each delta snapshot.
+class SnapshotClient
+{
+public:
+    // False if the snapshot's baseline is unknown; it is dropped and must
+    // not be acknowledged.
+    bool Apply(const NetMessage& snapshot, NetEntityMap& world);
+    void Reset();
+
+private:
+    std::deque<std::pair<uint32_t, NetEntityMap>> received;
+};
@@ -0,0 +1,225 @@
+#include "RigidBodies.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+
+static const float MAX_STEP_DISTANCE = 1.0f;
+static const int MAX_SUBSTEPS = 8;
+// slower bounces than this just stop, so a resting body doesn't jitter
+static const float BOUNCE_MIN_SPEED = 4.0f;
+// game time; about half a second of real time below SLEEP_SPEED puts a body to sleep
+static const float SLEEP_SPEED = 0.5f;
+static const float SLEEP_TIME = 0.15f;
+static const float TOUCH_EPSILON = 0.01f;
+
+size_t RigidBodyWorld::AddSphere(const float position[3], float radius, BlockId id)
+{
+    const float halfExtents[3] = { radius, radius, radius };
+    return Add(position, halfExtents, SPHERE, 0.5f, 1.5f, id);
+}
+
+size_t RigidBodyWorld::AddBox(const float position[3], const float halfExtents[3], BlockId id)
+{
+    return Add(position, halfExtents, BOX, 0.1f, 12.0f, id);
+}
+
+size_t RigidBodyWorld::Add(const float position[3], const float halfExtents[3], Shape kind,
+    float bounce, float drag, BlockId id)
+{
+    posX.push_back(position[0]); posY.push_back(position[1]); posZ.push_back(position[2]);
+    velX.push_back(0.0f); velY.push_back(0.0f); velZ.push_back(0.0f);
+    halfX.push_back(halfExtents[0]); halfY.push_back(halfExtents[1]); halfZ.push_back(halfExtents[2]);
+    restitution.push_back(bounce);
+    friction.push_back(drag);
+    restTime.push_back(0.0f);
+    shape.push_back(kind);
+    awake.push_back(1);
+    block.push_back(id);
+    stats.bodies = shape.size();
+    return shape.size() - 1;
+}
+
+void RigidBodyWorld::Clear()
+{
+    for (auto* v : { &posX, &posY, &posZ, &velX, &velY, &velZ, &halfX, &halfY, &halfZ,
+        &restitution, &friction, &restTime }) {
+        v->clear();
+    }
+    shape.clear();
+    awake.clear();
+    block.clear();
+    stats.bodies = 0;
+    stats.awake = 0;
+}
+
+void RigidBodyWorld::Step(float dt, float gravity, const PhysicsBoxSource& boxes)
+{
+    auto start = std::chrono::steady_clock::now();
+
+    awakeList.clear();
+    for (size_t i = 0; i < awake.size(); ++i) {
+        if (awake[i]) awakeList.push_back((uint32_t)i);
+    }
+    stats.awake = awakeList.size();
+
+    stepDt = dt;
+    stepGravity = gravity;
+    stepBoxes = &boxes;
+
+    size_t count = awakeList.size();
+    int threads = pool.GetThreadCount();
+    if (scratch.size() < (size_t)threads) scratch.resize(threads);
+    if (threads > 1 && count >= PARALLEL_MIN_BODIES) {
+        pool.Run([this, count](int index, int shares) {
+            StepRange(count * index / shares, count * (index + 1) / shares, scratch[index]);
+            });
+        stats.threads = threads;
+    }
+    else {
+        StepRange(0, count, scratch[0]);
+        stats.threads = 1;
+    }
+    stepBoxes = nullptr;
+
+    float ms = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+    stats.milliseconds += (ms - stats.milliseconds) * 0.05f;
+}
+
+void RigidBodyWorld::StepRange(size_t begin, size_t end, std::vector<PhysicsBox>& blockBoxes)
+{
+    const float dt = stepDt;
+    float* pos[3] = { posX.data(), posY.data(), posZ.data() };
+    float* vel[3] = { velX.data(), velY.data(), velZ.data() };
+    const float* half[3] = { halfX.data(), halfY.data(), halfZ.data() };
+
+    for (size_t k = begin; k < end; ++k) {
+        size_t i = awakeList[k];
+        vel[1][i] -= stepGravity * dt;
+
+        float longest = 0.0f;
+        for (int a = 0; a < 3; ++a) longest = (std::max)(longest, fabsf(vel[a][i] * dt));
+        int steps = (int)ceilf(longest / MAX_STEP_DISTANCE);
+        steps = (std::max)(1, (std::min)(steps, MAX_SUBSTEPS));
+        float subDt = dt / steps;
+
+        PhysicsBox box;
+        for (int a = 0; a < 3; ++a) {
+            box.min[a] = pos[a][i] - half[a][i];
+            box.max[a] = pos[a][i] + half[a][i];
+        }
+
+        // swept per axis like the player, but a hit bounces instead of stopping
+        bool grounded = false;
+        for (int step = 0; step < steps; ++step) {
+            float delta[3];
+            for (int a = 0; a < 3; ++a) delta[a] = vel[a][i] * subDt;
+
+            PhysicsBox region = box;
+            for (int a = 0; a < 3; ++a) {
+                if (delta[a] < 0.0f) region.min[a] += delta[a];
+                else region.max[a] += delta[a];
+            }
+            blockBoxes.clear();
+            (*stepBoxes)(region, blockBoxes);
+
+            static const int axes[3] = { 1, 0, 2 };
+            for (int a : axes) {
+                if (delta[a] == 0.0f) continue;
+                float moved = SweepAxis(box, a, delta[a], blockBoxes);
+                if (moved != delta[a]) {
+                    if (a == 1 && delta[a] < 0.0f) grounded = true;
+                    float bounced = -vel[a][i] * restitution[i];
+                    vel[a][i] = fabsf(bounced) < BOUNCE_MIN_SPEED ? 0.0f : bounced;
+                }
+                box.min[a] += moved;
+                box.max[a] += moved;
+            }
+        }
+        for (int a = 0; a < 3; ++a) pos[a][i] = box.min[a] + half[a][i];
+
+        // the floor plane at y = 0
+        if (box.min[1] <= 0.0f && vel[1][i] <= 0.0f) {
+            pos[1][i] = half[1][i];
+            float bounced = -vel[1][i] * restitution[i];
+            vel[1][i] = bounced < BOUNCE_MIN_SPEED ? 0.0f : bounced;
+            grounded = true;
+        }
+
+        if (!grounded) {
+            restTime[i] = 0.0f;
+            continue;
+        }
+        float slow = (std::max)(0.0f, 1.0f - friction[i] * dt);
+        vel[0][i] *= slow;
+        vel[2][i] *= slow;
+
+        float speedSq = vel[0][i] * vel[0][i] + vel[1][i] * vel[1][i] + vel[2][i] * vel[2][i];
+        if (speedSq >= SLEEP_SPEED * SLEEP_SPEED) {
+            restTime[i] = 0.0f;
+        }
+        else if ((restTime[i] += dt) >= SLEEP_TIME) {
+            awake[i] = 0;
+            vel[0][i] = vel[1][i] = vel[2][i] = 0.0f;
+        }
+    }
+}
+
+void RigidBodyWorld::Wake(size_t i)
+{
+    awake[i] = 1;
+    restTime[i] = 0.0f;
+}
+
+bool RigidBodyWorld::Touches(size_t i, const PhysicsBox& region) const
+{
+    return posX[i] - halfX[i] <= region.max[0] + TOUCH_EPSILON && posX[i] + halfX[i] >= region.min[0] - TOUCH_EPSILON &&
+        posY[i] - halfY[i] <= region.max[1] + TOUCH_EPSILON && posY[i] + halfY[i] >= region.min[1] - TOUCH_EPSILON &&
+        posZ[i] - halfZ[i] <= region.max[2] + TOUCH_EPSILON && posZ[i] + halfZ[i] >= region.min[2] - TOUCH_EPSILON;
+}
+
+void RigidBodyWorld::WakeInBox(const PhysicsBox& region)
+{
+    for (size_t i = 0; i < shape.size(); ++i) {
+        if (!awake[i] && Touches(i, region)) Wake(i);
+    }
+}
+
+void RigidBodyWorld::WakeAll()
+{
+    for (size_t i = 0; i < shape.size(); ++i) Wake(i);
+}
+
+void RigidBodyWorld::Push(const PhysicsBox& region, const float velocity[3])
+{
+    float centerX = (region.min[0] + region.max[0]) * 0.5f;
+    float centerZ = (region.min[2] + region.max[2]) * 0.5f;
+    for (size_t i = 0; i < shape.size(); ++i) {
+        if (!Touches(i, region)) continue;
+        // only away from the pusher, never pulled back toward it
+        bool pushed = false;
+        if ((velocity[0] > velX[i] && posX[i] > centerX) || (velocity[0] < velX[i] && posX[i] < centerX)) {
+            velX[i] = velocity[0];
+            pushed = true;
+        }
+        if ((velocity[2] > velZ[i] && posZ[i] > centerZ) || (velocity[2] < velZ[i] && posZ[i] < centerZ)) {
+            velZ[i] = velocity[2];
+            pushed = true;
+        }
+        if (pushed) Wake(i);
+    }
+}
+
+void RigidBodyWorld::CollectBoxes(const PhysicsBox& region, std::vector<PhysicsBox>& out) const
+{
+    for (size_t i = 0; i < shape.size(); ++i) {
+        if (posX[i] - halfX[i] > region.max[0] || posX[i] + halfX[i] < region.min[0] ||
+            posY[i] - halfY[i] > region.max[1] || posY[i] + halfY[i] < region.min[1] ||
+            posZ[i] - halfZ[i] > region.max[2] || posZ[i] + halfZ[i] < region.min[2]) {
+            continue;
+        }
+        out.push_back({
+            { posX[i] - halfX[i], posY[i] - halfY[i], posZ[i] - halfZ[i] },
+            { posX[i] + halfX[i], posY[i] + halfY[i], posZ[i] + halfZ[i] }
+            });
+    }
+}
@@ -0,0 +1,91 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "PlayerPhysics.h"
+#include "WorkerPool.h"
+
+struct RigidBodyStats {
+    size_t bodies = 0;
+    size_t awake = 0;
+    int threads = 1;            // that took part in the last step
+    float milliseconds = 0.0f;  // smoothed cost of one step
+};
+
+// Loose spheres and boxes (the parkour balls, dropped obstacles), free of
+// Windows and DirectX like PlayerPhysics. Each field is its own array so a
+// step streams through only what it touches. Bodies fall, bounce off and slide
+// along the map's blocks as their axis-aligned bounds, and don't collide with
+// each other, so the step is a loop over independent bodies that splits across
+// threads once there are enough of them. A body that has come to rest on the
+// ground sleeps and costs nothing until something wakes it.
+class RigidBodyWorld
+{
+public:
+    enum Shape : uint8_t { SPHERE, BOX };
+
+    RigidBodyWorld() = default;
+    RigidBodyWorld(const RigidBodyWorld&) = delete;
+    RigidBodyWorld& operator=(const RigidBodyWorld&) = delete;
+
+    size_t AddSphere(const float position[3], float radius, BlockId block);
+    size_t AddBox(const float position[3], const float halfExtents[3], BlockId block);
+    void Clear();
+
+    // One step of dt seconds (game time). boxes is called for each awake body,
+    // from several threads at once in the threaded mode, so it must only read.
+    void Step(float dt, float gravity, const PhysicsBoxSource& boxes);
+
+    // Something changed in region (a block removed, the map cleared): the
+    // bodies touching it may have lost their support.
+    void WakeInBox(const PhysicsBox& region);
+    void WakeAll();
+    // Wakes the bodies touching region and gives them at least velocity
+    // across it; the player walking into a ball rolls it along.
+    void Push(const PhysicsBox& region, const float velocity[3]);
+    // Appends the bounds of every body that touches region, to stand on.
+    void CollectBoxes(const PhysicsBox& region, std::vector<PhysicsBox>& out) const;
+
+    // Threads used once at least PARALLEL_MIN_BODIES are awake; 1 keeps every
+    // step on the calling thread.
+    void SetThreadCount(int count) { pool.SetThreadCount(count); }
+    int GetThreadCount() const { return pool.GetThreadCount(); }
+
+    size_t GetCount() const { return shape.size(); }
+    bool IsAwake(size_t i) const { return awake[i] != 0; }
+    void GetPosition(size_t i, float out[3]) const { out[0] = posX[i]; out[1] = posY[i]; out[2] = posZ[i]; }
+    void GetHalfExtents(size_t i, float out[3]) const { out[0] = halfX[i]; out[1] = halfY[i]; out[2] = halfZ[i]; }
+    BlockId GetBlock(size_t i) const { return block[i]; }
+    Shape GetShape(size_t i) const { return (Shape)shape[i]; }
+    const RigidBodyStats& GetStats() const { return stats; }
+
+    static const size_t PARALLEL_MIN_BODIES = 1024;
+
+private:
+    size_t Add(const float position[3], const float halfExtents[3], Shape kind,
+        float bounce, float drag, BlockId id);
+    void StepRange(size_t begin, size_t end, std::vector<PhysicsBox>& scratch);
+    void Wake(size_t i);
+    bool Touches(size_t i, const PhysicsBox& region) const;
+
+    std::vector<float> posX, posY, posZ;
+    std::vector<float> velX, velY, velZ;
+    std::vector<float> halfX, halfY, halfZ;
+    std::vector<float> restitution;   // share of the speed kept by a bounce
+    std::vector<float> friction;      // horizontal slowdown per second on the ground
+    std::vector<float> restTime;      // how long it has been almost still on the ground
+    std::vector<uint8_t> shape;
+    std::vector<uint8_t> awake;
+    std::vector<BlockId> block;
+
+    std::vector<uint32_t> awakeList;  // rebuilt each step, what the threads split
+    std::vector<std::vector<PhysicsBox>> scratch;  // broadphase output, one per thread
+    RigidBodyStats stats;
+
+    // the current step, read by every thread taking part
+    float stepDt = 0.0f;
+    float stepGravity = 0.0f;
+    const PhysicsBoxSource* stepBoxes = nullptr;
+
+    WorkerPool pool;
+};
@@ -10,6 +10,7 @@ struct Settings {
     float jumpVolume = 0.7f;
     bool fullscreen = false;
     int resolutionIndex = 2;
+    int maxFps = 0; // 0 = vsync only
 };
 
 extern Settings g_Settings;
@@ -30,7 +31,8 @@ inline void SaveSettings() {
         if (file.is_open()) {
             std::string data = std::to_string(g_Settings.jumpVolume) + ";" +
                 std::to_string(g_Settings.fullscreen ? 1 : 0) + ";" +
-                std::to_string(g_Settings.resolutionIndex);
+                std::to_string(g_Settings.resolutionIndex) + ";" +
+                std::to_string(g_Settings.maxFps);
             const char* key = "decodernax";
             XorCrypt(data, key, strlen(key));
             file.write(data.data(), data.size());
@@ -59,12 +61,17 @@ inline void LoadSettings() {
                     g_Settings.fullscreen = data.substr(pos, next - pos) == "1";
                     pos = next + 1;
                     g_Settings.resolutionIndex = std::stoi(data.substr(pos));
+                    next = data.find(';', pos);
+                    if (next != std::string::npos) {
+                        g_Settings.maxFps = std::stoi(data.substr(next + 1));
+                    }
                 }
             }
             if (g_Settings.jumpVolume < 0.0f) g_Settings.jumpVolume = 0.0f;
             if (g_Settings.jumpVolume > 1.0f) g_Settings.jumpVolume = 1.0f;
             if (g_Settings.resolutionIndex < 0 || g_Settings.resolutionIndex >= 5)
                 g_Settings.resolutionIndex = 2;
+            if (g_Settings.maxFps < 0) g_Settings.maxFps = 0;
         }
     }
 }
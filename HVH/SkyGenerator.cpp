@@ -0,0 +1,222 @@
+#include "SkyGenerator.h"
+#include "SkyShading.h"
+#include <algorithm>
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define SKYGEN_SSE2 1
+#endif
+
+namespace {
+
+    // direction = u * U + v * V + C per face, u and v in [-1, 1], v up
+    struct FaceBasis {
+        float u[3], v[3], c[3];
+    };
+    const FaceBasis FACES[6] = {
+        { {  0, 0, -1 }, { 0, 1,  0 }, {  1,  0,  0 } },  // +X
+        { {  0, 0,  1 }, { 0, 1,  0 }, { -1,  0,  0 } },  // -X
+        { {  1, 0,  0 }, { 0, 0, -1 }, {  0,  1,  0 } },  // +Y
+        { {  1, 0,  0 }, { 0, 0,  1 }, {  0, -1,  0 } },  // -Y
+        { {  1, 0,  0 }, { 0, 1,  0 }, {  0,  0,  1 } },  // +Z
+        { { -1, 0,  0 }, { 0, 1,  0 }, {  0,  0, -1 } },  // -Z
+    };
+
+    // SkyShading::SkyColor's constants, for the vector version of it below
+    const float HORIZON_POWER = 0.6f;
+    const float HAZE_FALLOFF = 3.5f;
+
+    uint8_t ToByte(float v)
+    {
+        return (uint8_t)(std::max)(0.0f, (std::min)(255.0f, v));
+    }
+
+#ifdef SKYGEN_SSE2
+    // 2^x for x in about [-126, 0]: integer part into the exponent bits, the
+    // fraction by a degree 5 polynomial (relative error below 2e-7)
+    __m128 Exp2(__m128 x)
+    {
+        x = _mm_max_ps(x, _mm_set1_ps(-126.0f));
+        __m128i whole = _mm_cvttps_epi32(x);
+        // truncation rounds toward zero; step down for the negative fractions
+        __m128 wholeF = _mm_cvtepi32_ps(whole);
+        __m128 below = _mm_cmpgt_ps(wholeF, x);
+        whole = _mm_add_epi32(whole, _mm_castps_si128(below));   // -1 where below
+        __m128 f = _mm_sub_ps(x, _mm_cvtepi32_ps(whole));        // [0, 1)
+
+        __m128 p = _mm_set1_ps(1.8775767e-3f);
+        p = _mm_add_ps(_mm_mul_ps(p, f), _mm_set1_ps(8.9893397e-3f));
+        p = _mm_add_ps(_mm_mul_ps(p, f), _mm_set1_ps(5.5826318e-2f));
+        p = _mm_add_ps(_mm_mul_ps(p, f), _mm_set1_ps(2.4015361e-1f));
+        p = _mm_add_ps(_mm_mul_ps(p, f), _mm_set1_ps(6.9315308e-1f));
+        p = _mm_add_ps(_mm_mul_ps(p, f), _mm_set1_ps(9.9999994e-1f));
+
+        __m128i bits = _mm_slli_epi32(_mm_add_epi32(whole, _mm_set1_epi32(127)), 23);
+        return _mm_mul_ps(p, _mm_castsi128_ps(bits));
+    }
+
+    // log2(x) for positive normal x: exponent bits plus a polynomial in the
+    // mantissa mapped to [sqrt(0.5), sqrt(2)) (absolute error below 1e-6)
+    __m128 Log2(__m128 x)
+    {
+        __m128i bits = _mm_castps_si128(x);
+        __m128i exponent = _mm_sub_epi32(_mm_srli_epi32(bits, 23), _mm_set1_epi32(127));
+        __m128 m = _mm_castsi128_ps(_mm_or_si128(_mm_and_si128(bits, _mm_set1_epi32(0x007FFFFF)),
+            _mm_set1_epi32(0x3F800000)));   // [1, 2)
+        __m128 big = _mm_cmpgt_ps(m, _mm_set1_ps(1.41421356f));
+        m = _mm_or_ps(_mm_and_ps(big, _mm_mul_ps(m, _mm_set1_ps(0.5f))), _mm_andnot_ps(big, m));
+        exponent = _mm_sub_epi32(exponent, _mm_castps_si128(big));   // +1 where halved
+
+        // log2(m) = 2 / ln 2 * atanh(s), s = (m - 1) / (m + 1), |s| < 0.172
+        __m128 s = _mm_div_ps(_mm_sub_ps(m, _mm_set1_ps(1.0f)), _mm_add_ps(m, _mm_set1_ps(1.0f)));
+        __m128 s2 = _mm_mul_ps(s, s);
+        __m128 p = _mm_set1_ps(1.0f / 9.0f);
+        p = _mm_add_ps(_mm_mul_ps(p, s2), _mm_set1_ps(1.0f / 7.0f));
+        p = _mm_add_ps(_mm_mul_ps(p, s2), _mm_set1_ps(1.0f / 5.0f));
+        p = _mm_add_ps(_mm_mul_ps(p, s2), _mm_set1_ps(1.0f / 3.0f));
+        p = _mm_add_ps(_mm_mul_ps(p, s2), _mm_set1_ps(1.0f));
+        __m128 log2m = _mm_mul_ps(_mm_mul_ps(p, s), _mm_set1_ps(2.8853900818f));
+        return _mm_add_ps(_mm_cvtepi32_ps(exponent), log2m);
+    }
+
+    // sin(x) for |x| up to a few hundred: reduced to [-pi, pi], folded onto
+    // [-pi/2, pi/2], then Taylor to x^9 (error below 4e-6)
+    __m128 Sin(__m128 x)
+    {
+        const __m128 twoPi = _mm_set1_ps(6.28318531f), pi = _mm_set1_ps(3.14159265f);
+        __m128 turns = _mm_cvtepi32_ps(_mm_cvtps_epi32(_mm_mul_ps(x, _mm_set1_ps(0.159154943f))));
+        x = _mm_sub_ps(x, _mm_mul_ps(turns, twoPi));
+
+        const __m128 signMask = _mm_set1_ps(-0.0f);
+        __m128 sign = _mm_and_ps(x, signMask);
+        __m128 ax = _mm_andnot_ps(signMask, x);
+        ax = _mm_min_ps(ax, _mm_sub_ps(pi, ax));   // sin(pi - a) = sin(a)
+        x = _mm_or_ps(ax, sign);
+
+        __m128 x2 = _mm_mul_ps(x, x);
+        __m128 p = _mm_set1_ps(1.0f / 362880.0f);
+        p = _mm_sub_ps(_mm_mul_ps(p, x2), _mm_set1_ps(1.0f / 5040.0f));
+        p = _mm_add_ps(_mm_mul_ps(p, x2), _mm_set1_ps(1.0f / 120.0f));
+        p = _mm_sub_ps(_mm_mul_ps(p, x2), _mm_set1_ps(1.0f / 6.0f));
+        p = _mm_add_ps(_mm_mul_ps(p, x2), _mm_set1_ps(1.0f));
+        return _mm_mul_ps(p, x);
+    }
+
+    __m128i ToBytes(__m128 v)
+    {
+        v = _mm_min_ps(_mm_max_ps(v, _mm_setzero_ps()), _mm_set1_ps(255.0f));
+        return _mm_cvttps_epi32(v);
+    }
+
+    // texels [0, count) with count a multiple of 4
+    void GenerateSkyRowSSE2(const SkyColors& colors, const FaceBasis& basis, float v, int size, int count, uint8_t* out)
+    {
+        const __m128 scale = _mm_set1_ps(2.0f / size);
+        const __m128 step = _mm_set1_ps(4.0f * 2.0f / size);
+        __m128 u = _mm_sub_ps(_mm_mul_ps(_mm_set_ps(3.5f, 2.5f, 1.5f, 0.5f), scale), _mm_set1_ps(1.0f));
+
+        __m128 base[3], du[3];
+        for (int a = 0; a < 3; ++a) {
+            base[a] = _mm_set1_ps(basis.v[a] * v + basis.c[a]);
+            du[a] = _mm_set1_ps(basis.u[a]);
+        }
+        const __m128 one = _mm_set1_ps(1.0f), half = _mm_set1_ps(0.5f);
+        const __m128 alpha = _mm_castsi128_ps(_mm_set1_epi32((int)0xFF000000));
+
+        for (int x = 0; x < count; x += 4, u = _mm_add_ps(u, step)) {
+            __m128 dx = _mm_add_ps(_mm_mul_ps(du[0], u), base[0]);
+            __m128 dy = _mm_add_ps(_mm_mul_ps(du[1], u), base[1]);
+            __m128 dz = _mm_add_ps(_mm_mul_ps(du[2], u), base[2]);
+            __m128 len = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz)));
+            __m128 nx = _mm_div_ps(dx, len), ny = _mm_div_ps(dy, len), nz = _mm_div_ps(dz, len);
+
+            __m128 t = _mm_add_ps(_mm_mul_ps(ny, half), half);
+            __m128 blend = Exp2(_mm_mul_ps(Log2(t), _mm_set1_ps(HORIZON_POWER)));
+            __m128 keep = _mm_sub_ps(one, blend);
+            __m128 absY = _mm_andnot_ps(_mm_set1_ps(-0.0f), ny);
+            __m128 haze = Exp2(_mm_mul_ps(absY, _mm_set1_ps(-HAZE_FALLOFF * 1.44269504f)));
+            __m128 ripple = Sin(_mm_mul_ps(_mm_add_ps(_mm_mul_ps(nx, _mm_set1_ps(10.0f)), _mm_mul_ps(nz, _mm_set1_ps(7.0f))),
+                _mm_set1_ps(0.3f)));
+            __m128 subtle = _mm_add_ps(half, _mm_mul_ps(half, ripple));
+            __m128 shade = _mm_mul_ps(_mm_add_ps(_mm_set1_ps(0.97f), _mm_mul_ps(_mm_set1_ps(0.03f), subtle)), _mm_set1_ps(255.0f));
+
+            __m128i channel[3];
+            for (int c = 0; c < 3; ++c) {
+                __m128 col = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(colors.horizon[c]), keep),
+                    _mm_mul_ps(_mm_set1_ps(colors.zenith[c]), blend));
+                col = _mm_add_ps(col, _mm_mul_ps(haze, _mm_set1_ps(colors.haze[c])));
+                channel[c] = ToBytes(_mm_mul_ps(col, shade));
+            }
+            __m128i rgba = _mm_or_si128(_mm_or_si128(channel[0], _mm_slli_epi32(channel[1], 8)),
+                _mm_or_si128(_mm_slli_epi32(channel[2], 16), _mm_castps_si128(alpha)));
+            _mm_storeu_si128((__m128i*)(out + x * 4), rgba);
+        }
+    }
+#endif
+
+    void GenerateSkyTexels(const SkyColors& colors, const FaceBasis& basis, float v, int size, int begin, int end, uint8_t* out)
+    {
+        using SkyShading::float3;
+        const float3 horizon = { colors.horizon[0], colors.horizon[1], colors.horizon[2] };
+        const float3 zenith = { colors.zenith[0], colors.zenith[1], colors.zenith[2] };
+        const float3 haze = { colors.haze[0], colors.haze[1], colors.haze[2] };
+        for (int x = begin; x < end; ++x) {
+            float u = (x + 0.5f) / size * 2.0f - 1.0f;
+            float3 dir = {
+                basis.u[0] * u + basis.v[0] * v + basis.c[0],
+                basis.u[1] * u + basis.v[1] * v + basis.c[1],
+                basis.u[2] * u + basis.v[2] * v + basis.c[2],
+            };
+            float3 color = SkyShading::SkyColor(dir, horizon, zenith, haze);
+
+            uint8_t* texel = out + x * 4;
+            texel[0] = ToByte(color.x * 255.0f);
+            texel[1] = ToByte(color.y * 255.0f);
+            texel[2] = ToByte(color.z * 255.0f);
+            texel[3] = 255;
+        }
+    }
+
+    float RowV(int y, int size)
+    {
+        return -((y + 0.5f) / size * 2.0f - 1.0f);
+    }
+}
+
+bool SkyColors::operator==(const SkyColors& other) const
+{
+    for (int c = 0; c < 3; ++c) {
+        if (horizon[c] != other.horizon[c] || zenith[c] != other.zenith[c] || haze[c] != other.haze[c]) return false;
+    }
+    return true;
+}
+
+void GenerateSkyRowReference(const SkyColors& colors, int face, int y, int size, uint8_t* out)
+{
+    GenerateSkyTexels(colors, FACES[face], RowV(y, size), size, 0, size, out);
+}
+
+void GenerateSkyRow(const SkyColors& colors, int face, int y, int size, uint8_t* out)
+{
+    int done = 0;
+#ifdef SKYGEN_SSE2
+    done = size & ~3;
+    GenerateSkyRowSSE2(colors, FACES[face], RowV(y, size), size, done, out);
+#endif
+    GenerateSkyTexels(colors, FACES[face], RowV(y, size), size, done, size, out);
+}
+
+void GenerateSky(const SkyColors& colors, int size, WorkerPool& pool, std::vector<uint8_t>& out)
+{
+    const size_t rowBytes = (size_t)size * 4;
+    const int rows = size * 6;
+    out.resize(rowBytes * rows);
+
+    // more threads than rows leaves some bands empty
+    pool.Run([&](int index, int bands) {
+        for (int row = rows * index / bands; row < rows * (index + 1) / bands; ++row) {
+            GenerateSkyRow(colors, row / size, row % size, size, out.data() + rowBytes * row);
+        }
+        });
+}
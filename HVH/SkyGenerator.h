@@ -0,0 +1,30 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+#include "WorkerPool.h"
+
+// The procedural sky cubemap, free of Windows and DirectX: a gradient from
+// the horizon color up to the zenith color, a haze band around the horizon
+// and a faint ripple. Faces are in D3D cube order (+X, -X, +Y, -Y, +Z, -Z),
+// each size x size RGBA8, rows top down.
+struct SkyColors {
+    float horizon[3];
+    float zenith[3];
+    float haze[3];
+
+    bool operator==(const SkyColors& other) const;
+    bool operator!=(const SkyColors& other) const { return !(*this == other); }
+};
+
+const int SKY_FACE_SIZE = 512;
+
+// One row of one face. Four texels at a time with SSE2 where the compiler has
+// it, using polynomial pow/exp/sin; those land within one step of the
+// reference per channel, which HVHTests holds it to.
+void GenerateSkyRow(const SkyColors& colors, int face, int y, int size, uint8_t* out);
+// SkyShading::SkyColor per texel, with the C library's powf/expf/sinf.
+void GenerateSkyRowReference(const SkyColors& colors, int face, int y, int size, uint8_t* out);
+
+// All six faces into out (6 * size * size * 4 bytes), the rows split into
+// one band per pool thread.
+void GenerateSky(const SkyColors& colors, int size, WorkerPool& pool, std::vector<uint8_t>& out);
@@ -0,0 +1,45 @@
+#pragma once
+#include <cmath>
+
+// The sky's color for a view direction: a gradient from the horizon color up
+// to the zenith color, a haze band around the horizon and a faint ripple.
+// SKY_SHADING's argument is compiled here as C++, with float3 and the HLSL
+// intrinsics it uses defined below, and is also kept as text in
+// SKY_SHADING_HLSL, which the analytic sky pixel shader is built from. The
+// baked cubemap and the shader can't drift apart; keep the code to what both
+// languages accept. HVHTests checks the function and the text on their own.
+#define SKY_SHADING(...) __VA_ARGS__ \
+    static const char* const SKY_SHADING_HLSL = #__VA_ARGS__;
+
+namespace SkyShading {
+
+    struct float3 {
+        float x, y, z;
+    };
+
+    inline float3 operator+(float3 a, float3 b) { return { a.x + b.x, a.y + b.y, a.z + b.z }; }
+    inline float3 operator*(float3 a, float s) { return { a.x * s, a.y * s, a.z * s }; }
+    inline float3& operator+=(float3& a, float3 b) { a = a + b; return a; }
+
+    inline float abs(float v) { return fabsf(v); }
+    inline float pow(float a, float b) { return powf(a, b); }
+    inline float exp(float v) { return expf(v); }
+    inline float sin(float v) { return sinf(v); }
+    inline float3 normalize(float3 v)
+    {
+        float len = sqrtf(v.x * v.x + v.y * v.y + v.z * v.z);
+        return { v.x / len, v.y / len, v.z / len };
+    }
+
+    SKY_SHADING(
+    inline float3 SkyColor(float3 dir, float3 horizon, float3 zenith, float3 haze)
+    {
+        float3 n = normalize(dir);
+        float blend = pow(n.y * 0.5f + 0.5f, 0.6f);
+        float3 color = horizon * (1.0f - blend) + zenith * blend;
+        color += haze * exp(-abs(n.y) * 3.5f);
+        float subtle = 0.5f + 0.5f * sin((n.x * 10.0f + n.z * 7.0f) * 0.3f);
+        return color * (0.97f + 0.03f * subtle);
+    }
+    )
+}
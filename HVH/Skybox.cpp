@@ -1,12 +1,29 @@
 ﻿#include "Skybox.h"
 #include <vector>
+#include <chrono>
+#include <thread>
+#include <string>
 #include <d3dcompiler.h>
 #include "SafeRelease.h"
+#include "SkyShading.h"
 
 #pragma comment(lib, "d3dcompiler.lib")
 
 using namespace DirectX;
 
+namespace {
+    SkyColors LerpColors(const SkyColors& a, const SkyColors& b, float t)
+    {
+        SkyColors result;
+        for (int i = 0; i < 3; ++i) {
+            result.horizon[i] = a.horizon[i] + t * (b.horizon[i] - a.horizon[i]);
+            result.zenith[i] = a.zenith[i] + t * (b.zenith[i] - a.zenith[i]);
+            result.haze[i] = a.haze[i] + t * (b.haze[i] - a.haze[i]);
+        }
+        return result;
+    }
+}
+
 Skybox::Skybox() {
 
 }
@@ -21,6 +38,7 @@ bool Skybox::Initialize(ID3D11Device* device, ID3D11DeviceContext* context)
     pDevice = device;
     pContext = context;
 
+    SetGeneratorThreads((int)std::thread::hardware_concurrency());
     if (!CreateCubeMesh()) return false;
     if (!CreateShaders()) return false;
     if (!CreateTexture()) return false;
@@ -31,27 +49,76 @@ bool Skybox::Initialize(ID3D11Device* device, ID3D11DeviceContext* context)
 void Skybox::SetHorizonColor(float r, float g, float b)
 {
     horizonColor = XMFLOAT3(r, g, b);
-    UpdateSkyTexture();
+    ColorsChanged();
 }
 
 void Skybox::SetZenithColor(float r, float g, float b)
 {
     zenithColor = XMFLOAT3(r, g, b);
-    UpdateSkyTexture();
+    ColorsChanged();
 }
 
 void Skybox::SetHazeColor(float r, float g, float b)
 {
     hazeColor = XMFLOAT3(r, g, b);
-    UpdateSkyTexture();
+    ColorsChanged();
+}
+
+void Skybox::SetColors(const XMFLOAT3& horizon, const XMFLOAT3& zenith, const XMFLOAT3& haze, bool fade)
+{
+    horizonColor = horizon;
+    zenithColor = zenith;
+    hazeColor = haze;
+    ColorsChanged(fade);
 }
 
 void Skybox::UpdateSkyTexture()
 {
-    SafeRelease(&pTextureSRV);
     CreateTexture();
 }
 
+void Skybox::ColorsChanged(bool fade)
+{
+    if (mode == Mode::Baked) {
+        UpdateSkyTexture();
+        return;
+    }
+    if (!fade) {
+        shownColors = CurrentColors();
+        fading = false;
+        paramsDirty = true;
+        return;
+    }
+    // analytic: nothing to bake, fade from whatever is on screen now
+    fadeFrom = shownColors;
+    fadeStart = -1.0f;
+    fading = true;
+}
+
+void Skybox::SetMode(Mode newMode)
+{
+    if (newMode == mode) return;
+    mode = newMode;
+    fading = false;
+    if (mode == Mode::Analytic) {
+        shownColors = CurrentColors();
+        paramsDirty = true;
+    }
+    else {
+        // colors may have changed while analytic, usually a cache hit
+        UpdateSkyTexture();
+    }
+}
+
+SkyColors Skybox::CurrentColors() const
+{
+    return {
+        { horizonColor.x, horizonColor.y, horizonColor.z },
+        { zenithColor.x, zenithColor.y, zenithColor.z },
+        { hazeColor.x, hazeColor.y, hazeColor.z },
+    };
+}
+
 bool Skybox::CreateCubeMesh()
 {
     struct SkyboxVertex {
@@ -172,6 +239,34 @@ bool Skybox::CreateShaders()
 
     hr = pDevice->CreatePixelShader(psBlob->GetBufferPointer(), psBlob->GetBufferSize(), nullptr, &pPixelShader);
     if (FAILED(hr)) { SafeRelease(&vsBlob); SafeRelease(&psBlob); return false; }
+    SafeRelease(&psBlob);
+
+    // the analytic sky, SkyColor's text is the same code SkyGenerator bakes with
+    std::string analyticSource = R"(
+    cbuffer SkyParams : register(b0) {
+        float3 Horizon;
+        float3 Zenith;
+        float3 Haze;
+    }
+    )";
+    analyticSource += SkyShading::SKY_SHADING_HLSL;
+    analyticSource += R"(
+    float4 main(float4 position : SV_POSITION, float3 texCoord : TEXCOORD0) : SV_Target {
+        return float4(saturate(SkyColor(texCoord, Horizon, Zenith, Haze)), 1.0);
+    }
+)";
+
+    hr = D3DCompile(analyticSource.c_str(), analyticSource.size(), nullptr, nullptr, nullptr,
+        "main", "ps_5_0", 0, 0, &psBlob, &errorBlob);
+    if (FAILED(hr)) {
+        if (errorBlob) OutputDebugStringA((char*)errorBlob->GetBufferPointer());
+        SafeRelease(&errorBlob);
+        SafeRelease(&vsBlob);
+        return false;
+    }
+
+    hr = pDevice->CreatePixelShader(psBlob->GetBufferPointer(), psBlob->GetBufferSize(), nullptr, &pAnalyticPS);
+    if (FAILED(hr)) { SafeRelease(&vsBlob); SafeRelease(&psBlob); return false; }
 
     D3D11_INPUT_ELEMENT_DESC layout[] = {
         {"POSITION", 0, DXGI_FORMAT_R32G32B32_FLOAT, 0, 0, D3D11_INPUT_PER_VERTEX_DATA, 0}
@@ -193,6 +288,10 @@ bool Skybox::CreateShaders()
     hr = pDevice->CreateBuffer(&cbDesc, nullptr, &pConstantBuffer);
     if (FAILED(hr)) return false;
 
+    cbDesc.ByteWidth = sizeof(SkyParams);
+    hr = pDevice->CreateBuffer(&cbDesc, nullptr, &pParamsCB);
+    if (FAILED(hr)) return false;
+
     D3D11_DEPTH_STENCIL_DESC depthDesc = {};
     depthDesc.DepthEnable = true;
     depthDesc.DepthWriteMask = D3D11_DEPTH_WRITE_MASK_ZERO;
@@ -214,76 +313,35 @@ bool Skybox::CreateShaders()
     rasterDesc.AntialiasedLineEnable = false;
 
     hr = pDevice->CreateRasterizerState(&rasterDesc, &pRasterState);
+    if (FAILED(hr)) return false;
+
+    D3D11_SAMPLER_DESC sampDesc = {};
+    sampDesc.Filter = D3D11_FILTER_MIN_MAG_MIP_LINEAR;
+    sampDesc.AddressU = D3D11_TEXTURE_ADDRESS_CLAMP;
+    sampDesc.AddressV = D3D11_TEXTURE_ADDRESS_CLAMP;
+    sampDesc.AddressW = D3D11_TEXTURE_ADDRESS_CLAMP;
 
+    hr = pDevice->CreateSamplerState(&sampDesc, &pSampler);
     return SUCCEEDED(hr);
 }
 
 bool Skybox::CreateTexture()
 {
-    using namespace DirectX;
-    const int TEXTURE_SIZE = 512;
-    std::vector<BYTE> textureData(TEXTURE_SIZE * TEXTURE_SIZE * 6 * 4);
-
-    auto TexelToDir = [&](int face, float u, float v) -> XMFLOAT3 {
-        switch (face)
-        {
-        case 0: return XMFLOAT3(1.0f, v, -u);   // +X
-        case 1: return XMFLOAT3(-1.0f, v, u);   // -X
-        case 2: return XMFLOAT3(u, 1.0f, -v);   // +Y
-        case 3: return XMFLOAT3(u, -1.0f, v);   // -Y
-        case 4: return XMFLOAT3(u, v, 1.0f);    // +Z
-        case 5: return XMFLOAT3(-u, v, -1.0f);  // -Z
-        default: return XMFLOAT3(0, 0, 1);
-        }
-        };
-
-    for (int face = 0; face < 6; ++face)
-    {
-        for (int y = 0; y < TEXTURE_SIZE; ++y)
-        {
-            for (int x = 0; x < TEXTURE_SIZE; ++x)
-            {
-                int idx = ((face * TEXTURE_SIZE + y) * TEXTURE_SIZE + x) * 4;
-                float u = (x + 0.5f) / TEXTURE_SIZE * 2.0f - 1.0f;
-                float v = (y + 0.5f) / TEXTURE_SIZE * 2.0f - 1.0f;
-                v = -v;
-
-                XMFLOAT3 dir = TexelToDir(face, u, v);
-                XMVECTOR d = XMVector3Normalize(XMLoadFloat3(&dir));
-                XMFLOAT3 n;
-                XMStoreFloat3(&n, d);
-
-                float t = n.y * 0.5f + 0.5f;
-                float horizonBlend = powf(t, 0.6f);
-
-                float r = horizonColor.x * (1.0f - horizonBlend) + zenithColor.x * horizonBlend;
-                float g = horizonColor.y * (1.0f - horizonBlend) + zenithColor.y * horizonBlend;
-                float b = horizonColor.z * (1.0f - horizonBlend) + zenithColor.z * horizonBlend;
-
-                float haze = expf(-fabsf(n.y) * 3.5f);
-                r += haze * hazeColor.x;
-                g += haze * hazeColor.y;
-                b += haze * hazeColor.z;
-
-                float subtle = 0.5f + 0.5f * sinf((n.x * 10.0f + n.z * 7.0f) * 0.3f);
-                r *= 0.97f + 0.03f * subtle;
-                g *= 0.97f + 0.03f * subtle;
-                b *= 0.97f + 0.03f * subtle;
-
-                auto clampByte = [](float v)->BYTE {
-#undef max
-#undef min
-                    return static_cast<BYTE>(std::max(0.0f, std::min(255.0f, v)));
-                    };
-
-                textureData[idx + 0] = clampByte(r * 255.0f);
-                textureData[idx + 1] = clampByte(g * 255.0f);
-                textureData[idx + 2] = clampByte(b * 255.0f);
-                textureData[idx + 3] = 255;
-            }
+    SkyColors colors = CurrentColors();
+    for (CachedSky& entry : skyCache) {
+        if (entry.colors == colors) {
+            entry.lastUsed = ++skyCacheClock;
+            pTextureSRV = entry.srv;
+            lastGenerateMs = 0.0f;
+            return true;
         }
     }
 
+    auto start = std::chrono::steady_clock::now();
+    const int TEXTURE_SIZE = SKY_FACE_SIZE;
+    std::vector<uint8_t> textureData;
+    GenerateSky(colors, TEXTURE_SIZE, generatorPool, textureData);
+
     D3D11_TEXTURE2D_DESC texDesc = {};
     texDesc.Width = TEXTURE_SIZE;
     texDesc.Height = TEXTURE_SIZE;
@@ -313,22 +371,57 @@ bool Skybox::CreateTexture()
     srvDesc.TextureCube.MostDetailedMip = 0;
     srvDesc.TextureCube.MipLevels = 1;
 
-    hr = pDevice->CreateShaderResourceView(pTexture, &srvDesc, &pTextureSRV);
+    ID3D11ShaderResourceView* srv = nullptr;
+    hr = pDevice->CreateShaderResourceView(pTexture, &srvDesc, &srv);
     SafeRelease(&pTexture);
     if (FAILED(hr)) return false;
 
-    D3D11_SAMPLER_DESC sampDesc = {};
-    sampDesc.Filter = D3D11_FILTER_MIN_MAG_MIP_LINEAR;
-    sampDesc.AddressU = D3D11_TEXTURE_ADDRESS_CLAMP;
-    sampDesc.AddressV = D3D11_TEXTURE_ADDRESS_CLAMP;
-    sampDesc.AddressW = D3D11_TEXTURE_ADDRESS_CLAMP;
+    // full: drop the one unused the longest, never the one on screen
+    if (skyCache.size() >= SKY_CACHE_SIZE) {
+        size_t oldest = 0;
+        for (size_t i = 1; i < skyCache.size(); ++i) {
+            if (skyCache[i].lastUsed < skyCache[oldest].lastUsed) oldest = i;
+        }
+        SafeRelease(&skyCache[oldest].srv);
+        skyCache.erase(skyCache.begin() + oldest);
+    }
+    skyCache.push_back({ colors, srv, ++skyCacheClock });
+    pTextureSRV = srv;
 
-    hr = pDevice->CreateSamplerState(&sampDesc, &pSampler);
-    return SUCCEEDED(hr);
+    lastGenerateMs = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+    return true;
 }
 
-void Skybox::Render(ID3D11DeviceContext* context, const XMMATRIX& view, const XMMATRIX& projection)
+void Skybox::UpdateParams(ID3D11DeviceContext* context, float time)
 {
+    if (fading) {
+        if (fadeStart < 0.0f) fadeStart = time;
+        float t = fadeSeconds > 0.0f ? (time - fadeStart) / fadeSeconds : 1.0f;
+        if (t >= 1.0f) {
+            t = 1.0f;
+            fading = false;
+        }
+        shownColors = LerpColors(fadeFrom, CurrentColors(), clamp(t, 0.0f, 1.0f));
+        paramsDirty = true;
+    }
+    // steady colors leave the buffer alone
+    if (!paramsDirty) return;
+
+    D3D11_MAPPED_SUBRESOURCE mapped;
+    if (FAILED(context->Map(pParamsCB, 0, D3D11_MAP_WRITE_DISCARD, 0, &mapped))) return;
+    SkyParams* params = (SkyParams*)mapped.pData;
+    params->horizon = XMFLOAT3(shownColors.horizon);
+    params->zenith = XMFLOAT3(shownColors.zenith);
+    params->haze = XMFLOAT3(shownColors.haze);
+    params->pad0 = params->pad1 = params->pad2 = 0.0f;
+    context->Unmap(pParamsCB, 0);
+    paramsDirty = false;
+}
+
+void Skybox::Render(ID3D11DeviceContext* context, const XMMATRIX& view, const XMMATRIX& projection, float time)
+{
+    if (mode == Mode::Analytic) UpdateParams(context, time);
+
     ID3D11RasterizerState* oldRasterState = nullptr;
     context->RSGetState(&oldRasterState);
     if (pRasterState) {
@@ -364,9 +457,15 @@ void Skybox::Render(ID3D11DeviceContext* context, const XMMATRIX& view, const XM
     context->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
     context->VSSetShader(pVertexShader, nullptr, 0);
     context->VSSetConstantBuffers(0, 1, &pConstantBuffer);
-    context->PSSetShader(pPixelShader, nullptr, 0);
-    context->PSSetShaderResources(0, 1, &pTextureSRV);
-    context->PSSetSamplers(0, 1, &pSampler);
+    if (mode == Mode::Analytic) {
+        context->PSSetShader(pAnalyticPS, nullptr, 0);
+        context->PSSetConstantBuffers(0, 1, &pParamsCB);
+    }
+    else {
+        context->PSSetShader(pPixelShader, nullptr, 0);
+        context->PSSetShaderResources(0, 1, &pTextureSRV);
+        context->PSSetSamplers(0, 1, &pSampler);
+    }
 
     context->DrawIndexed(indexCount, 0, 0);
 
@@ -385,10 +484,14 @@ void Skybox::Cleanup()
     SafeRelease(&pIndexBuffer);
     SafeRelease(&pVertexShader);
     SafeRelease(&pPixelShader);
+    SafeRelease(&pAnalyticPS);
     SafeRelease(&pInputLayout);
-    SafeRelease(&pTextureSRV);
+    for (CachedSky& entry : skyCache) SafeRelease(&entry.srv);
+    skyCache.clear();
+    pTextureSRV = nullptr;
     SafeRelease(&pSampler);
     SafeRelease(&pConstantBuffer);
+    SafeRelease(&pParamsCB);
     SafeRelease(&pDepthState);
     SafeRelease(&pRasterState);
 }
@@ -3,6 +3,8 @@
 #pragma once
 #include <d3d11.h>
 #include <DirectXMath.h>
+#include <vector>
+#include "SkyGenerator.h"
 
 #define M_PI 3.14159265358
 
@@ -11,22 +13,50 @@ using namespace DirectX;
 class Skybox
 {
 public:
+    // Baked samples a cubemap generated on the CPU (SkyGenerator). Analytic
+    // runs SkyShading::SkyColor in the pixel shader from a small constant
+    // buffer, so new colors are a buffer write and can fade in over time.
+    enum class Mode { Baked, Analytic };
+
     Skybox();
     ~Skybox();
 
     bool Initialize(ID3D11Device* device, ID3D11DeviceContext* context);
-    void Render(ID3D11DeviceContext* context, const DirectX::XMMATRIX& view, const DirectX::XMMATRIX& projection);
+    // time in seconds, drives the analytic fades
+    void Render(ID3D11DeviceContext* context, const DirectX::XMMATRIX& view, const DirectX::XMMATRIX& projection, float time);
     void Cleanup();
 
     void SetHorizonColor(float r, float g, float b);
     void SetZenithColor(float r, float g, float b);
     void SetHazeColor(float r, float g, float b);
+    // all three at once, one texture update instead of three. fade = false
+    // skips the analytic fade, for callers that blend the colors themselves
+    void SetColors(const DirectX::XMFLOAT3& horizon, const DirectX::XMFLOAT3& zenith, const DirectX::XMFLOAT3& haze, bool fade = true);
     void UpdateSkyTexture();
 
+    void SetMode(Mode newMode);
+    Mode GetMode() const { return mode; }
+    // how long the analytic sky takes to blend to new colors, 0 = at once
+    void SetFadeTime(float seconds) { fadeSeconds = seconds < 0.0f ? 0.0f : seconds; }
+    float GetFadeTime() const { return fadeSeconds; }
+
+    void SetGeneratorThreads(int count) { generatorPool.SetThreadCount(count); }
+    int GetGeneratorThreads() const { return generatorPool.GetThreadCount(); }
+    WorkerPool& GetGeneratorPool() { return generatorPool; }
+    float GetLastGenerateMs() const { return lastGenerateMs; }
+    size_t GetCachedCount() const { return skyCache.size(); }
+
+    // cubemaps kept for the last few color sets, so going back to a preset
+    // is a lookup instead of a regeneration
+    static const size_t SKY_CACHE_SIZE = 8;
+
 private:
     bool CreateCubeMesh();
     bool CreateShaders();
     bool CreateTexture();
+    SkyColors CurrentColors() const;
+    void ColorsChanged(bool fade = true);
+    void UpdateParams(ID3D11DeviceContext* context, float time);
 
     float lerp(float a, float b, float t) {
         return a + t * (b - a);
@@ -45,8 +75,10 @@ private:
     ID3D11Buffer* pIndexBuffer = nullptr;
     ID3D11VertexShader* pVertexShader = nullptr;
     ID3D11PixelShader* pPixelShader = nullptr;
+    ID3D11PixelShader* pAnalyticPS = nullptr;
+    ID3D11Buffer* pParamsCB = nullptr;          // SkyParams, analytic PS only
     ID3D11InputLayout* pInputLayout = nullptr;
-    ID3D11ShaderResourceView* pTextureSRV = nullptr;
+    ID3D11ShaderResourceView* pTextureSRV = nullptr;   // one of skyCache's, not owned
     ID3D11SamplerState* pSampler = nullptr;
     ID3D11Buffer* pConstantBuffer = nullptr;
     ID3D11DepthStencilState* pDepthState = nullptr;
@@ -54,6 +86,29 @@ private:
 
     UINT indexCount = 0;
 
+    struct CachedSky {
+        SkyColors colors;
+        ID3D11ShaderResourceView* srv;
+        uint64_t lastUsed;
+    };
+    std::vector<CachedSky> skyCache;
+    uint64_t skyCacheClock = 0;
+    WorkerPool generatorPool;      // kept between bakes, the threads sleep in between
+    float lastGenerateMs = 0.0f;   // 0 when the last update came from the cache
+
+    struct SkyParams {
+        DirectX::XMFLOAT3 horizon; float pad0;
+        DirectX::XMFLOAT3 zenith;  float pad1;
+        DirectX::XMFLOAT3 haze;    float pad2;
+    };
+    Mode mode = Mode::Baked;
+    SkyColors shownColors = {};    // what the analytic sky drew last
+    SkyColors fadeFrom = {};
+    float fadeSeconds = 2.0f;
+    float fadeStart = -1.0f;       // < 0: the fade starts on the next Render
+    bool fading = false;
+    bool paramsDirty = true;
+
     // color param sky
     DirectX::XMFLOAT3 horizonColor = { 0.7f, 0.8f, 0.9f };
     DirectX::XMFLOAT3 zenithColor = { 0.1f, 0.2f, 0.4f };
@@ -0,0 +1,74 @@
+#pragma once
+#include <cstddef>
+
+// The socket calls NetworkManager needs, on Winsock or on BSD sockets, so the
+// networking builds for the dedicated server on Linux as well.
+#ifdef _WIN32
+
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#include <windows.h>
+
+#pragma comment(lib, "ws2_32.lib")
+
+typedef WSAPOLLFD SocketPollFd;
+const int SOCKET_SEND_FLAGS = 0;
+
+// 0 on success, the WSAStartup error otherwise
+inline int SocketStartup()
+{
+    WSADATA wsaData;
+    return WSAStartup(MAKEWORD(2, 2), &wsaData);
+}
+
+inline void SocketSetNonBlocking(SOCKET socket)
+{
+    u_long nonBlocking = 1;
+    ioctlsocket(socket, FIONBIO, &nonBlocking);
+}
+
+inline int SocketPoll(SocketPollFd* fds, size_t count, int timeoutMs)
+{
+    return WSAPoll(fds, (ULONG)count, timeoutMs);
+}
+
+inline bool SocketWouldBlock() { return WSAGetLastError() == WSAEWOULDBLOCK; }
+
+#else
+
+#include <arpa/inet.h>
+#include <cerrno>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+typedef int SOCKET;
+typedef pollfd SocketPollFd;
+const SOCKET INVALID_SOCKET = -1;
+const int SOCKET_ERROR = -1;
+// a peer that went away is a send error, not a SIGPIPE
+const int SOCKET_SEND_FLAGS = MSG_NOSIGNAL;
+
+inline int SocketStartup() { return 0; }
+
+inline void SocketSetNonBlocking(SOCKET socket)
+{
+    fcntl(socket, F_SETFL, fcntl(socket, F_GETFL, 0) | O_NONBLOCK);
+}
+
+inline int SocketPoll(SocketPollFd* fds, size_t count, int timeoutMs)
+{
+    return poll(fds, (nfds_t)count, timeoutMs);
+}
+
+inline bool SocketWouldBlock() { return errno == EWOULDBLOCK || errno == EAGAIN; }
+
+inline int closesocket(SOCKET socket) { return close(socket); }
+
+#endif
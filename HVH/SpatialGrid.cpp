@@ -0,0 +1,106 @@
+#include "SpatialGrid.h"
+#include <cmath>
+#include <algorithm>
+
+SpatialGrid::SpatialGrid(float cellSize)
+    : cellSize(cellSize),
+    invCellSize(1.0f / cellSize)
+{
+}
+
+int SpatialGrid::CellCoord(float v) const
+{
+    return (int)floorf(v * invCellSize);
+}
+
+int64_t SpatialGrid::MakeKey(int cx, int cy, int cz)
+{
+    // 21 bits per axis is +-1M cells, far beyond any map we load
+    const int64_t mask = (1 << 21) - 1;
+    return ((int64_t)(cx & mask) << 42) | ((int64_t)(cy & mask) << 21) | (int64_t)(cz & mask);
+}
+
+void SpatialGrid::Insert(uint32_t id, float x, float y, float z, float halfExtent)
+{
+    cells[MakeKey(CellCoord(x), CellCoord(y), CellCoord(z))].push_back({ id, halfExtent });
+    extentCounts[halfExtent]++;
+    if (halfExtent > maxHalfExtent) maxHalfExtent = halfExtent;
+    objectCount++;
+}
+
+bool SpatialGrid::Remove(uint32_t id, float x, float y, float z)
+{
+    auto it = cells.find(MakeKey(CellCoord(x), CellCoord(y), CellCoord(z)));
+    if (it == cells.end()) return false;
+
+    std::vector<Entry>& entries = it->second;
+    for (size_t i = 0; i < entries.size(); ++i) {
+        if (entries[i].id == id) {
+            auto count = extentCounts.find(entries[i].halfExtent);
+            if (count != extentCounts.end() && --count->second == 0) {
+                extentCounts.erase(count);
+                maxHalfExtent = extentCounts.empty() ? 0.0f : extentCounts.rbegin()->first;
+            }
+            entries[i] = entries.back();
+            entries.pop_back();
+            if (entries.empty()) cells.erase(it);
+            objectCount--;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool SpatialGrid::Renumber(uint32_t oldId, uint32_t newId, float x, float y, float z)
+{
+    auto it = cells.find(MakeKey(CellCoord(x), CellCoord(y), CellCoord(z)));
+    if (it == cells.end()) return false;
+
+    for (Entry& entry : it->second) {
+        if (entry.id == oldId) {
+            entry.id = newId;
+            return true;
+        }
+    }
+    return false;
+}
+
+void SpatialGrid::Clear()
+{
+    cells.clear();
+    extentCounts.clear();
+    maxHalfExtent = 0.0f;
+    objectCount = 0;
+}
+
+void SpatialGrid::QueryBox(float minX, float minY, float minZ,
+    float maxX, float maxY, float maxZ, std::vector<uint32_t>& out) const
+{
+    if (cells.empty()) return;
+
+    int x0 = CellCoord(minX - maxHalfExtent), x1 = CellCoord(maxX + maxHalfExtent);
+    int y0 = CellCoord(minY - maxHalfExtent), y1 = CellCoord(maxY + maxHalfExtent);
+    int z0 = CellCoord(minZ - maxHalfExtent), z1 = CellCoord(maxZ + maxHalfExtent);
+
+    for (int cx = x0; cx <= x1; ++cx) {
+        for (int cy = y0; cy <= y1; ++cy) {
+            for (int cz = z0; cz <= z1; ++cz) {
+                auto it = cells.find(MakeKey(cx, cy, cz));
+                if (it != cells.end()) {
+                    for (const Entry& entry : it->second) out.push_back(entry.id);
+                }
+            }
+        }
+    }
+}
+
+void SpatialGrid::QuerySegment(float ox, float oy, float oz,
+    float dx, float dy, float dz, float length, std::vector<uint32_t>& out) const
+{
+    float ex = ox + dx * length;
+    float ey = oy + dy * length;
+    float ez = oz + dz * length;
+
+    QueryBox(std::min(ox, ex), std::min(oy, ey), std::min(oz, ez),
+        std::max(ox, ex), std::max(oy, ey), std::max(oz, ez), out);
+}
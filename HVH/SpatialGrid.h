@@ -0,0 +1,55 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <map>
+#include <vector>
+#include <unordered_map>
+
+// Uniform hash grid over map objects, keyed by integer cell.
+// Every object is filed under the cell that holds its center; queries are
+// widened by the largest half extent currently in the grid so objects that
+// straddle a cell border are still returned. Removing the largest object
+// shrinks the widening again.
+class SpatialGrid
+{
+public:
+    explicit SpatialGrid(float cellSize = 4.0f);
+
+    void Insert(uint32_t id, float x, float y, float z, float halfExtent);
+    bool Remove(uint32_t id, float x, float y, float z);
+    // Renumber an object in place (used when the owning vector swap-removes).
+    bool Renumber(uint32_t oldId, uint32_t newId, float x, float y, float z);
+    void Clear();
+
+    // Appends the ids of every object whose cell may overlap the box.
+    void QueryBox(float minX, float minY, float minZ,
+        float maxX, float maxY, float maxZ, std::vector<uint32_t>& out) const;
+
+    // Appends the ids of every object whose cell may overlap the segment
+    // origin + dir * [0, length].
+    void QuerySegment(float ox, float oy, float oz,
+        float dx, float dy, float dz, float length, std::vector<uint32_t>& out) const;
+
+    size_t GetCellCount() const { return cells.size(); }
+    size_t GetObjectCount() const { return objectCount; }
+    float GetCellSize() const { return cellSize; }
+    float GetMaxHalfExtent() const { return maxHalfExtent; }
+
+private:
+    int CellCoord(float v) const;
+    static int64_t MakeKey(int cx, int cy, int cz);
+
+    float cellSize;
+    float invCellSize;
+    struct Entry {
+        uint32_t id;
+        float halfExtent;
+    };
+
+    float maxHalfExtent = 0.0f;
+    size_t objectCount = 0;
+    // objects per half extent, so a removal knows the next largest
+    std::map<float, size_t> extentCounts;
+
+    std::unordered_map<int64_t, std::vector<Entry>> cells;
+};
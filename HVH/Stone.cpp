@@ -1,2632 +0,0 @@
-#include "GameEngine.h"
-
-//H V H   T E X T U R E   D A T A
-//================================
-//Generated by HVH Texture Editor v1.0
-#include <vector>
-bool GameEngine::CreateStoneTextureSRV(UINT size, ID3D11ShaderResourceView** outSRV) {
-    static ID3D11ShaderResourceView* cachedSRV = nullptr;
-    if (cachedSRV) {
-        *outSRV = cachedSRV;
-        return true;
-    }
-
-    if (size != 64) return false;
-
-    static const struct PixelSegment {
-        BYTE r, g, b, a;
-        int count;
-    } segments[] = {
-        {179, 179, 179, 84, 1},
-        {193, 193, 193, 146, 1},
-        {179, 179, 179, 146, 13},
-        {185, 185, 185, 146, 1},
-        {134, 134, 134, 146, 1},
-        {96, 96, 96, 146, 1},
-        {103, 103, 103, 146, 5},
-        {106, 106, 106, 146, 1},
-        {62, 62, 62, 146, 1},
-        {26, 26, 26, 146, 1},
-        {33, 33, 33, 146, 9},
-        {20, 20, 20, 146, 1},
-        {117, 117, 117, 146, 1},
-        {192, 192, 192, 146, 1},
-        {179, 179, 179, 146, 9},
-        {185, 185, 185, 146, 1},
-        {134, 134, 134, 146, 1},
-        {96, 96, 96, 146, 1},
-        {103, 103, 103, 146, 1},
-        {106, 106, 106, 146, 1},
-        {62, 62, 62, 146, 1},
-        {27, 27, 27, 146, 1},
-        {33, 33, 33, 146, 1},
-        {22, 22, 22, 146, 1},
-        {117, 117, 117, 146, 1},
-        {192, 192, 192, 146, 1},
-        {179, 179, 179, 146, 1},
-        {185, 185, 185, 146, 1},
-        {134, 134, 134, 146, 1},
-        {96, 96, 96, 146, 1},
-        {103, 103, 103, 146, 1},
-        {110, 110, 110, 146, 1},
-        {179, 179, 179, 158, 1},
-        {209, 209, 209, 255, 1},
-        {193, 193, 193, 255, 13},
-        {200, 200, 200, 255, 1},
-        {146, 146, 146, 255, 1},
-        {104, 104, 104, 255, 1},
-        {110, 110, 110, 255, 5},
-        {116, 116, 116, 255, 1},
-        {68, 68, 68, 255, 1},
-        {29, 29, 29, 255, 1},
-        {36, 36, 36, 255, 9},
-        {23, 23, 23, 255, 1},
-        {126, 126, 126, 255, 1},
-        {206, 206, 206, 255, 1},
-        {193, 193, 193, 255, 9},
-        {200, 200, 200, 255, 1},
-        {146, 146, 146, 255, 1},
-        {104, 104, 104, 255, 1},
-        {110, 110, 110, 255, 1},
-        {116, 116, 116, 255, 1},
-        {68, 68, 68, 255, 1},
-        {30, 30, 30, 255, 1},
-        {36, 36, 36, 255, 1},
-        {24, 24, 24, 255, 1},
-        {125, 125, 125, 255, 1},
-        {206, 206, 206, 255, 1},
-        {193, 193, 193, 255, 1},
-        {200, 200, 200, 255, 1},
-        {146, 146, 146, 255, 1},
-        {104, 104, 104, 255, 1},
-        {110, 110, 110, 255, 1},
-        {119, 119, 119, 255, 1},
-        {179, 179, 179, 146, 1},
-        {193, 193, 193, 255, 1},
-        {179, 179, 179, 255, 13},
-        {185, 185, 185, 255, 1},
-        {135, 135, 135, 255, 1},
-        {96, 96, 96, 255, 1},
-        {102, 102, 102, 255, 5},
-        {107, 107, 107, 255, 1},
-        {63, 63, 63, 255, 1},
-        {27, 27, 27, 255, 1},
-        {33, 33, 33, 255, 9},
-        {21, 21, 21, 255, 1},
-        {117, 117, 117, 255, 1},
-        {191, 191, 191, 255, 1},
-        {179, 179, 179, 255, 9},
-        {185, 185, 185, 255, 1},
-        {135, 135, 135, 255, 1},
-        {96, 96, 96, 255, 1},
-        {102, 102, 102, 255, 1},
-        {107, 107, 107, 255, 1},
-        {63, 63, 63, 255, 1},
-        {28, 28, 28, 255, 1},
-        {33, 33, 33, 255, 1},
-        {22, 22, 22, 255, 1},
-        {116, 116, 116, 255, 1},
-        {191, 191, 191, 255, 1},
-        {179, 179, 179, 255, 1},
-        {185, 185, 185, 255, 1},
-        {135, 135, 135, 255, 1},
-        {96, 96, 96, 255, 1},
-        {102, 102, 102, 255, 1},
-        {110, 110, 110, 255, 1},
-        {179, 179, 179, 146, 1},
-        {193, 193, 193, 255, 1},
-        {179, 179, 179, 255, 6},
-        {182, 182, 182, 255, 1},
-        {186, 186, 186, 255, 1},
-        {185, 185, 185, 255, 5},
-        {191, 191, 191, 255, 1},
-        {142, 142, 142, 255, 1},
-        {104, 104, 104, 255, 1},
-        {110, 110, 110, 255, 2},
-        {109, 109, 109, 255, 1},
-        {107, 107, 107, 255, 2},
-        {114, 114, 114, 255, 1},
-        {59, 59, 59, 255, 1},
-        {14, 14, 14, 255, 1},
-        {21, 21, 21, 255, 5},
-        {20, 20, 20, 255, 1},
-        {28, 28, 28, 255, 1},
-        {34, 34, 34, 255, 1},
-        {33, 33, 33, 255, 1},
-        {20, 20, 20, 255, 1},
-        {121, 121, 121, 255, 1},
-        {198, 198, 198, 255, 1},
-        {185, 185, 185, 255, 9},
-        {192, 192, 192, 255, 1},
-        {138, 138, 138, 255, 1},
-        {96, 96, 96, 255, 1},
-        {102, 102, 102, 255, 1},
-        {107, 107, 107, 255, 1},
-        {65, 65, 65, 255, 1},
-        {30, 30, 30, 255, 1},
-        {36, 36, 36, 255, 1},
-        {24, 24, 24, 255, 1},
-        {121, 121, 121, 255, 1},
-        {197, 197, 197, 255, 1},
-        {185, 185, 185, 255, 1},
-        {192, 192, 192, 255, 1},
-        {138, 138, 138, 255, 1},
-        {96, 96, 96, 255, 1},
-        {102, 102, 102, 255, 1},
-        {110, 110, 110, 255, 1},
-        {179, 179, 179, 146, 1},
-        {193, 193, 193, 255, 1},
-        {179, 179, 179, 255, 5},
-        {182, 182, 182, 255, 1},
-        {154, 154, 154, 255, 1},
-        {132, 132, 132, 255, 1},
-        {135, 135, 135, 255, 5},
-        {142, 142, 142, 255, 1},
-        {83, 83, 83, 255, 1},
-        {40, 40, 40, 255, 1},
-        {44, 44, 44, 255, 1},
-        {43, 43, 43, 255, 1},
-        {55, 55, 55, 255, 1},
-        {64, 64, 64, 255, 1},
-        {63, 63, 63, 255, 1},
-        {58, 58, 58, 255, 1},
-        {93, 93, 93, 255, 1},
-        {121, 121, 121, 255, 1},
-        {117, 117, 117, 255, 5},
-        {123, 123, 123, 255, 1},
-        {69, 69, 69, 255, 1},
-        {26, 26, 26, 255, 1},
-        {33, 33, 33, 255, 1},
-        {25, 25, 25, 255, 1},
-        {91, 91, 91, 255, 1},
-        {143, 143, 143, 255, 1},
-        {135, 135, 135, 255, 9},
-        {138, 138, 138, 255, 1},
-        {116, 116, 116, 255, 1},
-        {99, 99, 99, 255, 1},
-        {102, 102, 102, 255, 1},
-        {109, 109, 109, 255, 1},
-        {52, 52, 52, 255, 1},
-        {11, 11, 11, 255, 1},
-        {14, 14, 14, 255, 1},
-        {9, 9, 9, 255, 1},
-        {83, 83, 83, 255, 1},
-        {145, 145, 145, 255, 1},
-        {135, 135, 135, 255, 1},
-        {138, 138, 138, 255, 1},
-        {116, 116, 116, 255, 1},
-        {99, 99, 99, 255, 1},
-        {102, 102, 102, 255, 1},
-        {110, 110, 110, 255, 1},
-        {179, 179, 179, 146, 1},
-        {193, 193, 193, 255, 1},
-        {179, 179, 179, 255, 5},
-        {185, 185, 185, 255, 1},
-        {131, 131, 131, 255, 1},
-        {89, 89, 89, 255, 1},
-        {96, 96, 96, 255, 5},
-        {104, 104, 104, 255, 1},
-        {37, 37, 37, 255, 1},
-        {0, 0, 0, 255, 3},
-        {12, 12, 12, 255, 1},
-        {31, 31, 31, 255, 1},
-        {27, 27, 27, 255, 1},
-        {15, 15, 15, 255, 1},
-        {120, 120, 120, 255, 1},
-        {204, 204, 204, 255, 1},
-        {191, 191, 191, 255, 5},
-        {204, 204, 204, 255, 1},
-        {100, 100, 100, 255, 1},
-        {20, 20, 20, 255, 1},
-        {33, 33, 33, 255, 1},
-        {29, 29, 29, 255, 1},
-        {68, 68, 68, 255, 1},
-        {101, 101, 101, 255, 1},
-        {96, 96, 96, 255, 9},
-        {95, 95, 95, 255, 1},
-        {99, 99, 99, 255, 1},
-        {102, 102, 102, 255, 2},
-        {110, 110, 110, 255, 1},
-        {42, 42, 42, 255, 1},
-        {0, 0, 0, 255, 3},
-        {53, 53, 53, 255, 1},
-        {104, 104, 104, 255, 1},
-        {96, 96, 96, 255, 1},
-        {95, 95, 95, 255, 1},
-        {99, 99, 99, 255, 1},
-        {102, 102, 102, 255, 2},
-        {110, 110, 110, 255, 1},
-        {179, 179, 179, 146, 1},
-        {193, 193, 193, 255, 1},
-        {179, 179, 179, 255, 5},
-        {185, 185, 185, 255, 1},
-        {135, 135, 135, 255, 1},
-        {96, 96, 96, 255, 1},
-        {102, 102, 102, 255, 5},
-        {110, 110, 110, 255, 1},
-        {44, 44, 44, 255, 1},
-        {0, 0, 0, 255, 3},
-        {19, 19, 19, 255, 1},
-        {36, 36, 36, 255, 1},
-        {33, 33, 33, 255, 1},
-        {22, 22, 22, 255, 1},
-        {116, 116, 116, 255, 1},
-        {191, 191, 191, 255, 1},
-        {179, 179, 179, 255, 5},
-        {191, 191, 191, 255, 1},
-        {95, 95, 95, 255, 1},
-        {21, 21, 21, 255, 1},
-        {33, 33, 33, 255, 1},
-        {28, 28, 28, 255, 1},
-        {72, 72, 72, 255, 1},
-        {108, 108, 108, 255, 1},
-        {102, 102, 102, 255, 13},
-        {110, 110, 110, 255, 1},
-        {44, 44, 44, 255, 1},
-        {0, 0, 0, 255, 3},
-        {58, 58, 58, 255, 1},
-        {110, 110, 110, 255, 1},
-        {102, 102, 102, 255, 5},
-        {110, 110, 110, 255, 1},
-        {192, 192, 192, 146, 1},
-        {205, 205, 205, 255, 1},
-        {190, 190, 190, 255, 1},
-        {191, 191, 191, 255, 1},
-        {187, 187, 187, 255, 1},
-        {185, 185, 185, 255, 2},
-        {192, 192, 192, 255, 1},
-        {138, 138, 138, 255, 1},
-        {96, 96, 96, 255, 1},
-        {102, 102, 102, 255, 1},
-        {101, 101, 101, 255, 1},
-        {107, 107, 107, 255, 1},
-        {110, 110, 110, 255, 2},
-        {119, 119, 119, 255, 1},
-        {46, 46, 46, 255, 1},
-        {0, 0, 0, 255, 3},
-        {11, 11, 11, 255, 1},
-        {24, 24, 24, 255, 1},
-        {22, 22, 22, 255, 1},
-        {10, 10, 10, 255, 1},
-        {111, 111, 111, 255, 1},
-        {192, 192, 192, 255, 1},
-        {179, 179, 179, 255, 2},
-        {182, 182, 182, 255, 1},
-        {186, 186, 186, 255, 1},
-        {185, 185, 185, 255, 1},
-        {197, 197, 197, 255, 1},
-        {99, 99, 99, 255, 1},
-        {23, 23, 23, 255, 1},
-        {36, 36, 36, 255, 1},
-        {30, 30, 30, 255, 1},
-        {78, 78, 78, 255, 1},
-        {116, 116, 116, 255, 1},
-        {110, 110, 110, 255, 2},
-        {105, 105, 105, 255, 1},
-        {101, 101, 101, 255, 1},
-        {102, 102, 102, 255, 5},
-        {101, 101, 101, 255, 1},
-        {107, 107, 107, 255, 1},
-        {110, 110, 110, 255, 2},
-        {119, 119, 119, 255, 1},
-        {46, 46, 46, 255, 1},
-        {0, 0, 0, 255, 3},
-        {60, 60, 60, 255, 1},
-        {116, 116, 116, 255, 1},
-        {107, 107, 107, 255, 1},
-        {108, 108, 108, 255, 1},
-        {104, 104, 104, 255, 1},
-        {102, 102, 102, 255, 2},
-        {110, 110, 110, 255, 1},
-        {96, 96, 96, 146, 1},
-        {104, 104, 104, 255, 1},
-        {96, 96, 96, 255, 1},
-        {93, 93, 93, 255, 1},
-        {118, 118, 118, 255, 1},
-        {138, 138, 138, 255, 1},
-        {135, 135, 135, 255, 1},
-        {138, 138, 138, 255, 1},
-        {116, 116, 116, 255, 1},
-        {99, 99, 99, 255, 1},
-        {102, 102, 102, 255, 1},
-        {107, 107, 107, 255, 1},
-        {69, 69, 69, 255, 1},
-        {43, 43, 43, 255, 1},
-        {44, 44, 44, 255, 1},
-        {47, 47, 47, 255, 1},
-        {30, 30, 30, 255, 1},
-        {20, 20, 20, 255, 1},
-        {19, 19, 19, 255, 1},
-        {12, 12, 12, 255, 1},
-        {74, 74, 74, 255, 1},
-        {124, 124, 124, 255, 1},
-        {116, 116, 116, 255, 1},
-        {111, 111, 111, 255, 1},
-        {152, 152, 152, 255, 1},
-        {184, 184, 184, 255, 1},
-        {179, 179, 179, 255, 1},
-        {182, 182, 182, 255, 1},
-        {154, 154, 154, 255, 1},
-        {132, 132, 132, 255, 1},
-        {135, 135, 135, 255, 1},
-        {145, 145, 145, 255, 1},
-        {65, 65, 65, 255, 1},
-        {8, 8, 8, 255, 1},
-        {14, 14, 14, 255, 1},
-        {12, 12, 12, 255, 1},
-        {31, 31, 31, 255, 1},
-        {46, 46, 46, 255, 1},
-        {44, 44, 44, 255, 1},
-        {43, 43, 43, 255, 1},
-        {77, 77, 77, 255, 1},
-        {107, 107, 107, 255, 1},
-        {102, 102, 102, 255, 5},
-        {107, 107, 107, 255, 1},
-        {69, 69, 69, 255, 1},
-        {43, 43, 43, 255, 1},
-        {44, 44, 44, 255, 1},
-        {47, 47, 47, 255, 1},
-        {30, 30, 30, 255, 1},
-        {20, 20, 20, 255, 1},
-        {19, 19, 19, 255, 2},
-        {44, 44, 44, 255, 1},
-        {66, 66, 66, 255, 1},
-        {63, 63, 63, 255, 1},
-        {60, 60, 60, 255, 1},
-        {85, 85, 85, 255, 1},
-        {105, 105, 105, 255, 1},
-        {102, 102, 102, 255, 1},
-        {110, 110, 110, 255, 1},
-        {20, 20, 20, 146, 1},
-        {24, 24, 24, 255, 1},
-        {21, 21, 21, 255, 1},
-        {16, 16, 16, 255, 1},
-        {63, 63, 63, 255, 1},
-        {102, 102, 102, 255, 1},
-        {96, 96, 96, 255, 1},
-        {95, 95, 95, 255, 1},
-        {99, 99, 99, 255, 1},
-        {102, 102, 102, 255, 2},
-        {111, 111, 111, 255, 1},
-        {39, 39, 39, 255, 1},
-        {0, 0, 0, 255, 3},
-        {17, 17, 17, 255, 1},
-        {39, 39, 39, 255, 1},
-        {36, 36, 36, 255, 1},
-        {24, 24, 24, 255, 1},
-        {124, 124, 124, 255, 1},
-        {203, 203, 203, 255, 1},
-        {191, 191, 191, 255, 2},
-        {184, 184, 184, 255, 1},
-        {178, 178, 178, 255, 1},
-        {179, 179, 179, 255, 1},
-        {185, 185, 185, 255, 1},
-        {131, 131, 131, 255, 1},
-        {89, 89, 89, 255, 1},
-        {96, 96, 96, 255, 1},
-        {104, 104, 104, 255, 1},
-        {39, 39, 39, 255, 1},
-        {0, 0, 0, 255, 7},
-        {54, 54, 54, 255, 1},
-        {111, 111, 111, 255, 1},
-        {102, 102, 102, 255, 5},
-        {111, 111, 111, 255, 1},
-        {39, 39, 39, 255, 1},
-        {0, 0, 0, 255, 3},
-        {17, 17, 17, 255, 1},
-        {39, 39, 39, 255, 1},
-        {36, 36, 36, 255, 2},
-        {31, 31, 31, 255, 1},
-        {27, 27, 27, 255, 1},
-        {28, 28, 28, 255, 1},
-        {22, 22, 22, 255, 1},
-        {70, 70, 70, 255, 1},
-        {108, 108, 108, 255, 1},
-        {102, 102, 102, 255, 1},
-        {110, 110, 110, 255, 1},
-        {33, 33, 33, 146, 1},
-        {36, 36, 36, 255, 1},
-        {33, 33, 33, 255, 1},
-        {28, 28, 28, 255, 1},
-        {72, 72, 72, 255, 1},
-        {108, 108, 108, 255, 1},
-        {102, 102, 102, 255, 5},
-        {110, 110, 110, 255, 1},
-        {44, 44, 44, 255, 1},
-        {0, 0, 0, 255, 3},
-        {19, 19, 19, 255, 1},
-        {36, 36, 36, 255, 1},
-        {33, 33, 33, 255, 1},
-        {22, 22, 22, 255, 1},
-        {116, 116, 116, 255, 1},
-        {191, 191, 191, 255, 1},
-        {179, 179, 179, 255, 5},
-        {185, 185, 185, 255, 1},
-        {135, 135, 135, 255, 1},
-        {96, 96, 96, 255, 1},
-        {102, 102, 102, 255, 1},
-        {110, 110, 110, 255, 1},
-        {43, 43, 43, 255, 1},
-        {0, 0, 0, 255, 7},
-        {58, 58, 58, 255, 1},
-        {110, 110, 110, 255, 1},
-        {102, 102, 102, 255, 5},
-        {110, 110, 110, 255, 1},
-        {44, 44, 44, 255, 1},
-        {0, 0, 0, 255, 3},
-        {19, 19, 19, 255, 1},
-        {36, 36, 36, 255, 1},
-        {33, 33, 33, 255, 5},
-        {28, 28, 28, 255, 1},
-        {72, 72, 72, 255, 1},
-        {108, 108, 108, 255, 1},
-        {102, 102, 102, 255, 1},
-        {110, 110, 110, 255, 1},
-        {33, 33, 33, 146, 1},
-        {36, 36, 36, 255, 1},
-        {33, 33, 33, 255, 1},
-        {27, 27, 27, 255, 1},
-        {77, 77, 77, 255, 1},
-        {116, 116, 116, 255, 1},
-        {110, 110, 110, 255, 5},
-        {119, 119, 119, 255, 1},
-        {46, 46, 46, 255, 1},
-        {0, 0, 0, 255, 3},
-        {11, 11, 11, 255, 1},
-        {24, 24, 24, 255, 1},
-        {22, 22, 22, 255, 1},
-        {9, 9, 9, 255, 1},
-        {115, 115, 115, 255, 1},
-        {198, 198, 198, 255, 1},
-        {185, 185, 185, 255, 5},
-        {192, 192, 192, 255, 1},
-        {138, 138, 138, 255, 1},
-        {96, 96, 96, 255, 1},
-        {102, 102, 102, 255, 1},
-        {110, 110, 110, 255, 1},
-        {43, 43, 43, 255, 1},
-        {0, 0, 0, 255, 7},
-        {61, 61, 61, 255, 1},
-        {119, 119, 119, 255, 1},
-        {110, 110, 110, 255, 5},
-        {119, 119, 119, 255, 1},
-        {46, 46, 46, 255, 1},
-        {0, 0, 0, 255, 3},
-        {11, 11, 11, 255, 1},
-        {24, 24, 24, 255, 1},
-        {22, 22, 22, 255, 5},
-        {15, 15, 15, 255, 1},
-        {70, 70, 70, 255, 1},
-        {115, 115, 115, 255, 1},
-        {107, 107, 107, 255, 1},
-        {116, 116, 116, 255, 1},
-        {33, 33, 33, 146, 1},
-        {36, 36, 36, 255, 1},
-        {33, 33, 33, 255, 2},
-        {39, 39, 39, 255, 1},
-        {46, 46, 46, 255, 1},
-        {44, 44, 44, 255, 5},
-        {47, 47, 47, 255, 1},
-        {30, 30, 30, 255, 1},
-        {20, 20, 20, 255, 1},
-        {19, 19, 19, 255, 1},
-        {12, 12, 12, 255, 1},
-        {75, 75, 75, 255, 1},
-        {124, 124, 124, 255, 1},
-        {116, 116, 116, 255, 1},
-        {114, 114, 114, 255, 1},
-        {127, 127, 127, 255, 1},
-        {137, 137, 137, 255, 1},
-        {135, 135, 135, 255, 5},
-        {138, 138, 138, 255, 1},
-        {116, 116, 116, 255, 1},
-        {99, 99, 99, 255, 1},
-        {102, 102, 102, 255, 1},
-        {110, 110, 110, 255, 1},
-        {43, 43, 43, 255, 1},
-        {0, 0, 0, 255, 3},
-        {11, 11, 11, 255, 1},
-        {21, 21, 21, 255, 1},
-        {19, 19, 19, 255, 1},
-        {20, 20, 20, 255, 1},
-        {33, 33, 33, 255, 1},
-        {47, 47, 47, 255, 1},
-        {44, 44, 44, 255, 5},
-        {47, 47, 47, 255, 1},
-        {30, 30, 30, 255, 1},
-        {20, 20, 20, 255, 1},
-        {19, 19, 19, 255, 1},
-        {12, 12, 12, 255, 1},
-        {74, 74, 74, 255, 1},
-        {124, 124, 124, 255, 1},
-        {116, 116, 116, 255, 5},
-        {120, 120, 120, 255, 1},
-        {86, 86, 86, 255, 1},
-        {59, 59, 59, 255, 1},
-        {63, 63, 63, 255, 1},
-        {68, 68, 68, 255, 1},
-        {33, 33, 33, 146, 1},
-        {36, 36, 36, 255, 1},
-        {33, 33, 33, 255, 1},
-        {37, 37, 37, 255, 1},
-        {9, 9, 9, 255, 1},
-        {0, 0, 0, 255, 7},
-        {17, 17, 17, 255, 1},
-        {39, 39, 39, 255, 1},
-        {36, 36, 36, 255, 1},
-        {24, 24, 24, 255, 1},
-        {125, 125, 125, 255, 1},
-        {203, 203, 203, 255, 1},
-        {191, 191, 191, 255, 1},
-        {198, 198, 198, 255, 1},
-        {137, 137, 137, 255, 1},
-        {88, 88, 88, 255, 1},
-        {96, 96, 96, 255, 5},
-        {95, 95, 95, 255, 1},
-        {99, 99, 99, 255, 1},
-        {102, 102, 102, 255, 2},
-        {110, 110, 110, 255, 1},
-        {43, 43, 43, 255, 1},
-        {0, 0, 0, 255, 3},
-        {21, 21, 21, 255, 1},
-        {39, 39, 39, 255, 1},
-        {36, 36, 36, 255, 1},
-        {39, 39, 39, 255, 1},
-        {11, 11, 11, 255, 1},
-        {0, 0, 0, 255, 7},
-        {17, 17, 17, 255, 1},
-        {39, 39, 39, 255, 1},
-        {36, 36, 36, 255, 1},
-        {24, 24, 24, 255, 1},
-        {124, 124, 124, 255, 1},
-        {203, 203, 203, 255, 1},
-        {191, 191, 191, 255, 5},
-        {204, 204, 204, 255, 1},
-        {98, 98, 98, 255, 1},
-        {14, 14, 14, 255, 1},
-        {28, 28, 28, 255, 1},
-        {30, 30, 30, 255, 1},
-        {33, 33, 33, 146, 1},
-        {36, 36, 36, 255, 1},
-        {33, 33, 33, 255, 1},
-        {36, 36, 36, 255, 1},
-        {14, 14, 14, 255, 1},
-        {0, 0, 0, 255, 7},
-        {19, 19, 19, 255, 1},
-        {36, 36, 36, 255, 1},
-        {33, 33, 33, 255, 1},
-        {22, 22, 22, 255, 1},
-        {117, 117, 117, 255, 1},
-        {191, 191, 191, 255, 1},
-        {179, 179, 179, 255, 1},
-        {185, 185, 185, 255, 1},
-        {135, 135, 135, 255, 1},
-        {96, 96, 96, 255, 1},
-        {102, 102, 102, 255, 9},
-        {110, 110, 110, 255, 1},
-        {43, 43, 43, 255, 1},
-        {0, 0, 0, 255, 3},
-        {19, 19, 19, 255, 1},
-        {36, 36, 36, 255, 1},
-        {33, 33, 33, 255, 1},
-        {36, 36, 36, 255, 1},
-        {14, 14, 14, 255, 1},
-        {0, 0, 0, 255, 7},
-        {19, 19, 19, 255, 1},
-        {36, 36, 36, 255, 1},
-        {33, 33, 33, 255, 1},
-        {22, 22, 22, 255, 1},
-        {116, 116, 116, 255, 1},
-        {191, 191, 191, 255, 1},
-        {179, 179, 179, 255, 5},
-        {191, 191, 191, 255, 1},
-        {96, 96, 96, 255, 1},
-        {21, 21, 21, 255, 1},
-        {33, 33, 33, 255, 1},
-        {36, 36, 36, 255, 1},
-        {20, 20, 20, 146, 1},
-        {24, 24, 24, 255, 1},
-        {22, 22, 22, 255, 1},
-        {25, 25, 25, 255, 1},
-        {1, 1, 1, 255, 1},
-        {0, 0, 0, 255, 7},
-        {18, 18, 18, 255, 1},
-        {36, 36, 36, 255, 1},
-        {33, 33, 33, 255, 1},
-        {22, 22, 22, 255, 1},
-        {117, 117, 117, 255, 1},
-        {191, 191, 191, 255, 1},
-        {179, 179, 179, 255, 1},
-        {185, 185, 185, 255, 1},
-        {135, 135, 135, 255, 1},
-        {96, 96, 96, 255, 1},
-        {102, 102, 102, 255, 5},
-        {101, 101, 101, 255, 1},
-        {107, 107, 107, 255, 1},
-        {110, 110, 110, 255, 2},
-        {119, 119, 119, 255, 1},
-        {45, 45, 45, 255, 1},
-        {0, 0, 0, 255, 3},
-        {11, 11, 11, 255, 1},
-        {24, 24, 24, 255, 1},
-        {22, 22, 22, 255, 1},
-        {25, 25, 25, 255, 1},
-        {1, 1, 1, 255, 1},
-        {0, 0, 0, 255, 7},
-        {13, 13, 13, 255, 1},
-        {37, 37, 37, 255, 1},
-        {33, 33, 33, 255, 1},
-        {22, 22, 22, 255, 1},
-        {119, 119, 119, 255, 1},
-        {198, 198, 198, 255, 1},
-        {185, 185, 185, 255, 5},
-        {198, 198, 198, 255, 1},
-        {99, 99, 99, 255, 1},
-        {21, 21, 21, 255, 1},
-        {33, 33, 33, 255, 1},
-        {36, 36, 36, 255, 1},
-        {117, 117, 117, 146, 1},
-        {125, 125, 125, 255, 1},
-        {116, 116, 116, 255, 1},
-        {117, 117, 117, 255, 1},
-        {108, 108, 108, 255, 1},
-        {102, 102, 102, 255, 2},
-        {108, 108, 108, 255, 1},
-        {55, 55, 55, 255, 1},
-        {12, 12, 12, 255, 1},
-        {19, 19, 19, 255, 2},
-        {27, 27, 27, 255, 1},
-        {34, 34, 34, 255, 1},
-        {33, 33, 33, 255, 1},
-        {22, 22, 22, 255, 1},
-        {117, 117, 117, 255, 1},
-        {191, 191, 191, 255, 1},
-        {179, 179, 179, 255, 1},
-        {185, 185, 185, 255, 1},
-        {135, 135, 135, 255, 1},
-        {96, 96, 96, 255, 1},
-        {102, 102, 102, 255, 5},
-        {107, 107, 107, 255, 1},
-        {69, 69, 69, 255, 1},
-        {43, 43, 43, 255, 1},
-        {44, 44, 44, 255, 1},
-        {47, 47, 47, 255, 1},
-        {29, 29, 29, 255, 1},
-        {20, 20, 20, 255, 1},
-        {19, 19, 19, 255, 1},
-        {12, 12, 12, 255, 1},
-        {75, 75, 75, 255, 1},
-        {124, 124, 124, 255, 1},
-        {116, 116, 116, 255, 1},
-        {117, 117, 117, 255, 1},
-        {108, 108, 108, 255, 1},
-        {102, 102, 102, 255, 6},
-        {108, 108, 108, 255, 1},
-        {62, 62, 62, 255, 1},
-        {27, 27, 27, 255, 1},
-        {33, 33, 33, 255, 1},
-        {25, 25, 25, 255, 1},
-        {91, 91, 91, 255, 1},
-        {143, 143, 143, 255, 1},
-        {135, 135, 135, 255, 5},
-        {143, 143, 143, 255, 1},
-        {77, 77, 77, 255, 1},
-        {24, 24, 24, 255, 1},
-        {33, 33, 33, 255, 1},
-        {36, 36, 36, 255, 1},
-        {192, 192, 192, 146, 1},
-        {205, 205, 205, 255, 1},
-        {191, 191, 191, 255, 1},
-        {190, 190, 190, 255, 1},
-        {192, 192, 192, 255, 1},
-        {193, 193, 193, 255, 2},
-        {205, 205, 205, 255, 1},
-        {104, 104, 104, 255, 1},
-        {23, 23, 23, 255, 1},
-        {36, 36, 36, 255, 2},
-        {34, 34, 34, 255, 1},
-        {33, 33, 33, 255, 2},
-        {22, 22, 22, 255, 1},
-        {117, 117, 117, 255, 1},
-        {191, 191, 191, 255, 1},
-        {179, 179, 179, 255, 1},
-        {185, 185, 185, 255, 1},
-        {135, 135, 135, 255, 1},
-        {96, 96, 96, 255, 1},
-        {102, 102, 102, 255, 5},
-        {111, 111, 111, 255, 1},
-        {39, 39, 39, 255, 1},
-        {0, 0, 0, 255, 3},
-        {17, 17, 17, 255, 1},
-        {39, 39, 39, 255, 1},
-        {36, 36, 36, 255, 1},
-        {23, 23, 23, 255, 1},
-        {125, 125, 125, 255, 1},
-        {203, 203, 203, 255, 1},
-        {191, 191, 191, 255, 1},
-        {190, 190, 190, 255, 1},
-        {192, 192, 192, 255, 1},
-        {193, 193, 193, 255, 6},
-        {205, 205, 205, 255, 1},
-        {101, 101, 101, 255, 1},
-        {20, 20, 20, 255, 1},
-        {33, 33, 33, 255, 1},
-        {28, 28, 28, 255, 1},
-        {69, 69, 69, 255, 1},
-        {100, 100, 100, 255, 1},
-        {96, 96, 96, 255, 5},
-        {100, 100, 100, 255, 1},
-        {60, 60, 60, 255, 1},
-        {27, 27, 27, 255, 1},
-        {33, 33, 33, 255, 1},
-        {36, 36, 36, 255, 1},
-        {179, 179, 179, 146, 1},
-        {193, 193, 193, 255, 1},
-        {179, 179, 179, 255, 5},
-        {190, 190, 190, 255, 1},
-        {96, 96, 96, 255, 1},
-        {21, 21, 21, 255, 1},
-        {33, 33, 33, 255, 5},
-        {22, 22, 22, 255, 1},
-        {117, 117, 117, 255, 1},
-        {191, 191, 191, 255, 1},
-        {179, 179, 179, 255, 1},
-        {185, 185, 185, 255, 1},
-        {135, 135, 135, 255, 1},
-        {96, 96, 96, 255, 1},
-        {102, 102, 102, 255, 5},
-        {110, 110, 110, 255, 1},
-        {44, 44, 44, 255, 1},
-        {0, 0, 0, 255, 3},
-        {19, 19, 19, 255, 1},
-        {36, 36, 36, 255, 1},
-        {33, 33, 33, 255, 1},
-        {21, 21, 21, 255, 1},
-        {117, 117, 117, 255, 1},
-        {191, 191, 191, 255, 1},
-        {179, 179, 179, 255, 9},
-        {190, 190, 190, 255, 1},
-        {95, 95, 95, 255, 1},
-        {21, 21, 21, 255, 1},
-        {33, 33, 33, 255, 1},
-        {28, 28, 28, 255, 1},
-        {72, 72, 72, 255, 1},
-        {107, 107, 107, 255, 1},
-        {102, 102, 102, 255, 5},
-        {107, 107, 107, 255, 1},
-        {63, 63, 63, 255, 1},
-        {27, 27, 27, 255, 1},
-        {33, 33, 33, 255, 1},
-        {36, 36, 36, 255, 1},
-        {185, 185, 185, 146, 1},
-        {199, 199, 199, 255, 1},
-        {185, 185, 185, 255, 5},
-        {197, 197, 197, 255, 1},
-        {96, 96, 96, 255, 1},
-        {15, 15, 15, 255, 1},
-        {28, 28, 28, 255, 1},
-        {27, 27, 27, 255, 1},
-        {31, 31, 31, 255, 1},
-        {33, 33, 33, 255, 2},
-        {22, 22, 22, 255, 1},
-        {120, 120, 120, 255, 1},
-        {198, 198, 198, 255, 1},
-        {185, 185, 185, 255, 1},
-        {191, 191, 191, 255, 1},
-        {138, 138, 138, 255, 1},
-        {96, 96, 96, 255, 1},
-        {102, 102, 102, 255, 5},
-        {110, 110, 110, 255, 1},
-        {44, 44, 44, 255, 1},
-        {0, 0, 0, 255, 3},
-        {12, 12, 12, 255, 1},
-        {24, 24, 24, 255, 1},
-        {22, 22, 22, 255, 1},
-        {9, 9, 9, 255, 1},
-        {112, 112, 112, 255, 1},
-        {192, 192, 192, 255, 1},
-        {179, 179, 179, 255, 2},
-        {182, 182, 182, 255, 1},
-        {185, 185, 185, 255, 6},
-        {197, 197, 197, 255, 1},
-        {94, 94, 94, 255, 1},
-        {15, 15, 15, 255, 1},
-        {28, 28, 28, 255, 1},
-        {22, 22, 22, 255, 1},
-        {73, 73, 73, 255, 1},
-        {113, 113, 113, 255, 1},
-        {107, 107, 107, 255, 2},
-        {109, 109, 109, 255, 1},
-        {110, 110, 110, 255, 2},
-        {115, 115, 115, 255, 1},
-        {68, 68, 68, 255, 1},
-        {29, 29, 29, 255, 1},
-        {36, 36, 36, 255, 1},
-        {39, 39, 39, 255, 1},
-        {136, 136, 136, 146, 1},
-        {146, 146, 146, 255, 1},
-        {135, 135, 135, 255, 5},
-        {140, 140, 140, 255, 1},
-        {99, 99, 99, 255, 1},
-        {67, 67, 67, 255, 1},
-        {72, 72, 72, 255, 1},
-        {75, 75, 75, 255, 1},
-        {50, 50, 50, 255, 1},
-        {30, 30, 30, 255, 1},
-        {33, 33, 33, 255, 1},
-        {25, 25, 25, 255, 1},
-        {91, 91, 91, 255, 1},
-        {143, 143, 143, 255, 1},
-        {135, 135, 135, 255, 1},
-        {138, 138, 138, 255, 1},
-        {116, 116, 116, 255, 1},
-        {99, 99, 99, 255, 1},
-        {102, 102, 102, 255, 5},
-        {110, 110, 110, 255, 1},
-        {44, 44, 44, 255, 1},
-        {0, 0, 0, 255, 3},
-        {67, 67, 67, 255, 1},
-        {126, 126, 126, 255, 1},
-        {116, 116, 116, 255, 1},
-        {111, 111, 111, 255, 1},
-        {152, 152, 152, 255, 1},
-        {184, 184, 184, 255, 1},
-        {179, 179, 179, 255, 1},
-        {182, 182, 182, 255, 1},
-        {154, 154, 154, 255, 1},
-        {132, 132, 132, 255, 1},
-        {135, 135, 135, 255, 5},
-        {140, 140, 140, 255, 1},
-        {99, 99, 99, 255, 1},
-        {67, 67, 67, 255, 1},
-        {72, 72, 72, 255, 1},
-        {73, 73, 73, 255, 1},
-        {67, 67, 67, 255, 1},
-        {62, 62, 62, 255, 1},
-        {63, 63, 63, 255, 1},
-        {64, 64, 64, 255, 1},
-        {52, 52, 52, 255, 1},
-        {44, 44, 44, 255, 2},
-        {46, 46, 46, 255, 1},
-        {27, 27, 27, 255, 1},
-        {12, 12, 12, 255, 1},
-        {14, 14, 14, 255, 1},
-        {16, 16, 16, 255, 1},
-        {97, 97, 97, 146, 1},
-        {103, 103, 103, 255, 1},
-        {96, 96, 96, 255, 5},
-        {95, 95, 95, 255, 1},
-        {102, 102, 102, 255, 1},
-        {108, 108, 108, 255, 1},
-        {107, 107, 107, 255, 1},
-        {113, 113, 113, 255, 1},
-        {65, 65, 65, 255, 1},
-        {28, 28, 28, 255, 1},
-        {33, 33, 33, 255, 1},
-        {28, 28, 28, 255, 1},
-        {69, 69, 69, 255, 1},
-        {100, 100, 100, 255, 1},
-        {96, 96, 96, 255, 1},
-        {95, 95, 95, 255, 1},
-        {99, 99, 99, 255, 1},
-        {102, 102, 102, 255, 6},
-        {110, 110, 110, 255, 1},
-        {44, 44, 44, 255, 1},
-        {0, 0, 0, 255, 3},
-        {110, 110, 110, 255, 1},
-        {205, 205, 205, 255, 1},
-        {191, 191, 191, 255, 1},
-        {192, 192, 192, 255, 1},
-        {184, 184, 184, 255, 1},
-        {178, 178, 178, 255, 1},
-        {179, 179, 179, 255, 1},
-        {185, 185, 185, 255, 1},
-        {132, 132, 132, 255, 1},
-        {89, 89, 89, 255, 1},
-        {96, 96, 96, 255, 5},
-        {95, 95, 95, 255, 1},
-        {103, 103, 103, 255, 1},
-        {108, 108, 108, 255, 1},
-        {107, 107, 107, 255, 1},
-        {113, 113, 113, 255, 1},
-        {62, 62, 62, 255, 1},
-        {22, 22, 22, 255, 1},
-        {28, 28, 28, 255, 1},
-        {31, 31, 31, 255, 1},
-        {7, 7, 7, 255, 1},
-        {0, 0, 0, 255, 7},
-        {103, 103, 103, 146, 1},
-        {110, 110, 110, 255, 1},
-        {102, 102, 102, 255, 9},
-        {107, 107, 107, 255, 1},
-        {63, 63, 63, 255, 1},
-        {28, 28, 28, 255, 1},
-        {33, 33, 33, 255, 1},
-        {28, 28, 28, 255, 1},
-        {72, 72, 72, 255, 1},
-        {107, 107, 107, 255, 1},
-        {102, 102, 102, 255, 9},
-        {110, 110, 110, 255, 1},
-        {44, 44, 44, 255, 1},
-        {0, 0, 0, 255, 3},
-        {103, 103, 103, 255, 1},
-        {193, 193, 193, 255, 1},
-        {179, 179, 179, 255, 5},
-        {185, 185, 185, 255, 1},
-        {135, 135, 135, 255, 1},
-        {96, 96, 96, 255, 1},
-        {102, 102, 102, 255, 9},
-        {107, 107, 107, 255, 1},
-        {63, 63, 63, 255, 1},
-        {28, 28, 28, 255, 1},
-        {33, 33, 33, 255, 1},
-        {36, 36, 36, 255, 1},
-        {14, 14, 14, 255, 1},
-        {0, 0, 0, 255, 7},
-        {103, 103, 103, 146, 1},
-        {110, 110, 110, 255, 1},
-        {102, 102, 102, 255, 9},
-        {107, 107, 107, 255, 1},
-        {63, 63, 63, 255, 1},
-        {28, 28, 28, 255, 1},
-        {33, 33, 33, 255, 1},
-        {28, 28, 28, 255, 1},
-        {75, 75, 75, 255, 1},
-        {113, 113, 113, 255, 1},
-        {107, 107, 107, 255, 2},
-        {109, 109, 109, 255, 1},
-        {110, 110, 110, 255, 6},
-        {119, 119, 119, 255, 1},
-        {46, 46, 46, 255, 1},
-        {0, 0, 0, 255, 3},
-        {108, 108, 108, 255, 1},
-        {206, 206, 206, 255, 1},
-        {190, 190, 190, 255, 1},
-        {191, 191, 191, 255, 1},
-        {187, 187, 187, 255, 1},
-        {185, 185, 185, 255, 2},
-        {192, 192, 192, 255, 1},
-        {138, 138, 138, 255, 1},
-        {96, 96, 96, 255, 1},
-        {102, 102, 102, 255, 9},
-        {107, 107, 107, 255, 1},
-        {60, 60, 60, 255, 1},
-        {22, 22, 22, 255, 1},
-        {28, 28, 28, 255, 1},
-        {30, 30, 30, 255, 1},
-        {10, 10, 10, 255, 1},
-        {0, 0, 0, 255, 7},
-        {103, 103, 103, 146, 1},
-        {110, 110, 110, 255, 1},
-        {102, 102, 102, 255, 9},
-        {107, 107, 107, 255, 1},
-        {63, 63, 63, 255, 1},
-        {28, 28, 28, 255, 1},
-        {33, 33, 33, 255, 1},
-        {31, 31, 31, 255, 1},
-        {50, 50, 50, 255, 1},
-        {65, 65, 65, 255, 1},
-        {63, 63, 63, 255, 1},
-        {64, 64, 64, 255, 1},
-        {52, 52, 52, 255, 1},
-        {44, 44, 44, 255, 6},
-        {47, 47, 47, 255, 1},
-        {30, 30, 30, 255, 1},
-        {20, 20, 20, 255, 1},
-        {19, 19, 19, 255, 1},
-        {18, 18, 18, 255, 1},
-        {63, 63, 63, 255, 1},
-        {102, 102, 102, 255, 1},
-        {96, 96, 96, 255, 1},
-        {93, 93, 93, 255, 1},
-        {118, 118, 118, 255, 1},
-        {139, 139, 139, 255, 1},
-        {135, 135, 135, 255, 1},
-        {138, 138, 138, 255, 1},
-        {116, 116, 116, 255, 1},
-        {99, 99, 99, 255, 1},
-        {102, 102, 102, 255, 9},
-        {104, 104, 104, 255, 1},
-        {85, 85, 85, 255, 1},
-        {70, 70, 70, 255, 1},
-        {72, 72, 72, 255, 1},
-        {76, 76, 76, 255, 1},
-        {42, 42, 42, 255, 1},
-        {15, 15, 15, 255, 1},
-        {19, 19, 19, 255, 5},
-        {20, 20, 20, 255, 1},
-        {103, 103, 103, 146, 1},
-        {110, 110, 110, 255, 1},
-        {102, 102, 102, 255, 9},
-        {107, 107, 107, 255, 1},
-        {63, 63, 63, 255, 1},
-        {28, 28, 28, 255, 1},
-        {33, 33, 33, 255, 2},
-        {30, 30, 30, 255, 1},
-        {27, 27, 27, 255, 2},
-        {31, 31, 31, 255, 1},
-        {7, 7, 7, 255, 1},
-        {0, 0, 0, 255, 7},
-        {17, 17, 17, 255, 1},
-        {39, 39, 39, 255, 1},
-        {36, 36, 36, 255, 2},
-        {27, 27, 27, 255, 1},
-        {20, 20, 20, 255, 1},
-        {21, 21, 21, 255, 1},
-        {16, 16, 16, 255, 1},
-        {63, 63, 63, 255, 1},
-        {102, 102, 102, 255, 1},
-        {96, 96, 96, 255, 1},
-        {95, 95, 95, 255, 1},
-        {99, 99, 99, 255, 1},
-        {102, 102, 102, 255, 11},
-        {105, 105, 105, 255, 1},
-        {108, 108, 108, 255, 2},
-        {113, 113, 113, 255, 1},
-        {67, 67, 67, 255, 1},
-        {29, 29, 29, 255, 1},
-        {36, 36, 36, 255, 5},
-        {39, 39, 39, 255, 1},
-        {103, 103, 103, 146, 1},
-        {110, 110, 110, 255, 1},
-        {102, 102, 102, 255, 9},
-        {107, 107, 107, 255, 1},
-        {63, 63, 63, 255, 1},
-        {28, 28, 28, 255, 1},
-        {33, 33, 33, 255, 5},
-        {36, 36, 36, 255, 1},
-        {14, 14, 14, 255, 1},
-        {0, 0, 0, 255, 7},
-        {19, 19, 19, 255, 1},
-        {36, 36, 36, 255, 1},
-        {33, 33, 33, 255, 5},
-        {28, 28, 28, 255, 1},
-        {72, 72, 72, 255, 1},
-        {108, 108, 108, 255, 1},
-        {102, 102, 102, 255, 17},
-        {107, 107, 107, 255, 1},
-        {63, 63, 63, 255, 1},
-        {27, 27, 27, 255, 1},
-        {33, 33, 33, 255, 5},
-        {36, 36, 36, 255, 1},
-        {103, 103, 103, 146, 1},
-        {110, 110, 110, 255, 1},
-        {102, 102, 102, 255, 5},
-        {101, 101, 101, 255, 1},
-        {107, 107, 107, 255, 1},
-        {110, 110, 110, 255, 2},
-        {115, 115, 115, 255, 1},
-        {66, 66, 66, 255, 1},
-        {27, 27, 27, 255, 1},
-        {33, 33, 33, 255, 1},
-        {34, 34, 34, 255, 1},
-        {26, 26, 26, 255, 1},
-        {20, 20, 20, 255, 1},
-        {21, 21, 21, 255, 1},
-        {25, 25, 25, 255, 1},
-        {1, 1, 1, 255, 1},
-        {0, 0, 0, 255, 7},
-        {18, 18, 18, 255, 1},
-        {36, 36, 36, 255, 1},
-        {33, 33, 33, 255, 5},
-        {28, 28, 28, 255, 1},
-        {75, 75, 75, 255, 1},
-        {114, 114, 114, 255, 1},
-        {107, 107, 107, 255, 2},
-        {109, 109, 109, 255, 1},
-        {110, 110, 110, 255, 3},
-        {105, 105, 105, 255, 1},
-        {101, 101, 101, 255, 1},
-        {102, 102, 102, 255, 5},
-        {101, 101, 101, 255, 1},
-        {107, 107, 107, 255, 1},
-        {110, 110, 110, 255, 2},
-        {115, 115, 115, 255, 1},
-        {66, 66, 66, 255, 1},
-        {26, 26, 26, 255, 1},
-        {33, 33, 33, 255, 1},
-        {34, 34, 34, 255, 1},
-        {26, 26, 26, 255, 1},
-        {20, 20, 20, 255, 1},
-        {21, 21, 21, 255, 1},
-        {24, 24, 24, 255, 1},
-        {103, 103, 103, 146, 1},
-        {110, 110, 110, 255, 1},
-        {102, 102, 102, 255, 5},
-        {107, 107, 107, 255, 1},
-        {69, 69, 69, 255, 1},
-        {44, 44, 44, 255, 2},
-        {46, 46, 46, 255, 1},
-        {38, 38, 38, 255, 1},
-        {33, 33, 33, 255, 2},
-        {27, 27, 27, 255, 1},
-        {81, 81, 81, 255, 1},
-        {123, 123, 123, 255, 1},
-        {116, 116, 116, 255, 1},
-        {117, 117, 117, 255, 1},
-        {108, 108, 108, 255, 1},
-        {101, 101, 101, 255, 1},
-        {102, 102, 102, 255, 1},
-        {108, 108, 108, 255, 1},
-        {55, 55, 55, 255, 1},
-        {12, 12, 12, 255, 1},
-        {19, 19, 19, 255, 1},
-        {18, 18, 18, 255, 1},
-        {27, 27, 27, 255, 1},
-        {34, 34, 34, 255, 1},
-        {33, 33, 33, 255, 5},
-        {31, 31, 31, 255, 1},
-        {50, 50, 50, 255, 1},
-        {65, 65, 65, 255, 1},
-        {63, 63, 63, 255, 1},
-        {64, 64, 64, 255, 1},
-        {52, 52, 52, 255, 1},
-        {44, 44, 44, 255, 3},
-        {77, 77, 77, 255, 1},
-        {107, 107, 107, 255, 1},
-        {102, 102, 102, 255, 5},
-        {107, 107, 107, 255, 1},
-        {69, 69, 69, 255, 1},
-        {44, 44, 44, 255, 2},
-        {46, 46, 46, 255, 1},
-        {38, 38, 38, 255, 1},
-        {32, 32, 32, 255, 1},
-        {33, 33, 33, 255, 1},
-        {26, 26, 26, 255, 1},
-        {80, 80, 80, 255, 1},
-        {123, 123, 123, 255, 1},
-        {116, 116, 116, 255, 1},
-        {125, 125, 125, 255, 1},
-        {103, 103, 103, 146, 1},
-        {110, 110, 110, 255, 1},
-        {102, 102, 102, 255, 5},
-        {111, 111, 111, 255, 1},
-        {39, 39, 39, 255, 1},
-        {0, 0, 0, 255, 3},
-        {15, 15, 15, 255, 1},
-        {37, 37, 37, 255, 1},
-        {33, 33, 33, 255, 1},
-        {21, 21, 21, 255, 1},
-        {124, 124, 124, 255, 1},
-        {204, 204, 204, 255, 1},
-        {191, 191, 191, 255, 2},
-        {192, 192, 192, 255, 1},
-        {193, 193, 193, 255, 2},
-        {205, 205, 205, 255, 1},
-        {104, 104, 104, 255, 1},
-        {23, 23, 23, 255, 1},
-        {36, 36, 36, 255, 2},
-        {34, 34, 34, 255, 1},
-        {33, 33, 33, 255, 7},
-        {30, 30, 30, 255, 1},
-        {27, 27, 27, 255, 2},
-        {31, 31, 31, 255, 1},
-        {7, 7, 7, 255, 1},
-        {0, 0, 0, 255, 3},
-        {54, 54, 54, 255, 1},
-        {111, 111, 111, 255, 1},
-        {102, 102, 102, 255, 5},
-        {111, 111, 111, 255, 1},
-        {39, 39, 39, 255, 1},
-        {0, 0, 0, 255, 3},
-        {15, 15, 15, 255, 1},
-        {37, 37, 37, 255, 1},
-        {33, 33, 33, 255, 1},
-        {20, 20, 20, 255, 1},
-        {123, 123, 123, 255, 1},
-        {204, 204, 204, 255, 1},
-        {191, 191, 191, 255, 1},
-        {206, 206, 206, 255, 1},
-        {103, 103, 103, 146, 1},
-        {110, 110, 110, 255, 1},
-        {102, 102, 102, 255, 5},
-        {110, 110, 110, 255, 1},
-        {44, 44, 44, 255, 1},
-        {0, 0, 0, 255, 3},
-        {19, 19, 19, 255, 1},
-        {36, 36, 36, 255, 1},
-        {33, 33, 33, 255, 1},
-        {22, 22, 22, 255, 1},
-        {117, 117, 117, 255, 1},
-        {191, 191, 191, 255, 1},
-        {179, 179, 179, 255, 5},
-        {190, 190, 190, 255, 1},
-        {96, 96, 96, 255, 1},
-        {21, 21, 21, 255, 1},
-        {33, 33, 33, 255, 13},
-        {36, 36, 36, 255, 1},
-        {14, 14, 14, 255, 1},
-        {0, 0, 0, 255, 3},
-        {58, 58, 58, 255, 1},
-        {110, 110, 110, 255, 1},
-        {102, 102, 102, 255, 5},
-        {110, 110, 110, 255, 1},
-        {44, 44, 44, 255, 1},
-        {0, 0, 0, 255, 3},
-        {19, 19, 19, 255, 1},
-        {36, 36, 36, 255, 1},
-        {33, 33, 33, 255, 1},
-        {21, 21, 21, 255, 1},
-        {116, 116, 116, 255, 1},
-        {191, 191, 191, 255, 1},
-        {179, 179, 179, 255, 1},
-        {193, 193, 193, 255, 1},
-        {103, 103, 103, 146, 1},
-        {110, 110, 110, 255, 1},
-        {102, 102, 102, 255, 1},
-        {101, 101, 101, 255, 1},
-        {107, 107, 107, 255, 1},
-        {110, 110, 110, 255, 2},
-        {119, 119, 119, 255, 1},
-        {46, 46, 46, 255, 1},
-        {0, 0, 0, 255, 3},
-        {11, 11, 11, 255, 1},
-        {24, 24, 24, 255, 1},
-        {21, 21, 21, 255, 1},
-        {9, 9, 9, 255, 1},
-        {112, 112, 112, 255, 1},
-        {192, 192, 192, 255, 1},
-        {179, 179, 179, 255, 2},
-        {183, 183, 183, 255, 1},
-        {186, 186, 186, 255, 1},
-        {185, 185, 185, 255, 1},
-        {197, 197, 197, 255, 1},
-        {99, 99, 99, 255, 1},
-        {21, 21, 21, 255, 1},
-        {33, 33, 33, 255, 1},
-        {34, 34, 34, 255, 1},
-        {26, 26, 26, 255, 1},
-        {20, 20, 20, 255, 1},
-        {21, 21, 21, 255, 6},
-        {25, 25, 25, 255, 1},
-        {28, 28, 28, 255, 1},
-        {27, 27, 27, 255, 1},
-        {30, 30, 30, 255, 1},
-        {10, 10, 10, 255, 1},
-        {0, 0, 0, 255, 3},
-        {62, 62, 62, 255, 1},
-        {119, 119, 119, 255, 1},
-        {110, 110, 110, 255, 5},
-        {119, 119, 119, 255, 1},
-        {48, 48, 48, 255, 1},
-        {0, 0, 0, 255, 3},
-        {12, 12, 12, 255, 1},
-        {23, 23, 23, 255, 1},
-        {21, 21, 21, 255, 1},
-        {8, 8, 8, 255, 1},
-        {111, 111, 111, 255, 1},
-        {192, 192, 192, 255, 1},
-        {179, 179, 179, 255, 1},
-        {193, 193, 193, 255, 1},
-        {103, 103, 103, 146, 1},
-        {110, 110, 110, 255, 1},
-        {102, 102, 102, 255, 1},
-        {107, 107, 107, 255, 1},
-        {69, 69, 69, 255, 1},
-        {43, 43, 43, 255, 2},
-        {47, 47, 47, 255, 1},
-        {30, 30, 30, 255, 1},
-        {21, 21, 21, 255, 1},
-        {19, 19, 19, 255, 1},
-        {13, 13, 13, 255, 1},
-        {75, 75, 75, 255, 1},
-        {125, 125, 125, 255, 1},
-        {117, 117, 117, 255, 1},
-        {112, 112, 112, 255, 1},
-        {153, 153, 153, 255, 1},
-        {184, 184, 184, 255, 1},
-        {179, 179, 179, 255, 1},
-        {182, 182, 182, 255, 1},
-        {154, 154, 154, 255, 1},
-        {131, 131, 131, 255, 1},
-        {135, 135, 135, 255, 1},
-        {142, 142, 142, 255, 1},
-        {77, 77, 77, 255, 1},
-        {24, 24, 24, 255, 1},
-        {33, 33, 33, 255, 1},
-        {26, 26, 26, 255, 1},
-        {81, 81, 81, 255, 1},
-        {124, 124, 124, 255, 1},
-        {117, 117, 117, 255, 5},
-        {120, 120, 120, 255, 1},
-        {92, 92, 92, 255, 1},
-        {69, 69, 69, 255, 1},
-        {73, 73, 73, 255, 1},
-        {77, 77, 77, 255, 1},
-        {42, 42, 42, 255, 1},
-        {16, 16, 16, 255, 1},
-        {19, 19, 19, 255, 1},
-        {21, 21, 21, 255, 1},
-        {33, 33, 33, 255, 1},
-        {47, 47, 47, 255, 1},
-        {43, 43, 43, 255, 5},
-        {47, 47, 47, 255, 1},
-        {19, 19, 19, 255, 1},
-        {0, 0, 0, 255, 3},
-        {67, 67, 67, 255, 1},
-        {126, 126, 126, 255, 1},
-        {117, 117, 117, 255, 1},
-        {112, 112, 112, 255, 1},
-        {152, 152, 152, 255, 1},
-        {184, 184, 184, 255, 1},
-        {179, 179, 179, 255, 1},
-        {193, 193, 193, 255, 1},
-        {103, 103, 103, 146, 1},
-        {110, 110, 110, 255, 1},
-        {102, 102, 102, 255, 1},
-        {111, 111, 111, 255, 1},
-        {39, 39, 39, 255, 1},
-        {0, 0, 0, 255, 3},
-        {17, 17, 17, 255, 1},
-        {39, 39, 39, 255, 1},
-        {36, 36, 36, 255, 1},
-        {24, 24, 24, 255, 1},
-        {124, 124, 124, 255, 1},
-        {204, 204, 204, 255, 1},
-        {191, 191, 191, 255, 1},
-        {192, 192, 192, 255, 1},
-        {184, 184, 184, 255, 1},
-        {178, 178, 178, 255, 1},
-        {179, 179, 179, 255, 1},
-        {185, 185, 185, 255, 1},
-        {131, 131, 131, 255, 1},
-        {89, 89, 89, 255, 1},
-        {96, 96, 96, 255, 1},
-        {100, 100, 100, 255, 1},
-        {60, 60, 60, 255, 1},
-        {27, 27, 27, 255, 1},
-        {33, 33, 33, 255, 1},
-        {20, 20, 20, 255, 1},
-        {123, 123, 123, 255, 1},
-        {204, 204, 204, 255, 1},
-        {191, 191, 191, 255, 5},
-        {197, 197, 197, 255, 1},
-        {143, 143, 143, 255, 1},
-        {101, 101, 101, 255, 1},
-        {108, 108, 108, 255, 1},
-        {113, 113, 113, 255, 1},
-        {67, 67, 67, 255, 1},
-        {30, 30, 30, 255, 1},
-        {36, 36, 36, 255, 1},
-        {39, 39, 39, 255, 1},
-        {10, 10, 10, 255, 1},
-        {0, 0, 0, 255, 11},
-        {109, 109, 109, 255, 1},
-        {206, 206, 206, 255, 1},
-        {191, 191, 191, 255, 1},
-        {192, 192, 192, 255, 1},
-        {184, 184, 184, 255, 1},
-        {178, 178, 178, 255, 1},
-        {179, 179, 179, 255, 1},
-        {193, 193, 193, 255, 1},
-        {103, 103, 103, 146, 1},
-        {110, 110, 110, 255, 1},
-        {102, 102, 102, 255, 1},
-        {110, 110, 110, 255, 1},
-        {44, 44, 44, 255, 1},
-        {0, 0, 0, 255, 3},
-        {19, 19, 19, 255, 1},
-        {36, 36, 36, 255, 1},
-        {33, 33, 33, 255, 1},
-        {22, 22, 22, 255, 1},
-        {116, 116, 116, 255, 1},
-        {191, 191, 191, 255, 1},
-        {179, 179, 179, 255, 5},
-        {185, 185, 185, 255, 1},
-        {135, 135, 135, 255, 1},
-        {96, 96, 96, 255, 1},
-        {102, 102, 102, 255, 1},
-        {107, 107, 107, 255, 1},
-        {63, 63, 63, 255, 1},
-        {27, 27, 27, 255, 1},
-        {33, 33, 33, 255, 1},
-        {21, 21, 21, 255, 1},
-        {116, 116, 116, 255, 1},
-        {191, 191, 191, 255, 1},
-        {179, 179, 179, 255, 5},
-        {185, 185, 185, 255, 1},
-        {135, 135, 135, 255, 1},
-        {96, 96, 96, 255, 1},
-        {102, 102, 102, 255, 1},
-        {107, 107, 107, 255, 1},
-        {63, 63, 63, 255, 1},
-        {28, 28, 28, 255, 1},
-        {33, 33, 33, 255, 1},
-        {36, 36, 36, 255, 1},
-        {14, 14, 14, 255, 1},
-        {0, 0, 0, 255, 11},
-        {102, 102, 102, 255, 1},
-        {193, 193, 193, 255, 1},
-        {179, 179, 179, 255, 5},
-        {193, 193, 193, 255, 1},
-        {103, 103, 103, 146, 1},
-        {110, 110, 110, 255, 1},
-        {102, 102, 102, 255, 1},
-        {110, 110, 110, 255, 1},
-        {42, 42, 42, 255, 1},
-        {0, 0, 0, 255, 3},
-        {11, 11, 11, 255, 1},
-        {24, 24, 24, 255, 1},
-        {21, 21, 21, 255, 1},
-        {10, 10, 10, 255, 1},
-        {111, 111, 111, 255, 1},
-        {192, 192, 192, 255, 1},
-        {179, 179, 179, 255, 2},
-        {182, 182, 182, 255, 1},
-        {186, 186, 186, 255, 1},
-        {185, 185, 185, 255, 1},
-        {191, 191, 191, 255, 1},
-        {142, 142, 142, 255, 1},
-        {104, 104, 104, 255, 1},
-        {110, 110, 110, 255, 1},
-        {115, 115, 115, 255, 1},
-        {60, 60, 60, 255, 1},
-        {14, 14, 14, 255, 1},
-        {21, 21, 21, 255, 1},
-        {8, 8, 8, 255, 1},
-        {114, 114, 114, 255, 1},
-        {199, 199, 199, 255, 1},
-        {185, 185, 185, 255, 1},
-        {186, 186, 186, 255, 1},
-        {182, 182, 182, 255, 1},
-        {179, 179, 179, 255, 2},
-        {185, 185, 185, 255, 1},
-        {135, 135, 135, 255, 1},
-        {96, 96, 96, 255, 1},
-        {102, 102, 102, 255, 1},
-        {107, 107, 107, 255, 1},
-        {60, 60, 60, 255, 1},
-        {22, 22, 22, 255, 1},
-        {28, 28, 28, 255, 1},
-        {30, 30, 30, 255, 1},
-        {10, 10, 10, 255, 1},
-        {0, 0, 0, 255, 11},
-        {99, 99, 99, 255, 1},
-        {201, 201, 201, 255, 1},
-        {185, 185, 185, 255, 5},
-        {200, 200, 200, 255, 1},
-        {103, 103, 103, 146, 1},
-        {110, 110, 110, 255, 1},
-        {102, 102, 102, 255, 1},
-        {108, 108, 108, 255, 1},
-        {55, 55, 55, 255, 1},
-        {15, 15, 15, 255, 1},
-        {19, 19, 19, 255, 1},
-        {13, 13, 13, 255, 1},
-        {74, 74, 74, 255, 1},
-        {125, 125, 125, 255, 1},
-        {117, 117, 117, 255, 1},
-        {112, 112, 112, 255, 1},
-        {152, 152, 152, 255, 1},
-        {184, 184, 184, 255, 1},
-        {179, 179, 179, 255, 1},
-        {182, 182, 182, 255, 1},
-        {154, 154, 154, 255, 1},
-        {132, 132, 132, 255, 1},
-        {135, 135, 135, 255, 1},
-        {142, 142, 142, 255, 1},
-        {83, 83, 83, 255, 1},
-        {40, 40, 40, 255, 1},
-        {44, 44, 44, 255, 2},
-        {85, 85, 85, 255, 1},
-        {122, 122, 122, 255, 1},
-        {117, 117, 117, 255, 1},
-        {115, 115, 115, 255, 1},
-        {127, 127, 127, 255, 1},
-        {137, 137, 137, 255, 1},
-        {135, 135, 135, 255, 1},
-        {132, 132, 132, 255, 1},
-        {160, 160, 160, 255, 1},
-        {182, 182, 182, 255, 1},
-        {179, 179, 179, 255, 1},
-        {185, 185, 185, 255, 1},
-        {135, 135, 135, 255, 1},
-        {96, 96, 96, 255, 1},
-        {102, 102, 102, 255, 1},
-        {104, 104, 104, 255, 1},
-        {85, 85, 85, 255, 1},
-        {70, 70, 70, 255, 1},
-        {72, 72, 72, 255, 1},
-        {77, 77, 77, 255, 1},
-        {42, 42, 42, 255, 1},
-        {16, 16, 16, 255, 1},
-        {19, 19, 19, 255, 5},
-        {13, 13, 13, 255, 1},
-        {66, 66, 66, 255, 1},
-        {109, 109, 109, 255, 1},
-        {102, 102, 102, 255, 1},
-        {106, 106, 106, 255, 1},
-        {121, 121, 121, 255, 1},
-        {138, 138, 138, 255, 1},
-        {135, 135, 135, 255, 5},
-        {146, 146, 146, 255, 1},
-        {103, 103, 103, 146, 1},
-        {110, 110, 110, 255, 1},
-        {102, 102, 102, 255, 1},
-        {107, 107, 107, 255, 1},
-        {65, 65, 65, 255, 1},
-        {29, 29, 29, 255, 1},
-        {36, 36, 36, 255, 1},
-        {24, 24, 24, 255, 1},
-        {124, 124, 124, 255, 1},
-        {203, 203, 203, 255, 1},
-        {191, 191, 191, 255, 1},
-        {192, 192, 192, 255, 1},
-        {184, 184, 184, 255, 1},
-        {178, 178, 178, 255, 1},
-        {179, 179, 179, 255, 1},
-        {185, 185, 185, 255, 1},
-        {131, 131, 131, 255, 1},
-        {89, 89, 89, 255, 1},
-        {96, 96, 96, 255, 1},
-        {104, 104, 104, 255, 1},
-        {37, 37, 37, 255, 1},
-        {0, 0, 0, 255, 3},
-        {105, 105, 105, 255, 1},
-        {206, 206, 206, 255, 1},
-        {191, 191, 191, 255, 1},
-        {198, 198, 198, 255, 1},
-        {137, 137, 137, 255, 1},
-        {88, 88, 88, 255, 1},
-        {96, 96, 96, 255, 1},
-        {89, 89, 89, 255, 1},
-        {143, 143, 143, 255, 1},
-        {185, 185, 185, 255, 1},
-        {179, 179, 179, 255, 1},
-        {185, 185, 185, 255, 1},
-        {135, 135, 135, 255, 1},
-        {96, 96, 96, 255, 1},
-        {102, 102, 102, 255, 2},
-        {105, 105, 105, 255, 1},
-        {108, 108, 108, 255, 2},
-        {113, 113, 113, 255, 1},
-        {67, 67, 67, 255, 1},
-        {30, 30, 30, 255, 1},
-        {36, 36, 36, 255, 5},
-        {24, 24, 24, 255, 1},
-        {125, 125, 125, 255, 1},
-        {206, 206, 206, 255, 1},
-        {193, 193, 193, 255, 1},
-        {200, 200, 200, 255, 1},
-        {138, 138, 138, 255, 1},
-        {88, 88, 88, 255, 1},
-        {96, 96, 96, 255, 5},
-        {103, 103, 103, 255, 1},
-        {103, 103, 103, 146, 1},
-        {110, 110, 110, 255, 1},
-        {102, 102, 102, 255, 1},
-        {107, 107, 107, 255, 1},
-        {63, 63, 63, 255, 1},
-        {27, 27, 27, 255, 1},
-        {33, 33, 33, 255, 1},
-        {22, 22, 22, 255, 1},
-        {116, 116, 116, 255, 1},
-        {191, 191, 191, 255, 1},
-        {179, 179, 179, 255, 5},
-        {185, 185, 185, 255, 1},
-        {135, 135, 135, 255, 1},
-        {96, 96, 96, 255, 1},
-        {102, 102, 102, 255, 1},
-        {110, 110, 110, 255, 1},
-        {44, 44, 44, 255, 1},
-        {0, 0, 0, 255, 3},
-        {102, 102, 102, 255, 1},
-        {193, 193, 193, 255, 1},
-        {179, 179, 179, 255, 1},
-        {185, 185, 185, 255, 1},
-        {135, 135, 135, 255, 1},
-        {96, 96, 96, 255, 1},
-        {102, 102, 102, 255, 1},
-        {96, 96, 96, 255, 1},
-        {146, 146, 146, 255, 1},
-        {185, 185, 185, 255, 1},
-        {179, 179, 179, 255, 1},
-        {185, 185, 185, 255, 1},
-        {135, 135, 135, 255, 1},
-        {96, 96, 96, 255, 1},
-        {102, 102, 102, 255, 5},
-        {107, 107, 107, 255, 1},
-        {63, 63, 63, 255, 1},
-        {28, 28, 28, 255, 1},
-        {33, 33, 33, 255, 5},
-        {22, 22, 22, 255, 1},
-        {116, 116, 116, 255, 1},
-        {191, 191, 191, 255, 1},
-        {179, 179, 179, 255, 1},
-        {185, 185, 185, 255, 1},
-        {135, 135, 135, 255, 1},
-        {96, 96, 96, 255, 1},
-        {102, 102, 102, 255, 5},
-        {110, 110, 110, 255, 1},
-        {108, 108, 108, 146, 1},
-        {116, 116, 116, 255, 1},
-        {107, 107, 107, 255, 1},
-        {114, 114, 114, 255, 1},
-        {59, 59, 59, 255, 1},
-        {14, 14, 14, 255, 1},
-        {22, 22, 22, 255, 1},
-        {9, 9, 9, 255, 1},
-        {115, 115, 115, 255, 1},
-        {198, 198, 198, 255, 1},
-        {185, 185, 185, 255, 5},
-        {192, 192, 192, 255, 1},
-        {138, 138, 138, 255, 1},
-        {96, 96, 96, 255, 1},
-        {102, 102, 102, 255, 1},
-        {110, 110, 110, 255, 1},
-        {44, 44, 44, 255, 1},
-        {0, 0, 0, 255, 3},
-        {102, 102, 102, 255, 1},
-        {193, 193, 193, 255, 1},
-        {179, 179, 179, 255, 1},
-        {185, 185, 185, 255, 1},
-        {135, 135, 135, 255, 1},
-        {96, 96, 96, 255, 1},
-        {102, 102, 102, 255, 1},
-        {96, 96, 96, 255, 1},
-        {149, 149, 149, 255, 1},
-        {192, 192, 192, 255, 1},
-        {185, 185, 185, 255, 1},
-        {192, 192, 192, 255, 1},
-        {138, 138, 138, 255, 1},
-        {96, 96, 96, 255, 1},
-        {102, 102, 102, 255, 5},
-        {107, 107, 107, 255, 1},
-        {64, 64, 64, 255, 1},
-        {30, 30, 30, 255, 1},
-        {36, 36, 36, 255, 2},
-        {34, 34, 34, 255, 1},
-        {33, 33, 33, 255, 2},
-        {21, 21, 21, 255, 1},
-        {123, 123, 123, 255, 1},
-        {203, 203, 203, 255, 1},
-        {190, 190, 190, 255, 1},
-        {197, 197, 197, 255, 1},
-        {140, 140, 140, 255, 1},
-        {95, 95, 95, 255, 1},
-        {102, 102, 102, 255, 5},
-        {110, 110, 110, 255, 1},
-        {62, 62, 62, 146, 1},
-        {68, 68, 68, 255, 1},
-        {63, 63, 63, 255, 1},
-        {58, 58, 58, 255, 1},
-        {94, 94, 94, 255, 1},
-        {120, 120, 120, 255, 1},
-        {116, 116, 116, 255, 1},
-        {115, 115, 115, 255, 1},
-        {127, 127, 127, 255, 1},
-        {137, 137, 137, 255, 1},
-        {135, 135, 135, 255, 5},
-        {138, 138, 138, 255, 1},
-        {116, 116, 116, 255, 1},
-        {99, 99, 99, 255, 1},
-        {102, 102, 102, 255, 1},
-        {110, 110, 110, 255, 1},
-        {44, 44, 44, 255, 1},
-        {0, 0, 0, 255, 3},
-        {102, 102, 102, 255, 1},
-        {193, 193, 193, 255, 1},
-        {179, 179, 179, 255, 1},
-        {185, 185, 185, 255, 1},
-        {135, 135, 135, 255, 1},
-        {96, 96, 96, 255, 1},
-        {102, 102, 102, 255, 1},
-        {99, 99, 99, 255, 1},
-        {121, 121, 121, 255, 1},
-        {138, 138, 138, 255, 1},
-        {135, 135, 135, 255, 1},
-        {138, 138, 138, 255, 1},
-        {116, 116, 116, 255, 1},
-        {99, 99, 99, 255, 1},
-        {102, 102, 102, 255, 5},
-        {109, 109, 109, 255, 1},
-        {52, 52, 52, 255, 1},
-        {11, 11, 11, 255, 1},
-        {14, 14, 14, 255, 2},
-        {25, 25, 25, 255, 1},
-        {35, 35, 35, 255, 1},
-        {33, 33, 33, 255, 1},
-        {28, 28, 28, 255, 1},
-        {69, 69, 69, 255, 1},
-        {101, 101, 101, 255, 1},
-        {96, 96, 96, 255, 1},
-        {95, 95, 95, 255, 1},
-        {99, 99, 99, 255, 1},
-        {103, 103, 103, 255, 1},
-        {102, 102, 102, 255, 5},
-        {110, 110, 110, 255, 1},
-        {27, 27, 27, 146, 1},
-        {30, 30, 30, 255, 1},
-        {28, 28, 28, 255, 1},
-        {14, 14, 14, 255, 1},
-        {121, 121, 121, 255, 1},
-        {204, 204, 204, 255, 1},
-        {191, 191, 191, 255, 1},
-        {198, 198, 198, 255, 1},
-        {137, 137, 137, 255, 1},
-        {88, 88, 88, 255, 1},
-        {96, 96, 96, 255, 5},
-        {95, 95, 95, 255, 1},
-        {99, 99, 99, 255, 1},
-        {102, 102, 102, 255, 2},
-        {110, 110, 110, 255, 1},
-        {44, 44, 44, 255, 1},
-        {0, 0, 0, 255, 3},
-        {102, 102, 102, 255, 1},
-        {193, 193, 193, 255, 1},
-        {179, 179, 179, 255, 1},
-        {185, 185, 185, 255, 1},
-        {135, 135, 135, 255, 1},
-        {96, 96, 96, 255, 1},
-        {102, 102, 102, 255, 2},
-        {98, 98, 98, 255, 1},
-        {95, 95, 95, 255, 1},
-        {96, 96, 96, 255, 1},
-        {95, 95, 95, 255, 1},
-        {99, 99, 99, 255, 1},
-        {102, 102, 102, 255, 6},
-        {110, 110, 110, 255, 1},
-        {42, 42, 42, 255, 1},
-        {0, 0, 0, 255, 3},
-        {18, 18, 18, 255, 1},
-        {36, 36, 36, 255, 1},
-        {33, 33, 33, 255, 1},
-        {34, 34, 34, 255, 1},
-        {26, 26, 26, 255, 1},
-        {20, 20, 20, 255, 1},
-        {21, 21, 21, 255, 1},
-        {16, 16, 16, 255, 1},
-        {67, 67, 67, 255, 1},
-        {109, 109, 109, 255, 1},
-        {102, 102, 102, 255, 5},
-        {110, 110, 110, 255, 1},
-        {33, 33, 33, 146, 1},
-        {36, 36, 36, 255, 1},
-        {33, 33, 33, 255, 1},
-        {21, 21, 21, 255, 1},
-        {117, 117, 117, 255, 1},
-        {191, 191, 191, 255, 1},
-        {179, 179, 179, 255, 1},
-        {185, 185, 185, 255, 1},
-        {135, 135, 135, 255, 1},
-        {96, 96, 96, 255, 1},
-        {102, 102, 102, 255, 9},
-        {110, 110, 110, 255, 1},
-        {44, 44, 44, 255, 1},
-        {0, 0, 0, 255, 3},
-        {102, 102, 102, 255, 1},
-        {193, 193, 193, 255, 1},
-        {179, 179, 179, 255, 1},
-        {185, 185, 185, 255, 1},
-        {135, 135, 135, 255, 1},
-        {96, 96, 96, 255, 1},
-        {102, 102, 102, 255, 13},
-        {110, 110, 110, 255, 1},
-        {44, 44, 44, 255, 1},
-        {0, 0, 0, 255, 3},
-        {19, 19, 19, 255, 1},
-        {36, 36, 36, 255, 1},
-        {33, 33, 33, 255, 5},
-        {28, 28, 28, 255, 1},
-        {72, 72, 72, 255, 1},
-        {108, 108, 108, 255, 1},
-        {102, 102, 102, 255, 5},
-        {110, 110, 110, 255, 1},
-        {33, 33, 33, 146, 1},
-        {36, 36, 36, 255, 1},
-        {33, 33, 33, 255, 1},
-        {20, 20, 20, 255, 1},
-        {124, 124, 124, 255, 1},
-        {203, 203, 203, 255, 1},
-        {190, 190, 190, 255, 1},
-        {197, 197, 197, 255, 1},
-        {140, 140, 140, 255, 1},
-        {95, 95, 95, 255, 1},
-        {102, 102, 102, 255, 9},
-        {110, 110, 110, 255, 1},
-        {44, 44, 44, 255, 1},
-        {0, 0, 0, 255, 3},
-        {105, 105, 105, 255, 1},
-        {200, 200, 200, 255, 1},
-        {185, 185, 185, 255, 1},
-        {192, 192, 192, 255, 1},
-        {138, 138, 138, 255, 1},
-        {96, 96, 96, 255, 1},
-        {102, 102, 102, 255, 9},
-        {101, 101, 101, 255, 1},
-        {107, 107, 107, 255, 1},
-        {110, 110, 110, 255, 2},
-        {119, 119, 119, 255, 1},
-        {46, 46, 46, 255, 1},
-        {0, 0, 0, 255, 3},
-        {11, 11, 11, 255, 1},
-        {24, 24, 24, 255, 1},
-        {22, 22, 22, 255, 1},
-        {21, 21, 21, 255, 1},
-        {28, 28, 28, 255, 1},
-        {34, 34, 34, 255, 1},
-        {33, 33, 33, 255, 1},
-        {28, 28, 28, 255, 1},
-        {75, 75, 75, 255, 1},
-        {114, 114, 114, 255, 1},
-        {107, 107, 107, 255, 2},
-        {109, 109, 109, 255, 1},
-        {110, 110, 110, 255, 2},
-        {119, 119, 119, 255, 1},
-        {33, 33, 33, 146, 1},
-        {36, 36, 36, 255, 1},
-        {33, 33, 33, 255, 1},
-        {28, 28, 28, 255, 1},
-        {69, 69, 69, 255, 1},
-        {101, 101, 101, 255, 1},
-        {96, 96, 96, 255, 2},
-        {99, 99, 99, 255, 1},
-        {102, 102, 102, 255, 10},
-        {110, 110, 110, 255, 1},
-        {44, 44, 44, 255, 1},
-        {0, 0, 0, 255, 3},
-        {77, 77, 77, 255, 1},
-        {146, 146, 146, 255, 1},
-        {135, 135, 135, 255, 1},
-        {138, 138, 138, 255, 1},
-        {116, 116, 116, 255, 1},
-        {99, 99, 99, 255, 1},
-        {102, 102, 102, 255, 9},
-        {107, 107, 107, 255, 1},
-        {69, 69, 69, 255, 1},
-        {43, 43, 43, 255, 1},
-        {44, 44, 44, 255, 1},
-        {47, 47, 47, 255, 1},
-        {30, 30, 30, 255, 1},
-        {20, 20, 20, 255, 1},
-        {19, 19, 19, 255, 1},
-        {12, 12, 12, 255, 1},
-        {75, 75, 75, 255, 1},
-        {124, 124, 124, 255, 1},
-        {116, 116, 116, 255, 1},
-        {122, 122, 122, 255, 1},
-        {69, 69, 69, 255, 1},
-        {26, 26, 26, 255, 1},
-        {33, 33, 33, 255, 1},
-        {31, 31, 31, 255, 1},
-        {50, 50, 50, 255, 1},
-        {65, 65, 65, 255, 1},
-        {63, 63, 63, 255, 1},
-        {65, 65, 65, 255, 1},
-        {52, 52, 52, 255, 1},
-        {44, 44, 44, 255, 2},
-        {48, 48, 48, 255, 1},
-        {33, 33, 33, 146, 1},
-        {36, 36, 36, 255, 1},
-        {33, 33, 33, 255, 1},
-        {34, 34, 34, 255, 1},
-        {26, 26, 26, 255, 1},
-        {20, 20, 20, 255, 1},
-        {21, 21, 21, 255, 1},
-        {16, 16, 16, 255, 1},
-        {67, 67, 67, 255, 1},
-        {108, 108, 108, 255, 1},
-        {102, 102, 102, 255, 9},
-        {110, 110, 110, 255, 1},
-        {44, 44, 44, 255, 1},
-        {0, 0, 0, 255, 3},
-        {55, 55, 55, 255, 1},
-        {103, 103, 103, 255, 1},
-        {96, 96, 96, 255, 1},
-        {95, 95, 95, 255, 1},
-        {99, 99, 99, 255, 1},
-        {102, 102, 102, 255, 10},
-        {111, 111, 111, 255, 1},
-        {39, 39, 39, 255, 1},
-        {0, 0, 0, 255, 3},
-        {17, 17, 17, 255, 1},
-        {39, 39, 39, 255, 1},
-        {36, 36, 36, 255, 1},
-        {24, 24, 24, 255, 1},
-        {125, 125, 125, 255, 1},
-        {203, 203, 203, 255, 1},
-        {191, 191, 191, 255, 1},
-        {202, 202, 202, 255, 1},
-        {101, 101, 101, 255, 1},
-        {20, 20, 20, 255, 1},
-        {33, 33, 33, 255, 2},
-        {30, 30, 30, 255, 1},
-        {27, 27, 27, 255, 1},
-        {28, 28, 28, 255, 1},
-        {31, 31, 31, 255, 1},
-        {7, 7, 7, 255, 1},
-        {0, 0, 0, 255, 3},
-        {33, 33, 33, 146, 1},
-        {36, 36, 36, 255, 1},
-        {33, 33, 33, 255, 5},
-        {28, 28, 28, 255, 1},
-        {72, 72, 72, 255, 1},
-        {107, 107, 107, 255, 1},
-        {102, 102, 102, 255, 9},
-        {110, 110, 110, 255, 1},
-        {44, 44, 44, 255, 1},
-        {0, 0, 0, 255, 3},
-        {58, 58, 58, 255, 1},
-        {110, 110, 110, 255, 1},
-        {102, 102, 102, 255, 13},
-        {110, 110, 110, 255, 1},
-        {44, 44, 44, 255, 1},
-        {0, 0, 0, 255, 3},
-        {19, 19, 19, 255, 1},
-        {36, 36, 36, 255, 1},
-        {33, 33, 33, 255, 1},
-        {22, 22, 22, 255, 1},
-        {117, 117, 117, 255, 1},
-        {191, 191, 191, 255, 1},
-        {179, 179, 179, 255, 1},
-        {190, 190, 190, 255, 1},
-        {96, 96, 96, 255, 1},
-        {21, 21, 21, 255, 1},
-        {33, 33, 33, 255, 5},
-        {36, 36, 36, 255, 1},
-        {14, 14, 14, 255, 1},
-        {0, 0, 0, 255, 3},
-        {20, 20, 20, 146, 1},
-        {24, 24, 24, 255, 1},
-        {22, 22, 22, 255, 5},
-        {15, 15, 15, 255, 1},
-        {72, 72, 72, 255, 1},
-        {115, 115, 115, 255, 1},
-        {110, 110, 110, 255, 9},
-        {119, 119, 119, 255, 1},
-        {47, 47, 47, 255, 1},
-        {0, 0, 0, 255, 3},
-        {61, 61, 61, 255, 1},
-        {116, 116, 116, 255, 1},
-        {107, 107, 107, 255, 1},
-        {108, 108, 108, 255, 1},
-        {104, 104, 104, 255, 1},
-        {102, 102, 102, 255, 2},
-        {101, 101, 101, 255, 1},
-        {107, 107, 107, 255, 1},
-        {110, 110, 110, 255, 6},
-        {118, 118, 118, 255, 1},
-        {39, 39, 39, 255, 1},
-        {0, 0, 0, 255, 3},
-        {7, 7, 7, 255, 1},
-        {25, 25, 25, 255, 1},
-        {22, 22, 22, 255, 1},
-        {9, 9, 9, 255, 1},
-        {116, 116, 116, 255, 1},
-        {198, 198, 198, 255, 1},
-        {185, 185, 185, 255, 1},
-        {197, 197, 197, 255, 1},
-        {96, 96, 96, 255, 1},
-        {15, 15, 15, 255, 1},
-        {28, 28, 28, 255, 1},
-        {27, 27, 27, 255, 1},
-        {31, 31, 31, 255, 1},
-        {33, 33, 33, 255, 2},
-        {36, 36, 36, 255, 1},
-        {13, 13, 13, 255, 1},
-        {0, 0, 0, 255, 3},
-        {117, 117, 117, 146, 1},
-        {125, 125, 125, 255, 1},
-        {116, 116, 116, 255, 5},
-        {122, 122, 122, 255, 1},
-        {75, 75, 75, 255, 1},
-        {45, 45, 45, 255, 1},
-        {44, 44, 44, 255, 9},
-        {47, 47, 47, 255, 1},
-        {19, 19, 19, 255, 1},
-        {0, 0, 0, 255, 3},
-        {36, 36, 36, 255, 1},
-        {68, 68, 68, 255, 1},
-        {63, 63, 63, 255, 1},
-        {60, 60, 60, 255, 1},
-        {85, 85, 85, 255, 1},
-        {105, 105, 105, 255, 1},
-        {102, 102, 102, 255, 1},
-        {107, 107, 107, 255, 1},
-        {68, 68, 68, 255, 1},
-        {43, 43, 43, 255, 1},
-        {44, 44, 44, 255, 5},
-        {46, 46, 46, 255, 1},
-        {77, 77, 77, 255, 1},
-        {109, 109, 109, 255, 1},
-        {102, 102, 102, 255, 2},
-        {110, 110, 110, 255, 1},
-        {117, 117, 117, 255, 1},
-        {116, 116, 116, 255, 1},
-        {115, 115, 115, 255, 1},
-        {127, 127, 127, 255, 1},
-        {137, 137, 137, 255, 1},
-        {135, 135, 135, 255, 1},
-        {140, 140, 140, 255, 1},
-        {99, 99, 99, 255, 1},
-        {67, 67, 67, 255, 1},
-        {72, 72, 72, 255, 1},
-        {75, 75, 75, 255, 1},
-        {50, 50, 50, 255, 1},
-        {30, 30, 30, 255, 1},
-        {33, 33, 33, 255, 1},
-        {34, 34, 34, 255, 1},
-        {25, 25, 25, 255, 1},
-        {19, 19, 19, 255, 2},
-        {20, 20, 20, 255, 1},
-        {192, 192, 192, 146, 1},
-        {205, 205, 205, 255, 1},
-        {191, 191, 191, 255, 5},
-        {206, 206, 206, 255, 1},
-        {77, 77, 77, 255, 1},
-        {0, 0, 0, 255, 15},
-        {16, 16, 16, 255, 1},
-        {30, 30, 30, 255, 1},
-        {28, 28, 28, 255, 1},
-        {22, 22, 22, 255, 1},
-        {70, 70, 70, 255, 1},
-        {108, 108, 108, 255, 1},
-        {102, 102, 102, 255, 1},
-        {111, 111, 111, 255, 1},
-        {38, 38, 38, 255, 1},
-        {0, 0, 0, 255, 7},
-        {107, 107, 107, 255, 1},
-        {208, 208, 208, 255, 1},
-        {193, 193, 193, 255, 2},
-        {192, 192, 192, 255, 1},
-        {190, 190, 190, 255, 1},
-        {191, 191, 191, 255, 1},
-        {198, 198, 198, 255, 1},
-        {136, 136, 136, 255, 1},
-        {88, 88, 88, 255, 1},
-        {96, 96, 96, 255, 1},
-        {95, 95, 95, 255, 1},
-        {102, 102, 102, 255, 1},
-        {108, 108, 108, 255, 1},
-        {107, 107, 107, 255, 1},
-        {113, 113, 113, 255, 1},
-        {65, 65, 65, 255, 1},
-        {27, 27, 27, 255, 1},
-        {33, 33, 33, 255, 2},
-        {35, 35, 35, 255, 1},
-        {36, 36, 36, 255, 2},
-        {39, 39, 39, 255, 1},
-        {179, 179, 179, 146, 1},
-        {193, 193, 193, 255, 1},
-        {179, 179, 179, 255, 5},
-        {193, 193, 193, 255, 1},
-        {77, 77, 77, 255, 1},
-        {0, 0, 0, 255, 15},
-        {19, 19, 19, 255, 1},
-        {36, 36, 36, 255, 1},
-        {33, 33, 33, 255, 1},
-        {28, 28, 28, 255, 1},
-        {72, 72, 72, 255, 1},
-        {108, 108, 108, 255, 1},
-        {102, 102, 102, 255, 1},
-        {110, 110, 110, 255, 1},
-        {43, 43, 43, 255, 1},
-        {0, 0, 0, 255, 7},
-        {102, 102, 102, 255, 1},
-        {193, 193, 193, 255, 1},
-        {179, 179, 179, 255, 5},
-        {185, 185, 185, 255, 1},
-        {135, 135, 135, 255, 1},
-        {96, 96, 96, 255, 1},
-        {102, 102, 102, 255, 5},
-        {107, 107, 107, 255, 1},
-        {63, 63, 63, 255, 1},
-        {27, 27, 27, 255, 1},
-        {33, 33, 33, 255, 5},
-        {36, 36, 36, 255, 1},
-        {179, 179, 179, 146, 1},
-        {193, 193, 193, 255, 1},
-        {179, 179, 179, 255, 2},
-        {182, 182, 182, 255, 1},
-        {185, 185, 185, 255, 2},
-        {200, 200, 200, 255, 1},
-        {78, 78, 78, 255, 1},
-        {0, 0, 0, 255, 15},
-        {13, 13, 13, 255, 1},
-        {37, 37, 37, 255, 1},
-        {33, 33, 33, 255, 1},
-        {27, 27, 27, 255, 1},
-        {77, 77, 77, 255, 1},
-        {116, 116, 116, 255, 1},
-        {110, 110, 110, 255, 1},
-        {119, 119, 119, 255, 1},
-        {45, 45, 45, 255, 1},
-        {0, 0, 0, 255, 7},
-        {96, 96, 96, 255, 1},
-        {194, 194, 194, 255, 1},
-        {179, 179, 179, 255, 2},
-        {182, 182, 182, 255, 1},
-        {185, 185, 185, 255, 2},
-        {191, 191, 191, 255, 1},
-        {138, 138, 138, 255, 1},
-        {96, 96, 96, 255, 1},
-        {102, 102, 102, 255, 5},
-        {107, 107, 107, 255, 1},
-        {60, 60, 60, 255, 1},
-        {21, 21, 21, 255, 1},
-        {28, 28, 28, 255, 1},
-        {27, 27, 27, 255, 1},
-        {32, 32, 32, 255, 1},
-        {36, 36, 36, 255, 2},
-        {39, 39, 39, 255, 1},
-        {179, 179, 179, 146, 1},
-        {193, 193, 193, 255, 1},
-        {179, 179, 179, 255, 1},
-        {182, 182, 182, 255, 1},
-        {154, 154, 154, 255, 1},
-        {132, 132, 132, 255, 1},
-        {135, 135, 135, 255, 1},
-        {144, 144, 144, 255, 1},
-        {69, 69, 69, 255, 1},
-        {15, 15, 15, 255, 1},
-        {19, 19, 19, 255, 1},
-        {13, 13, 13, 255, 1},
-        {66, 66, 66, 255, 1},
-        {109, 109, 109, 255, 1},
-        {102, 102, 102, 255, 9},
-        {108, 108, 108, 255, 1},
-        {63, 63, 63, 255, 1},
-        {27, 27, 27, 255, 1},
-        {33, 33, 33, 255, 2},
-        {39, 39, 39, 255, 1},
-        {46, 46, 46, 255, 1},
-        {44, 44, 44, 255, 1},
-        {47, 47, 47, 255, 1},
-        {29, 29, 29, 255, 1},
-        {20, 20, 20, 255, 1},
-        {19, 19, 19, 255, 1},
-        {12, 12, 12, 255, 1},
-        {67, 67, 67, 255, 1},
-        {109, 109, 109, 255, 1},
-        {102, 102, 102, 255, 1},
-        {101, 101, 101, 255, 1},
-        {146, 146, 146, 255, 1},
-        {185, 185, 185, 255, 1},
-        {179, 179, 179, 255, 1},
-        {182, 182, 182, 255, 1},
-        {154, 154, 154, 255, 1},
-        {132, 132, 132, 255, 1},
-        {135, 135, 135, 255, 1},
-        {138, 138, 138, 255, 1},
-        {116, 116, 116, 255, 1},
-        {99, 99, 99, 255, 1},
-        {102, 102, 102, 255, 5},
-        {104, 104, 104, 255, 1},
-        {85, 85, 85, 255, 1},
-        {70, 70, 70, 255, 1},
-        {72, 72, 72, 255, 1},
-        {77, 77, 77, 255, 1},
-        {39, 39, 39, 255, 1},
-        {14, 14, 14, 255, 2},
-        {16, 16, 16, 255, 1},
-        {179, 179, 179, 146, 1},
-        {193, 193, 193, 255, 1},
-        {179, 179, 179, 255, 1},
-        {185, 185, 185, 255, 1},
-        {132, 132, 132, 255, 1},
-        {89, 89, 89, 255, 1},
-        {96, 96, 96, 255, 1},
-        {100, 100, 100, 255, 1},
-        {62, 62, 62, 255, 1},
-        {30, 30, 30, 255, 1},
-        {36, 36, 36, 255, 1},
-        {24, 24, 24, 255, 1},
-        {125, 125, 125, 255, 1},
-        {206, 206, 206, 255, 1},
-        {193, 193, 193, 255, 9},
-        {205, 205, 205, 255, 1},
-        {102, 102, 102, 255, 1},
-        {20, 20, 20, 255, 1},
-        {33, 33, 33, 255, 1},
-        {37, 37, 37, 255, 1},
-        {9, 9, 9, 255, 1},
-        {0, 0, 0, 255, 3},
-        {17, 17, 17, 255, 1},
-        {39, 39, 39, 255, 1},
-        {36, 36, 36, 255, 1},
-        {23, 23, 23, 255, 1},
-        {126, 126, 126, 255, 1},
-        {206, 206, 206, 255, 1},
-        {193, 193, 193, 255, 2},
-        {185, 185, 185, 255, 1},
-        {178, 178, 178, 255, 1},
-        {179, 179, 179, 255, 1},
-        {185, 185, 185, 255, 1},
-        {132, 132, 132, 255, 1},
-        {89, 89, 89, 255, 1},
-        {96, 96, 96, 255, 1},
-        {95, 95, 95, 255, 1},
-        {99, 99, 99, 255, 1},
-        {102, 102, 102, 255, 7},
-        {105, 105, 105, 255, 1},
-        {108, 108, 108, 255, 1},
-        {107, 107, 107, 255, 1},
-        {116, 116, 116, 255, 1},
-        {45, 45, 45, 255, 1},
-        {0, 0, 0, 255, 3},
-        {179, 179, 179, 146, 1},
-        {193, 193, 193, 255, 1},
-        {179, 179, 179, 255, 1},
-        {185, 185, 185, 255, 1},
-        {135, 135, 135, 255, 1},
-        {96, 96, 96, 255, 1},
-        {102, 102, 102, 255, 1},
-        {107, 107, 107, 255, 1},
-        {63, 63, 63, 255, 1},
-        {28, 28, 28, 255, 1},
-        {33, 33, 33, 255, 1},
-        {22, 22, 22, 255, 1},
-        {116, 116, 116, 255, 1},
-        {191, 191, 191, 255, 1},
-        {179, 179, 179, 255, 9},
-        {190, 190, 190, 255, 1},
-        {96, 96, 96, 255, 1},
-        {21, 21, 21, 255, 1},
-        {33, 33, 33, 255, 1},
-        {36, 36, 36, 255, 1},
-        {14, 14, 14, 255, 1},
-        {0, 0, 0, 255, 3},
-        {19, 19, 19, 255, 1},
-        {36, 36, 36, 255, 1},
-        {33, 33, 33, 255, 1},
-        {21, 21, 21, 255, 1},
-        {117, 117, 117, 255, 1},
-        {191, 191, 191, 255, 1},
-        {179, 179, 179, 255, 5},
-        {185, 185, 185, 255, 1},
-        {135, 135, 135, 255, 1},
-        {96, 96, 96, 255, 1},
-        {102, 102, 102, 255, 13},
-        {110, 110, 110, 255, 1},
-        {44, 44, 44, 255, 1},
-        {0, 0, 0, 255, 3},
-        {185, 185, 185, 146, 1},
-        {200, 200, 200, 255, 1},
-        {185, 185, 185, 255, 1},
-        {192, 192, 192, 255, 1},
-        {138, 138, 138, 255, 1},
-        {96, 96, 96, 255, 1},
-        {102, 102, 102, 255, 1},
-        {107, 107, 107, 255, 1},
-        {63, 63, 63, 255, 1},
-        {28, 28, 28, 255, 1},
-        {33, 33, 33, 255, 1},
-        {22, 22, 22, 255, 1},
-        {116, 116, 116, 255, 1},
-        {191, 191, 191, 255, 1},
-        {179, 179, 179, 255, 2},
-        {182, 182, 182, 255, 1},
-        {186, 186, 186, 255, 1},
-        {185, 185, 185, 255, 5},
-        {197, 197, 197, 255, 1},
-        {96, 96, 96, 255, 1},
-        {15, 15, 15, 255, 1},
-        {28, 28, 28, 255, 1},
-        {30, 30, 30, 255, 1},
-        {10, 10, 10, 255, 1},
-        {0, 0, 0, 255, 3},
-        {18, 18, 18, 255, 1},
-        {36, 36, 36, 255, 1},
-        {33, 33, 33, 255, 1},
-        {20, 20, 20, 255, 1},
-        {124, 124, 124, 255, 1},
-        {203, 203, 203, 255, 1},
-        {190, 190, 190, 255, 1},
-        {191, 191, 191, 255, 1},
-        {187, 187, 187, 255, 1},
-        {185, 185, 185, 255, 2},
-        {192, 192, 192, 255, 1},
-        {138, 138, 138, 255, 1},
-        {96, 96, 96, 255, 1},
-        {102, 102, 102, 255, 9},
-        {101, 101, 101, 255, 1},
-        {107, 107, 107, 255, 1},
-        {110, 110, 110, 255, 2},
-        {119, 119, 119, 255, 1},
-        {47, 47, 47, 255, 1},
-        {0, 0, 0, 255, 3},
-        {136, 136, 136, 146, 1},
-        {146, 146, 146, 255, 1},
-        {135, 135, 135, 255, 1},
-        {138, 138, 138, 255, 1},
-        {116, 116, 116, 255, 1},
-        {99, 99, 99, 255, 1},
-        {102, 102, 102, 255, 1},
-        {107, 107, 107, 255, 1},
-        {63, 63, 63, 255, 1},
-        {28, 28, 28, 255, 1},
-        {33, 33, 33, 255, 1},
-        {22, 22, 22, 255, 1},
-        {116, 116, 116, 255, 1},
-        {191, 191, 191, 255, 1},
-        {179, 179, 179, 255, 1},
-        {182, 182, 182, 255, 1},
-        {154, 154, 154, 255, 1},
-        {132, 132, 132, 255, 1},
-        {135, 135, 135, 255, 5},
-        {140, 140, 140, 255, 1},
-        {99, 99, 99, 255, 1},
-        {67, 67, 67, 255, 1},
-        {72, 72, 72, 255, 1},
-        {76, 76, 76, 255, 1},
-        {42, 42, 42, 255, 1},
-        {15, 15, 15, 255, 1},
-        {19, 19, 19, 255, 1},
-        {18, 18, 18, 255, 1},
-        {27, 27, 27, 255, 1},
-        {34, 34, 34, 255, 1},
-        {33, 33, 33, 255, 1},
-        {28, 28, 28, 255, 1},
-        {69, 69, 69, 255, 1},
-        {101, 101, 101, 255, 1},
-        {96, 96, 96, 255, 1},
-        {93, 93, 93, 255, 1},
-        {118, 118, 118, 255, 1},
-        {138, 138, 138, 255, 1},
-        {135, 135, 135, 255, 1},
-        {138, 138, 138, 255, 1},
-        {116, 116, 116, 255, 1},
-        {99, 99, 99, 255, 1},
-        {102, 102, 102, 255, 9},
-        {107, 107, 107, 255, 1},
-        {69, 69, 69, 255, 1},
-        {44, 44, 44, 255, 2},
-        {47, 47, 47, 255, 1},
-        {19, 19, 19, 255, 1},
-        {0, 0, 0, 255, 3},
-        {96, 96, 96, 146, 1},
-        {103, 103, 103, 255, 1},
-        {96, 96, 96, 255, 1},
-        {95, 95, 95, 255, 1},
-        {99, 99, 99, 255, 1},
-        {102, 102, 102, 255, 2},
-        {107, 107, 107, 255, 1},
-        {63, 63, 63, 255, 1},
-        {28, 28, 28, 255, 1},
-        {33, 33, 33, 255, 1},
-        {22, 22, 22, 255, 1},
-        {116, 116, 116, 255, 1},
-        {191, 191, 191, 255, 1},
-        {179, 179, 179, 255, 1},
-        {185, 185, 185, 255, 1},
-        {131, 131, 131, 255, 1},
-        {89, 89, 89, 255, 1},
-        {96, 96, 96, 255, 5},
-        {95, 95, 95, 255, 1},
-        {102, 102, 102, 255, 1},
-        {108, 108, 108, 255, 2},
-        {113, 113, 113, 255, 1},
-        {67, 67, 67, 255, 1},
-        {29, 29, 29, 255, 1},
-        {36, 36, 36, 255, 2},
-        {34, 34, 34, 255, 1},
-        {33, 33, 33, 255, 2},
-        {34, 34, 34, 255, 1},
-        {26, 26, 26, 255, 1},
-        {20, 20, 20, 255, 1},
-        {21, 21, 21, 255, 1},
-        {16, 16, 16, 255, 1},
-        {63, 63, 63, 255, 1},
-        {101, 101, 101, 255, 1},
-        {96, 96, 96, 255, 1},
-        {95, 95, 95, 255, 1},
-        {99, 99, 99, 255, 1},
-        {102, 102, 102, 255, 10},
-        {111, 111, 111, 255, 1},
-        {39, 39, 39, 255, 1},
-        {0, 0, 0, 255, 7},
-        {103, 103, 103, 146, 1},
-        {110, 110, 110, 255, 1},
-        {102, 102, 102, 255, 5},
-        {107, 107, 107, 255, 1},
-        {63, 63, 63, 255, 1},
-        {28, 28, 28, 255, 1},
-        {33, 33, 33, 255, 1},
-        {22, 22, 22, 255, 1},
-        {116, 116, 116, 255, 1},
-        {191, 191, 191, 255, 1},
-        {179, 179, 179, 255, 1},
-        {185, 185, 185, 255, 1},
-        {135, 135, 135, 255, 1},
-        {96, 96, 96, 255, 1},
-        {102, 102, 102, 255, 9},
-        {107, 107, 107, 255, 1},
-        {63, 63, 63, 255, 1},
-        {27, 27, 27, 255, 1},
-        {33, 33, 33, 255, 9},
-        {28, 28, 28, 255, 1},
-        {72, 72, 72, 255, 1},
-        {107, 107, 107, 255, 1},
-        {102, 102, 102, 255, 13},
-        {110, 110, 110, 255, 1},
-        {44, 44, 44, 255, 1},
-        {0, 0, 0, 255, 7},
-        {103, 103, 103, 146, 1},
-        {110, 110, 110, 255, 1},
-        {102, 102, 102, 255, 5},
-        {107, 107, 107, 255, 1},
-        {60, 60, 60, 255, 1},
-        {22, 22, 22, 255, 1},
-        {28, 28, 28, 255, 1},
-        {15, 15, 15, 255, 1},
-        {120, 120, 120, 255, 1},
-        {204, 204, 204, 255, 1},
-        {191, 191, 191, 255, 1},
-        {197, 197, 197, 255, 1},
-        {145, 145, 145, 255, 1},
-        {104, 104, 104, 255, 1},
-        {110, 110, 110, 255, 9},
-        {115, 115, 115, 255, 1},
-        {66, 66, 66, 255, 1},
-        {26, 26, 26, 255, 1},
-        {33, 33, 33, 255, 1},
-        {34, 34, 34, 255, 1},
-        {26, 26, 26, 255, 1},
-        {20, 20, 20, 255, 1},
-        {21, 21, 21, 255, 2},
-        {25, 25, 25, 255, 1},
-        {28, 28, 28, 255, 2},
-        {22, 22, 22, 255, 1},
-        {73, 73, 73, 255, 1},
-        {113, 113, 113, 255, 1},
-        {107, 107, 107, 255, 6},
-        {109, 109, 109, 255, 1},
-        {110, 110, 110, 255, 6},
-        {119, 119, 119, 255, 1},
-        {46, 46, 46, 255, 1},
-        {0, 0, 0, 255, 7},
-        {103, 103, 103, 146, 1},
-        {110, 110, 110, 255, 1},
-        {102, 102, 102, 255, 5},
-        {104, 104, 104, 255, 1},
-        {85, 85, 85, 255, 1},
-        {70, 70, 70, 255, 1},
-        {72, 72, 72, 255, 1},
-        {70, 70, 70, 255, 1},
-        {86, 86, 86, 255, 1},
-        {98, 98, 98, 255, 1},
-        {96, 96, 96, 255, 1},
-        {100, 100, 100, 255, 1},
-        {66, 66, 66, 255, 1},
-        {41, 41, 41, 255, 1},
-        {44, 44, 44, 255, 9},
-        {46, 46, 46, 255, 1},
-        {38, 38, 38, 255, 1},
-        {32, 32, 32, 255, 1},
-        {33, 33, 33, 255, 1},
-        {26, 26, 26, 255, 1},
-        {81, 81, 81, 255, 1},
-        {123, 123, 123, 255, 1},
-        {116, 116, 116, 255, 1},
-        {119, 119, 119, 255, 1},
-        {91, 91, 91, 255, 1},
-        {69, 69, 69, 255, 1},
-        {72, 72, 72, 255, 1},
-        {73, 73, 73, 255, 1},
-        {67, 67, 67, 255, 1},
-        {62, 62, 62, 255, 1},
-        {63, 63, 63, 255, 5},
-        {64, 64, 64, 255, 1},
-        {52, 52, 52, 255, 1},
-        {44, 44, 44, 255, 6},
-        {47, 47, 47, 255, 1},
-        {30, 30, 30, 255, 1},
-        {20, 20, 20, 255, 1},
-        {19, 19, 19, 255, 5},
-        {20, 20, 20, 255, 1},
-        {103, 103, 103, 146, 1},
-        {110, 110, 110, 255, 1},
-        {102, 102, 102, 255, 6},
-        {105, 105, 105, 255, 1},
-        {108, 108, 108, 255, 2},
-        {114, 114, 114, 255, 1},
-        {59, 59, 59, 255, 1},
-        {15, 15, 15, 255, 1},
-        {21, 21, 21, 255, 1},
-        {24, 24, 24, 255, 1},
-        {4, 4, 4, 255, 1},
-        {0, 0, 0, 255, 11},
-        {15, 15, 15, 255, 1},
-        {37, 37, 37, 255, 1},
-        {33, 33, 33, 255, 1},
-        {20, 20, 20, 255, 1},
-        {124, 124, 124, 255, 1},
-        {204, 204, 204, 255, 1},
-        {191, 191, 191, 255, 1},
-        {197, 197, 197, 255, 1},
-        {143, 143, 143, 255, 1},
-        {101, 101, 101, 255, 1},
-        {108, 108, 108, 255, 1},
-        {113, 113, 113, 255, 1},
-        {62, 62, 62, 255, 1},
-        {22, 22, 22, 255, 1},
-        {27, 27, 27, 255, 5},
-        {31, 31, 31, 255, 1},
-        {7, 7, 7, 255, 1},
-        {0, 0, 0, 255, 7},
-        {17, 17, 17, 255, 1},
-        {39, 39, 39, 255, 1},
-        {36, 36, 36, 255, 5},
-        {39, 39, 39, 255, 1},
-        {103, 103, 103, 146, 1},
-        {110, 110, 110, 255, 1},
-        {102, 102, 102, 255, 9},
-        {107, 107, 107, 255, 1},
-        {63, 63, 63, 255, 1},
-        {28, 28, 28, 255, 1},
-        {33, 33, 33, 255, 1},
-        {36, 36, 36, 255, 1},
-        {14, 14, 14, 255, 1},
-        {0, 0, 0, 255, 11},
-        {19, 19, 19, 255, 1},
-        {36, 36, 36, 255, 1},
-        {33, 33, 33, 255, 1},
-        {21, 21, 21, 255, 1},
-        {117, 117, 117, 255, 1},
-        {191, 191, 191, 255, 1},
-        {179, 179, 179, 255, 1},
-        {185, 185, 185, 255, 1},
-        {135, 135, 135, 255, 1},
-        {96, 96, 96, 255, 1},
-        {102, 102, 102, 255, 1},
-        {107, 107, 107, 255, 1},
-        {63, 63, 63, 255, 1},
-        {28, 28, 28, 255, 1},
-        {33, 33, 33, 255, 5},
-        {36, 36, 36, 255, 1},
-        {14, 14, 14, 255, 1},
-        {0, 0, 0, 255, 7},
-        {19, 19, 19, 255, 1},
-        {36, 36, 36, 255, 1},
-        {33, 33, 33, 255, 5},
-        {36, 36, 36, 255, 1},
-        {103, 103, 103, 158, 1},
-        {119, 119, 119, 255, 1},
-        {110, 110, 110, 255, 9},
-        {116, 116, 116, 255, 1},
-        {68, 68, 68, 255, 1},
-        {30, 30, 30, 255, 1},
-        {36, 36, 36, 255, 1},
-        {39, 39, 39, 255, 1},
-        {15, 15, 15, 255, 1},
-        {0, 0, 0, 255, 11},
-        {21, 21, 21, 255, 1},
-        {39, 39, 39, 255, 1},
-        {36, 36, 36, 255, 1},
-        {23, 23, 23, 255, 1},
-        {126, 126, 126, 255, 1},
-        {206, 206, 206, 255, 1},
-        {193, 193, 193, 255, 1},
-        {200, 200, 200, 255, 1},
-        {146, 146, 146, 255, 1},
-        {104, 104, 104, 255, 1},
-        {110, 110, 110, 255, 1},
-        {116, 116, 116, 255, 1},
-        {68, 68, 68, 255, 1},
-        {30, 30, 30, 255, 1},
-        {36, 36, 36, 255, 5},
-        {39, 39, 39, 255, 1},
-        {15, 15, 15, 255, 1},
-        {0, 0, 0, 255, 7},
-        {21, 21, 21, 255, 1},
-        {39, 39, 39, 255, 1},
-        {36, 36, 36, 255, 5},
-        {39, 39, 39, 255, 1},
-    };
-
-    static BYTE textureData[64 * 64 * 4];
-
-    BYTE* ptr = textureData;
-    for (const auto& seg : segments) {
-        for (int i = 0; i < seg.count; ++i) {
-            *ptr++ = seg.r;
-            *ptr++ = seg.g;
-            *ptr++ = seg.b;
-            *ptr++ = seg.a;
-        }
-    }
-
-    bool result = CreateTextureFromData(textureData, size, size, &cachedSRV);
-    *outSRV = cachedSRV;
-    return result;
-}
\ No newline at end of file
@@ -1,2160 +0,0 @@
-//H V H   T E X T U R E   D A T A
-//================================
-//Generated by HVH Texture Editor v1.0
-#include <vector>
-#include "GameEngine.h"
-bool GameEngine::CreateCheckerTextureSRV(UINT size, UINT cellSize, ID3D11ShaderResourceView** outSRV) {
-    static ID3D11ShaderResourceView* cachedSRV = nullptr;
-    if (cachedSRV) {
-        *outSRV = cachedSRV;
-        return true;
-    }
-
-    if (size != 64) return false;
-
-    static const struct PixelSegment {
-        BYTE r, g, b, a;
-        int count;
-    } segments[] = {
-        {0, 0, 0, 0, 15},
-        {255, 255, 255, 3, 1},
-        {254, 254, 254, 14, 1},
-        {254, 254, 254, 23, 1},
-        {254, 254, 254, 19, 1},
-        {254, 254, 254, 9, 1},
-        {0, 0, 0, 0, 55},
-        {245, 245, 245, 28, 1},
-        {241, 241, 241, 92, 1},
-        {238, 238, 238, 151, 1},
-        {233, 233, 233, 193, 1},
-        {230, 230, 230, 220, 1},
-        {226, 226, 226, 235, 1},
-        {224, 224, 224, 243, 1},
-        {222, 222, 222, 240, 1},
-        {220, 220, 220, 228, 1},
-        {220, 220, 220, 210, 1},
-        {220, 220, 220, 187, 1},
-        {221, 221, 221, 153, 1},
-        {223, 223, 223, 105, 1},
-        {228, 228, 228, 49, 1},
-        {0, 0, 0, 0, 48},
-        {244, 244, 244, 71, 1},
-        {240, 240, 240, 173, 1},
-        {237, 237, 237, 244, 1},
-        {250, 250, 250, 255, 1},
-        {251, 251, 251, 255, 1},
-        {245, 245, 245, 255, 1},
-        {240, 240, 240, 255, 1},
-        {237, 237, 237, 255, 1},
-        {234, 234, 234, 255, 1},
-        {233, 233, 233, 255, 2},
-        {237, 237, 237, 255, 1},
-        {241, 241, 241, 255, 1},
-        {245, 245, 245, 255, 1},
-        {243, 243, 243, 255, 1},
-        {229, 229, 229, 255, 1},
-        {228, 228, 228, 211, 1},
-        {232, 232, 232, 126, 1},
-        {230, 230, 230, 31, 1},
-        {0, 0, 0, 0, 43},
-        {234, 234, 234, 62, 1},
-        {241, 241, 241, 192, 1},
-        {247, 247, 247, 255, 1},
-        {252, 252, 252, 255, 1},
-        {241, 241, 241, 255, 1},
-        {238, 238, 238, 255, 1},
-        {239, 239, 239, 255, 5},
-        {240, 240, 240, 255, 1},
-        {239, 239, 239, 255, 3},
-        {240, 240, 240, 255, 3},
-        {246, 246, 246, 255, 1},
-        {250, 250, 250, 255, 1},
-        {234, 234, 234, 243, 1},
-        {231, 231, 231, 144, 1},
-        {199, 199, 199, 23, 1},
-        {0, 0, 0, 0, 39},
-        {85, 85, 85, 3, 1},
-        {240, 240, 240, 140, 1},
-        {246, 246, 246, 255, 1},
-        {252, 252, 252, 255, 1},
-        {240, 240, 240, 255, 2},
-        {241, 241, 241, 255, 1},
-        {243, 243, 243, 255, 1},
-        {244, 244, 244, 255, 1},
-        {246, 246, 246, 255, 1},
-        {251, 251, 251, 255, 1},
-        {255, 255, 255, 255, 1},
-        {253, 253, 253, 255, 1},
-        {247, 247, 247, 255, 1},
-        {244, 244, 244, 255, 1},
-        {245, 245, 245, 255, 1},
-        {250, 250, 250, 255, 1},
-        {253, 253, 253, 255, 1},
-        {250, 250, 250, 255, 1},
-        {245, 245, 245, 255, 2},
-        {244, 244, 244, 255, 2},
-        {254, 254, 254, 255, 1},
-        {237, 237, 237, 231, 1},
-        {224, 224, 224, 92, 1},
-        {0, 0, 0, 0, 37},
-        {218, 218, 218, 14, 1},
-        {240, 240, 240, 188, 1},
-        {255, 255, 255, 255, 1},
-        {240, 240, 240, 255, 1},
-        {238, 238, 238, 255, 1},
-        {240, 240, 240, 255, 1},
-        {245, 245, 245, 255, 1},
-        {246, 246, 246, 255, 1},
-        {247, 247, 247, 255, 1},
-        {254, 254, 254, 255, 1},
-        {255, 255, 255, 255, 1},
-        {230, 230, 230, 255, 1},
-        {197, 197, 197, 255, 1},
-        {173, 173, 173, 255, 1},
-        {162, 162, 162, 255, 1},
-        {163, 163, 163, 255, 1},
-        {168, 168, 168, 255, 1},
-        {177, 177, 177, 255, 1},
-        {195, 195, 195, 255, 1},
-        {224, 224, 224, 255, 1},
-        {250, 250, 250, 255, 1},
-        {253, 253, 253, 255, 1},
-        {247, 247, 247, 255, 2},
-        {245, 245, 245, 255, 1},
-        {248, 248, 248, 255, 1},
-        {253, 253, 253, 255, 1},
-        {233, 233, 233, 151, 1},
-        {0, 0, 0, 2, 1},
-        {0, 0, 0, 0, 34},
-        {226, 226, 226, 9, 1},
-        {236, 236, 236, 197, 1},
-        {255, 255, 255, 255, 1},
-        {222, 222, 222, 255, 1},
-        {216, 216, 216, 255, 1},
-        {240, 240, 240, 255, 2},
-        {243, 243, 243, 255, 1},
-        {249, 249, 249, 255, 1},
-        {255, 255, 255, 255, 1},
-        {234, 234, 234, 255, 1},
-        {180, 180, 180, 255, 1},
-        {151, 151, 151, 255, 1},
-        {154, 154, 154, 255, 1},
-        {171, 171, 171, 255, 1},
-        {186, 186, 186, 255, 1},
-        {195, 195, 195, 255, 1},
-        {199, 199, 199, 255, 1},
-        {195, 195, 195, 255, 1},
-        {185, 185, 185, 255, 1},
-        {177, 177, 177, 255, 1},
-        {186, 186, 186, 255, 1},
-        {223, 223, 223, 255, 1},
-        {253, 253, 253, 255, 1},
-        {250, 250, 250, 255, 1},
-        {246, 246, 246, 255, 1},
-        {250, 250, 250, 255, 1},
-        {239, 239, 239, 255, 1},
-        {255, 255, 255, 255, 1},
-        {235, 235, 235, 181, 1},
-        {145, 145, 145, 7, 1},
-        {0, 0, 0, 0, 33},
-        {230, 230, 230, 164, 1},
-        {255, 255, 255, 255, 1},
-        {236, 236, 236, 255, 1},
-        {238, 238, 238, 255, 1},
-        {221, 221, 221, 255, 1},
-        {209, 209, 209, 255, 1},
-        {213, 213, 213, 255, 1},
-        {217, 217, 217, 255, 1},
-        {254, 254, 254, 255, 1},
-        {219, 219, 219, 255, 1},
-        {158, 158, 158, 255, 1},
-        {164, 164, 164, 255, 1},
-        {190, 190, 190, 255, 1},
-        {206, 206, 206, 255, 1},
-        {216, 216, 216, 255, 1},
-        {222, 222, 222, 255, 1},
-        {226, 226, 226, 255, 1},
-        {230, 230, 230, 255, 1},
-        {229, 229, 229, 255, 2},
-        {225, 225, 225, 255, 1},
-        {209, 209, 209, 255, 1},
-        {185, 185, 185, 255, 1},
-        {207, 207, 207, 255, 1},
-        {248, 248, 248, 255, 1},
-        {245, 245, 245, 255, 1},
-        {234, 234, 234, 255, 1},
-        {223, 223, 223, 255, 1},
-        {238, 238, 238, 255, 1},
-        {255, 255, 255, 255, 1},
-        {229, 229, 229, 181, 1},
-        {0, 0, 0, 1, 1},
-        {0, 0, 0, 0, 31},
-        {232, 232, 232, 79, 1},
-        {252, 252, 252, 255, 1},
-        {235, 235, 235, 255, 2},
-        {238, 238, 238, 255, 1},
-        {245, 245, 245, 255, 1},
-        {242, 242, 242, 255, 1},
-        {229, 229, 229, 255, 1},
-        {239, 239, 239, 255, 1},
-        {222, 222, 222, 255, 1},
-        {157, 157, 157, 255, 1},
-        {178, 178, 178, 255, 1},
-        {206, 206, 206, 255, 1},
-        {218, 218, 218, 255, 1},
-        {225, 225, 225, 255, 1},
-        {231, 231, 231, 255, 1},
-        {234, 234, 234, 255, 1},
-        {235, 235, 235, 255, 1},
-        {237, 237, 237, 255, 3},
-        {236, 236, 236, 255, 1},
-        {234, 234, 234, 255, 1},
-        {225, 225, 225, 255, 1},
-        {197, 197, 197, 255, 1},
-        {206, 206, 206, 255, 1},
-        {238, 238, 238, 255, 1},
-        {232, 232, 232, 255, 1},
-        {244, 244, 244, 255, 1},
-        {248, 248, 248, 255, 1},
-        {244, 244, 244, 255, 1},
-        {255, 255, 255, 255, 1},
-        {226, 226, 226, 145, 1},
-        {0, 0, 0, 0, 30},
-        {255, 255, 255, 3, 1},
-        {228, 228, 228, 213, 1},
-        {245, 245, 245, 255, 1},
-        {231, 231, 231, 255, 1},
-        {234, 234, 234, 255, 1},
-        {238, 238, 238, 255, 1},
-        {241, 241, 241, 255, 1},
-        {246, 246, 246, 255, 1},
-        {252, 252, 252, 255, 1},
-        {242, 242, 242, 255, 1},
-        {177, 177, 177, 255, 2},
-        {208, 208, 208, 255, 1},
-        {221, 221, 221, 255, 1},
-        {230, 230, 230, 255, 1},
-        {236, 236, 236, 255, 1},
-        {238, 238, 238, 255, 1},
-        {239, 239, 239, 255, 2},
-        {240, 240, 240, 255, 4},
-        {239, 239, 239, 255, 1},
-        {236, 236, 236, 255, 1},
-        {228, 228, 228, 255, 1},
-        {205, 205, 205, 255, 1},
-        {213, 213, 213, 255, 1},
-        {247, 247, 247, 255, 1},
-        {244, 244, 244, 255, 1},
-        {243, 243, 243, 255, 1},
-        {245, 245, 245, 255, 1},
-        {252, 252, 252, 255, 1},
-        {253, 253, 253, 255, 1},
-        {211, 211, 211, 71, 1},
-        {0, 0, 0, 0, 29},
-        {228, 228, 228, 67, 1},
-        {242, 242, 242, 255, 1},
-        {229, 229, 229, 255, 2},
-        {233, 233, 233, 255, 1},
-        {238, 238, 238, 255, 1},
-        {243, 243, 243, 255, 1},
-        {247, 247, 247, 255, 1},
-        {248, 248, 248, 255, 1},
-        {209, 209, 209, 255, 1},
-        {179, 179, 179, 255, 1},
-        {204, 204, 204, 255, 1},
-        {219, 219, 219, 255, 1},
-        {228, 228, 228, 255, 1},
-        {235, 235, 235, 255, 1},
-        {238, 238, 238, 255, 1},
-        {239, 239, 239, 255, 1},
-        {240, 240, 240, 255, 1},
-        {241, 241, 241, 255, 2},
-        {242, 242, 242, 255, 4},
-        {240, 240, 240, 255, 1},
-        {237, 237, 237, 255, 1},
-        {231, 231, 231, 255, 1},
-        {214, 214, 214, 255, 1},
-        {228, 228, 228, 255, 1},
-        {243, 243, 243, 255, 1},
-        {240, 240, 240, 255, 1},
-        {242, 242, 242, 255, 1},
-        {249, 249, 249, 255, 1},
-        {255, 255, 255, 255, 1},
-        {235, 235, 235, 217, 1},
-        {102, 102, 102, 5, 1},
-        {0, 0, 0, 0, 28},
-        {227, 227, 227, 146, 1},
-        {245, 245, 245, 255, 1},
-        {224, 224, 224, 255, 1},
-        {228, 228, 228, 255, 1},
-        {232, 232, 232, 255, 1},
-        {237, 237, 237, 255, 1},
-        {246, 246, 246, 255, 1},
-        {253, 253, 253, 255, 1},
-        {239, 239, 239, 255, 1},
-        {193, 193, 193, 255, 1},
-        {195, 195, 195, 255, 1},
-        {216, 216, 216, 255, 1},
-        {224, 224, 224, 255, 1},
-        {232, 232, 232, 255, 1},
-        {237, 237, 237, 255, 1},
-        {239, 239, 239, 255, 1},
-        {240, 240, 240, 255, 1},
-        {241, 241, 241, 255, 1},
-        {242, 242, 242, 255, 1},
-        {243, 243, 243, 255, 1},
-        {245, 245, 245, 255, 3},
-        {244, 244, 244, 255, 1},
-        {243, 243, 243, 255, 1},
-        {241, 241, 241, 255, 1},
-        {237, 237, 237, 255, 1},
-        {231, 231, 231, 255, 1},
-        {222, 222, 222, 255, 1},
-        {237, 237, 237, 255, 1},
-        {239, 239, 239, 255, 2},
-        {244, 244, 244, 255, 1},
-        {254, 254, 254, 255, 1},
-        {255, 255, 255, 255, 1},
-        {217, 217, 217, 89, 1},
-        {0, 0, 0, 0, 28},
-        {225, 225, 225, 196, 1},
-        {236, 236, 236, 255, 1},
-        {221, 221, 221, 255, 1},
-        {226, 226, 226, 255, 1},
-        {230, 230, 230, 255, 1},
-        {237, 237, 237, 255, 1},
-        {249, 249, 249, 255, 1},
-        {255, 255, 255, 255, 1},
-        {227, 227, 227, 255, 1},
-        {189, 189, 189, 255, 1},
-        {206, 206, 206, 255, 1},
-        {219, 219, 219, 255, 1},
-        {226, 226, 226, 255, 1},
-        {232, 232, 232, 255, 1},
-        {237, 237, 237, 255, 1},
-        {239, 239, 239, 255, 1},
-        {240, 240, 240, 255, 1},
-        {242, 242, 242, 255, 1},
-        {244, 244, 244, 255, 1},
-        {246, 246, 246, 255, 2},
-        {247, 247, 247, 255, 2},
-        {246, 246, 246, 255, 1},
-        {245, 245, 245, 255, 1},
-        {243, 243, 243, 255, 1},
-        {240, 240, 240, 255, 1},
-        {237, 237, 237, 255, 1},
-        {228, 228, 228, 255, 1},
-        {229, 229, 229, 255, 1},
-        {240, 240, 240, 255, 1},
-        {237, 237, 237, 255, 1},
-        {239, 239, 239, 255, 1},
-        {247, 247, 247, 255, 1},
-        {255, 255, 255, 255, 1},
-        {234, 234, 234, 188, 1},
-        {0, 0, 0, 0, 27},
-        {255, 255, 255, 3, 1},
-        {224, 224, 224, 221, 1},
-        {227, 227, 227, 255, 1},
-        {218, 218, 218, 255, 1},
-        {224, 224, 224, 255, 1},
-        {229, 229, 229, 255, 1},
-        {235, 235, 235, 255, 1},
-        {249, 249, 249, 255, 1},
-        {253, 253, 253, 255, 1},
-        {217, 217, 217, 255, 1},
-        {190, 190, 190, 255, 1},
-        {211, 211, 211, 255, 1},
-        {220, 220, 220, 255, 1},
-        {225, 225, 225, 255, 1},
-        {231, 231, 231, 255, 1},
-        {235, 235, 235, 255, 1},
-        {238, 238, 238, 255, 1},
-        {240, 240, 240, 255, 1},
-        {242, 242, 242, 255, 1},
-        {245, 245, 245, 255, 1},
-        {247, 247, 247, 255, 2},
-        {249, 249, 249, 255, 2},
-        {248, 248, 248, 255, 1},
-        {247, 247, 247, 255, 1},
-        {245, 245, 245, 255, 1},
-        {242, 242, 242, 255, 1},
-        {240, 240, 240, 255, 1},
-        {236, 236, 236, 255, 1},
-        {227, 227, 227, 255, 1},
-        {238, 238, 238, 255, 1},
-        {236, 236, 236, 255, 2},
-        {239, 239, 239, 255, 1},
-        {253, 253, 253, 255, 1},
-        {238, 238, 238, 246, 1},
-        {185, 185, 185, 22, 1},
-        {0, 0, 0, 0, 26},
-        {255, 255, 255, 8, 1},
-        {224, 224, 224, 228, 1},
-        {222, 222, 222, 255, 1},
-        {216, 216, 216, 255, 1},
-        {223, 223, 223, 255, 1},
-        {228, 228, 228, 255, 1},
-        {233, 233, 233, 255, 1},
-        {245, 245, 245, 255, 1},
-        {247, 247, 247, 255, 1},
-        {211, 211, 211, 255, 1},
-        {192, 192, 192, 255, 1},
-        {214, 214, 214, 255, 1},
-        {220, 220, 220, 255, 1},
-        {225, 225, 225, 255, 1},
-        {230, 230, 230, 255, 1},
-        {234, 234, 234, 255, 1},
-        {238, 238, 238, 255, 1},
-        {241, 241, 241, 255, 1},
-        {243, 243, 243, 255, 1},
-        {246, 246, 246, 255, 1},
-        {247, 247, 247, 255, 1},
-        {249, 249, 249, 255, 1},
-        {250, 250, 250, 255, 3},
-        {248, 248, 248, 255, 1},
-        {246, 246, 246, 255, 1},
-        {244, 244, 244, 255, 1},
-        {241, 241, 241, 255, 1},
-        {240, 240, 240, 255, 1},
-        {231, 231, 231, 255, 1},
-        {235, 235, 235, 255, 1},
-        {238, 238, 238, 255, 1},
-        {234, 234, 234, 255, 1},
-        {233, 233, 233, 255, 1},
-        {241, 241, 241, 255, 1},
-        {251, 251, 251, 255, 1},
-        {216, 216, 216, 66, 1},
-        {0, 0, 0, 0, 26},
-        {255, 255, 255, 2, 1},
-        {224, 224, 224, 218, 1},
-        {219, 219, 219, 255, 1},
-        {213, 213, 213, 255, 1},
-        {222, 222, 222, 255, 1},
-        {227, 227, 227, 255, 1},
-        {230, 230, 230, 255, 1},
-        {238, 238, 238, 255, 1},
-        {239, 239, 239, 255, 1},
-        {209, 209, 209, 255, 1},
-        {196, 196, 196, 255, 1},
-        {218, 218, 218, 255, 1},
-        {222, 222, 222, 255, 1},
-        {226, 226, 226, 255, 1},
-        {230, 230, 230, 255, 1},
-        {234, 234, 234, 255, 1},
-        {238, 238, 238, 255, 1},
-        {240, 240, 240, 255, 1},
-        {243, 243, 243, 255, 1},
-        {246, 246, 246, 255, 1},
-        {247, 247, 247, 255, 1},
-        {249, 249, 249, 255, 1},
-        {250, 250, 250, 255, 3},
-        {248, 248, 248, 255, 1},
-        {246, 246, 246, 255, 1},
-        {244, 244, 244, 255, 1},
-        {241, 241, 241, 255, 1},
-        {240, 240, 240, 255, 1},
-        {234, 234, 234, 255, 1},
-        {233, 233, 233, 255, 1},
-        {240, 240, 240, 255, 1},
-        {234, 234, 234, 255, 1},
-        {229, 229, 229, 255, 1},
-        {233, 233, 233, 255, 1},
-        {255, 255, 255, 255, 1},
-        {223, 223, 223, 98, 1},
-        {0, 0, 0, 0, 27},
-        {224, 224, 224, 191, 1},
-        {217, 217, 217, 255, 1},
-        {208, 208, 208, 255, 1},
-        {220, 220, 220, 255, 1},
-        {226, 226, 226, 255, 1},
-        {227, 227, 227, 255, 1},
-        {231, 231, 231, 255, 1},
-        {230, 230, 230, 255, 1},
-        {210, 210, 210, 255, 1},
-        {198, 198, 198, 255, 1},
-        {220, 220, 220, 255, 1},
-        {224, 224, 224, 255, 1},
-        {227, 227, 227, 255, 1},
-        {230, 230, 230, 255, 1},
-        {234, 234, 234, 255, 1},
-        {238, 238, 238, 255, 1},
-        {240, 240, 240, 255, 1},
-        {243, 243, 243, 255, 1},
-        {246, 246, 246, 255, 1},
-        {247, 247, 247, 255, 2},
-        {249, 249, 249, 255, 2},
-        {248, 248, 248, 255, 1},
-        {247, 247, 247, 255, 1},
-        {246, 246, 246, 255, 1},
-        {243, 243, 243, 255, 1},
-        {241, 241, 241, 255, 1},
-        {240, 240, 240, 255, 1},
-        {235, 235, 235, 255, 1},
-        {233, 233, 233, 255, 1},
-        {241, 241, 241, 255, 1},
-        {233, 233, 233, 255, 1},
-        {225, 225, 225, 255, 1},
-        {228, 228, 228, 255, 1},
-        {254, 254, 254, 255, 1},
-        {223, 223, 223, 120, 1},
-        {0, 0, 0, 0, 27},
-        {224, 224, 224, 143, 1},
-        {220, 220, 220, 255, 1},
-        {201, 201, 201, 255, 1},
-        {218, 218, 218, 255, 1},
-        {224, 224, 224, 255, 1},
-        {226, 226, 226, 255, 2},
-        {223, 223, 223, 255, 1},
-        {212, 212, 212, 255, 1},
-        {198, 198, 198, 255, 1},
-        {216, 216, 216, 255, 1},
-        {224, 224, 224, 255, 1},
-        {227, 227, 227, 255, 1},
-        {231, 231, 231, 255, 1},
-        {234, 234, 234, 255, 1},
-        {238, 238, 238, 255, 1},
-        {240, 240, 240, 255, 1},
-        {242, 242, 242, 255, 1},
-        {244, 244, 244, 255, 1},
-        {246, 246, 246, 255, 1},
-        {247, 247, 247, 255, 3},
-        {246, 246, 246, 255, 2},
-        {244, 244, 244, 255, 1},
-        {242, 242, 242, 255, 1},
-        {241, 241, 241, 255, 1},
-        {239, 239, 239, 255, 1},
-        {235, 235, 235, 255, 1},
-        {234, 234, 234, 255, 1},
-        {241, 241, 241, 255, 1},
-        {232, 232, 232, 255, 1},
-        {221, 221, 221, 255, 1},
-        {222, 222, 222, 255, 1},
-        {252, 252, 252, 255, 1},
-        {223, 223, 223, 130, 1},
-        {0, 0, 0, 0, 27},
-        {230, 230, 230, 72, 1},
-        {220, 220, 220, 255, 1},
-        {192, 192, 192, 255, 1},
-        {215, 215, 215, 255, 1},
-        {223, 223, 223, 255, 1},
-        {225, 225, 225, 255, 1},
-        {224, 224, 224, 255, 1},
-        {220, 220, 220, 255, 1},
-        {214, 214, 214, 255, 1},
-        {202, 202, 202, 255, 1},
-        {206, 206, 206, 255, 1},
-        {223, 223, 223, 255, 1},
-        {226, 226, 226, 255, 1},
-        {230, 230, 230, 255, 1},
-        {234, 234, 234, 255, 1},
-        {237, 237, 237, 255, 1},
-        {239, 239, 239, 255, 1},
-        {241, 241, 241, 255, 1},
-        {243, 243, 243, 255, 1},
-        {244, 244, 244, 255, 1},
-        {246, 246, 246, 255, 3},
-        {244, 244, 244, 255, 1},
-        {243, 243, 243, 255, 1},
-        {241, 241, 241, 255, 1},
-        {240, 240, 240, 255, 1},
-        {239, 239, 239, 255, 2},
-        {233, 233, 233, 255, 1},
-        {237, 237, 237, 255, 1},
-        {240, 240, 240, 255, 1},
-        {228, 228, 228, 255, 1},
-        {215, 215, 215, 255, 1},
-        {219, 219, 219, 255, 1},
-        {251, 251, 251, 255, 1},
-        {222, 222, 222, 125, 1},
-        {0, 0, 0, 0, 27},
-        {254, 254, 254, 9, 1},
-        {217, 217, 217, 230, 1},
-        {194, 194, 194, 255, 1},
-        {207, 207, 207, 255, 1},
-        {222, 222, 222, 255, 1},
-        {224, 224, 224, 255, 1},
-        {220, 220, 220, 255, 1},
-        {217, 217, 217, 255, 1},
-        {215, 215, 215, 255, 1},
-        {210, 210, 210, 255, 1},
-        {201, 201, 201, 255, 1},
-        {216, 216, 216, 255, 1},
-        {226, 226, 226, 255, 1},
-        {228, 228, 228, 255, 1},
-        {232, 232, 232, 255, 1},
-        {236, 236, 236, 255, 1},
-        {238, 238, 238, 255, 1},
-        {240, 240, 240, 255, 1},
-        {241, 241, 241, 255, 1},
-        {242, 242, 242, 255, 1},
-        {243, 243, 243, 255, 3},
-        {242, 242, 242, 255, 1},
-        {241, 241, 241, 255, 1},
-        {240, 240, 240, 255, 1},
-        {239, 239, 239, 255, 2},
-        {236, 236, 236, 255, 1},
-        {233, 233, 233, 255, 1},
-        {239, 239, 239, 255, 1},
-        {229, 229, 229, 255, 1},
-        {235, 235, 235, 255, 1},
-        {223, 223, 223, 255, 1},
-        {215, 215, 215, 255, 1},
-        {249, 249, 249, 255, 1},
-        {222, 222, 222, 103, 1},
-        {0, 0, 0, 0, 28},
-        {232, 232, 232, 138, 1},
-        {212, 212, 212, 255, 1},
-        {192, 192, 192, 255, 1},
-        {217, 217, 217, 255, 1},
-        {225, 225, 225, 255, 1},
-        {229, 229, 229, 255, 1},
-        {226, 226, 226, 255, 1},
-        {211, 211, 211, 255, 1},
-        {213, 213, 213, 255, 1},
-        {208, 208, 208, 255, 1},
-        {204, 204, 204, 255, 1},
-        {218, 218, 218, 255, 1},
-        {228, 228, 228, 255, 1},
-        {231, 231, 231, 255, 1},
-        {233, 233, 233, 255, 1},
-        {237, 237, 237, 255, 1},
-        {239, 239, 239, 255, 1},
-        {240, 240, 240, 255, 2},
-        {241, 241, 241, 255, 2},
-        {240, 240, 240, 255, 2},
-        {239, 239, 239, 255, 2},
-        {238, 238, 238, 255, 1},
-        {236, 236, 236, 255, 1},
-        {233, 233, 233, 255, 1},
-        {239, 239, 239, 255, 1},
-        {240, 240, 240, 255, 1},
-        {226, 226, 226, 255, 1},
-        {215, 215, 215, 255, 1},
-        {206, 206, 206, 255, 1},
-        {216, 216, 216, 255, 1},
-        {243, 243, 243, 255, 1},
-        {216, 216, 216, 66, 1},
-        {0, 0, 0, 0, 28},
-        {247, 247, 247, 35, 1},
-        {209, 209, 209, 251, 1},
-        {183, 183, 183, 255, 1},
-        {209, 209, 209, 255, 1},
-        {214, 214, 214, 255, 1},
-        {217, 217, 217, 255, 1},
-        {211, 211, 211, 255, 1},
-        {210, 210, 210, 255, 1},
-        {219, 219, 219, 255, 1},
-        {215, 215, 215, 255, 1},
-        {209, 209, 209, 255, 1},
-        {206, 206, 206, 255, 1},
-        {216, 216, 216, 255, 1},
-        {227, 227, 227, 255, 1},
-        {232, 232, 232, 255, 1},
-        {234, 234, 234, 255, 1},
-        {236, 236, 236, 255, 1},
-        {238, 238, 238, 255, 2},
-        {239, 239, 239, 255, 2},
-        {238, 238, 238, 255, 2},
-        {237, 237, 237, 255, 1},
-        {236, 236, 236, 255, 1},
-        {234, 234, 234, 255, 1},
-        {233, 233, 233, 255, 1},
-        {237, 237, 237, 255, 1},
-        {238, 238, 238, 255, 1},
-        {231, 231, 231, 255, 1},
-        {228, 228, 228, 255, 1},
-        {220, 220, 220, 255, 1},
-        {210, 210, 210, 255, 1},
-        {232, 232, 232, 255, 1},
-        {227, 227, 227, 242, 1},
-        {195, 195, 195, 17, 1},
-        {0, 0, 0, 0, 29},
-        {215, 215, 215, 168, 1},
-        {196, 196, 196, 255, 1},
-        {191, 191, 191, 255, 1},
-        {209, 209, 209, 255, 1},
-        {217, 217, 217, 255, 1},
-        {224, 224, 224, 255, 2},
-        {221, 221, 221, 255, 1},
-        {219, 219, 219, 255, 1},
-        {218, 218, 218, 255, 1},
-        {213, 213, 213, 255, 1},
-        {208, 208, 208, 255, 1},
-        {212, 212, 212, 255, 1},
-        {222, 222, 222, 255, 1},
-        {228, 228, 228, 255, 1},
-        {232, 232, 232, 255, 1},
-        {235, 235, 235, 255, 1},
-        {237, 237, 237, 255, 3},
-        {236, 236, 236, 255, 1},
-        {235, 235, 235, 255, 1},
-        {234, 234, 234, 255, 1},
-        {232, 232, 232, 255, 2},
-        {234, 234, 234, 255, 2},
-        {229, 229, 229, 255, 1},
-        {226, 226, 226, 255, 1},
-        {221, 221, 221, 255, 1},
-        {213, 213, 213, 255, 2},
-        {251, 251, 251, 255, 1},
-        {225, 225, 225, 165, 1},
-        {0, 0, 0, 0, 30},
-        {236, 236, 236, 42, 1},
-        {203, 203, 203, 253, 1},
-        {180, 180, 180, 255, 1},
-        {211, 211, 211, 255, 1},
-        {221, 221, 221, 255, 1},
-        {223, 223, 223, 255, 1},
-        {224, 224, 224, 255, 1},
-        {223, 223, 223, 255, 1},
-        {222, 222, 222, 255, 2},
-        {221, 221, 221, 255, 1},
-        {220, 220, 220, 255, 1},
-        {217, 217, 217, 255, 1},
-        {215, 215, 215, 255, 1},
-        {216, 216, 216, 255, 1},
-        {219, 219, 219, 255, 1},
-        {221, 221, 221, 255, 1},
-        {223, 223, 223, 255, 1},
-        {225, 225, 225, 255, 1},
-        {226, 226, 226, 255, 3},
-        {225, 225, 225, 255, 1},
-        {227, 227, 227, 255, 1},
-        {230, 230, 230, 255, 2},
-        {228, 228, 228, 255, 1},
-        {226, 226, 226, 255, 1},
-        {223, 223, 223, 255, 1},
-        {218, 218, 218, 255, 1},
-        {213, 213, 213, 255, 1},
-        {231, 231, 231, 255, 1},
-        {239, 239, 239, 255, 1},
-        {191, 191, 191, 56, 1},
-        {0, 0, 0, 0, 31},
-        {221, 221, 221, 154, 1},
-        {205, 205, 205, 255, 1},
-        {184, 184, 184, 255, 1},
-        {214, 214, 214, 255, 1},
-        {220, 220, 220, 255, 1},
-        {222, 222, 222, 255, 1},
-        {223, 223, 223, 255, 1},
-        {224, 224, 224, 255, 3},
-        {225, 225, 225, 255, 1},
-        {226, 226, 226, 255, 1},
-        {227, 227, 227, 255, 1},
-        {226, 226, 226, 255, 2},
-        {225, 225, 225, 255, 2},
-        {226, 226, 226, 255, 1},
-        {227, 227, 227, 255, 1},
-        {228, 228, 228, 255, 1},
-        {229, 229, 229, 255, 2},
-        {230, 230, 230, 255, 2},
-        {229, 229, 229, 255, 1},
-        {228, 228, 228, 255, 1},
-        {227, 227, 227, 255, 1},
-        {223, 223, 223, 255, 1},
-        {220, 220, 220, 255, 1},
-        {234, 234, 234, 255, 1},
-        {249, 249, 249, 255, 1},
-        {196, 196, 196, 215, 1},
-        {0, 0, 0, 1, 1},
-        {0, 0, 0, 0, 31},
-        {255, 255, 255, 20, 1},
-        {223, 223, 223, 236, 1},
-        {190, 190, 190, 255, 1},
-        {191, 191, 191, 255, 1},
-        {213, 213, 213, 255, 1},
-        {219, 219, 219, 255, 1},
-        {222, 222, 222, 255, 1},
-        {224, 224, 224, 255, 1},
-        {226, 226, 226, 255, 1},
-        {227, 227, 227, 255, 1},
-        {228, 228, 228, 255, 1},
-        {229, 229, 229, 255, 3},
-        {230, 230, 230, 255, 1},
-        {231, 231, 231, 255, 1},
-        {232, 232, 232, 255, 1},
-        {233, 233, 233, 255, 1},
-        {234, 234, 234, 255, 2},
-        {235, 235, 235, 255, 3},
-        {234, 234, 234, 255, 2},
-        {232, 232, 232, 255, 1},
-        {229, 229, 229, 255, 1},
-        {233, 233, 233, 255, 1},
-        {242, 242, 242, 255, 1},
-        {229, 229, 229, 255, 1},
-        {210, 210, 210, 255, 1},
-        {204, 204, 204, 106, 1},
-        {0, 0, 0, 0, 33},
-        {228, 228, 228, 87, 1},
-        {223, 223, 223, 255, 1},
-        {188, 188, 188, 255, 1},
-        {198, 198, 198, 255, 1},
-        {211, 211, 211, 255, 1},
-        {220, 220, 220, 255, 1},
-        {225, 225, 225, 255, 1},
-        {227, 227, 227, 255, 1},
-        {229, 229, 229, 255, 1},
-        {232, 232, 232, 255, 1},
-        {234, 234, 234, 255, 1},
-        {235, 235, 235, 255, 1},
-        {236, 236, 236, 255, 1},
-        {238, 238, 238, 255, 1},
-        {239, 239, 239, 255, 1},
-        {240, 240, 240, 255, 1},
-        {241, 241, 241, 255, 1},
-        {242, 242, 242, 255, 2},
-        {241, 241, 241, 255, 1},
-        {240, 240, 240, 255, 1},
-        {238, 238, 238, 255, 3},
-        {240, 240, 240, 255, 1},
-        {248, 248, 248, 255, 1},
-        {234, 234, 234, 255, 1},
-        {208, 208, 208, 255, 2},
-        {208, 208, 208, 224, 1},
-        {255, 255, 255, 8, 1},
-        {0, 0, 0, 0, 34},
-        {220, 220, 220, 154, 1},
-        {210, 210, 210, 255, 1},
-        {184, 184, 184, 255, 1},
-        {202, 202, 202, 255, 1},
-        {214, 214, 214, 255, 1},
-        {222, 222, 222, 255, 1},
-        {228, 228, 228, 255, 1},
-        {232, 232, 232, 255, 1},
-        {236, 236, 236, 255, 1},
-        {237, 237, 237, 255, 1},
-        {239, 239, 239, 255, 1},
-        {240, 240, 240, 255, 1},
-        {241, 241, 241, 255, 1},
-        {242, 242, 242, 255, 1},
-        {243, 243, 243, 255, 3},
-        {244, 244, 244, 255, 1},
-        {245, 245, 245, 255, 1},
-        {243, 243, 243, 255, 1},
-        {241, 241, 241, 255, 1},
-        {238, 238, 238, 255, 1},
-        {235, 235, 235, 255, 1},
-        {232, 232, 232, 253, 1},
-        {236, 236, 236, 254, 1},
-        {218, 218, 218, 255, 1},
-        {225, 225, 225, 250, 1},
-        {241, 241, 241, 207, 1},
-        {244, 244, 244, 49, 1},
-        {0, 0, 0, 0, 36},
-        {216, 216, 216, 181, 1},
-        {184, 184, 184, 255, 1},
-        {162, 162, 162, 255, 1},
-        {174, 174, 174, 255, 1},
-        {185, 185, 185, 255, 1},
-        {204, 204, 204, 255, 1},
-        {234, 234, 234, 255, 1},
-        {236, 236, 236, 255, 2},
-        {239, 239, 239, 255, 1},
-        {245, 245, 245, 255, 2},
-        {244, 244, 244, 255, 1},
-        {241, 241, 241, 255, 1},
-        {237, 237, 237, 255, 1},
-        {230, 230, 230, 255, 1},
-        {222, 222, 222, 255, 1},
-        {213, 213, 213, 255, 1},
-        {212, 212, 212, 255, 1},
-        {220, 220, 220, 255, 1},
-        {229, 229, 229, 255, 1},
-        {225, 225, 225, 255, 1},
-        {219, 219, 219, 231, 1},
-        {192, 192, 192, 185, 1},
-        {192, 192, 192, 166, 1},
-        {223, 223, 223, 120, 1},
-        {220, 220, 220, 51, 1},
-        {228, 228, 228, 19, 1},
-        {240, 240, 240, 17, 1},
-        {255, 255, 255, 5, 1},
-        {0, 0, 0, 0, 33},
-        {255, 255, 255, 10, 1},
-        {254, 254, 254, 44, 1},
-        {225, 225, 225, 222, 1},
-        {206, 206, 206, 255, 1},
-        {202, 202, 202, 255, 1},
-        {214, 214, 214, 255, 1},
-        {211, 211, 211, 255, 1},
-        {195, 195, 195, 255, 1},
-        {224, 224, 224, 255, 1},
-        {230, 230, 230, 255, 1},
-        {218, 218, 218, 255, 1},
-        {195, 195, 195, 255, 1},
-        {190, 190, 190, 255, 1},
-        {183, 183, 183, 255, 1},
-        {179, 179, 179, 255, 1},
-        {177, 177, 177, 255, 2},
-        {179, 179, 179, 255, 1},
-        {183, 183, 183, 255, 1},
-        {195, 195, 195, 255, 1},
-        {213, 213, 213, 255, 1},
-        {229, 229, 229, 255, 1},
-        {231, 231, 231, 255, 1},
-        {232, 232, 232, 255, 1},
-        {219, 219, 219, 255, 1},
-        {215, 215, 215, 251, 1},
-        {226, 226, 226, 250, 1},
-        {234, 234, 234, 252, 1},
-        {238, 238, 238, 248, 1},
-        {239, 239, 239, 237, 1},
-        {240, 240, 240, 223, 1},
-        {241, 241, 241, 207, 1},
-        {241, 241, 241, 189, 1},
-        {241, 241, 241, 169, 1},
-        {242, 242, 242, 146, 1},
-        {244, 244, 244, 122, 1},
-        {244, 244, 244, 98, 1},
-        {248, 248, 248, 73, 1},
-        {244, 244, 244, 50, 1},
-        {246, 246, 246, 29, 1},
-        {254, 254, 254, 11, 1},
-        {0, 0, 0, 0, 23},
-        {227, 227, 227, 185, 1},
-        {249, 249, 249, 244, 1},
-        {238, 238, 238, 248, 1},
-        {233, 233, 233, 255, 1},
-        {231, 231, 231, 255, 1},
-        {212, 212, 212, 255, 1},
-        {191, 191, 191, 255, 1},
-        {177, 177, 177, 255, 1},
-        {200, 200, 200, 255, 1},
-        {217, 217, 217, 255, 1},
-        {207, 207, 207, 255, 1},
-        {171, 171, 171, 255, 1},
-        {189, 189, 189, 255, 1},
-        {208, 208, 208, 255, 1},
-        {222, 222, 222, 255, 1},
-        {229, 229, 229, 255, 1},
-        {235, 235, 235, 255, 1},
-        {240, 240, 240, 255, 1},
-        {243, 243, 243, 255, 1},
-        {244, 244, 244, 255, 1},
-        {243, 243, 243, 255, 1},
-        {242, 242, 242, 255, 2},
-        {243, 243, 243, 255, 1},
-        {247, 247, 247, 255, 1},
-        {249, 249, 249, 255, 2},
-        {250, 250, 250, 255, 1},
-        {251, 251, 251, 255, 1},
-        {253, 253, 253, 255, 1},
-        {255, 255, 255, 255, 8},
-        {254, 254, 254, 255, 1},
-        {249, 249, 249, 247, 1},
-        {249, 249, 249, 231, 1},
-        {250, 250, 250, 208, 1},
-        {249, 249, 249, 180, 1},
-        {251, 251, 251, 147, 1},
-        {250, 250, 250, 112, 1},
-        {248, 248, 248, 76, 1},
-        {254, 254, 254, 41, 1},
-        {255, 255, 255, 12, 1},
-        {0, 0, 0, 0, 16},
-        {224, 224, 224, 158, 1},
-        {239, 239, 239, 255, 1},
-        {224, 224, 224, 255, 1},
-        {236, 236, 236, 255, 2},
-        {223, 223, 223, 255, 1},
-        {216, 216, 216, 255, 1},
-        {221, 221, 221, 255, 1},
-        {228, 228, 228, 255, 1},
-        {234, 234, 234, 255, 1},
-        {237, 237, 237, 255, 1},
-        {240, 240, 240, 255, 1},
-        {241, 241, 241, 255, 1},
-        {242, 242, 242, 255, 1},
-        {240, 240, 240, 255, 2},
-        {239, 239, 239, 255, 4},
-        {240, 240, 240, 255, 2},
-        {241, 241, 241, 255, 1},
-        {242, 242, 242, 255, 1},
-        {244, 244, 244, 255, 2},
-        {245, 245, 245, 255, 1},
-        {246, 246, 246, 255, 3},
-        {247, 247, 247, 255, 7},
-        {248, 248, 248, 255, 1},
-        {249, 249, 249, 255, 1},
-        {252, 252, 252, 255, 1},
-        {255, 255, 255, 255, 6},
-        {251, 251, 251, 255, 1},
-        {251, 251, 251, 231, 1},
-        {251, 251, 251, 196, 1},
-        {251, 251, 251, 151, 1},
-        {249, 249, 249, 100, 1},
-        {249, 249, 249, 50, 1},
-        {226, 226, 226, 9, 1},
-        {0, 0, 0, 0, 11},
-        {230, 230, 230, 62, 1},
-        {235, 235, 235, 255, 1},
-        {204, 204, 204, 255, 2},
-        {220, 220, 220, 255, 1},
-        {232, 232, 232, 255, 1},
-        {235, 235, 235, 255, 1},
-        {234, 234, 234, 255, 1},
-        {237, 237, 237, 255, 1},
-        {241, 241, 241, 255, 2},
-        {240, 240, 240, 255, 1},
-        {236, 236, 236, 255, 1},
-        {235, 235, 235, 255, 3},
-        {236, 236, 236, 255, 1},
-        {238, 238, 238, 255, 1},
-        {239, 239, 239, 255, 1},
-        {241, 241, 241, 255, 1},
-        {243, 243, 243, 255, 1},
-        {245, 245, 245, 255, 1},
-        {247, 247, 247, 255, 1},
-        {249, 249, 249, 255, 1},
-        {251, 251, 251, 255, 1},
-        {252, 252, 252, 255, 1},
-        {253, 253, 253, 255, 4},
-        {252, 252, 252, 255, 2},
-        {251, 251, 251, 255, 1},
-        {250, 250, 250, 255, 2},
-        {249, 249, 249, 255, 3},
-        {248, 248, 248, 255, 1},
-        {247, 247, 247, 255, 1},
-        {246, 246, 246, 255, 2},
-        {245, 245, 245, 255, 1},
-        {244, 244, 244, 255, 1},
-        {243, 243, 243, 255, 2},
-        {245, 245, 245, 255, 1},
-        {251, 251, 251, 255, 1},
-        {255, 255, 255, 255, 4},
-        {250, 250, 250, 226, 1},
-        {250, 250, 250, 172, 1},
-        {247, 247, 247, 96, 1},
-        {212, 212, 212, 12, 1},
-        {0, 0, 0, 0, 9},
-        {214, 214, 214, 159, 1},
-        {227, 227, 227, 255, 1},
-        {203, 203, 203, 255, 1},
-        {192, 192, 192, 255, 1},
-        {202, 202, 202, 255, 1},
-        {217, 217, 217, 255, 1},
-        {229, 229, 229, 255, 1},
-        {237, 237, 237, 255, 1},
-        {241, 241, 241, 255, 1},
-        {243, 243, 243, 255, 1},
-        {242, 242, 242, 255, 1},
-        {232, 232, 232, 255, 1},
-        {230, 230, 230, 255, 1},
-        {233, 233, 233, 255, 1},
-        {236, 236, 236, 255, 1},
-        {239, 239, 239, 255, 1},
-        {242, 242, 242, 255, 1},
-        {245, 245, 245, 255, 1},
-        {248, 248, 248, 255, 1},
-        {249, 249, 249, 255, 1},
-        {248, 248, 248, 255, 1},
-        {246, 246, 246, 255, 1},
-        {245, 245, 245, 255, 1},
-        {244, 244, 244, 255, 1},
-        {243, 243, 243, 255, 1},
-        {242, 242, 242, 255, 1},
-        {240, 240, 240, 255, 1},
-        {238, 238, 238, 255, 1},
-        {236, 236, 236, 255, 1},
-        {235, 235, 235, 255, 1},
-        {234, 234, 234, 255, 4},
-        {235, 235, 235, 255, 1},
-        {236, 236, 236, 255, 1},
-        {238, 238, 238, 255, 1},
-        {240, 240, 240, 255, 1},
-        {241, 241, 241, 255, 1},
-        {244, 244, 244, 255, 1},
-        {245, 245, 245, 255, 1},
-        {246, 246, 246, 255, 3},
-        {244, 244, 244, 255, 1},
-        {242, 242, 242, 255, 1},
-        {240, 240, 240, 255, 1},
-        {239, 239, 239, 255, 1},
-        {240, 240, 240, 255, 1},
-        {242, 242, 242, 255, 1},
-        {248, 248, 248, 255, 1},
-        {255, 255, 255, 255, 3},
-        {250, 250, 250, 221, 1},
-        {244, 244, 244, 50, 1},
-        {0, 0, 0, 0, 9},
-        {208, 208, 208, 104, 1},
-        {205, 205, 205, 240, 1},
-        {207, 207, 207, 255, 1},
-        {191, 191, 191, 255, 1},
-        {194, 194, 194, 255, 1},
-        {207, 207, 207, 255, 1},
-        {221, 221, 221, 255, 1},
-        {232, 232, 232, 255, 1},
-        {241, 241, 241, 255, 1},
-        {246, 246, 246, 255, 2},
-        {240, 240, 240, 255, 1},
-        {236, 236, 236, 255, 1},
-        {233, 233, 233, 255, 1},
-        {226, 226, 226, 255, 1},
-        {215, 215, 215, 255, 1},
-        {205, 205, 205, 255, 1},
-        {198, 198, 198, 255, 1},
-        {193, 193, 193, 255, 1},
-        {191, 191, 191, 255, 1},
-        {192, 192, 192, 255, 1},
-        {196, 196, 196, 255, 1},
-        {202, 202, 202, 255, 1},
-        {209, 209, 209, 255, 1},
-        {215, 215, 215, 255, 1},
-        {219, 219, 219, 255, 1},
-        {221, 221, 221, 255, 1},
-        {224, 224, 224, 255, 1},
-        {226, 226, 226, 255, 1},
-        {227, 227, 227, 255, 3},
-        {226, 226, 226, 255, 2},
-        {225, 225, 225, 255, 1},
-        {223, 223, 223, 255, 1},
-        {221, 221, 221, 255, 1},
-        {220, 220, 220, 255, 1},
-        {218, 218, 218, 255, 1},
-        {216, 216, 216, 255, 1},
-        {215, 215, 215, 255, 1},
-        {216, 216, 216, 255, 1},
-        {219, 219, 219, 255, 1},
-        {225, 225, 225, 255, 1},
-        {233, 233, 233, 255, 1},
-        {239, 239, 239, 255, 2},
-        {236, 236, 236, 255, 1},
-        {233, 233, 233, 255, 1},
-        {235, 235, 235, 255, 1},
-        {246, 246, 246, 255, 1},
-        {252, 252, 252, 255, 1},
-        {253, 253, 253, 255, 1},
-        {255, 255, 255, 255, 1},
-        {244, 244, 244, 199, 1},
-        {127, 127, 127, 2, 1},
-        {0, 0, 0, 0, 9},
-        {195, 195, 195, 34, 1},
-        {196, 196, 196, 171, 1},
-        {199, 199, 199, 255, 1},
-        {200, 200, 200, 255, 1},
-        {195, 195, 195, 255, 1},
-        {205, 205, 205, 255, 1},
-        {214, 214, 214, 255, 1},
-        {223, 223, 223, 255, 1},
-        {233, 233, 233, 255, 1},
-        {242, 242, 242, 255, 1},
-        {249, 249, 249, 255, 1},
-        {251, 251, 251, 255, 1},
-        {250, 250, 250, 255, 1},
-        {240, 240, 240, 255, 1},
-        {219, 219, 219, 255, 1},
-        {203, 203, 203, 255, 1},
-        {195, 195, 195, 255, 1},
-        {193, 193, 193, 255, 1},
-        {197, 197, 197, 255, 1},
-        {204, 204, 204, 255, 1},
-        {213, 213, 213, 255, 1},
-        {223, 223, 223, 255, 1},
-        {231, 231, 231, 255, 1},
-        {237, 237, 237, 255, 1},
-        {240, 240, 240, 255, 1},
-        {243, 243, 243, 255, 1},
-        {245, 245, 245, 255, 1},
-        {246, 246, 246, 255, 1},
-        {247, 247, 247, 255, 2},
-        {246, 246, 246, 255, 1},
-        {245, 245, 245, 255, 1},
-        {244, 244, 244, 255, 1},
-        {243, 243, 243, 255, 1},
-        {241, 241, 241, 255, 1},
-        {239, 239, 239, 255, 1},
-        {236, 236, 236, 255, 1},
-        {232, 232, 232, 255, 1},
-        {228, 228, 228, 255, 1},
-        {222, 222, 222, 255, 1},
-        {215, 215, 215, 255, 1},
-        {207, 207, 207, 255, 1},
-        {200, 200, 200, 255, 1},
-        {196, 196, 196, 255, 1},
-        {200, 200, 200, 255, 1},
-        {217, 217, 217, 255, 1},
-        {235, 235, 235, 255, 1},
-        {240, 240, 240, 255, 1},
-        {248, 248, 248, 255, 1},
-        {255, 255, 255, 255, 2},
-        {254, 254, 254, 255, 1},
-        {253, 253, 253, 255, 1},
-        {236, 236, 236, 240, 1},
-        {226, 226, 226, 9, 1},
-        {0, 0, 0, 0, 11},
-        {192, 192, 192, 74, 1},
-        {193, 193, 193, 199, 1},
-        {203, 203, 203, 255, 1},
-        {206, 206, 206, 255, 1},
-        {209, 209, 209, 255, 1},
-        {213, 213, 213, 255, 1},
-        {217, 217, 217, 255, 1},
-        {222, 222, 222, 255, 1},
-        {227, 227, 227, 255, 1},
-        {232, 232, 232, 255, 1},
-        {238, 238, 238, 255, 1},
-        {244, 244, 244, 255, 1},
-        {251, 251, 251, 255, 1},
-        {255, 255, 255, 255, 2},
-        {254, 254, 254, 255, 1},
-        {251, 251, 251, 255, 1},
-        {249, 249, 249, 255, 1},
-        {248, 248, 248, 255, 5},
-        {249, 249, 249, 255, 1},
-        {248, 248, 248, 255, 5},
-        {249, 249, 249, 255, 1},
-        {248, 248, 248, 255, 2},
-        {249, 249, 249, 255, 4},
-        {250, 250, 250, 255, 2},
-        {249, 249, 249, 255, 1},
-        {246, 246, 246, 255, 1},
-        {243, 243, 243, 255, 1},
-        {240, 240, 240, 255, 1},
-        {241, 241, 241, 255, 1},
-        {248, 248, 248, 255, 1},
-        {255, 255, 255, 255, 2},
-        {252, 252, 252, 255, 1},
-        {247, 247, 247, 255, 1},
-        {240, 240, 240, 255, 1},
-        {233, 233, 233, 255, 1},
-        {252, 252, 252, 255, 1},
-        {228, 228, 228, 182, 1},
-        {0, 0, 0, 0, 14},
-        {178, 178, 178, 90, 1},
-        {172, 172, 172, 245, 1},
-        {201, 201, 201, 255, 1},
-        {213, 213, 213, 255, 1},
-        {216, 216, 216, 255, 1},
-        {219, 219, 219, 255, 1},
-        {223, 223, 223, 255, 1},
-        {225, 225, 225, 255, 1},
-        {226, 226, 226, 255, 1},
-        {227, 227, 227, 255, 2},
-        {229, 229, 229, 255, 1},
-        {231, 231, 231, 255, 1},
-        {234, 234, 234, 255, 1},
-        {237, 237, 237, 255, 1},
-        {241, 241, 241, 255, 1},
-        {243, 243, 243, 255, 1},
-        {246, 246, 246, 255, 1},
-        {248, 248, 248, 255, 1},
-        {249, 249, 249, 255, 1},
-        {250, 250, 250, 255, 1},
-        {251, 251, 251, 255, 1},
-        {252, 252, 252, 255, 2},
-        {253, 253, 253, 255, 3},
-        {254, 254, 254, 255, 2},
-        {255, 255, 255, 255, 6},
-        {254, 254, 254, 255, 1},
-        {253, 253, 253, 255, 1},
-        {252, 252, 252, 255, 1},
-        {251, 251, 251, 255, 1},
-        {249, 249, 249, 255, 1},
-        {246, 246, 246, 255, 1},
-        {240, 240, 240, 255, 1},
-        {233, 233, 233, 255, 1},
-        {227, 227, 227, 255, 1},
-        {223, 223, 223, 255, 1},
-        {219, 219, 219, 255, 1},
-        {222, 222, 222, 255, 1},
-        {240, 240, 240, 255, 1},
-        {228, 228, 228, 223, 1},
-        {227, 227, 227, 37, 1},
-        {0, 0, 0, 0, 14},
-        {0, 0, 0, 2, 1},
-        {110, 110, 110, 236, 1},
-        {141, 141, 141, 255, 1},
-        {162, 162, 162, 255, 1},
-        {193, 193, 193, 255, 1},
-        {211, 211, 211, 255, 1},
-        {220, 220, 220, 255, 1},
-        {224, 224, 224, 255, 1},
-        {227, 227, 227, 255, 1},
-        {230, 230, 230, 255, 1},
-        {231, 231, 231, 255, 2},
-        {232, 232, 232, 255, 1},
-        {231, 231, 231, 255, 3},
-        {232, 232, 232, 255, 2},
-        {233, 233, 233, 255, 1},
-        {234, 234, 234, 255, 1},
-        {235, 235, 235, 255, 1},
-        {236, 236, 236, 255, 1},
-        {237, 237, 237, 255, 1},
-        {238, 238, 238, 255, 1},
-        {237, 237, 237, 255, 2},
-        {236, 236, 236, 255, 1},
-        {235, 235, 235, 255, 1},
-        {233, 233, 233, 255, 1},
-        {232, 232, 232, 255, 1},
-        {231, 231, 231, 255, 2},
-        {230, 230, 230, 255, 1},
-        {229, 229, 229, 255, 1},
-        {227, 227, 227, 255, 1},
-        {225, 225, 225, 255, 1},
-        {223, 223, 223, 255, 1},
-        {221, 221, 221, 255, 1},
-        {219, 219, 219, 255, 1},
-        {216, 216, 216, 255, 1},
-        {212, 212, 212, 255, 1},
-        {210, 210, 210, 255, 1},
-        {208, 208, 208, 255, 1},
-        {209, 209, 209, 255, 1},
-        {212, 212, 212, 255, 1},
-        {217, 217, 217, 255, 1},
-        {213, 213, 213, 252, 1},
-        {221, 221, 221, 137, 1},
-        {201, 201, 201, 19, 1},
-        {0, 0, 0, 0, 15},
-        {111, 111, 111, 16, 1},
-        {133, 133, 133, 236, 1},
-        {135, 135, 135, 255, 1},
-        {120, 120, 120, 255, 1},
-        {135, 135, 135, 255, 1},
-        {165, 165, 165, 255, 1},
-        {184, 184, 184, 255, 1},
-        {197, 197, 197, 255, 1},
-        {209, 209, 209, 255, 1},
-        {218, 218, 218, 255, 1},
-        {225, 225, 225, 255, 1},
-        {230, 230, 230, 255, 1},
-        {234, 234, 234, 255, 1},
-        {238, 238, 238, 255, 1},
-        {240, 240, 240, 255, 1},
-        {242, 242, 242, 255, 1},
-        {244, 244, 244, 255, 1},
-        {246, 246, 246, 255, 1},
-        {247, 247, 247, 255, 1},
-        {248, 248, 248, 255, 3},
-        {246, 246, 246, 255, 1},
-        {244, 244, 244, 255, 1},
-        {241, 241, 241, 255, 1},
-        {238, 238, 238, 255, 1},
-        {235, 235, 235, 255, 1},
-        {232, 232, 232, 255, 1},
-        {228, 228, 228, 255, 1},
-        {226, 226, 226, 255, 1},
-        {223, 223, 223, 255, 1},
-        {221, 221, 221, 255, 1},
-        {218, 218, 218, 255, 1},
-        {216, 216, 216, 255, 1},
-        {215, 215, 215, 255, 1},
-        {213, 213, 213, 255, 1},
-        {211, 211, 211, 255, 1},
-        {209, 209, 209, 255, 1},
-        {207, 207, 207, 255, 1},
-        {204, 204, 204, 255, 1},
-        {200, 200, 200, 255, 1},
-        {198, 198, 198, 255, 1},
-        {196, 196, 196, 255, 1},
-        {195, 195, 195, 255, 1},
-        {191, 191, 191, 255, 1},
-        {200, 200, 200, 255, 1},
-        {169, 169, 169, 122, 1},
-        {0, 0, 0, 0, 17},
-        {127, 127, 127, 4, 1},
-        {158, 158, 158, 222, 1},
-        {165, 165, 165, 255, 1},
-        {149, 149, 149, 255, 1},
-        {137, 137, 137, 255, 1},
-        {155, 155, 155, 255, 1},
-        {172, 172, 172, 255, 1},
-        {176, 176, 176, 255, 1},
-        {179, 179, 179, 255, 1},
-        {184, 184, 184, 255, 1},
-        {189, 189, 189, 255, 1},
-        {196, 196, 196, 255, 1},
-        {204, 204, 204, 255, 1},
-        {212, 212, 212, 255, 1},
-        {220, 220, 220, 255, 1},
-        {228, 228, 228, 255, 1},
-        {234, 234, 234, 255, 1},
-        {241, 241, 241, 255, 1},
-        {246, 246, 246, 255, 1},
-        {251, 251, 251, 255, 1},
-        {253, 253, 253, 255, 1},
-        {254, 254, 254, 255, 1},
-        {253, 253, 253, 255, 1},
-        {250, 250, 250, 255, 1},
-        {245, 245, 245, 255, 1},
-        {241, 241, 241, 255, 1},
-        {238, 238, 238, 255, 1},
-        {234, 234, 234, 255, 1},
-        {230, 230, 230, 255, 1},
-        {226, 226, 226, 255, 1},
-        {221, 221, 221, 255, 1},
-        {217, 217, 217, 255, 1},
-        {213, 213, 213, 255, 1},
-        {209, 209, 209, 255, 1},
-        {205, 205, 205, 255, 1},
-        {201, 201, 201, 255, 1},
-        {196, 196, 196, 255, 1},
-        {191, 191, 191, 255, 1},
-        {185, 185, 185, 255, 1},
-        {180, 180, 180, 255, 1},
-        {176, 176, 176, 255, 1},
-        {174, 174, 174, 255, 1},
-        {175, 175, 175, 255, 1},
-        {176, 176, 176, 255, 1},
-        {198, 198, 198, 255, 1},
-        {180, 180, 180, 178, 1},
-        {0, 0, 0, 0, 19},
-        {176, 176, 176, 192, 1},
-        {198, 198, 198, 255, 1},
-        {184, 184, 184, 255, 1},
-        {161, 161, 161, 255, 1},
-        {153, 153, 153, 255, 1},
-        {176, 176, 176, 255, 1},
-        {189, 189, 189, 255, 1},
-        {193, 193, 193, 255, 1},
-        {194, 194, 194, 255, 1},
-        {195, 195, 195, 255, 1},
-        {196, 196, 196, 255, 1},
-        {197, 197, 197, 255, 1},
-        {199, 199, 199, 255, 1},
-        {201, 201, 201, 255, 1},
-        {204, 204, 204, 255, 1},
-        {207, 207, 207, 255, 1},
-        {211, 211, 211, 255, 1},
-        {214, 214, 214, 255, 1},
-        {215, 215, 215, 255, 1},
-        {217, 217, 217, 255, 1},
-        {216, 216, 216, 255, 1},
-        {214, 214, 214, 255, 1},
-        {211, 211, 211, 255, 1},
-        {208, 208, 208, 255, 1},
-        {205, 205, 205, 255, 1},
-        {201, 201, 201, 255, 1},
-        {197, 197, 197, 255, 1},
-        {193, 193, 193, 255, 1},
-        {189, 189, 189, 255, 1},
-        {186, 186, 186, 255, 1},
-        {182, 182, 182, 255, 1},
-        {179, 179, 179, 255, 1},
-        {177, 177, 177, 255, 1},
-        {175, 175, 175, 255, 1},
-        {173, 173, 173, 255, 1},
-        {171, 171, 171, 255, 1},
-        {170, 170, 170, 255, 1},
-        {171, 171, 171, 255, 1},
-        {174, 174, 174, 255, 1},
-        {179, 179, 179, 255, 1},
-        {185, 185, 185, 255, 1},
-        {192, 192, 192, 255, 1},
-        {216, 216, 216, 255, 1},
-        {201, 201, 201, 185, 1},
-        {223, 223, 223, 8, 1},
-        {0, 0, 0, 0, 19},
-        {181, 181, 181, 143, 1},
-        {214, 214, 214, 255, 1},
-        {204, 204, 204, 255, 1},
-        {192, 192, 192, 255, 1},
-        {167, 167, 167, 255, 2},
-        {185, 185, 185, 255, 1},
-        {193, 193, 193, 255, 1},
-        {200, 200, 200, 255, 1},
-        {205, 205, 205, 255, 1},
-        {209, 209, 209, 255, 1},
-        {213, 213, 213, 255, 1},
-        {216, 216, 216, 255, 1},
-        {219, 219, 219, 255, 1},
-        {221, 221, 221, 255, 1},
-        {223, 223, 223, 255, 1},
-        {224, 224, 224, 255, 1},
-        {226, 226, 226, 255, 2},
-        {225, 225, 225, 255, 1},
-        {221, 221, 221, 255, 1},
-        {216, 216, 216, 255, 1},
-        {211, 211, 211, 255, 1},
-        {207, 207, 207, 255, 1},
-        {202, 202, 202, 255, 1},
-        {198, 198, 198, 255, 1},
-        {194, 194, 194, 255, 1},
-        {191, 191, 191, 255, 1},
-        {188, 188, 188, 255, 1},
-        {186, 186, 186, 255, 1},
-        {185, 185, 185, 255, 1},
-        {184, 184, 184, 255, 1},
-        {185, 185, 185, 255, 1},
-        {186, 186, 186, 255, 2},
-        {187, 187, 187, 255, 1},
-        {190, 190, 190, 255, 1},
-        {193, 193, 193, 255, 1},
-        {197, 197, 197, 255, 1},
-        {201, 201, 201, 255, 1},
-        {210, 210, 210, 255, 1},
-        {230, 230, 230, 255, 1},
-        {213, 213, 213, 164, 1},
-        {255, 255, 255, 4, 1},
-        {0, 0, 0, 0, 20},
-        {179, 179, 179, 78, 1},
-        {214, 214, 214, 255, 1},
-        {212, 212, 212, 255, 1},
-        {210, 210, 210, 255, 1},
-        {196, 196, 196, 255, 1},
-        {171, 171, 171, 255, 1},
-        {174, 174, 174, 255, 1},
-        {187, 187, 187, 255, 1},
-        {196, 196, 196, 255, 1},
-        {202, 202, 202, 255, 1},
-        {209, 209, 209, 255, 1},
-        {214, 214, 214, 255, 1},
-        {219, 219, 219, 255, 1},
-        {223, 223, 223, 255, 1},
-        {227, 227, 227, 255, 1},
-        {230, 230, 230, 255, 1},
-        {234, 234, 234, 255, 1},
-        {239, 239, 239, 255, 1},
-        {241, 241, 241, 255, 1},
-        {242, 242, 242, 255, 1},
-        {239, 239, 239, 255, 1},
-        {234, 234, 234, 255, 1},
-        {229, 229, 229, 255, 1},
-        {225, 225, 225, 255, 1},
-        {221, 221, 221, 255, 1},
-        {217, 217, 217, 255, 1},
-        {213, 213, 213, 255, 1},
-        {210, 210, 210, 255, 1},
-        {206, 206, 206, 255, 1},
-        {204, 204, 204, 255, 1},
-        {201, 201, 201, 255, 1},
-        {200, 200, 200, 255, 2},
-        {201, 201, 201, 255, 2},
-        {203, 203, 203, 255, 1},
-        {206, 206, 206, 255, 1},
-        {210, 210, 210, 255, 1},
-        {214, 214, 214, 255, 1},
-        {230, 230, 230, 255, 1},
-        {229, 229, 229, 255, 1},
-        {221, 221, 221, 122, 1},
-        {0, 0, 0, 0, 22},
-        {150, 150, 150, 17, 1},
-        {201, 201, 201, 241, 1},
-        {222, 222, 222, 255, 1},
-        {219, 219, 219, 255, 1},
-        {212, 212, 212, 255, 1},
-        {196, 196, 196, 255, 1},
-        {173, 173, 173, 255, 1},
-        {178, 178, 178, 255, 1},
-        {189, 189, 189, 255, 1},
-        {196, 196, 196, 255, 1},
-        {204, 204, 204, 255, 1},
-        {211, 211, 211, 255, 1},
-        {218, 218, 218, 255, 1},
-        {223, 223, 223, 255, 1},
-        {228, 228, 228, 255, 1},
-        {232, 232, 232, 255, 1},
-        {237, 237, 237, 255, 1},
-        {243, 243, 243, 255, 1},
-        {247, 247, 247, 255, 1},
-        {248, 248, 248, 255, 1},
-        {245, 245, 245, 255, 1},
-        {240, 240, 240, 255, 1},
-        {235, 235, 235, 255, 1},
-        {231, 231, 231, 255, 1},
-        {228, 228, 228, 255, 1},
-        {224, 224, 224, 255, 1},
-        {220, 220, 220, 255, 1},
-        {216, 216, 216, 255, 1},
-        {211, 211, 211, 255, 1},
-        {209, 209, 209, 255, 1},
-        {207, 207, 207, 255, 2},
-        {208, 208, 208, 255, 2},
-        {211, 211, 211, 255, 1},
-        {214, 214, 214, 255, 1},
-        {217, 217, 217, 255, 1},
-        {225, 225, 225, 255, 1},
-        {245, 245, 245, 255, 1},
-        {231, 231, 231, 218, 1},
-        {224, 224, 224, 66, 1},
-        {0, 0, 0, 0, 24},
-        {198, 198, 198, 172, 1},
-        {237, 237, 237, 255, 1},
-        {228, 228, 228, 255, 1},
-        {219, 219, 219, 255, 1},
-        {208, 208, 208, 255, 1},
-        {190, 190, 190, 255, 1},
-        {175, 175, 175, 255, 1},
-        {183, 183, 183, 255, 1},
-        {191, 191, 191, 255, 1},
-        {198, 198, 198, 255, 1},
-        {207, 207, 207, 255, 1},
-        {214, 214, 214, 255, 1},
-        {221, 221, 221, 255, 1},
-        {227, 227, 227, 255, 1},
-        {232, 232, 232, 255, 1},
-        {237, 237, 237, 255, 1},
-        {243, 243, 243, 255, 1},
-        {248, 248, 248, 255, 2},
-        {246, 246, 246, 255, 1},
-        {241, 241, 241, 255, 1},
-        {237, 237, 237, 255, 1},
-        {232, 232, 232, 255, 1},
-        {229, 229, 229, 255, 1},
-        {225, 225, 225, 255, 1},
-        {220, 220, 220, 255, 1},
-        {215, 215, 215, 255, 1},
-        {211, 211, 211, 255, 1},
-        {210, 210, 210, 255, 1},
-        {209, 209, 209, 255, 2},
-        {211, 211, 211, 255, 1},
-        {215, 215, 215, 255, 1},
-        {218, 218, 218, 255, 1},
-        {222, 222, 222, 255, 1},
-        {240, 240, 240, 255, 1},
-        {237, 237, 237, 255, 1},
-        {232, 232, 232, 147, 1},
-        {200, 200, 200, 14, 1},
-        {0, 0, 0, 0, 25},
-        {192, 192, 192, 82, 1},
-        {235, 235, 235, 255, 1},
-        {239, 239, 239, 255, 1},
-        {229, 229, 229, 255, 1},
-        {214, 214, 214, 255, 1},
-        {200, 200, 200, 255, 1},
-        {184, 184, 184, 255, 1},
-        {180, 180, 180, 255, 1},
-        {186, 186, 186, 255, 1},
-        {193, 193, 193, 255, 1},
-        {201, 201, 201, 255, 1},
-        {209, 209, 209, 255, 1},
-        {217, 217, 217, 255, 1},
-        {224, 224, 224, 255, 1},
-        {230, 230, 230, 255, 1},
-        {235, 235, 235, 255, 1},
-        {240, 240, 240, 255, 1},
-        {244, 244, 244, 255, 1},
-        {245, 245, 245, 255, 1},
-        {242, 242, 242, 255, 1},
-        {239, 239, 239, 255, 1},
-        {235, 235, 235, 255, 1},
-        {231, 231, 231, 255, 1},
-        {227, 227, 227, 255, 1},
-        {222, 222, 222, 255, 1},
-        {218, 218, 218, 255, 1},
-        {214, 214, 214, 255, 1},
-        {212, 212, 212, 255, 1},
-        {211, 211, 211, 255, 1},
-        {212, 212, 212, 255, 1},
-        {214, 214, 214, 255, 1},
-        {217, 217, 217, 255, 1},
-        {220, 220, 220, 255, 1},
-        {235, 235, 235, 255, 1},
-        {247, 247, 247, 255, 1},
-        {235, 235, 235, 197, 1},
-        {230, 230, 230, 62, 1},
-        {0, 0, 0, 0, 27},
-        {162, 162, 162, 11, 1},
-        {213, 213, 213, 231, 1},
-        {250, 250, 250, 255, 1},
-        {239, 239, 239, 255, 1},
-        {219, 219, 219, 255, 1},
-        {206, 206, 206, 255, 1},
-        {192, 192, 192, 255, 1},
-        {182, 182, 182, 255, 1},
-        {184, 184, 184, 255, 1},
-        {188, 188, 188, 255, 1},
-        {196, 196, 196, 255, 1},
-        {204, 204, 204, 255, 1},
-        {212, 212, 212, 255, 1},
-        {219, 219, 219, 255, 1},
-        {226, 226, 226, 255, 1},
-        {231, 231, 231, 255, 1},
-        {236, 236, 236, 255, 1},
-        {239, 239, 239, 255, 2},
-        {238, 238, 238, 255, 1},
-        {235, 235, 235, 255, 1},
-        {232, 232, 232, 255, 1},
-        {229, 229, 229, 255, 1},
-        {225, 225, 225, 255, 1},
-        {220, 220, 220, 255, 1},
-        {217, 217, 217, 255, 1},
-        {216, 216, 216, 255, 1},
-        {215, 215, 215, 255, 2},
-        {216, 216, 216, 255, 1},
-        {220, 220, 220, 255, 1},
-        {234, 234, 234, 255, 1},
-        {249, 249, 249, 255, 1},
-        {237, 237, 237, 219, 1},
-        {233, 233, 233, 97, 1},
-        {0, 0, 0, 0, 30},
-        {201, 201, 201, 206, 1},
-        {246, 246, 246, 255, 1},
-        {243, 243, 243, 255, 1},
-        {224, 224, 224, 255, 1},
-        {210, 210, 210, 255, 1},
-        {198, 198, 198, 255, 1},
-        {187, 187, 187, 255, 1},
-        {185, 185, 185, 255, 1},
-        {188, 188, 188, 255, 1},
-        {192, 192, 192, 255, 1},
-        {200, 200, 200, 255, 1},
-        {207, 207, 207, 255, 1},
-        {214, 214, 214, 255, 1},
-        {220, 220, 220, 255, 1},
-        {226, 226, 226, 255, 1},
-        {231, 231, 231, 255, 1},
-        {233, 233, 233, 255, 2},
-        {232, 232, 232, 255, 1},
-        {231, 231, 231, 255, 1},
-        {229, 229, 229, 255, 1},
-        {226, 226, 226, 255, 1},
-        {223, 223, 223, 255, 1},
-        {220, 220, 220, 255, 1},
-        {219, 219, 219, 255, 1},
-        {218, 218, 218, 255, 2},
-        {220, 220, 220, 255, 1},
-        {236, 236, 236, 255, 1},
-        {247, 247, 247, 255, 1},
-        {238, 238, 238, 219, 1},
-        {241, 241, 241, 110, 1},
-        {204, 204, 204, 10, 1},
-        {0, 0, 0, 0, 30},
-        {115, 115, 115, 11, 1},
-        {184, 184, 184, 233, 1},
-        {230, 230, 230, 255, 1},
-        {237, 237, 237, 255, 1},
-        {225, 225, 225, 255, 1},
-        {212, 212, 212, 255, 1},
-        {200, 200, 200, 255, 1},
-        {190, 190, 190, 255, 1},
-        {187, 187, 187, 255, 1},
-        {190, 190, 190, 255, 1},
-        {191, 191, 191, 255, 1},
-        {196, 196, 196, 255, 1},
-        {202, 202, 202, 255, 1},
-        {208, 208, 208, 255, 1},
-        {213, 213, 213, 255, 1},
-        {219, 219, 219, 255, 1},
-        {224, 224, 224, 255, 1},
-        {226, 226, 226, 255, 1},
-        {227, 227, 227, 255, 1},
-        {226, 226, 226, 255, 1},
-        {225, 225, 225, 255, 1},
-        {224, 224, 224, 255, 1},
-        {223, 223, 223, 255, 2},
-        {222, 222, 222, 255, 1},
-        {223, 223, 223, 255, 2},
-        {226, 226, 226, 255, 1},
-        {231, 231, 231, 255, 1},
-        {235, 235, 235, 196, 1},
-        {239, 239, 239, 96, 1},
-        {226, 226, 226, 9, 1},
-        {0, 0, 0, 0, 32},
-        {145, 145, 145, 51, 1},
-        {177, 177, 177, 255, 1},
-        {215, 215, 215, 255, 1},
-        {229, 229, 229, 255, 1},
-        {224, 224, 224, 255, 1},
-        {213, 213, 213, 255, 1},
-        {202, 202, 202, 255, 1},
-        {193, 193, 193, 255, 1},
-        {189, 189, 189, 255, 1},
-        {190, 190, 190, 255, 1},
-        {191, 191, 191, 255, 1},
-        {194, 194, 194, 255, 1},
-        {198, 198, 198, 255, 1},
-        {202, 202, 202, 255, 1},
-        {206, 206, 206, 255, 1},
-        {211, 211, 211, 255, 1},
-        {215, 215, 215, 255, 1},
-        {219, 219, 219, 255, 1},
-        {220, 220, 220, 255, 1},
-        {221, 221, 221, 255, 2},
-        {223, 223, 223, 255, 1},
-        {225, 225, 225, 255, 2},
-        {224, 224, 224, 255, 1},
-        {222, 222, 222, 255, 1},
-        {218, 218, 218, 255, 1},
-        {217, 217, 217, 255, 1},
-        {229, 229, 229, 255, 1},
-        {209, 209, 209, 62, 1},
-        {0, 0, 0, 0, 34},
-        {143, 143, 143, 117, 1},
-        {176, 176, 176, 255, 1},
-        {205, 205, 205, 255, 1},
-        {223, 223, 223, 255, 1},
-        {221, 221, 221, 255, 1},
-        {213, 213, 213, 255, 1},
-        {202, 202, 202, 255, 1},
-        {196, 196, 196, 255, 1},
-        {194, 194, 194, 255, 1},
-        {183, 183, 183, 255, 1},
-        {182, 182, 182, 255, 1},
-        {186, 186, 186, 255, 1},
-        {190, 190, 190, 255, 1},
-        {196, 196, 196, 255, 1},
-        {201, 201, 201, 255, 1},
-        {207, 207, 207, 255, 1},
-        {211, 211, 211, 255, 1},
-        {213, 213, 213, 255, 1},
-        {214, 214, 214, 255, 3},
-        {213, 213, 213, 255, 1},
-        {210, 210, 210, 255, 1},
-        {206, 206, 206, 255, 1},
-        {201, 201, 201, 255, 1},
-        {196, 196, 196, 255, 1},
-        {198, 198, 198, 255, 1},
-        {206, 206, 206, 255, 1},
-        {234, 234, 234, 255, 1},
-        {218, 218, 218, 141, 1},
-        {0, 0, 0, 0, 34},
-        {144, 144, 144, 199, 1},
-        {167, 167, 167, 255, 1},
-        {198, 198, 198, 255, 1},
-        {217, 217, 217, 255, 2},
-        {211, 211, 211, 255, 1},
-        {202, 202, 202, 255, 1},
-        {197, 197, 197, 255, 1},
-        {186, 186, 186, 255, 1},
-        {178, 178, 178, 255, 1},
-        {181, 181, 181, 255, 1},
-        {185, 185, 185, 255, 1},
-        {190, 190, 190, 255, 1},
-        {197, 197, 197, 255, 1},
-        {207, 207, 207, 255, 1},
-        {222, 222, 222, 255, 1},
-        {233, 233, 233, 255, 1},
-        {232, 232, 232, 255, 1},
-        {226, 226, 226, 255, 1},
-        {222, 222, 222, 255, 1},
-        {217, 217, 217, 255, 1},
-        {210, 210, 210, 255, 1},
-        {204, 204, 204, 255, 1},
-        {203, 203, 203, 255, 1},
-        {202, 202, 202, 255, 1},
-        {201, 201, 201, 255, 1},
-        {205, 205, 205, 255, 1},
-        {213, 213, 213, 255, 1},
-        {229, 229, 229, 255, 1},
-        {222, 222, 222, 209, 1},
-        {0, 0, 0, 0, 33},
-        {144, 144, 144, 44, 1},
-        {151, 151, 151, 254, 1},
-        {162, 162, 162, 255, 1},
-        {192, 192, 192, 255, 1},
-        {211, 211, 211, 255, 1},
-        {213, 213, 213, 255, 1},
-        {207, 207, 207, 255, 1},
-        {200, 200, 200, 255, 1},
-        {190, 190, 190, 255, 1},
-        {180, 180, 180, 255, 2},
-        {183, 183, 183, 255, 1},
-        {188, 188, 188, 255, 1},
-        {196, 196, 196, 255, 1},
-        {204, 204, 204, 255, 1},
-        {215, 215, 215, 255, 1},
-        {233, 233, 233, 255, 1},
-        {245, 245, 245, 255, 1},
-        {243, 243, 243, 255, 1},
-        {237, 237, 237, 255, 1},
-        {232, 232, 232, 255, 1},
-        {227, 227, 227, 255, 1},
-        {219, 219, 219, 255, 1},
-        {214, 214, 214, 255, 1},
-        {211, 211, 211, 255, 1},
-        {210, 210, 210, 255, 1},
-        {207, 207, 207, 255, 1},
-        {209, 209, 209, 255, 1},
-        {215, 215, 215, 255, 1},
-        {222, 222, 222, 255, 1},
-        {227, 227, 227, 252, 1},
-        {233, 233, 233, 35, 1},
-        {0, 0, 0, 0, 32},
-        {157, 157, 157, 134, 1},
-        {174, 174, 174, 255, 1},
-        {168, 168, 168, 255, 1},
-        {190, 190, 190, 255, 1},
-        {203, 203, 203, 255, 1},
-        {207, 207, 207, 255, 1},
-        {204, 204, 204, 255, 1},
-        {196, 196, 196, 255, 1},
-        {186, 186, 186, 255, 1},
-        {182, 182, 182, 255, 1},
-        {183, 183, 183, 255, 1},
-        {185, 185, 185, 255, 1},
-        {190, 190, 190, 255, 1},
-        {199, 199, 199, 255, 1},
-        {207, 207, 207, 255, 1},
-        {219, 219, 219, 255, 1},
-        {238, 238, 238, 255, 1},
-        {252, 252, 252, 255, 1},
-        {247, 247, 247, 255, 1},
-        {238, 238, 238, 255, 1},
-        {233, 233, 233, 255, 1},
-        {228, 228, 228, 255, 1},
-        {221, 221, 221, 255, 1},
-        {214, 214, 214, 255, 1},
-        {211, 211, 211, 255, 1},
-        {210, 210, 210, 255, 1},
-        {208, 208, 208, 255, 1},
-        {209, 209, 209, 255, 1},
-        {214, 214, 214, 255, 1},
-        {218, 218, 218, 255, 1},
-        {243, 243, 243, 255, 1},
-        {236, 236, 236, 98, 1},
-        {0, 0, 0, 0, 32},
-        {172, 172, 172, 149, 1},
-        {196, 196, 196, 255, 1},
-        {178, 178, 178, 255, 1},
-        {190, 190, 190, 255, 1},
-        {203, 203, 203, 255, 1},
-        {202, 202, 202, 255, 1},
-        {201, 201, 201, 255, 1},
-        {193, 193, 193, 255, 1},
-        {185, 185, 185, 255, 1},
-        {181, 181, 181, 255, 1},
-        {180, 180, 180, 255, 1},
-        {184, 184, 184, 255, 1},
-        {190, 190, 190, 255, 1},
-        {200, 200, 200, 255, 1},
-        {210, 210, 210, 255, 1},
-        {222, 222, 222, 255, 1},
-        {241, 241, 241, 255, 1},
-        {255, 255, 255, 255, 1},
-        {250, 250, 250, 255, 1},
-        {240, 240, 240, 255, 1},
-        {234, 234, 234, 255, 1},
-        {229, 229, 229, 255, 1},
-        {223, 223, 223, 255, 1},
-        {216, 216, 216, 255, 1},
-        {212, 212, 212, 255, 1},
-        {210, 210, 210, 255, 1},
-        {208, 208, 208, 255, 2},
-        {212, 212, 212, 255, 1},
-        {216, 216, 216, 255, 1},
-        {239, 239, 239, 255, 1},
-        {233, 233, 233, 168, 1},
-        {0, 0, 0, 0, 32},
-        {179, 179, 179, 44, 1},
-        {192, 192, 192, 246, 1},
-        {203, 203, 203, 255, 1},
-        {190, 190, 190, 255, 1},
-        {201, 201, 201, 255, 1},
-        {208, 208, 208, 255, 1},
-        {205, 205, 205, 255, 1},
-        {198, 198, 198, 255, 1},
-        {192, 192, 192, 255, 1},
-        {184, 184, 184, 255, 1},
-        {175, 175, 175, 255, 1},
-        {179, 179, 179, 255, 1},
-        {190, 190, 190, 255, 1},
-        {201, 201, 201, 255, 1},
-        {212, 212, 212, 255, 1},
-        {224, 224, 224, 255, 1},
-        {241, 241, 241, 255, 1},
-        {254, 254, 254, 255, 1},
-        {251, 251, 251, 255, 1},
-        {242, 242, 242, 255, 1},
-        {236, 236, 236, 255, 1},
-        {230, 230, 230, 255, 1},
-        {223, 223, 223, 255, 1},
-        {216, 216, 216, 255, 1},
-        {211, 211, 211, 255, 1},
-        {209, 209, 209, 255, 1},
-        {208, 208, 208, 255, 1},
-        {207, 207, 207, 255, 1},
-        {210, 210, 210, 255, 1},
-        {214, 214, 214, 255, 1},
-        {226, 226, 226, 255, 1},
-        {228, 228, 228, 228, 1},
-        {254, 254, 254, 7, 1},
-        {0, 0, 0, 0, 32},
-        {186, 186, 186, 63, 1},
-        {207, 207, 207, 229, 1},
-        {219, 219, 219, 255, 1},
-        {202, 202, 202, 255, 1},
-        {204, 204, 204, 255, 1},
-        {212, 212, 212, 255, 1},
-        {211, 211, 211, 255, 1},
-        {206, 206, 206, 255, 1},
-        {198, 198, 198, 255, 1},
-        {189, 189, 189, 255, 1},
-        {185, 185, 185, 255, 1},
-        {191, 191, 191, 255, 1},
-        {201, 201, 201, 255, 1},
-        {213, 213, 213, 255, 1},
-        {226, 226, 226, 255, 1},
-        {242, 242, 242, 255, 1},
-        {252, 252, 252, 255, 1},
-        {251, 251, 251, 255, 1},
-        {244, 244, 244, 255, 1},
-        {237, 237, 237, 255, 1},
-        {231, 231, 231, 255, 1},
-        {224, 224, 224, 255, 1},
-        {216, 216, 216, 255, 1},
-        {211, 211, 211, 255, 1},
-        {209, 209, 209, 255, 1},
-        {208, 208, 208, 255, 1},
-        {207, 207, 207, 255, 2},
-        {211, 211, 211, 255, 1},
-        {216, 216, 216, 255, 1},
-        {231, 231, 231, 255, 1},
-        {231, 231, 231, 54, 1},
-        {0, 0, 0, 0, 33},
-        {193, 193, 193, 25, 1},
-        {209, 209, 209, 164, 1},
-        {220, 220, 220, 255, 1},
-        {226, 226, 226, 255, 1},
-        {214, 214, 214, 255, 1},
-        {217, 217, 217, 255, 1},
-        {219, 219, 219, 255, 1},
-        {216, 216, 216, 255, 1},
-        {210, 210, 210, 255, 1},
-        {204, 204, 204, 255, 1},
-        {200, 200, 200, 255, 1},
-        {203, 203, 203, 255, 1},
-        {214, 214, 214, 255, 1},
-        {226, 226, 226, 255, 1},
-        {242, 242, 242, 255, 1},
-        {251, 251, 251, 255, 2},
-        {244, 244, 244, 255, 1},
-        {237, 237, 237, 255, 1},
-        {232, 232, 232, 255, 1},
-        {226, 226, 226, 255, 1},
-        {219, 219, 219, 255, 1},
-        {214, 214, 214, 255, 1},
-        {210, 210, 210, 255, 1},
-        {208, 208, 208, 255, 1},
-        {206, 206, 206, 255, 2},
-        {210, 210, 210, 255, 1},
-        {212, 212, 212, 255, 1},
-        {236, 236, 236, 255, 1},
-        {222, 222, 222, 119, 1},
-        {0, 0, 0, 0, 35},
-        {213, 213, 213, 67, 1},
-        {221, 221, 221, 193, 1},
-        {237, 237, 237, 255, 1},
-        {240, 240, 240, 255, 1},
-        {227, 227, 227, 255, 1},
-        {226, 226, 226, 255, 1},
-        {224, 224, 224, 255, 1},
-        {222, 222, 222, 255, 1},
-        {220, 220, 220, 255, 1},
-        {219, 219, 219, 255, 1},
-        {221, 221, 221, 255, 1},
-        {228, 228, 228, 255, 1},
-        {239, 239, 239, 255, 1},
-        {248, 248, 248, 255, 1},
-        {249, 249, 249, 255, 1},
-        {243, 243, 243, 255, 1},
-        {237, 237, 237, 255, 1},
-        {232, 232, 232, 255, 1},
-        {227, 227, 227, 255, 1},
-        {220, 220, 220, 255, 1},
-        {214, 214, 214, 255, 1},
-        {212, 212, 212, 255, 1},
-        {210, 210, 210, 255, 1},
-        {209, 209, 209, 255, 1},
-        {208, 208, 208, 255, 1},
-        {210, 210, 210, 255, 1},
-        {212, 212, 212, 255, 1},
-        {228, 228, 228, 255, 1},
-        {218, 218, 218, 181, 1},
-        {0, 0, 0, 0, 37},
-        {225, 225, 225, 79, 1},
-        {235, 235, 235, 195, 1},
-        {248, 248, 248, 255, 1},
-        {253, 253, 253, 255, 1},
-        {237, 237, 237, 255, 1},
-        {231, 231, 231, 255, 1},
-        {230, 230, 230, 255, 1},
-        {232, 232, 232, 255, 2},
-        {233, 233, 233, 255, 1},
-        {238, 238, 238, 255, 1},
-        {244, 244, 244, 255, 1},
-        {245, 245, 245, 255, 1},
-        {241, 241, 241, 255, 1},
-        {237, 237, 237, 255, 1},
-        {232, 232, 232, 255, 1},
-        {226, 226, 226, 255, 1},
-        {219, 219, 219, 255, 1},
-        {214, 214, 214, 255, 1},
-        {212, 212, 212, 255, 3},
-        {210, 210, 210, 255, 1},
-        {209, 209, 209, 255, 1},
-        {211, 211, 211, 255, 1},
-        {223, 223, 223, 255, 1},
-        {212, 212, 212, 212, 1},
-        {0, 0, 0, 0, 39},
-        {237, 237, 237, 72, 1},
-        {244, 244, 244, 177, 1},
-        {244, 244, 244, 250, 1},
-        {255, 255, 255, 255, 1},
-        {253, 253, 253, 255, 1},
-        {240, 240, 240, 255, 1},
-        {236, 236, 236, 255, 2},
-        {238, 238, 238, 255, 1},
-        {241, 241, 241, 255, 2},
-        {239, 239, 239, 255, 1},
-        {235, 235, 235, 255, 1},
-        {231, 231, 231, 255, 1},
-        {225, 225, 225, 255, 1},
-        {219, 219, 219, 255, 1},
-        {214, 214, 214, 255, 1},
-        {212, 212, 212, 255, 2},
-        {210, 210, 210, 255, 1},
-        {208, 208, 208, 255, 1},
-        {207, 207, 207, 255, 1},
-        {211, 211, 211, 255, 1},
-        {238, 238, 238, 255, 1},
-        {210, 210, 210, 143, 1},
-        {0, 0, 0, 0, 41},
-        {241, 241, 241, 38, 1},
-        {248, 248, 248, 121, 1},
-        {249, 249, 249, 201, 1},
-        {248, 248, 248, 252, 1},
-        {255, 255, 255, 255, 2},
-        {252, 252, 252, 255, 1},
-        {247, 247, 247, 255, 1},
-        {244, 244, 244, 255, 1},
-        {240, 240, 240, 255, 1},
-        {235, 235, 235, 255, 1},
-        {230, 230, 230, 255, 1},
-        {225, 225, 225, 255, 1},
-        {219, 219, 219, 255, 1},
-        {215, 215, 215, 255, 1},
-        {213, 213, 213, 255, 1},
-        {214, 214, 214, 255, 1},
-        {215, 215, 215, 255, 1},
-        {220, 220, 220, 255, 1},
-        {226, 226, 226, 255, 1},
-        {215, 215, 215, 255, 1},
-        {211, 211, 211, 157, 1},
-        {223, 223, 223, 8, 1},
-        {0, 0, 0, 0, 44},
-        {254, 254, 254, 38, 1},
-        {252, 252, 252, 98, 1},
-        {250, 250, 250, 156, 1},
-        {246, 246, 246, 202, 1},
-        {243, 243, 243, 235, 1},
-        {242, 242, 242, 255, 1},
-        {250, 250, 250, 255, 1},
-        {251, 251, 251, 255, 1},
-        {248, 248, 248, 255, 1},
-        {242, 242, 242, 255, 1},
-        {235, 235, 235, 255, 1},
-        {229, 229, 229, 255, 1},
-        {222, 222, 222, 255, 1},
-        {213, 213, 213, 252, 1},
-        {211, 211, 211, 230, 1},
-        {212, 212, 212, 191, 1},
-        {213, 213, 213, 130, 1},
-        {212, 212, 212, 48, 1},
-        {0, 0, 0, 0, 19},
-    };
-
-    static BYTE textureData[64 * 64 * 4];
-
-    BYTE* ptr = textureData;
-    for (const auto& seg : segments) {
-        for (int i = 0; i < seg.count; ++i) {
-            *ptr++ = seg.r;
-            *ptr++ = seg.g;
-            *ptr++ = seg.b;
-            *ptr++ = seg.a;
-        }
-    }
-
-    bool result = CreateTextureFromData(textureData, size, size, &cachedSRV);
-    *outSRV = cachedSRV;
-    return result;
-}
\ No newline at end of file
@@ -0,0 +1,313 @@
+#include "TextureArchive.h"
+#include "MipChain.h"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+    const char MAGIC[4] = { 'H', 'V', 'H', 'T' };
+    const size_t DATA_ALIGNMENT = 16;
+
+    void PutU16(std::vector<char>& out, uint16_t v)
+    {
+        out.push_back((char)(v & 0xFF));
+        out.push_back((char)((v >> 8) & 0xFF));
+    }
+
+    void PutU32(std::vector<char>& out, uint32_t v)
+    {
+        out.push_back((char)(v & 0xFF));
+        out.push_back((char)((v >> 8) & 0xFF));
+        out.push_back((char)((v >> 16) & 0xFF));
+        out.push_back((char)((v >> 24) & 0xFF));
+    }
+
+    uint16_t GetU16(const char* p)
+    {
+        const unsigned char* b = (const unsigned char*)p;
+        return (uint16_t)(b[0] | (b[1] << 8));
+    }
+
+    uint32_t GetU32(const char* p)
+    {
+        const unsigned char* b = (const unsigned char*)p;
+        return (uint32_t)b[0] | ((uint32_t)b[1] << 8) | ((uint32_t)b[2] << 16) | ((uint32_t)b[3] << 24);
+    }
+
+    size_t MipChainSize(uint32_t width, uint32_t height, int mipCount)
+    {
+        size_t total = 0;
+        for (int level = 0; level < mipCount; ++level) {
+            total += (size_t)MipDimension(width, level) * MipDimension(height, level) * 4;
+        }
+        return total;
+    }
+}
+
+bool ReadRleTexture(const std::string& path, uint32_t& width, uint32_t& height,
+    std::vector<uint8_t>& pixels, std::string& error)
+{
+    std::ifstream in(path);
+    if (!in.is_open()) {
+        error = "can't open " + path;
+        return false;
+    }
+
+    width = height = 0;
+    pixels.clear();
+    size_t expected = 0;
+    std::string line;
+    int lineNumber = 0;
+    while (std::getline(in, line)) {
+        ++lineNumber;
+        size_t comment = line.find('#');
+        if (comment != std::string::npos) line.erase(comment);
+        std::istringstream fields(line);
+        std::vector<long long> values;
+        std::string token;
+        bool numeric = true;
+        while (fields >> token) {
+            char* end = nullptr;
+            values.push_back(strtoll(token.c_str(), &end, 10));
+            if (*end != '\0') numeric = false;
+        }
+        if (values.empty()) continue;
+
+        std::string where = path + ":" + std::to_string(lineNumber);
+        if (width == 0) {
+            if (!numeric || values.size() != 2 || values[0] < 1 || values[1] < 1 ||
+                values[0] > 4096 || values[1] > 4096) {
+                error = where + ": expected width and height";
+                return false;
+            }
+            width = (uint32_t)values[0];
+            height = (uint32_t)values[1];
+            expected = (size_t)width * height * 4;
+            pixels.reserve(expected);
+            continue;
+        }
+
+        if (!numeric || values.size() != 5) {
+            error = where + ": expected r g b a count";
+            return false;
+        }
+        for (int i = 0; i < 4; ++i) {
+            if (values[i] < 0 || values[i] > 255) {
+                error = where + ": channel out of range";
+                return false;
+            }
+        }
+        if (values[4] < 1 || (size_t)values[4] * 4 > expected - pixels.size()) {
+            error = where + ": run overflows the image";
+            return false;
+        }
+        for (long long i = 0; i < values[4]; ++i) {
+            for (int c = 0; c < 4; ++c) pixels.push_back((uint8_t)values[c]);
+        }
+    }
+
+    if (width == 0) {
+        error = path + ": no width and height";
+        return false;
+    }
+    if (pixels.size() != expected) {
+        error = path + ": runs cover " + std::to_string(pixels.size() / 4) + " of " +
+            std::to_string(expected / 4) + " pixels";
+        return false;
+    }
+    return true;
+}
+
+void BuildMipChain(PackedTexture& texture, std::vector<uint8_t> pixels)
+{
+    ::BuildMipChain(texture.width, texture.height, std::move(pixels), texture.mips);
+}
+
+bool WriteTextureArchive(const std::string& path, const std::vector<PackedTexture>& textures)
+{
+    if (textures.size() > 0xFFFF) return false;
+
+    std::vector<char> file(MAGIC, MAGIC + 4);
+    PutU16(file, TEXTURE_ARCHIVE_VERSION);
+    PutU16(file, (uint16_t)textures.size());
+
+    size_t offset = TEXTURE_ARCHIVE_HEADER_SIZE + textures.size() * TEXTURE_ARCHIVE_ENTRY_SIZE;
+    std::vector<size_t> offsets;
+    for (const PackedTexture& texture : textures) {
+        if (texture.name.empty() || texture.name.size() > TEXTURE_ARCHIVE_NAME_SIZE ||
+            texture.width == 0 || texture.height == 0 || texture.width > 0xFFFF || texture.height > 0xFFFF ||
+            texture.mips.empty() || texture.mips.size() > 0xFF) {
+            return false;
+        }
+        size_t chainSize = 0;
+        for (const auto& mip : texture.mips) chainSize += mip.size();
+        if (chainSize != MipChainSize(texture.width, texture.height, (int)texture.mips.size())) return false;
+
+        offset = (offset + DATA_ALIGNMENT - 1) / DATA_ALIGNMENT * DATA_ALIGNMENT;
+        offsets.push_back(offset);
+
+        char name[TEXTURE_ARCHIVE_NAME_SIZE] = {};
+        memcpy(name, texture.name.data(), texture.name.size());
+        file.insert(file.end(), name, name + TEXTURE_ARCHIVE_NAME_SIZE);
+        PutU16(file, (uint16_t)texture.width);
+        PutU16(file, (uint16_t)texture.height);
+        file.push_back((char)TEXTURE_RGBA8);
+        file.push_back((char)texture.mips.size());
+        PutU16(file, 0);
+        PutU32(file, (uint32_t)offset);
+        PutU32(file, (uint32_t)chainSize);
+        offset += chainSize;
+    }
+
+    for (size_t i = 0; i < textures.size(); ++i) {
+        file.resize(offsets[i], 0);
+        for (const auto& mip : textures[i].mips) file.insert(file.end(), mip.begin(), mip.end());
+    }
+
+    std::string temp = path + ".tmp";
+    {
+        std::ofstream out(temp, std::ios::binary | std::ios::trunc);
+        if (!out.is_open()) return false;
+        out.write(file.data(), (std::streamsize)file.size());
+        if (!out.good()) return false;
+    }
+#ifdef _WIN32
+    if (!MoveFileExA(temp.c_str(), path.c_str(), MOVEFILE_REPLACE_EXISTING)) return false;
+#else
+    if (std::rename(temp.c_str(), path.c_str()) != 0) return false;
+#endif
+    return true;
+}
+
+bool TextureArchive::Open(const std::string& path)
+{
+    Close();
+
+#ifdef _WIN32
+    HANDLE handle = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+        FILE_ATTRIBUTE_NORMAL, NULL);
+    if (handle == INVALID_HANDLE_VALUE) return false;
+    file = handle;
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(handle, &fileSize) || fileSize.QuadPart < (LONGLONG)TEXTURE_ARCHIVE_HEADER_SIZE) {
+        Close();
+        return false;
+    }
+
+    mapping = CreateFileMappingA(handle, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (mapping) {
+        data = (const char*)MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    }
+    if (!data) {
+        Close();
+        return false;
+    }
+    size = (size_t)fileSize.QuadPart;
+#else
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) return false;
+
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size < (off_t)TEXTURE_ARCHIVE_HEADER_SIZE) {
+        close(fd);
+        return false;
+    }
+
+    void* view = mmap(nullptr, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (view == MAP_FAILED) return false;
+    data = (const char*)view;
+    size = (size_t)info.st_size;
+#endif
+
+    if (!Parse()) {
+        Close();
+        return false;
+    }
+    return true;
+}
+
+void TextureArchive::Close()
+{
+#ifdef _WIN32
+    if (data) UnmapViewOfFile(data);
+    if (mapping) CloseHandle(mapping);
+    if (file) CloseHandle(file);
+#else
+    if (data) munmap((void*)data, size);
+#endif
+    data = nullptr;
+    mapping = nullptr;
+    file = nullptr;
+    size = 0;
+    entries.clear();
+}
+
+bool TextureArchive::Parse()
+{
+    if (memcmp(data, MAGIC, 4) != 0 || GetU16(data + 4) != TEXTURE_ARCHIVE_VERSION) return false;
+
+    size_t count = GetU16(data + 6);
+    if (size < TEXTURE_ARCHIVE_HEADER_SIZE + count * TEXTURE_ARCHIVE_ENTRY_SIZE) return false;
+
+    const char* p = data + TEXTURE_ARCHIVE_HEADER_SIZE;
+    for (size_t i = 0; i < count; ++i, p += TEXTURE_ARCHIVE_ENTRY_SIZE) {
+        Entry entry;
+        const char* nameEnd = (const char*)memchr(p, 0, TEXTURE_ARCHIVE_NAME_SIZE);
+        entry.name.assign(p, nameEnd ? nameEnd : p + TEXTURE_ARCHIVE_NAME_SIZE);
+        const char* q = p + TEXTURE_ARCHIVE_NAME_SIZE;
+        entry.width = GetU16(q);
+        entry.height = GetU16(q + 2);
+        entry.format = (uint8_t)q[4];
+        entry.mipCount = (uint8_t)q[5];
+        entry.offset = GetU32(q + 8);
+        entry.size = GetU32(q + 12);
+
+        if (entry.format != TEXTURE_RGBA8 || entry.width == 0 || entry.height == 0 ||
+            entry.mipCount == 0 || entry.mipCount > MipCount(entry.width, entry.height) ||
+            entry.size != MipChainSize(entry.width, entry.height, entry.mipCount) ||
+            entry.offset > size || entry.size > size - entry.offset) {
+            return false;
+        }
+        entries.push_back(entry);
+    }
+    return true;
+}
+
+int TextureArchive::Find(const std::string& name) const
+{
+    for (size_t i = 0; i < entries.size(); ++i) {
+        if (entries[i].name == name) return (int)i;
+    }
+    return -1;
+}
+
+bool TextureArchive::GetMips(size_t index, std::vector<TextureMip>& out) const
+{
+    out.clear();
+    if (index >= entries.size()) return false;
+
+    const Entry& entry = entries[index];
+    const uint8_t* pixels = (const uint8_t*)data + entry.offset;
+    for (int level = 0; level < entry.mipCount; ++level) {
+        TextureMip mip;
+        mip.width = MipDimension(entry.width, level);
+        mip.height = MipDimension(entry.height, level);
+        mip.pixels = pixels;
+        pixels += (size_t)mip.width * mip.height * 4;
+        out.push_back(mip);
+    }
+    return true;
+}
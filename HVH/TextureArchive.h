@@ -0,0 +1,83 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+// Packed block textures, built offline by HVHTexturePack from the run-length
+// sources in HVH/Textures. Little endian:
+//   header (TEXTURE_ARCHIVE_HEADER_SIZE bytes): "HVHT", u16 version,
+//     u16 texture count
+//   directory: name (16 bytes, zero padded), u16 width, u16 height,
+//     u8 format, u8 mip count, u16 reserved, u32 offset, u32 size
+//   data: each texture's mips, largest first, rows tightly packed, every
+//     texture starting on a 16 byte boundary
+// Mips are already built, so the game hands them straight to CreateTexture2D
+// from the mapped file; nothing is expanded or filtered at startup.
+const uint16_t TEXTURE_ARCHIVE_VERSION = 1;
+const size_t TEXTURE_ARCHIVE_HEADER_SIZE = 8;
+const size_t TEXTURE_ARCHIVE_ENTRY_SIZE = 32;
+const size_t TEXTURE_ARCHIVE_NAME_SIZE = 16;
+
+enum TextureFormat : uint8_t {
+    TEXTURE_RGBA8 = 0
+};
+
+struct TextureMip {
+    uint32_t width = 0, height = 0;
+    const uint8_t* pixels = nullptr;  // width * height * 4 bytes
+};
+
+struct PackedTexture {
+    std::string name;
+    uint32_t width = 0, height = 0;
+    std::vector<std::vector<uint8_t>> mips;  // RGBA8, mip 0 first
+};
+
+// width x height RGBA8 from a run-length source: "width height", then one
+// "r g b a count" run per line, '#' starts a comment. False with error set if
+// it's malformed or the runs don't cover the image exactly.
+bool ReadRleTexture(const std::string& path, uint32_t& width, uint32_t& height,
+    std::vector<uint8_t>& pixels, std::string& error);
+
+// Every mip down to 1x1, each texel the rounded average of the 2x2 above it
+// (see MipChain.h).
+void BuildMipChain(PackedTexture& texture, std::vector<uint8_t> pixels);
+
+bool WriteTextureArchive(const std::string& path, const std::vector<PackedTexture>& textures);
+
+class TextureArchive
+{
+public:
+    TextureArchive() {}
+    ~TextureArchive() { Close(); }
+    TextureArchive(const TextureArchive&) = delete;
+    TextureArchive& operator=(const TextureArchive&) = delete;
+
+    // Maps the file and checks the header and that every mip lies inside it.
+    bool Open(const std::string& path);
+    void Close();
+    bool IsOpen() const { return data != nullptr; }
+
+    size_t GetTextureCount() const { return entries.size(); }
+    const std::string& GetName(size_t index) const { return entries[index].name; }
+    int Find(const std::string& name) const;
+    // Views into the mapped file, valid until Close.
+    bool GetMips(size_t index, std::vector<TextureMip>& out) const;
+
+private:
+    struct Entry {
+        std::string name;
+        uint16_t width, height;
+        uint8_t format, mipCount;
+        uint32_t offset, size;
+    };
+
+    bool Parse();
+
+    void* file = nullptr;      // HANDLEs on Windows, kept out of the header
+    void* mapping = nullptr;
+    const char* data = nullptr;
+    size_t size = 0;
+    std::vector<Entry> entries;
+};
@@ -19,32 +19,159 @@
 //    return CreateTextureFromData(data.data(), size, size, outSRV);
 //}
 
-bool GameEngine::CreateWaterTextureSRV(UINT size, ID3D11ShaderResourceView** outSRV) {
-    std::vector<BYTE> data(size * size * 4);
-    for (UINT y = 0; y < size; ++y) {
-        for (UINT x = 0; x < size; ++x) {
-            UINT index = (y * size + x) * 4;
-            BYTE wave = static_cast<BYTE>(sinf(x * 0.1f + y * 0.05f) * 50 + 100);
-            data[index] = 200;        // B
-            data[index + 1] = wave;   // G
-            data[index + 2] = wave / 2; // R
-            data[index + 3] = 200;    // A
+bool GameEngine::OpenTextureArchive(TextureArchive& archive)
+{
+    // next to the exe once built, under the project dir when run from Visual Studio
+    char exePath[MAX_PATH] = {};
+    GetModuleFileNameA(NULL, exePath, MAX_PATH);
+    std::string exeDir = exePath;
+    exeDir.erase(exeDir.find_last_of("\\/") + 1);
+    if (archive.Open(exeDir + "blocks.hvht") || archive.Open("Textures\\blocks.hvht")) return true;
+
+    MessageBox(hWnd, L"Can't load blocks.hvht, the block textures. Run HVHTexturePack or copy it next to the game.",
+        L"Error", MB_OK);
+    return false;
+}
+
+bool GameEngine::CreateMippedTextureSRV(const std::vector<TextureMip>& mips, ID3D11ShaderResourceView** outSRV)
+{
+    if (mips.empty()) return false;
+
+    // every mip up front, the texture never changes after this
+    std::vector<D3D11_SUBRESOURCE_DATA> initial(mips.size());
+    for (size_t i = 0; i < mips.size(); ++i) {
+        initial[i].pSysMem = mips[i].pixels;
+        initial[i].SysMemPitch = mips[i].width * 4;
+    }
+
+    D3D11_TEXTURE2D_DESC texDesc = {};
+    texDesc.Width = mips[0].width;
+    texDesc.Height = mips[0].height;
+    texDesc.MipLevels = (UINT)mips.size();
+    texDesc.ArraySize = 1;
+    texDesc.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
+    texDesc.SampleDesc.Count = 1;
+    texDesc.Usage = D3D11_USAGE_IMMUTABLE;
+    texDesc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
+
+    ID3D11Texture2D* pTexture = nullptr;
+    if (FAILED(pDevice->CreateTexture2D(&texDesc, initial.data(), &pTexture))) return false;
+
+    HRESULT hr = pDevice->CreateShaderResourceView(pTexture, nullptr, outSRV);
+    SafeRelease(&pTexture);
+    return SUCCEEDED(hr);
+}
+
+namespace {
+
+    const UINT BLOCK_TEXTURE_SIZE = 64;
+    // water and lava are drawn this big and filtered down to BLOCK_TEXTURE_SIZE,
+    // the mips the sampler used to pick for a block on screen anyway
+    const UINT PROCEDURAL_TEXTURE_SIZE = 2048;
+
+    std::vector<uint8_t> MakeWaterPixels(UINT size)
+    {
+        std::vector<uint8_t> data(size * size * 4);
+        for (UINT y = 0; y < size; ++y) {
+            for (UINT x = 0; x < size; ++x) {
+                UINT index = (y * size + x) * 4;
+                BYTE wave = static_cast<BYTE>(sinf(x * 0.1f + y * 0.05f) * 50 + 100);
+                data[index] = 200;        // B
+                data[index + 1] = wave;   // G
+                data[index + 2] = wave / 2; // R
+                data[index + 3] = 200;    // A
+            }
+        }
+        return data;
+    }
+
+    std::vector<uint8_t> MakeLavaPixels(UINT size)
+    {
+        std::vector<uint8_t> data(size * size * 4);
+        for (UINT y = 0; y < size; ++y) {
+            for (UINT x = 0; x < size; ++x) {
+                UINT index = (y * size + x) * 4;
+                BYTE heat = static_cast<BYTE>(200 + sinf(x * 0.15f) * 55);
+                data[index] = 0;          // B
+                data[index + 1] = heat / 2; // G
+                data[index + 2] = heat;   // R
+                data[index + 3] = 255;    // A
+            }
+        }
+        return data;
+    }
+
+    // the levels of a square chain from the one size texels wide down
+    std::vector<TextureMip> MipsFrom(const std::vector<std::vector<uint8_t>>& chain, UINT fullSize, UINT size)
+    {
+        std::vector<TextureMip> mips;
+        for (size_t level = 0; level < chain.size(); ++level) {
+            UINT side = MipDimension(fullSize, (int)level);
+            if (side > size) continue;
+            mips.push_back({ side, side, chain[level].data() });
         }
+        return mips;
     }
-    return CreateTextureFromData(data.data(), size, size, outSRV);
 }
 
-bool GameEngine::CreateLavaTextureSRV(UINT size, ID3D11ShaderResourceView** outSRV) {
-    std::vector<BYTE> data(size * size * 4);
-    for (UINT y = 0; y < size; ++y) {
-        for (UINT x = 0; x < size; ++x) {
-            UINT index = (y * size + x) * 4;
-            BYTE heat = static_cast<BYTE>(200 + sinf(x * 0.15f) * 55);
-            data[index] = 0;          // B
-            data[index + 1] = heat / 2; // G
-            data[index + 2] = heat;   // R
-            data[index + 3] = 255;    // A
+bool GameEngine::CreateBlockTextures(const TextureArchive& archive)
+{
+    // indexed by BlockTexture; null for the ones drawn here
+    static const char* archiveNames[BLOCK_TEXTURE_COUNT] = {
+        "checker", "grass", "stone", "wood", "metal", "brick", "dirt", nullptr, nullptr
+    };
+    ID3D11ShaderResourceView** views[BLOCK_TEXTURE_COUNT] = {
+        &pCubeSRV, &pGrassSRV, &pStoneSRV, &pWoodSRV, &pMetalSRV, &pBrickSRV, &pDirtSRV, &pWaterSRV, &pLavaSRV
+    };
+
+    std::vector<std::vector<uint8_t>> water, lava;
+    BuildMipChain(PROCEDURAL_TEXTURE_SIZE, PROCEDURAL_TEXTURE_SIZE, MakeWaterPixels(PROCEDURAL_TEXTURE_SIZE), water);
+    BuildMipChain(PROCEDURAL_TEXTURE_SIZE, PROCEDURAL_TEXTURE_SIZE, MakeLavaPixels(PROCEDURAL_TEXTURE_SIZE), lava);
+
+    std::vector<TextureMip> slices[BLOCK_TEXTURE_COUNT];
+    for (int t = 0; t < BLOCK_TEXTURE_COUNT; ++t) {
+        if (archiveNames[t]) {
+            int index = archive.Find(archiveNames[t]);
+            if (index < 0 || !archive.GetMips(index, slices[t])) return false;
+        }
+        else {
+            slices[t] = MipsFrom((BlockTexture)t == BlockTexture::Water ? water : lava,
+                PROCEDURAL_TEXTURE_SIZE, BLOCK_TEXTURE_SIZE);
+        }
+        // an array needs every slice the same size with the same mips
+        if (slices[t].empty() || slices[t][0].width != BLOCK_TEXTURE_SIZE || slices[t][0].height != BLOCK_TEXTURE_SIZE ||
+            slices[t].size() != slices[0].size()) {
+            return false;
+        }
+        // a plain copy too, for the inventory icons and the floor
+        if (!CreateMippedTextureSRV(slices[t], views[t])) return false;
+    }
+
+    UINT mipCount = (UINT)slices[0].size();
+    std::vector<D3D11_SUBRESOURCE_DATA> initial(BLOCK_TEXTURE_COUNT * mipCount);
+    for (int t = 0; t < BLOCK_TEXTURE_COUNT; ++t) {
+        for (UINT level = 0; level < mipCount; ++level) {
+            D3D11_SUBRESOURCE_DATA& sub = initial[t * mipCount + level];
+            sub.pSysMem = slices[t][level].pixels;
+            sub.SysMemPitch = slices[t][level].width * 4;
         }
     }
-    return CreateTextureFromData(data.data(), size, size, outSRV);
+
+    D3D11_TEXTURE2D_DESC texDesc = {};
+    texDesc.Width = BLOCK_TEXTURE_SIZE;
+    texDesc.Height = BLOCK_TEXTURE_SIZE;
+    texDesc.MipLevels = mipCount;
+    texDesc.ArraySize = BLOCK_TEXTURE_COUNT;
+    texDesc.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
+    texDesc.SampleDesc.Count = 1;
+    texDesc.Usage = D3D11_USAGE_IMMUTABLE;
+    texDesc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
+
+    ID3D11Texture2D* pTexture = nullptr;
+    if (FAILED(pDevice->CreateTexture2D(&texDesc, initial.data(), &pTexture))) return false;
+
+    // the default view of an array texture is a Texture2DArray over every slice
+    HRESULT hr = pDevice->CreateShaderResourceView(pTexture, nullptr, &pBlockTextureArraySRV);
+    SafeRelease(&pTexture);
+    return SUCCEEDED(hr);
 }
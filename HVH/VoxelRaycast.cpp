@@ -0,0 +1,102 @@
+#include "VoxelRaycast.h"
+#include "BlockRegistry.h"
+#include <cmath>
+
+bool RayEntersBox(const float origin[3], const float dir[3], const float boxMin[3], const float boxMax[3],
+    float& t, int& axis, int& sign)
+{
+    float tMin = -INFINITY;
+    float tMax = INFINITY;
+    axis = -1;
+    sign = 0;
+
+    for (int i = 0; i < 3; ++i) {
+        if (dir[i] == 0.0f) {
+            if (origin[i] < boxMin[i] || origin[i] > boxMax[i]) return false;
+            continue;
+        }
+        float ood = 1.0f / dir[i];
+        float t1 = (boxMin[i] - origin[i]) * ood;
+        float t2 = (boxMax[i] - origin[i]) * ood;
+        // entering through min when moving +, through max when moving -
+        int faceSign = -1;
+        if (t1 > t2) {
+            float swap = t1; t1 = t2; t2 = swap;
+            faceSign = 1;
+        }
+        if (t1 > tMin) {
+            tMin = t1;
+            axis = i;
+            sign = faceSign;
+        }
+        if (t2 < tMax) tMax = t2;
+        if (tMin > tMax) return false;
+    }
+
+    if (axis == -1 || tMin <= 0.0f) return false;
+    t = tMin;
+    return true;
+}
+
+bool RaycastVoxels(const VoxelWorld& world, const float origin[3], const float dir[3], float maxDist,
+    VoxelRayHit& hit, bool solidOnly)
+{
+    if (dir[0] == 0.0f && dir[1] == 0.0f && dir[2] == 0.0f) return false;
+
+    int cell[3], step[3];
+    float tNext[3], tDelta[3];
+    for (int i = 0; i < 3; ++i) {
+        cell[i] = (int)floorf(origin[i]);
+        if (dir[i] > 0.0f) {
+            step[i] = 1;
+            tDelta[i] = 1.0f / dir[i];
+            tNext[i] = (cell[i] + 1 - origin[i]) * tDelta[i];
+        }
+        else if (dir[i] < 0.0f) {
+            step[i] = -1;
+            tDelta[i] = -1.0f / dir[i];
+            tNext[i] = (origin[i] - cell[i]) * tDelta[i];
+        }
+        else {
+            step[i] = 0;
+            tDelta[i] = INFINITY;
+            tNext[i] = INFINITY;
+        }
+    }
+
+    // blocks span +-1 around their lattice point, so the eight at the corners
+    // of a unit cell cover it; a block is entered in the cell where its face is
+    VoxelCellLookup lookup(world);
+    for (;;) {
+        float tExit = fminf(tNext[0], fminf(tNext[1], tNext[2]));
+
+        bool found = false;
+        for (int corner = 0; corner < 8; ++corner) {
+            int p[3] = { cell[0] + (corner & 1), cell[1] + ((corner >> 1) & 1), cell[2] + ((corner >> 2) & 1) };
+            BlockId id = lookup.Get(p[0], p[1], p[2]);
+            if (id == BLOCK_AIR || (solidOnly && !BlockRegistry::Get(id).solid)) continue;
+
+            float boxMin[3] = { p[0] - 1.0f, p[1] - 1.0f, p[2] - 1.0f };
+            float boxMax[3] = { p[0] + 1.0f, p[1] + 1.0f, p[2] + 1.0f };
+            float t;
+            int axis, sign;
+            if (!RayEntersBox(origin, dir, boxMin, boxMax, t, axis, sign)) continue;
+            if (t >= maxDist || (found && t >= hit.t)) continue;
+
+            found = true;
+            hit.t = t;
+            hit.block = id;
+            for (int i = 0; i < 3; ++i) {
+                hit.position[i] = p[i];
+                hit.normal[i] = i == axis ? sign : 0;
+            }
+        }
+        // one entered further on is still ahead, and found again there
+        if (found && hit.t <= tExit) return true;
+        if (tExit >= maxDist) return found;
+
+        int axis = tNext[0] < tNext[1] ? (tNext[0] < tNext[2] ? 0 : 2) : (tNext[1] < tNext[2] ? 1 : 2);
+        cell[axis] += step[axis];
+        tNext[axis] += tDelta[axis];
+    }
+}
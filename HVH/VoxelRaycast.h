@@ -0,0 +1,24 @@
+#pragma once
+#include "VoxelWorld.h"
+
+// Ray queries against the voxel world, free of Windows and DirectX like
+// PlayerPhysics. The ray is origin + t * dir; dir needn't be normalized, t is
+// in units of its length.
+struct VoxelRayHit {
+    float t = 0.0f;
+    int position[3] = {};  // lattice coords of the block
+    int normal[3] = {};    // the face the ray entered through, one axis is +-1
+    BlockId block = BLOCK_AIR;
+};
+
+// Where the ray enters the box, and through which face (axis, sign of the
+// normal). False if it misses, or starts inside.
+bool RayEntersBox(const float origin[3], const float dir[3], const float boxMin[3], const float boxMax[3],
+    float& t, int& axis, int& sign);
+
+// The first block the ray enters before maxDist. Walks the unit cells along
+// the ray (Amanatides & Woo) and only tests the blocks covering each one, so
+// the cost follows the length of the ray, not the size of the map. Blocks the
+// ray starts in are skipped; solidOnly skips the ones you can walk through.
+bool RaycastVoxels(const VoxelWorld& world, const float origin[3], const float dir[3], float maxDist,
+    VoxelRayHit& hit, bool solidOnly = false);
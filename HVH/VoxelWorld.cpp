@@ -0,0 +1,201 @@
+#include "VoxelWorld.h"
+#include <cmath>
+#include <cstring>
+#include <utility>
+
+int64_t VoxelWorld::MakeKey(int cx, int cy, int cz)
+{
+    const int64_t mask = (1 << 21) - 1;
+    return ((int64_t)(cx & mask) << 42) | ((int64_t)(cy & mask) << 21) | (int64_t)(cz & mask);
+}
+
+const VoxelChunk* VoxelWorld::FindChunk(int cx, int cy, int cz) const
+{
+    auto it = chunks.find(MakeKey(cx, cy, cz));
+    return it != chunks.end() ? it->second.get() : nullptr;
+}
+
+void VoxelWorld::GetChunkCoords(std::vector<ChunkCoords>& out) const
+{
+    out.reserve(out.size() + chunks.size());
+    for (const auto& pair : chunks) {
+        out.push_back({ pair.second->cx, pair.second->cy, pair.second->cz });
+    }
+}
+
+BlockId VoxelWorld::GetBlock(int x, int y, int z) const
+{
+    const VoxelChunk* chunk = FindChunk(ChunkCoord(x), ChunkCoord(y), ChunkCoord(z));
+    if (!chunk) return BLOCK_AIR;
+    return chunk->blocks[VoxelChunk::Index(LocalCoord(x), LocalCoord(y), LocalCoord(z))];
+}
+
+bool VoxelWorld::SetBlock(int x, int y, int z, BlockId id)
+{
+    int cx = ChunkCoord(x), cy = ChunkCoord(y), cz = ChunkCoord(z);
+    int64_t key = MakeKey(cx, cy, cz);
+
+    auto it = chunks.find(key);
+    if (it == chunks.end()) {
+        if (id == BLOCK_AIR) return false;
+
+        std::shared_ptr<VoxelChunk> chunk = std::make_shared<VoxelChunk>();
+        chunk->cx = cx;
+        chunk->cy = cy;
+        chunk->cz = cz;
+        chunk->blockCount = 0;
+        memset(chunk->blocks, 0, sizeof(chunk->blocks));
+        it = chunks.emplace(key, std::move(chunk)).first;
+        if (snapshotLive) ownedKeys.insert(key);
+    }
+
+    int index = VoxelChunk::Index(x - cx * VOXEL_CHUNK_SIZE, y - cy * VOXEL_CHUNK_SIZE, z - cz * VOXEL_CHUNK_SIZE);
+    if (it->second->blocks[index] == id) return false;
+
+    VoxelChunk& chunk = Mutable(key, it->second);
+    BlockId& slot = chunk.blocks[index];
+
+    if (slot == BLOCK_AIR) { chunk.blockCount++; blockCount++; }
+    else if (id == BLOCK_AIR) { chunk.blockCount--; blockCount--; }
+    slot = id;
+    MarkDirtyAround(x, y, z);
+
+    if (chunk.blockCount == 0) {
+        chunks.erase(it);
+    }
+    return true;
+}
+
+void VoxelWorld::SetChunk(int cx, int cy, int cz, const BlockId* blocks)
+{
+    uint16_t count = 0;
+    for (int i = 0; i < VOXEL_CHUNK_VOLUME; ++i) {
+        if (blocks[i] != BLOCK_AIR) count++;
+    }
+
+    int64_t key = MakeKey(cx, cy, cz);
+    auto it = chunks.find(key);
+    if (it != chunks.end()) {
+        blockCount -= it->second->blockCount;
+        if (count == 0) chunks.erase(it);
+    }
+    else if (count > 0) {
+        it = chunks.emplace(key, nullptr).first;
+    }
+    if (count > 0) {
+        // always a fresh chunk, a snapshot may still be reading the old one
+        std::shared_ptr<VoxelChunk> chunk = std::make_shared<VoxelChunk>();
+        chunk->cx = cx;
+        chunk->cy = cy;
+        chunk->cz = cz;
+        chunk->blockCount = count;
+        memcpy(chunk->blocks, blocks, sizeof(chunk->blocks));
+        it->second = std::move(chunk);
+        blockCount += count;
+        if (snapshotLive) ownedKeys.insert(key);
+    }
+
+    // border faces of the neighbours may change too
+    for (int y = cy - 1; y <= cy + 1; ++y) {
+        for (int z = cz - 1; z <= cz + 1; ++z) {
+            for (int x = cx - 1; x <= cx + 1; ++x) {
+                MarkDirty(x, y, z);
+            }
+        }
+    }
+}
+
+void VoxelWorld::Clear()
+{
+    for (const auto& pair : chunks) {
+        MarkDirty(pair.second->cx, pair.second->cy, pair.second->cz);
+    }
+    chunks.clear();
+    blockCount = 0;
+}
+
+VoxelWorld VoxelWorld::Snapshot()
+{
+    // every chunk is shared from here on, on both sides
+    snapshotLive = true;
+    ownedKeys.clear();
+
+    VoxelWorld copy;
+    copy.chunks = chunks;
+    copy.blockCount = blockCount;
+    copy.snapshotLive = true;
+    return copy;
+}
+
+void VoxelWorld::ReleaseSnapshots()
+{
+    snapshotLive = false;
+    ownedKeys.clear();
+}
+
+void VoxelWorld::Swap(VoxelWorld& other)
+{
+    MarkAllDirty();
+    chunks.swap(other.chunks);
+    std::swap(blockCount, other.blockCount);
+    // whether the chunks are shared goes with them
+    std::swap(snapshotLive, other.snapshotLive);
+    ownedKeys.swap(other.ownedKeys);
+    MarkAllDirty();
+}
+
+VoxelChunk& VoxelWorld::Mutable(int64_t key, std::shared_ptr<VoxelChunk>& chunk)
+{
+    // a reference count read here wouldn't order our writes after another
+    // thread's reads of the snapshot, so sharing is decided by the flag alone
+    if (snapshotLive && ownedKeys.insert(key).second) {
+        chunk = std::make_shared<VoxelChunk>(*chunk);
+    }
+    return *chunk;
+}
+
+bool VoxelWorld::ToLattice(float x, float y, float z, int& ix, int& iy, int& iz)
+{
+    const float eps = 0.01f;
+    float rx = roundf(x), ry = roundf(y), rz = roundf(z);
+    if (fabsf(x - rx) > eps || fabsf(y - ry) > eps || fabsf(z - rz) > eps) return false;
+
+    ix = (int)rx;
+    iy = (int)ry;
+    iz = (int)rz;
+    return true;
+}
+
+void VoxelWorld::MarkDirty(int cx, int cy, int cz)
+{
+    if (dirtyKeys.insert(MakeKey(cx, cy, cz)).second) {
+        dirtyChunks.push_back({ cx, cy, cz });
+    }
+}
+
+void VoxelWorld::MarkDirtyAround(int x, int y, int z)
+{
+    // faces are hidden by neighbours up to 2 cells away, so a change near a
+    // chunk border can alter the mesh on the other side of it
+    for (int cy = ChunkCoord(y - 2); cy <= ChunkCoord(y + 2); ++cy) {
+        for (int cz = ChunkCoord(z - 2); cz <= ChunkCoord(z + 2); ++cz) {
+            for (int cx = ChunkCoord(x - 2); cx <= ChunkCoord(x + 2); ++cx) {
+                MarkDirty(cx, cy, cz);
+            }
+        }
+    }
+}
+
+void VoxelWorld::MarkAllDirty()
+{
+    for (const auto& pair : chunks) {
+        MarkDirty(pair.second->cx, pair.second->cy, pair.second->cz);
+    }
+}
+
+void VoxelWorld::TakeDirtyChunks(std::vector<ChunkCoords>& out)
+{
+    out.insert(out.end(), dirtyChunks.begin(), dirtyChunks.end());
+    dirtyChunks.clear();
+    dirtyKeys.clear();
+}
@@ -0,0 +1,176 @@
+#pragma once
+#include <cstdint>
+#include <cstddef>
+#include <memory>
+#include <vector>
+#include <unordered_map>
+#include <unordered_set>
+
+// Block id stored per voxel (see BlockRegistry), 0 is air.
+typedef uint16_t BlockId;
+const BlockId BLOCK_AIR = 0;
+
+const int VOXEL_CHUNK_SIZE = 16;
+const int VOXEL_CHUNK_VOLUME = VOXEL_CHUNK_SIZE * VOXEL_CHUNK_SIZE * VOXEL_CHUNK_SIZE;
+
+struct VoxelChunk {
+    int cx, cy, cz;            // chunk coords, block origin is c * VOXEL_CHUNK_SIZE
+    uint16_t blockCount;       // non-air voxels, chunk is freed when it drops to 0
+    BlockId blocks[VOXEL_CHUNK_VOLUME];
+
+    static int Index(int lx, int ly, int lz) {
+        return (ly * VOXEL_CHUNK_SIZE + lz) * VOXEL_CHUNK_SIZE + lx;
+    }
+};
+
+struct ChunkCoords {
+    int cx, cy, cz;
+};
+
+// Dense block storage for axis-aligned unit blocks sitting on the integer lattice.
+// Blocks are kept in 16^3 chunks of BlockId, so one block costs 2 bytes instead of
+// a full MapObject. Anything rotated, scaled or off-lattice stays in WorldStore's
+// sparse object list instead.
+//
+// Chunks are shared copy-on-write between a world and its snapshots, so a
+// snapshot costs one pointer per chunk and can be read on another thread while
+// this one keeps editing. Sharing is tracked explicitly rather than through
+// shared_ptr use counts: from Snapshot() until ReleaseSnapshots() every chunk
+// is copied before its first edit.
+class VoxelWorld
+{
+public:
+    VoxelWorld() {}
+    // a plain copy would share chunks without marking them; use Snapshot()
+    VoxelWorld(const VoxelWorld&) = delete;
+    VoxelWorld& operator=(const VoxelWorld&) = delete;
+    VoxelWorld(VoxelWorld&&) = default;
+    VoxelWorld& operator=(VoxelWorld&&) = default;
+
+    BlockId GetBlock(int x, int y, int z) const;
+    // Returns true if the stored id changed.
+    bool SetBlock(int x, int y, int z, BlockId id);
+    bool RemoveBlock(int x, int y, int z) { return SetBlock(x, y, z, BLOCK_AIR); }
+    // Replaces a whole chunk at once, for loading; blocks is in VoxelChunk::Index order.
+    void SetChunk(int cx, int cy, int cz, const BlockId* blocks);
+    void Clear();
+
+    // Copy sharing every chunk; only chunks edited afterwards get duplicated.
+    VoxelWorld Snapshot();
+    // Call once every snapshot taken from this world is gone (for a save, once
+    // MapIoWorker::Poll has joined the worker); edits stop copying chunks then.
+    void ReleaseSnapshots();
+    bool HasLiveSnapshot() const { return snapshotLive; }
+    // Takes other's blocks, other gets ours. Old and new chunks are all marked dirty.
+    void Swap(VoxelWorld& other);
+
+    size_t GetBlockCount() const { return blockCount; }
+    size_t GetChunkCount() const { return chunks.size(); }
+    size_t GetMemoryUsage() const { return chunks.size() * sizeof(VoxelChunk); }
+
+    // True (and the lattice coords) if a unit block at this position fits the grid.
+    static bool ToLattice(float x, float y, float z, int& ix, int& iy, int& iz);
+
+    // fn(x, y, z, id) for every non-air block, chunk by chunk.
+    template <typename Fn>
+    void ForEachBlock(Fn&& fn) const
+    {
+        for (const auto& pair : chunks) {
+            const VoxelChunk& chunk = *pair.second;
+            int ox = chunk.cx * VOXEL_CHUNK_SIZE;
+            int oy = chunk.cy * VOXEL_CHUNK_SIZE;
+            int oz = chunk.cz * VOXEL_CHUNK_SIZE;
+            for (int i = 0; i < VOXEL_CHUNK_VOLUME; ++i) {
+                if (chunk.blocks[i] == BLOCK_AIR) continue;
+                int lx = i % VOXEL_CHUNK_SIZE;
+                int lz = (i / VOXEL_CHUNK_SIZE) % VOXEL_CHUNK_SIZE;
+                int ly = i / (VOXEL_CHUNK_SIZE * VOXEL_CHUNK_SIZE);
+                fn(ox + lx, oy + ly, oz + lz, chunk.blocks[i]);
+            }
+        }
+    }
+
+    // fn(x, y, z, id) for every non-air block with x0 <= x <= x1 (same for y, z).
+    template <typename Fn>
+    void ForEachBlockInBox(int x0, int y0, int z0, int x1, int y1, int z1, Fn&& fn) const
+    {
+        for (int cy = ChunkCoord(y0); cy <= ChunkCoord(y1); ++cy) {
+            for (int cz = ChunkCoord(z0); cz <= ChunkCoord(z1); ++cz) {
+                for (int cx = ChunkCoord(x0); cx <= ChunkCoord(x1); ++cx) {
+                    const VoxelChunk* chunk = FindChunk(cx, cy, cz);
+                    if (!chunk) continue;
+
+                    int ox = cx * VOXEL_CHUNK_SIZE, oy = cy * VOXEL_CHUNK_SIZE, oz = cz * VOXEL_CHUNK_SIZE;
+                    int ly0 = Clamp(y0 - oy), ly1 = Clamp(y1 - oy);
+                    int lz0 = Clamp(z0 - oz), lz1 = Clamp(z1 - oz);
+                    int lx0 = Clamp(x0 - ox), lx1 = Clamp(x1 - ox);
+                    for (int ly = ly0; ly <= ly1; ++ly) {
+                        for (int lz = lz0; lz <= lz1; ++lz) {
+                            for (int lx = lx0; lx <= lx1; ++lx) {
+                                BlockId id = chunk->blocks[VoxelChunk::Index(lx, ly, lz)];
+                                if (id != BLOCK_AIR) fn(ox + lx, oy + ly, oz + lz, id);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    static int ChunkCoord(int v) { return v >= 0 ? v / VOXEL_CHUNK_SIZE : (v - VOXEL_CHUNK_SIZE + 1) / VOXEL_CHUNK_SIZE; }
+    static int LocalCoord(int v) { return v - ChunkCoord(v) * VOXEL_CHUNK_SIZE; }
+
+    const VoxelChunk* FindChunk(int cx, int cy, int cz) const;
+    void GetChunkCoords(std::vector<ChunkCoords>& out) const;
+    static int64_t MakeKey(int cx, int cy, int cz);
+
+    // Chunks whose blocks, or blocks within 2 of their border, changed since the
+    // last call. A listed chunk may no longer exist (it became empty).
+    void TakeDirtyChunks(std::vector<ChunkCoords>& out);
+    void MarkAllDirty();
+
+private:
+    void MarkDirty(int cx, int cy, int cz);
+    void MarkDirtyAround(int x, int y, int z);
+    // The chunk, duplicated first if a snapshot may still share it.
+    VoxelChunk& Mutable(int64_t key, std::shared_ptr<VoxelChunk>& chunk);
+    static int Clamp(int v) { return v < 0 ? 0 : (v >= VOXEL_CHUNK_SIZE ? VOXEL_CHUNK_SIZE - 1 : v); }
+
+    std::unordered_map<int64_t, std::shared_ptr<VoxelChunk>> chunks;
+    size_t blockCount = 0;
+
+    // set by Snapshot(); ownedKeys are the chunks copied or created since,
+    // which no snapshot can see
+    bool snapshotLive = false;
+    std::unordered_set<int64_t> ownedKeys;
+
+    std::vector<ChunkCoords> dirtyChunks;
+    std::unordered_set<int64_t> dirtyKeys;
+};
+
+// Single-block reads for code that walks neighbouring cells, like a ray. The
+// last chunk looked up (or its absence) is kept, so most reads skip the map.
+// Only valid while the world's chunks don't change.
+class VoxelCellLookup
+{
+public:
+    explicit VoxelCellLookup(const VoxelWorld& world) : world(world) {}
+
+    BlockId Get(int x, int y, int z)
+    {
+        int cx = VoxelWorld::ChunkCoord(x), cy = VoxelWorld::ChunkCoord(y), cz = VoxelWorld::ChunkCoord(z);
+        if (!cached || cx != lastX || cy != lastY || cz != lastZ) {
+            chunk = world.FindChunk(cx, cy, cz);
+            lastX = cx; lastY = cy; lastZ = cz;
+            cached = true;
+        }
+        if (!chunk) return BLOCK_AIR;
+        return chunk->blocks[VoxelChunk::Index(x - cx * VOXEL_CHUNK_SIZE, y - cy * VOXEL_CHUNK_SIZE, z - cz * VOXEL_CHUNK_SIZE)];
+    }
+
+private:
+    const VoxelWorld& world;
+    const VoxelChunk* chunk = nullptr;
+    int lastX = 0, lastY = 0, lastZ = 0;
+    bool cached = false;
+};
@@ -1,2307 +0,0 @@
-//H V H   T E X T U R E   D A T A
-//================================
-//Generated by HVH Texture Editor v1.0
-#include <vector>
-#include "GameEngine.h"
-bool GameEngine::CreateWoodTextureSRV(UINT size, ID3D11ShaderResourceView** outSRV) {
-    static ID3D11ShaderResourceView* cachedSRV = nullptr;
-    if (cachedSRV) {
-        *outSRV = cachedSRV;
-        return true;
-    }
-
-    if (size != 64) return false;
-
-    static const struct PixelSegment {
-        BYTE r, g, b, a;
-        int count;
-    } segments[] = {
-        {189, 152, 97, 105, 1},
-        {202, 163, 104, 164, 1},
-        {188, 152, 97, 164, 2},
-        {164, 135, 82, 164, 1},
-        {157, 130, 76, 164, 1},
-        {158, 132, 76, 164, 13},
-        {157, 130, 74, 164, 1},
-        {175, 144, 88, 164, 1},
-        {189, 153, 99, 164, 1},
-        {188, 152, 97, 164, 6},
-        {183, 146, 91, 164, 1},
-        {178, 143, 88, 164, 1},
-        {180, 144, 90, 164, 2},
-        {163, 135, 79, 164, 1},
-        {158, 130, 76, 164, 1},
-        {158, 132, 76, 164, 1},
-        {157, 130, 76, 164, 1},
-        {177, 144, 90, 164, 1},
-        {189, 152, 99, 164, 1},
-        {188, 152, 97, 164, 21},
-        {188, 152, 99, 164, 1},
-        {166, 136, 82, 164, 1},
-        {157, 130, 76, 164, 1},
-        {158, 132, 76, 164, 1},
-        {169, 141, 82, 164, 1},
-        {188, 152, 98, 176, 1},
-        {217, 175, 113, 255, 1},
-        {202, 163, 105, 255, 1},
-        {203, 163, 105, 255, 1},
-        {177, 146, 88, 255, 1},
-        {169, 141, 82, 255, 1},
-        {171, 142, 83, 255, 13},
-        {169, 141, 81, 255, 1},
-        {189, 155, 96, 255, 1},
-        {204, 166, 107, 255, 1},
-        {202, 163, 105, 255, 5},
-        {203, 163, 105, 255, 1},
-        {197, 158, 99, 255, 1},
-        {192, 154, 96, 255, 1},
-        {193, 155, 97, 255, 1},
-        {195, 155, 97, 255, 1},
-        {176, 145, 86, 255, 1},
-        {170, 141, 82, 255, 1},
-        {171, 142, 83, 255, 1},
-        {169, 141, 82, 255, 1},
-        {191, 156, 98, 255, 1},
-        {204, 164, 106, 255, 1},
-        {202, 163, 105, 255, 21},
-        {203, 164, 106, 255, 1},
-        {178, 147, 88, 255, 1},
-        {169, 141, 82, 255, 1},
-        {171, 142, 83, 255, 1},
-        {183, 153, 89, 255, 1},
-        {188, 152, 97, 164, 1},
-        {202, 163, 105, 255, 1},
-        {188, 152, 98, 255, 1},
-        {189, 152, 98, 255, 1},
-        {165, 136, 82, 255, 1},
-        {157, 131, 76, 255, 1},
-        {159, 132, 77, 255, 13},
-        {157, 131, 75, 255, 1},
-        {176, 144, 89, 255, 1},
-        {190, 154, 100, 255, 1},
-        {188, 152, 98, 255, 5},
-        {189, 152, 98, 255, 1},
-        {183, 147, 92, 255, 1},
-        {179, 143, 89, 255, 1},
-        {180, 144, 90, 255, 1},
-        {181, 144, 90, 255, 1},
-        {164, 135, 80, 255, 1},
-        {158, 131, 76, 255, 1},
-        {159, 132, 77, 255, 1},
-        {157, 131, 76, 255, 1},
-        {178, 145, 91, 255, 1},
-        {190, 153, 99, 255, 1},
-        {188, 152, 98, 255, 21},
-        {189, 153, 99, 255, 1},
-        {166, 137, 82, 255, 1},
-        {157, 131, 76, 255, 1},
-        {159, 132, 77, 255, 1},
-        {170, 142, 83, 255, 1},
-        {188, 152, 97, 164, 1},
-        {202, 163, 105, 255, 1},
-        {188, 152, 98, 255, 1},
-        {189, 152, 98, 255, 1},
-        {164, 135, 81, 255, 1},
-        {156, 130, 75, 255, 1},
-        {158, 131, 76, 255, 2},
-        {158, 132, 77, 255, 1},
-        {159, 132, 77, 255, 1},
-        {158, 132, 77, 255, 2},
-        {160, 133, 77, 255, 4},
-        {159, 132, 77, 255, 3},
-        {157, 131, 75, 255, 1},
-        {176, 144, 89, 255, 1},
-        {191, 155, 101, 255, 1},
-        {189, 153, 99, 255, 1},
-        {188, 152, 98, 255, 2},
-        {189, 152, 98, 255, 2},
-        {190, 152, 98, 255, 1},
-        {184, 147, 92, 255, 1},
-        {179, 143, 89, 255, 1},
-        {180, 144, 90, 255, 1},
-        {181, 144, 90, 255, 1},
-        {164, 135, 80, 255, 1},
-        {158, 131, 76, 255, 1},
-        {159, 132, 77, 255, 1},
-        {157, 131, 76, 255, 1},
-        {178, 145, 91, 255, 1},
-        {191, 153, 99, 255, 1},
-        {189, 152, 98, 255, 7},
-        {189, 153, 99, 255, 3},
-        {189, 152, 98, 255, 5},
-        {189, 153, 99, 255, 3},
-        {188, 152, 98, 255, 3},
-        {189, 153, 99, 255, 1},
-        {166, 137, 82, 255, 1},
-        {157, 131, 76, 255, 1},
-        {159, 132, 77, 255, 1},
-        {170, 142, 83, 255, 1},
-        {188, 152, 97, 164, 1},
-        {202, 163, 105, 255, 1},
-        {188, 152, 98, 255, 2},
-        {182, 148, 93, 255, 1},
-        {180, 146, 92, 255, 2},
-        {181, 147, 93, 255, 1},
-        {177, 143, 89, 255, 1},
-        {175, 141, 86, 255, 1},
-        {176, 141, 87, 255, 1},
-        {177, 142, 88, 255, 1},
-        {136, 111, 67, 255, 1},
-        {122, 100, 60, 255, 1},
-        {125, 103, 61, 255, 1},
-        {122, 100, 60, 255, 1},
-        {160, 130, 79, 255, 1},
-        {179, 144, 89, 255, 1},
-        {175, 141, 87, 255, 2},
-        {180, 144, 90, 255, 1},
-        {183, 147, 93, 255, 3},
-        {170, 139, 84, 255, 1},
-        {164, 136, 81, 255, 1},
-        {165, 136, 82, 255, 2},
-        {164, 135, 80, 255, 1},
-        {163, 134, 79, 255, 1},
-        {163, 134, 80, 255, 1},
-        {164, 135, 80, 255, 1},
-        {160, 133, 78, 255, 1},
-        {159, 132, 77, 255, 3},
-        {163, 135, 80, 255, 1},
-        {166, 137, 82, 255, 1},
-        {165, 136, 82, 255, 5},
-        {164, 135, 81, 255, 1},
-        {177, 143, 89, 255, 1},
-        {184, 148, 94, 255, 1},
-        {183, 147, 93, 255, 1},
-        {184, 148, 94, 255, 1},
-        {173, 141, 86, 255, 1},
-        {164, 135, 81, 255, 1},
-        {165, 136, 82, 255, 1},
-        {164, 136, 81, 255, 1},
-        {178, 144, 89, 255, 1},
-        {184, 148, 94, 255, 1},
-        {183, 147, 93, 255, 1},
-        {182, 146, 92, 255, 1},
-        {186, 150, 96, 255, 1},
-        {189, 153, 99, 255, 1},
-        {188, 152, 98, 255, 1},
-        {189, 153, 99, 255, 1},
-        {166, 137, 82, 255, 1},
-        {157, 131, 76, 255, 1},
-        {159, 132, 77, 255, 1},
-        {170, 142, 83, 255, 1},
-        {188, 152, 97, 164, 1},
-        {202, 163, 105, 255, 1},
-        {188, 152, 98, 255, 2},
-        {189, 153, 99, 255, 1},
-        {190, 153, 99, 255, 2},
-        {191, 154, 100, 255, 1},
-        {184, 148, 94, 255, 1},
-        {180, 144, 90, 255, 1},
-        {182, 145, 91, 255, 1},
-        {183, 146, 92, 255, 1},
-        {128, 103, 63, 255, 1},
-        {108, 89, 54, 255, 1},
-        {113, 92, 56, 255, 1},
-        {108, 89, 54, 255, 1},
-        {160, 129, 80, 255, 1},
-        {185, 148, 93, 255, 1},
-        {181, 145, 91, 255, 2},
-        {180, 144, 90, 255, 1},
-        {179, 143, 89, 255, 2},
-        {180, 144, 90, 255, 1},
-        {164, 134, 79, 255, 1},
-        {156, 130, 75, 255, 1},
-        {157, 131, 76, 255, 2},
-        {158, 131, 76, 255, 4},
-        {159, 132, 77, 255, 4},
-        {158, 131, 76, 255, 1},
-        {157, 131, 76, 255, 6},
-        {156, 130, 75, 255, 1},
-        {172, 139, 85, 255, 1},
-        {180, 144, 90, 255, 1},
-        {179, 143, 89, 255, 1},
-        {182, 144, 90, 255, 1},
-        {167, 136, 81, 255, 1},
-        {155, 130, 75, 255, 1},
-        {157, 131, 76, 255, 1},
-        {156, 131, 75, 255, 1},
-        {173, 140, 85, 255, 1},
-        {180, 144, 90, 255, 1},
-        {179, 143, 89, 255, 1},
-        {178, 142, 88, 255, 1},
-        {185, 149, 95, 255, 1},
-        {189, 153, 99, 255, 1},
-        {188, 152, 98, 255, 1},
-        {189, 153, 99, 255, 1},
-        {166, 137, 82, 255, 1},
-        {157, 131, 76, 255, 1},
-        {159, 132, 77, 255, 1},
-        {170, 142, 83, 255, 1},
-        {188, 152, 97, 164, 1},
-        {202, 163, 105, 255, 1},
-        {188, 152, 98, 255, 5},
-        {189, 153, 99, 255, 1},
-        {183, 147, 93, 255, 1},
-        {179, 143, 89, 255, 1},
-        {181, 144, 90, 255, 1},
-        {182, 145, 91, 255, 1},
-        {130, 105, 64, 255, 1},
-        {111, 91, 55, 255, 1},
-        {115, 94, 57, 255, 1},
-        {111, 91, 55, 255, 1},
-        {160, 129, 80, 255, 1},
-        {184, 147, 92, 255, 1},
-        {180, 144, 90, 255, 5},
-        {181, 145, 91, 255, 1},
-        {165, 135, 80, 255, 1},
-        {158, 131, 76, 255, 1},
-        {159, 132, 77, 255, 17},
-        {158, 131, 76, 255, 1},
-        {173, 140, 86, 255, 1},
-        {181, 145, 91, 255, 1},
-        {180, 144, 90, 255, 1},
-        {182, 145, 91, 255, 1},
-        {168, 137, 82, 255, 1},
-        {157, 131, 76, 255, 1},
-        {159, 132, 77, 255, 1},
-        {158, 132, 76, 255, 1},
-        {174, 141, 86, 255, 1},
-        {181, 145, 91, 255, 1},
-        {180, 144, 90, 255, 1},
-        {179, 143, 89, 255, 1},
-        {185, 149, 95, 255, 1},
-        {189, 153, 99, 255, 1},
-        {188, 152, 98, 255, 1},
-        {189, 153, 99, 255, 1},
-        {166, 137, 82, 255, 1},
-        {157, 131, 76, 255, 1},
-        {159, 132, 77, 255, 1},
-        {170, 142, 83, 255, 1},
-        {188, 152, 97, 164, 1},
-        {202, 163, 105, 255, 1},
-        {188, 152, 98, 255, 5},
-        {189, 153, 99, 255, 1},
-        {184, 148, 94, 255, 1},
-        {180, 144, 90, 255, 1},
-        {182, 145, 91, 255, 1},
-        {184, 146, 92, 255, 1},
-        {128, 103, 63, 255, 1},
-        {108, 88, 53, 255, 1},
-        {112, 91, 55, 255, 1},
-        {108, 88, 53, 255, 1},
-        {160, 129, 80, 255, 1},
-        {186, 148, 93, 255, 1},
-        {181, 145, 91, 255, 5},
-        {183, 146, 92, 255, 1},
-        {164, 134, 80, 255, 1},
-        {156, 130, 75, 255, 1},
-        {157, 131, 76, 255, 6},
-        {161, 134, 78, 255, 1},
-        {162, 135, 79, 255, 1},
-        {162, 135, 78, 255, 1},
-        {163, 135, 79, 255, 1},
-        {159, 132, 77, 255, 1},
-        {157, 130, 75, 255, 1},
-        {157, 131, 75, 255, 5},
-        {156, 130, 74, 255, 1},
-        {172, 140, 86, 255, 1},
-        {181, 145, 91, 255, 1},
-        {180, 144, 90, 255, 1},
-        {182, 145, 91, 255, 1},
-        {167, 136, 81, 255, 1},
-        {155, 129, 74, 255, 1},
-        {157, 131, 75, 255, 1},
-        {156, 131, 74, 255, 1},
-        {173, 140, 85, 255, 1},
-        {180, 144, 90, 255, 1},
-        {179, 143, 89, 255, 1},
-        {178, 142, 88, 255, 1},
-        {185, 149, 95, 255, 1},
-        {189, 153, 99, 255, 1},
-        {188, 152, 98, 255, 1},
-        {189, 153, 99, 255, 1},
-        {166, 137, 82, 255, 1},
-        {157, 131, 76, 255, 1},
-        {159, 132, 77, 255, 1},
-        {170, 142, 83, 255, 1},
-        {188, 152, 97, 164, 1},
-        {202, 163, 105, 255, 1},
-        {188, 152, 98, 255, 5},
-        {190, 153, 99, 255, 1},
-        {173, 141, 87, 255, 1},
-        {164, 135, 80, 255, 1},
-        {166, 136, 81, 255, 2},
-        {149, 123, 73, 255, 1},
-        {143, 119, 70, 255, 1},
-        {145, 120, 70, 255, 1},
-        {143, 118, 70, 255, 1},
-        {159, 131, 78, 255, 1},
-        {167, 137, 82, 255, 1},
-        {166, 136, 81, 255, 5},
-        {165, 135, 81, 255, 1},
-        {171, 139, 84, 255, 1},
-        {173, 140, 86, 255, 6},
-        {175, 142, 87, 255, 1},
-        {140, 115, 69, 255, 1},
-        {127, 104, 62, 255, 1},
-        {129, 106, 63, 255, 1},
-        {126, 104, 61, 255, 1},
-        {162, 132, 82, 255, 1},
-        {182, 148, 93, 255, 1},
-        {178, 145, 91, 255, 6},
-        {180, 145, 91, 255, 1},
-        {180, 144, 90, 255, 3},
-        {179, 145, 91, 255, 1},
-        {178, 146, 91, 255, 1},
-        {178, 145, 91, 255, 2},
-        {183, 148, 94, 255, 1},
-        {185, 149, 95, 255, 3},
-        {187, 151, 97, 255, 1},
-        {188, 152, 98, 255, 2},
-        {189, 153, 99, 255, 1},
-        {166, 137, 82, 255, 1},
-        {157, 131, 76, 255, 1},
-        {159, 132, 77, 255, 1},
-        {170, 142, 83, 255, 1},
-        {188, 152, 97, 164, 1},
-        {202, 163, 105, 255, 1},
-        {188, 152, 98, 255, 5},
-        {190, 153, 99, 255, 1},
-        {167, 137, 83, 255, 1},
-        {155, 130, 75, 255, 1},
-        {157, 131, 76, 255, 2},
-        {161, 134, 78, 255, 1},
-        {163, 135, 79, 255, 1},
-        {162, 135, 79, 255, 1},
-        {163, 135, 79, 255, 1},
-        {159, 132, 77, 255, 1},
-        {157, 131, 76, 255, 1},
-        {158, 131, 76, 255, 5},
-        {156, 130, 75, 255, 1},
-        {175, 141, 86, 255, 1},
-        {183, 146, 92, 255, 1},
-        {182, 145, 91, 255, 5},
-        {185, 148, 93, 255, 1},
-        {130, 105, 64, 255, 1},
-        {107, 88, 53, 255, 1},
-        {112, 91, 56, 255, 1},
-        {106, 87, 52, 255, 1},
-        {162, 132, 84, 255, 1},
-        {195, 158, 103, 255, 1},
-        {190, 153, 100, 255, 5},
-        {190, 154, 100, 255, 1},
-        {184, 147, 92, 255, 1},
-        {179, 143, 90, 255, 1},
-        {180, 144, 90, 255, 1},
-        {179, 143, 89, 255, 1},
-        {186, 150, 96, 255, 1},
-        {191, 155, 101, 255, 1},
-        {190, 153, 100, 255, 2},
-        {189, 153, 99, 255, 4},
-        {188, 152, 98, 255, 3},
-        {189, 153, 99, 255, 1},
-        {166, 137, 82, 255, 1},
-        {157, 131, 76, 255, 1},
-        {159, 132, 77, 255, 1},
-        {170, 142, 83, 255, 1},
-        {188, 152, 97, 164, 1},
-        {202, 163, 105, 255, 1},
-        {188, 152, 98, 255, 5},
-        {190, 153, 99, 255, 1},
-        {168, 138, 84, 255, 1},
-        {157, 131, 76, 255, 1},
-        {159, 132, 77, 255, 13},
-        {158, 131, 76, 255, 1},
-        {174, 141, 86, 255, 1},
-        {181, 145, 91, 255, 1},
-        {180, 144, 90, 255, 5},
-        {183, 147, 92, 255, 1},
-        {132, 107, 65, 255, 1},
-        {111, 91, 55, 255, 1},
-        {115, 94, 57, 255, 1},
-        {110, 90, 54, 255, 1},
-        {162, 132, 84, 255, 1},
-        {193, 156, 101, 255, 1},
-        {188, 152, 98, 255, 6},
-        {183, 147, 92, 255, 1},
-        {179, 143, 90, 255, 1},
-        {180, 144, 90, 255, 1},
-        {179, 143, 89, 255, 1},
-        {185, 149, 95, 255, 1},
-        {189, 153, 99, 255, 1},
-        {188, 152, 98, 255, 9},
-        {189, 153, 99, 255, 1},
-        {166, 137, 82, 255, 1},
-        {157, 131, 76, 255, 1},
-        {159, 132, 77, 255, 1},
-        {170, 142, 83, 255, 1},
-        {194, 157, 101, 164, 1},
-        {209, 169, 109, 255, 1},
-        {195, 157, 102, 255, 5},
-        {197, 158, 103, 255, 1},
-        {173, 142, 86, 255, 1},
-        {161, 134, 78, 255, 1},
-        {163, 136, 79, 255, 2},
-        {163, 135, 79, 255, 1},
-        {162, 135, 79, 255, 1},
-        {163, 135, 79, 255, 9},
-        {161, 134, 78, 255, 1},
-        {178, 144, 88, 255, 1},
-        {186, 149, 93, 255, 1},
-        {185, 148, 92, 255, 5},
-        {188, 151, 95, 255, 1},
-        {133, 108, 66, 255, 1},
-        {111, 91, 55, 255, 1},
-        {115, 94, 57, 255, 1},
-        {110, 90, 54, 255, 1},
-        {166, 135, 86, 255, 1},
-        {199, 161, 105, 255, 1},
-        {194, 157, 101, 255, 2},
-        {194, 157, 102, 255, 1},
-        {195, 157, 102, 255, 3},
-        {189, 152, 95, 255, 1},
-        {185, 148, 93, 255, 1},
-        {186, 149, 93, 255, 1},
-        {185, 148, 92, 255, 1},
-        {191, 154, 98, 255, 1},
-        {196, 158, 103, 255, 1},
-        {195, 157, 102, 255, 6},
-        {194, 157, 101, 255, 3},
-        {195, 158, 102, 255, 1},
-        {170, 140, 84, 255, 1},
-        {160, 134, 78, 255, 1},
-        {163, 135, 79, 255, 1},
-        {174, 145, 85, 255, 1},
-        {141, 115, 71, 164, 1},
-        {153, 123, 78, 255, 1},
-        {142, 115, 72, 255, 5},
-        {143, 115, 73, 255, 1},
-        {132, 107, 65, 255, 1},
-        {127, 103, 61, 255, 1},
-        {127, 104, 62, 255, 2},
-        {133, 110, 65, 255, 1},
-        {134, 111, 65, 255, 1},
-        {134, 110, 65, 255, 10},
-        {140, 114, 70, 255, 1},
-        {143, 116, 72, 255, 1},
-        {143, 116, 71, 255, 5},
-        {144, 117, 72, 255, 1},
-        {122, 99, 61, 255, 1},
-        {113, 93, 56, 255, 1},
-        {115, 94, 57, 255, 1},
-        {113, 92, 56, 255, 1},
-        {136, 111, 69, 255, 1},
-        {151, 122, 77, 255, 1},
-        {148, 121, 76, 255, 1},
-        {149, 121, 76, 255, 1},
-        {145, 117, 74, 255, 1},
-        {141, 114, 72, 255, 1},
-        {142, 115, 72, 255, 2},
-        {138, 111, 70, 255, 1},
-        {137, 110, 68, 255, 1},
-        {138, 110, 69, 255, 1},
-        {137, 110, 68, 255, 1},
-        {140, 113, 70, 255, 1},
-        {142, 115, 72, 255, 6},
-        {141, 114, 72, 255, 1},
-        {146, 118, 75, 255, 1},
-        {149, 121, 76, 255, 1},
-        {148, 121, 76, 255, 1},
-        {149, 121, 76, 255, 1},
-        {138, 113, 68, 255, 1},
-        {133, 110, 65, 255, 1},
-        {134, 110, 65, 255, 1},
-        {144, 119, 70, 255, 1},
-        {97, 79, 48, 164, 1},
-        {106, 84, 51, 255, 1},
-        {98, 79, 47, 255, 6},
-        {100, 80, 48, 255, 1},
-        {101, 80, 49, 255, 3},
-        {109, 89, 54, 255, 1},
-        {112, 92, 55, 255, 1},
-        {111, 91, 55, 255, 10},
-        {110, 90, 55, 255, 1},
-        {110, 90, 54, 255, 7},
-        {114, 93, 56, 255, 1},
-        {115, 94, 57, 255, 3},
-        {111, 91, 55, 255, 1},
-        {109, 89, 53, 255, 1},
-        {109, 89, 54, 255, 1},
-        {110, 90, 54, 255, 1},
-        {104, 84, 50, 255, 1},
-        {97, 78, 47, 255, 1},
-        {98, 79, 47, 255, 2},
-        {99, 79, 48, 255, 5},
-        {98, 79, 47, 255, 6},
-        {97, 78, 47, 255, 1},
-        {105, 85, 52, 255, 1},
-        {110, 90, 54, 255, 1},
-        {109, 89, 54, 255, 2},
-        {111, 91, 55, 255, 1},
-        {112, 91, 55, 255, 1},
-        {111, 91, 55, 255, 1},
-        {119, 98, 59, 255, 1},
-        {104, 83, 51, 164, 1},
-        {113, 90, 55, 255, 1},
-        {105, 84, 51, 255, 10},
-        {113, 92, 56, 255, 1},
-        {116, 95, 57, 255, 1},
-        {115, 94, 57, 255, 25},
-        {116, 95, 57, 255, 1},
-        {110, 89, 54, 255, 1},
-        {104, 83, 51, 255, 1},
-        {105, 84, 51, 255, 13},
-        {104, 83, 51, 255, 1},
-        {111, 90, 55, 255, 1},
-        {116, 95, 57, 255, 1},
-        {115, 94, 57, 255, 5},
-        {123, 101, 61, 255, 1},
-        {99, 79, 48, 164, 1},
-        {107, 85, 52, 255, 1},
-        {100, 80, 48, 255, 2},
-        {101, 81, 49, 255, 1},
-        {102, 81, 49, 255, 1},
-        {101, 81, 49, 255, 6},
-        {110, 89, 55, 255, 1},
-        {113, 93, 56, 255, 1},
-        {112, 92, 56, 255, 6},
-        {111, 91, 55, 255, 1},
-        {110, 90, 54, 255, 7},
-        {111, 91, 55, 255, 1},
-        {112, 92, 56, 255, 3},
-        {111, 91, 55, 255, 1},
-        {110, 90, 54, 255, 3},
-        {112, 91, 55, 255, 1},
-        {112, 92, 56, 255, 2},
-        {113, 93, 56, 255, 1},
-        {107, 86, 52, 255, 1},
-        {100, 80, 49, 255, 1},
-        {101, 81, 49, 255, 2},
-        {103, 83, 50, 255, 1},
-        {105, 84, 51, 255, 1},
-        {104, 83, 51, 255, 1},
-        {105, 84, 51, 255, 1},
-        {102, 81, 49, 255, 1},
-        {100, 80, 48, 255, 1},
-        {100, 80, 49, 255, 5},
-        {99, 79, 49, 255, 1},
-        {107, 87, 53, 255, 1},
-        {112, 92, 55, 255, 1},
-        {111, 91, 55, 255, 3},
-        {110, 90, 54, 255, 2},
-        {118, 97, 58, 255, 1},
-        {163, 132, 83, 164, 1},
-        {175, 141, 90, 255, 1},
-        {163, 132, 84, 255, 1},
-        {164, 132, 84, 255, 1},
-        {147, 120, 73, 255, 1},
-        {141, 117, 68, 255, 1},
-        {142, 117, 69, 255, 6},
-        {145, 120, 70, 255, 1},
-        {146, 121, 71, 255, 1},
-        {146, 120, 71, 255, 5},
-        {144, 120, 70, 255, 1},
-        {158, 129, 79, 255, 1},
-        {167, 136, 87, 255, 1},
-        {166, 135, 86, 255, 5},
-        {167, 135, 86, 255, 1},
-        {153, 126, 76, 255, 1},
-        {144, 120, 69, 255, 1},
-        {146, 120, 71, 255, 1},
-        {145, 120, 70, 255, 1},
-        {161, 131, 82, 255, 1},
-        {167, 135, 86, 255, 1},
-        {166, 135, 86, 255, 1},
-        {167, 135, 86, 255, 1},
-        {153, 125, 76, 255, 1},
-        {144, 120, 70, 255, 1},
-        {146, 120, 71, 255, 1},
-        {146, 121, 71, 255, 1},
-        {144, 119, 70, 255, 1},
-        {142, 117, 69, 255, 2},
-        {144, 119, 70, 255, 1},
-        {122, 100, 59, 255, 1},
-        {110, 89, 55, 255, 1},
-        {112, 91, 55, 255, 1},
-        {109, 88, 53, 255, 1},
-        {139, 112, 69, 255, 1},
-        {161, 129, 80, 255, 1},
-        {157, 126, 78, 255, 6},
-        {159, 128, 79, 255, 1},
-        {161, 129, 80, 255, 1},
-        {160, 129, 80, 255, 2},
-        {164, 133, 83, 255, 1},
-        {167, 135, 86, 255, 1},
-        {166, 135, 86, 255, 1},
-        {178, 145, 92, 255, 1},
-        {194, 157, 101, 164, 1},
-        {208, 168, 108, 255, 1},
-        {194, 157, 101, 255, 1},
-        {195, 157, 101, 255, 1},
-        {169, 140, 84, 255, 1},
-        {161, 134, 78, 255, 1},
-        {163, 135, 79, 255, 6},
-        {162, 135, 78, 255, 7},
-        {160, 134, 76, 255, 1},
-        {180, 147, 91, 255, 1},
-        {195, 158, 103, 255, 1},
-        {193, 156, 101, 255, 5},
-        {195, 157, 102, 255, 1},
-        {174, 142, 87, 255, 1},
-        {160, 134, 76, 255, 1},
-        {162, 135, 78, 255, 1},
-        {161, 134, 77, 255, 1},
-        {186, 151, 96, 255, 1},
-        {195, 157, 102, 255, 1},
-        {193, 156, 101, 255, 1},
-        {195, 157, 102, 255, 1},
-        {173, 142, 86, 255, 1},
-        {160, 134, 77, 255, 1},
-        {162, 135, 78, 255, 2},
-        {162, 135, 79, 255, 1},
-        {163, 135, 79, 255, 2},
-        {165, 137, 80, 255, 1},
-        {131, 108, 64, 255, 1},
-        {112, 91, 56, 255, 1},
-        {116, 95, 57, 255, 1},
-        {110, 90, 54, 255, 1},
-        {157, 127, 79, 255, 1},
-        {190, 152, 96, 255, 1},
-        {185, 148, 93, 255, 6},
-        {185, 148, 92, 255, 1},
-        {184, 147, 92, 255, 2},
-        {183, 146, 91, 255, 1},
-        {190, 153, 98, 255, 1},
-        {194, 157, 102, 255, 1},
-        {193, 156, 101, 255, 1},
-        {207, 167, 108, 255, 1},
-        {188, 152, 97, 164, 1},
-        {202, 163, 105, 255, 1},
-        {188, 152, 98, 255, 1},
-        {189, 152, 98, 255, 1},
-        {165, 136, 82, 255, 1},
-        {157, 131, 76, 255, 1},
-        {159, 132, 77, 255, 13},
-        {157, 131, 75, 255, 1},
-        {176, 144, 89, 255, 1},
-        {190, 154, 100, 255, 1},
-        {188, 152, 98, 255, 5},
-        {190, 153, 99, 255, 1},
-        {170, 139, 85, 255, 1},
-        {157, 131, 75, 255, 1},
-        {159, 132, 77, 255, 1},
-        {158, 131, 76, 255, 1},
-        {181, 147, 93, 255, 1},
-        {190, 153, 99, 255, 1},
-        {188, 152, 98, 255, 1},
-        {190, 153, 99, 255, 1},
-        {169, 139, 84, 255, 1},
-        {157, 131, 76, 255, 1},
-        {159, 132, 77, 255, 5},
-        {161, 134, 78, 255, 1},
-        {129, 106, 63, 255, 1},
-        {112, 91, 56, 255, 1},
-        {115, 94, 57, 255, 1},
-        {110, 90, 54, 255, 1},
-        {154, 124, 77, 255, 1},
-        {185, 148, 93, 255, 1},
-        {180, 144, 90, 255, 9},
-        {179, 143, 89, 255, 1},
-        {185, 149, 95, 255, 1},
-        {189, 153, 99, 255, 1},
-        {188, 152, 98, 255, 1},
-        {202, 163, 105, 255, 1},
-        {189, 153, 99, 164, 1},
-        {204, 164, 107, 255, 1},
-        {190, 153, 99, 255, 1},
-        {191, 153, 99, 255, 1},
-        {165, 136, 82, 255, 1},
-        {157, 131, 76, 255, 1},
-        {159, 132, 77, 255, 2},
-        {161, 134, 78, 255, 1},
-        {163, 135, 79, 255, 1},
-        {162, 135, 79, 255, 2},
-        {159, 132, 76, 255, 1},
-        {157, 131, 76, 255, 6},
-        {155, 130, 74, 255, 1},
-        {176, 144, 89, 255, 1},
-        {191, 155, 101, 255, 1},
-        {189, 153, 98, 255, 1},
-        {189, 153, 99, 255, 1},
-        {188, 152, 98, 255, 3},
-        {190, 153, 99, 255, 1},
-        {170, 139, 85, 255, 1},
-        {157, 131, 75, 255, 1},
-        {159, 132, 77, 255, 1},
-        {158, 131, 76, 255, 1},
-        {181, 147, 93, 255, 1},
-        {191, 154, 99, 255, 1},
-        {189, 153, 98, 255, 1},
-        {191, 154, 100, 255, 1},
-        {168, 139, 84, 255, 1},
-        {155, 130, 75, 255, 1},
-        {157, 131, 76, 255, 5},
-        {160, 133, 77, 255, 1},
-        {125, 103, 61, 255, 1},
-        {107, 87, 54, 255, 1},
-        {110, 91, 55, 255, 1},
-        {105, 86, 51, 255, 1},
-        {153, 123, 77, 255, 1},
-        {187, 149, 94, 255, 1},
-        {181, 145, 91, 255, 9},
-        {180, 144, 90, 255, 1},
-        {187, 150, 96, 255, 1},
-        {191, 154, 101, 255, 1},
-        {190, 153, 99, 255, 1},
-        {204, 164, 107, 255, 1},
-        {171, 139, 85, 164, 1},
-        {184, 151, 92, 255, 1},
-        {171, 140, 86, 255, 2},
-        {162, 134, 79, 255, 1},
-        {158, 131, 76, 255, 1},
-        {159, 132, 77, 255, 1},
-        {161, 134, 78, 255, 1},
-        {142, 117, 69, 255, 1},
-        {131, 107, 64, 255, 1},
-        {132, 109, 65, 255, 2},
-        {163, 133, 81, 255, 1},
-        {173, 140, 85, 255, 1},
-        {171, 139, 84, 255, 5},
-        {170, 138, 84, 255, 1},
-        {179, 144, 89, 255, 1},
-        {184, 148, 94, 255, 1},
-        {184, 147, 93, 255, 1},
-        {183, 147, 92, 255, 1},
-        {187, 151, 97, 255, 1},
-        {188, 152, 98, 255, 2},
-        {190, 153, 99, 255, 1},
-        {170, 139, 85, 255, 1},
-        {157, 131, 75, 255, 1},
-        {159, 132, 77, 255, 1},
-        {158, 131, 76, 255, 1},
-        {177, 143, 89, 255, 1},
-        {185, 148, 94, 255, 1},
-        {184, 147, 93, 255, 1},
-        {184, 148, 93, 255, 1},
-        {176, 142, 88, 255, 1},
-        {170, 138, 84, 255, 1},
-        {171, 139, 84, 255, 5},
-        {172, 139, 85, 255, 1},
-        {159, 129, 80, 255, 1},
-        {153, 123, 77, 255, 1},
-        {154, 125, 77, 255, 1},
-        {153, 124, 77, 255, 1},
-        {162, 132, 80, 255, 1},
-        {169, 138, 83, 255, 1},
-        {168, 137, 82, 255, 9},
-        {167, 137, 82, 255, 1},
-        {170, 139, 84, 255, 1},
-        {171, 140, 86, 255, 2},
-        {183, 150, 92, 255, 1},
-        {157, 130, 74, 164, 1},
-        {169, 140, 81, 255, 1},
-        {157, 130, 75, 255, 2},
-        {159, 132, 77, 255, 3},
-        {162, 135, 78, 255, 1},
-        {127, 104, 62, 255, 1},
-        {108, 88, 54, 255, 1},
-        {110, 90, 55, 255, 1},
-        {110, 90, 54, 255, 1},
-        {167, 135, 84, 255, 1},
-        {185, 148, 93, 255, 1},
-        {182, 145, 91, 255, 6},
-        {180, 144, 90, 255, 1},
-        {179, 143, 89, 255, 2},
-        {178, 142, 88, 255, 1},
-        {186, 150, 96, 255, 1},
-        {189, 153, 99, 255, 1},
-        {188, 152, 98, 255, 1},
-        {190, 153, 99, 255, 1},
-        {170, 139, 85, 255, 1},
-        {157, 131, 75, 255, 1},
-        {159, 132, 77, 255, 1},
-        {158, 131, 76, 255, 1},
-        {175, 141, 87, 255, 1},
-        {180, 144, 90, 255, 1},
-        {179, 143, 89, 255, 2},
-        {181, 144, 90, 255, 1},
-        {182, 145, 91, 255, 6},
-        {181, 145, 91, 255, 1},
-        {184, 147, 92, 255, 1},
-        {185, 148, 92, 255, 2},
-        {187, 149, 94, 255, 1},
-        {169, 138, 82, 255, 1},
-        {155, 130, 75, 255, 1},
-        {157, 131, 76, 255, 11},
-        {157, 130, 75, 255, 2},
-        {168, 140, 81, 255, 1},
-        {158, 132, 76, 164, 1},
-        {171, 142, 83, 255, 1},
-        {159, 132, 77, 255, 5},
-        {162, 135, 78, 255, 1},
-        {129, 106, 63, 255, 1},
-        {112, 91, 56, 255, 1},
-        {114, 93, 57, 255, 1},
-        {114, 93, 56, 255, 1},
-        {167, 135, 84, 255, 1},
-        {183, 147, 92, 255, 1},
-        {180, 144, 90, 255, 9},
-        {179, 143, 89, 255, 1},
-        {186, 150, 96, 255, 1},
-        {189, 153, 99, 255, 1},
-        {188, 152, 98, 255, 1},
-        {190, 153, 99, 255, 1},
-        {170, 139, 85, 255, 1},
-        {157, 131, 75, 255, 1},
-        {159, 132, 77, 255, 1},
-        {158, 131, 76, 255, 1},
-        {175, 141, 87, 255, 1},
-        {181, 145, 91, 255, 1},
-        {180, 144, 90, 255, 13},
-        {182, 145, 91, 255, 1},
-        {168, 137, 82, 255, 1},
-        {157, 131, 76, 255, 1},
-        {159, 132, 77, 255, 13},
-        {170, 142, 83, 255, 1},
-        {157, 130, 74, 164, 1},
-        {169, 141, 82, 255, 1},
-        {157, 131, 76, 255, 5},
-        {161, 134, 77, 255, 1},
-        {126, 103, 61, 255, 1},
-        {107, 87, 53, 255, 1},
-        {110, 89, 54, 255, 1},
-        {110, 89, 53, 255, 1},
-        {166, 134, 83, 255, 1},
-        {183, 147, 92, 255, 1},
-        {180, 144, 90, 255, 3},
-        {179, 143, 89, 255, 7},
-        {186, 150, 96, 255, 1},
-        {189, 153, 99, 255, 1},
-        {188, 152, 98, 255, 1},
-        {190, 153, 99, 255, 1},
-        {170, 139, 85, 255, 1},
-        {157, 131, 75, 255, 1},
-        {159, 132, 77, 255, 1},
-        {158, 131, 76, 255, 1},
-        {176, 141, 87, 255, 1},
-        {182, 146, 92, 255, 1},
-        {181, 145, 91, 255, 5},
-        {181, 144, 91, 255, 1},
-        {183, 146, 91, 255, 1},
-        {184, 147, 92, 255, 3},
-        {181, 144, 90, 255, 1},
-        {179, 143, 89, 255, 2},
-        {182, 145, 91, 255, 1},
-        {167, 136, 81, 255, 1},
-        {155, 130, 75, 255, 1},
-        {157, 131, 76, 255, 13},
-        {168, 141, 82, 255, 1},
-        {180, 146, 91, 164, 1},
-        {194, 157, 99, 255, 1},
-        {180, 147, 92, 255, 5},
-        {181, 147, 93, 255, 1},
-        {172, 139, 88, 255, 1},
-        {167, 134, 86, 255, 1},
-        {167, 135, 86, 255, 2},
-        {178, 143, 89, 255, 1},
-        {180, 144, 90, 255, 2},
-        {179, 143, 89, 255, 1},
-        {183, 147, 93, 255, 1},
-        {186, 150, 96, 255, 7},
-        {187, 151, 97, 255, 1},
-        {188, 152, 98, 255, 2},
-        {190, 153, 99, 255, 1},
-        {170, 139, 85, 255, 1},
-        {157, 131, 75, 255, 1},
-        {159, 132, 77, 255, 2},
-        {163, 134, 80, 255, 1},
-        {165, 135, 81, 255, 1},
-        {165, 135, 80, 255, 5},
-        {167, 137, 82, 255, 1},
-        {147, 120, 73, 255, 1},
-        {130, 106, 65, 255, 1},
-        {133, 108, 66, 255, 1},
-        {130, 106, 65, 255, 1},
-        {169, 137, 87, 255, 1},
-        {189, 153, 98, 255, 1},
-        {186, 150, 96, 255, 2},
-        {183, 148, 94, 255, 1},
-        {180, 146, 92, 255, 1},
-        {180, 147, 92, 255, 13},
-        {193, 157, 99, 255, 1},
-        {189, 153, 99, 164, 1},
-        {204, 164, 106, 255, 1},
-        {190, 153, 99, 255, 6},
-        {192, 155, 100, 255, 1},
-        {193, 156, 101, 255, 3},
-        {183, 147, 93, 255, 1},
-        {179, 143, 89, 255, 1},
-        {180, 144, 90, 255, 1},
-        {179, 143, 89, 255, 1},
-        {185, 149, 95, 255, 1},
-        {190, 154, 100, 255, 1},
-        {189, 153, 99, 255, 6},
-        {188, 152, 98, 255, 3},
-        {190, 153, 99, 255, 1},
-        {170, 139, 85, 255, 1},
-        {157, 131, 75, 255, 1},
-        {159, 132, 77, 255, 2},
-        {158, 131, 76, 255, 7},
-        {162, 134, 78, 255, 1},
-        {132, 109, 64, 255, 1},
-        {107, 88, 53, 255, 1},
-        {111, 91, 55, 255, 1},
-        {107, 88, 53, 255, 1},
-        {165, 134, 86, 255, 1},
-        {194, 157, 102, 255, 1},
-        {189, 153, 99, 255, 1},
-        {188, 152, 98, 255, 1},
-        {189, 153, 99, 255, 1},
-        {190, 153, 99, 255, 14},
-        {204, 164, 106, 255, 1},
-        {188, 152, 97, 164, 1},
-        {202, 163, 105, 255, 1},
-        {188, 152, 98, 255, 10},
-        {182, 146, 92, 255, 1},
-        {179, 143, 89, 255, 1},
-        {180, 144, 90, 255, 1},
-        {179, 143, 89, 255, 1},
-        {185, 149, 95, 255, 1},
-        {189, 153, 99, 255, 1},
-        {188, 152, 98, 255, 9},
-        {190, 153, 99, 255, 1},
-        {170, 139, 85, 255, 1},
-        {157, 131, 75, 255, 1},
-        {159, 132, 77, 255, 9},
-        {163, 135, 79, 255, 1},
-        {135, 111, 66, 255, 1},
-        {111, 91, 55, 255, 1},
-        {115, 94, 57, 255, 1},
-        {111, 91, 55, 255, 1},
-        {166, 135, 86, 255, 1},
-        {193, 156, 101, 255, 1},
-        {188, 152, 98, 255, 17},
-        {202, 163, 105, 255, 1},
-        {192, 155, 101, 164, 1},
-        {207, 167, 108, 255, 1},
-        {193, 156, 101, 255, 6},
-        {194, 157, 101, 255, 1},
-        {194, 157, 102, 255, 3},
-        {187, 150, 95, 255, 1},
-        {184, 147, 92, 255, 1},
-        {185, 148, 93, 255, 1},
-        {184, 147, 92, 255, 1},
-        {191, 154, 98, 255, 1},
-        {195, 158, 103, 255, 1},
-        {194, 157, 102, 255, 9},
-        {196, 158, 103, 255, 1},
-        {174, 143, 87, 255, 1},
-        {160, 133, 76, 255, 1},
-        {162, 135, 78, 255, 9},
-        {166, 138, 80, 255, 1},
-        {137, 112, 67, 255, 1},
-        {111, 91, 55, 255, 1},
-        {116, 95, 57, 255, 1},
-        {111, 91, 55, 255, 1},
-        {170, 138, 88, 255, 1},
-        {199, 161, 105, 255, 1},
-        {194, 157, 102, 255, 10},
-        {193, 156, 101, 255, 7},
-        {207, 167, 108, 255, 1},
-        {143, 115, 73, 164, 1},
-        {153, 124, 78, 255, 1},
-        {142, 116, 73, 255, 5},
-        {143, 116, 73, 255, 1},
-        {139, 113, 71, 255, 1},
-        {137, 110, 70, 255, 1},
-        {138, 110, 70, 255, 2},
-        {135, 108, 67, 255, 1},
-        {133, 107, 66, 255, 1},
-        {134, 107, 66, 255, 1},
-        {133, 107, 66, 255, 1},
-        {136, 109, 69, 255, 1},
-        {138, 111, 70, 255, 1},
-        {138, 110, 70, 255, 10},
-        {134, 109, 66, 255, 1},
-        {131, 109, 64, 255, 1},
-        {132, 108, 64, 255, 2},
-        {132, 109, 64, 255, 1},
-        {132, 108, 64, 255, 3},
-        {132, 109, 64, 255, 3},
-        {134, 110, 65, 255, 1},
-        {119, 97, 58, 255, 1},
-        {107, 85, 52, 255, 1},
-        {109, 87, 53, 255, 1},
-        {107, 86, 52, 255, 1},
-        {128, 103, 64, 255, 1},
-        {140, 112, 71, 255, 1},
-        {138, 110, 70, 255, 9},
-        {137, 110, 70, 255, 1},
-        {141, 114, 71, 255, 1},
-        {143, 116, 73, 255, 1},
-        {142, 116, 73, 255, 5},
-        {153, 124, 78, 255, 1},
-        {110, 88, 54, 164, 1},
-        {118, 96, 58, 255, 1},
-        {110, 90, 54, 255, 5},
-        {111, 91, 54, 255, 1},
-        {102, 82, 50, 255, 1},
-        {98, 78, 47, 255, 1},
-        {99, 79, 47, 255, 2},
-        {99, 79, 48, 255, 3},
-        {99, 80, 48, 255, 1},
-        {99, 79, 48, 255, 1},
-        {99, 79, 47, 255, 10},
-        {97, 78, 47, 255, 1},
-        {107, 86, 52, 255, 1},
-        {113, 92, 56, 255, 1},
-        {112, 91, 55, 255, 9},
-        {112, 92, 55, 255, 1},
-        {108, 87, 53, 255, 1},
-        {104, 82, 51, 255, 1},
-        {104, 83, 51, 255, 1},
-        {105, 84, 51, 255, 1},
-        {100, 80, 48, 255, 1},
-        {98, 79, 47, 255, 1},
-        {99, 79, 47, 255, 9},
-        {98, 78, 47, 255, 1},
-        {105, 85, 52, 255, 1},
-        {111, 91, 54, 255, 1},
-        {110, 90, 54, 255, 5},
-        {117, 96, 58, 255, 1},
-        {115, 93, 57, 164, 1},
-        {124, 101, 61, 255, 1},
-        {115, 94, 57, 255, 5},
-        {116, 95, 57, 255, 1},
-        {108, 87, 53, 255, 1},
-        {104, 83, 51, 255, 1},
-        {105, 84, 51, 255, 17},
-        {104, 83, 51, 255, 1},
-        {111, 90, 54, 255, 1},
-        {116, 95, 57, 255, 1},
-        {115, 94, 57, 255, 9},
-        {116, 95, 57, 255, 1},
-        {110, 89, 54, 255, 1},
-        {104, 83, 51, 255, 1},
-        {105, 84, 51, 255, 13},
-        {104, 83, 51, 255, 1},
-        {111, 90, 55, 255, 1},
-        {116, 95, 57, 255, 1},
-        {115, 94, 57, 255, 5},
-        {123, 101, 61, 255, 1},
-        {108, 88, 54, 164, 1},
-        {118, 96, 57, 255, 1},
-        {109, 89, 54, 255, 5},
-        {110, 90, 54, 255, 1},
-        {101, 82, 49, 255, 1},
-        {97, 77, 47, 255, 1},
-        {98, 78, 47, 255, 10},
-        {102, 81, 49, 255, 1},
-        {105, 84, 51, 255, 1},
-        {104, 83, 51, 255, 2},
-        {102, 81, 49, 255, 1},
-        {100, 80, 49, 255, 1},
-        {101, 80, 49, 255, 1},
-        {100, 79, 49, 255, 1},
-        {106, 86, 51, 255, 1},
-        {110, 90, 53, 255, 1},
-        {109, 89, 54, 255, 6},
-        {109, 90, 54, 255, 1},
-        {110, 90, 54, 255, 2},
-        {111, 91, 54, 255, 1},
-        {104, 84, 51, 255, 1},
-        {98, 78, 48, 255, 1},
-        {99, 79, 48, 255, 6},
-        {98, 79, 47, 255, 1},
-        {98, 78, 47, 255, 6},
-        {97, 77, 47, 255, 1},
-        {105, 85, 51, 255, 1},
-        {110, 90, 54, 255, 1},
-        {109, 89, 54, 255, 2},
-        {111, 91, 55, 255, 1},
-        {112, 91, 55, 255, 1},
-        {111, 91, 55, 255, 1},
-        {119, 98, 59, 255, 1},
-        {153, 124, 79, 164, 1},
-        {165, 134, 84, 255, 1},
-        {153, 125, 79, 255, 5},
-        {154, 125, 79, 255, 1},
-        {150, 121, 77, 255, 1},
-        {148, 119, 76, 255, 1},
-        {149, 120, 76, 255, 9},
-        {151, 122, 77, 255, 1},
-        {126, 102, 63, 255, 1},
-        {107, 86, 52, 255, 1},
-        {110, 89, 54, 255, 1},
-        {108, 88, 53, 255, 1},
-        {127, 104, 61, 255, 1},
-        {135, 110, 65, 255, 1},
-        {134, 109, 65, 255, 1},
-        {132, 108, 64, 255, 1},
-        {145, 118, 73, 255, 1},
-        {155, 126, 80, 255, 1},
-        {153, 125, 79, 255, 5},
-        {154, 125, 79, 255, 1},
-        {151, 122, 76, 255, 1},
-        {149, 120, 74, 255, 1},
-        {149, 121, 74, 255, 1},
-        {150, 121, 74, 255, 1},
-        {147, 118, 73, 255, 1},
-        {144, 115, 71, 255, 1},
-        {145, 116, 71, 255, 5},
-        {144, 115, 71, 255, 1},
-        {147, 118, 74, 255, 1},
-        {149, 120, 76, 255, 6},
-        {148, 119, 76, 255, 1},
-        {151, 123, 78, 255, 1},
-        {154, 125, 79, 255, 1},
-        {153, 125, 79, 255, 1},
-        {154, 125, 79, 255, 1},
-        {142, 117, 70, 255, 1},
-        {137, 114, 67, 255, 1},
-        {138, 114, 68, 255, 1},
-        {148, 123, 73, 255, 1},
-        {194, 157, 101, 164, 1},
-        {209, 168, 109, 255, 1},
-        {194, 157, 102, 255, 6},
-        {195, 158, 102, 255, 11},
-        {201, 163, 105, 255, 1},
-        {149, 122, 76, 255, 1},
-        {109, 89, 54, 255, 1},
-        {116, 95, 57, 255, 1},
-        {113, 93, 56, 255, 1},
-        {151, 125, 73, 255, 1},
-        {167, 138, 80, 255, 1},
-        {164, 136, 79, 255, 1},
-        {161, 135, 78, 255, 1},
-        {183, 149, 93, 255, 1},
-        {196, 158, 104, 255, 1},
-        {194, 157, 102, 255, 5},
-        {195, 157, 102, 255, 1},
-        {189, 152, 95, 255, 1},
-        {184, 147, 93, 255, 1},
-        {186, 148, 93, 255, 1},
-        {185, 148, 93, 255, 1},
-        {186, 149, 93, 255, 7},
-        {185, 148, 92, 255, 1},
-        {192, 155, 99, 255, 1},
-        {196, 159, 103, 255, 1},
-        {195, 158, 102, 255, 6},
-        {195, 157, 102, 255, 1},
-        {194, 157, 102, 255, 2},
-        {195, 158, 103, 255, 1},
-        {170, 141, 84, 255, 1},
-        {161, 134, 78, 255, 1},
-        {163, 135, 79, 255, 1},
-        {174, 145, 85, 255, 1},
-        {188, 152, 97, 164, 1},
-        {202, 163, 105, 255, 1},
-        {188, 152, 98, 255, 17},
-        {194, 157, 101, 255, 1},
-        {146, 119, 74, 255, 1},
-        {109, 89, 54, 255, 1},
-        {115, 94, 57, 255, 1},
-        {112, 92, 56, 255, 1},
-        {147, 122, 71, 255, 1},
-        {162, 134, 78, 255, 1},
-        {159, 132, 77, 255, 1},
-        {157, 131, 76, 255, 1},
-        {177, 144, 90, 255, 1},
-        {190, 153, 100, 255, 1},
-        {188, 152, 98, 255, 5},
-        {189, 152, 98, 255, 1},
-        {183, 147, 92, 255, 1},
-        {179, 143, 90, 255, 1},
-        {180, 144, 90, 255, 9},
-        {179, 143, 89, 255, 1},
-        {185, 149, 95, 255, 1},
-        {189, 153, 99, 255, 1},
-        {188, 152, 98, 255, 9},
-        {189, 153, 99, 255, 1},
-        {166, 137, 82, 255, 1},
-        {157, 131, 76, 255, 1},
-        {159, 132, 77, 255, 1},
-        {170, 142, 83, 255, 1},
-        {189, 153, 99, 164, 1},
-        {204, 164, 106, 255, 1},
-        {190, 153, 99, 255, 17},
-        {196, 158, 103, 255, 1},
-        {144, 117, 73, 255, 1},
-        {104, 85, 51, 255, 1},
-        {110, 90, 54, 255, 1},
-        {107, 88, 53, 255, 1},
-        {145, 120, 70, 255, 1},
-        {161, 134, 77, 255, 1},
-        {158, 131, 76, 255, 1},
-        {156, 130, 75, 255, 1},
-        {177, 144, 90, 255, 1},
-        {191, 154, 100, 255, 1},
-        {189, 152, 98, 255, 1},
-        {188, 152, 98, 255, 1},
-        {189, 153, 99, 255, 1},
-        {190, 153, 99, 255, 2},
-        {191, 153, 99, 255, 1},
-        {185, 148, 93, 255, 1},
-        {180, 144, 91, 255, 1},
-        {181, 145, 91, 255, 6},
-        {183, 146, 92, 255, 1},
-        {184, 147, 92, 255, 2},
-        {183, 146, 91, 255, 1},
-        {187, 150, 96, 255, 1},
-        {189, 153, 99, 255, 1},
-        {188, 152, 98, 255, 2},
-        {189, 153, 99, 255, 1},
-        {190, 153, 99, 255, 6},
-        {191, 154, 100, 255, 1},
-        {166, 137, 82, 255, 1},
-        {157, 131, 76, 255, 1},
-        {159, 132, 77, 255, 1},
-        {170, 142, 83, 255, 1},
-        {169, 138, 83, 164, 1},
-        {182, 149, 91, 255, 1},
-        {169, 139, 84, 255, 17},
-        {170, 139, 84, 255, 1},
-        {166, 136, 85, 255, 1},
-        {162, 131, 84, 255, 1},
-        {162, 132, 84, 255, 1},
-        {162, 131, 84, 255, 1},
-        {170, 138, 85, 255, 1},
-        {173, 140, 85, 255, 2},
-        {172, 139, 85, 255, 1},
-        {179, 144, 90, 255, 1},
-        {184, 147, 93, 255, 1},
-        {183, 147, 92, 255, 1},
-        {184, 147, 93, 255, 1},
-        {172, 141, 86, 255, 1},
-        {168, 138, 84, 255, 1},
-        {169, 139, 84, 255, 2},
-        {167, 137, 82, 255, 1},
-        {166, 136, 81, 255, 6},
-        {167, 137, 82, 255, 1},
-        {147, 120, 73, 255, 1},
-        {136, 110, 69, 255, 1},
-        {138, 112, 69, 255, 1},
-        {134, 109, 67, 255, 1},
-        {168, 136, 86, 255, 1},
-        {192, 155, 101, 255, 1},
-        {188, 152, 98, 255, 1},
-        {189, 153, 99, 255, 1},
-        {174, 142, 88, 255, 1},
-        {168, 138, 83, 255, 1},
-        {169, 139, 84, 255, 6},
-        {162, 134, 79, 255, 1},
-        {158, 132, 77, 255, 1},
-        {159, 132, 77, 255, 1},
-        {170, 142, 83, 255, 1},
-        {157, 130, 74, 164, 1},
-        {169, 141, 81, 255, 1},
-        {157, 131, 76, 255, 17},
-        {154, 129, 73, 255, 1},
-        {178, 146, 90, 255, 1},
-        {196, 158, 103, 255, 1},
-        {193, 156, 101, 255, 2},
-        {184, 148, 93, 255, 1},
-        {181, 145, 91, 255, 2},
-        {182, 145, 91, 255, 1},
-        {180, 144, 90, 255, 1},
-        {179, 143, 89, 255, 1},
-        {179, 143, 90, 255, 1},
-        {180, 143, 90, 255, 1},
-        {162, 134, 79, 255, 1},
-        {156, 130, 74, 255, 1},
-        {157, 131, 76, 255, 1},
-        {157, 131, 75, 255, 1},
-        {157, 131, 76, 255, 1},
-        {158, 131, 76, 255, 6},
-        {160, 133, 77, 255, 1},
-        {125, 103, 61, 255, 1},
-        {107, 87, 53, 255, 1},
-        {110, 90, 54, 255, 1},
-        {104, 85, 51, 255, 1},
-        {156, 127, 80, 255, 1},
-        {194, 157, 101, 255, 1},
-        {188, 152, 98, 255, 1},
-        {189, 153, 99, 255, 1},
-        {166, 136, 82, 255, 1},
-        {155, 130, 74, 255, 1},
-        {157, 131, 76, 255, 5},
-        {157, 131, 75, 255, 1},
-        {159, 132, 77, 255, 3},
-        {170, 142, 83, 255, 1},
-        {158, 132, 76, 164, 1},
-        {171, 142, 83, 255, 1},
-        {159, 132, 77, 255, 17},
-        {157, 131, 75, 255, 1},
-        {176, 144, 89, 255, 1},
-        {190, 154, 100, 255, 1},
-        {188, 152, 98, 255, 2},
-        {182, 146, 92, 255, 1},
-        {180, 144, 90, 255, 6},
-        {181, 144, 90, 255, 1},
-        {164, 135, 80, 255, 1},
-        {158, 131, 76, 255, 1},
-        {159, 132, 77, 255, 9},
-        {161, 134, 78, 255, 1},
-        {129, 106, 63, 255, 1},
-        {112, 91, 56, 255, 1},
-        {115, 94, 57, 255, 1},
-        {109, 89, 54, 255, 1},
-        {158, 128, 81, 255, 1},
-        {194, 157, 101, 255, 1},
-        {188, 152, 98, 255, 1},
-        {189, 153, 99, 255, 1},
-        {167, 137, 83, 255, 1},
-        {157, 131, 76, 255, 1},
-        {159, 132, 77, 255, 9},
-        {170, 142, 83, 255, 1},
-        {155, 130, 74, 164, 1},
-        {168, 140, 81, 255, 1},
-        {157, 130, 75, 255, 2},
-        {157, 131, 76, 255, 12},
-        {157, 131, 75, 255, 1},
-        {157, 130, 75, 255, 2},
-        {154, 129, 73, 255, 1},
-        {175, 143, 88, 255, 1},
-        {190, 154, 100, 255, 1},
-        {188, 152, 98, 255, 2},
-        {183, 147, 93, 255, 1},
-        {182, 145, 91, 255, 6},
-        {183, 145, 91, 255, 1},
-        {164, 135, 80, 255, 1},
-        {158, 131, 76, 255, 1},
-        {159, 132, 77, 255, 6},
-        {158, 132, 76, 255, 1},
-        {157, 131, 76, 255, 2},
-        {159, 133, 77, 255, 1},
-        {125, 103, 61, 255, 1},
-        {106, 87, 53, 255, 1},
-        {110, 90, 54, 255, 1},
-        {103, 84, 51, 255, 1},
-        {156, 127, 80, 255, 1},
-        {195, 158, 102, 255, 1},
-        {189, 153, 99, 255, 1},
-        {190, 154, 100, 255, 1},
-        {166, 136, 82, 255, 1},
-        {155, 130, 75, 255, 1},
-        {157, 131, 76, 255, 6},
-        {159, 132, 77, 255, 3},
-        {170, 142, 83, 255, 1},
-        {174, 143, 87, 164, 1},
-        {188, 153, 95, 255, 1},
-        {175, 143, 88, 255, 1},
-        {175, 143, 89, 255, 1},
-        {172, 140, 86, 255, 1},
-        {170, 138, 83, 255, 1},
-        {170, 138, 84, 255, 10},
-        {173, 141, 87, 255, 1},
-        {175, 143, 89, 255, 1},
-        {175, 143, 88, 255, 1},
-        {174, 142, 87, 255, 1},
-        {182, 148, 94, 255, 1},
-        {189, 153, 99, 255, 1},
-        {188, 152, 98, 255, 1},
-        {189, 153, 99, 255, 1},
-        {174, 141, 87, 255, 1},
-        {167, 137, 82, 255, 1},
-        {168, 137, 83, 255, 5},
-        {169, 137, 83, 255, 1},
-        {161, 133, 78, 255, 1},
-        {159, 132, 77, 255, 6},
-        {158, 131, 76, 255, 1},
-        {165, 135, 81, 255, 1},
-        {171, 139, 84, 255, 1},
-        {170, 138, 84, 255, 1},
-        {171, 139, 84, 255, 1},
-        {157, 127, 78, 255, 1},
-        {150, 120, 75, 255, 1},
-        {151, 122, 75, 255, 1},
-        {148, 120, 74, 255, 1},
-        {170, 137, 86, 255, 1},
-        {186, 150, 95, 255, 1},
-        {183, 147, 93, 255, 1},
-        {184, 148, 94, 255, 1},
-        {174, 141, 87, 255, 1},
-        {169, 138, 83, 255, 1},
-        {170, 138, 84, 255, 5},
-        {171, 139, 84, 255, 1},
-        {162, 134, 79, 255, 1},
-        {158, 131, 76, 255, 1},
-        {159, 132, 77, 255, 1},
-        {170, 142, 83, 255, 1},
-        {191, 153, 99, 164, 1},
-        {205, 165, 107, 255, 1},
-        {190, 154, 100, 255, 1},
-        {191, 155, 101, 255, 1},
-        {185, 148, 94, 255, 1},
-        {181, 144, 90, 255, 1},
-        {182, 145, 91, 255, 9},
-        {181, 144, 90, 255, 1},
-        {187, 150, 97, 255, 1},
-        {191, 155, 101, 255, 1},
-        {190, 154, 100, 255, 1},
-        {191, 154, 100, 255, 1},
-        {189, 153, 99, 255, 1},
-        {188, 152, 98, 255, 2},
-        {189, 153, 99, 255, 1},
-        {166, 136, 82, 255, 1},
-        {155, 130, 75, 255, 1},
-        {157, 131, 76, 255, 6},
-        {159, 132, 77, 255, 7},
-        {157, 131, 76, 255, 1},
-        {171, 138, 85, 255, 1},
-        {184, 146, 92, 255, 1},
-        {182, 145, 91, 255, 2},
-        {184, 147, 92, 255, 1},
-        {186, 149, 93, 255, 1},
-        {186, 148, 93, 255, 1},
-        {186, 149, 93, 255, 1},
-        {182, 145, 91, 255, 1},
-        {179, 143, 89, 255, 3},
-        {181, 145, 91, 255, 1},
-        {182, 145, 91, 255, 6},
-        {183, 145, 91, 255, 1},
-        {164, 135, 80, 255, 1},
-        {158, 131, 76, 255, 1},
-        {159, 132, 77, 255, 1},
-        {170, 142, 83, 255, 1},
-        {188, 152, 97, 164, 1},
-        {202, 163, 105, 255, 1},
-        {188, 152, 98, 255, 1},
-        {189, 153, 99, 255, 1},
-        {183, 147, 93, 255, 1},
-        {179, 143, 89, 255, 1},
-        {180, 144, 90, 255, 9},
-        {179, 143, 89, 255, 1},
-        {185, 149, 95, 255, 1},
-        {189, 153, 99, 255, 1},
-        {188, 152, 98, 255, 5},
-        {189, 153, 99, 255, 1},
-        {167, 137, 83, 255, 1},
-        {157, 131, 76, 255, 1},
-        {159, 132, 77, 255, 13},
-        {157, 131, 76, 255, 1},
-        {170, 138, 84, 255, 1},
-        {182, 145, 91, 255, 1},
-        {180, 144, 90, 255, 17},
-        {181, 144, 90, 255, 1},
-        {164, 135, 80, 255, 1},
-        {158, 131, 76, 255, 1},
-        {159, 132, 77, 255, 1},
-        {170, 142, 83, 255, 1},
-        {191, 155, 99, 164, 1},
-        {206, 166, 107, 255, 1},
-        {192, 155, 100, 255, 1},
-        {193, 156, 101, 255, 1},
-        {187, 150, 95, 255, 1},
-        {183, 146, 91, 255, 1},
-        {184, 147, 92, 255, 9},
-        {183, 146, 91, 255, 1},
-        {190, 153, 98, 255, 1},
-        {193, 157, 101, 255, 1},
-        {193, 156, 101, 255, 5},
-        {194, 157, 102, 255, 1},
-        {171, 140, 85, 255, 1},
-        {160, 134, 78, 255, 1},
-        {162, 135, 79, 255, 2},
-        {162, 134, 78, 255, 1},
-        {161, 134, 78, 255, 10},
-        {159, 133, 77, 255, 1},
-        {173, 141, 86, 255, 1},
-        {186, 148, 93, 255, 1},
-        {184, 147, 92, 255, 17},
-        {185, 148, 93, 255, 1},
-        {167, 138, 82, 255, 1},
-        {160, 133, 77, 255, 1},
-        {161, 134, 78, 255, 1},
-        {173, 144, 84, 255, 1},
-        {136, 111, 69, 164, 1},
-        {148, 121, 75, 255, 1},
-        {138, 112, 70, 255, 1},
-        {138, 113, 70, 255, 1},
-        {132, 106, 66, 255, 1},
-        {129, 103, 64, 255, 1},
-        {130, 104, 65, 255, 1},
-        {129, 103, 65, 255, 1},
-        {134, 108, 67, 255, 1},
-        {137, 111, 68, 255, 1},
-        {136, 111, 68, 255, 5},
-        {137, 111, 68, 255, 1},
-        {133, 108, 67, 255, 1},
-        {131, 106, 67, 255, 1},
-        {132, 106, 67, 255, 5},
-        {133, 107, 67, 255, 1},
-        {125, 101, 61, 255, 1},
-        {122, 99, 59, 255, 1},
-        {122, 100, 59, 255, 1},
-        {122, 99, 59, 255, 1},
-        {127, 104, 62, 255, 1},
-        {129, 107, 63, 255, 1},
-        {129, 106, 63, 255, 9},
-        {128, 106, 63, 255, 1},
-        {133, 109, 66, 255, 1},
-        {137, 111, 69, 255, 1},
-        {136, 111, 68, 255, 5},
-        {137, 111, 68, 255, 1},
-        {132, 107, 66, 255, 1},
-        {129, 103, 65, 255, 1},
-        {130, 104, 65, 255, 10},
-        {129, 106, 63, 255, 1},
-        {129, 107, 63, 255, 1},
-        {129, 106, 63, 255, 1},
-        {138, 114, 68, 255, 1},
-        {110, 88, 54, 164, 1},
-        {119, 97, 58, 255, 1},
-        {110, 90, 54, 255, 2},
-        {102, 82, 49, 255, 1},
-        {100, 80, 48, 255, 2},
-        {99, 79, 48, 255, 1},
-        {107, 87, 52, 255, 1},
-        {112, 92, 55, 255, 1},
-        {110, 90, 55, 255, 5},
-        {112, 92, 55, 255, 1},
-        {103, 83, 50, 255, 1},
-        {98, 78, 48, 255, 1},
-        {99, 79, 48, 255, 6},
-        {101, 80, 49, 255, 1},
-        {101, 81, 49, 255, 2},
-        {100, 80, 49, 255, 1},
-        {108, 87, 52, 255, 1},
-        {113, 92, 56, 255, 1},
-        {112, 91, 56, 255, 10},
-        {111, 91, 55, 255, 1},
-        {110, 90, 55, 255, 6},
-        {112, 92, 55, 255, 1},
-        {104, 84, 51, 255, 1},
-        {99, 79, 48, 255, 1},
-        {100, 80, 48, 255, 10},
-        {108, 88, 53, 255, 1},
-        {113, 92, 56, 255, 1},
-        {112, 91, 56, 255, 1},
-        {120, 98, 59, 255, 1},
-        {115, 93, 57, 164, 1},
-        {124, 101, 61, 255, 1},
-        {115, 94, 57, 255, 2},
-        {107, 86, 52, 255, 1},
-        {105, 84, 51, 255, 2},
-        {104, 83, 51, 255, 1},
-        {112, 91, 55, 255, 1},
-        {116, 95, 57, 255, 1},
-        {115, 94, 57, 255, 5},
-        {116, 95, 57, 255, 1},
-        {108, 87, 53, 255, 1},
-        {104, 83, 51, 255, 1},
-        {105, 84, 51, 255, 9},
-        {104, 83, 51, 255, 1},
-        {111, 90, 54, 255, 1},
-        {116, 95, 57, 255, 1},
-        {115, 94, 57, 255, 17},
-        {116, 95, 57, 255, 1},
-        {109, 88, 54, 255, 1},
-        {104, 83, 51, 255, 1},
-        {105, 84, 51, 255, 10},
-        {112, 91, 55, 255, 1},
-        {116, 95, 57, 255, 1},
-        {115, 94, 57, 255, 1},
-        {123, 101, 61, 255, 1},
-        {108, 88, 54, 164, 1},
-        {117, 96, 57, 255, 1},
-        {109, 89, 54, 255, 2},
-        {100, 80, 48, 255, 1},
-        {98, 78, 47, 255, 2},
-        {97, 77, 47, 255, 1},
-        {106, 86, 51, 255, 1},
-        {110, 90, 54, 255, 1},
-        {109, 89, 54, 255, 5},
-        {110, 90, 54, 255, 1},
-        {101, 82, 49, 255, 1},
-        {97, 77, 47, 255, 1},
-        {98, 78, 47, 255, 2},
-        {100, 79, 48, 255, 1},
-        {101, 80, 49, 255, 3},
-        {99, 79, 48, 255, 1},
-        {98, 78, 47, 255, 2},
-        {97, 77, 47, 255, 1},
-        {106, 86, 51, 255, 1},
-        {113, 92, 56, 255, 1},
-        {111, 91, 55, 255, 6},
-        {114, 93, 57, 255, 1},
-        {115, 94, 57, 255, 3},
-        {113, 92, 56, 255, 1},
-        {111, 91, 55, 255, 6},
-        {113, 92, 56, 255, 1},
-        {104, 84, 51, 255, 1},
-        {98, 78, 48, 255, 1},
-        {99, 79, 48, 255, 2},
-        {98, 79, 47, 255, 1},
-        {98, 78, 47, 255, 7},
-        {106, 86, 51, 255, 1},
-        {110, 90, 54, 255, 1},
-        {109, 89, 54, 255, 1},
-        {116, 96, 57, 255, 1},
-        {157, 127, 80, 164, 1},
-        {169, 137, 87, 255, 1},
-        {158, 128, 81, 255, 2},
-        {154, 125, 79, 255, 1},
-        {154, 124, 79, 255, 2},
-        {153, 123, 79, 255, 1},
-        {156, 127, 80, 255, 1},
-        {158, 128, 81, 255, 7},
-        {155, 125, 79, 255, 1},
-        {153, 123, 79, 255, 1},
-        {154, 124, 79, 255, 1},
-        {155, 124, 79, 255, 1},
-        {144, 117, 71, 255, 1},
-        {136, 111, 65, 255, 1},
-        {137, 112, 66, 255, 1},
-        {136, 112, 66, 255, 1},
-        {149, 121, 75, 255, 1},
-        {155, 124, 79, 255, 1},
-        {154, 124, 79, 255, 2},
-        {145, 119, 72, 255, 1},
-        {140, 116, 68, 255, 1},
-        {141, 116, 69, 255, 5},
-        {143, 118, 69, 255, 1},
-        {124, 102, 61, 255, 1},
-        {113, 92, 56, 255, 1},
-        {115, 94, 57, 255, 1},
-        {113, 92, 56, 255, 1},
-        {129, 106, 63, 255, 1},
-        {143, 118, 70, 255, 1},
-        {141, 116, 69, 255, 5},
-        {140, 116, 68, 255, 1},
-        {145, 118, 72, 255, 1},
-        {150, 120, 74, 255, 1},
-        {149, 120, 74, 255, 1},
-        {149, 119, 74, 255, 1},
-        {152, 122, 77, 255, 1},
-        {154, 124, 79, 255, 7},
-        {157, 127, 80, 255, 1},
-        {158, 128, 81, 255, 2},
-        {169, 137, 87, 255, 1},
-        {194, 157, 101, 164, 1},
-        {209, 168, 109, 255, 1},
-        {194, 157, 101, 255, 2},
-        {195, 157, 102, 255, 1},
-        {195, 158, 102, 255, 3},
-        {194, 157, 102, 255, 1},
-        {194, 157, 101, 255, 7},
-        {195, 157, 102, 255, 1},
-        {195, 158, 102, 255, 2},
-        {197, 159, 103, 255, 1},
-        {176, 145, 89, 255, 1},
-        {161, 134, 77, 255, 1},
-        {163, 136, 79, 255, 1},
-        {161, 135, 78, 255, 1},
-        {186, 152, 95, 255, 1},
-        {197, 159, 103, 255, 1},
-        {195, 158, 102, 255, 1},
-        {197, 159, 103, 255, 1},
-        {175, 143, 88, 255, 1},
-        {160, 134, 76, 255, 1},
-        {163, 135, 79, 255, 5},
-        {166, 137, 80, 255, 1},
-        {131, 108, 64, 255, 1},
-        {112, 91, 56, 255, 1},
-        {115, 94, 57, 255, 1},
-        {111, 91, 55, 255, 1},
-        {141, 117, 69, 255, 1},
-        {167, 138, 81, 255, 1},
-        {163, 135, 79, 255, 5},
-        {160, 134, 78, 255, 1},
-        {176, 143, 87, 255, 1},
-        {188, 150, 94, 255, 1},
-        {186, 149, 93, 255, 1},
-        {185, 148, 92, 255, 1},
-        {192, 154, 99, 255, 1},
-        {196, 159, 103, 255, 1},
-        {195, 158, 102, 255, 6},
-        {194, 157, 102, 255, 1},
-        {194, 157, 101, 255, 2},
-        {209, 168, 109, 255, 1},
-        {188, 152, 97, 164, 1},
-        {202, 163, 105, 255, 1},
-        {188, 152, 98, 255, 17},
-        {190, 153, 99, 255, 1},
-        {171, 140, 86, 255, 1},
-        {157, 130, 75, 255, 1},
-        {159, 132, 77, 255, 1},
-        {157, 131, 76, 255, 1},
-        {180, 147, 92, 255, 1},
-        {190, 153, 99, 255, 1},
-        {188, 152, 98, 255, 1},
-        {190, 153, 99, 255, 1},
-        {170, 139, 85, 255, 1},
-        {157, 131, 75, 255, 1},
-        {159, 132, 77, 255, 5},
-        {162, 134, 78, 255, 1},
-        {130, 107, 63, 255, 1},
-        {112, 91, 56, 255, 1},
-        {115, 94, 57, 255, 1},
-        {111, 91, 55, 255, 1},
-        {139, 115, 68, 255, 1},
-        {163, 135, 79, 255, 1},
-        {159, 132, 77, 255, 5},
-        {157, 131, 76, 255, 1},
-        {171, 139, 84, 255, 1},
-        {182, 145, 91, 255, 1},
-        {180, 144, 90, 255, 1},
-        {179, 143, 89, 255, 1},
-        {185, 149, 95, 255, 1},
-        {189, 153, 99, 255, 1},
-        {188, 152, 98, 255, 9},
-        {202, 163, 105, 255, 1},
-        {188, 152, 97, 164, 1},
-        {203, 164, 106, 255, 1},
-        {189, 153, 99, 255, 6},
-        {191, 154, 100, 255, 1},
-        {192, 155, 100, 255, 3},
-        {189, 153, 98, 255, 1},
-        {188, 152, 98, 255, 6},
-        {190, 153, 99, 255, 1},
-        {170, 139, 85, 255, 1},
-        {156, 129, 74, 255, 1},
-        {158, 131, 76, 255, 1},
-        {156, 130, 75, 255, 1},
-        {180, 147, 92, 255, 1},
-        {190, 153, 99, 255, 1},
-        {188, 152, 98, 255, 1},
-        {190, 153, 99, 255, 1},
-        {170, 139, 85, 255, 1},
-        {157, 131, 75, 255, 1},
-        {159, 132, 77, 255, 2},
-        {158, 131, 76, 255, 3},
-        {161, 133, 77, 255, 1},
-        {127, 105, 62, 255, 1},
-        {109, 88, 54, 255, 1},
-        {112, 92, 55, 255, 1},
-        {107, 88, 53, 255, 1},
-        {137, 114, 67, 255, 1},
-        {162, 135, 79, 255, 1},
-        {158, 132, 76, 255, 1},
-        {158, 131, 76, 255, 1},
-        {159, 132, 77, 255, 3},
-        {157, 131, 76, 255, 1},
-        {171, 139, 84, 255, 1},
-        {183, 146, 92, 255, 1},
-        {181, 144, 91, 255, 1},
-        {180, 144, 90, 255, 1},
-        {186, 150, 96, 255, 1},
-        {190, 154, 100, 255, 1},
-        {189, 153, 99, 255, 9},
-        {203, 164, 106, 255, 1},
-        {183, 147, 93, 164, 1},
-        {197, 158, 100, 255, 1},
-        {183, 147, 93, 255, 2},
-        {170, 139, 85, 255, 1},
-        {166, 137, 82, 255, 1},
-        {167, 137, 83, 255, 1},
-        {169, 139, 84, 255, 1},
-        {147, 120, 73, 255, 1},
-        {135, 109, 68, 255, 1},
-        {136, 111, 69, 255, 1},
-        {136, 110, 68, 255, 1},
-        {177, 144, 92, 255, 1},
-        {191, 154, 99, 255, 1},
-        {188, 152, 98, 255, 5},
-        {189, 152, 99, 255, 1},
-        {183, 148, 94, 255, 1},
-        {179, 146, 91, 255, 1},
-        {180, 146, 92, 255, 1},
-        {179, 146, 92, 255, 1},
-        {186, 150, 96, 255, 1},
-        {189, 152, 98, 255, 1},
-        {188, 152, 98, 255, 1},
-        {190, 153, 99, 255, 1},
-        {170, 139, 85, 255, 1},
-        {157, 131, 75, 255, 1},
-        {159, 132, 77, 255, 1},
-        {158, 131, 76, 255, 1},
-        {175, 143, 88, 255, 1},
-        {181, 147, 93, 255, 1},
-        {180, 146, 92, 255, 1},
-        {181, 147, 92, 255, 1},
-        {167, 135, 84, 255, 1},
-        {159, 128, 80, 255, 1},
-        {160, 129, 80, 255, 1},
-        {159, 128, 80, 255, 1},
-        {168, 135, 84, 255, 1},
-        {175, 142, 87, 255, 1},
-        {174, 141, 86, 255, 1},
-        {174, 141, 87, 255, 1},
-        {163, 135, 80, 255, 1},
-        {158, 131, 76, 255, 1},
-        {159, 132, 77, 255, 1},
-        {158, 132, 77, 255, 1},
-        {162, 134, 79, 255, 1},
-        {165, 135, 80, 255, 3},
-        {167, 137, 82, 255, 1},
-        {167, 137, 83, 255, 6},
-        {166, 137, 83, 255, 1},
-        {179, 145, 90, 255, 1},
-        {184, 148, 94, 255, 1},
-        {183, 147, 93, 255, 1},
-        {197, 158, 100, 255, 1},
-        {180, 144, 90, 164, 1},
-        {192, 154, 96, 255, 1},
-        {179, 143, 89, 255, 2},
-        {161, 133, 79, 255, 1},
-        {156, 130, 75, 255, 1},
-        {157, 131, 76, 255, 1},
-        {160, 134, 77, 255, 1},
-        {125, 103, 61, 255, 1},
-        {107, 87, 53, 255, 1},
-        {109, 89, 54, 255, 1},
-        {108, 89, 53, 255, 1},
-        {172, 139, 90, 255, 1},
-        {192, 155, 100, 255, 1},
-        {188, 152, 98, 255, 6},
-        {189, 153, 99, 255, 1},
-        {190, 153, 99, 255, 3},
-        {188, 152, 98, 255, 3},
-        {190, 153, 99, 255, 1},
-        {170, 139, 85, 255, 1},
-        {157, 131, 75, 255, 1},
-        {159, 132, 77, 255, 1},
-        {158, 131, 76, 255, 1},
-        {182, 148, 94, 255, 1},
-        {192, 154, 100, 255, 1},
-        {190, 153, 99, 255, 1},
-        {191, 153, 99, 255, 1},
-        {186, 150, 94, 255, 1},
-        {183, 146, 92, 255, 1},
-        {184, 147, 92, 255, 2},
-        {183, 146, 91, 255, 1},
-        {181, 145, 91, 255, 2},
-        {182, 146, 92, 255, 1},
-        {165, 136, 81, 255, 1},
-        {158, 131, 76, 255, 1},
-        {159, 132, 77, 255, 2},
-        {158, 132, 77, 255, 1},
-        {158, 131, 76, 255, 3},
-        {157, 131, 76, 255, 7},
-        {156, 131, 76, 255, 1},
-        {174, 140, 86, 255, 1},
-        {180, 144, 90, 255, 1},
-        {179, 143, 89, 255, 1},
-        {192, 153, 95, 255, 1},
-        {180, 144, 90, 164, 1},
-        {193, 155, 97, 255, 1},
-        {180, 144, 90, 255, 2},
-        {163, 134, 80, 255, 1},
-        {158, 131, 76, 255, 1},
-        {159, 132, 77, 255, 1},
-        {162, 135, 78, 255, 1},
-        {129, 106, 63, 255, 1},
-        {112, 91, 56, 255, 1},
-        {114, 93, 57, 255, 1},
-        {113, 93, 56, 255, 1},
-        {173, 140, 90, 255, 1},
-        {192, 155, 100, 255, 1},
-        {188, 152, 98, 255, 13},
-        {190, 153, 99, 255, 1},
-        {170, 139, 85, 255, 1},
-        {157, 131, 75, 255, 1},
-        {159, 132, 77, 255, 1},
-        {158, 131, 76, 255, 1},
-        {181, 147, 93, 255, 1},
-        {190, 153, 99, 255, 1},
-        {188, 152, 98, 255, 1},
-        {189, 152, 98, 255, 1},
-        {183, 147, 92, 255, 1},
-        {179, 143, 90, 255, 1},
-        {180, 144, 90, 255, 5},
-        {181, 145, 91, 255, 1},
-        {165, 136, 81, 255, 1},
-        {158, 131, 76, 255, 1},
-        {159, 132, 77, 255, 13},
-        {158, 132, 77, 255, 1},
-        {175, 141, 87, 255, 1},
-        {181, 145, 91, 255, 1},
-        {180, 144, 90, 255, 1},
-        {193, 154, 96, 255, 1},
-        {180, 144, 90, 164, 1},
-        {192, 154, 96, 255, 1},
-        {179, 143, 89, 255, 2},
-        {161, 133, 79, 255, 1},
-        {156, 129, 74, 255, 1},
-        {157, 130, 75, 255, 1},
-        {160, 134, 76, 255, 1},
-        {126, 103, 61, 255, 1},
-        {108, 88, 54, 255, 1},
-        {110, 90, 55, 255, 1},
-        {109, 90, 54, 255, 1},
-        {174, 141, 91, 255, 1},
-        {195, 157, 102, 255, 1},
-        {190, 154, 100, 255, 6},
-        {189, 153, 99, 255, 1},
-        {188, 152, 98, 255, 6},
-        {190, 153, 99, 255, 1},
-        {170, 139, 85, 255, 1},
-        {157, 131, 75, 255, 1},
-        {159, 132, 77, 255, 1},
-        {158, 131, 76, 255, 1},
-        {181, 147, 93, 255, 1},
-        {190, 153, 99, 255, 1},
-        {188, 152, 98, 255, 1},
-        {189, 152, 98, 255, 1},
-        {183, 147, 92, 255, 1},
-        {178, 142, 89, 255, 1},
-        {179, 143, 89, 255, 2},
-        {181, 144, 90, 255, 1},
-        {182, 145, 91, 255, 2},
-        {183, 146, 92, 255, 1},
-        {164, 136, 81, 255, 1},
-        {156, 130, 75, 255, 1},
-        {157, 131, 76, 255, 3},
-        {157, 130, 75, 255, 10},
-        {156, 130, 75, 255, 1},
-        {174, 140, 86, 255, 1},
-        {180, 144, 90, 255, 1},
-        {179, 143, 89, 255, 1},
-        {192, 153, 95, 255, 1},
-        {185, 149, 94, 164, 1},
-        {198, 160, 102, 255, 1},
-        {185, 149, 95, 255, 2},
-        {178, 145, 91, 255, 1},
-        {176, 143, 89, 255, 1},
-        {176, 144, 89, 255, 1},
-        {179, 146, 91, 255, 1},
-        {153, 126, 76, 255, 1},
-        {139, 115, 67, 255, 1},
-        {141, 117, 69, 255, 2},
-        {165, 135, 82, 255, 1},
-        {172, 141, 86, 255, 1},
-        {170, 140, 85, 255, 5},
-        {169, 139, 84, 255, 1},
-        {181, 147, 93, 255, 1},
-        {189, 153, 99, 255, 1},
-        {188, 152, 98, 255, 5},
-        {190, 153, 99, 255, 1},
-        {170, 139, 85, 255, 1},
-        {157, 131, 75, 255, 1},
-        {159, 132, 77, 255, 1},
-        {158, 131, 76, 255, 1},
-        {181, 147, 93, 255, 1},
-        {190, 153, 99, 255, 1},
-        {188, 152, 98, 255, 2},
-        {186, 150, 96, 255, 1},
-        {184, 148, 95, 255, 1},
-        {185, 149, 95, 255, 1},
-        {186, 150, 96, 255, 1},
-        {175, 142, 88, 255, 1},
-        {166, 135, 81, 255, 1},
-        {167, 136, 82, 255, 2},
-        {170, 138, 84, 255, 1},
-        {172, 139, 85, 255, 1},
-        {171, 139, 85, 255, 1},
-        {171, 138, 84, 255, 1},
-        {175, 142, 88, 255, 1},
-        {177, 144, 90, 255, 1},
-        {176, 144, 89, 255, 10},
-        {183, 148, 93, 255, 1},
-        {185, 149, 95, 255, 2},
-        {198, 159, 101, 255, 1},
-        {188, 152, 97, 164, 1},
-        {203, 164, 106, 255, 1},
-        {189, 153, 99, 255, 2},
-        {190, 153, 99, 255, 1},
-        {190, 154, 100, 255, 2},
-        {192, 154, 101, 255, 1},
-        {171, 141, 86, 255, 1},
-        {161, 134, 78, 255, 1},
-        {163, 135, 79, 255, 2},
-        {158, 131, 76, 255, 1},
-        {156, 130, 75, 255, 1},
-        {157, 130, 75, 255, 5},
-        {155, 129, 73, 255, 1},
-        {175, 143, 88, 255, 1},
-        {190, 154, 100, 255, 1},
-        {188, 152, 98, 255, 5},
-        {190, 153, 99, 255, 1},
-        {170, 139, 85, 255, 1},
-        {157, 131, 75, 255, 1},
-        {159, 132, 77, 255, 1},
-        {158, 131, 76, 255, 1},
-        {181, 147, 93, 255, 1},
-        {190, 153, 99, 255, 1},
-        {188, 152, 98, 255, 3},
-        {189, 153, 99, 255, 2},
-        {191, 155, 101, 255, 1},
-        {171, 141, 86, 255, 1},
-        {155, 129, 74, 255, 1},
-        {157, 131, 76, 255, 1},
-        {156, 130, 75, 255, 1},
-        {174, 140, 86, 255, 1},
-        {183, 146, 92, 255, 1},
-        {182, 145, 91, 255, 1},
-        {181, 144, 90, 255, 1},
-        {187, 150, 96, 255, 1},
-        {191, 155, 101, 255, 1},
-        {190, 154, 100, 255, 10},
-        {189, 153, 99, 255, 3},
-        {203, 164, 106, 255, 1},
-        {188, 152, 97, 164, 1},
-        {202, 163, 105, 255, 1},
-        {188, 152, 98, 255, 5},
-        {190, 153, 99, 255, 1},
-        {168, 138, 84, 255, 1},
-        {157, 131, 76, 255, 1},
-        {159, 132, 77, 255, 9},
-        {157, 131, 75, 255, 1},
-        {176, 144, 89, 255, 1},
-        {190, 154, 100, 255, 1},
-        {188, 152, 98, 255, 5},
-        {190, 153, 99, 255, 1},
-        {170, 139, 85, 255, 1},
-        {157, 131, 75, 255, 1},
-        {159, 132, 77, 255, 1},
-        {158, 131, 76, 255, 1},
-        {181, 147, 93, 255, 1},
-        {190, 153, 99, 255, 1},
-        {188, 152, 98, 255, 5},
-        {190, 154, 100, 255, 1},
-        {172, 141, 86, 255, 1},
-        {157, 130, 75, 255, 1},
-        {159, 132, 77, 255, 1},
-        {158, 131, 76, 255, 1},
-        {173, 140, 86, 255, 1},
-        {181, 145, 91, 255, 1},
-        {180, 144, 90, 255, 1},
-        {179, 143, 89, 255, 1},
-        {185, 149, 95, 255, 1},
-        {189, 153, 99, 255, 1},
-        {188, 152, 98, 255, 13},
-        {202, 163, 105, 255, 1},
-        {194, 157, 101, 164, 1},
-        {208, 168, 109, 255, 1},
-        {194, 157, 101, 255, 5},
-        {196, 158, 103, 255, 1},
-        {172, 142, 86, 255, 1},
-        {160, 134, 77, 255, 1},
-        {163, 135, 79, 255, 2},
-        {162, 135, 78, 255, 3},
-        {162, 134, 78, 255, 1},
-        {163, 135, 79, 255, 1},
-        {164, 136, 79, 255, 1},
-        {163, 136, 79, 255, 1},
-        {161, 135, 77, 255, 1},
-        {182, 149, 92, 255, 1},
-        {197, 160, 104, 255, 1},
-        {195, 158, 102, 255, 2},
-        {194, 157, 101, 255, 1},
-        {193, 156, 101, 255, 2},
-        {195, 157, 102, 255, 1},
-        {175, 143, 87, 255, 1},
-        {161, 135, 77, 255, 1},
-        {163, 136, 79, 255, 1},
-        {162, 135, 78, 255, 1},
-        {186, 151, 96, 255, 1},
-        {196, 158, 102, 255, 1},
-        {194, 157, 101, 255, 5},
-        {196, 159, 104, 255, 1},
-        {176, 145, 88, 255, 1},
-        {160, 133, 76, 255, 1},
-        {163, 135, 79, 255, 1},
-        {161, 134, 78, 255, 1},
-        {178, 144, 88, 255, 1},
-        {187, 150, 94, 255, 1},
-        {186, 149, 93, 255, 1},
-        {185, 147, 92, 255, 1},
-        {193, 155, 99, 255, 1},
-        {198, 161, 104, 255, 1},
-        {197, 159, 103, 255, 2},
-        {195, 158, 102, 255, 1},
-        {195, 157, 102, 255, 1},
-        {195, 158, 102, 255, 6},
-        {194, 157, 102, 255, 1},
-        {194, 157, 101, 255, 2},
-        {208, 168, 109, 255, 1},
-        {150, 122, 77, 164, 1},
-        {163, 133, 84, 255, 1},
-        {152, 123, 78, 255, 5},
-        {153, 124, 78, 255, 1},
-        {142, 117, 71, 255, 1},
-        {137, 113, 66, 255, 1},
-        {138, 114, 67, 255, 1},
-        {138, 113, 67, 255, 1},
-        {140, 115, 69, 255, 1},
-        {142, 115, 70, 255, 1},
-        {141, 115, 70, 255, 1},
-        {142, 115, 71, 255, 1},
-        {134, 109, 65, 255, 1},
-        {131, 107, 63, 255, 2},
-        {130, 107, 62, 255, 1},
-        {140, 114, 70, 255, 1},
-        {147, 119, 76, 255, 1},
-        {146, 118, 75, 255, 1},
-        {146, 118, 74, 255, 1},
-        {154, 124, 79, 255, 1},
-        {157, 126, 81, 255, 2},
-        {158, 127, 82, 255, 1},
-        {141, 114, 70, 255, 1},
-        {130, 106, 62, 255, 1},
-        {131, 107, 63, 255, 2},
-        {146, 119, 74, 255, 1},
-        {153, 124, 78, 255, 1},
-        {152, 123, 78, 255, 5},
-        {153, 124, 79, 255, 1},
-        {144, 118, 72, 255, 1},
-        {137, 113, 66, 255, 1},
-        {138, 114, 67, 255, 2},
-        {141, 114, 70, 255, 1},
-        {142, 114, 71, 255, 2},
-        {143, 115, 71, 255, 1},
-        {137, 110, 70, 255, 1},
-        {132, 106, 68, 255, 1},
-        {132, 107, 68, 255, 1},
-        {132, 106, 68, 255, 1},
-        {142, 115, 72, 255, 1},
-        {147, 119, 75, 255, 1},
-        {146, 118, 75, 255, 6},
-        {150, 122, 77, 255, 1},
-        {152, 124, 78, 255, 1},
-        {152, 123, 78, 255, 1},
-        {162, 132, 83, 255, 1},
-        {108, 88, 54, 164, 1},
-        {118, 96, 57, 255, 1},
-        {109, 89, 54, 255, 6},
-        {111, 91, 55, 255, 1},
-        {112, 91, 56, 255, 1},
-        {112, 91, 55, 255, 1},
-        {111, 91, 55, 255, 1},
-        {118, 94, 59, 255, 1},
-        {122, 95, 61, 255, 1},
-        {121, 95, 61, 255, 1},
-        {122, 97, 62, 255, 1},
-        {107, 84, 52, 255, 1},
-        {99, 79, 48, 255, 1},
-        {100, 80, 49, 255, 1},
-        {101, 80, 49, 255, 1},
-        {99, 79, 48, 255, 1},
-        {98, 78, 47, 255, 1},
-        {98, 79, 47, 255, 1},
-        {97, 77, 46, 255, 1},
-        {114, 90, 56, 255, 1},
-        {120, 95, 60, 255, 1},
-        {119, 94, 59, 255, 1},
-        {120, 95, 60, 255, 1},
-        {107, 86, 52, 255, 1},
-        {99, 79, 48, 255, 1},
-        {100, 80, 49, 255, 1},
-        {101, 80, 49, 255, 1},
-        {107, 88, 53, 255, 1},
-        {110, 90, 54, 255, 1},
-        {109, 89, 54, 255, 6},
-        {111, 90, 55, 255, 1},
-        {112, 91, 56, 255, 1},
-        {112, 91, 55, 255, 1},
-        {113, 92, 56, 255, 1},
-        {104, 84, 50, 255, 1},
-        {98, 78, 48, 255, 1},
-        {99, 79, 48, 255, 1},
-        {101, 81, 49, 255, 1},
-        {80, 65, 40, 255, 1},
-        {65, 52, 32, 255, 1},
-        {67, 54, 33, 255, 1},
-        {66, 53, 32, 255, 1},
-        {89, 71, 43, 255, 1},
-        {100, 80, 48, 255, 1},
-        {98, 79, 47, 255, 5},
-        {98, 78, 47, 255, 1},
-        {106, 86, 52, 255, 1},
-        {110, 90, 54, 255, 1},
-        {109, 89, 54, 255, 1},
-        {117, 96, 57, 255, 1},
-        {115, 93, 57, 164, 1},
-        {124, 101, 61, 255, 1},
-        {115, 94, 57, 255, 9},
-        {114, 94, 57, 255, 1},
-        {121, 97, 60, 255, 1},
-        {125, 98, 62, 255, 1},
-        {124, 98, 62, 255, 1},
-        {125, 99, 63, 255, 1},
-        {111, 88, 54, 255, 1},
-        {104, 83, 50, 255, 1},
-        {105, 84, 51, 255, 5},
-        {104, 83, 50, 255, 1},
-        {119, 94, 59, 255, 1},
-        {125, 99, 63, 255, 1},
-        {124, 98, 62, 255, 1},
-        {125, 99, 63, 255, 1},
-        {112, 90, 55, 255, 1},
-        {104, 83, 50, 255, 1},
-        {105, 84, 51, 255, 2},
-        {113, 92, 56, 255, 1},
-        {116, 95, 57, 255, 1},
-        {115, 94, 57, 255, 9},
-        {116, 95, 57, 255, 1},
-        {109, 88, 53, 255, 1},
-        {104, 83, 51, 255, 1},
-        {105, 84, 51, 255, 1},
-        {107, 86, 52, 255, 1},
-        {88, 71, 44, 255, 1},
-        {74, 59, 37, 255, 1},
-        {76, 61, 38, 255, 1},
-        {75, 60, 37, 255, 1},
-        {96, 77, 47, 255, 1},
-        {107, 85, 52, 255, 1},
-        {105, 84, 51, 255, 6},
-        {112, 91, 55, 255, 1},
-        {116, 95, 57, 255, 1},
-        {115, 94, 57, 255, 1},
-        {123, 101, 61, 255, 1},
-        {114, 92, 57, 176, 1},
-        {133, 108, 65, 255, 1},
-        {123, 101, 61, 255, 9},
-        {122, 101, 61, 255, 1},
-        {130, 104, 64, 255, 1},
-        {134, 105, 66, 255, 1},
-        {133, 105, 66, 255, 1},
-        {134, 106, 68, 255, 1},
-        {119, 94, 58, 255, 1},
-        {111, 89, 54, 255, 1},
-        {113, 90, 55, 255, 5},
-        {111, 89, 54, 255, 1},
-        {128, 101, 63, 255, 1},
-        {134, 106, 68, 255, 1},
-        {133, 105, 66, 255, 1},
-        {134, 106, 68, 255, 1},
-        {120, 96, 59, 255, 1},
-        {111, 89, 54, 255, 1},
-        {113, 90, 55, 255, 2},
-        {121, 99, 60, 255, 1},
-        {124, 102, 61, 255, 1},
-        {123, 101, 61, 255, 9},
-        {124, 102, 61, 255, 1},
-        {117, 94, 57, 255, 1},
-        {111, 89, 55, 255, 1},
-        {113, 90, 55, 255, 1},
-        {115, 92, 56, 255, 1},
-        {94, 76, 47, 255, 1},
-        {79, 63, 40, 255, 1},
-        {81, 65, 41, 255, 1},
-        {80, 64, 40, 255, 1},
-        {103, 83, 50, 255, 1},
-        {115, 91, 56, 255, 1},
-        {113, 90, 55, 255, 6},
-        {120, 98, 59, 255, 1},
-        {124, 102, 61, 255, 1},
-        {123, 101, 61, 255, 1},
-        {132, 108, 65, 255, 1},
-    };
-
-    static BYTE textureData[64 * 64 * 4];
-
-    BYTE* ptr = textureData;
-    for (const auto& seg : segments) {
-        for (int i = 0; i < seg.count; ++i) {
-            *ptr++ = seg.r;
-            *ptr++ = seg.g;
-            *ptr++ = seg.b;
-            *ptr++ = seg.a;
-        }
-    }
-
-    bool result = CreateTextureFromData(textureData, size, size, &cachedSRV);
-    *outSRV = cachedSRV;
-    return result;
-}
\ No newline at end of file
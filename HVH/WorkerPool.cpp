@@ -0,0 +1,78 @@
+#include "WorkerPool.h"
+#include <algorithm>
+
+WorkerPool::~WorkerPool()
+{
+    StopWorkers();
+}
+
+void WorkerPool::SetThreadCount(int count)
+{
+    count = (std::max)(1, count);
+    if (count == threadCount) return;
+    StopWorkers();
+    threadCount = count;
+}
+
+void WorkerPool::Run(const std::function<void(int index, int count)>& work)
+{
+    if (threadCount == 1) {
+        work(0, 1);
+        return;
+    }
+
+    if (workers.empty()) StartWorkers();
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        job = &work;
+        pending = (int)workers.size();
+        ++generation;
+    }
+    start.notify_all();
+
+    work(0, threadCount);
+
+    std::unique_lock<std::mutex> lock(mutex);
+    done.wait(lock, [this] { return pending == 0; });
+    job = nullptr;
+}
+
+void WorkerPool::StartWorkers()
+{
+    // each worker remembers the last job it ran, starting from now, so a job
+    // begun before the thread gets going isn't missed
+    for (int i = 1; i < threadCount; ++i) {
+        workers.emplace_back(&WorkerPool::WorkerLoop, this, i, generation);
+    }
+}
+
+void WorkerPool::StopWorkers()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    start.notify_all();
+    for (auto& worker : workers) worker.join();
+    workers.clear();
+    stopping = false;
+}
+
+void WorkerPool::WorkerLoop(int index, uint64_t seen)
+{
+    for (;;) {
+        const std::function<void(int, int)>* work;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            start.wait(lock, [&] { return stopping || generation != seen; });
+            if (stopping) return;
+            seen = generation;
+            work = job;
+        }
+
+        (*work)(index, threadCount);
+
+        std::lock_guard<std::mutex> lock(mutex);
+        if (--pending == 0) done.notify_one();
+    }
+}
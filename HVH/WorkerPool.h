@@ -0,0 +1,45 @@
+#pragma once
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Threads that sleep between jobs, for work that splits into independent
+// shares and comes round often enough that starting threads each time would
+// show: the rigid body step, the sky bake. Free of Windows and DirectX.
+class WorkerPool
+{
+public:
+    WorkerPool() = default;
+    ~WorkerPool();
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+    // 1 runs every job on the calling thread. The workers start with the
+    // first job that needs them.
+    void SetThreadCount(int count);
+    int GetThreadCount() const { return threadCount; }
+
+    // Calls job(index, count) once for every index below count, the thread
+    // count: index 0 on the calling thread, the rest on the workers. Returns
+    // once all of them have. One caller at a time.
+    void Run(const std::function<void(int index, int count)>& job);
+
+private:
+    void StartWorkers();
+    void StopWorkers();
+    void WorkerLoop(int index, uint64_t seen);
+
+    int threadCount = 1;
+    std::vector<std::thread> workers;
+    std::mutex mutex;
+    std::condition_variable start;
+    std::condition_variable done;
+    // the current job, read by the workers between start and done
+    const std::function<void(int, int)>* job = nullptr;
+    uint64_t generation = 0;
+    int pending = 0;
+    bool stopping = false;
+};
@@ -0,0 +1,107 @@
+#include "WorldPresets.h"
+#include <cctype>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+
+float (WorldPreset::* const WORLD_PRESET_FIELDS[WORLD_PRESET_FIELD_COUNT])[3] = {
+    &WorldPreset::horizon, &WorldPreset::zenith, &WorldPreset::haze,
+    &WorldPreset::fogNear, &WorldPreset::fogFar,
+    &WorldPreset::lightDir, &WorldPreset::lightColor, &WorldPreset::ambient,
+};
+
+WorldPreset LerpPresets(const WorldPreset& a, const WorldPreset& b, float t)
+{
+    WorldPreset result;
+    for (auto field : WORLD_PRESET_FIELDS) {
+        for (int c = 0; c < 3; ++c) {
+            (result.*field)[c] = (a.*field)[c] * (1.0f - t) + (b.*field)[c] * t;   // exact at both ends
+        }
+    }
+    return result;
+}
+
+bool WorldPresetTable::Load(const std::string& path, std::string& error)
+{
+    std::ifstream in(path);
+    if (!in.is_open()) {
+        error = "can't open " + path;
+        Clear();
+        return false;
+    }
+    std::stringstream text;
+    text << in.rdbuf();
+    return Parse(text.str(), path, error);
+}
+
+bool WorldPresetTable::Parse(const std::string& text, const std::string& source, std::string& error)
+{
+    Clear();
+
+    std::istringstream in(text);
+    std::string line;
+    int lineNumber = 0;
+    while (std::getline(in, line)) {
+        ++lineNumber;
+        size_t comment = line.find('#');
+        if (comment != std::string::npos) line.erase(comment);
+        std::istringstream fields(line);
+        std::string name;
+        if (!(fields >> name)) continue;
+
+        std::string where = source + ":" + std::to_string(lineNumber);
+        if (index.count(name)) {
+            error = where + ": preset '" + name + "' defined twice";
+            Clear();
+            return false;
+        }
+
+        WorldPreset preset;
+        int count = 0;
+        std::string token;
+        for (; count < WORLD_PRESET_FLOATS && fields >> token; ++count) {
+            char* end = nullptr;
+            (preset.*WORLD_PRESET_FIELDS[count / 3])[count % 3] = strtof(token.c_str(), &end);
+            if (*end != '\0') break;
+        }
+        if (count < WORLD_PRESET_FLOATS) {
+            error = where + ": expected " + std::to_string(WORLD_PRESET_FLOATS) + " numbers after '" + name + "'";
+            Clear();
+            return false;
+        }
+
+        std::string description;
+        std::getline(fields >> std::ws, description);
+        while (!description.empty() && isspace((unsigned char)description.back())) description.pop_back();
+
+        index[name] = (int)presets.size();
+        presets.push_back(preset);
+        names.push_back(name);
+        descriptions.push_back(description.empty() ? name + " preset applied" : description);
+    }
+    return true;
+}
+
+void WorldPresetTable::Clear()
+{
+    presets.clear();
+    names.clear();
+    descriptions.clear();
+    index.clear();
+}
+
+int WorldPresetTable::Find(const std::string& name) const
+{
+    auto it = index.find(name);
+    return it != index.end() ? it->second : -1;
+}
+
+std::string WorldPresetTable::ListNames() const
+{
+    std::string list;
+    for (const std::string& name : names) {
+        if (!list.empty()) list += ", ";
+        list += name;
+    }
+    return list;
+}
@@ -0,0 +1,50 @@
+#pragma once
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// A world lighting preset: sky, fog and directional light, eight RGB or XYZ
+// triples. WORLD_PRESET_FIELDS lists them in file order, so blending and
+// parsing walk the members instead of indexing past the end of one.
+struct WorldPreset {
+    float horizon[3], zenith[3], haze[3];
+    float fogNear[3], fogFar[3];
+    float lightDir[3], lightColor[3], ambient[3];
+};
+const int WORLD_PRESET_FIELD_COUNT = 8;
+extern float (WorldPreset::* const WORLD_PRESET_FIELDS[WORLD_PRESET_FIELD_COUNT])[3];
+const int WORLD_PRESET_FLOATS = WORLD_PRESET_FIELD_COUNT * 3;
+
+// t = 0 gives a, 1 gives b. The light direction is blended like the colors;
+// the block shader normalizes it.
+WorldPreset LerpPresets(const WorldPreset& a, const WorldPreset& b, float t);
+
+// Presets read once from a text table (WorldPresets.txt): one per line, a
+// name, WORLD_PRESET_FLOATS numbers in WorldPreset order, then the line
+// shown when it's applied. '#' starts a comment. Lookups go through a hash of
+// the name instead of comparing against every preset.
+class WorldPresetTable
+{
+public:
+    // Replaces the table. False with error set (file:line) if the file can't
+    // be read or a row is malformed; the table is left empty then.
+    bool Load(const std::string& path, std::string& error);
+    bool Parse(const std::string& text, const std::string& source, std::string& error);
+
+    // -1 if there's no preset by that name
+    int Find(const std::string& name) const;
+    size_t GetCount() const { return presets.size(); }
+    const WorldPreset& Get(size_t index) const { return presets[index]; }
+    const std::string& GetName(size_t index) const { return names[index]; }
+    const std::string& GetDescription(size_t index) const { return descriptions[index]; }
+    // "default, sunset, ..." in file order, for usage lines
+    std::string ListNames() const;
+
+private:
+    void Clear();
+
+    std::vector<WorldPreset> presets;
+    std::vector<std::string> names;
+    std::vector<std::string> descriptions;
+    std::unordered_map<std::string, int> index;
+};
@@ -0,0 +1,315 @@
+#include "WorldStore.h"
+#include "BlockRegistry.h"
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
+
+namespace {
+    // same rule MapIoWorker uses when it loads a map
+    bool IsUnitObject(const MapObject& obj)
+    {
+        return obj.scale.x == 1.0f && obj.scale.y == 1.0f && obj.scale.z == 1.0f &&
+            obj.rotation.x == 0.0f && obj.rotation.y == 0.0f && obj.rotation.z == 0.0f;
+    }
+}
+
+bool WorldStore::AddBlock(float x, float y, float z, BlockId block)
+{
+    if (IsOccupied(x, y, z)) return false;
+    MapObject obj;
+    obj.position = { x, y, z };
+    obj.block = block;
+    AddObject(obj);
+    journal.Add(x, y, z, BlockRegistry::GetName(block));
+    return true;
+}
+
+bool WorldStore::RemoveBlock(float px, float py, float pz)
+{
+    PhysicsBox box;
+    int x, y, z;
+    if (VoxelWorld::ToLattice(px, py, pz, x, y, z) && voxels.RemoveBlock(x, y, z)) {
+        box = { { x - 1.0f, y - 1.0f, z - 1.0f }, { x + 1.0f, y + 1.0f, z + 1.0f } };
+    }
+    else {
+        int index = FindObjectAt(px, py, pz);
+        if (index == -1) return false;
+        const MapObject& obj = objects[index];
+        box = {
+            { obj.position.x - obj.scale.x, obj.position.y - obj.scale.y, obj.position.z - obj.scale.z },
+            { obj.position.x + obj.scale.x, obj.position.y + obj.scale.y, obj.position.z + obj.scale.z }
+        };
+        RemoveObject(index);
+    }
+    journal.Remove(px, py, pz);
+    if (removed) removed(box);
+    return true;
+}
+
+void WorldStore::Clear()
+{
+    ClearBlocks();
+    journal.Clear();
+    if (replaced) replaced();
+}
+
+void WorldStore::ClearBlocks()
+{
+    voxels.Clear();
+    objects.clear();
+    grid.Clear();
+}
+
+void WorldStore::AddObject(const MapObject& obj)
+{
+    int x, y, z;
+    if (IsUnitObject(obj) && VoxelWorld::ToLattice(obj.position.x, obj.position.y, obj.position.z, x, y, z)) {
+        voxels.SetBlock(x, y, z, obj.block);
+        return;
+    }
+
+    float halfExtent = (std::max)(obj.scale.x, (std::max)(obj.scale.y, obj.scale.z));
+    grid.Insert((uint32_t)objects.size(), obj.position.x, obj.position.y, obj.position.z, halfExtent);
+    objects.push_back(obj);
+}
+
+void WorldStore::AddObject(const ParkourObject& parkourObj)
+{
+    MapObject obj;
+    obj.position = parkourObj.position;
+    obj.rotation = parkourObj.rotation;
+    obj.scale = parkourObj.scale;
+    obj.block = BlockRegistry::Intern(parkourObj.type);
+    AddObject(obj);
+}
+
+void WorldStore::RemoveObject(size_t index)
+{
+    const MapObject& gone = objects[index];
+    grid.Remove((uint32_t)index, gone.position.x, gone.position.y, gone.position.z);
+
+    // swap-and-pop keeps every other id valid except the moved tail element
+    size_t last = objects.size() - 1;
+    if (index != last) {
+        const MapObject& moved = objects[last];
+        grid.Renumber((uint32_t)last, (uint32_t)index, moved.position.x, moved.position.y, moved.position.z);
+        objects[index] = std::move(objects[last]);
+    }
+    objects.pop_back();
+}
+
+bool WorldStore::IsOccupied(float px, float py, float pz, float tolerance) const
+{
+    int x, y, z;
+    if (VoxelWorld::ToLattice(px, py, pz, x, y, z) && voxels.GetBlock(x, y, z) != BLOCK_AIR) return true;
+    return FindObjectAt(px, py, pz, tolerance) != -1;
+}
+
+int WorldStore::FindObjectAt(float x, float y, float z, float tolerance) const
+{
+    std::vector<uint32_t> candidates;
+    grid.QueryBox(x - tolerance, y - tolerance, z - tolerance, x + tolerance, y + tolerance, z + tolerance, candidates);
+    for (uint32_t id : candidates) {
+        const MapObject& obj = objects[id];
+        if (fabs(obj.position.x - x) < tolerance &&
+            fabs(obj.position.y - y) < tolerance &&
+            fabs(obj.position.z - z) < tolerance) {
+            return (int)id;
+        }
+    }
+    return -1;
+}
+
+void WorldStore::QueryObjects(const PhysicsBox& box, std::vector<uint32_t>& out) const
+{
+    grid.QueryBox(box.min[0], box.min[1], box.min[2], box.max[0], box.max[1], box.max[2], out);
+}
+
+void WorldStore::QueryObjectsAlongRay(const float origin[3], const float dir[3], float length, std::vector<uint32_t>& out) const
+{
+    grid.QuerySegment(origin[0], origin[1], origin[2], dir[0], dir[1], dir[2], length, out);
+}
+
+void WorldStore::CollectBoxes(const PhysicsBox& region, std::vector<PhysicsBox>& out) const
+{
+    CollectVoxelBoxes(voxels, region, out);
+
+    // in id order, so the result doesn't depend on the grid's hashing
+    std::vector<uint32_t> candidates;
+    QueryObjects(region, candidates);
+    std::sort(candidates.begin(), candidates.end());
+    for (uint32_t id : candidates) {
+        const MapObject& obj = objects[id];
+        if (!BlockRegistry::Get(obj.block).solid) continue;
+        out.push_back({
+            { obj.position.x - obj.scale.x, obj.position.y - obj.scale.y, obj.position.z - obj.scale.z },
+            { obj.position.x + obj.scale.x, obj.position.y + obj.scale.y, obj.position.z + obj.scale.z } });
+    }
+}
+
+void WorldStore::CollectObjects(std::vector<ParkourObject>& out) const
+{
+    out.reserve(out.size() + objects.size());
+    for (const MapObject& obj : objects) {
+        ParkourObject parkourObj;
+        parkourObj.position = obj.position;
+        parkourObj.rotation = obj.rotation;
+        parkourObj.scale = obj.scale;
+        parkourObj.type = BlockRegistry::GetName(obj.block);
+        out.push_back(parkourObj);
+    }
+}
+
+HostWorld WorldStore::MakeHostWorld()
+{
+    HostWorld world;
+    world.voxels = &voxels;
+    world.collectObjects = [this](std::vector<ParkourObject>& out) { CollectObjects(out); };
+    world.addBlock = [this](float x, float y, float z, const std::string& blockName) {
+        return AddBlock(x, y, z, BlockRegistry::Intern(blockName));
+        };
+    world.removeBlock = [this](float x, float y, float z) { return RemoveBlock(x, y, z); };
+    return world;
+}
+
+bool WorldStore::StartSave(const std::string& name)
+{
+    if (mapIo.IsBusy()) return false;
+
+    // voxel chunks are shared with the snapshot, only the sparse objects are copied
+    std::vector<ParkourObject> parkourObjects;
+    CollectObjects(parkourObjects);
+    mapIoReportedQuarter = 0;
+    if (!mapIo.StartSave(ParkourMap::GetMapPath(name), name, voxels.Snapshot(), std::move(parkourObjects))) return false;
+    journal.MarkSnapshot();
+    return true;
+}
+
+bool WorldStore::StartLoad(const std::string& name)
+{
+    // the current map stays until the new one is ready, see Update
+    if (!mapIo.StartLoad(name)) return false;
+    mapIoReportedQuarter = 0;
+    return true;
+}
+
+void WorldStore::SetAutosaveMinutes(float minutes)
+{
+    autosaveMinutes = (std::max)(0.0f, minutes);
+    lastAutosaveTime = std::chrono::steady_clock::now();
+}
+
+void WorldStore::Update()
+{
+    auto now = std::chrono::steady_clock::now();
+    if (autosaveMinutes > 0.0f &&
+        std::chrono::duration<float>(now - lastAutosaveTime).count() >= autosaveMinutes * 60.0f &&
+        StartSave(files.autosave)) {
+        lastAutosaveTime = now;
+    }
+
+    // compaction: fold the journal into a full save once it has grown
+    journal.Update();
+    if (journal.GetSize() > journalCompactAt && StartSave(files.journalMap)) {
+        journalCompactAt = journal.GetSize() + JOURNAL_COMPACT_BYTES; // not every tick if it fails
+    }
+
+    if (!mapIo.IsBusy()) return;
+
+    MapIoResult result;
+    if (!mapIo.Poll(result)) {
+        int quarter = (int)(mapIo.GetProgress() * 4.0f);
+        if (quarter > mapIoReportedQuarter && quarter < 4) {
+            mapIoReportedQuarter = quarter;
+            Log(std::string(mapIo.GetKind() == MapIoResult::Kind::Load ? "Loading" : "Saving") +
+                " map " + std::to_string(quarter * 25) + "%");
+        }
+        return;
+    }
+
+    bool loaded = result.kind == MapIoResult::Kind::Load && result.ok;
+    if (loaded) {
+        // swapped in between ticks, nothing ever sees half a map
+        auto swapStart = std::chrono::steady_clock::now();
+        ClearBlocks();
+        voxels.Swap(result.world);
+        for (const auto& obj : result.objects) AddObject(obj);
+        float swapMs = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - swapStart).count();
+        result.message += " (" + std::to_string(GetBlockCount()) + " blocks, " +
+            std::to_string((int)result.milliseconds) + " ms in background, " +
+            std::to_string(swapMs) + " ms swap)";
+    }
+
+    // the journal follows whatever file now holds the world
+    std::string journalPath = GetJournalPath();
+    std::vector<EditJournal::Record> replay;
+    if (result.kind == MapIoResult::Kind::Save) {
+        // Poll joined the worker, nothing reads the snapshot's chunks anymore
+        voxels.ReleaseSnapshots();
+        if (result.ok && journal.Rebase(result.name)) journalCompactAt = JOURNAL_COMPACT_BYTES;
+        else journal.CancelSnapshot();
+    }
+    else if (result.ok) {
+        replay.swap(journalReplay);
+        journal.Begin(journalPath, result.name);
+        journalCompactAt = JOURNAL_COMPACT_BYTES;
+    }
+    else if (!journalReplay.empty()) {
+        // the base map is gone, keep the edits aside rather than replay them on the wrong world
+        std::error_code error;
+        std::filesystem::rename(journalPath, journalPath + ".bak", error);
+        journal.Begin(journalPath, "");
+        journalReplay.clear();
+        result.message += ", unsaved edits kept in " + files.journal + ".bak";
+    }
+
+    Log(result.message);
+    if (!replay.empty()) {
+        Replay(replay);
+        Log("Recovered " + std::to_string(replay.size()) + " unsaved edits");
+    }
+    if (loaded && replaced) replaced();
+}
+
+void WorldStore::Recover()
+{
+    std::string journalPath = GetJournalPath();
+    std::string baseMap;
+    std::vector<EditJournal::Record> records;
+    if (!EditJournal::Read(journalPath, baseMap, records) || records.empty()) {
+        journal.Begin(journalPath, "");
+        return;
+    }
+
+    if (baseMap.empty()) {
+        // edits on the built-in course, which is already built
+        journal.Begin(journalPath, "");
+        Replay(records);
+        Log("Recovered " + std::to_string(records.size()) + " unsaved edits");
+        return;
+    }
+
+    // the journal stays closed, and on disk, until the base map is back
+    journalReplay = std::move(records);
+    StartLoad(baseMap);
+    Log("Recovering unsaved edits on " + baseMap);
+}
+
+void WorldStore::Replay(const std::vector<EditJournal::Record>& records)
+{
+    // through the same calls the edits first took, so they are journaled again
+    for (const auto& record : records) {
+        switch (record.op) {
+        case EditJournal::Op::Add:
+            AddBlock(record.x, record.y, record.z, BlockRegistry::Intern(record.blockName));
+            break;
+        case EditJournal::Op::Remove:
+            RemoveBlock(record.x, record.y, record.z);
+            break;
+        case EditJournal::Op::Clear:
+            Clear();
+            break;
+        }
+    }
+    journal.Flush();
+}
@@ -0,0 +1,123 @@
+#pragma once
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+#include "EditJournal.h"
+#include "HostSession.h"
+#include "MapIo.h"
+#include "PlayerPhysics.h"
+#include "SpatialGrid.h"
+#include "VoxelWorld.h"
+#include "map1.h"
+
+// A block that doesn't fit the voxel lattice: rotated, scaled or off-grid.
+struct MapObject {
+    XMFLOAT3 position = { 0.0f, 0.0f, 0.0f };
+    XMFLOAT3 rotation = { 0.0f, 0.0f, 0.0f };
+    XMFLOAT3 scale = { 1.0f, 1.0f, 1.0f };
+    BlockId block = BLOCK_AIR;
+};
+
+// The map a host edits and keeps on disk, shared by the game and the dedicated
+// server. Unit blocks live in a VoxelWorld, everything else in a short list
+// indexed by a SpatialGrid. Edits are journaled until the next full save;
+// saves and loads run on a MapIoWorker, and Update starts autosaves and
+// journal compaction. Free of Windows and DirectX like the rest of the host.
+class WorldStore
+{
+public:
+    // files under Documents/HVHproject
+    struct Files {
+        std::string journal;    // edits since the last full save
+        std::string journalMap; // compaction target
+        std::string autosave;
+    };
+
+    static const size_t JOURNAL_COMPACT_BYTES = 256 * 1024;
+
+    void SetFiles(const Files& storeFiles) { files = storeFiles; }
+    const Files& GetFiles() const { return files; }
+    std::string GetJournalPath() const { return ParkourMap::GetMapPath(files.journal); }
+
+    void SetLog(std::function<void(const std::string&)> callback) { log = callback; }
+    // blocks inside box were removed, e.g. to wake the bodies resting on them
+    void SetRemovedCallback(std::function<void(const PhysicsBox&)> callback) { removed = callback; }
+    // the whole map was swapped out by a load or a clear
+    void SetReplacedCallback(std::function<void()> callback) { replaced = callback; }
+
+    // Edits, journaled. AddBlock puts a unit block at a free cell, false if
+    // it's taken; RemoveBlock is false if nothing was there.
+    bool AddBlock(float x, float y, float z, BlockId block);
+    bool RemoveBlock(float x, float y, float z);
+    void Clear();
+
+    // Not journaled, for building a course or a map: unit blocks go to the
+    // voxel world, the rest to the object list.
+    void AddObject(const MapObject& obj);
+    void AddObject(const ParkourObject& obj);
+
+    bool IsOccupied(float x, float y, float z, float tolerance = 0.1f) const;
+    // index into GetObjects, -1 if no object is that close
+    int FindObjectAt(float x, float y, float z, float tolerance = 0.1f) const;
+    // Appends the ids of every object that may overlap the box or the segment
+    // origin + dir * [0, length].
+    void QueryObjects(const PhysicsBox& box, std::vector<uint32_t>& out) const;
+    void QueryObjectsAlongRay(const float origin[3], const float dir[3], float length, std::vector<uint32_t>& out) const;
+    // Solid blocks and objects that may touch region, what player and rigid
+    // body collision runs against.
+    void CollectBoxes(const PhysicsBox& region, std::vector<PhysicsBox>& out) const;
+    // objects in map file form, what a save or a joining client gets
+    void CollectObjects(std::vector<ParkourObject>& out) const;
+    // reads go straight to the store, edits through AddBlock and RemoveBlock
+    HostWorld MakeHostWorld();
+
+    VoxelWorld& GetVoxels() { return voxels; }
+    const VoxelWorld& GetVoxels() const { return voxels; }
+    const std::vector<MapObject>& GetObjects() const { return objects; }
+    const SpatialGrid& GetGrid() const { return grid; }
+    size_t GetBlockCount() const { return voxels.GetBlockCount() + objects.size(); }
+
+    // False while a save or load is running. A load replaces the map once
+    // it's done, in Update.
+    bool StartSave(const std::string& name);
+    bool StartLoad(const std::string& name);
+    bool IsBusy() const { return mapIo.IsBusy(); }
+
+    void SetAutosaveMinutes(float minutes);
+    float GetAutosaveMinutes() const { return autosaveMinutes; }
+
+    // Once per tick: autosave and compaction, progress, and a finished save
+    // or load.
+    void Update();
+    // At startup, once the built-in course (if any) is in: replays what the
+    // journal holds, loading its base map first if it has one.
+    void Recover();
+
+    EditJournal& GetJournal() { return journal; }
+
+private:
+    void Log(const std::string& text) { if (log) log(text); }
+    void RemoveObject(size_t index);
+    void ClearBlocks();
+    void Replay(const std::vector<EditJournal::Record>& records);
+
+    Files files;
+    std::function<void(const std::string&)> log;
+    std::function<void(const PhysicsBox&)> removed;
+    std::function<void()> replaced;
+
+    VoxelWorld voxels;
+    std::vector<MapObject> objects; // ids in grid are indices here
+    SpatialGrid grid;
+
+    MapIoWorker mapIo;
+    int mapIoReportedQuarter = 0;
+    float autosaveMinutes = 0.0f;
+    std::chrono::steady_clock::time_point lastAutosaveTime = std::chrono::steady_clock::now();
+
+    EditJournal journal;
+    size_t journalCompactAt = JOURNAL_COMPACT_BYTES;
+    std::vector<EditJournal::Record> journalReplay; // waiting for its base map to load
+};
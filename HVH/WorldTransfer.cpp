@@ -0,0 +1,300 @@
+#include "WorldTransfer.h"
+#include "BlockRegistry.h"
+#include <algorithm>
+#include <cstdlib>
+
+namespace {
+
+    const size_t ENTRY_HEADER_SIZE = 10;
+    const size_t MAX_PALETTE = 255;
+    const size_t MAX_ENTRIES = 255;
+
+    void PutU16(std::vector<char>& out, uint16_t v)
+    {
+        out.push_back((char)(v & 0xFF));
+        out.push_back((char)((v >> 8) & 0xFF));
+    }
+
+    void SetU16(std::vector<char>& out, size_t pos, uint16_t v)
+    {
+        out[pos] = (char)(v & 0xFF);
+        out[pos + 1] = (char)((v >> 8) & 0xFF);
+    }
+
+    uint16_t GetU16(const char* p)
+    {
+        const unsigned char* b = (const unsigned char*)p;
+        return (uint16_t)(b[0] | (b[1] << 8));
+    }
+
+    size_t VarintSize(uint32_t v)
+    {
+        return v < 0x80 ? 1 : (v < 0x4000 ? 2 : 3);
+    }
+
+    void PutVarint(std::vector<char>& out, uint32_t v)
+    {
+        while (v >= 0x80) {
+            out.push_back((char)((v & 0x7F) | 0x80));
+            v >>= 7;
+        }
+        out.push_back((char)v);
+    }
+
+    bool GetVarint(const char* data, size_t size, size_t& pos, uint32_t& v)
+    {
+        v = 0;
+        for (int shift = 0; shift < 21; shift += 7) {
+            if (pos >= size) return false;
+            unsigned char b = (unsigned char)data[pos++];
+            v |= (uint32_t)(b & 0x7F) << shift;
+            if (!(b & 0x80)) return true;
+        }
+        return false;
+    }
+}
+
+uint32_t WorldTransferServer::Begin(int clientId, const VoxelWorld& world, int spawnX, int spawnZ)
+{
+    ClientState client;
+    world.GetChunkCoords(client.chunks);
+
+    // nearest column first, bottom up within a column
+    int scx = VoxelWorld::ChunkCoord(spawnX), scz = VoxelWorld::ChunkCoord(spawnZ);
+    auto ring = [&](const ChunkCoords& c) {
+        return (std::max)(abs(c.cx - scx), abs(c.cz - scz));
+        };
+    std::sort(client.chunks.begin(), client.chunks.end(), [&](const ChunkCoords& a, const ChunkCoords& b) {
+        int ra = ring(a), rb = ring(b);
+        if (ra != rb) return ra < rb;
+        if (a.cx != b.cx) return a.cx < b.cx;
+        if (a.cz != b.cz) return a.cz < b.cz;
+        return a.cy < b.cy;
+        });
+    while (client.spawnChunks < client.chunks.size() && ring(client.chunks[client.spawnChunks]) <= SPAWN_RADIUS) {
+        client.spawnChunks++;
+    }
+
+    client.sentSequence = client.ackedSequence = lastSequence[clientId];
+    clients[clientId] = std::move(client);
+    return (uint32_t)clients[clientId].chunks.size();
+}
+
+void WorldTransferServer::Cancel(int clientId)
+{
+    clients.erase(clientId);
+    lastSequence.erase(clientId);
+}
+
+void WorldTransferServer::Reset()
+{
+    clients.clear();
+    lastSequence.clear();
+}
+
+std::vector<int> WorldTransferServer::GetClients() const
+{
+    std::vector<int> ids;
+    ids.reserve(clients.size());
+    for (const auto& pair : clients) {
+        ids.push_back(pair.first);
+    }
+    return ids;
+}
+
+void WorldTransferServer::Acknowledge(int clientId, uint32_t sequence)
+{
+    auto it = clients.find(clientId);
+    if (it == clients.end()) return;
+
+    ClientState& client = it->second;
+    if ((int32_t)(sequence - client.ackedSequence) <= 0 || (int32_t)(sequence - client.sentSequence) > 0) return;
+    client.ackedSequence = sequence;
+
+    if (client.finished && client.ackedSequence == client.sentSequence) {
+        clients.erase(it);
+    }
+}
+
+bool WorldTransferServer::NextBatch(int clientId, const VoxelWorld& world, NetMessage& out)
+{
+    auto it = clients.find(clientId);
+    if (it == clients.end()) return false;
+
+    ClientState& client = it->second;
+    if (client.finished || client.sentSequence - client.ackedSequence >= WINDOW) return false;
+
+    std::vector<BlockId> palette;
+    size_t paletteBytes = 0;
+    std::vector<char> entries;
+    size_t entryCount = 0;
+    const size_t budget = NET_MAX_WORLD_BATCH - 3;
+
+    auto paletteIndex = [&](BlockId id, size_t& extraBytes) -> int {
+        extraBytes = 0;
+        if (id == BLOCK_AIR) return 0;
+        for (size_t i = 0; i < palette.size(); ++i) {
+            if (palette[i] == id) return (int)i + 1;
+        }
+        if (palette.size() >= MAX_PALETTE) return -1;
+        extraBytes = 1 + (std::min)(BlockRegistry::GetName(id).size(), NET_BLOCK_NAME_SIZE);
+        return (int)palette.size() + 1;
+        };
+
+    bool full = false;
+    while (!full && client.next < client.chunks.size() && entryCount < MAX_ENTRIES) {
+        if (paletteBytes + entries.size() + ENTRY_HEADER_SIZE + 3 > budget) break;
+
+        const ChunkCoords& coords = client.chunks[client.next];
+        const VoxelChunk* chunk = world.FindChunk(coords.cx, coords.cy, coords.cz);
+
+        size_t header = entries.size();
+        PutU16(entries, (uint16_t)(int16_t)coords.cx);
+        PutU16(entries, (uint16_t)(int16_t)coords.cy);
+        PutU16(entries, (uint16_t)(int16_t)coords.cz);
+        PutU16(entries, (uint16_t)client.nextVoxel);
+        PutU16(entries, 0);
+
+        uint16_t runs = 0;
+        int i = client.nextVoxel;
+        while (i < VOXEL_CHUNK_VOLUME) {
+            // a chunk that emptied since Begin goes out as one air run
+            BlockId id = chunk ? chunk->blocks[i] : BLOCK_AIR;
+            int end = i + 1;
+            while (end < VOXEL_CHUNK_VOLUME && (chunk ? chunk->blocks[end] : BLOCK_AIR) == id) ++end;
+
+            size_t extra;
+            int index = paletteIndex(id, extra);
+            size_t cost = extra + 1 + VarintSize((uint32_t)(end - i));
+            if (index < 0 || paletteBytes + entries.size() + cost > budget) {
+                full = true;
+                break;
+            }
+            if (extra) {
+                palette.push_back(id);
+                paletteBytes += extra;
+            }
+            entries.push_back((char)index);
+            PutVarint(entries, (uint32_t)(end - i));
+            runs++;
+            i = end;
+        }
+
+        if (runs == 0) {
+            entries.resize(header);
+            break;
+        }
+        SetU16(entries, header + 8, runs);
+        entryCount++;
+
+        if (i == VOXEL_CHUNK_VOLUME) {
+            client.next++;
+            client.nextVoxel = 0;
+        }
+        else {
+            client.nextVoxel = i;
+        }
+    }
+
+    uint8_t flags = 0;
+    if (client.next >= client.spawnChunks) flags |= WORLD_BATCH_SPAWN_READY;
+    if (client.next == client.chunks.size()) {
+        flags |= WORLD_BATCH_LAST;
+        client.finished = true;
+    }
+
+    out = NetMessage();
+    out.type = NetMessageType::WorldBatch;
+    out.sequence = ++client.sentSequence;
+    lastSequence[clientId] = client.sentSequence;
+
+    out.data.reserve(3 + paletteBytes + entries.size());
+    out.data.push_back((char)flags);
+    out.data.push_back((char)palette.size());
+    for (BlockId id : palette) {
+        const std::string& name = BlockRegistry::GetName(id);
+        size_t len = (std::min)(name.size(), NET_BLOCK_NAME_SIZE);
+        out.data.push_back((char)len);
+        out.data.insert(out.data.end(), name.begin(), name.begin() + len);
+    }
+    out.data.push_back((char)entryCount);
+    out.data.insert(out.data.end(), entries.begin(), entries.end());
+    return true;
+}
+
+void WorldTransferClient::Begin(uint32_t count)
+{
+    active = true;
+    spawnReady = false;
+    chunkCount = count;
+    chunksReceived = 0;
+}
+
+void WorldTransferClient::Reset()
+{
+    active = false;
+    spawnReady = true;
+    chunkCount = 0;
+    chunksReceived = 0;
+}
+
+bool WorldTransferClient::Apply(const NetMessage& batch, VoxelWorld& world)
+{
+    const char* data = batch.data.data();
+    size_t size = batch.data.size();
+    size_t pos = 0;
+    if (size < 3) return false;
+
+    uint8_t flags = (uint8_t)data[pos++];
+    size_t paletteSize = (unsigned char)data[pos++];
+    std::vector<BlockId> palette(1, BLOCK_AIR);
+    for (size_t i = 0; i < paletteSize; ++i) {
+        if (pos >= size) return false;
+        size_t len = (unsigned char)data[pos++];
+        if (len > NET_BLOCK_NAME_SIZE || pos + len > size) return false;
+        palette.push_back(BlockRegistry::Intern(std::string(data + pos, len)));
+        pos += len;
+    }
+
+    if (pos >= size) return false;
+    size_t entryCount = (unsigned char)data[pos++];
+    for (size_t e = 0; e < entryCount; ++e) {
+        if (pos + ENTRY_HEADER_SIZE > size) return false;
+        int cx = (int16_t)GetU16(data + pos);
+        int cy = (int16_t)GetU16(data + pos + 2);
+        int cz = (int16_t)GetU16(data + pos + 4);
+        uint32_t voxel = GetU16(data + pos + 6);
+        size_t runs = GetU16(data + pos + 8);
+        pos += ENTRY_HEADER_SIZE;
+
+        // air only has to be written over blocks this client already has
+        bool hadChunk = world.FindChunk(cx, cy, cz) != nullptr;
+        int ox = cx * VOXEL_CHUNK_SIZE, oy = cy * VOXEL_CHUNK_SIZE, oz = cz * VOXEL_CHUNK_SIZE;
+        for (size_t r = 0; r < runs; ++r) {
+            if (pos >= size) return false;
+            size_t index = (unsigned char)data[pos++];
+            uint32_t length;
+            if (index >= palette.size() || !GetVarint(data, size, pos, length) ||
+                voxel + length > (uint32_t)VOXEL_CHUNK_VOLUME) {
+                return false;
+            }
+
+            BlockId id = palette[index];
+            if (id != BLOCK_AIR || hadChunk) {
+                for (uint32_t v = voxel; v < voxel + length; ++v) {
+                    int lx = v % VOXEL_CHUNK_SIZE;
+                    int lz = (v / VOXEL_CHUNK_SIZE) % VOXEL_CHUNK_SIZE;
+                    int ly = v / (VOXEL_CHUNK_SIZE * VOXEL_CHUNK_SIZE);
+                    world.SetBlock(ox + lx, oy + ly, oz + lz, id);
+                }
+            }
+            voxel += length;
+        }
+        if (voxel == (uint32_t)VOXEL_CHUNK_VOLUME) chunksReceived++;
+    }
+    if (pos != size) return false;
+
+    if (flags & WORLD_BATCH_SPAWN_READY) spawnReady = true;
+    if (flags & WORLD_BATCH_LAST) active = false;
+    return true;
+}
@@ -0,0 +1,78 @@
+#pragma once
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+#include "NetProtocol.h"
+#include "VoxelWorld.h"
+
+// WorldBatch data: u8 flags, u8 palette size, palette names (u8 length + bytes),
+// u8 entry count, then per entry i16 cx, cy, cz, u16 first voxel index, u16 run
+// count and the runs (u8 palette index, 0 = air, varint length). An entry covers
+// a chunk from its first voxel on, a chunk too big for one batch continues in
+// the next entry.
+enum WorldBatchFlags : uint8_t {
+    WORLD_BATCH_SPAWN_READY = 1,   // every chunk around spawn has been sent
+    WORLD_BATCH_LAST = 2
+};
+
+// Server half of the join-time world transfer. Chunks go out nearest to spawn
+// first, as run-length encoded batches, with at most WINDOW batches waiting
+// for an ack per client.
+class WorldTransferServer
+{
+public:
+    static const uint32_t WINDOW = 16;
+    static const int SPAWN_RADIUS = 2;   // in chunks, around the spawn column
+
+    // Starts (or restarts) sending every chunk world holds now. Returns the
+    // chunk count for WorldBegin.
+    uint32_t Begin(int clientId, const VoxelWorld& world, int spawnX, int spawnZ);
+    void Cancel(int clientId);
+    void Reset();
+    bool HasTransfers() const { return !clients.empty(); }
+    std::vector<int> GetClients() const;
+
+    void Acknowledge(int clientId, uint32_t sequence);
+
+    // Encodes the next batch if the client's window has room. Chunks are read
+    // when encoded, so edits made during the transfer are included; edits to
+    // chunks already sent reach the client as regular BlockAdd/BlockRemove.
+    bool NextBatch(int clientId, const VoxelWorld& world, NetMessage& out);
+
+private:
+    struct ClientState {
+        std::vector<ChunkCoords> chunks;
+        size_t spawnChunks = 0;    // chunks[0, spawnChunks) surround spawn
+        size_t next = 0;           // chunk being sent
+        int nextVoxel = 0;         // where the next entry for it starts
+        bool finished = false;     // last batch sent, waiting for acks only
+        uint32_t sentSequence = 0;
+        uint32_t ackedSequence = 0;
+    };
+
+    std::unordered_map<int, ClientState> clients;
+    // sequences keep counting across restarts so stale acks are ignored
+    std::unordered_map<int, uint32_t> lastSequence;
+};
+
+// Client half: applies batches to the local world and tracks progress.
+class WorldTransferClient
+{
+public:
+    void Begin(uint32_t chunkCount);
+    void Reset();
+
+    // False if the batch is malformed; nothing after the bad entry is applied.
+    bool Apply(const NetMessage& batch, VoxelWorld& world);
+
+    bool IsActive() const { return active; }
+    bool IsSpawnReady() const { return spawnReady; }
+    uint32_t GetChunksReceived() const { return chunksReceived; }
+    uint32_t GetChunkCount() const { return chunkCount; }
+
+private:
+    bool active = false;
+    bool spawnReady = true;
+    uint32_t chunkCount = 0;
+    uint32_t chunksReceived = 0;
+};
@@ -2,8 +2,12 @@
 #include <fstream>
 #include <sstream>
 #include <string>
+#ifdef _WIN32
 #include <shlobj.h> // For SHGetFolderPath
 #include <windows.h>
+#else
+#include <cstdlib>
+#endif
 
 // Use filesystem if available (C++17 or later)
 #if __cplusplus >= 201703L
@@ -25,21 +29,11 @@ void ParkourMap::AddParkourObject(std::vector<ParkourObject>& course, const Park
 }
 
 bool ParkourMap::SaveParkourCourse(const std::vector<ParkourObject>& course, const std::string& filename) {
-    // Get the Documents folder path
-    char documentsPath[MAX_PATH];
-    HRESULT result = SHGetFolderPathA(NULL, CSIDL_PERSONAL, NULL, 0, documentsPath);
-    if (FAILED(result)) {
+    std::string filePath = GetMapPath(filename);
+    if (filePath.empty()) {
         return false;
     }
 
-    // Construct the full path: Documents/HVHproject/filename
-#if __cplusplus >= 201703L
-    fs::path filePath = fs::path(documentsPath) / "HVHproject" / filename;
-#else
-    // Fallback: manual path construction
-    std::string filePath = std::string(documentsPath) + "\\HVHproject\\" + filename;
-#endif
-
     // Open file for writing
     std::ofstream outFile(filePath);
     if (!outFile.is_open()) {
@@ -62,21 +56,11 @@ bool ParkourMap::SaveParkourCourse(const std::vector<ParkourObject>& course, con
 std::vector<ParkourObject> ParkourMap::LoadParkourCourse(const std::string& filename) {
     std::vector<ParkourObject> course;
 
-    // Get the Documents folder path
-    char documentsPath[MAX_PATH];
-    HRESULT result = SHGetFolderPathA(NULL, CSIDL_PERSONAL, NULL, 0, documentsPath);
-    if (FAILED(result)) {
+    std::string filePath = GetMapPath(filename);
+    if (filePath.empty()) {
         return course; // Return empty course on error
     }
 
-    // Construct the full path: Documents/HVHproject/filename
-#if __cplusplus >= 201703L
-    fs::path filePath = fs::path(documentsPath) / "HVHproject" / filename;
-#else
-    // Fallback: manual path construction
-    std::string filePath = std::string(documentsPath) + "\\HVHproject\\" + filename;
-#endif
-
     // Open file for reading
     std::ifstream inFile(filePath);
     if (!inFile.is_open()) {
@@ -103,6 +87,31 @@ std::vector<ParkourObject> ParkourMap::LoadParkourCourse(const std::string& file
     return course;
 }
 
+std::string ParkourMap::GetMapPath(const std::string& filename) {
+#ifdef _WIN32
+    // Get the Documents folder path
+    char documentsPath[MAX_PATH];
+    HRESULT result = SHGetFolderPathA(NULL, CSIDL_PERSONAL, NULL, 0, documentsPath);
+    if (FAILED(result)) {
+        return "";
+    }
+#else
+    // no Documents folder on a server box, the home directory stands in
+    const char* documentsPath = std::getenv("HOME");
+    if (!documentsPath) {
+        return "";
+    }
+#endif
+
+    // Construct the full path: Documents/HVHproject/filename
+#if __cplusplus >= 201703L
+    return (fs::path(documentsPath) / "HVHproject" / filename).string();
+#else
+    // Fallback: manual path construction
+    return std::string(documentsPath) + "\\HVHproject\\" + filename;
+#endif
+}
+
 std::vector<ParkourObject> ParkourMap::CreateParkourBalls() {
     std::vector<ParkourObject> balls;
 
@@ -28,5 +28,7 @@ public:
     static void AddParkourObject(std::vector<ParkourObject>& course, const ParkourObject& object);
     static bool SaveParkourCourse(const std::vector<ParkourObject>& course, const std::string& filename);
     static std::vector<ParkourObject> LoadParkourCourse(const std::string& filename);
+    // Documents/HVHproject/filename (~/HVHproject off Windows), empty if there is no such folder
+    static std::string GetMapPath(const std::string& filename);
     static std::vector<ParkourObject> CreateParkourBalls();
 };
\ No newline at end of file
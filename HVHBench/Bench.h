@@ -0,0 +1,51 @@
+#pragma once
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+// Benchmarks register themselves with BENCH(name) { ... } and print what they
+// measured. hvh-bench runs every one, or only those named on the command line.
+// Everything here is headless and portable, the numbers are for comparing
+// changes on one machine, not across machines.
+struct BenchCase {
+    const char* name;
+    void (*run)();
+};
+
+std::vector<BenchCase>& BenchRegistry();
+
+struct BenchRegistrar {
+    BenchRegistrar(const char* name, void (*run)()) { BenchRegistry().push_back({ name, run }); }
+};
+
+#define BENCH(name) \
+    static void Bench_##name(); \
+    static BenchRegistrar benchRegistrar_##name(#name, Bench_##name); \
+    static void Bench_##name()
+
+inline double MillisecondsSince(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Deterministic scatter for scenes, so every run measures the same work.
+struct BenchRandom {
+    uint32_t state;
+    explicit BenchRandom(uint32_t seed) : state(seed ? seed : 1) {}
+    uint32_t Next()
+    {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        return state;
+    }
+    // [lo, hi)
+    float Range(float lo, float hi) { return lo + (hi - lo) * (Next() >> 8) * (1.0f / 16777216.0f); }
+};
+
+// Keeps a result alive so the optimizer can't drop the measured loop.
+inline void BenchKeep(uint64_t value)
+{
+    static volatile uint64_t sink;
+    sink = sink + value;
+}
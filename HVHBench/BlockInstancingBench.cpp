@@ -0,0 +1,47 @@
+#include "Bench.h"
+#include "BlockInstancing.h"
+#include <cstdio>
+
+// BuildInstanceList per frame: 100k voxels drawn as instances (the path
+// before chunk meshes) and the sparse object list alone (what Render builds
+// now), reported as ms per build and instances per second.
+namespace {
+    void TimeBuild(const char* label, const VoxelWorld* world, const std::vector<InstanceObject>& objects)
+    {
+        InstanceList list;
+        BuildInstanceList(world, objects.data(), objects.size(), list);   // warm, sized
+        const int frames = 50;
+        auto start = std::chrono::steady_clock::now();
+        for (int f = 0; f < frames; ++f) {
+            BuildInstanceList(world, objects.data(), objects.size(), list);
+            BenchKeep(list.instances.size());
+        }
+        double ms = MillisecondsSince(start) / frames;
+        printf("  %-32s %7zu instances %8.3f ms/build %7.1f M instances/s\n", label,
+            list.instances.size(), ms, list.instances.size() / ms / 1000.0);
+    }
+}
+
+BENCH(block_instancing)
+{
+    BenchRandom random(9);
+    VoxelWorld world;
+    while (world.GetBlockCount() < 100000) {
+        world.SetBlock((int)random.Range(-128, 128), (int)random.Range(0, 32), (int)random.Range(-128, 128),
+            (BlockId)(1 + random.Next() % 9));
+    }
+
+    std::vector<InstanceObject> objects(10000);
+    for (InstanceObject& obj : objects) {
+        for (int i = 0; i < 3; ++i) {
+            obj.position[i] = random.Range(-128, 128);
+            obj.rotation[i] = random.Range(-3.2f, 3.2f);
+            obj.scale[i] = random.Range(0.5f, 4.0f);
+        }
+        obj.block = (BlockId)(1 + random.Next() % 9);
+    }
+
+    TimeBuild("100k voxels", &world, {});
+    TimeBuild("10k rotated objects", nullptr, objects);
+    TimeBuild("100k voxels + 10k objects", &world, objects);
+}
@@ -0,0 +1,41 @@
+#include "Bench.h"
+#include "ChunkMesher.h"
+#include <cstdio>
+
+// One chunk remeshed over and over: a dense chunk (every cell filled, mostly
+// buried) and a sparse one (1 in 10 cells), plain and greedy.
+namespace {
+    void TimeRemesh(const char* label, const VoxelWorld& world, bool greedy)
+    {
+        ChunkMesh mesh;
+        BuildChunkMesh(world, 0, 0, 0, greedy, mesh);
+        const int remeshes = 200;
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < remeshes; ++i) {
+            BuildChunkMesh(world, 0, 0, 0, greedy, mesh);
+            BenchKeep(mesh.indices.size());
+        }
+        double ms = MillisecondsSince(start) / remeshes;
+        printf("  %-16s %-7s %6zu faces %6zu triangles %7.3f ms/remesh\n", label, greedy ? "greedy" : "plain",
+            mesh.exposedFaces, mesh.indices.size() / 3, ms);
+    }
+}
+
+BENCH(chunk_mesher)
+{
+    BenchRandom random(4);
+    VoxelWorld dense, sparse;
+    for (int y = 0; y < VOXEL_CHUNK_SIZE; ++y) {
+        for (int z = 0; z < VOXEL_CHUNK_SIZE; ++z) {
+            for (int x = 0; x < VOXEL_CHUNK_SIZE; ++x) {
+                dense.SetBlock(x, y, z, (BlockId)(1 + y / 6));
+                if (random.Next() % 10 == 0) sparse.SetBlock(x, y, z, (BlockId)(1 + random.Next() % 9));
+            }
+        }
+    }
+
+    TimeRemesh("dense", dense, false);
+    TimeRemesh("dense", dense, true);
+    TimeRemesh("sparse", sparse, false);
+    TimeRemesh("sparse", sparse, true);
+}
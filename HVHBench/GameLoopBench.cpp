@@ -0,0 +1,92 @@
+#include "Bench.h"
+#include "GameLoop.h"
+#include "PlayerPhysics.h"
+#include "RigidBodies.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+
+// The headless part of a host tick, driven by FixedTimestep from jittery 144 Hz
+// frames: 64 players wandering over voxel terrain and 2000 loose bodies. Each
+// tick's cost is timed on its own, so the spread shows against the 8.3 ms
+// budget of a 120 Hz tick. Advance alone is timed too, it runs every frame.
+namespace {
+    const int PLAYER_COUNT = 64;
+    const int BODY_COUNT = 2000;
+    const int TICKS = 1200;
+}
+
+BENCH(game_loop)
+{
+    VoxelWorld world;
+    for (int z = -64; z <= 64; z += 2) {
+        for (int x = -64; x <= 64; x += 2) {
+            int height = 1 + (int)(2.0f + 2.0f * sinf(x * 0.07f) * cosf(z * 0.05f));
+            for (int h = 0; h < height; ++h) world.SetBlock(x, 1 + 2 * h, z, 2);
+        }
+    }
+    PhysicsBoxSource boxes = [&world](const PhysicsBox& region, std::vector<PhysicsBox>& out) {
+        CollectVoxelBoxes(world, region, out);
+    };
+
+    BenchRandom random(16);
+    std::vector<PlayerBody> players(PLAYER_COUNT);
+    for (PlayerBody& body : players) {
+        body.position[0] = random.Range(-50, 50);
+        body.position[1] = 20.0f;
+        body.position[2] = random.Range(-50, 50);
+    }
+    RigidBodyWorld bodies;
+    for (int i = 0; i < BODY_COUNT; ++i) {
+        float position[3] = { random.Range(-60, 60), random.Range(15, 60), random.Range(-60, 60) };
+        bodies.AddSphere(position, random.Range(0.3f, 1.0f), 9);
+    }
+    PlayerPhysicsParams params;
+    params.airAcceleration = 45.0f;
+
+    FixedTimestep timestep;
+    std::vector<double> tickMs;
+    tickMs.reserve(TICKS);
+    int frames = 0;
+    while ((int)tickMs.size() < TICKS) {
+        int due = timestep.Advance(1.0 / 144.0 + random.Range(-0.002f, 0.002f));
+        ++frames;
+        for (int t = 0; t < due; ++t) {
+            auto start = std::chrono::steady_clock::now();
+            float dt = (float)timestep.GetTickSeconds();
+            for (PlayerBody& body : players) {
+                float angle = random.Range(0, 6.2831853f);
+                PlayerMove move;
+                move.wishX = cosf(angle);
+                move.wishZ = sinf(angle);
+                move.speed = 15.625f;
+                if (body.grounded && (random.Next() & 31) == 0) {
+                    body.velocity[1] = 40.0f;
+                    body.grounded = false;
+                }
+                StepPlayer(body, move, params, dt, boxes);
+            }
+            bodies.Step(dt, params.gravity, boxes);
+            tickMs.push_back(MillisecondsSince(start));
+        }
+    }
+
+    std::vector<double> sorted = tickMs;
+    std::sort(sorted.begin(), sorted.end());
+    double total = 0.0;
+    for (double ms : tickMs) total += ms;
+    double budget = timestep.GetTickSeconds() * 1000.0;
+    printf("  %d ticks over %d frames, %zu awake bodies at the end\n", TICKS, frames, bodies.GetStats().awake);
+    printf("  tick cost  mean %.3f ms  p50 %.3f  p99 %.3f  max %.3f  (%.1f%% of the %.2f ms budget at p99)\n",
+        total / TICKS, sorted[TICKS / 2], sorted[TICKS * 99 / 100], sorted.back(),
+        100.0 * sorted[TICKS * 99 / 100] / budget, budget);
+
+    const int advances = 10000000;
+    FixedTimestep clock;
+    uint64_t ticks = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < advances; ++i) ticks += clock.Advance(1.0 / 144.0);
+    double ms = MillisecondsSince(start);
+    BenchKeep(ticks);
+    printf("  Advance    %.2f ns/frame\n", ms * 1e6 / advances);
+}
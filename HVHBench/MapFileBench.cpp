@@ -0,0 +1,87 @@
+#include "Bench.h"
+#include "MapIo.h"
+#include "BlockRegistry.h"
+#include <cmath>
+#include <cstdio>
+#include <filesystem>
+#include <thread>
+
+// A generated 1M block map saved as the binary format (with and without LZ)
+// and as the old text format, then loaded back through MapIoWorker the way
+// the game's "load" command does. Files go to the temp directory;
+// GetMapPath joins names with std::filesystem, so an absolute one is used
+// as is.
+namespace fs = std::filesystem;
+
+namespace {
+    void BuildMap(VoxelWorld& world, size_t blockCount)
+    {
+        int half = (int)(sqrt(blockCount / 4.0) * 0.5);
+        for (int x = -half; x < half; ++x) {
+            for (int z = -half; z < half; ++z) {
+                int top = (int)(6.0 * sin(x * 0.05) * cos(z * 0.04));
+                for (int y = top - 3; y <= top; ++y) {
+                    world.SetBlock(x, y, z, (BlockId)(y == top ? 1 : y == top - 1 ? 6 : 2));
+                }
+            }
+        }
+    }
+
+    void TimeLoad(const char* label, const fs::path& path, double saveMs, size_t expectedBlocks)
+    {
+        MapIoWorker worker;
+        MapIoResult result;
+        worker.StartLoad(path.string());
+        while (!worker.Poll(result)) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+        // the binary format only reads the directory up front
+        char open[32] = "-";
+        MapFileReader reader;
+        auto start = std::chrono::steady_clock::now();
+        if (reader.Open(path.string()) == MapFileStatus::Ok) snprintf(open, sizeof(open), "%.2f ms", MillisecondsSince(start));
+
+        printf("  %-12s %9.2f MB  save %8.1f ms  load %8.1f ms  open only %s%s\n", label,
+            fs::file_size(path) / 1048576.0, saveMs, result.milliseconds, open,
+            result.ok && result.world.GetBlockCount() == expectedBlocks ? "" : "  LOAD MISMATCH");
+    }
+}
+
+BENCH(map_file)
+{
+    VoxelWorld world;
+    BuildMap(world, 1000000);
+    std::vector<ParkourObject> none;
+
+    fs::path dir = fs::temp_directory_path();
+    fs::path lz = dir / "hvh-bench-lz.hvhmap", rle = dir / "hvh-bench-rle.hvhmap", text = dir / "hvh-bench.txt";
+
+    auto start = std::chrono::steady_clock::now();
+    SaveMapFile(lz.string(), world, none, true);
+    double lzSave = MillisecondsSince(start);
+    start = std::chrono::steady_clock::now();
+    SaveMapFile(rle.string(), world, none, false);
+    double rleSave = MillisecondsSince(start);
+
+    // the old format has one line per block
+    std::vector<ParkourObject> objects;
+    objects.reserve(world.GetBlockCount());
+    world.ForEachBlock([&](int x, int y, int z, BlockId id) {
+        ParkourObject obj;
+        obj.position = { (float)x, (float)y, (float)z };
+        obj.type = BlockRegistry::GetName(id);
+        objects.push_back(obj);
+    });
+    start = std::chrono::steady_clock::now();
+    ParkourMap::SaveParkourCourse(objects, text.string());
+    double textSave = MillisecondsSince(start);
+
+    printf("  %zu blocks, %zu chunks\n", world.GetBlockCount(), world.GetChunkCount());
+    TimeLoad("binary LZ", lz, lzSave, world.GetBlockCount());
+    TimeLoad("binary RLE", rle, rleSave, world.GetBlockCount());
+    TimeLoad("text", text, textSave, world.GetBlockCount());
+
+    std::error_code ignored;
+    fs::remove(lz, ignored);
+    fs::remove(rle, ignored);
+    fs::remove(text, ignored);
+}
@@ -0,0 +1,63 @@
+#include "Bench.h"
+#include "MipChain.h"
+#include <cstdio>
+
+// DownsampleRGBA8 against the scalar reference it must match: first a bit
+// for bit check over odd and 1 texel sides, which take the scalar edges,
+// then both filters on a 2048x2048 level, the size of the player and water
+// textures, and a full chain the way the game builds one at startup: mip 0
+// copied in and every level freshly allocated, which is most of its cost.
+namespace {
+    std::vector<uint8_t> RandomImage(BenchRandom& random, uint32_t width, uint32_t height)
+    {
+        std::vector<uint8_t> image((size_t)width * height * 4);
+        for (uint8_t& b : image) b = (uint8_t)(random.Next() >> 24);
+        return image;
+    }
+}
+
+BENCH(mip_chain)
+{
+    BenchRandom random(22);
+    static const uint32_t sizes[][2] = {
+        { 1, 1 }, { 1, 7 }, { 7, 1 }, { 2, 2 }, { 3, 5 }, { 9, 9 }, { 17, 6 }, { 64, 64 }, { 255, 129 },
+    };
+    int differing = 0;
+    for (const auto& size : sizes) {
+        std::vector<uint8_t> image = RandomImage(random, size[0], size[1]);
+        size_t outSize = (size_t)MipDimension(size[0], 1) * MipDimension(size[1], 1) * 4;
+        std::vector<uint8_t> fast(outSize), reference(outSize);
+        DownsampleRGBA8(image.data(), size[0], size[1], fast.data());
+        DownsampleRGBA8Reference(image.data(), size[0], size[1], reference.data());
+        if (fast != reference) {
+            printf("  %ux%u: DIFFERS from the reference\n", size[0], size[1]);
+            ++differing;
+        }
+    }
+    printf("  %zu odd sizes, %d differ from the reference\n", sizeof(sizes) / sizeof(sizes[0]), differing);
+
+    const uint32_t side = 2048;
+    const int runs = 20;
+    std::vector<uint8_t> image = RandomImage(random, side, side);
+    std::vector<uint8_t> out((size_t)side * side);
+    double ms[2];
+    for (int pass = 0; pass < 2; ++pass) {
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < runs; ++i) {
+            if (pass == 0) DownsampleRGBA8Reference(image.data(), side, side, out.data());
+            else DownsampleRGBA8(image.data(), side, side, out.data());
+            BenchKeep(out[i]);
+        }
+        ms[pass] = MillisecondsSince(start) / runs;
+        printf("  %-16s %7.2f ms per 2048x2048 level, %6.0f MB/s read\n", pass == 0 ? "reference" : "DownsampleRGBA8",
+            ms[pass], image.size() / (ms[pass] * 1e-3) / (1024.0 * 1024.0));
+    }
+    printf("  %.1fx the reference\n", ms[0] / ms[1]);
+
+    std::vector<std::vector<uint8_t>> mips;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < runs; ++i) BuildMipChain(side, side, image, mips);
+    double chainMs = MillisecondsSince(start) / runs;
+    BenchKeep(mips.size());
+    printf("  BuildMipChain    %7.2f ms for all %zu levels of a 2048x2048 image\n", chainMs, mips.size());
+}
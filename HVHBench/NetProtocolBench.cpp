@@ -0,0 +1,65 @@
+#include "Bench.h"
+#include "NetworkManager.h"
+#include <atomic>
+#include <cstdio>
+#include <thread>
+
+// Framing cost in memory, then the same Position stream pushed through
+// NetworkManager over a loopback socket, one client to one server.
+namespace {
+    const int BENCH_PORT = 27115;
+    const int MESSAGE_COUNT = 100000;
+
+    NetMessage BenchPosition(uint32_t i)
+    {
+        NetMessage msg = NetMessage::Position(3, i * 0.01f, 1.5f, -i * 0.02f, 0.5f, 0.1f);
+        msg.sequence = i;
+        return msg;
+    }
+}
+
+BENCH(net_protocol)
+{
+    std::vector<char> stream;
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < MESSAGE_COUNT; ++i) EncodeNetMessage(BenchPosition(i), stream);
+    double encodeMs = MillisecondsSince(start);
+
+    // recv-sized pieces, so frames straddle the appends
+    NetFrameReader reader;
+    NetMessage msg;
+    size_t decoded = 0;
+    start = std::chrono::steady_clock::now();
+    for (size_t pos = 0; pos < stream.size(); pos += 8192) {
+        size_t size = stream.size() - pos < 8192 ? stream.size() - pos : 8192;
+        reader.Append(stream.data() + pos, size);
+        while (reader.Next(msg)) ++decoded;
+    }
+    double decodeMs = MillisecondsSince(start);
+    printf("  encode %d Position    %7.2f ms  %6.2f M msgs/s\n", MESSAGE_COUNT, encodeMs, MESSAGE_COUNT / encodeMs / 1000.0);
+    printf("  decode %zu Position    %7.2f ms  %6.2f M msgs/s\n", decoded, decodeMs, decoded / decodeMs / 1000.0);
+
+    NetworkManager server, client;
+    std::atomic<int> received{ 0 };
+    server.Initialize();
+    server.SetDataReceivedCallback([&](const NetMessage& m, int) {
+        if (m.type == NetMessageType::Position) received++;
+    });
+    if (!server.StartServer(BENCH_PORT) || !client.ConnectToServer("127.0.0.1", BENCH_PORT)) {
+        printf("  loopback: can't open port %d\n", BENCH_PORT);
+        return;
+    }
+
+    start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < MESSAGE_COUNT; ++i) client.SendData(BenchPosition(i));
+    while (received < MESSAGE_COUNT && MillisecondsSince(start) < 30000.0) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    double loopMs = MillisecondsSince(start);
+    double bytes = (double)received * NetMessageSize(BenchPosition(0));
+    printf("  loopback %d/%d Position %7.2f ms  %6.2f M msgs/s  %6.1f MB/s\n", received.load(), MESSAGE_COUNT,
+        loopMs, received / loopMs / 1000.0, bytes / loopMs / 1000.0);
+
+    client.Disconnect();
+    server.Disconnect();
+}
@@ -0,0 +1,97 @@
+#include "Bench.h"
+#include "NetworkManager.h"
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <memory>
+#include <thread>
+
+// Load test for the server's I/O thread: N clients connect over loopback and
+// each sends Position messages at a fixed rate; the server echoes every one
+// back to its sender. Reports what the server handled per second and the
+// round trip percentiles seen by the clients.
+namespace {
+    const int BENCH_PORT = 27117;
+    const int SEND_INTERVAL_US = 4000;   // 250 messages a second per client
+    const int RUN_MS = 1500;
+
+    struct LoadClient {
+        NetworkManager net;
+        std::vector<float> roundTripsUs;   // only touched by net's I/O thread until Disconnect
+    };
+
+    double Percentile(std::vector<float>& sorted, double p)
+    {
+        if (sorted.empty()) return 0.0;
+        size_t index = (size_t)(p * (sorted.size() - 1) + 0.5);
+        return sorted[index];
+    }
+
+    void RunLoad(int clientCount)
+    {
+        auto epoch = std::chrono::steady_clock::now();
+        auto microsNow = [epoch] {
+            return (uint32_t)std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now() - epoch).count();
+        };
+
+        NetworkManager server;
+        std::atomic<uint64_t> handled{ 0 };
+        server.Initialize();
+        server.SetDataReceivedCallback([&](const NetMessage& msg, int clientId) {
+            if (msg.type != NetMessageType::Position) return;
+            server.SendToClient(clientId, msg);
+            handled++;
+        });
+        if (!server.StartServer(BENCH_PORT)) {
+            printf("  can't open port %d\n", BENCH_PORT);
+            return;
+        }
+
+        std::vector<std::unique_ptr<LoadClient>> clients;
+        for (int i = 0; i < clientCount; ++i) {
+            clients.push_back(std::make_unique<LoadClient>());
+            LoadClient* client = clients.back().get();
+            client->roundTripsUs.reserve(RUN_MS * 1000 / SEND_INTERVAL_US + 64);
+            client->net.SetDataReceivedCallback([client, microsNow](const NetMessage& msg, int) {
+                if (msg.type == NetMessageType::Position) client->roundTripsUs.push_back((float)(microsNow() - msg.sequence));
+            });
+            if (!client->net.ConnectToServer("127.0.0.1", BENCH_PORT)) {
+                printf("  client %d can't connect\n", i);
+                return;
+            }
+        }
+        while (server.GetClientCount() < clientCount) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+        // one sender thread, spreading the clients over the interval
+        uint64_t sent = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (int tick = 0; tick * SEND_INTERVAL_US < RUN_MS * 1000; ++tick) {
+            for (int i = 0; i < clientCount; ++i) {
+                auto due = start + std::chrono::microseconds(tick * SEND_INTERVAL_US + i * SEND_INTERVAL_US / clientCount);
+                std::this_thread::sleep_until(due);
+                NetMessage msg = NetMessage::Position(i, (float)tick, 1.0f, 0.0f);
+                msg.sequence = microsNow();
+                clients[i]->net.SendData(msg);
+                ++sent;
+            }
+        }
+        double ms = MillisecondsSince(start);
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));   // let the last echoes land
+
+        std::vector<float> all;
+        for (auto& client : clients) client->net.Disconnect();
+        for (auto& client : clients) all.insert(all.end(), client->roundTripsUs.begin(), client->roundTripsUs.end());
+        server.Disconnect();
+        std::sort(all.begin(), all.end());
+
+        printf("  %3d clients  sent %6llu  echoed %6zu  server %6.0f msgs/s in+out  rtt us p50 %6.0f p99 %6.0f p99.9 %6.0f max %6.0f\n",
+            clientCount, (unsigned long long)sent, all.size(), handled * 2 / ms * 1000.0,
+            Percentile(all, 0.5), Percentile(all, 0.99), Percentile(all, 0.999), all.empty() ? 0.0 : all.back());
+    }
+}
+
+BENCH(net_load)
+{
+    for (int clients : { 8, 32, 64 }) RunLoad(clients);
+}
@@ -0,0 +1,75 @@
+#include "Bench.h"
+#include "PlayerPhysics.h"
+#include <cmath>
+#include <cstdio>
+
+// 64 players wandering over hilly voxel terrain at 120 Hz, turning and
+// jumping at random, the way a host steps everyone each tick. The fast run
+// moves them at 400 u/s, so every tick is swept in several sub-steps.
+namespace {
+    const int PLAYER_COUNT = 64;
+    const float DT = 1.0f / 120.0f;
+
+    void TimePlayers(const char* label, const VoxelWorld& world, float speed, int ticks)
+    {
+        PlayerPhysicsParams params;
+        params.gravity = 350.0f;
+        params.airAcceleration = 45.0f;
+        PhysicsBoxSource boxes = [&world](const PhysicsBox& region, std::vector<PhysicsBox>& out) {
+            CollectVoxelBoxes(world, region, out);
+        };
+
+        BenchRandom random(18);
+        std::vector<PlayerBody> players(PLAYER_COUNT);
+        std::vector<PlayerMove> moves(PLAYER_COUNT);
+        for (PlayerBody& body : players) {
+            body.position[0] = random.Range(-60, 60);
+            body.position[1] = 20.0f;
+            body.position[2] = random.Range(-60, 60);
+        }
+
+        uint64_t landings = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (int tick = 0; tick < ticks; ++tick) {
+            for (int i = 0; i < PLAYER_COUNT; ++i) {
+                PlayerBody& body = players[i];
+                PlayerMove& move = moves[i];
+                if ((random.Next() & 63) == 0 || move.speed == 0.0f) {
+                    float angle = random.Range(0, 6.2831853f);
+                    move.wishX = cosf(angle);
+                    move.wishZ = sinf(angle);
+                    move.speed = speed;
+                }
+                if (body.grounded && (random.Next() & 31) == 0) {
+                    body.velocity[1] = 40.0f;
+                    body.grounded = false;
+                }
+                // keep them on the terrain
+                if (fabsf(body.position[0]) > 60.0f) move.wishX = body.position[0] > 0 ? -fabsf(move.wishX) : fabsf(move.wishX);
+                if (fabsf(body.position[2]) > 60.0f) move.wishZ = body.position[2] > 0 ? -fabsf(move.wishZ) : fabsf(move.wishZ);
+                landings += StepPlayer(body, move, params, DT, boxes);
+            }
+        }
+        double ms = MillisecondsSince(start);
+        BenchKeep(landings);
+        double updates = (double)ticks * PLAYER_COUNT;
+        printf("  %-18s %10.0f updates/s %7.3f us/update %6.2f ms/tick for %d players\n", label,
+            updates / (ms / 1000.0), ms * 1000.0 / updates, ms / ticks, PLAYER_COUNT);
+    }
+}
+
+BENCH(player_physics)
+{
+    // rolling hills of 2 unit blocks over 128 x 128, up to 5 blocks high
+    VoxelWorld world;
+    for (int z = -64; z <= 64; z += 2) {
+        for (int x = -64; x <= 64; x += 2) {
+            int height = 1 + (int)(2.0f + 2.0f * sinf(x * 0.07f) * cosf(z * 0.05f));
+            for (int h = 0; h < height; ++h) world.SetBlock(x, 1 + 2 * h, z, 2);
+        }
+    }
+    printf("  terrain: %zu blocks\n", world.GetBlockCount());
+
+    TimePlayers("walking (15.6 u/s)", world, 50.0f / 3.2f, 1200);
+    TimePlayers("fast (400 u/s)", world, 400.0f, 600);
+}
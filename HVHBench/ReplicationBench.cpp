@@ -0,0 +1,95 @@
+#include "Bench.h"
+#include "Replication.h"
+#include <cmath>
+#include <cstdio>
+#include <deque>
+
+// Snapshot bandwidth for N players at the host's 30 Hz tick (NET_TICK_RATE):
+// half of them walk, a quarter only look around, the rest stand still. Every
+// client acks 3 ticks late (100 ms round trip) and loses 5% of snapshots.
+// Reported per client, with the old scheme for scale: every peer's POS text
+// line (~40 bytes) at 5 Hz, relayed to everyone.
+namespace {
+    const int TICK_RATE = 30;
+    const int SECONDS = 20;
+    const int ACK_DELAY_TICKS = 3;
+    const uint32_t LOSS_PERCENT = 5;
+
+    struct SimClient {
+        SnapshotClient client;
+        NetEntityMap world;
+        std::deque<std::pair<int, uint32_t>> pendingAcks;   // tick due, sequence
+        uint64_t bytes = 0;
+    };
+
+    void RunPlayers(int playerCount, bool acks)
+    {
+        BenchRandom random(playerCount);
+        SnapshotServer server;
+        std::vector<SimClient> clients(playerCount);
+        for (int i = 0; i < playerCount; ++i) server.AddClient(i);
+
+        NetEntityMap entities;
+        std::vector<float> heading(playerCount);
+        for (int i = 0; i < playerCount; ++i) heading[i] = random.Range(0, 6.28f);
+
+        bool consistent = true;
+        NetMessage snapshot;
+        const int ticks = TICK_RATE * SECONDS;
+        for (int tick = 0; tick < ticks; ++tick) {
+            for (int i = 0; i < playerCount; ++i) {
+                float t = tick / (float)TICK_RATE;
+                int kind = i % 4;   // 0, 1 walk, 2 looks around, 3 idle
+                float x = 10.0f * i, z = 0.0f, yaw = heading[i], pitch = 0.0f;
+                if (kind < 2) {
+                    x += 4.0f * t * cosf(heading[i]);
+                    z += 4.0f * t * sinf(heading[i]);
+                } else if (kind == 2) {
+                    yaw += sinf(t * 1.3f + i);
+                    pitch = 0.3f * sinf(t * 0.7f + i);
+                }
+                NetQuantizedState& q = entities[i];
+                q.x = NetQuantizePosition(x);
+                q.y = NetQuantizePosition(1.8f);
+                q.z = NetQuantizePosition(z);
+                q.yaw = NetQuantizeAngle(yaw);
+                q.pitch = NetQuantizeAngle(pitch);
+            }
+
+            server.BeginTick();
+            for (int i = 0; i < playerCount; ++i) {
+                SimClient& sim = clients[i];
+                while (!sim.pendingAcks.empty() && sim.pendingAcks.front().first <= tick) {
+                    server.Acknowledge(i, sim.pendingAcks.front().second);
+                    sim.pendingAcks.pop_front();
+                }
+                if (!server.BuildSnapshot(i, entities, snapshot)) continue;
+                sim.bytes += NetMessageSize(snapshot);
+                if (random.Next() % 100 < LOSS_PERCENT) continue;
+                if (sim.client.Apply(snapshot, sim.world) && acks) {
+                    sim.pendingAcks.push_back({ tick + ACK_DELAY_TICKS, snapshot.sequence });
+                }
+            }
+        }
+
+        // whatever was lost along the way, the last delivered state is whole
+        uint64_t total = 0;
+        for (SimClient& sim : clients) {
+            total += sim.bytes;
+            if (sim.world.size() != entities.size()) consistent = false;
+        }
+        double perClient = (double)total / playerCount / SECONDS;
+        double oldScheme = 40.0 * 5.0 * (playerCount - 1) * 2;   // sent up, relayed back down
+        printf("  %3d players %-9s %8.0f bytes/s per client  (%5.1f per entity per tick)  old POS relay ~%6.0f%s\n",
+            playerCount, acks ? "delta" : "no acks", perClient, perClient / TICK_RATE / playerCount, oldScheme,
+            consistent ? "" : "  CLIENT STATE INCOMPLETE");
+    }
+}
+
+BENCH(replication)
+{
+    for (int players : { 8, 32, 64 }) {
+        RunPlayers(players, true);
+        RunPlayers(players, false);
+    }
+}
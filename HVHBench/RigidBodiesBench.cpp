@@ -0,0 +1,74 @@
+#include "Bench.h"
+#include "RigidBodies.h"
+#include <cmath>
+#include <cstdio>
+#include <thread>
+
+// 10k balls and boxes dropped over voxel terrain and stepped at 120 Hz for
+// two seconds, so most of them are falling, bouncing or rolling the whole
+// time. The same scene runs on the calling thread and on 2, 4 and
+// hardware_concurrency threads; the end positions must match the
+// single-threaded run exactly, since bodies don't touch each other.
+namespace {
+    const int BODY_COUNT = 10000;
+    const int STEPS = 240;
+    const float DT = 1.0f / 120.0f;
+
+    double TimeSteps(const VoxelWorld& world, int threads, std::vector<float>& endPositions)
+    {
+        BenchRandom random(20);
+        RigidBodyWorld bodies;
+        bodies.SetThreadCount(threads);
+        for (int i = 0; i < BODY_COUNT; ++i) {
+            float position[3] = { random.Range(-60, 60), random.Range(15, 60), random.Range(-60, 60) };
+            if (i % 2 == 0) {
+                bodies.AddSphere(position, random.Range(0.3f, 1.0f), 9);
+            }
+            else {
+                float half[3] = { random.Range(0.3f, 1.0f), random.Range(0.3f, 1.0f), random.Range(0.3f, 1.0f) };
+                bodies.AddBox(position, half, 4);
+            }
+        }
+        PhysicsBoxSource boxes = [&world](const PhysicsBox& region, std::vector<PhysicsBox>& out) {
+            CollectVoxelBoxes(world, region, out);
+        };
+
+        size_t awakeSteps = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (int step = 0; step < STEPS; ++step) {
+            bodies.Step(DT, 350.0f, boxes);
+            awakeSteps += bodies.GetStats().awake;
+        }
+        double ms = MillisecondsSince(start);
+
+        endPositions.resize(bodies.GetCount() * 3);
+        for (size_t i = 0; i < bodies.GetCount(); ++i) bodies.GetPosition(i, &endPositions[i * 3]);
+        printf("  %2d thread(s) %8.3f ms/step %10.0f body updates/s, %5.0f awake on average\n",
+            threads, ms / STEPS, awakeSteps / (ms / 1000.0), (double)awakeSteps / STEPS);
+        return ms;
+    }
+}
+
+BENCH(rigid_bodies)
+{
+    VoxelWorld world;
+    for (int z = -64; z <= 64; z += 2) {
+        for (int x = -64; x <= 64; x += 2) {
+            int height = 1 + (int)(2.0f + 2.0f * sinf(x * 0.07f) * cosf(z * 0.05f));
+            for (int h = 0; h < height; ++h) world.SetBlock(x, 1 + 2 * h, z, 2);
+        }
+    }
+    unsigned hardware = std::thread::hardware_concurrency();
+    printf("  %d bodies over %zu blocks, %d steps, %u hardware threads\n", BODY_COUNT, world.GetBlockCount(), STEPS,
+        hardware);
+
+    std::vector<float> single, threaded;
+    double singleMs = TimeSteps(world, 1, single);
+    std::vector<int> counts = { 2, 4 };
+    if (hardware > 4) counts.push_back((int)hardware);
+    for (int threads : counts) {
+        double ms = TimeSteps(world, threads, threaded);
+        printf("     %.2fx the single-threaded speed, %s\n", singleMs / ms,
+            threaded == single ? "same end positions" : "END POSITIONS DIFFER");
+    }
+}
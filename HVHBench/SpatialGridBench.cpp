@@ -0,0 +1,93 @@
+#include "Bench.h"
+#include "SpatialGrid.h"
+#include <cstdio>
+
+// 100k map objects scattered over a 400 x 40 x 400 world, queried the ways
+// GameEngine does: the player's collision box, a placement probe and a pick
+// segment. The linear scan is what every query cost before the grid.
+namespace {
+    struct Object { float x, y, z, halfExtent; };
+
+    const int OBJECT_COUNT = 100000;
+    const int QUERY_COUNT = 200000;
+
+    size_t LinearScan(const std::vector<Object>& objects, float minX, float minY, float minZ,
+        float maxX, float maxY, float maxZ)
+    {
+        size_t hits = 0;
+        for (const Object& o : objects) {
+            if (o.x + o.halfExtent >= minX && o.x - o.halfExtent <= maxX &&
+                o.y + o.halfExtent >= minY && o.y - o.halfExtent <= maxY &&
+                o.z + o.halfExtent >= minZ && o.z - o.halfExtent <= maxZ) ++hits;
+        }
+        return hits;
+    }
+
+    void TimeQueries(const char* label, const SpatialGrid& grid, float radius, uint32_t seed, int count = QUERY_COUNT)
+    {
+        BenchRandom random(seed);
+        std::vector<uint32_t> found;
+        size_t candidates = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (int q = 0; q < count; ++q) {
+            float x = random.Range(-200, 200), y = random.Range(-20, 20), z = random.Range(-200, 200);
+            found.clear();
+            grid.QueryBox(x - radius, y - radius, z - radius, x + radius, y + radius, z + radius, found);
+            candidates += found.size();
+        }
+        double ms = MillisecondsSince(start);
+        BenchKeep(candidates);
+        printf("  %-28s %8.1f ns/query, %.2f candidates/query\n", label, ms * 1e6 / count,
+            (double)candidates / count);
+    }
+}
+
+BENCH(spatial_grid)
+{
+    BenchRandom random(1);
+    std::vector<Object> objects(OBJECT_COUNT);
+    SpatialGrid grid(4.0f);
+    auto start = std::chrono::steady_clock::now();
+    for (uint32_t i = 0; i < OBJECT_COUNT; ++i) {
+        Object& o = objects[i];
+        o = { random.Range(-200, 200), random.Range(-20, 20), random.Range(-200, 200), random.Range(0.5f, 2.0f) };
+        grid.Insert(i, o.x, o.y, o.z, o.halfExtent);
+    }
+    printf("  insert %d objects            %8.2f ms, %zu cells\n", OBJECT_COUNT, MillisecondsSince(start), grid.GetCellCount());
+
+    TimeQueries("player box (+-1)", grid, 1.0f, 2);
+    TimeQueries("placement probe (+-0.1)", grid, 0.1f, 3);
+
+    BenchRandom rayRandom(4);
+    std::vector<uint32_t> found;
+    size_t candidates = 0;
+    start = std::chrono::steady_clock::now();
+    for (int q = 0; q < QUERY_COUNT; ++q) {
+        float x = rayRandom.Range(-200, 200), y = rayRandom.Range(-20, 20), z = rayRandom.Range(-200, 200);
+        found.clear();
+        grid.QuerySegment(x, y, z, 0.6f, -0.48f, 0.64f, 10.0f, found);
+        candidates += found.size();
+    }
+    double ms = MillisecondsSince(start);
+    BenchKeep(candidates);
+    printf("  %-28s %8.1f ns/query, %.2f candidates/query\n", "pick segment (10 units)", ms * 1e6 / QUERY_COUNT,
+        (double)candidates / QUERY_COUNT);
+
+    // one huge object widens every query while it exists, not after
+    grid.Insert(OBJECT_COUNT, 0.0f, 0.0f, 0.0f, 64.0f);
+    TimeQueries("player box, 64 unit object", grid, 1.0f, 2, 200);
+    grid.Remove(OBJECT_COUNT, 0.0f, 0.0f, 0.0f);
+    TimeQueries("player box, object removed", grid, 1.0f, 2);
+
+    const int scanCount = 200;
+    BenchRandom scanRandom(2);
+    size_t hits = 0;
+    start = std::chrono::steady_clock::now();
+    for (int q = 0; q < scanCount; ++q) {
+        float x = scanRandom.Range(-200, 200), y = scanRandom.Range(-20, 20), z = scanRandom.Range(-200, 200);
+        hits += LinearScan(objects, x - 1, y - 1, z - 1, x + 1, y + 1, z + 1);
+    }
+    ms = MillisecondsSince(start);
+    BenchKeep(hits);
+    printf("  %-28s %8.1f ns/query\n", "linear scan, player box", ms * 1e6 / scanCount);
+}
@@ -0,0 +1,108 @@
+#include "Bench.h"
+#include "VoxelRaycast.h"
+#include <cmath>
+#include <cstdio>
+
+// Rays from a player's eye over a 256 x 256 hilly terrain: build picks
+// (GameEngine's 5 unit reach), long sight lines that mostly hit the ground,
+// and rays aimed at the sky that walk their whole length. The linear scan is the
+// per-block RayEntersBox loop picking did before the cell walk.
+namespace {
+    const float EXTENT = 128.0f;
+
+    // blocks stacked on the column at lattice x, z
+    int ColumnHeight(int x, int z)
+    {
+        return 1 + (int)(2.5f + 2.5f * sinf(x * 0.05f) * cosf(z * 0.04f));
+    }
+
+    struct RayCase {
+        const char* label;
+        float maxDist;
+        float minPitch, maxPitch;   // radians, 0 is level
+    };
+
+    void RandomRay(BenchRandom& random, const RayCase& rays, float origin[3], float dir[3])
+    {
+        origin[0] = random.Range(-EXTENT * 0.8f, EXTENT * 0.8f);
+        origin[2] = random.Range(-EXTENT * 0.8f, EXTENT * 0.8f);
+        // eye height above the column under it
+        int column[2] = { 2 * (int)floorf(origin[0] * 0.5f + 0.5f), 2 * (int)floorf(origin[2] * 0.5f + 0.5f) };
+        origin[1] = 2.0f * ColumnHeight(column[0], column[1]) + 1.6f;
+        float yaw = random.Range(0, 6.2831853f), pitch = random.Range(rays.minPitch, rays.maxPitch);
+        dir[0] = cosf(pitch) * cosf(yaw);
+        dir[1] = sinf(pitch);
+        dir[2] = cosf(pitch) * sinf(yaw);
+    }
+
+    void TimeRays(const VoxelWorld& world, const RayCase& rays, int count)
+    {
+        BenchRandom random(19);
+        uint64_t hits = 0;
+        double distance = 0.0;
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < count; ++i) {
+            float origin[3], dir[3];
+            RandomRay(random, rays, origin, dir);
+            VoxelRayHit hit;
+            if (RaycastVoxels(world, origin, dir, rays.maxDist, hit, true)) {
+                ++hits;
+                distance += hit.t;
+            }
+            else {
+                distance += rays.maxDist;
+            }
+        }
+        double ms = MillisecondsSince(start);
+        BenchKeep(hits);
+        printf("  %-22s %10.0f rays/s %8.3f us/ray %5.1f%% hit, %5.1f units walked/ray\n", rays.label,
+            count / (ms / 1000.0), ms * 1000.0 / count, 100.0 * hits / count, distance / count);
+    }
+
+    void TimeLinearScan(const std::vector<int>& blocks, const RayCase& rays, int count)
+    {
+        BenchRandom random(19);
+        uint64_t hits = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < count; ++i) {
+            float origin[3], dir[3];
+            RandomRay(random, rays, origin, dir);
+            float best = rays.maxDist;
+            for (size_t b = 0; b < blocks.size(); b += 3) {
+                float boxMin[3] = { blocks[b] - 1.0f, blocks[b + 1] - 1.0f, blocks[b + 2] - 1.0f };
+                float boxMax[3] = { blocks[b] + 1.0f, blocks[b + 1] + 1.0f, blocks[b + 2] + 1.0f };
+                float t;
+                int axis, sign;
+                if (RayEntersBox(origin, dir, boxMin, boxMax, t, axis, sign) && t < best) best = t;
+            }
+            hits += best < rays.maxDist;
+        }
+        double ms = MillisecondsSince(start);
+        BenchKeep(hits);
+        printf("  %-22s %10.0f rays/s %8.3f us/ray (linear scan)\n", rays.label, count / (ms / 1000.0),
+            ms * 1000.0 / count);
+    }
+}
+
+BENCH(voxel_raycast)
+{
+    VoxelWorld world;
+    std::vector<int> blocks;
+    for (int z = -(int)EXTENT; z <= (int)EXTENT; z += 2) {
+        for (int x = -(int)EXTENT; x <= (int)EXTENT; x += 2) {
+            for (int h = 0; h < ColumnHeight(x, z); ++h) {
+                world.SetBlock(x, 1 + 2 * h, z, 2);
+                blocks.insert(blocks.end(), { x, 1 + 2 * h, z });
+            }
+        }
+    }
+    printf("  terrain: %zu blocks\n", world.GetBlockCount());
+
+    const RayCase picks = { "build pick (5)", 5.0f, -1.4f, 0.3f };
+    const RayCase sight = { "sight line (100)", 100.0f, -0.6f, 0.0f };
+    const RayCase sky = { "sky miss (100)", 100.0f, 0.4f, 1.5f };
+    TimeRays(world, picks, 1000000);
+    TimeRays(world, sight, 200000);
+    TimeRays(world, sky, 200000);
+    TimeLinearScan(blocks, picks, 200);
+}
@@ -0,0 +1,113 @@
+#include "Bench.h"
+#include "WorldTransfer.h"
+#include "NetworkManager.h"
+#include <atomic>
+#include <cmath>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+
+// Join-time world sync over loopback: a host with a 10k or 100k block map,
+// one client joining. The host pumps WorldTransferServer on its 120 Hz tick
+// like HostSession does; the client applies batches and acks them. Reports
+// time to playable (every chunk around spawn arrived) and to the last chunk.
+namespace {
+    const int BENCH_PORT = 27118;
+    const int TICK_US = 1000000 / 120;
+
+    // rolling terrain around the origin, 4 layers deep
+    void BuildMap(VoxelWorld& world, size_t blockCount)
+    {
+        int half = (int)(sqrt(blockCount / 4.0) * 0.5);
+        for (int x = -half; x < half; ++x) {
+            for (int z = -half; z < half; ++z) {
+                int top = (int)(3.0 * sin(x * 0.11) * cos(z * 0.07));
+                for (int y = top - 3; y <= top; ++y) {
+                    world.SetBlock(x, y, z, (BlockId)(y == top ? 1 : 2 + (x & 1)));
+                }
+            }
+        }
+    }
+
+    void RunJoin(size_t blockCount)
+    {
+        VoxelWorld hostWorld;
+        BuildMap(hostWorld, blockCount);
+
+        NetworkManager server, client;
+        std::mutex transferMutex;
+        WorldTransferServer transfers;
+        server.Initialize();
+        server.SetDataReceivedCallback([&](const NetMessage& msg, int clientId) {
+            std::lock_guard<std::mutex> lock(transferMutex);
+            if (msg.type == NetMessageType::Join) {
+                uint32_t chunks = transfers.Begin(clientId, hostWorld, 0, 0);
+                server.SendToClient(clientId, NetMessage::WorldBegin(chunks));
+            }
+            else if (msg.type == NetMessageType::WorldAck) {
+                transfers.Acknowledge(clientId, msg.sequence);
+            }
+        });
+
+        // the client side only runs on the client's I/O thread
+        VoxelWorld clientWorld;
+        WorldTransferClient receiver;
+        std::atomic<bool> playable{ false }, done{ false }, failed{ false };
+        std::atomic<uint64_t> bytes{ 0 };
+        std::chrono::steady_clock::time_point start, playableAt, doneAt;
+        client.SetDataReceivedCallback([&](const NetMessage& msg, int) {
+            if (msg.type == NetMessageType::WorldBegin) {
+                receiver.Begin(msg.count);
+            }
+            else if (msg.type == NetMessageType::WorldBatch) {
+                bytes += NetMessageSize(msg);
+                if (!receiver.Apply(msg, clientWorld)) failed = true;
+                client.SendData(NetMessage::WorldAck(msg.sequence));
+            }
+            else {
+                return;
+            }
+            if (!playable && receiver.IsSpawnReady()) {
+                playableAt = std::chrono::steady_clock::now();
+                playable = true;
+            }
+            if (receiver.GetChunksReceived() == receiver.GetChunkCount()) {
+                doneAt = std::chrono::steady_clock::now();
+                done = true;
+            }
+        });
+
+        if (!server.StartServer(BENCH_PORT) || !client.ConnectToServer("127.0.0.1", BENCH_PORT)) {
+            printf("  can't open port %d\n", BENCH_PORT);
+            return;
+        }
+        start = std::chrono::steady_clock::now();
+        client.SendData(NetMessage::Simple(NetMessageType::Join));
+
+        auto tick = start;
+        NetMessage batch;
+        while (!done && !failed && MillisecondsSince(start) < 60000.0) {
+            tick += std::chrono::microseconds(TICK_US);
+            std::this_thread::sleep_until(tick);
+            std::lock_guard<std::mutex> lock(transferMutex);
+            for (int id : transfers.GetClients()) {
+                while (transfers.NextBatch(id, hostWorld, batch)) server.SendToClient(id, batch);
+            }
+        }
+        client.Disconnect();
+        server.Disconnect();
+
+        double playableMs = std::chrono::duration<double, std::milli>(playableAt - start).count();
+        double doneMs = std::chrono::duration<double, std::milli>(doneAt - start).count();
+        bool same = clientWorld.GetBlockCount() == hostWorld.GetBlockCount();
+        printf("  %7zu blocks  %4u chunks  %8llu bytes  playable %7.1f ms  complete %7.1f ms%s\n",
+            hostWorld.GetBlockCount(), receiver.GetChunkCount(), (unsigned long long)bytes.load(),
+            playableMs, doneMs, failed ? "  BAD BATCH" : same ? "" : "  BLOCK COUNT MISMATCH");
+    }
+}
+
+BENCH(world_transfer)
+{
+    RunJoin(10000);
+    RunJoin(100000);
+}
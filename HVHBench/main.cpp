@@ -0,0 +1,40 @@
+#include "Bench.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+// Usage: hvh-bench [--list] [name ...]
+std::vector<BenchCase>& BenchRegistry()
+{
+    static std::vector<BenchCase> registry;
+    return registry;
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<BenchCase> cases = BenchRegistry();
+    std::sort(cases.begin(), cases.end(),
+        [](const BenchCase& a, const BenchCase& b) { return strcmp(a.name, b.name) < 0; });
+
+    if (argc > 1 && std::string(argv[1]) == "--list") {
+        for (const BenchCase& c : cases) printf("%s\n", c.name);
+        return 0;
+    }
+
+    int ran = 0;
+    for (const BenchCase& c : cases) {
+        bool wanted = argc < 2;
+        for (int i = 1; i < argc && !wanted; ++i) wanted = strcmp(argv[i], c.name) == 0;
+        if (!wanted) continue;
+        printf("== %s\n", c.name);
+        fflush(stdout);
+        c.run();
+        ++ran;
+    }
+    if (ran == 0) {
+        fprintf(stderr, "No benchmark by that name, see --list\n");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,188 @@
+#include "DedicatedServer.h"
+#include <algorithm>
+#include <filesystem>
+#include <iostream>
+#include <sstream>
+
+DedicatedServer::DedicatedServer()
+    : consoleInput(std::make_shared<MpscQueue<std::string>>())
+{
+    store.SetLog([this](const std::string& text) { Log(text); });
+    // clients are sent the new map, the same way a joining one gets it
+    store.SetReplacedCallback([this]() { hostSession.RestartWorldTransfers(); });
+    hostSession.SetWorld(store.MakeHostWorld());
+    hostSession.SetLog([this](const std::string& text) { Log(text); });
+
+    RegisterCommands();
+}
+
+DedicatedServer::~DedicatedServer()
+{
+    // a clean shutdown has nothing to recover
+    store.GetJournal().Discard();
+}
+
+void DedicatedServer::Log(const std::string& text)
+{
+    std::cout << text << std::endl;
+}
+
+bool DedicatedServer::Start(int serverPort, const std::string& map)
+{
+    port = serverPort;
+    // per port, so sessions sharing a box don't write over each other
+    std::string prefix = "server-" + std::to_string(port);
+    store.SetFiles({ prefix + ".hvhj", prefix + ".hvhm", prefix + "-autosave.hvhm" });
+
+    std::string mapDir = ParkourMap::GetMapPath("");
+    std::error_code error;
+    if (!mapDir.empty()) std::filesystem::create_directories(mapDir, error);
+
+    if (!networkManager.Initialize()) return false;
+    networkManager.SetDataReceivedCallback([this](const NetMessage& msg, int clientId) {
+        // runs on the network thread, everything else happens in Tick
+        InboundMessage inbound;
+        inbound.msg = msg;
+        inbound.clientId = clientId;
+        inboundMessages.Push(std::move(inbound));
+        });
+    if (!networkManager.StartServer(port)) return false;
+    hostSession.Reset();
+
+    if (map.empty()) {
+        for (const auto& obj : ParkourMap::CreateParkourCourse()) store.AddObject(obj);
+        for (const auto& obj : ParkourMap::CreateParkourBalls()) store.AddObject(obj);
+        Log("Built-in course, " + std::to_string(store.GetBlockCount()) + " blocks");
+    }
+    store.Recover();
+    // players can join meanwhile, they get the map once it's swapped in
+    if (!map.empty() && store.StartLoad(map)) {
+        Log("Loading map from " + ParkourMap::GetMapPath(map) + "...");
+    }
+
+    // stdin is read on its own thread; without a terminal it just ends
+    std::shared_ptr<MpscQueue<std::string>> input = consoleInput;
+    std::thread([input]() {
+        std::string line;
+        while (std::getline(std::cin, line)) input->Push(line);
+        }).detach();
+
+    tickStats.windowStart = std::chrono::steady_clock::now();
+    Log("Dedicated server on port " + std::to_string(port) + ", " +
+        std::to_string((int)NET_TICK_RATE) + " ticks/s, type help for commands");
+    return true;
+}
+
+void DedicatedServer::Run()
+{
+    running = true;
+    timestep.Reset();
+    auto last = std::chrono::steady_clock::now();
+    while (running) {
+        auto now = std::chrono::steady_clock::now();
+        int ticks = timestep.Advance(std::chrono::duration<double>(now - last).count());
+        last = now;
+        for (int i = 0; i < ticks && running; ++i) {
+            Tick();
+        }
+
+        // nothing to render between ticks, sleep until the next one is due
+        double wait = (1.0 - timestep.GetAlpha()) * timestep.GetTickSeconds();
+        std::this_thread::sleep_for(std::chrono::duration<double>(wait));
+    }
+}
+
+void DedicatedServer::Tick()
+{
+    auto start = std::chrono::steady_clock::now();
+
+    std::string line;
+    while (consoleInput->Pop(line)) {
+        ProcessCommand(line);
+    }
+
+    // same cap as the game, a flood is spread over several ticks
+    const size_t maxMessagesPerTick = 256;
+    size_t processed = 0;
+    InboundMessage inbound;
+    while (processed < maxMessagesPerTick && inboundMessages.Pop(inbound)) {
+        // whatever HostSession leaves is meant for clients, not for a host
+        hostSession.HandleMessage(inbound.msg, inbound.clientId);
+        processed++;
+    }
+
+    store.Update();
+    hostSession.PumpWorldTransfers();
+    hostSession.SendSnapshots(NetEntityMap());
+    networkManager.Update((float)timestep.GetTickSeconds());
+
+    float ms = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+    tickStats.ticks++;
+    tickStats.lastMs = ms;
+    tickStats.windowTicks++;
+    tickStats.windowMs += ms;
+    tickStats.windowMaxMs = (std::max)(tickStats.windowMaxMs, ms);
+    tickStats.windowMessages += processed;
+    if (start - tickStats.windowStart >= std::chrono::seconds(1)) {
+        tickStats.avgMs = tickStats.windowMs / tickStats.windowTicks;
+        tickStats.maxMs = tickStats.windowMaxMs;
+        tickStats.messages = tickStats.windowMessages;
+        tickStats.windowTicks = 0;
+        tickStats.windowMs = 0.0f;
+        tickStats.windowMaxMs = 0.0f;
+        tickStats.windowMessages = 0;
+        tickStats.windowStart = start;
+    }
+}
+
+void DedicatedServer::ProcessCommand(const std::string& command)
+{
+    std::vector<std::string> args;
+    std::istringstream iss(command);
+    std::string arg;
+
+    while (iss >> arg) {
+        args.push_back(arg);
+    }
+
+    if (args.empty()) return;
+
+    auto it = commands.find(args[0]);
+    if (it != commands.end()) {
+        it->second(args);
+    }
+    else {
+        Log("Unknown command: " + args[0]);
+    }
+}
+
+void DedicatedServer::RegisterCommands()
+{
+    // the game's client-only commands drive a camera and a renderer, the
+    // shared ones are all that's left without them
+    HostConsole console;
+    console.store = &store;
+    console.session = &hostSession;
+    console.isHosting = []() { return true; };
+    console.log = [this](const std::string& text) { Log(text); };
+    RegisterHostCommands(commands, console);
+
+    commands["help"] = [this](const auto&) {
+        Log("Commands: status, players, netstats, save <file>, load <file>, autosave <minutes>, clear, quit");
+        };
+    commands["status"] = [this](const auto&) {
+        Log("Port " + std::to_string(port) + ", " + std::to_string(hostSession.GetPlayers().size()) +
+            " players, " + std::to_string(store.GetBlockCount()) + " blocks (" +
+            std::to_string(store.GetVoxels().GetChunkCount()) + " chunks, " +
+            std::to_string(store.GetObjects().size()) + " sparse objects)");
+        Log("Tick: " + std::to_string(tickStats.ticks) + " at " + std::to_string((int)NET_TICK_RATE) +
+            " Hz, avg " + std::to_string(tickStats.avgMs) + " ms, max " + std::to_string(tickStats.maxMs) +
+            " ms, " + std::to_string(tickStats.messages) + " msgs/s, dropped " +
+            std::to_string(timestep.GetDroppedSeconds()) + " s");
+        Log("Inbound queue: " + std::to_string(inboundMessages.ApproxSize()) + " waiting");
+        };
+    commands["quit"] = [this](const auto&) {
+        Log("Shutting down");
+        Stop();
+        };
+}
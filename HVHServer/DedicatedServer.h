@@ -0,0 +1,74 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "NetworkManager.h"
+#include "HostSession.h"
+#include "HostCommands.h"
+#include "MpscQueue.h"
+#include "WorldStore.h"
+#include "GameLoop.h"
+#include "map1.h"
+
+// A host without a window: the world, a HostSession and a console read from
+// stdin, ticked at the snapshot rate. Players aren't simulated here any more
+// than on an in-game host, their reported moves are bounded and relayed.
+class DedicatedServer
+{
+public:
+    DedicatedServer();
+    ~DedicatedServer();
+
+    // Binds the port and builds the world: map if given, else the built-in course.
+    bool Start(int port, const std::string& map);
+    // Until Stop or the quit command.
+    void Run();
+    void Stop() { running = false; }
+
+    void ProcessCommand(const std::string& command);
+
+private:
+    struct InboundMessage {
+        NetMessage msg;
+        int clientId = 0;
+    };
+
+    // wall-clock cost of the tick, what hosting more sessions per box comes down to
+    struct TickStats {
+        size_t ticks = 0;
+        float lastMs = 0.0f;
+        float avgMs = 0.0f;     // over the last full second
+        float maxMs = 0.0f;
+        size_t messages = 0;    // handled in that second
+        size_t windowTicks = 0;
+        float windowMs = 0.0f;
+        float windowMaxMs = 0.0f;
+        size_t windowMessages = 0;
+        std::chrono::steady_clock::time_point windowStart;
+    };
+
+    void Tick();
+    // the shared host commands plus status and quit
+    void RegisterCommands();
+    void Log(const std::string& text);
+
+    NetworkManager networkManager;
+    HostSession hostSession{ networkManager };
+    MpscQueue<InboundMessage> inboundMessages;
+    // shared with the stdin reader, which is left blocked in getline at exit
+    std::shared_ptr<MpscQueue<std::string>> consoleInput;
+    std::atomic<bool> running{ false };
+    int port = 27015;
+
+    // the same map, journal and saves as an in-game host
+    WorldStore store;
+
+    FixedTimestep timestep{ (int)NET_TICK_RATE };
+    TickStats tickStats;
+
+    ConsoleCommands commands;
+};
@@ -0,0 +1,40 @@
+#include "DedicatedServer.h"
+#include <csignal>
+#include <iostream>
+#include <string>
+
+// Usage: HVHServer [port] [map file under HVHproject]
+static DedicatedServer* g_Server = nullptr;
+
+static void OnSignal(int)
+{
+    // running is a lock-free atomic, storing to it is safe here
+    if (g_Server) g_Server->Stop();
+}
+
+int main(int argc, char* argv[])
+{
+    int port = 27015;
+    std::string map;
+    if (argc > 1) {
+        try { port = std::stoi(argv[1]); }
+        catch (...) {
+            std::cerr << "Usage: " << argv[0] << " [port] [map]" << std::endl;
+            return 1;
+        }
+    }
+    if (argc > 2) map = argv[2];
+
+    DedicatedServer server;
+    if (!server.Start(port, map)) {
+        std::cerr << "Can't start the server on port " << port << std::endl;
+        return 1;
+    }
+
+    g_Server = &server;
+    std::signal(SIGINT, OnSignal);
+    std::signal(SIGTERM, OnSignal);
+    server.Run();
+    g_Server = nullptr;
+    return 0;
+}
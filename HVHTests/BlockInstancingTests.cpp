@@ -0,0 +1,105 @@
+#include "Test.h"
+#include "BlockInstancing.h"
+#include <cstring>
+#include <map>
+#include <tuple>
+
+namespace {
+    typedef float Matrix[4][4];
+
+    void Multiply(const Matrix a, const Matrix b, Matrix out)
+    {
+        for (int i = 0; i < 4; ++i) {
+            for (int j = 0; j < 4; ++j) {
+                out[i][j] = 0.0f;
+                for (int k = 0; k < 4; ++k) out[i][j] += a[i][k] * b[k][j];
+            }
+        }
+    }
+
+    // XMMatrixScaling * XMMatrixRotationRollPitchYaw * XMMatrixTranslation,
+    // spelled out for row vectors the way DirectXMath builds them
+    void ReferenceTransform(const InstanceObject& obj, Matrix out)
+    {
+        float cp = cosf(obj.rotation[0]), sp = sinf(obj.rotation[0]);
+        float cy = cosf(obj.rotation[1]), sy = sinf(obj.rotation[1]);
+        float cr = cosf(obj.rotation[2]), sr = sinf(obj.rotation[2]);
+        Matrix scale = { { obj.scale[0], 0, 0, 0 }, { 0, obj.scale[1], 0, 0 }, { 0, 0, obj.scale[2], 0 }, { 0, 0, 0, 1 } };
+        Matrix roll = { { cr, sr, 0, 0 }, { -sr, cr, 0, 0 }, { 0, 0, 1, 0 }, { 0, 0, 0, 1 } };
+        Matrix pitch = { { 1, 0, 0, 0 }, { 0, cp, sp, 0 }, { 0, -sp, cp, 0 }, { 0, 0, 0, 1 } };
+        Matrix yaw = { { cy, 0, -sy, 0 }, { 0, 1, 0, 0 }, { sy, 0, cy, 0 }, { 0, 0, 0, 1 } };
+        Matrix move = { { 1, 0, 0, 0 }, { 0, 1, 0, 0 }, { 0, 0, 1, 0 }, { obj.position[0], obj.position[1], obj.position[2], 1 } };
+        Matrix a, b, c;
+        Multiply(scale, roll, a);
+        Multiply(a, pitch, b);
+        Multiply(b, yaw, c);
+        Multiply(c, move, out);
+    }
+}
+
+TEST(BlockInstancing_ObjectTransformsMatchDirectXOrder)
+{
+    TestRandom random(11);
+    std::vector<InstanceObject> objects(200);
+    for (InstanceObject& obj : objects) {
+        for (int i = 0; i < 3; ++i) {
+            obj.position[i] = random.Range(-100, 100);
+            obj.rotation[i] = random.Range(-3.2f, 3.2f);
+            obj.scale[i] = random.Range(0.1f, 8.0f);
+        }
+        obj.block = (BlockId)random.Int(1, 9);
+    }
+
+    InstanceList list;
+    BuildInstanceList(nullptr, objects.data(), objects.size(), list);
+    REQUIRE(list.instances.size() == objects.size());
+    for (size_t n = 0; n < objects.size(); ++n) {
+        Matrix expected;
+        ReferenceTransform(objects[n], expected);
+        for (int i = 0; i < 4; ++i) {
+            for (int j = 0; j < 4; ++j) CHECK_NEAR(list.instances[n].row[i][j], expected[i][j], 1e-4);
+        }
+        CHECK(list.instances[n].layer == (uint32_t)BlockRegistry::Get(objects[n].block).texture);
+    }
+}
+
+TEST(BlockInstancing_VoxelsThenObjects)
+{
+    VoxelWorld world;
+    std::map<std::tuple<int, int, int>, BlockId> placed;
+    TestRandom random(5);
+    for (int i = 0; i < 3000; ++i) {
+        int x = random.Int(-40, 40), y = random.Int(-5, 20), z = random.Int(-40, 40);
+        BlockId id = (BlockId)random.Int(1, 9);
+        world.SetBlock(x, y, z, id);
+        placed[std::make_tuple(x, y, z)] = id;
+    }
+    InstanceObject obj = { { 0.5f, 2.25f, -3.0f }, { 0, 0, 0 }, { 2, 1, 1 }, 3 };
+
+    InstanceList list;
+    BuildInstanceList(&world, &obj, 1, list);
+    REQUIRE(list.instances.size() == placed.size() + 1);
+
+    // every voxel exactly once, a pure translation with its block's texture
+    std::map<std::tuple<int, int, int>, int> seen;
+    for (size_t n = 0; n + 1 < list.instances.size(); ++n) {
+        const BlockInstance& inst = list.instances[n];
+        CHECK(inst.row[0][0] == 1.0f && inst.row[1][1] == 1.0f && inst.row[2][2] == 1.0f && inst.row[3][3] == 1.0f);
+        CHECK(inst.row[0][1] == 0.0f && inst.row[1][2] == 0.0f && inst.row[2][0] == 0.0f);
+        auto key = std::make_tuple((int)inst.row[3][0], (int)inst.row[3][1], (int)inst.row[3][2]);
+        auto it = placed.find(key);
+        REQUIRE(it != placed.end());
+        CHECK(inst.layer == (uint32_t)BlockRegistry::Get(it->second).texture);
+        seen[key]++;
+    }
+    CHECK(seen.size() == placed.size());
+
+    const BlockInstance& last = list.instances.back();
+    CHECK(last.row[0][0] == 2.0f && last.row[3][0] == 0.5f && last.row[3][1] == 2.25f && last.row[3][2] == -3.0f);
+
+    // rebuilding into the same list with fewer instances shrinks it
+    BuildInstanceList(nullptr, &obj, 1, list);
+    CHECK(list.instances.size() == 1);
+    BuildInstanceList(nullptr, nullptr, 0, list);
+    CHECK(list.instances.empty());
+}
@@ -0,0 +1,136 @@
+#include "Test.h"
+#include "ChunkMesher.h"
+#include <algorithm>
+
+namespace {
+    const BlockId STONE = 2;
+    const BlockId WOOD = 3;
+
+    ChunkMesh Mesh(const VoxelWorld& world, bool greedy, int cx = 0, int cy = 0, int cz = 0)
+    {
+        ChunkMesh mesh;
+        BuildChunkMesh(world, cx, cy, cz, greedy, mesh);
+        return mesh;
+    }
+
+    // summed quad area (in block faces, 2x2 units each) for one normal
+    float FaceArea(const ChunkMesh& mesh, int axis, float sign)
+    {
+        float area = 0.0f;
+        for (size_t i = 0; i < mesh.vertices.size(); i += 4) {
+            const MeshVertex* v = &mesh.vertices[i];
+            if (v[0].normal[axis] != sign) continue;
+            float e[3];
+            for (int a = 0; a < 3; ++a) {
+                float lo = v[0].position[a], hi = v[0].position[a];
+                for (int c = 1; c < 4; ++c) {
+                    lo = std::min(lo, v[c].position[a]);
+                    hi = std::max(hi, v[c].position[a]);
+                }
+                e[a] = hi - lo;
+            }
+            e[axis] = 1.0f;
+            area += e[0] * e[1] * e[2] / 4.0f;
+        }
+        return area;
+    }
+}
+
+TEST(ChunkMesher_SingleBlockHasSixFaces)
+{
+    VoxelWorld world;
+    world.SetBlock(4, 5, 6, STONE);
+    ChunkMesh mesh = Mesh(world, false);
+    CHECK(mesh.exposedFaces == 6);
+    CHECK(mesh.quads == 6);
+    CHECK(mesh.vertices.size() == 24);
+    CHECK(mesh.indices.size() == 36);
+    for (const MeshVertex& v : mesh.vertices) {
+        CHECK(v.layer == (uint32_t)BlockTexture::Stone);
+    }
+    CHECK(FaceArea(mesh, 1, 1.0f) == 1.0f);
+}
+
+TEST(ChunkMesher_NeighboursOneAndTwoCellsAwayHideFaces)
+{
+    // blocks span +-1, so neighbours 1 or 2 cells away overlap or touch
+    for (int gap = 1; gap <= 3; ++gap) {
+        for (int axis = 0; axis < 3; ++axis) {
+            VoxelWorld world;
+            int p[3] = { 6, 6, 6 };
+            world.SetBlock(p[0], p[1], p[2], STONE);
+            p[axis] += gap;
+            world.SetBlock(p[0], p[1], p[2], STONE);
+            ChunkMesh mesh = Mesh(world, false);
+            CHECK(mesh.exposedFaces == (gap <= 2 ? 10u : 12u));
+            CHECK(FaceArea(mesh, axis, 1.0f) == (gap <= 2 ? 1.0f : 2.0f));
+            CHECK(FaceArea(mesh, axis, -1.0f) == (gap <= 2 ? 1.0f : 2.0f));
+        }
+    }
+}
+
+TEST(ChunkMesher_NeighboursInTheNextChunkHideFaces)
+{
+    VoxelWorld world;
+    world.SetBlock(VOXEL_CHUNK_SIZE - 1, 0, 0, STONE);
+    world.SetBlock(VOXEL_CHUNK_SIZE + 1, 0, 0, STONE);   // 2 cells away, other chunk
+    CHECK(Mesh(world, false, 0).exposedFaces == 5);
+    CHECK(Mesh(world, false, 1).exposedFaces == 5);
+    CHECK(Mesh(world, false, 2).exposedFaces == 0);
+}
+
+TEST(ChunkMesher_GreedyMergesAtStrideTwo)
+{
+    // a floor of blocks on even cells tiles exactly: one quad per side
+    VoxelWorld world;
+    for (int x = 0; x < VOXEL_CHUNK_SIZE; x += 2) {
+        for (int z = 0; z < VOXEL_CHUNK_SIZE; z += 2) world.SetBlock(x, 0, z, STONE);
+    }
+    ChunkMesh plain = Mesh(world, false);
+    ChunkMesh greedy = Mesh(world, true);
+    CHECK(plain.exposedFaces == 64 + 64 + 4 * 8);
+    CHECK(plain.quads == plain.exposedFaces);
+    CHECK(greedy.exposedFaces == plain.exposedFaces);
+    CHECK(greedy.quads == 6);
+    CHECK(FaceArea(greedy, 1, 1.0f) == 64.0f);
+
+    // a different texture in the middle splits the top and bottom
+    world.SetBlock(8, 0, 8, WOOD);
+    greedy = Mesh(world, true);
+    CHECK(greedy.exposedFaces == plain.exposedFaces);
+    CHECK(greedy.quads > 6);
+    CHECK(FaceArea(greedy, 1, 1.0f) == 64.0f);
+
+    // filled cells only tile with every other cell, so a solid slab merges
+    // into one quad per parity class (4 on top)
+    VoxelWorld slab;
+    for (int x = 0; x < VOXEL_CHUNK_SIZE; ++x) {
+        for (int z = 0; z < VOXEL_CHUNK_SIZE; ++z) slab.SetBlock(x, 0, z, STONE);
+    }
+    ChunkMesh slabMesh = Mesh(slab, true);
+    int top = 0;
+    for (size_t i = 0; i < slabMesh.vertices.size(); i += 4) top += slabMesh.vertices[i].normal[1] == 1.0f;
+    CHECK(top == 4);
+    CHECK(FaceArea(slabMesh, 1, 1.0f) == 256.0f);
+}
+
+TEST(ChunkMesher_GreedyCoversTheSameFacesAsPlain)
+{
+    TestRandom random(3);
+    for (int round = 0; round < 20; ++round) {
+        VoxelWorld world;
+        int fill = random.Int(50, 1500);
+        for (int i = 0; i < fill; ++i) {
+            world.SetBlock(random.Int(-2, VOXEL_CHUNK_SIZE + 1), random.Int(-2, VOXEL_CHUNK_SIZE + 1),
+                random.Int(-2, VOXEL_CHUNK_SIZE + 1), (BlockId)random.Int(STONE, WOOD));
+        }
+        ChunkMesh plain = Mesh(world, false);
+        ChunkMesh greedy = Mesh(world, true);
+        CHECK(greedy.exposedFaces == plain.exposedFaces);
+        CHECK(greedy.quads <= plain.quads);
+        for (int axis = 0; axis < 3; ++axis) {
+            CHECK(FaceArea(greedy, axis, 1.0f) == FaceArea(plain, axis, 1.0f));
+            CHECK(FaceArea(greedy, axis, -1.0f) == FaceArea(plain, axis, -1.0f));
+        }
+    }
+}
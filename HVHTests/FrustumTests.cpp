@@ -0,0 +1,192 @@
+#include "Test.h"
+#include "Frustum.h"
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+
+// Camera poses against the boxes in scenes/frustum.txt, plus random poses
+// checking that the SSE path, the scalar fallback and TestBox agree and that
+// nothing on screen is culled.
+namespace {
+    typedef float Matrix[4][4];
+
+    struct Camera {
+        std::string name;
+        float eye[3];
+        float yaw, pitch, fov, aspect, nearZ, farZ, viewDistance;
+        std::vector<int> visible;
+    };
+
+    struct Scene {
+        CullBoxList boxes;
+        std::vector<Camera> cameras;
+    };
+
+    const float DEGREES = 3.14159265f / 180.0f;
+
+    std::string DataPath(const char* name)
+    {
+        std::string dir = __FILE__;
+        size_t slash = dir.find_last_of("/\\");
+        dir = slash == std::string::npos ? "" : dir.substr(0, slash + 1);
+        return dir + "scenes/" + name;
+    }
+
+    bool LoadScene(const std::string& path, Scene& scene)
+    {
+        std::ifstream in(path);
+        if (!in.is_open()) return false;
+        std::string line;
+        while (std::getline(in, line)) {
+            size_t comment = line.find('#');
+            if (comment != std::string::npos) line.erase(comment);
+            std::istringstream fields(line);
+            std::string kind;
+            if (!(fields >> kind)) continue;
+            if (kind == "box") {
+                float b[6];
+                for (float& f : b) fields >> f;
+                if (!fields) return false;
+                scene.boxes.Add(b[0], b[1], b[2], b[3], b[4], b[5]);
+            } else if (kind == "camera") {
+                Camera c;
+                fields >> c.name >> c.eye[0] >> c.eye[1] >> c.eye[2] >> c.yaw >> c.pitch
+                    >> c.fov >> c.aspect >> c.nearZ >> c.farZ >> c.viewDistance;
+                if (!fields) return false;
+                scene.cameras.push_back(c);
+            } else if (kind == "visible" && !scene.cameras.empty()) {
+                int index;
+                while (fields >> index) scene.cameras.back().visible.push_back(index);
+            } else {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    void Multiply(const Matrix a, const Matrix b, Matrix out)
+    {
+        for (int i = 0; i < 4; ++i) {
+            for (int j = 0; j < 4; ++j) {
+                out[i][j] = 0.0f;
+                for (int k = 0; k < 4; ++k) out[i][j] += a[i][k] * b[k][j];
+            }
+        }
+    }
+
+    // XMMatrixLookToLH * XMMatrixPerspectiveFovLH, written out
+    void ViewProjection(const Camera& c, Matrix out)
+    {
+        float yaw = c.yaw * DEGREES, pitch = c.pitch * DEGREES;
+        float z[3] = { sinf(yaw) * cosf(pitch), sinf(pitch), cosf(yaw) * cosf(pitch) };
+        float x[3] = { z[2], 0.0f, -z[0] };   // up (0, 1, 0) x forward
+        float xl = sqrtf(x[0] * x[0] + x[2] * x[2]);
+        x[0] /= xl; x[2] /= xl;
+        float y[3] = { z[1] * x[2] - z[2] * x[1], z[2] * x[0] - z[0] * x[2], z[0] * x[1] - z[1] * x[0] };
+        const float* e = c.eye;
+        Matrix view = {
+            { x[0], y[0], z[0], 0 },
+            { x[1], y[1], z[1], 0 },
+            { x[2], y[2], z[2], 0 },
+            { -(x[0] * e[0] + x[1] * e[1] + x[2] * e[2]), -(y[0] * e[0] + y[1] * e[1] + y[2] * e[2]),
+              -(z[0] * e[0] + z[1] * e[1] + z[2] * e[2]), 1 },
+        };
+        float h = 1.0f / tanf(c.fov * DEGREES * 0.5f), w = h / c.aspect;
+        float q = c.farZ / (c.farZ - c.nearZ);
+        Matrix proj = { { w, 0, 0, 0 }, { 0, h, 0, 0 }, { 0, 0, q, 1 }, { 0, 0, -q * c.nearZ, 0 } };
+        Multiply(view, proj, out);
+    }
+
+    Frustum MakeFrustum(const Camera& c)
+    {
+        Matrix viewProj;
+        ViewProjection(c, viewProj);
+        Frustum frustum;
+        frustum.Extract(viewProj);
+        frustum.SetViewDistance(c.eye, c.viewDistance);
+        return frustum;
+    }
+
+    bool OnScreen(const Matrix m, const float p[3])
+    {
+        float clip[4];
+        for (int j = 0; j < 4; ++j) clip[j] = p[0] * m[0][j] + p[1] * m[1][j] + p[2] * m[2][j] + m[3][j];
+        return clip[3] > 0.0f && fabsf(clip[0]) <= clip[3] && fabsf(clip[1]) <= clip[3] &&
+            clip[2] >= 0.0f && clip[2] <= clip[3];
+    }
+}
+
+TEST(Frustum_ScenePoses)
+{
+    Scene scene;
+    REQUIRE(LoadScene(DataPath("frustum.txt"), scene));
+    REQUIRE(scene.boxes.Size() > 0 && !scene.cameras.empty());
+
+    for (const Camera& camera : scene.cameras) {
+        Frustum frustum = MakeFrustum(camera);
+        std::vector<uint8_t> expected(scene.boxes.Size(), 0);
+        for (int index : camera.visible) expected[index] = 1;
+
+        std::vector<uint8_t> fast, scalar;
+        size_t fastCount = frustum.CullBoxes(scene.boxes, fast);
+        size_t scalarCount = frustum.CullBoxesReference(scene.boxes, scalar);
+        for (size_t i = 0; i < expected.size(); ++i) {
+            if (fast[i] != expected[i] || scalar[i] != expected[i]) {
+                printf("    camera %s box %zu: expected %d, SSE %d, scalar %d\n", camera.name.c_str(), i,
+                    expected[i], fast[i], scalar[i]);
+            }
+            CHECK(fast[i] == expected[i]);
+            CHECK(scalar[i] == expected[i]);
+        }
+        CHECK(fastCount == camera.visible.size());
+        CHECK(scalarCount == camera.visible.size());
+    }
+}
+
+TEST(Frustum_SimdMatchesScalarOnRandomPoses)
+{
+    TestRandom random(21);
+    for (int round = 0; round < 200; ++round) {
+        Camera camera;
+        for (float& e : camera.eye) e = random.Range(-50, 50);
+        camera.yaw = random.Range(-180, 180);
+        camera.pitch = random.Range(-80, 80);
+        camera.fov = random.Range(30, 110);
+        camera.aspect = random.Range(0.5f, 2.5f);
+        camera.nearZ = 0.1f;
+        camera.farZ = random.Range(20, 300);
+        camera.viewDistance = random.Int(0, 1) ? random.Range(10, 200) : 0.0f;
+
+        // odd count so the scalar tail after the last group of four runs too
+        CullBoxList boxes;
+        int count = random.Int(1, 203) | 1;
+        for (int i = 0; i < count; ++i) {
+            float x = random.Range(-150, 150), y = random.Range(-150, 150), z = random.Range(-150, 150);
+            float s = random.Range(0.1f, 8.0f);
+            boxes.Add(x - s, y - s, z - s, x + s, y + s, z + s);
+        }
+
+        Frustum frustum = MakeFrustum(camera);
+        Matrix viewProj;
+        ViewProjection(camera, viewProj);
+        std::vector<uint8_t> fast, scalar;
+        size_t fastCount = frustum.CullBoxes(boxes, fast);
+        size_t scalarCount = frustum.CullBoxesReference(boxes, scalar);
+        CHECK(fastCount == scalarCount);
+        for (int i = 0; i < count; ++i) {
+            CHECK(fast[i] == scalar[i]);
+            CHECK(scalar[i] == (frustum.TestBox(boxes.minX[i], boxes.minY[i], boxes.minZ[i],
+                boxes.maxX[i], boxes.maxY[i], boxes.maxZ[i]) ? 1 : 0));
+
+            // culling is conservative: a box with its center on screen (and
+            // within the view distance) is never dropped
+            float center[3] = { (boxes.minX[i] + boxes.maxX[i]) * 0.5f, (boxes.minY[i] + boxes.maxY[i]) * 0.5f,
+                (boxes.minZ[i] + boxes.maxZ[i]) * 0.5f };
+            float dx = center[0] - camera.eye[0], dy = center[1] - camera.eye[1], dz = center[2] - camera.eye[2];
+            bool inRange = camera.viewDistance <= 0.0f || dx * dx + dy * dy + dz * dz <= camera.viewDistance * camera.viewDistance;
+            if (inRange && OnScreen(viewProj, center)) CHECK(fast[i] == 1);
+        }
+    }
+}
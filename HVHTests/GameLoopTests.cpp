@@ -0,0 +1,150 @@
+#include "Test.h"
+#include "GameLoop.h"
+#include "PlayerPhysics.h"
+#include <cmath>
+#include <cstring>
+
+namespace {
+    const double TICK = 1.0 / FixedTimestep::DEFAULT_TICK_RATE;
+
+    // A walk over a few blocks where the input only depends on the tick
+    // number, the way a replay or a server feeds it. Steps through timestep
+    // with the given frame times until ticks have run, and records every
+    // tick's body.
+    std::vector<PlayerBody> RunFrames(const std::vector<double>& frames, uint64_t ticks)
+    {
+        VoxelWorld world;
+        for (int x = -20; x <= 20; x += 2) world.SetBlock(x, 1, 8 + (x & 2) * 2, 2);
+        world.SetBlock(6, 1, 0, 2);
+        PhysicsBoxSource boxes = [&world](const PhysicsBox& region, std::vector<PhysicsBox>& out) {
+            CollectVoxelBoxes(world, region, out);
+        };
+        PlayerPhysicsParams params;
+        params.airAcceleration = 45.0f;
+
+        FixedTimestep timestep;
+        PlayerBody body;
+        body.position[1] = 5.0f;
+        std::vector<PlayerBody> trace;
+        for (size_t frame = 0; trace.size() < ticks; ++frame) {
+            int due = timestep.Advance(frames[frame % frames.size()]);
+            for (int i = 0; i < due && trace.size() < ticks; ++i) {
+                uint64_t tick = trace.size();
+                float angle = tick * 0.013f;
+                PlayerMove move;
+                move.wishX = cosf(angle);
+                move.wishZ = sinf(angle);
+                move.speed = 15.625f;
+                if (body.grounded && tick % 97 == 0) {
+                    body.velocity[1] = 40.0f;
+                    body.grounded = false;
+                }
+                StepPlayer(body, move, params, (float)timestep.GetTickSeconds(), boxes);
+                trace.push_back(body);
+            }
+        }
+        return trace;
+    }
+}
+
+TEST(GameLoop_AccumulatesWholeTicks)
+{
+    FixedTimestep timestep;
+    CHECK(timestep.GetTickRate() == 120);
+    CHECK(timestep.Advance(TICK * 0.5) == 0);
+    CHECK_NEAR(timestep.GetAlpha(), 0.5f, 1e-6f);
+    CHECK(timestep.Advance(TICK * 0.75) == 1);
+    CHECK_NEAR(timestep.GetAlpha(), 0.25f, 1e-6f);
+    CHECK(timestep.Advance(TICK * 2.5) == 2);
+    CHECK_NEAR(timestep.GetAlpha(), 0.75f, 1e-6f);
+    CHECK(timestep.GetTick() == 3);
+
+    // a zero or backwards frame adds nothing
+    CHECK(timestep.Advance(0.0) == 0);
+    CHECK(timestep.Advance(-1.0) == 0);
+    CHECK_NEAR(timestep.GetAlpha(), 0.75f, 1e-6f);
+
+    // 10 s of 144 Hz frames: every tick is accounted for, nothing dropped
+    FixedTimestep display;
+    uint64_t ticks = 0;
+    for (int i = 0; i < 1440; ++i) ticks += display.Advance(1.0 / 144.0);
+    CHECK(ticks == display.GetTick());
+    CHECK_NEAR(ticks + display.GetAlpha(), 1200.0, 1e-6);
+    CHECK(display.GetDroppedSeconds() == 0.0);
+
+    FixedTimestep server(30);
+    CHECK(server.GetTickSeconds() == 1.0 / 30);
+    CHECK(FixedTimestep(0).GetTickRate() == FixedTimestep::DEFAULT_TICK_RATE);
+}
+
+TEST(GameLoop_HitchesAreCappedAndCounted)
+{
+    FixedTimestep timestep;
+    timestep.Advance(TICK * 0.25);
+
+    // a one second hitch runs 8 ticks and drops the rest, remainder included
+    CHECK(timestep.Advance(1.0) == FixedTimestep::MAX_TICKS_PER_FRAME);
+    CHECK(timestep.GetAlpha() == 0.0f);
+    CHECK_NEAR(timestep.GetDroppedSeconds(), 1.0 + TICK * 0.25 - 8 * TICK, 1e-9);
+
+    // exactly 8 ticks' worth isn't a hitch
+    double dropped = timestep.GetDroppedSeconds();
+    CHECK(timestep.Advance(TICK * 8.5) == 8);
+    CHECK(timestep.GetDroppedSeconds() == dropped);
+    CHECK_NEAR(timestep.GetAlpha(), 0.5f, 1e-6f);
+
+    // a second hitch adds to the count
+    CHECK(timestep.Advance(0.25) == 8);
+    CHECK_NEAR(timestep.GetDroppedSeconds(), dropped + 0.25 + TICK * 0.5 - 8 * TICK, 1e-9);
+    CHECK(timestep.GetTick() == 24);
+
+    timestep.Reset();
+    CHECK(timestep.GetTick() == 0);
+    CHECK(timestep.GetDroppedSeconds() == 0.0);
+    CHECK(timestep.GetAlpha() == 0.0f);
+}
+
+TEST(GameLoop_FrameTimingDoesntChangeTheSimulation)
+{
+    // the same 1200 ticks from steady 60 Hz frames, 144 Hz frames and frames
+    // jittering between 1 and 60 ms (up to 7 ticks, under the cap)
+    const uint64_t ticks = 1200;
+    std::vector<PlayerBody> steady = RunFrames({ 1.0 / 60.0 }, ticks);
+    std::vector<PlayerBody> fast = RunFrames({ 1.0 / 144.0 }, ticks);
+    TestRandom random(16);
+    std::vector<double> jittered;
+    for (int i = 0; i < 500; ++i) jittered.push_back(random.Range(0.001f, 0.060f));
+    std::vector<PlayerBody> jitter = RunFrames(jittered, ticks);
+
+    REQUIRE(steady.size() == ticks && fast.size() == ticks && jitter.size() == ticks);
+    bool landed = false;
+    for (uint64_t i = 0; i < ticks; ++i) {
+        CHECK(memcmp(steady[i].position, fast[i].position, sizeof(steady[i].position)) == 0);
+        CHECK(memcmp(steady[i].position, jitter[i].position, sizeof(steady[i].position)) == 0);
+        CHECK(memcmp(steady[i].velocity, jitter[i].velocity, sizeof(steady[i].velocity)) == 0);
+        CHECK(steady[i].grounded == jitter[i].grounded);
+        landed |= steady[i].grounded && steady[i].position[1] > 1.0f;
+    }
+    // it did get somewhere, and onto a block at some point
+    CHECK(fabsf(steady.back().position[0]) + fabsf(steady.back().position[2]) > 1.0f);
+    CHECK(landed);
+}
+
+TEST(GameLoop_FrameLimiterHoldsTheRate)
+{
+    FrameLimiter unlimited;
+    CHECK(unlimited.GetMaxFps() == 0);
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < 1000; ++i) unlimited.Wait();
+    CHECK(std::chrono::steady_clock::now() - start < std::chrono::milliseconds(50));
+
+    // never early: 20 frames at 200 fps take at least 100 ms
+    FrameLimiter limiter;
+    limiter.SetMaxFps(200);
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < 20; ++i) limiter.Wait();
+    CHECK(std::chrono::steady_clock::now() - start >= std::chrono::milliseconds(99));
+
+    limiter.SetMaxFps(-5);
+    CHECK(limiter.GetMaxFps() == 0);
+}
@@ -0,0 +1,105 @@
+#include "Test.h"
+#include "MipChain.h"
+#include <cstdio>
+#include <cstring>
+
+namespace {
+    std::vector<uint8_t> RandomImage(TestRandom& random, uint32_t width, uint32_t height)
+    {
+        std::vector<uint8_t> pixels((size_t)width * height * 4);
+        for (uint8_t& value : pixels) value = (uint8_t)random.Int(0, 255);
+        return pixels;
+    }
+
+    // DownsampleRGBA8 against the reference, with guard bytes after dst so a
+    // write past the mip shows up too. Prints the first texel that differs.
+    bool MatchesReference(const std::vector<uint8_t>& pixels, uint32_t width, uint32_t height)
+    {
+        const size_t guard = 64;
+        size_t size = (size_t)MipDimension(width, 1) * MipDimension(height, 1) * 4;
+        std::vector<uint8_t> fast(size + guard, 0xCD), reference(size + guard, 0xCD);
+        DownsampleRGBA8(pixels.data(), width, height, fast.data());
+        DownsampleRGBA8Reference(pixels.data(), width, height, reference.data());
+        for (size_t i = 0; i < size + guard; ++i) {
+            if (fast[i] != reference[i]) {
+                printf("  %ux%u: byte %zu (texel %zu channel %zu) is %d, reference %d%s\n", width, height, i, i / 4,
+                    i % 4, fast[i], reference[i], i >= size ? ", past the end" : "");
+                return false;
+            }
+        }
+        return true;
+    }
+}
+
+TEST(MipChain_AveragesRoundToNearest)
+{
+    // 2x2 -> 1x1 per channel: (a + b + c + d + 2) / 4
+    const uint8_t pixels[16] = {
+        0, 255, 1, 10,    0, 255, 1, 10,
+        0, 255, 2, 11,    1, 254, 2, 11,
+    };
+    uint8_t out[4] = {};
+    DownsampleRGBA8Reference(pixels, 2, 2, out);
+    CHECK(out[0] == 0);     // (1 + 2) / 4
+    CHECK(out[1] == 255);   // (1019 + 2) / 4
+    CHECK(out[2] == 2);     // (6 + 2) / 4
+    CHECK(out[3] == 11);    // (42 + 2) / 4
+
+    // a 1 texel side repeats: 1x2 -> 1x1 averages the two texels twice each
+    const uint8_t column[8] = { 10, 20, 30, 40,   13, 20, 31, 255 };
+    DownsampleRGBA8Reference(column, 1, 2, out);
+    CHECK(out[0] == 12 && out[1] == 20 && out[2] == 31 && out[3] == 148);
+    DownsampleRGBA8Reference(column, 2, 1, out);
+    CHECK(out[0] == 12 && out[1] == 20 && out[2] == 31 && out[3] == 148);
+}
+
+TEST(MipChain_DownsampleMatchesReference)
+{
+    // every size up to 40 x 40 covers odd sides, 1 x N and N x 1, and spans
+    // that end before, on and after a 4 texel SIMD block
+    TestRandom random(22);
+    for (uint32_t height = 1; height <= 40; ++height) {
+        for (uint32_t width = 1; width <= 40; ++width) {
+            std::vector<uint8_t> pixels = RandomImage(random, width, height);
+            CHECK(MatchesReference(pixels, width, height));
+        }
+    }
+    const uint32_t sizes[][2] = { { 1, 1000 }, { 1000, 1 }, { 257, 3 }, { 3, 257 }, { 1023, 511 }, { 512, 512 } };
+    for (const auto& size : sizes) {
+        std::vector<uint8_t> pixels = RandomImage(random, size[0], size[1]);
+        CHECK(MatchesReference(pixels, size[0], size[1]));
+    }
+
+    // the extremes, where a 16 bit sum would matter
+    for (uint8_t fill : { (uint8_t)0, (uint8_t)1, (uint8_t)254, (uint8_t)255 }) {
+        std::vector<uint8_t> pixels(37 * 9 * 4, fill);
+        CHECK(MatchesReference(pixels, 37, 9));
+    }
+}
+
+TEST(MipChain_BuildsEveryLevel)
+{
+    TestRandom random(23);
+    const uint32_t sizes[][2] = { { 1, 1 }, { 1, 37 }, { 64, 64 }, { 100, 30 }, { 33, 1 } };
+    for (const auto& size : sizes) {
+        uint32_t width = size[0], height = size[1];
+        std::vector<uint8_t> pixels = RandomImage(random, width, height);
+        std::vector<std::vector<uint8_t>> mips;
+        BuildMipChain(width, height, pixels, mips);
+        REQUIRE((int)mips.size() == MipCount(width, height));
+        CHECK(mips[0] == pixels);
+        CHECK(mips.back().size() == 4);
+
+        // each level is the reference filter of the one above
+        for (size_t level = 1; level < mips.size(); ++level) {
+            uint32_t w = MipDimension(width, (int)level - 1), h = MipDimension(height, (int)level - 1);
+            REQUIRE(mips[level].size() == (size_t)MipDimension(w, 1) * MipDimension(h, 1) * 4);
+            std::vector<uint8_t> expected(mips[level].size());
+            DownsampleRGBA8Reference(mips[level - 1].data(), w, h, expected.data());
+            CHECK(mips[level] == expected);
+        }
+    }
+    CHECK(MipCount(1, 1) == 1);
+    CHECK(MipCount(1, 37) == 6);
+    CHECK(MipCount(1024, 16) == 11);
+}
@@ -0,0 +1,295 @@
+#include "Test.h"
+#include "NetProtocol.h"
+#include <cstring>
+
+namespace {
+    const NetMessageType LAST_WIRE_TYPE = NetMessageType::WorldAck;
+
+    // a message of the given type with every field it carries filled in
+    NetMessage RandomMessage(NetMessageType type, TestRandom& random)
+    {
+        NetMessage msg;
+        msg.type = type;
+        switch (type) {
+        case NetMessageType::AssignId:
+        case NetMessageType::NewPlayer:
+        case NetMessageType::PlayerLeft:
+        case NetMessageType::Hit:
+            msg.playerId = (int32_t)random.Next();
+            break;
+        case NetMessageType::SnapshotAck:
+        case NetMessageType::WorldAck:
+            msg.sequence = random.Next();
+            break;
+        case NetMessageType::WorldBegin:
+            msg.count = random.Next();
+            break;
+        case NetMessageType::WorldBatch:
+            msg.sequence = random.Next();
+            msg.data.resize(random.Int(0, 600));
+            for (char& c : msg.data) c = (char)random.Next();
+            break;
+        case NetMessageType::Position:
+            msg = NetMessage::Position(random.Int(-1, 40), random.Range(-1e4f, 1e4f), random.Range(-1e4f, 1e4f),
+                random.Range(-1e4f, 1e4f), random.Range(-3.2f, 3.2f), random.Range(-1.6f, 1.6f));
+            msg.sequence = random.Next();
+            msg.teleport = random.Int(0, 1) != 0;
+            break;
+        case NetMessageType::BlockAdd: {
+            static const char* names[] = { "stone", "", "a_block_name_exactly_32_bytes_xx", "grass" };
+            msg = NetMessage::BlockAdd(random.Range(-500, 500), random.Range(-500, 500), random.Range(-500, 500),
+                names[random.Int(0, 3)]);
+            break;
+        }
+        case NetMessageType::BlockRemove:
+            msg = NetMessage::BlockRemove(random.Range(-500, 500), random.Range(-500, 500), random.Range(-500, 500));
+            break;
+        case NetMessageType::Snapshot: {
+            msg.sequence = random.Next();
+            msg.baseline = random.Next();
+            msg.inputAck = random.Next();
+            msg.entities.resize(random.Int(0, 40));
+            for (NetEntityState& e : msg.entities) {
+                e.id = random.Int(-32768, 32767);
+                e.flags = (uint8_t)random.Int(0, 7);
+                if (e.flags & NET_ENTITY_POSITION) {
+                    e.state.x = random.Int(-8388608, 8388607);
+                    e.state.y = random.Int(-8388608, 8388607);
+                    e.state.z = random.Int(-8388608, 8388607);
+                }
+                if (e.flags & NET_ENTITY_ROTATION) {
+                    e.state.yaw = (uint16_t)random.Next();
+                    e.state.pitch = (uint16_t)random.Next();
+                }
+            }
+            break;
+        }
+        default:
+            break;
+        }
+        return msg;
+    }
+
+    bool SameMessage(const NetMessage& a, const NetMessage& b)
+    {
+        if (a.type != b.type || a.playerId != b.playerId || a.sequence != b.sequence ||
+            a.baseline != b.baseline || a.inputAck != b.inputAck || a.count != b.count ||
+            a.teleport != b.teleport || a.blockName != b.blockName || a.data != b.data) {
+            return false;
+        }
+        // floats go over the wire as raw bits
+        if (memcmp(&a.x, &b.x, sizeof(float)) || memcmp(&a.y, &b.y, sizeof(float)) ||
+            memcmp(&a.z, &b.z, sizeof(float)) || memcmp(&a.yaw, &b.yaw, sizeof(float)) ||
+            memcmp(&a.pitch, &b.pitch, sizeof(float))) {
+            return false;
+        }
+        if (a.entities.size() != b.entities.size()) return false;
+        for (size_t i = 0; i < a.entities.size(); ++i) {
+            const NetEntityState& x = a.entities[i];
+            const NetEntityState& y = b.entities[i];
+            if (x.id != y.id || x.flags != y.flags) return false;
+            if ((x.flags & NET_ENTITY_POSITION) && !x.state.SamePosition(y.state)) return false;
+            if ((x.flags & NET_ENTITY_ROTATION) && !x.state.SameRotation(y.state)) return false;
+        }
+        return true;
+    }
+
+    NetMessageType RandomWireType(TestRandom& random)
+    {
+        return (NetMessageType)random.Int((int)NetMessageType::Join, (int)LAST_WIRE_TYPE);
+    }
+}
+
+TEST(NetProtocol_EveryTypeRoundTrips)
+{
+    TestRandom random(7);
+    for (int t = (int)NetMessageType::Join; t <= (int)LAST_WIRE_TYPE; ++t) {
+        for (int round = 0; round < 50; ++round) {
+            NetMessage msg = RandomMessage((NetMessageType)t, random);
+            std::vector<char> bytes;
+            EncodeNetMessage(msg, bytes);
+            CHECK(bytes.size() == NetMessageSize(msg));
+
+            NetFrameReader reader;
+            reader.Append(bytes.data(), bytes.size());
+            NetMessage decoded;
+            const char* frame = nullptr;
+            size_t frameSize = 0;
+            REQUIRE(reader.Next(decoded, &frame, &frameSize));
+            CHECK(SameMessage(msg, decoded));
+            CHECK(frameSize == bytes.size() && memcmp(frame, bytes.data(), frameSize) == 0);
+            CHECK(!reader.Next(decoded));
+            CHECK(!reader.HasError());
+        }
+    }
+
+    // never on the wire
+    std::vector<char> bytes;
+    EncodeNetMessage(NetMessage::Simple(NetMessageType::Disconnected), bytes);
+    EncodeNetMessage(NetMessage::Simple(NetMessageType::None), bytes);
+    CHECK(bytes.empty());
+}
+
+TEST(NetProtocol_OversizedFieldsAreClamped)
+{
+    NetMessage add = NetMessage::BlockAdd(1, 2, 3, std::string(100, 'x'));
+    CHECK(add.blockName.size() == NET_BLOCK_NAME_SIZE);
+
+    NetMessage batch;
+    batch.type = NetMessageType::WorldBatch;
+    batch.data.assign(NET_MAX_WORLD_BATCH + 500, 'y');
+    std::vector<char> bytes;
+    EncodeNetMessage(batch, bytes);
+    CHECK(bytes.size() == NET_HEADER_SIZE + NET_MAX_PAYLOAD);
+
+    NetMessage snapshot;
+    snapshot.type = NetMessageType::Snapshot;
+    snapshot.entities.resize(NET_MAX_SNAPSHOT_ENTITIES + 20);
+    bytes.clear();
+    EncodeNetMessage(snapshot, bytes);
+    NetFrameReader reader;
+    reader.Append(bytes.data(), bytes.size());
+    NetMessage decoded;
+    REQUIRE(reader.Next(decoded));
+    CHECK(decoded.entities.size() == NET_MAX_SNAPSHOT_ENTITIES);
+}
+
+TEST(NetProtocol_SplitAndCoalescedStreams)
+{
+    TestRandom random(13);
+    for (int round = 0; round < 100; ++round) {
+        std::vector<NetMessage> sent;
+        std::vector<char> stream;
+        int count = random.Int(1, 60);
+        for (int i = 0; i < count; ++i) {
+            sent.push_back(RandomMessage(RandomWireType(random), random));
+            EncodeNetMessage(sent.back(), stream);
+        }
+
+        // whatever recv hands back: single bytes, a bit of everything, or
+        // the whole stream at once
+        NetFrameReader reader;
+        std::vector<NetMessage> received;
+        size_t pos = 0;
+        int maxChunk = random.Int(0, 2) == 0 ? 1 : random.Int(2, 3000);
+        while (pos < stream.size()) {
+            size_t chunk = (size_t)random.Int(1, maxChunk);
+            if (chunk > stream.size() - pos) chunk = stream.size() - pos;
+            reader.Append(stream.data() + pos, chunk);
+            pos += chunk;
+            NetMessage msg;
+            while (reader.Next(msg)) received.push_back(msg);
+        }
+
+        CHECK(!reader.HasError());
+        REQUIRE(received.size() == sent.size());
+        for (size_t i = 0; i < sent.size(); ++i) CHECK(SameMessage(sent[i], received[i]));
+    }
+}
+
+TEST(NetProtocol_UnknownTypesAreSkipped)
+{
+    std::vector<char> stream;
+    EncodeNetMessage(NetMessage::Simple(NetMessageType::Ping), stream);
+    const char unknown[] = { 3, 0, (char)200, 0, 'a', 'b', 'c' };
+    stream.insert(stream.end(), unknown, unknown + sizeof(unknown));
+    EncodeNetMessage(NetMessage::BlockRemove(1, 2, 3), stream);
+
+    NetFrameReader reader;
+    reader.Append(stream.data(), stream.size());
+    NetMessage msg;
+    REQUIRE(reader.Next(msg));
+    CHECK(msg.type == NetMessageType::Ping);
+    REQUIRE(reader.Next(msg));
+    CHECK(msg.type == NetMessageType::BlockRemove && msg.y == 2.0f);
+    CHECK(!reader.Next(msg));
+    CHECK(!reader.HasError());
+}
+
+TEST(NetProtocol_CorruptFramesStopTheReader)
+{
+    // a known type with the wrong size means the stream lost sync
+    std::vector<char> stream;
+    EncodeNetMessage(NetMessage::BlockRemove(1, 2, 3), stream);
+    stream[0] = 11;
+    stream.pop_back();
+    EncodeNetMessage(NetMessage::Simple(NetMessageType::Ping), stream);
+    NetFrameReader reader;
+    reader.Append(stream.data(), stream.size());
+    NetMessage msg;
+    CHECK(!reader.Next(msg));
+    CHECK(reader.HasError());
+
+    // so does a length past NET_MAX_PAYLOAD, before the payload arrives
+    reader.Reset();
+    const char huge[] = { (char)0xFF, (char)0xFF, (char)NetMessageType::WorldBatch, 0 };
+    reader.Append(huge, sizeof(huge));
+    CHECK(!reader.Next(msg));
+    CHECK(reader.HasError());
+
+    // and a snapshot whose entities run past its length
+    NetMessage snapshot;
+    snapshot.type = NetMessageType::Snapshot;
+    snapshot.entities.resize(2);
+    snapshot.entities[1].flags = NET_ENTITY_POSITION;
+    stream.clear();
+    EncodeNetMessage(snapshot, stream);
+    stream[NET_HEADER_SIZE + 12] = 3;
+    reader.Reset();
+    reader.Append(stream.data(), stream.size());
+    CHECK(!reader.Next(msg));
+    CHECK(reader.HasError());
+
+    // Reset recovers
+    reader.Reset();
+    stream.clear();
+    EncodeNetMessage(NetMessage::Simple(NetMessageType::Ping), stream);
+    reader.Append(stream.data(), stream.size());
+    CHECK(reader.Next(msg) && msg.type == NetMessageType::Ping);
+}
+
+TEST(NetProtocol_RandomBytesNeverCrash)
+{
+    // garbage alone, and garbage spliced into a valid stream; the reader
+    // must either hand back well formed messages or stop with an error
+    TestRandom random(99);
+    for (int round = 0; round < 2000; ++round) {
+        std::vector<char> stream;
+        if (round % 2) {
+            for (int i = random.Int(1, 10); i > 0; --i) {
+                EncodeNetMessage(RandomMessage(RandomWireType(random), random), stream);
+            }
+            for (int i = random.Int(1, 8); i > 0; --i) {
+                stream[random.Int(0, (int)stream.size() - 1)] = (char)random.Next();
+            }
+        } else {
+            stream.resize(random.Int(1, 5000));
+            for (char& c : stream) c = (char)random.Next();
+            // keep lengths small often enough that frames actually complete
+            for (size_t i = 0; i + 1 < stream.size(); i += random.Int(4, 64)) stream[i + 1] = 0;
+        }
+
+        NetFrameReader reader;
+        size_t pos = 0;
+        size_t decodedBytes = 0;
+        while (pos < stream.size()) {
+            size_t chunk = (size_t)random.Int(1, 700);
+            if (chunk > stream.size() - pos) chunk = stream.size() - pos;
+            reader.Append(stream.data() + pos, chunk);
+            pos += chunk;
+            NetMessage msg;
+            size_t frameSize = 0;
+            while (reader.Next(msg, nullptr, &frameSize)) {
+                CHECK(msg.type != NetMessageType::None && msg.type <= LAST_WIRE_TYPE);
+                CHECK(frameSize == NetMessageSize(msg));
+                decodedBytes += frameSize;
+            }
+        }
+        CHECK(decodedBytes <= stream.size());
+        if (reader.HasError()) {
+            NetMessage msg;
+            reader.Append(stream.data(), stream.size());
+            CHECK(!reader.Next(msg));
+        }
+    }
+}
@@ -0,0 +1,273 @@
+#include "Test.h"
+#include "NetSmoothing.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+
+// Deterministic replays of packet streams through the smoothing code: a
+// remote player's 30 Hz snapshots over a link with jitter, loss and a stall,
+// rendered at 120 Hz; and the local player's uploads reconciled against a
+// host that clamps moves, the way HostSession::OnPosition does.
+namespace {
+    const double SEND_RATE = 30.0;
+    const double FRAME_RATE = 120.0;
+
+    struct Packet {
+        double sent;
+        double arrives;
+        EntitySample sample;
+    };
+
+    struct LinkModel {
+        double latency;
+        double jitter;          // uniform extra delay in [0, jitter)
+        int lossPercent;
+        double stallAt;         // a retransmit holding everything up, < 0 for none
+        double stallFor;
+    };
+
+    // where the remote player really is at time t
+    EntitySample Truth(double t)
+    {
+        EntitySample s;
+        s.time = t;
+        s.position[0] = (float)(4.0 * t);
+        s.position[1] = 1.8f;
+        s.position[2] = (float)(2.0 * sin(0.5 * t));
+        s.yaw = (float)atan2(cos(0.5 * t), 4.0);
+        return s;
+    }
+
+    // The recorded stream: what the host sent and when each packet arrived.
+    // TCP delivers in order, so a late packet holds back the ones behind it.
+    std::vector<Packet> RecordStream(const LinkModel& link, double seconds, uint32_t seed)
+    {
+        TestRandom random(seed);
+        std::vector<Packet> stream;
+        double lastArrival = 0.0;
+        for (int i = 0; i < (int)(seconds * SEND_RATE); ++i) {
+            Packet p;
+            p.sent = i / SEND_RATE;
+            p.sample = Truth(p.sent);
+            p.arrives = p.sent + link.latency + random.Range(0.0f, (float)link.jitter);
+            if (link.stallAt >= 0.0 && p.sent >= link.stallAt && p.sent < link.stallAt + link.stallFor) {
+                p.arrives = std::max(p.arrives, link.stallAt + link.stallFor + link.latency);
+            }
+            p.arrives = std::max(p.arrives, lastArrival);
+            lastArrival = p.arrives;
+            if (random.Int(1, 100) <= link.lossPercent) continue;
+            stream.push_back(p);
+        }
+        return stream;
+    }
+
+    struct Smoothness {
+        double maxStep = 0.0;        // largest move between two frames
+        double maxBackStep = 0.0;    // largest move against the direction of travel
+        double meanError = 0.0;      // against the truth at the playback time
+        double maxError = 0.0;
+        double frozenFraction = 0.0; // frames that didn't move while the player did
+        double minLag = 1e9, maxLag = 0.0;   // newest sample time - playback time
+    };
+
+    Smoothness Replay(const std::vector<Packet>& stream, double seconds)
+    {
+        EntityHistory history;
+        InterpolationClock clock;
+        Smoothness m;
+        size_t next = 0;
+        bool havePrevious = false;
+        EntitySample previous;
+        double newest = 0.0, errorSum = 0.0;
+        int frames = 0, frozen = 0;
+
+        for (int f = 0; f < (int)(seconds * FRAME_RATE); ++f) {
+            double now = f / FRAME_RATE;
+            while (next < stream.size() && stream[next].arrives <= now) {
+                history.Push(stream[next].sample);
+                clock.OnSample(stream[next].sample.time);
+                newest = std::max(newest, stream[next].sample.time);
+                ++next;
+            }
+            clock.Advance(1.0 / FRAME_RATE);
+            EntitySample shown;
+            if (!clock.IsRunning() || !history.Sample(clock.Now(), shown)) continue;
+
+            // the first second settles the clock
+            if (now > 1.0 && havePrevious) {
+                double dx = shown.position[0] - previous.position[0];
+                double dz = shown.position[2] - previous.position[2];
+                double step = sqrt(dx * dx + dz * dz);
+                m.maxStep = std::max(m.maxStep, step);
+                m.maxBackStep = std::max(m.maxBackStep, -dx);
+                if (step == 0.0) ++frozen;
+
+                EntitySample truth = Truth(clock.Now());
+                double ex = shown.position[0] - truth.position[0], ez = shown.position[2] - truth.position[2];
+                double error = sqrt(ex * ex + ez * ez);
+                errorSum += error;
+                m.maxError = std::max(m.maxError, error);
+                m.minLag = std::min(m.minLag, newest - clock.Now());
+                m.maxLag = std::max(m.maxLag, newest - clock.Now());
+                ++frames;
+            }
+            previous = shown;
+            havePrevious = true;
+        }
+        m.meanError = frames ? errorSum / frames : 0.0;
+        m.frozenFraction = frames ? (double)frozen / frames : 0.0;
+        return m;
+    }
+
+    void Print(const char* name, const Smoothness& m)
+    {
+        printf("    %-8s step max %.4f back %.4f  error mean %.4f max %.4f  frozen %.1f%%  lag %.3f..%.3f\n", name,
+            m.maxStep, m.maxBackStep, m.meanError, m.maxError, m.frozenFraction * 100.0, m.minLag, m.maxLag);
+    }
+
+    // one frame at full speed (just over 4.1 units/s), with the clock's 10% catch-up
+    const double FRAME_STEP = 4.13 / FRAME_RATE * 1.1;
+}
+
+TEST(NetSmoothing_RemotePlayerOverJitterAndLoss)
+{
+    LinkModel link = { 0.06, 0.05, 10, -1.0, 0.0 };
+    for (uint32_t seed = 1; seed <= 5; ++seed) {
+        Smoothness m = Replay(RecordStream(link, 20.0, seed), 20.0);
+        if (seed == 1) Print("jitter", m);
+        CHECK(m.maxStep <= FRAME_STEP * 1.05);
+        CHECK(m.maxBackStep == 0.0);
+        CHECK(m.meanError < 0.01);
+        CHECK(m.maxError < 0.05);
+        CHECK(m.frozenFraction < 0.01);
+    }
+
+    // a clean link is the baseline: no frozen frames, lag right at the delay
+    LinkModel clean = { 0.06, 0.0, 0, -1.0, 0.0 };
+    Smoothness m = Replay(RecordStream(clean, 20.0, 1), 20.0);
+    CHECK(m.frozenFraction == 0.0);
+    CHECK(m.maxStep <= FRAME_STEP);
+    CHECK_NEAR(m.minLag, 0.1, 0.035);
+}
+
+TEST(NetSmoothing_RemotePlayerOverAStall)
+{
+    // 300 ms with nothing arriving, then everything at once
+    LinkModel link = { 0.06, 0.03, 5, 8.0, 0.3 };
+    Smoothness m = Replay(RecordStream(link, 20.0, 3), 20.0);
+    Print("stall", m);
+    // playback holds at the newest sample instead of running past it and
+    // snapping back; once the backlog lands it may skip ahead, never back
+    CHECK(m.maxBackStep == 0.0);
+    CHECK(m.maxError < 0.05);
+    CHECK(m.frozenFraction < 0.05);
+    CHECK(m.minLag >= 0.0);
+}
+
+namespace {
+    // The host side of HostSession::OnPosition: moves longer than max speed
+    // over the time since the last report (+0.5) are cut short.
+    struct HostModel {
+        float maxSpeed = 6.0f;
+        bool reported = false;
+        double lastTime = 0.0;
+        float position[3] = {};
+        uint32_t lastSequence = 0;
+
+        void OnPosition(double now, const float reported3[3], uint32_t sequence)
+        {
+            float accepted[3] = { reported3[0], reported3[1], reported3[2] };
+            if (reported) {
+                float d[3] = { reported3[0] - position[0], reported3[1] - position[1], reported3[2] - position[2] };
+                float distance = sqrtf(d[0] * d[0] + d[1] * d[1] + d[2] * d[2]);
+                float maxDistance = maxSpeed * (float)(now - lastTime) + 0.5f;
+                if (distance > maxDistance) {
+                    for (int k = 0; k < 3; ++k) accepted[k] = position[k] + d[k] * (maxDistance / distance);
+                }
+            }
+            for (int k = 0; k < 3; ++k) position[k] = accepted[k];
+            reported = true;
+            lastTime = now;
+            lastSequence = sequence;
+        }
+    };
+
+    struct InFlight {
+        double arrives;
+        float position[3];
+        uint32_t sequence;
+    };
+}
+
+TEST(NetSmoothing_PredictionReconcilesToTheHost)
+{
+    // The client walks at 4 units/s; between 5 and 5.5 s it dashes at 40,
+    // more than the host accepts. Uploads go out at 30 Hz and snapshots
+    // come back at 30 Hz; both directions have jitter, snapshots are lost.
+    TestRandom random(17);
+    PredictionHistory prediction;
+    HostModel host;
+    std::vector<InFlight> uploads, snapshots;
+    float position[3] = { 0.0f, 1.8f, 0.0f };
+    double lastUpload = 0.0, lastSnapshot = 0.0, lastUploadArrival = 0.0, lastSnapshotArrival = 0.0;
+    int corrections = 0, correctionsBeforeDash = 0, correctionsAfterDash = 0;
+    double maxErrorAfterSettle = 0.0;
+
+    for (int f = 0; f < (int)(15.0 * FRAME_RATE); ++f) {
+        double now = f / FRAME_RATE;
+        bool dashing = now >= 5.0 && now < 5.5;
+        position[0] += (float)((dashing ? 40.0 : 4.0) / FRAME_RATE);
+
+        if (now - lastUpload >= 1.0 / SEND_RATE) {
+            lastUpload = now;
+            InFlight up = { std::max(lastUploadArrival, now + 0.04 + random.Range(0, 0.03f)),
+                { position[0], position[1], position[2] }, prediction.Record(position) };
+            lastUploadArrival = up.arrives;
+            uploads.push_back(up);
+        }
+        while (!uploads.empty() && uploads.front().arrives <= now) {
+            host.OnPosition(uploads.front().arrives, uploads.front().position, uploads.front().sequence);
+            uploads.erase(uploads.begin());
+        }
+        if (host.reported && now - lastSnapshot >= 1.0 / SEND_RATE) {
+            lastSnapshot = now;
+            InFlight down = { std::max(lastSnapshotArrival, now + 0.04 + random.Range(0, 0.03f)),
+                { host.position[0], host.position[1], host.position[2] }, host.lastSequence };
+            lastSnapshotArrival = down.arrives;
+            if (random.Int(1, 100) > 10) snapshots.push_back(down);
+        }
+        while (!snapshots.empty() && snapshots.front().arrives <= now) {
+            // GameEngine::ReconcileLocalPlayer
+            float correction[3];
+            if (prediction.Reconcile(snapshots.front().sequence, snapshots.front().position, correction)) {
+                float error = sqrtf(correction[0] * correction[0] + correction[1] * correction[1] + correction[2] * correction[2]);
+                if (error >= 0.05f) {
+                    for (int k = 0; k < 3; ++k) position[k] += correction[k];
+                    ++corrections;
+                    if (now < 5.0) ++correctionsBeforeDash;
+                    if (now > 6.5) ++correctionsAfterDash;
+                }
+            }
+            snapshots.erase(snapshots.begin());
+        }
+
+        // a second after the dash the client agrees with the host again,
+        // less the distance walked since the host last heard from it
+        if (now > 6.5) {
+            double behind = fabs(position[0] - host.position[0]);
+            maxErrorAfterSettle = std::max(maxErrorAfterSettle, behind);
+        }
+    }
+    printf("    corrections %d (before the dash %d, after it settled %d), max host/client gap after %.3f\n",
+        corrections, correctionsBeforeDash, correctionsAfterDash, maxErrorAfterSettle);
+
+    // walking never needs correcting, the dash does, and a second later the
+    // client and host agree again: no oscillation from stacked corrections
+    CHECK(correctionsBeforeDash == 0);
+    CHECK(corrections > 0);
+    CHECK(correctionsAfterDash == 0);
+    // the gap left is what the client walked during one round trip
+    CHECK(maxErrorAfterSettle < 4.0 * (0.04 + 0.03 + 2.0 / SEND_RATE + 0.04 + 0.03));
+    // part of the dash was cut short by the host
+    CHECK(position[0] < 4.0f * 15.0f + 36.0f * 0.5f - 1.0f);
+}
@@ -0,0 +1,83 @@
+#include "Test.h"
+#include "NetworkManager.h"
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace {
+    const int TEST_PORT = 27116;
+
+    // Join/Disconnected per client id as the server saw them
+    struct ServerLog {
+        std::mutex mutex;
+        std::vector<int> joined;
+        std::vector<int> left;
+
+        size_t Joined() { std::lock_guard<std::mutex> lock(mutex); return joined.size(); }
+        size_t Left() { std::lock_guard<std::mutex> lock(mutex); return left.size(); }
+    };
+
+    template <typename F>
+    bool WaitFor(F done)
+    {
+        auto start = std::chrono::steady_clock::now();
+        while (!done()) {
+            if (std::chrono::steady_clock::now() - start > std::chrono::seconds(5)) return false;
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        }
+        return true;
+    }
+}
+
+TEST(NetworkManager_ClosedSlotsAreReused)
+{
+    NetworkManager server;
+    ServerLog log;
+    server.Initialize();
+    server.SetDataReceivedCallback([&](const NetMessage& msg, int clientId) {
+        std::lock_guard<std::mutex> lock(log.mutex);
+        if (msg.type == NetMessageType::Join) log.joined.push_back(clientId);
+        if (msg.type == NetMessageType::Disconnected) log.left.push_back(clientId);
+    });
+    REQUIRE(server.StartServer(TEST_PORT));
+
+    std::vector<std::unique_ptr<NetworkManager>> clients;
+    for (int i = 0; i < 3; ++i) {
+        clients.push_back(std::make_unique<NetworkManager>());
+        REQUIRE(clients.back()->ConnectToServer("127.0.0.1", TEST_PORT));
+        REQUIRE(WaitFor([&] { return log.Joined() == (size_t)i + 1; }));
+    }
+    CHECK(log.joined == std::vector<int>({ 0, 1, 2 }));
+
+    // drop the middle one, the next client takes its id instead of id 3
+    clients[1]->Disconnect();
+    REQUIRE(WaitFor([&] { return log.Left() == 1; }));
+    CHECK(log.left[0] == 1);
+    CHECK(server.GetClientCount() == 2);
+
+    for (int round = 0; round < 20; ++round) {
+        clients[1] = std::make_unique<NetworkManager>();
+        REQUIRE(clients[1]->ConnectToServer("127.0.0.1", TEST_PORT));
+        REQUIRE(WaitFor([&] { return log.Joined() == 4u + round; }));
+        CHECK(log.joined.back() == 1);
+        clients[1]->Disconnect();
+        REQUIRE(WaitFor([&] { return log.Left() == 2u + round; }));
+    }
+    CHECK(server.GetClientCount() == 2);
+
+    // messages still reach the right slot
+    std::mutex mutex;
+    std::vector<int> senders;
+    server.SetDataReceivedCallback([&](const NetMessage& msg, int clientId) {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (msg.type == NetMessageType::Ping) senders.push_back(clientId);
+    });
+    clients[2]->SendData(NetMessage::Simple(NetMessageType::Ping));
+    REQUIRE(WaitFor([&] { std::lock_guard<std::mutex> lock(mutex); return !senders.empty(); }));
+    CHECK(senders[0] == 2);
+
+    for (auto& client : clients) client->Disconnect();
+    server.Disconnect();
+}
@@ -0,0 +1,210 @@
+#include "Test.h"
+#include "PlayerPhysics.h"
+#include <cmath>
+#include <cstring>
+
+// Fixed 120 Hz steps with GameEngine's movement constants, against voxel
+// blocks (+-1 around each lattice point) or hand-made boxes.
+namespace {
+    const float DT = 1.0f / 120.0f;
+    const float WALK_SPEED = 50.0f / 3.2f;
+    const float JUMP_FORCE = 40.0f;
+
+    PlayerPhysicsParams GameParams()
+    {
+        PlayerPhysicsParams params;
+        params.gravity = 350.0f;
+        params.airAcceleration = 45.0f;
+        return params;
+    }
+
+    PhysicsBoxSource FromWorld(const VoxelWorld& world)
+    {
+        return [&world](const PhysicsBox& region, std::vector<PhysicsBox>& out) {
+            CollectVoxelBoxes(world, region, out);
+        };
+    }
+
+    PhysicsBoxSource FromList(const std::vector<PhysicsBox>& list)
+    {
+        return [&list](const PhysicsBox& region, std::vector<PhysicsBox>& out) {
+            for (const PhysicsBox& box : list) {
+                if (box.max[0] >= region.min[0] && box.min[0] <= region.max[0] &&
+                    box.max[1] >= region.min[1] && box.min[1] <= region.max[1] &&
+                    box.max[2] >= region.min[2] && box.min[2] <= region.max[2]) out.push_back(box);
+            }
+        };
+    }
+
+    PlayerBody BodyAt(float x, float y, float z, bool grounded)
+    {
+        PlayerBody body;
+        body.position[0] = x; body.position[1] = y; body.position[2] = z;
+        body.grounded = grounded;
+        return body;
+    }
+
+    PlayerMove Walk(float wishX, float wishZ, float speed = WALK_SPEED)
+    {
+        PlayerMove move;
+        move.wishX = wishX;
+        move.wishZ = wishZ;
+        move.speed = speed;
+        return move;
+    }
+
+    // what Input does on space
+    void Jump(PlayerBody& body)
+    {
+        body.velocity[1] = JUMP_FORCE;
+        body.grounded = false;
+    }
+}
+
+TEST(PlayerPhysics_DropLandsFlushOnTheBlock)
+{
+    VoxelWorld world;
+    world.SetBlock(0, 1, 0, 2);   // top face at y = 2
+
+    PlayerBody body = BodyAt(0, 20, 0, false);
+    PlayerMove still;
+    int landings = 0;
+    for (int i = 0; i < 600 && !body.grounded; ++i) {
+        if (StepPlayer(body, still, GameParams(), DT, FromWorld(world))) ++landings;
+    }
+    CHECK(body.grounded);
+    CHECK(landings == 1);
+    CHECK_NEAR(body.position[1], 2.0f, 1e-4f);
+    CHECK(body.velocity[1] == 0.0f);
+
+    // standing on it stays put and doesn't land again
+    for (int i = 0; i < 120; ++i) {
+        CHECK(!StepPlayer(body, still, GameParams(), DT, FromWorld(world)));
+    }
+    CHECK(body.grounded);
+    CHECK_NEAR(body.position[1], 2.0f, 1e-4f);
+
+    // walking off the edge falls to the floor plane
+    for (int i = 0; i < 240; ++i) StepPlayer(body, Walk(1, 0), GameParams(), DT, FromWorld(world));
+    CHECK(body.grounded);
+    CHECK(body.position[1] == 0.0f);
+    CHECK(body.position[0] > 1.3f);
+}
+
+TEST(PlayerPhysics_HighSpeedDoesntTunnel)
+{
+    // one tick at the fastest of these covers 400 units, far past the
+    // sub-step budget; the sweep still has to stop on a 0.01 thick plate
+    const float speeds[] = { 50.0f, 500.0f, 5000.0f, 50000.0f };
+    std::vector<PhysicsBox> plate = { { { -5, 9.99f, -5 }, { 5, 10, 5 } } };
+    for (float speed : speeds) {
+        PlayerBody body = BodyAt(0, 30, 0, false);
+        body.velocity[1] = -speed;
+        for (int i = 0; i < 60; ++i) StepPlayer(body, PlayerMove(), GameParams(), DT, FromList(plate));
+        CHECK(body.grounded);
+        CHECK_NEAR(body.position[1], 10.0f, 1e-4f);
+    }
+
+    // and sideways into a wall, at walking speeds no tick could cover
+    std::vector<PhysicsBox> wall = { { { 9, 0, -5 }, { 9.01f, 4, 5 } } };
+    for (float speed : speeds) {
+        PlayerBody body = BodyAt(0, 0, 0, true);
+        for (int i = 0; i < 60; ++i) StepPlayer(body, Walk(1, 0, speed), GameParams(), DT, FromList(wall));
+        CHECK_NEAR(body.position[0], 9.0f - 0.3f, 1e-4f);
+        CHECK(body.position[1] == 0.0f);
+    }
+}
+
+TEST(PlayerPhysics_CornersStopOnBothWalls)
+{
+    VoxelWorld world;
+    for (int i = -10; i <= 4; i += 2) {
+        world.SetBlock(4, 1, i, 2);   // wall facing -x at x = 3
+        world.SetBlock(i, 1, 4, 2);   // wall facing -z at z = 3
+    }
+    const float diagonal = 0.70710678f;
+
+    // straight into the inside corner
+    PlayerBody body = BodyAt(0, 0, 0, true);
+    for (int i = 0; i < 240; ++i) StepPlayer(body, Walk(diagonal, diagonal), GameParams(), DT, FromWorld(world));
+    CHECK_NEAR(body.position[0], 2.7f, 1e-4f);
+    CHECK_NEAR(body.position[2], 2.7f, 1e-4f);
+    CHECK(body.position[1] == 0.0f);
+    CHECK(body.grounded);
+
+    // sliding along the x wall keeps the full z speed, the seams between
+    // its blocks don't catch
+    body = BodyAt(0, 0, -10, true);
+    for (int i = 0; i < 60; ++i) StepPlayer(body, Walk(diagonal, diagonal), GameParams(), DT, FromWorld(world));
+    CHECK_NEAR(body.position[0], 2.7f, 1e-4f);
+    CHECK_NEAR(body.position[2], -10.0f + 0.5f * WALK_SPEED * diagonal, 1e-3f);
+
+    // a box the player is already inside doesn't hold it
+    std::vector<PhysicsBox> inside = { { { -1, 0, -1 }, { 1, 2, 1 } } };
+    PhysicsBox player = { { -0.3f, 0, -0.3f }, { 0.3f, 1.8f, 0.3f } };
+    CHECK(SweepAxis(player, 0, 5.0f, inside) == 5.0f);
+    CHECK(SweepAxis(player, 1, -5.0f, inside) == -5.0f);
+}
+
+TEST(PlayerPhysics_StairsTakeAJumpEach)
+{
+    // four steps, each one block (2 units) higher than the last
+    VoxelWorld world;
+    for (int step = 0; step < 4; ++step) {
+        for (int z = -4; z <= 4; z += 2) {
+            for (int y = 1; y <= 1 + 2 * step; y += 2) world.SetBlock(4 + 2 * step, y, z, 2);
+        }
+    }
+
+    // there's no step-up, walking into the first one just stops
+    PlayerBody body = BodyAt(0, 0, 0, true);
+    for (int i = 0; i < 120; ++i) StepPlayer(body, Walk(1, 0), GameParams(), DT, FromWorld(world));
+    CHECK_NEAR(body.position[0], 2.7f, 1e-4f);
+    CHECK(body.position[1] == 0.0f);
+
+    // jumping whenever grounded climbs one step per jump
+    int landings = 0;
+    for (int i = 0; i < 600; ++i) {
+        if (body.grounded) Jump(body);
+        if (StepPlayer(body, Walk(1, 0), GameParams(), DT, FromWorld(world))) ++landings;
+        if (body.grounded && body.position[1] > 7.0f) break;
+    }
+    CHECK(body.grounded);
+    CHECK_NEAR(body.position[1], 8.0f, 1e-4f);
+    CHECK(body.position[0] > 9.0f - 0.3f && body.position[0] < 11.0f + 0.3f);
+    CHECK(landings == 4);
+}
+
+TEST(PlayerPhysics_SameInputsSameResult)
+{
+    TestRandom random(18);
+    std::vector<PhysicsBox> boxes;
+    for (int i = 0; i < 300; ++i) {
+        float x = random.Range(-30, 30), y = random.Range(0, 6), z = random.Range(-30, 30);
+        float w = random.Range(0.2f, 3.0f), h = random.Range(0.2f, 3.0f);
+        boxes.push_back({ { x - w, y, z - w }, { x + w, y + h, z + w } });
+    }
+    std::vector<PhysicsBox> reversed(boxes.rbegin(), boxes.rend());
+
+    auto run = [&](const std::vector<PhysicsBox>& list, std::vector<PlayerBody>& trace) {
+        TestRandom input(19);
+        PlayerBody body = BodyAt(0, 10, 0, false);
+        for (int i = 0; i < 2000; ++i) {
+            float angle = input.Range(0, 6.2831853f);
+            if (body.grounded && input.Int(0, 9) == 0) Jump(body);
+            StepPlayer(body, Walk(cosf(angle), sinf(angle), input.Range(5, 60)), GameParams(), DT, FromList(list));
+            trace.push_back(body);
+        }
+    };
+    std::vector<PlayerBody> a, b, c;
+    run(boxes, a);
+    run(boxes, b);
+    run(reversed, c);
+    REQUIRE(a.size() == b.size() && a.size() == c.size());
+    for (size_t i = 0; i < a.size(); ++i) {
+        CHECK(memcmp(a[i].position, b[i].position, sizeof(a[i].position)) == 0);
+        CHECK(memcmp(a[i].position, c[i].position, sizeof(a[i].position)) == 0);
+        CHECK(memcmp(a[i].velocity, c[i].velocity, sizeof(a[i].velocity)) == 0);
+        CHECK(a[i].grounded == c[i].grounded);
+    }
+}
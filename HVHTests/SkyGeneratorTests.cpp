@@ -0,0 +1,103 @@
+#include "Test.h"
+#include "SkyGenerator.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+
+namespace {
+    // how far GenerateSkyRow may land from the reference, per channel
+    const int SKY_ROW_TOLERANCE = 1;
+
+    SkyColors RandomColors(TestRandom& random)
+    {
+        SkyColors colors;
+        for (int c = 0; c < 3; ++c) {
+            colors.horizon[c] = random.Range(0, 1);
+            colors.zenith[c] = random.Range(0, 1);
+            colors.haze[c] = random.Range(0, 0.5f);
+        }
+        return colors;
+    }
+
+    // Every row of every face at this size. Returns the largest channel
+    // difference and prints the first texel past the tolerance.
+    int CompareWithReference(const SkyColors& colors, int size, size_t& texelsOff)
+    {
+        std::vector<uint8_t> fast(size * 4), reference(size * 4);
+        int worst = 0;
+        bool reported = false;
+        for (int face = 0; face < 6; ++face) {
+            for (int y = 0; y < size; ++y) {
+                GenerateSkyRow(colors, face, y, size, fast.data());
+                GenerateSkyRowReference(colors, face, y, size, reference.data());
+                for (int x = 0; x < size; ++x) {
+                    bool off = false;
+                    for (int c = 0; c < 4; ++c) {
+                        int diff = abs(fast[x * 4 + c] - reference[x * 4 + c]);
+                        if (diff > worst) worst = diff;
+                        off |= diff != 0;
+                        if (diff > SKY_ROW_TOLERANCE && !reported) {
+                            printf("  size %d face %d texel (%d, %d) channel %d: %d, reference %d\n", size, face, x, y, c,
+                                fast[x * 4 + c], reference[x * 4 + c]);
+                            reported = true;
+                        }
+                    }
+                    texelsOff += off;
+                }
+            }
+        }
+        return worst;
+    }
+}
+
+TEST(SkyGenerator_RowMatchesReference)
+{
+    // sizes that aren't a multiple of the 4 texel SIMD block take the scalar
+    // tail, the game's 512 is all SIMD
+    TestRandom random(23);
+    const int sizes[] = { 1, 3, 4, 7, 64, 130, SKY_FACE_SIZE };
+    size_t texels = 0, texelsOff = 0;
+    int worst = 0;
+    for (int size : sizes) {
+        for (int i = 0; i < (size == SKY_FACE_SIZE ? 2 : 8); ++i) {
+            SkyColors colors = RandomColors(random);
+            int diff = CompareWithReference(colors, size, texelsOff);
+            CHECK(diff <= SKY_ROW_TOLERANCE);
+            if (diff > worst) worst = diff;
+            texels += (size_t)size * size * 6;
+        }
+    }
+
+    // saturated colors push the sum past 1, both must clamp to 255
+    SkyColors bright = { { 1, 1, 1 }, { 1, 1, 1 }, { 1, 1, 1 } };
+    SkyColors dark = { { 0, 0, 0 }, { 0, 0, 0 }, { 0, 0, 0 } };
+    CHECK(CompareWithReference(bright, 64, texelsOff) <= SKY_ROW_TOLERANCE);
+    CHECK(CompareWithReference(dark, 64, texelsOff) == 0);
+    printf("  %zu texels, %zu off by at most %d\n", texels, texelsOff, worst);
+}
+
+TEST(SkyGenerator_ThreadsDontChangeTheSky)
+{
+    TestRandom random(24);
+    SkyColors colors = RandomColors(random);
+    std::vector<uint8_t> single, threaded;
+    WorkerPool pool;
+    GenerateSky(colors, 64, pool, single);
+    REQUIRE(single.size() == (size_t)6 * 64 * 64 * 4);
+    // one pool throughout, so the later bakes reuse its sleeping threads
+    for (int threads : { 2, 3, 7, 7, 500 }) {
+        pool.SetThreadCount(threads);
+        GenerateSky(colors, 64, pool, threaded);
+        CHECK(threaded == single);
+    }
+
+    // and the cubemap is GenerateSkyRow row by row, alpha opaque
+    std::vector<uint8_t> row(64 * 4);
+    for (int face = 0; face < 6; ++face) {
+        GenerateSkyRow(colors, face, 17, 64, row.data());
+        CHECK(std::equal(row.begin(), row.end(), single.begin() + ((size_t)face * 64 + 17) * 64 * 4));
+    }
+    for (size_t i = 3; i < single.size(); i += 4) {
+        if (single[i] != 255) { CHECK(single[i] == 255); break; }
+    }
+}
@@ -0,0 +1,106 @@
+#include "Test.h"
+#include "SkyShading.h"
+#include <string>
+
+using SkyShading::float3;
+using SkyShading::SkyColor;
+
+namespace {
+    const float3 BLACK = { 0, 0, 0 };
+    const float3 WHITE = { 1, 1, 1 };
+    // where the ripple term is 0.5, n.x * 10 + n.z * 7 = 0, so the shade is
+    // exactly 0.985
+    const float FLAT_SHADE = 0.97f + 0.03f * 0.5f;
+
+    void CheckColor(float3 color, float r, float g, float b)
+    {
+        CHECK_NEAR(color.x, r, 1e-5f);
+        CHECK_NEAR(color.y, g, 1e-5f);
+        CHECK_NEAR(color.z, b, 1e-5f);
+    }
+}
+
+TEST(SkyShading_PolesAndHorizon)
+{
+    const float3 horizon = { 0.7f, 0.8f, 0.9f }, zenith = { 0.1f, 0.2f, 0.4f }, haze = { 0.4f, 0.3f, 0.2f };
+    const float poleHaze = expf(-3.5f);
+
+    // straight up is the zenith color, straight down the horizon color, both
+    // with what's left of the haze
+    CheckColor(SkyColor({ 0, 1, 0 }, horizon, zenith, haze),
+        (0.1f + 0.4f * poleHaze) * FLAT_SHADE, (0.2f + 0.3f * poleHaze) * FLAT_SHADE, (0.4f + 0.2f * poleHaze) * FLAT_SHADE);
+    CheckColor(SkyColor({ 0, -1, 0 }, horizon, zenith, haze),
+        (0.7f + 0.4f * poleHaze) * FLAT_SHADE, (0.8f + 0.3f * poleHaze) * FLAT_SHADE, (0.9f + 0.2f * poleHaze) * FLAT_SHADE);
+
+    // level, the gradient is 0.5^0.6 of the way up and the haze is at full
+    float blend = powf(0.5f, 0.6f);
+    CheckColor(SkyColor({ 7, 0, -10 }, horizon, zenith, haze),
+        (0.7f + (0.1f - 0.7f) * blend + 0.4f) * FLAT_SHADE,
+        (0.8f + (0.2f - 0.8f) * blend + 0.3f) * FLAT_SHADE,
+        (0.9f + (0.4f - 0.9f) * blend + 0.2f) * FLAT_SHADE);
+}
+
+TEST(SkyShading_DirectionLengthDoesntMatter)
+{
+    TestRandom random(24);
+    const float3 horizon = { 0.9f, 0.5f, 0.2f }, zenith = { 0.0f, 0.3f, 0.8f }, haze = { 0.2f, 0.2f, 0.3f };
+    for (int i = 0; i < 1000; ++i) {
+        float3 dir = { random.Range(-1, 1), random.Range(-1, 1), random.Range(-1, 1) };
+        if (fabsf(dir.x) + fabsf(dir.y) + fabsf(dir.z) < 1e-3f) continue;
+        float3 a = SkyColor(dir, horizon, zenith, haze);
+        float3 b = SkyColor(dir * random.Range(0.01f, 500.0f), horizon, zenith, haze);
+        CHECK_NEAR(a.x, b.x, 1e-5f);
+        CHECK_NEAR(a.y, b.y, 1e-5f);
+        CHECK_NEAR(a.z, b.z, 1e-5f);
+    }
+}
+
+TEST(SkyShading_GradientAndRippleStayInRange)
+{
+    // black at the horizon, white at the zenith, no haze: brighter the
+    // higher you look along a ripple-free line
+    float last = -1.0f;
+    for (int i = -100; i <= 100; ++i) {
+        float y = i / 10.0f;
+        float3 color = SkyColor({ 7, y, -10 }, BLACK, WHITE, BLACK);
+        CHECK(color.x > last);
+        CHECK(color.x >= 0.0f && color.x <= FLAT_SHADE + 1e-6f);
+        last = color.x;
+    }
+
+    // one flat color: the ripple only ever darkens it by up to 3%
+    TestRandom random(25);
+    const float3 gray = { 0.5f, 0.5f, 0.5f };
+    float darkest = 1.0f, brightest = 0.0f;
+    for (int i = 0; i < 10000; ++i) {
+        float3 dir = { random.Range(-1, 1), random.Range(-1, 1), random.Range(-1, 1) };
+        if (fabsf(dir.x) + fabsf(dir.y) + fabsf(dir.z) < 1e-3f) continue;
+        float3 color = SkyColor(dir, gray, gray, BLACK);
+        darkest = fminf(darkest, color.x);
+        brightest = fmaxf(brightest, color.x);
+        CHECK(color.x == color.y && color.y == color.z);
+    }
+    CHECK(darkest >= 0.5f * 0.97f - 1e-6f);
+    CHECK(brightest <= 0.5f + 1e-6f);
+    CHECK(brightest - darkest > 0.5f * 0.02f);
+}
+
+TEST(SkyShading_HlslTextIsTheCompiledFunction)
+{
+    // what the analytic pixel shader is built from: the same function, with
+    // nothing only C++ accepts
+    std::string hlsl = SkyShading::SKY_SHADING_HLSL;
+    CHECK(hlsl.find("float3 SkyColor(float3 dir, float3 horizon, float3 zenith, float3 haze)") != std::string::npos);
+    CHECK(hlsl.find("pow(n.y * 0.5f + 0.5f, 0.6f)") != std::string::npos);
+    CHECK(hlsl.find("exp(-abs(n.y) * 3.5f)") != std::string::npos);
+    CHECK(hlsl.find("::") == std::string::npos);
+    CHECK(hlsl.find("std") == std::string::npos);
+    CHECK(hlsl.find("powf") == std::string::npos);
+    int depth = 0;
+    for (char c : hlsl) {
+        if (c == '{' || c == '(') ++depth;
+        if (c == '}' || c == ')') --depth;
+        CHECK(depth >= 0);
+    }
+    CHECK(depth == 0);
+}
@@ -0,0 +1,86 @@
+#include "Test.h"
+#include "SpatialGrid.h"
+#include <algorithm>
+
+namespace {
+    struct Object { float x, y, z, halfExtent; };
+
+    bool Overlaps(const Object& o, float minX, float minY, float minZ, float maxX, float maxY, float maxZ)
+    {
+        return o.x + o.halfExtent >= minX && o.x - o.halfExtent <= maxX &&
+            o.y + o.halfExtent >= minY && o.y - o.halfExtent <= maxY &&
+            o.z + o.halfExtent >= minZ && o.z - o.halfExtent <= maxZ;
+    }
+
+    bool Contains(const std::vector<uint32_t>& ids, uint32_t id)
+    {
+        return std::find(ids.begin(), ids.end(), id) != ids.end();
+    }
+}
+
+// every object that really overlaps a box comes back, whatever cell its center is in
+TEST(SpatialGrid_QueryBoxFindsEveryOverlap)
+{
+    TestRandom random(7);
+    SpatialGrid grid(4.0f);
+    std::vector<Object> objects;
+    for (uint32_t i = 0; i < 2000; ++i) {
+        Object o = { random.Range(-60, 60), random.Range(-10, 10), random.Range(-60, 60), random.Range(0.5f, 6.0f) };
+        grid.Insert(i, o.x, o.y, o.z, o.halfExtent);
+        objects.push_back(o);
+    }
+
+    std::vector<uint32_t> found;
+    for (int q = 0; q < 300; ++q) {
+        float x = random.Range(-60, 60), y = random.Range(-10, 10), z = random.Range(-60, 60);
+        float r = random.Range(0.1f, 3.0f);
+        found.clear();
+        grid.QueryBox(x - r, y - r, z - r, x + r, y + r, z + r, found);
+        for (uint32_t i = 0; i < objects.size(); ++i) {
+            if (Overlaps(objects[i], x - r, y - r, z - r, x + r, y + r, z + r)) CHECK(Contains(found, i));
+        }
+    }
+}
+
+TEST(SpatialGrid_RemovingTheLargestObjectShrinksQueries)
+{
+    SpatialGrid grid(4.0f);
+    for (uint32_t i = 0; i < 100; ++i) grid.Insert(i, i * 2.0f, 0.0f, 0.0f, 1.0f);
+    grid.Insert(100, 0.0f, 0.0f, 400.0f, 64.0f);
+    grid.Insert(101, 0.0f, 0.0f, 500.0f, 64.0f);
+    CHECK(grid.GetMaxHalfExtent() == 64.0f);
+
+    // one of two equally large objects gone: still widened
+    CHECK(grid.Remove(100, 0.0f, 0.0f, 400.0f));
+    CHECK(grid.GetMaxHalfExtent() == 64.0f);
+
+    CHECK(grid.Remove(101, 0.0f, 0.0f, 500.0f));
+    CHECK(grid.GetMaxHalfExtent() == 1.0f);
+
+    // a box 10 cells from every small object finds nothing once the big ones are gone
+    std::vector<uint32_t> found;
+    grid.QueryBox(-1.0f, -1.0f, 40.0f, 1.0f, 1.0f, 42.0f, found);
+    CHECK(found.empty());
+
+    for (uint32_t i = 0; i < 100; ++i) CHECK(grid.Remove(i, i * 2.0f, 0.0f, 0.0f));
+    CHECK(grid.GetMaxHalfExtent() == 0.0f);
+    CHECK(grid.GetObjectCount() == 0);
+    CHECK(grid.GetCellCount() == 0);
+}
+
+// the swap-and-pop GameEngine does: remove one id, renumber the tail into it
+TEST(SpatialGrid_RenumberAfterSwapRemove)
+{
+    SpatialGrid grid(4.0f);
+    grid.Insert(0, 1.0f, 1.0f, 1.0f, 1.0f);
+    grid.Insert(1, 10.0f, 1.0f, 1.0f, 1.0f);
+    grid.Insert(2, 20.0f, 1.0f, 1.0f, 1.0f);
+
+    CHECK(grid.Remove(0, 1.0f, 1.0f, 1.0f));
+    CHECK(grid.Renumber(2, 0, 20.0f, 1.0f, 1.0f));
+    CHECK(!grid.Remove(0, 1.0f, 1.0f, 1.0f));
+
+    std::vector<uint32_t> found;
+    grid.QueryBox(19.5f, 0.5f, 0.5f, 20.5f, 1.5f, 1.5f, found);
+    CHECK(found.size() == 1 && found[0] == 0);
+}
@@ -0,0 +1,50 @@
+#pragma once
+#include <cmath>
+#include <vector>
+
+// Self-registering tests: TEST(name) { CHECK(...); }. hvh-tests runs every
+// test, or those whose name contains one of its arguments, and exits nonzero
+// if any check failed. Tests are headless and deterministic: fixed seeds, no
+// wall clock in anything that's asserted.
+struct TestCase {
+    const char* name;
+    void (*run)();
+};
+
+std::vector<TestCase>& TestRegistry();
+void TestFail(const char* file, int line, const char* what);
+
+struct TestRegistrar {
+    TestRegistrar(const char* name, void (*run)()) { TestRegistry().push_back({ name, run }); }
+};
+
+#define TEST(name) \
+    static void Test_##name(); \
+    static TestRegistrar testRegistrar_##name(#name, Test_##name); \
+    static void Test_##name()
+
+#define CHECK(cond) \
+    do { if (!(cond)) TestFail(__FILE__, __LINE__, #cond); } while (0)
+#define CHECK_NEAR(a, b, tolerance) \
+    do { if (!(std::fabs((double)(a) - (double)(b)) <= (double)(tolerance))) \
+        TestFail(__FILE__, __LINE__, #a " ~= " #b " within " #tolerance); } while (0)
+// stops the test, for checks later lines depend on
+#define REQUIRE(cond) \
+    do { if (!(cond)) { TestFail(__FILE__, __LINE__, #cond); return; } } while (0)
+
+// Same generator as the benchmarks: a fixed seed gives the same sequence on
+// every platform, unlike the distributions in <random>.
+struct TestRandom {
+    unsigned state;
+    explicit TestRandom(unsigned seed) : state(seed ? seed : 1) {}
+    unsigned Next()
+    {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        return state;
+    }
+    // [lo, hi)
+    float Range(float lo, float hi) { return lo + (hi - lo) * (Next() >> 8) * (1.0f / 16777216.0f); }
+    int Int(int lo, int hi) { return lo + (int)(Next() % (unsigned)(hi - lo + 1)); }
+};
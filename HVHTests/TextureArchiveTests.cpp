@@ -0,0 +1,134 @@
+#include "Test.h"
+#include "TextureArchive.h"
+#include "MipChain.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+// The committed HVH/Textures/blocks.hvht against its run-length sources, the
+// check hvh-texpack --verify makes, so a stale archive or a loader regression
+// fails the suite rather than showing up as wrong textures in game.
+namespace fs = std::filesystem;
+
+namespace {
+    std::string TexturesDir()
+    {
+        std::string dir = __FILE__;
+        size_t slash = dir.find_last_of("/\\");
+        dir = slash == std::string::npos ? "" : dir.substr(0, slash + 1);
+        return dir + "../HVH/Textures/";
+    }
+
+    bool SameMip(const TextureMip& mip, const std::vector<uint8_t>& expected)
+    {
+        return (size_t)mip.width * mip.height * 4 == expected.size() &&
+            memcmp(mip.pixels, expected.data(), expected.size()) == 0;
+    }
+
+    std::string ScratchPath(const char* name)
+    {
+        return (fs::temp_directory_path() / name).string();
+    }
+}
+
+TEST(TextureArchive_ShippedArchiveMatchesSources)
+{
+    std::vector<fs::path> sources;
+    for (const auto& item : fs::directory_iterator(TexturesDir())) {
+        if (item.path().extension() == ".rle") sources.push_back(item.path());
+    }
+    std::sort(sources.begin(), sources.end());
+    REQUIRE(!sources.empty());
+
+    TextureArchive archive;
+    REQUIRE(archive.Open(TexturesDir() + "blocks.hvht"));
+    CHECK(archive.GetTextureCount() == sources.size());
+
+    for (const fs::path& path : sources) {
+        PackedTexture expected;
+        expected.name = path.stem().string();
+        std::vector<uint8_t> pixels;
+        std::string error;
+        REQUIRE(ReadRleTexture(path.string(), expected.width, expected.height, pixels, error));
+        BuildMipChain(expected, pixels);
+
+        int index = archive.Find(expected.name);
+        std::vector<TextureMip> mips;
+        if (index < 0 || !archive.GetMips(index, mips)) {
+            printf("  %s: missing from the archive\n", expected.name.c_str());
+            CHECK(index >= 0);
+            continue;
+        }
+        REQUIRE(mips.size() == (size_t)MipCount(expected.width, expected.height));
+        REQUIRE(mips.size() == expected.mips.size());
+
+        // mip 0 is the source exactly, every other level what BuildMipChain
+        // makes of it, and that the reference filter of the level above
+        CHECK(mips[0].width == expected.width && mips[0].height == expected.height);
+        CHECK(SameMip(mips[0], pixels));
+        for (size_t level = 1; level < mips.size(); ++level) {
+            bool same = SameMip(mips[level], expected.mips[level]);
+            if (!same) printf("  %s: mip %zu differs from BuildMipChain\n", expected.name.c_str(), level);
+            CHECK(same);
+
+            std::vector<uint8_t> reference((size_t)mips[level].width * mips[level].height * 4);
+            DownsampleRGBA8Reference(mips[level - 1].pixels, mips[level - 1].width, mips[level - 1].height,
+                reference.data());
+            CHECK(SameMip(mips[level], reference));
+        }
+    }
+}
+
+TEST(TextureArchive_RoundTripAndDamagedFiles)
+{
+    // two odd sized textures, so rows aren't a multiple of 16 bytes
+    std::vector<PackedTexture> textures(2);
+    TestRandom random(21);
+    const uint32_t sizes[2][2] = { { 5, 3 }, { 1, 9 } };
+    for (int i = 0; i < 2; ++i) {
+        textures[i].name = i == 0 ? "first" : "second";
+        textures[i].width = sizes[i][0];
+        textures[i].height = sizes[i][1];
+        std::vector<uint8_t> pixels((size_t)sizes[i][0] * sizes[i][1] * 4);
+        for (uint8_t& b : pixels) b = (uint8_t)random.Next();
+        BuildMipChain(textures[i], pixels);
+    }
+
+    std::string path = ScratchPath("hvh-tests-archive.hvht");
+    REQUIRE(WriteTextureArchive(path, textures));
+    {
+        TextureArchive archive;
+        REQUIRE(archive.Open(path));
+        REQUIRE(archive.GetTextureCount() == 2);
+        CHECK(archive.Find("no such texture") == -1);
+        for (const PackedTexture& texture : textures) {
+            int index = archive.Find(texture.name);
+            std::vector<TextureMip> mips;
+            REQUIRE(index >= 0 && archive.GetMips(index, mips));
+            REQUIRE(mips.size() == texture.mips.size());
+            for (size_t level = 0; level < mips.size(); ++level) CHECK(SameMip(mips[level], texture.mips[level]));
+        }
+    }
+
+    // cut short, a mip would run past the end: rejected rather than read
+    std::vector<char> bytes;
+    {
+        std::ifstream in(path, std::ios::binary);
+        bytes.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+    }
+    REQUIRE(bytes.size() > TEXTURE_ARCHIVE_HEADER_SIZE + 2 * TEXTURE_ARCHIVE_ENTRY_SIZE);
+    std::ofstream(path, std::ios::binary | std::ios::trunc).write(bytes.data(), bytes.size() - 1);
+    TextureArchive archive;
+    CHECK(!archive.Open(path));
+
+    bytes[0] = 'X';
+    std::ofstream(path, std::ios::binary | std::ios::trunc).write(bytes.data(), bytes.size());
+    CHECK(!archive.Open(path));
+    CHECK(!archive.Open(path + ".missing"));
+
+    std::error_code ec;
+    fs::remove(path, ec);
+}
@@ -0,0 +1,100 @@
+#include "Test.h"
+#include "VoxelWorld.h"
+#include <atomic>
+#include <thread>
+
+TEST(VoxelWorld_SnapshotKeepsItsBlocks)
+{
+    VoxelWorld world;
+    for (int i = 0; i < 100; ++i) world.SetBlock(i, 0, -i, 2);
+    VoxelWorld snapshot = world.Snapshot();
+    CHECK(world.HasLiveSnapshot());
+
+    for (int i = 0; i < 100; i += 2) world.RemoveBlock(i, 0, -i);
+    world.SetBlock(1, 5, 1, 3);
+    world.SetChunk(10, 10, 10, std::vector<BlockId>(VOXEL_CHUNK_VOLUME, 4).data());
+    CHECK(snapshot.GetBlockCount() == 100);
+    for (int i = 0; i < 100; ++i) CHECK(snapshot.GetBlock(i, 0, -i) == 2);
+    CHECK(snapshot.GetBlock(1, 5, 1) == BLOCK_AIR);
+    CHECK(world.GetBlockCount() == 50 + 1 + VOXEL_CHUNK_VOLUME);
+
+    // and the other way round: editing the snapshot leaves the world alone
+    snapshot.SetBlock(1, 0, -1, 5);
+    CHECK(world.GetBlock(1, 0, -1) == 2);
+}
+
+TEST(VoxelWorld_ChunksAreCopiedOncePerSnapshot)
+{
+    VoxelWorld world;
+    world.SetBlock(0, 0, 0, 2);
+    const VoxelChunk* original = world.FindChunk(0, 0, 0);
+
+    // no snapshot: edits go in place
+    world.SetBlock(1, 0, 0, 2);
+    CHECK(world.FindChunk(0, 0, 0) == original);
+
+    {
+        VoxelWorld snapshot = world.Snapshot();
+        world.SetBlock(2, 0, 0, 2);
+        const VoxelChunk* copy = world.FindChunk(0, 0, 0);
+        CHECK(copy != original);
+        CHECK(snapshot.FindChunk(0, 0, 0) == original);
+        world.SetBlock(3, 0, 0, 2);
+        CHECK(world.FindChunk(0, 0, 0) == copy);
+    }
+
+    // the snapshot is gone, but only ReleaseSnapshots says so
+    const VoxelChunk* current = world.FindChunk(0, 0, 0);
+    world.SetBlock(4, 0, 0, 2);
+    CHECK(world.FindChunk(0, 0, 0) == current);
+    world.Snapshot();
+    world.SetBlock(5, 0, 0, 2);
+    CHECK(world.FindChunk(0, 0, 0) != current);
+    world.ReleaseSnapshots();
+    CHECK(!world.HasLiveSnapshot());
+    current = world.FindChunk(0, 0, 0);
+    world.SetBlock(6, 0, 0, 2);
+    CHECK(world.FindChunk(0, 0, 0) == current);
+    CHECK(world.GetBlockCount() == 7);
+}
+
+TEST(VoxelWorld_SwapCarriesSharing)
+{
+    VoxelWorld world, loaded;
+    world.SetBlock(0, 0, 0, 2);
+    loaded.SetBlock(0, 0, 0, 3);
+    VoxelWorld snapshot = world.Snapshot();
+
+    // the shared chunks now live in loaded, which must still copy them
+    world.Swap(loaded);
+    CHECK(!world.HasLiveSnapshot());
+    CHECK(loaded.HasLiveSnapshot());
+    loaded.SetBlock(0, 0, 0, 4);
+    CHECK(snapshot.GetBlock(0, 0, 0) == 2);
+    CHECK(world.GetBlock(0, 0, 0) == 3);
+}
+
+TEST(VoxelWorld_SnapshotReadOnAnotherThread)
+{
+    // what a background save does; run under TSan this catches edits that
+    // land in a chunk the worker is still reading
+    VoxelWorld world;
+    for (int x = 0; x < 64; ++x) {
+        for (int z = 0; z < 64; ++z) world.SetBlock(x, 0, z, 2);
+    }
+
+    for (int round = 0; round < 20; ++round) {
+        VoxelWorld snapshot = world.Snapshot();
+        size_t expected = snapshot.GetBlockCount();
+        std::atomic<size_t> counted{ 0 };
+        std::thread worker([&counted, snapshot = std::move(snapshot)]() {
+            size_t count = 0;
+            snapshot.ForEachBlock([&](int, int, int, BlockId id) { count += id != BLOCK_AIR; });
+            counted = count;
+        });
+        for (int x = 0; x < 64; ++x) world.SetBlock(x, 0, (x * 7 + round) & 63, (round & 1) ? 2 : BLOCK_AIR);
+        worker.join();
+        world.ReleaseSnapshots();
+        CHECK(counted == expected);
+    }
+}
@@ -0,0 +1,33 @@
+#include "Test.h"
+#include "WorkerPool.h"
+#include <atomic>
+#include <thread>
+
+TEST(WorkerPool_EveryShareRunsOncePerJob)
+{
+    WorkerPool pool;
+    CHECK(pool.GetThreadCount() == 1);
+    for (int threads : { 1, 4, 4, 2, 9, 1 }) {
+        pool.SetThreadCount(threads);
+        REQUIRE(pool.GetThreadCount() == threads);
+
+        // many jobs back to back, as a step per tick would give it
+        std::vector<std::atomic<int>> runs(threads);
+        for (auto& count : runs) count = 0;
+        std::atomic<int> badCount(0), offCaller(0);
+        const std::thread::id caller = std::this_thread::get_id();
+        for (int job = 0; job < 200; ++job) {
+            pool.Run([&](int index, int count) {
+                if (count != threads) ++badCount;
+                if (index == 0 && std::this_thread::get_id() != caller) ++offCaller;
+                ++runs[index];
+                });
+        }
+        CHECK(badCount == 0);
+        CHECK(offCaller == 0);
+        for (auto& count : runs) CHECK(count == 200);
+    }
+
+    pool.SetThreadCount(0);
+    CHECK(pool.GetThreadCount() == 1);
+}
@@ -0,0 +1,93 @@
+#include "Test.h"
+#include "WorldPresets.h"
+
+namespace {
+    // the table the game ships, next to the engine sources
+    std::string ShippedTablePath()
+    {
+        std::string dir = __FILE__;
+        size_t slash = dir.find_last_of("/\\");
+        dir = slash == std::string::npos ? "" : dir.substr(0, slash + 1);
+        return dir + "../HVH/WorldPresets.txt";
+    }
+}
+
+TEST(WorldPresets_ParseFillsEachMember)
+{
+    // 1..24 in file order, so every number has to land in its own member
+    std::string row = "counting";
+    for (int i = 1; i <= WORLD_PRESET_FLOATS; ++i) row += " " + std::to_string(i);
+    row += "   counted to twenty four  \n";
+
+    WorldPresetTable table;
+    std::string error;
+    REQUIRE(table.Parse("# comment line\n\n" + row, "test", error));
+    REQUIRE(table.GetCount() == 1);
+    CHECK(table.Find("counting") == 0);
+    CHECK(table.GetDescription(0) == "counted to twenty four");
+
+    const WorldPreset& preset = table.Get(0);
+    const float* members[] = { preset.horizon, preset.zenith, preset.haze, preset.fogNear, preset.fogFar,
+        preset.lightDir, preset.lightColor, preset.ambient };
+    for (int field = 0; field < WORLD_PRESET_FIELD_COUNT; ++field) {
+        CHECK(&(preset.*WORLD_PRESET_FIELDS[field])[0] == members[field]);
+        for (int c = 0; c < 3; ++c) CHECK(members[field][c] == (float)(field * 3 + c + 1));
+    }
+}
+
+TEST(WorldPresets_BadRowsAreRejected)
+{
+    WorldPresetTable table;
+    std::string error;
+    std::string row = "short";
+    for (int i = 1; i < WORLD_PRESET_FLOATS; ++i) row += " 0.5";
+    CHECK(!table.Parse(row, "test", error));
+    CHECK(error == "test:1: expected 24 numbers after 'short'");
+    CHECK(table.GetCount() == 0);
+
+    CHECK(!table.Parse("typo 1 2 3 4 5 6 7 8 9 10 11 12 x3 14 15 16 17 18 19 20 21 22 23 24", "test", error));
+    CHECK(error == "test:1: expected 24 numbers after 'typo'");
+
+    std::string good = "twice";
+    for (int i = 0; i < WORLD_PRESET_FLOATS; ++i) good += " 1";
+    CHECK(!table.Parse(good + "\n" + good, "test", error));
+    CHECK(error == "test:2: preset 'twice' defined twice");
+    CHECK(table.GetCount() == 0);
+}
+
+TEST(WorldPresets_LerpBlendsEveryMember)
+{
+    WorldPreset a, b;
+    for (int field = 0; field < WORLD_PRESET_FIELD_COUNT; ++field) {
+        for (int c = 0; c < 3; ++c) {
+            (a.*WORLD_PRESET_FIELDS[field])[c] = (float)(field * 3 + c);
+            (b.*WORLD_PRESET_FIELDS[field])[c] = -10.0f * (field * 3 + c) + 0.1f;
+        }
+    }
+    WorldPreset start = LerpPresets(a, b, 0.0f), end = LerpPresets(a, b, 1.0f), mid = LerpPresets(a, b, 0.25f);
+    for (auto field : WORLD_PRESET_FIELDS) {
+        for (int c = 0; c < 3; ++c) {
+            CHECK((start.*field)[c] == (a.*field)[c]);
+            CHECK((end.*field)[c] == (b.*field)[c]);
+            CHECK_NEAR((mid.*field)[c], (a.*field)[c] * 0.75f + (b.*field)[c] * 0.25f, 1e-5f);
+        }
+    }
+    CHECK(mid.ambient[2] != a.ambient[2]);
+}
+
+TEST(WorldPresets_ShippedTableLoads)
+{
+    WorldPresetTable table;
+    std::string error;
+    REQUIRE(table.Load(ShippedTablePath(), error));
+    CHECK(table.GetCount() >= 10);
+    int night = table.Find("night");
+    REQUIRE(night >= 0);
+    CHECK(table.Get(night).lightColor[2] == 0.8f);
+    CHECK(table.Get(night).ambient[2] == 0.15f);
+    CHECK(table.Find("no such preset") == -1);
+    CHECK(table.ListNames().compare(0, 15, "default, sunset") == 0);
+
+    CHECK(!table.Load(ShippedTablePath() + ".missing", error));
+    CHECK(table.GetCount() == 0);
+}
@@ -0,0 +1,44 @@
+#include "Test.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+// Usage: hvh-tests [name filter ...]
+std::vector<TestCase>& TestRegistry()
+{
+    static std::vector<TestCase> registry;
+    return registry;
+}
+
+static int currentFailures = 0;
+
+void TestFail(const char* file, int line, const char* what)
+{
+    const char* name = strrchr(file, '/');
+    if (!name) name = strrchr(file, '\\');
+    printf("  %s:%d: %s\n", name ? name + 1 : file, line, what);
+    ++currentFailures;
+}
+
+int main(int argc, char* argv[])
+{
+    std::vector<TestCase> cases = TestRegistry();
+    std::sort(cases.begin(), cases.end(),
+        [](const TestCase& a, const TestCase& b) { return strcmp(a.name, b.name) < 0; });
+
+    int ran = 0, failed = 0;
+    for (const TestCase& c : cases) {
+        bool wanted = argc < 2;
+        for (int i = 1; i < argc && !wanted; ++i) wanted = strstr(c.name, argv[i]) != nullptr;
+        if (!wanted) continue;
+
+        currentFailures = 0;
+        c.run();
+        printf("%s %s\n", currentFailures ? "FAIL" : "ok  ", c.name);
+        fflush(stdout);
+        ++ran;
+        if (currentFailures) ++failed;
+    }
+    printf("%d of %d tests passed\n", ran - failed, ran);
+    return failed || ran == 0 ? 1 : 0;
+}
@@ -0,0 +1,109 @@
+#include "TextureArchive.h"
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Usage: HVHTexturePack <source dir> <archive> [--verify]
+// Packs every <name>.rle under the source dir into the archive, with its mip
+// chain. --verify packs nothing; it decodes the archive and checks it matches
+// the sources bit for bit, mips included. hvh-bench mip_chain times the mip
+// filter.
+namespace fs = std::filesystem;
+
+static bool LoadSources(const std::string& dir, std::vector<PackedTexture>& out)
+{
+    std::vector<fs::path> paths;
+    std::error_code ec;
+    for (const auto& item : fs::directory_iterator(dir, ec)) {
+        if (item.is_regular_file() && item.path().extension() == ".rle") paths.push_back(item.path());
+    }
+    if (ec) {
+        std::cerr << "Can't list " << dir << ": " << ec.message() << std::endl;
+        return false;
+    }
+    // sorted, so the same sources always give the same archive
+    std::sort(paths.begin(), paths.end());
+
+    for (const auto& path : paths) {
+        PackedTexture texture;
+        texture.name = path.stem().string();
+        if (texture.name.size() > TEXTURE_ARCHIVE_NAME_SIZE) {
+            std::cerr << path.string() << ": name longer than " << TEXTURE_ARCHIVE_NAME_SIZE << " characters" << std::endl;
+            return false;
+        }
+        std::vector<uint8_t> pixels;
+        std::string error;
+        if (!ReadRleTexture(path.string(), texture.width, texture.height, pixels, error)) {
+            std::cerr << error << std::endl;
+            return false;
+        }
+        BuildMipChain(texture, std::move(pixels));
+        out.push_back(std::move(texture));
+    }
+    return true;
+}
+
+static int Verify(const std::vector<PackedTexture>& sources, const std::string& archivePath)
+{
+    TextureArchive archive;
+    if (!archive.Open(archivePath)) {
+        std::cerr << "Can't open " << archivePath << " as a texture archive" << std::endl;
+        return 1;
+    }
+
+    int failures = 0;
+    if (archive.GetTextureCount() != sources.size()) {
+        std::cerr << archivePath << " has " << archive.GetTextureCount() << " textures, the sources " <<
+            sources.size() << std::endl;
+        ++failures;
+    }
+    for (const PackedTexture& source : sources) {
+        int index = archive.Find(source.name);
+        std::vector<TextureMip> mips;
+        if (index < 0 || !archive.GetMips(index, mips)) {
+            std::cerr << source.name << ": missing from the archive" << std::endl;
+            ++failures;
+            continue;
+        }
+        bool same = mips.size() == source.mips.size();
+        for (size_t level = 0; same && level < mips.size(); ++level) {
+            same = (size_t)mips[level].width * mips[level].height * 4 == source.mips[level].size() &&
+                memcmp(mips[level].pixels, source.mips[level].data(), source.mips[level].size()) == 0;
+        }
+        std::cout << source.name << ": " << (same ? "matches" : "DIFFERS") << std::endl;
+        if (!same) ++failures;
+    }
+    return failures == 0 ? 0 : 1;
+}
+
+int main(int argc, char* argv[])
+{
+    bool verify = argc == 4 && std::string(argv[3]) == "--verify";
+    if (argc != 3 && !verify) {
+        std::cerr << "Usage: " << argv[0] << " <source dir> <archive> [--verify]" << std::endl;
+        return 2;
+    }
+
+    std::vector<PackedTexture> textures;
+    if (!LoadSources(argv[1], textures)) return 1;
+    if (textures.empty()) {
+        std::cerr << "No .rle sources in " << argv[1] << std::endl;
+        return 1;
+    }
+    if (verify) return Verify(textures, argv[2]);
+
+    if (!WriteTextureArchive(argv[2], textures)) {
+        std::cerr << "Can't write " << argv[2] << std::endl;
+        return 1;
+    }
+    for (const PackedTexture& texture : textures) {
+        std::cout << texture.name << ": " << texture.width << "x" << texture.height << ", " <<
+            texture.mips.size() << " mips" << std::endl;
+    }
+    std::cout << "Packed " << textures.size() << " textures into " << argv[2] << " (" <<
+        fs::file_size(argv[2]) << " bytes)" << std::endl;
+    return 0;
+}